@@ -89,6 +89,15 @@ QSharedPointer<RegisterFileValidator> AddressBlockValidator::getRegisterFileVali
 // Function: AddressBlockValidator::validate()
 //-----------------------------------------------------------------------------
 bool AddressBlockValidator::validate(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits)
+{
+    return validateShallow(addressBlock, addressUnitBits) && hasValidRegisters(addressBlock, addressUnitBits);
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::validateShallow()
+//-----------------------------------------------------------------------------
+bool AddressBlockValidator::validateShallow(QSharedPointer<AddressBlock> addressBlock,
+    QString const& addressUnitBits)
 {
     bool validAmongSiblings = validComparedToSiblings(addressBlock);
 
@@ -97,7 +106,7 @@ bool AddressBlockValidator::validate(QSharedPointer<AddressBlock> addressBlock,
         return MemoryBlockValidator::validate(addressBlock) &&
             hasValidRange(addressBlock) &&
             hasValidWidth(addressBlock) &&
-            hasValidRegisterData(addressBlock, addressUnitBits) &&
+            hasValidRegisterLayout(addressBlock, addressUnitBits) &&
             hasValidUsage(addressBlock) && validAmongSiblings;
     }
     else if (docRevision_ == Document::Revision::Std22)
@@ -112,7 +121,7 @@ bool AddressBlockValidator::validate(QSharedPointer<AddressBlock> addressBlock,
         return validAmongSiblings && MemoryBlockValidator::validate(addressBlock) &&
             hasValidRegisterAlignment(addressBlock) && hasValidMemoryArray(addressBlock) &&
             hasValidUsage(addressBlock) && hasValidAccessPolicies(addressBlock) &&
-            hasValidRegisterData(addressBlock, addressUnitBits) &&
+            hasValidRegisterLayout(addressBlock, addressUnitBits) &&
             hasValidStructure(addressBlock) && validAmongSiblings;
     }
 
@@ -146,6 +155,15 @@ bool AddressBlockValidator::hasValidWidth(QSharedPointer<AddressBlock> addressBl
 //-----------------------------------------------------------------------------
 bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> addressBlock,
     QString const& addressUnitBits)
+{
+    return hasValidRegisterLayout(addressBlock, addressUnitBits) && hasValidRegisters(addressBlock, addressUnitBits);
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::hasValidRegisterLayout()
+//-----------------------------------------------------------------------------
+bool AddressBlockValidator::hasValidRegisterLayout(QSharedPointer<AddressBlock> addressBlock,
+    QString const& addressUnitBits)
 {
     if (addressBlock->getRegisterData()->isEmpty())
     {
@@ -263,13 +281,24 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
         }
     }
 
-    if (errorFound)
+    return errorFound == false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockValidator::hasValidRegisters()
+//-----------------------------------------------------------------------------
+bool AddressBlockValidator::hasValidRegisters(QSharedPointer<AddressBlock> addressBlock,
+    QString const& addressUnitBits)
+{
+    // Default AUB to 8 if empty
+    QString correctedAUB = addressUnitBits;
+    if (addressUnitBits.isEmpty())
     {
-        return false;
+        correctedAUB = QStringLiteral("8");
     }
 
     // Validate registers and register files separately
-    for (auto const& registerBase : *registerData)
+    for (auto const& registerBase : *addressBlock->getRegisterData())
     {
         if (QSharedPointer<Register> asRegister = registerBase.dynamicCast<Register>();
             asRegister && !registerValidator_->validate(asRegister))
@@ -91,6 +91,17 @@ public:
      */
     bool validate(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits);
 
+    /*!
+     *  Validates the given address block without validating the contents of its registers and register files.
+     *  The registers and register files are only checked together, e.g. for unique names and overlapping.
+     *
+     *    @param [in] addressBlock        The address block to validate.
+     *    @param [in] addressUnitBits     The address unit bits of a memory map.
+     *
+     *    @return True, if the address block is valid IP-XACT apart from its register data, otherwise false.
+     */
+    bool validateShallow(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits);
+
     /*!
      *  Check if the address block contains a valid range.
      *
@@ -119,6 +130,17 @@ public:
      */
     bool hasValidRegisterData(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits);
 
+    /*!
+     *  Check if the registers and register files of the address block are valid together. Invalid registers and
+     *  register files are marked invalid.
+     *
+     *    @param [in] addressBlock        The selected address block.
+     *    @param [in] addressUnitBits     The address unit bits of a memory map.
+     *
+     *    @return True, if the register data is valid together, otherwise false.
+     */
+    bool hasValidRegisterLayout(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits);
+
     /*!
      *  Check if the register size is not within address block width.
      *
@@ -206,6 +228,16 @@ private:
      */
     virtual QString getBlockType() const override final;
 
+    /*!
+     *  Check if the registers and register files of the address block are valid separately.
+     *
+     *    @param [in] addressBlock        The selected address block.
+     *    @param [in] addressUnitBits     The address unit bits of a memory map.
+     *
+     *    @return True, if all the registers and register files are valid, otherwise false.
+     */
+    bool hasValidRegisters(QSharedPointer<AddressBlock> addressBlock, QString const& addressUnitBits);
+
     /*!
      *  Check if the contained registers have similar register definitions.
      *
@@ -90,6 +90,16 @@ bool MemoryMapBaseValidator::validate(QSharedPointer<MemoryMapBase> memoryMapBas
         hasValidMemoryBlocks(memoryMapBase, addressUnitBits) && validComparedToSiblings(memoryMapBase);
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::validateShallow()
+//-----------------------------------------------------------------------------
+bool MemoryMapBaseValidator::validateShallow(QSharedPointer<MemoryMapBase> memoryMapBase,
+    QString const& addressUnitBits)
+{
+    return hasValidName(memoryMapBase) && hasValidIsPresent(memoryMapBase) &&
+        hasValidMemoryBlockLayout(memoryMapBase, addressUnitBits) && validComparedToSiblings(memoryMapBase);
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryMapBaseValidator::hasValidName()
 //-----------------------------------------------------------------------------
@@ -133,6 +143,36 @@ bool MemoryMapBaseValidator::hasValidIsPresent(QSharedPointer<MemoryMapBase> mem
 //-----------------------------------------------------------------------------
 bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase> memoryMapBase,
     QString const& addressUnitBits)
+{
+    // No need to check child blocks if they are erroneous together.
+    if (hasValidMemoryBlockLayout(memoryMapBase, addressUnitBits) == false)
+    {
+        return false;
+    }
+
+    // Validate blocks separately
+    for (auto const& child : *memoryMapBase->getMemoryBlocks())
+    {
+        if (QSharedPointer<AddressBlock> addressBlock = child.dynamicCast<AddressBlock>();
+            addressBlock && !addressBlockValidator_->validate(addressBlock, addressUnitBits))
+        {
+            return false;
+        }
+        else if (QSharedPointer<SubSpaceMap> subspace = child.dynamicCast<SubSpaceMap>();
+            subspace && !subspaceValidator_->validate(subspace))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::hasValidMemoryBlockLayout()
+//-----------------------------------------------------------------------------
+bool MemoryMapBaseValidator::hasValidMemoryBlockLayout(QSharedPointer<MemoryMapBase> memoryMapBase,
+    QString const& addressUnitBits)
 {
     if (memoryMapBase->getMemoryBlocks()->isEmpty())
     {
@@ -184,31 +224,15 @@ bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase>
             markItemInvalid(memoryBlock);
             errorFound = true;
         }
-    }
-
-    // No need to check child blocks if they are erroneous together.
-    if (errorFound)
-    {
-        return false;
-    }
 
-    // Validate blocks separately
-    for (auto const& child : *memoryMapBase->getMemoryBlocks())
-    {
-        if (QSharedPointer<AddressBlock> addressBlock = child.dynamicCast<AddressBlock>();
-            addressBlock && (!addressBlockValidator_->validate(addressBlock, addressUnitBits)
-            || !addressBlockWidthIsMultipleOfAUB(addressUnitBits, addressBlock)))
-        {
-            return false;
-        }
-        else if (QSharedPointer<SubSpaceMap> subspace = child.dynamicCast<SubSpaceMap>();
-            subspace && !subspaceValidator_->validate(subspace))
+        if (QSharedPointer<AddressBlock> addressBlock = memoryBlock.dynamicCast<AddressBlock>();
+            addressBlock && !addressBlockWidthIsMultipleOfAUB(addressUnitBits, addressBlock))
         {
-            return false;
+            errorFound = true;
         }
     }
 
-    return true;
+    return errorFound == false;
 }
 
 //-----------------------------------------------------------------------------
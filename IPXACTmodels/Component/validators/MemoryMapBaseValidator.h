@@ -93,6 +93,17 @@ public:
      */
     virtual bool validate(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits);
 
+    /*!
+     *  Validates the given memory map base without validating the contents of its memory blocks. The memory
+     *  blocks are only checked together, e.g. for unique names and overlapping.
+     *
+     *    @param [in] memoryMapBase       The memory map base to validate.
+     *    @param [in] addressUnitBits     The address unit bits used by the memory map.
+     *
+     *    @return True, if the memory map base is valid IP-XACT apart from its memory blocks, otherwise false.
+     */
+    bool validateShallow(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits);
+
     /*!
      *  Check if the memory map base contains a valid name.
      *
@@ -121,6 +132,18 @@ public:
      */
     bool hasValidMemoryBlocks(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits);
 
+    /*!
+     *  Check if the memory blocks of the memory map base are valid together. Memory blocks with non-unique
+     *  names, overlapping memory blocks and address blocks with a width not a multiple of address unit bits
+     *  are marked invalid.
+     *
+     *    @param [in] memoryMapBase       The selected memory map base.
+     *    @param [in] addressUnitBits     The address unit bits used by the memory map.
+     *
+     *    @return True, if the memory blocks are valid together, otherwise false.
+     */
+    bool hasValidMemoryBlockLayout(QSharedPointer<MemoryMapBase> memoryMapBase, QString const& addressUnitBits);
+
     /*!
      *  Locate errors within a memory map base.
      *
@@ -69,6 +69,27 @@ bool MemoryMapValidator::validate(QSharedPointer<MemoryMap> memoryMap)
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryMapValidator::validateShallow()
+//-----------------------------------------------------------------------------
+bool MemoryMapValidator::validateShallow(QSharedPointer<MemoryMap> memoryMap)
+{
+    bool validBase = hasValidName(memoryMap) && hasValidIsPresent(memoryMap) &&
+        validComparedToSiblings(memoryMap) && hasValidAddressUnitBits(memoryMap) &&
+        hasValidMemoryRemapLayout(memoryMap);
+
+    if (docRevision_ == Document::Revision::Std14)
+    {
+        return validBase;
+    }
+    else if (docRevision_ == Document::Revision::Std22)
+    {
+        return validBase && hasValidStructure(memoryMap);
+    }
+
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryMapValidator::hasValidAddressUnitBits()
 //-----------------------------------------------------------------------------
@@ -85,6 +106,27 @@ bool MemoryMapValidator::hasValidAddressUnitBits(QSharedPointer<MemoryMap> memor
 // Function: MemoryMapValidator::hasValidMemoryRemaps()
 //-----------------------------------------------------------------------------
 bool MemoryMapValidator::hasValidMemoryRemaps(QSharedPointer<MemoryMap> memoryMap)
+{
+    if (hasValidMemoryRemapLayout(memoryMap) == false)
+    {
+        return false;
+    }
+
+    for (QSharedPointer<MemoryRemap> memoryRemap : *memoryMap->getMemoryRemaps())
+    {
+        if (!MemoryMapBaseValidator::validate(memoryRemap, memoryMap->getAddressUnitBits()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapValidator::hasValidMemoryRemapLayout()
+//-----------------------------------------------------------------------------
+bool MemoryMapValidator::hasValidMemoryRemapLayout(QSharedPointer<MemoryMap> memoryMap) const
 {
     if (!memoryMap->getMemoryRemaps()->isEmpty())
     {
@@ -102,8 +144,7 @@ bool MemoryMapValidator::hasValidMemoryRemaps(QSharedPointer<MemoryMap> memoryMa
             {
                 if (remapNames.contains(memoryRemap->name()) ||
                     remapStates.contains(memoryRemap->getRemapState()) ||
-                    remapStateIsNotValid(memoryRemap) ||
-                    !MemoryMapBaseValidator::validate(memoryRemap, memoryMap->getAddressUnitBits()))
+                    remapStateIsNotValid(memoryRemap))
                 {
                     return false;
                 }
@@ -111,8 +152,7 @@ bool MemoryMapValidator::hasValidMemoryRemaps(QSharedPointer<MemoryMap> memoryMa
             else if (docRevision_ == Document::Revision::Std22)
             {
                 if (remapNames.contains(memoryRemap->name()) ||
-                    !remapHasValidStructure(memoryRemap) ||
-                    !MemoryMapBaseValidator::validate(memoryRemap, memoryMap->getAddressUnitBits()))
+                    !remapHasValidStructure(memoryRemap))
                 {
                     return false;
                 }
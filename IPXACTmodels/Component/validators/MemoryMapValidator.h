@@ -70,6 +70,16 @@ public:
      */
     virtual bool validate(QSharedPointer<MemoryMap> memoryMap);
 
+    /*!
+     *  Validates the given memory map without validating the memory blocks of the memory map or its remaps.
+     *  The memory blocks of the memory map are not checked at all, and the remaps only together.
+     *
+     *    @param [in] memoryMap   The memory map to validate.
+     *
+     *    @return True, if the memory map is valid IP-XACT apart from its memory blocks, otherwise false.
+     */
+    bool validateShallow(QSharedPointer<MemoryMap> memoryMap);
+
     /*!
      *  Check if the memory map contains valid address unit bits.
      *
@@ -88,6 +98,15 @@ public:
      */
     bool hasValidMemoryRemaps(QSharedPointer<MemoryMap> memoryMap);
 
+    /*!
+     *  Check if the memory remaps of the memory map are valid together, without validating their memory blocks.
+     *
+     *    @param [in] memoryMap   The selected memory map.
+     *
+     *    @return True, if the memory remaps are valid together, otherwise false.
+     */
+    bool hasValidMemoryRemapLayout(QSharedPointer<MemoryMap> memoryMap) const;
+
     /*!
      *  Check if the memory remap remap state is valid.
      *
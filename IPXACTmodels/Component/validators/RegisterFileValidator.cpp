@@ -61,17 +61,27 @@ void RegisterFileValidator::componentChange(QSharedPointer<Component> newCompone
 // Function: RegisterFileValidator::validate()
 //-----------------------------------------------------------------------------
 bool RegisterFileValidator::validate(QSharedPointer<RegisterFile> selectedRegisterFile, QString const& addressUnitBits, QString const& addressBlockWidth)
+{
+    return validateShallow(selectedRegisterFile, addressUnitBits) &&
+        hasValidRegisters(selectedRegisterFile, addressUnitBits, addressBlockWidth);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterFileValidator::validateShallow()
+//-----------------------------------------------------------------------------
+bool RegisterFileValidator::validateShallow(QSharedPointer<RegisterFile> selectedRegisterFile,
+    QString const& addressUnitBits)
 {
     if (docRevision_ == Document::Revision::Std14)
     {
         return hasValidRange(selectedRegisterFile) &&
-            hasValidRegisterData(selectedRegisterFile, addressUnitBits, addressBlockWidth) &&
+            hasValidRegisterLayout(selectedRegisterFile, addressUnitBits) &&
             RegisterBaseValidator::validate(selectedRegisterFile);
     }
     else if (docRevision_ == Document::Revision::Std22)
     {
         return hasValidRange(selectedRegisterFile) &&
-            hasValidRegisterData(selectedRegisterFile, addressUnitBits, addressBlockWidth) &&
+            hasValidRegisterLayout(selectedRegisterFile, addressUnitBits) &&
             hasValidAccessPolicies(selectedRegisterFile) &&
             RegisterBaseValidator::validate(selectedRegisterFile) &&
             hasValidStructure(selectedRegisterFile);
@@ -95,6 +105,16 @@ bool RegisterFileValidator::hasValidRange(QSharedPointer<RegisterFile> selectedR
 // Function: RegisterFileValidator::hasValidRegisterData()
 //-----------------------------------------------------------------------------
 bool RegisterFileValidator::hasValidRegisterData(QSharedPointer<RegisterFile> selectedRegisterFile, QString const& addressUnitBits, QString const& addressBlockWidth)
+{
+    return hasValidRegisterLayout(selectedRegisterFile, addressUnitBits) &&
+        hasValidRegisters(selectedRegisterFile, addressUnitBits, addressBlockWidth);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterFileValidator::hasValidRegisterLayout()
+//-----------------------------------------------------------------------------
+bool RegisterFileValidator::hasValidRegisterLayout(QSharedPointer<RegisterFile> selectedRegisterFile,
+    QString const& addressUnitBits)
 {
     if (selectedRegisterFile->getRegisterData()->isEmpty())
     {
@@ -167,13 +187,25 @@ bool RegisterFileValidator::hasValidRegisterData(QSharedPointer<RegisterFile> se
         }
     }
 
-    if (!registerDataIsValid)
+    return registerDataIsValid;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterFileValidator::hasValidRegisters()
+//-----------------------------------------------------------------------------
+bool RegisterFileValidator::hasValidRegisters(QSharedPointer<RegisterFile> selectedRegisterFile,
+    QString const& addressUnitBits, QString const& addressBlockWidth)
+{
+    QString correctedAUB = addressUnitBits;
+
+    // Avoid divisions by 0, default AUB to 8 bits
+    if (addressUnitBits.isEmpty())
     {
-        return false;
+        correctedAUB = QStringLiteral("8");
     }
 
     // Validate registers and register files separately
-    for (auto const& registerBase : *registerData)
+    for (auto const& registerBase : *selectedRegisterFile->getRegisterData())
     {
         if (QSharedPointer<Register> asRegister = registerBase.dynamicCast<Register>(); 
             asRegister && !registerValidator_->validate(asRegister))
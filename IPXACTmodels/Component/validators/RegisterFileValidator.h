@@ -66,6 +66,17 @@ public:
     */
     bool validate(QSharedPointer<RegisterFile> selectedRegisterFile, QString const& addressUnitBits, QString const& addressBlockWidth);
 
+    /*!
+    *  Validates the given register file without validating the contents of its registers and register files.
+    *  The registers and register files are only checked together, e.g. for unique names and overlapping.
+    *
+    *    @param [in] selectedRegisterFile    The register file to validate.
+    *    @param [in] addressUnitBits         The number of bits per address unit.
+    *
+    *    @return True, if the register file is valid IP-XACT apart from its register data, otherwise false.
+    */
+    bool validateShallow(QSharedPointer<RegisterFile> selectedRegisterFile, QString const& addressUnitBits);
+
     /*!
     *  Check if the register file has a valid range.
     *
@@ -87,6 +98,17 @@ public:
     bool hasValidRegisterData(QSharedPointer<RegisterFile> selectedRegisterFile, QString const& addressUnitBits, 
         QString const& addressBlockWidth);
 
+    /*!
+    *  Check if the registers and register files of the register file are valid together. Invalid registers and
+    *  register files are marked invalid.
+    *
+    *    @param [in] selectedRegisterFile    The selected register file whose register data to check.
+    *    @param [in] addressUnitBits         The number of bits per address unit.
+    *
+    *    @return True, if the register data is valid together, otherwise false.
+    */
+    bool hasValidRegisterLayout(QSharedPointer<RegisterFile> selectedRegisterFile, QString const& addressUnitBits);
+
     /*!
      *	Check if the register file has a valid structure (choice of elements).
      *  
@@ -113,6 +135,18 @@ public:
 
 private:
 
+    /*!
+    *  Check if the registers and register files of the register file are valid separately.
+    *
+    *    @param [in] selectedRegisterFile    The selected register file whose register data to check.
+    *    @param [in] addressUnitBits         The number of bits per address unit.
+    *    @param [in] addressBlockWidth       The width of the enclosing address block.
+    *
+    *    @return True, if all the registers and register files are valid, otherwise false.
+    */
+    bool hasValidRegisters(QSharedPointer<RegisterFile> selectedRegisterFile, QString const& addressUnitBits,
+        QString const& addressBlockWidth);
+
     /*!
     *  Find errors within the range value.
     *
@@ -68,9 +68,17 @@ QSharedPointer<FieldValidator> RegisterValidator::getFieldValidator() const
 // Function: RegisterValidator::validate()
 //-----------------------------------------------------------------------------
 bool RegisterValidator::validate(QSharedPointer<Register> selectedRegister) const
+{
+    return validateShallow(selectedRegister) && hasSeparatelyValidFields(selectedRegister);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterValidator::validateShallow()
+//-----------------------------------------------------------------------------
+bool RegisterValidator::validateShallow(QSharedPointer<Register> selectedRegister) const
 {
     return hasValidSize(selectedRegister) &&
-           hasValidFields(selectedRegister, selectedRegister->getSize()) &&
+           hasValidFieldLayout(selectedRegister, selectedRegister->getSize()) &&
            hasValidAlternateRegisters(selectedRegister) &&
             RegisterBaseValidator::validate(selectedRegister) &&
            hasValidStructure(selectedRegister);
@@ -95,6 +103,15 @@ bool RegisterValidator::hasValidSize(QSharedPointer<Register> selectedRegister)
 //-----------------------------------------------------------------------------
 bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> selectedRegister,
     QString const& registerSize) const
+{
+    return hasValidFieldLayout(selectedRegister, registerSize) && hasSeparatelyValidFields(selectedRegister);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterValidator::hasValidFieldLayout()
+//-----------------------------------------------------------------------------
+bool RegisterValidator::hasValidFieldLayout(QSharedPointer<RegisterDefinition> selectedRegister,
+    QString const& registerSize) const
 {
     if (selectedRegister->getFields()->isEmpty())
     {
@@ -173,13 +190,15 @@ bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> select
         fieldTypeIdentifiers.append(field->getTypeIdentifier());
     }
     
-    if (!fieldsAreValid)
-    {
-        return false;
-    }
+    return fieldsAreValid;
+}
 
-    // Validate fields separately.
-    for (auto const& field : *fields)
+//-----------------------------------------------------------------------------
+// Function: RegisterValidator::hasSeparatelyValidFields()
+//-----------------------------------------------------------------------------
+bool RegisterValidator::hasSeparatelyValidFields(QSharedPointer<RegisterDefinition> selectedRegister) const
+{
+    for (auto const& field : *selectedRegister->getFields())
     {
         if (!fieldValidator_->validate(field))
         {
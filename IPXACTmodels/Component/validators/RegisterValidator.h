@@ -82,6 +82,16 @@ public:
      */
     bool validate(QSharedPointer<Register> selectedRegister) const;
 
+    /*!
+     *  Validates the given register without validating the contents of its fields. The fields are only checked
+     *  together, e.g. for unique names and overlapping.
+     *
+     *    @param [in] selectedRegister    The register to validate.
+     *
+     *    @return True, if the register is valid IP-XACT apart from its fields, otherwise false.
+     */
+    bool validateShallow(QSharedPointer<Register> selectedRegister) const;
+
     /*!
      *  Check if the register contains a valid size.
      *
@@ -101,6 +111,16 @@ public:
      */
     bool hasValidFields(QSharedPointer<RegisterDefinition> selectedRegister, QString const& registerSize) const;
 
+    /*!
+     *  Check if the fields of the register are valid together. Invalid fields are marked invalid.
+     *
+     *    @param [in] selectedRegister    The selected register definition.
+     *    @param [in] registerSize        Size of the selected register.
+     *
+     *    @return True, if the fields are valid together, otherwise false.
+     */
+    bool hasValidFieldLayout(QSharedPointer<RegisterDefinition> selectedRegister, QString const& registerSize) const;
+
     /*!
      *  Check if the register contains valid alternate registers.
      *
@@ -140,6 +160,15 @@ public:
 
 private:
 
+    /*!
+     *  Check if the fields of the register are valid separately.
+     *
+     *    @param [in] selectedRegister    The selected register definition.
+     *
+     *    @return True, if all the fields are valid, otherwise false.
+     */
+    bool hasSeparatelyValidFields(QSharedPointer<RegisterDefinition> selectedRegister) const;
+
     /*!
      *  Check if the field contains a valid access value.
      *
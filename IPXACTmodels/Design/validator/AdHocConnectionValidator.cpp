@@ -17,6 +17,7 @@
 
 #include <IPXACTmodels/Design/AdHocConnection.h>
 #include <IPXACTmodels/Design/ComponentInstance.h>
+#include <IPXACTmodels/Design/validator/DesignValidationContext.h>
 
 #include <KactusAPI/include/ExpressionParser.h>
 
@@ -28,7 +29,8 @@
 AdHocConnectionValidator::AdHocConnectionValidator(QSharedPointer<ExpressionParser> parser,
     LibraryInterface* library):
 parser_(parser),
-libraryHandler_(library)
+libraryHandler_(library),
+validationContext_(new DesignValidationContext(library, nullptr))
 {
 
 }
@@ -47,7 +49,16 @@ AdHocConnectionValidator::~AdHocConnectionValidator()
 void AdHocConnectionValidator::changeComponentInstances(
     QSharedPointer<QList<QSharedPointer<ComponentInstance> > > newInstances)
 {
-    availableComponentInstances_ = newInstances;
+    validationContext_ = QSharedPointer<DesignValidationContext>(
+        new DesignValidationContext(libraryHandler_, newInstances));
+}
+
+//-----------------------------------------------------------------------------
+// Function: AdHocConnectionValidator::setValidationContext()
+//-----------------------------------------------------------------------------
+void AdHocConnectionValidator::setValidationContext(QSharedPointer<DesignValidationContext> context)
+{
+    validationContext_ = context;
 }
 
 //-----------------------------------------------------------------------------
@@ -156,21 +167,7 @@ bool AdHocConnectionValidator::internalPortReferenceIsValid(QSharedPointer<PortR
 QSharedPointer<ComponentInstance> AdHocConnectionValidator::getReferencedComponentInstance(
     QString const& instanceReference) const
 {
-    QSharedPointer<ComponentInstance> foundInstance = nullptr;
-    if (instanceReference.isEmpty() || availableComponentInstances_->isEmpty())
-    {
-        return foundInstance;
-    }
-
-    auto it = std::find_if(availableComponentInstances_->cbegin(), availableComponentInstances_->cend(),
-        [&instanceReference](auto const& instance) {return instance->getInstanceName() == instanceReference; });
-        
-    if (it != availableComponentInstances_->cend())
-    {
-        foundInstance = *it;
-    }
-    
-    return foundInstance;
+    return validationContext_->getComponentInstance(instanceReference);
 }
 
 //-----------------------------------------------------------------------------
@@ -179,15 +176,7 @@ QSharedPointer<ComponentInstance> AdHocConnectionValidator::getReferencedCompone
 QSharedPointer<const Component> AdHocConnectionValidator::getReferencedComponent(
     QSharedPointer<ComponentInstance> referencingInstance) const
 {
-    if (referencingInstance && referencingInstance->getComponentRef())
-    {
-        QSharedPointer<const Component> referencedComponent =
-            libraryHandler_->getModelReadOnly(*referencingInstance->getComponentRef()).dynamicCast<Component const>();
-
-        return referencedComponent;
-    }
-
-    return QSharedPointer<const Component> ();
+    return validationContext_->getReferencedComponent(referencingInstance);
 }
 
 //-----------------------------------------------------------------------------
@@ -196,22 +185,7 @@ QSharedPointer<const Component> AdHocConnectionValidator::getReferencedComponent
 QSharedPointer<Port> AdHocConnectionValidator::getReferencedPort(QSharedPointer<const Component> component,
     QSharedPointer<PortReference> portReference) const
 {
-    QSharedPointer<Port> foundPort = nullptr;
-
-    if (portReference->getPortRef().isEmpty())
-    {
-        return foundPort;
-    }
-
-    auto it = std::find_if(component->getPorts()->cbegin(), component->getPorts()->cend(),
-        [&portReference](auto const& currentPort) { return currentPort->name() == portReference->getPortRef(); });
-
-    if (it != component->getPorts()->cend())
-    {
-        foundPort = *it;
-    }
-
-    return foundPort;
+    return validationContext_->getPort(component, portReference->getPortRef());
 }
 
 //-----------------------------------------------------------------------------
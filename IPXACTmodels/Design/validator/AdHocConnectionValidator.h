@@ -30,6 +30,8 @@ class PartSelect;
 class Component;
 class Port;
 
+class DesignValidationContext;
+
 //-----------------------------------------------------------------------------
 //! Validator for the ipxact:adHocConnection.
 //-----------------------------------------------------------------------------
@@ -49,12 +51,20 @@ public:
 	~AdHocConnectionValidator();
     
     /*!
-     *  Change the used component instances.
+     *  Change the used component instances. The instances are indexed by name, so this must be called
+     *  again after instances are added, removed or renamed.
      *
      *    @param [in] newInstances    A list of the new component instances.
      */
     void changeComponentInstances(QSharedPointer<QList<QSharedPointer<ComponentInstance> > > newInstances);
 
+    /*!
+     *  Change the validation context holding the available component instances.
+     *
+     *    @param [in] context     The validation context of the design.
+     */
+    void setValidationContext(QSharedPointer<DesignValidationContext> context);
+
     /*!
      *  Validates the given ad hoc connection.
      *
@@ -282,9 +292,8 @@ private:
     //! The containing library.
     LibraryInterface* libraryHandler_;
 
-    //! The currently available component instances.
-    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > availableComponentInstances_ =
-        QSharedPointer<QList<QSharedPointer<ComponentInstance> > >(new QList<QSharedPointer<ComponentInstance> >());
+    //! The currently available component instances and their referenced components.
+    QSharedPointer<DesignValidationContext> validationContext_;
 };
 
 #endif // ADHOCCONNECTIONVALIDATOR_H
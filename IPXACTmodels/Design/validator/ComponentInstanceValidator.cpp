@@ -16,6 +16,7 @@
 #include <IPXACTmodels/Component/Component.h>
 
 #include <IPXACTmodels/Design/ComponentInstance.h>
+#include <IPXACTmodels/Design/validator/DesignValidationContext.h>
 
 #include <KactusAPI/include/ExpressionParser.h>
 #include <KactusAPI/include/LibraryInterface.h>
@@ -40,6 +41,14 @@ ComponentInstanceValidator::~ComponentInstanceValidator()
 
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentInstanceValidator::setValidationContext()
+//-----------------------------------------------------------------------------
+void ComponentInstanceValidator::setValidationContext(QSharedPointer<DesignValidationContext> context)
+{
+    validationContext_ = context;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentInstanceValidator::validate()
 //-----------------------------------------------------------------------------
@@ -70,7 +79,7 @@ bool ComponentInstanceValidator::hasValidIsPresent(QSharedPointer<ComponentInsta
 bool ComponentInstanceValidator::hasValidComponentReference(QSharedPointer<ComponentInstance> instance) const
 {
     return instance->getComponentRef() && instance->getComponentRef()->isValid() &&
-       libraryHandler_->contains(*instance->getComponentRef());
+       libraryContains(*instance->getComponentRef());
 }
 
 //-----------------------------------------------------------------------------
@@ -118,7 +127,7 @@ void ComponentInstanceValidator::findErrorsInComponentReference(QVector<QString>
 {
     if (!instance->getComponentRef()->isEmpty())
     {
-        if (!libraryHandler_->contains(*instance->getComponentRef()))
+        if (!libraryContains(*instance->getComponentRef()))
         {
             errors.append(QObject::tr("Component reference %1 in component instance %2 within %3 was not found "
                 "in the library")
@@ -136,3 +145,16 @@ void ComponentInstanceValidator::findErrorsInComponentReference(QVector<QString>
             .arg(instance->getInstanceName(), context));
     }
 }
+
+//-----------------------------------------------------------------------------
+// Function: ComponentInstanceValidator::libraryContains()
+//-----------------------------------------------------------------------------
+bool ComponentInstanceValidator::libraryContains(VLNV const& vlnv) const
+{
+    if (validationContext_)
+    {
+        return validationContext_->libraryContains(vlnv);
+    }
+
+    return libraryHandler_->contains(vlnv);
+}
@@ -19,6 +19,8 @@
 #include <QVector>
 
 class ComponentInstance;
+class DesignValidationContext;
+class VLNV;
 
 class LibraryInterface;
 class ExpressionParser;
@@ -40,6 +42,13 @@ public:
 
 	//! The destructor.
 	~ComponentInstanceValidator();
+
+    /*!
+     *  Change the validation context used for library lookups.
+     *
+     *    @param [in] context     The validation context of the design, or null to use the library directly.
+     */
+    void setValidationContext(QSharedPointer<DesignValidationContext> context);
     
     /*!
      *  Validates the given component instance.
@@ -93,6 +102,15 @@ private:
 	ComponentInstanceValidator(ComponentInstanceValidator const& rhs);
 	ComponentInstanceValidator& operator=(ComponentInstanceValidator const& rhs);
 
+    /*!
+     *  Check if the library contains the selected item.
+     *
+     *    @param [in] vlnv    VLNV of the selected item.
+     *
+     *    @return True, if the library contains the item, otherwise false.
+     */
+    bool libraryContains(VLNV const& vlnv) const;
+
     /*!
      *  Find errors in name.
      *
@@ -132,6 +150,9 @@ private:
 
     //! The used library interface.
     LibraryInterface* libraryHandler_;
+
+    //! The validation context of the current design.
+    QSharedPointer<DesignValidationContext> validationContext_;
 };
 
 #endif // COMPONENTINSTANCEVALIDATOR_H
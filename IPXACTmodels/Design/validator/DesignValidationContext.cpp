@@ -0,0 +1,182 @@
+//-----------------------------------------------------------------------------
+// File: DesignValidationContext.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Indexes of the component instances and their referenced components for a single design validation.
+//-----------------------------------------------------------------------------
+
+#include "DesignValidationContext.h"
+
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Port.h>
+
+#include <IPXACTmodels/Design/ComponentInstance.h>
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <KactusAPI/include/LibraryInterface.h>
+
+//-----------------------------------------------------------------------------
+// Function: DesignValidationContext::DesignValidationContext()
+//-----------------------------------------------------------------------------
+DesignValidationContext::DesignValidationContext(LibraryInterface* library,
+    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > instances):
+library_(library),
+instances_(instances)
+{
+    if (instances_.isNull())
+    {
+        instances_ = QSharedPointer<QList<QSharedPointer<ComponentInstance> > >(
+            new QList<QSharedPointer<ComponentInstance> >());
+    }
+
+    instancesByName_.reserve(instances_->size());
+    for (QSharedPointer<ComponentInstance> instance : *instances_)
+    {
+        // Keep the first instance for duplicate names, matching a linear search.
+        if (instancesByName_.contains(instance->getInstanceName()) == false)
+        {
+            instancesByName_.insert(instance->getInstanceName(), instance);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignValidationContext::getComponentInstances()
+//-----------------------------------------------------------------------------
+QSharedPointer<QList<QSharedPointer<ComponentInstance> > > DesignValidationContext::getComponentInstances() const
+{
+    return instances_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignValidationContext::getComponentInstance()
+//-----------------------------------------------------------------------------
+QSharedPointer<ComponentInstance> DesignValidationContext::getComponentInstance(QString const& instanceName) const
+{
+    if (instanceName.isEmpty())
+    {
+        return QSharedPointer<ComponentInstance>();
+    }
+
+    return instancesByName_.value(instanceName);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignValidationContext::getReferencedComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component const> DesignValidationContext::getReferencedComponent(
+    QSharedPointer<ComponentInstance> instance) const
+{
+    if (library_ == nullptr || instance.isNull() || instance->getComponentRef().isNull())
+    {
+        return QSharedPointer<Component const>();
+    }
+
+    QString componentKey = instance->getComponentRef()->toString();
+
+    auto cachedComponent = components_.constFind(componentKey);
+    if (cachedComponent != components_.constEnd())
+    {
+        return cachedComponent.value();
+    }
+
+    QSharedPointer<Component const> component =
+        library_->getModelReadOnly(*instance->getComponentRef()).dynamicCast<Component const>();
+    components_.insert(componentKey, component);
+
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignValidationContext::libraryContains()
+//-----------------------------------------------------------------------------
+bool DesignValidationContext::libraryContains(VLNV const& vlnv) const
+{
+    if (library_ == nullptr)
+    {
+        return false;
+    }
+
+    QString itemKey = vlnv.toString();
+
+    auto cachedResult = containedItems_.constFind(itemKey);
+    if (cachedResult != containedItems_.constEnd())
+    {
+        return cachedResult.value();
+    }
+
+    bool contains = library_->contains(vlnv);
+    containedItems_.insert(itemKey, contains);
+
+    return contains;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignValidationContext::getBusInterface()
+//-----------------------------------------------------------------------------
+QSharedPointer<BusInterface> DesignValidationContext::getBusInterface(QSharedPointer<Component const> component,
+    QString const& busName) const
+{
+    if (component.isNull() || busName.isEmpty())
+    {
+        return QSharedPointer<BusInterface>();
+    }
+
+    return getComponentIndex(component).busInterfaces_.value(busName);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignValidationContext::getPort()
+//-----------------------------------------------------------------------------
+QSharedPointer<Port> DesignValidationContext::getPort(QSharedPointer<Component const> component,
+    QString const& portName) const
+{
+    if (component.isNull() || portName.isEmpty())
+    {
+        return QSharedPointer<Port>();
+    }
+
+    return getComponentIndex(component).ports_.value(portName);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignValidationContext::getComponentIndex()
+//-----------------------------------------------------------------------------
+DesignValidationContext::ComponentIndex const& DesignValidationContext::getComponentIndex(
+    QSharedPointer<Component const> component) const
+{
+    auto existingIndex = componentIndexes_.constFind(component.data());
+    if (existingIndex != componentIndexes_.constEnd())
+    {
+        return existingIndex.value();
+    }
+
+    ComponentIndex& index = componentIndexes_[component.data()];
+    index.component_ = component;
+
+    index.busInterfaces_.reserve(component->getBusInterfaces()->size());
+    for (QSharedPointer<BusInterface> busInterface : *component->getBusInterfaces())
+    {
+        if (index.busInterfaces_.contains(busInterface->name()) == false)
+        {
+            index.busInterfaces_.insert(busInterface->name(), busInterface);
+        }
+    }
+
+    index.ports_.reserve(component->getPorts()->size());
+    for (QSharedPointer<Port> port : *component->getPorts())
+    {
+        if (index.ports_.contains(port->name()) == false)
+        {
+            index.ports_.insert(port->name(), port);
+        }
+    }
+
+    return index;
+}
@@ -0,0 +1,161 @@
+//-----------------------------------------------------------------------------
+// File: DesignValidationContext.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Indexes of the component instances and their referenced components for a single design validation.
+//-----------------------------------------------------------------------------
+
+#ifndef DESIGNVALIDATIONCONTEXT_H
+#define DESIGNVALIDATIONCONTEXT_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QHash>
+#include <QList>
+#include <QSharedPointer>
+#include <QString>
+
+class BusInterface;
+class Component;
+class ComponentInstance;
+class Port;
+class VLNV;
+
+class LibraryInterface;
+
+//-----------------------------------------------------------------------------
+//! Indexes of the component instances and their referenced components for a single design validation.
+//!
+//! The instances are indexed by name when the context is created. Referenced components, their bus interfaces
+//! and ports are looked up from the library once and indexed on first use. The context is a snapshot: it does
+//! not track changes to the design or the library, so instances added, removed or renamed after the creation
+//! and components changed in the library after their first use are seen only by a new context. It must
+//! therefore be recreated for each validation.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT DesignValidationContext
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] library     The used library interface.
+     *    @param [in] instances   The component instances of the validated design.
+     */
+    DesignValidationContext(LibraryInterface* library,
+        QSharedPointer<QList<QSharedPointer<ComponentInstance> > > instances);
+
+    //! The destructor.
+    ~DesignValidationContext() = default;
+
+    // Disable copying.
+    DesignValidationContext(DesignValidationContext const& rhs) = delete;
+    DesignValidationContext& operator=(DesignValidationContext const& rhs) = delete;
+
+    /*!
+     *  Get the component instances of the validated design.
+     *
+     *    @return The component instances.
+     */
+    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > getComponentInstances() const;
+
+    /*!
+     *  Find a component instance by name.
+     *
+     *    @param [in] instanceName    Name of the component instance.
+     *
+     *    @return The first component instance with the given name, or null if none is found.
+     */
+    QSharedPointer<ComponentInstance> getComponentInstance(QString const& instanceName) const;
+
+    /*!
+     *  Get the component referenced by a component instance.
+     *
+     *    @param [in] instance    The selected component instance.
+     *
+     *    @return The referenced component, or null if it is not found in the library.
+     */
+    QSharedPointer<Component const> getReferencedComponent(QSharedPointer<ComponentInstance> instance) const;
+
+    /*!
+     *  Check if the library contains the selected item.
+     *
+     *    @param [in] vlnv    VLNV of the selected item.
+     *
+     *    @return True, if the library contains the item, otherwise false.
+     */
+    bool libraryContains(VLNV const& vlnv) const;
+
+    /*!
+     *  Find a bus interface of a referenced component.
+     *
+     *    @param [in] component   The referenced component.
+     *    @param [in] busName     Name of the bus interface.
+     *
+     *    @return The bus interface, or null if none is found.
+     */
+    QSharedPointer<BusInterface> getBusInterface(QSharedPointer<Component const> component,
+        QString const& busName) const;
+
+    /*!
+     *  Find a port of a referenced component.
+     *
+     *    @param [in] component   The referenced component.
+     *    @param [in] portName    Name of the port.
+     *
+     *    @return The port, or null if none is found.
+     */
+    QSharedPointer<Port> getPort(QSharedPointer<Component const> component, QString const& portName) const;
+
+private:
+
+    //! Name indexes of the bus interfaces and ports of a component.
+    struct ComponentIndex
+    {
+        //! The indexed component, kept alive for the lifetime of the index.
+        QSharedPointer<Component const> component_;
+
+        //! The bus interfaces by name.
+        QHash<QString, QSharedPointer<BusInterface> > busInterfaces_;
+
+        //! The ports by name.
+        QHash<QString, QSharedPointer<Port> > ports_;
+    };
+
+    /*!
+     *  Get the name indexes of a component. The indexes are created on first use.
+     *
+     *    @param [in] component   The selected component.
+     *
+     *    @return The name indexes of the component.
+     */
+    ComponentIndex const& getComponentIndex(QSharedPointer<Component const> component) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The used library interface.
+    LibraryInterface* library_;
+
+    //! The component instances of the validated design.
+    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > instances_;
+
+    //! The component instances by name.
+    QHash<QString, QSharedPointer<ComponentInstance> > instancesByName_;
+
+    //! The referenced components by VLNV.
+    mutable QHash<QString, QSharedPointer<Component const> > components_;
+
+    //! Library availability of the referenced items by VLNV.
+    mutable QHash<QString, bool> containedItems_;
+
+    //! The name indexes of the referenced components.
+    mutable QHash<Component const*, ComponentIndex> componentIndexes_;
+};
+
+#endif // DESIGNVALIDATIONCONTEXT_H
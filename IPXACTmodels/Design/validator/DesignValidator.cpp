@@ -15,6 +15,7 @@
 #include <IPXACTmodels/Design/ComponentInstance.h>
 #include <IPXACTmodels/Design/AdHocConnection.h>
 
+#include <IPXACTmodels/Design/validator/DesignValidationContext.h>
 #include <IPXACTmodels/Design/validator/ComponentInstanceValidator.h>
 #include <IPXACTmodels/Design/validator/InterconnectionValidator.h>
 #include <IPXACTmodels/Design/validator/AdHocConnectionValidator.h>
@@ -30,6 +31,7 @@
 #include <KactusAPI/include/LibraryInterface.h>
 
 #include <QRegularExpression>
+#include <QSet>
 
 //-----------------------------------------------------------------------------
 // Function: DesignValidator::DesignValidator()
@@ -39,7 +41,8 @@ componentInstanceValidator_(new ComponentInstanceValidator(parser, library)),
 interconnectionValidator_(new InterconnectionValidator(parser, library)),
 adHocConnectionValidator_(new AdHocConnectionValidator(parser, library)),
 assertionValidator_(new AssertionValidator(parser)),
-expressionParser_(parser)
+expressionParser_(parser),
+library_(library)
 {
 
 }
@@ -57,9 +60,15 @@ DesignValidator::~DesignValidator()
 //-----------------------------------------------------------------------------
 bool DesignValidator::validate(QSharedPointer<Design> design) const
 {
-    return hasValidVLNV(design) && hasValidComponentInstances(design) && hasValidInterconnections(design) &&
+    validationContext_ = QSharedPointer<DesignValidationContext>(
+        new DesignValidationContext(library_, design->getComponentInstances()));
+
+    bool valid = hasValidVLNV(design) && hasValidComponentInstances(design) && hasValidInterconnections(design) &&
         hasValidMonitorInterconnections(design) && hasValidAdHocConnections(design) &&
         hasValidParameters(design) && hasValidAssertions(design);
+
+    validationContext_.clear();
+    return valid;
 }
 
 //-----------------------------------------------------------------------------
@@ -80,7 +89,9 @@ bool DesignValidator::hasValidComponentInstances(QSharedPointer<Design> design)
         return true;
     }
 
-    QVector<QString> instanceNames;
+    setupValidationContext(design);
+
+    QSet<QString> instanceNames;
     for (QSharedPointer<ComponentInstance> instance : *design->getComponentInstances())
     {
         if (instanceNames.contains(instance->getInstanceName()) ||
@@ -89,7 +100,7 @@ bool DesignValidator::hasValidComponentInstances(QSharedPointer<Design> design)
             return false;
         }
 
-        instanceNames.append(instance->getInstanceName());
+        instanceNames.insert(instance->getInstanceName());
     }
 
     return true;
@@ -105,8 +116,8 @@ bool DesignValidator::hasValidInterconnections(QSharedPointer<Design> design) co
         return true;
     }
 
-    interconnectionValidator_->changeComponentInstances(design->getComponentInstances());
-    QVector<QString> connectionNames;
+    setupValidationContext(design);
+    QSet<QString> connectionNames;
 
     for (QSharedPointer<Interconnection> connection : *design->getInterconnections())
     {
@@ -116,7 +127,7 @@ bool DesignValidator::hasValidInterconnections(QSharedPointer<Design> design) co
             return false;
         }
 
-        connectionNames.append(connection->name());
+        connectionNames.insert(connection->name());
     }
 
     return true;
@@ -132,8 +143,8 @@ bool DesignValidator::hasValidMonitorInterconnections(QSharedPointer<Design> des
         return true;
     }
 
-    interconnectionValidator_->changeComponentInstances(design->getComponentInstances());
-    QVector<QString> connectionNames;
+    setupValidationContext(design);
+    QSet<QString> connectionNames;
 
     for (QSharedPointer<MonitorInterconnection> connection : *design->getMonitorInterconnecions())
     {
@@ -143,7 +154,7 @@ bool DesignValidator::hasValidMonitorInterconnections(QSharedPointer<Design> des
             return false;
         }
 
-        connectionNames.append(connection->name());
+        connectionNames.insert(connection->name());
     }
 
     return true;
@@ -159,8 +170,8 @@ bool DesignValidator::hasValidAdHocConnections(QSharedPointer<Design> design) co
         return true;
     }
 
-    adHocConnectionValidator_->changeComponentInstances(design->getComponentInstances());
-    QVector<QString> connectionNames;
+    setupValidationContext(design);
+    QSet<QString> connectionNames;
     for (QSharedPointer<AdHocConnection> connection: *design->getAdHocConnections())
     {
         if (connectionNames.contains(connection->name()) || !adHocConnectionValidator_->validate(connection))
@@ -168,7 +179,7 @@ bool DesignValidator::hasValidAdHocConnections(QSharedPointer<Design> design) co
             return false;
         }
 
-        connectionNames.append(connection->name());
+        connectionNames.insert(connection->name());
     }
 
     return true;
@@ -186,7 +197,7 @@ bool DesignValidator::hasValidParameters(QSharedPointer<Design> design) const
 
     ParameterValidator parameterValidator(expressionParser_, QSharedPointer<QList<QSharedPointer<Choice> > >(), design->getRevision());
 
-    QVector<QString> parameterNames;
+    QSet<QString> parameterNames;
     for (QSharedPointer<Parameter> parameter : *design->getParameters())
     {
         if (parameterNames.contains(parameter->name()) || !parameterValidator.validate(parameter))
@@ -194,7 +205,7 @@ bool DesignValidator::hasValidParameters(QSharedPointer<Design> design) const
             return false;
         }
 
-        parameterNames.append(parameter->name());
+        parameterNames.insert(parameter->name());
     }
 
     return true;
@@ -210,7 +221,7 @@ bool DesignValidator::hasValidAssertions(QSharedPointer<Design> design) const
         return true;
     }
 
-    QVector<QString> assertionNames;
+    QSet<QString> assertionNames;
     for (QSharedPointer<Assertion> assertion : *design->getAssertions())
     {
         if (assertionNames.contains(assertion->name()) || !assertionValidator_->validate(assertion))
@@ -218,7 +229,7 @@ bool DesignValidator::hasValidAssertions(QSharedPointer<Design> design) const
             return false;
         }
 
-        assertionNames.append(assertion->name());
+        assertionNames.insert(assertion->name());
     }
 
     return true;
@@ -231,6 +242,9 @@ void DesignValidator::findErrorsIn(QVector<QString>& errors, QSharedPointer<Desi
 {
     QString context = QObject::tr("design %1").arg(design->getVlnv().toString());
 
+    validationContext_ = QSharedPointer<DesignValidationContext>(
+        new DesignValidationContext(library_, design->getComponentInstances()));
+
     findErrorsInVLNV(errors, design);
     findErrorsInComponentInstances(errors, design, context);
     findErrorsInInterconnections(errors, design, context);
@@ -238,6 +252,8 @@ void DesignValidator::findErrorsIn(QVector<QString>& errors, QSharedPointer<Desi
     findErrorsInAdHocConnections(errors, design, context);
     findErrorsInParameters(errors, design, context);
     findErrorsInAssertions(errors, design, context);
+
+    validationContext_.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -259,8 +275,10 @@ void DesignValidator::findErrorsInComponentInstances(QVector<QString>& errors, Q
         return;
     }
 
-    QVector<QString> instanceNames;
-    QVector<QString> duplicateNames;
+    setupValidationContext(design);
+
+    QSet<QString> instanceNames;
+    QSet<QString> duplicateNames;
     for (QSharedPointer<ComponentInstance> instance : *design->getComponentInstances())
     {
         if (instanceNames.contains(instance->getInstanceName()) &&
@@ -268,10 +286,10 @@ void DesignValidator::findErrorsInComponentInstances(QVector<QString>& errors, Q
         {
             errors.append(QObject::tr("Component instance name '%1' within %2 is not unique.")
                 .arg(instance->getInstanceName(), context));
-            duplicateNames.append(instance->getInstanceName());
+            duplicateNames.insert(instance->getInstanceName());
         }
 
-        instanceNames.append(instance->getInstanceName());
+        instanceNames.insert(instance->getInstanceName());
         componentInstanceValidator_->findErrorsIn(errors, instance, context);
     }
 }
@@ -287,19 +305,19 @@ void DesignValidator::findErrorsInInterconnections(QVector<QString>& errors, QSh
         return;
     }
 
-    interconnectionValidator_->changeComponentInstances(design->getComponentInstances());
-    QVector<QString> connectionNames;
-    QVector<QString> duplicateNames;
+    setupValidationContext(design);
+    QSet<QString> connectionNames;
+    QSet<QString> duplicateNames;
     for (QSharedPointer<Interconnection> connection : *design->getInterconnections())
     {
         if (connectionNames.contains(connection->name()) && !duplicateNames.contains(connection->name()))
         {
             errors.append(QObject::tr("Interconnection name %1 within %2 is not unique")
                 .arg(connection->name(), context));
-            duplicateNames.append(connection->name());
+            duplicateNames.insert(connection->name());
         }
 
-        connectionNames.append(connection->name());
+        connectionNames.insert(connection->name());
         interconnectionValidator_->findErrorsInInterconnection(errors, connection, context);
     }
 }
@@ -315,19 +333,19 @@ void DesignValidator::findErrorsInMonitorInterconnections(QVector<QString>& erro
         return;
     }
 
-    interconnectionValidator_->changeComponentInstances(design->getComponentInstances());
-    QVector<QString> connectionNames;
-    QVector<QString> duplicateNames;
+    setupValidationContext(design);
+    QSet<QString> connectionNames;
+    QSet<QString> duplicateNames;
     for (QSharedPointer<MonitorInterconnection> connection: *design->getMonitorInterconnecions())
     {
         if (connectionNames.contains(connection->name()) && !duplicateNames.contains(connection->name()))
         {
             errors.append(QObject::tr("Monitor interconnection name %1 within %2 is not unique")
                 .arg(connection->name(), context));
-            duplicateNames.append(connection->name());
+            duplicateNames.insert(connection->name());
         }
 
-        connectionNames.append(connection->name());
+        connectionNames.insert(connection->name());
         interconnectionValidator_->findErrorsInMonitorInterconnection(errors, connection, context);
     }
 }
@@ -343,19 +361,19 @@ void DesignValidator::findErrorsInAdHocConnections(QVector<QString>& errors, QSh
         return;
     }
 
-    adHocConnectionValidator_->changeComponentInstances(design->getComponentInstances());
-    QVector<QString> connectionNames;
-    QVector<QString> duplicateNames;
+    setupValidationContext(design);
+    QSet<QString> connectionNames;
+    QSet<QString> duplicateNames;
     for (QSharedPointer<AdHocConnection> connection: *design->getAdHocConnections())
     {
         if (connectionNames.contains(connection->name()) && !duplicateNames.contains(connection->name()))
         {
             errors.append(QObject::tr("Ad hoc connection name %1 within %2 is not unique")
                 .arg(connection->name(), context));
-            duplicateNames.append(connection->name());
+            duplicateNames.insert(connection->name());
         }
 
-        connectionNames.append(connection->name());
+        connectionNames.insert(connection->name());
         adHocConnectionValidator_->findErrorsIn(errors, connection, context);
     }
 }
@@ -372,18 +390,18 @@ void DesignValidator::findErrorsInParameters(QVector<QString>& errors, QSharedPo
     }
     ParameterValidator parameterValidator(expressionParser_, QSharedPointer<QList<QSharedPointer<Choice> > >(), design->getRevision());
 
-    QVector<QString> parameterNames;
-    QVector<QString> duplicateNames;
+    QSet<QString> parameterNames;
+    QSet<QString> duplicateNames;
     for (QSharedPointer<Parameter> parameter : *design->getParameters())
     {
         if (parameterNames.contains(parameter->name()) && !duplicateNames.contains(parameter->name()))
         {
             errors.append(QObject::tr("Parameter name %1 within %2 is not unique.")
                 .arg(parameter->name(), context));
-            duplicateNames.append(parameter->name());
+            duplicateNames.insert(parameter->name());
         }
 
-        parameterNames.append(parameter->name());
+        parameterNames.insert(parameter->name());
         parameterValidator.findErrorsIn(errors, parameter, context);
     }
 }
@@ -399,18 +417,35 @@ void DesignValidator::findErrorsInAssertions(QVector<QString>& errors, QSharedPo
         return;
     }
 
-    QVector<QString> assertionNames;
-    QVector<QString> duplicateNames;
+    QSet<QString> assertionNames;
+    QSet<QString> duplicateNames;
     for (QSharedPointer<Assertion> assertion : *design->getAssertions())
     {
         if (assertionNames.contains(assertion->name()) && !duplicateNames.contains(assertion->name()))
         {
             errors.append(QObject::tr("Assertion name %1 within %2 is not unique.")
                 .arg(assertion->name(), context));
-            duplicateNames.append(assertion->name());
+            duplicateNames.insert(assertion->name());
         }
 
-        assertionNames.append(assertion->name());
+        assertionNames.insert(assertion->name());
         assertionValidator_->findErrorsIn(errors, assertion, context);
     }
 }
+
+//-----------------------------------------------------------------------------
+// Function: DesignValidator::setupValidationContext()
+//-----------------------------------------------------------------------------
+void DesignValidator::setupValidationContext(QSharedPointer<Design> design) const
+{
+    QSharedPointer<DesignValidationContext> context = validationContext_;
+    if (context.isNull() || context->getComponentInstances() != design->getComponentInstances())
+    {
+        context = QSharedPointer<DesignValidationContext>(
+            new DesignValidationContext(library_, design->getComponentInstances()));
+    }
+
+    componentInstanceValidator_->setValidationContext(context);
+    interconnectionValidator_->setValidationContext(context);
+    adHocConnectionValidator_->setValidationContext(context);
+}
@@ -23,6 +23,7 @@ class Design;
 class LibraryInterface;
 class ExpressionParser;
 
+class DesignValidationContext;
 class ComponentInstanceValidator;
 class InterconnectionValidator;
 class AdHocConnectionValidator;
@@ -133,6 +134,14 @@ private:
 	DesignValidator(DesignValidator const& rhs);
 	DesignValidator& operator=(DesignValidator const& rhs);
 
+    /*!
+     *  Create the validation context for the design and share it with the contained validators. A context
+     *  created for the whole validation of the design is reused.
+     *
+     *    @param [in] design  The selected design.
+     */
+    void setupValidationContext(QSharedPointer<Design> design) const;
+
     /*!
      *  Find errors in design VLNV.
      *
@@ -219,6 +228,12 @@ private:
 
     //! The used expression parser
     QSharedPointer<ExpressionParser> expressionParser_;
+
+    //! The used library interface.
+    LibraryInterface* library_;
+
+    //! The validation context shared during the validation of a whole design.
+    mutable QSharedPointer<DesignValidationContext> validationContext_;
 };
 
 #endif // DESIGNVALIDATOR_H
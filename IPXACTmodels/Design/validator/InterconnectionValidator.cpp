@@ -21,6 +21,7 @@
 #include <IPXACTmodels/Design/MonitorInterconnection.h>
 #include <IPXACTmodels/Design/ActiveInterface.h>
 #include <IPXACTmodels/Design/ComponentInstance.h>
+#include <IPXACTmodels/Design/validator/DesignValidationContext.h>
 
 #include <KactusAPI/include/ExpressionParser.h>
 
@@ -34,7 +35,8 @@
 InterconnectionValidator::InterconnectionValidator(QSharedPointer<ExpressionParser> parser,
     LibraryInterface* library):
 parser_(parser),
-libraryHandler_(library)
+libraryHandler_(library),
+validationContext_(new DesignValidationContext(library, nullptr))
 {
 
 }
@@ -53,7 +55,16 @@ InterconnectionValidator::~InterconnectionValidator()
 void InterconnectionValidator::changeComponentInstances(
     QSharedPointer<QList<QSharedPointer<ComponentInstance> > > newInstances)
 {
-    availableComponentInstances_ = newInstances;
+    validationContext_ = QSharedPointer<DesignValidationContext>(
+        new DesignValidationContext(libraryHandler_, newInstances));
+}
+
+//-----------------------------------------------------------------------------
+// Function: InterconnectionValidator::setValidationContext()
+//-----------------------------------------------------------------------------
+void InterconnectionValidator::setValidationContext(QSharedPointer<DesignValidationContext> context)
+{
+    validationContext_ = context;
 }
 
 //-----------------------------------------------------------------------------
@@ -123,21 +134,7 @@ bool InterconnectionValidator::activeInterfaceIsValid(QSharedPointer<ActiveInter
 QSharedPointer<ComponentInstance> InterconnectionValidator::getReferencedComponentInstance(
     QString const& instanceReference) const
 {
-    QSharedPointer<ComponentInstance> foundInstance = nullptr;
-    if (instanceReference.isEmpty() || availableComponentInstances_->isEmpty())
-    {
-        return foundInstance;
-    }
-
-    auto it = std::find_if(availableComponentInstances_->cbegin(), availableComponentInstances_->cend(),
-        [&instanceReference](auto const& instance) {return instance->getInstanceName() == instanceReference; });
-
-    if (it != availableComponentInstances_->cend())
-    {
-        foundInstance = *it;
-    }
-
-    return foundInstance;
+    return validationContext_->getComponentInstance(instanceReference);
 }
 
 //-----------------------------------------------------------------------------
@@ -146,15 +143,7 @@ QSharedPointer<ComponentInstance> InterconnectionValidator::getReferencedCompone
 QSharedPointer<const Component> InterconnectionValidator::getReferencedComponent(
     QSharedPointer<ComponentInstance> referencingInstance) const
 {
-    if (referencingInstance && referencingInstance->getComponentRef())
-    {
-        QSharedPointer<const Component> referencedComponent =
-            libraryHandler_->getModelReadOnly<Component>(*referencingInstance->getComponentRef());
-
-        return referencedComponent;
-    }
-
-    return QSharedPointer<const Component> ();
+    return validationContext_->getReferencedComponent(referencingInstance);
 }
 
 //-----------------------------------------------------------------------------
@@ -163,13 +152,7 @@ QSharedPointer<const Component> InterconnectionValidator::getReferencedComponent
 bool InterconnectionValidator::busReferenceIsValid(QSharedPointer<const Component> component,
     QString const& busReference) const
 {
-    if (busReference.isEmpty() || component == nullptr)
-    {
-        return false;
-    }
-        
-    return std::any_of(component->getBusInterfaces()->cbegin(), component->getBusInterfaces()->cend(),
-        [&busReference](auto const& currentBus) { return currentBus->name() == busReference; });
+    return validationContext_->getBusInterface(component, busReference).isNull() == false;
 }
 
 //-----------------------------------------------------------------------------
@@ -183,7 +166,7 @@ bool InterconnectionValidator::excludePortsAreValid(QSharedPointer<const Compone
         return true;
     }
 
-    auto busInterface = component->getBusInterface(activeInterface->getBusReference());
+    auto busInterface = validationContext_->getBusInterface(component, activeInterface->getBusReference());
 
     if (busInterface == nullptr)
     {
@@ -222,12 +205,12 @@ bool InterconnectionValidator::hasValidInterfaces(QSharedPointer<Interconnection
     }
     else
     {
-        QMap<QString, QString> interfaceReferences;
+        QSet<QPair<QString, QString> > interfaceReferences;
 
         if (interConnection->getStartInterface())
         {
-            interfaceReferences.insert(interConnection->getStartInterface()->getComponentReference(),
-                interConnection->getStartInterface()->getBusReference());
+            interfaceReferences.insert(qMakePair(interConnection->getStartInterface()->getComponentReference(),
+                interConnection->getStartInterface()->getBusReference()));
         }
 
         for (auto const& currentInterface: *interConnection->getActiveInterfaces())
@@ -239,12 +222,12 @@ bool InterconnectionValidator::hasValidInterfaces(QSharedPointer<Interconnection
             }
             else
             {
-                interfaceReferences.insert(currentInterface->getComponentReference(),
-                    currentInterface->getBusReference());
+                interfaceReferences.insert(qMakePair(currentInterface->getComponentReference(),
+                    currentInterface->getBusReference()));
             }
         }
 
-        QVector<QString> usedHierBusInterfaces;
+        QSet<QString> usedHierBusInterfaces;
         for (auto const& currentInterface : *interConnection->getHierInterfaces())
         {
             if (usedHierBusInterfaces.contains(currentInterface->getBusReference()) ||
@@ -254,7 +237,7 @@ bool InterconnectionValidator::hasValidInterfaces(QSharedPointer<Interconnection
             }
             else
             {
-                usedHierBusInterfaces.append(currentInterface->getBusReference());
+                usedHierBusInterfaces.insert(currentInterface->getBusReference());
             }
         }
 
@@ -265,18 +248,11 @@ bool InterconnectionValidator::hasValidInterfaces(QSharedPointer<Interconnection
 //-----------------------------------------------------------------------------
 // Function: InterconnectionValidator::referenceCombinationIsUnique()
 //-----------------------------------------------------------------------------
-bool InterconnectionValidator::referenceCombinationIsUnique(QMap<QString, QString> referenceCombinations,
-    QString const& componentReference, QString const& busReference) const
+bool InterconnectionValidator::referenceCombinationIsUnique(
+    QSet<QPair<QString, QString> > const& referenceCombinations, QString const& componentReference,
+    QString const& busReference) const
 {
-    for (auto it = referenceCombinations.cbegin(); it != referenceCombinations.cend(); ++it)
-    {
-        if (it.key() == componentReference && it.value() == busReference)
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return referenceCombinations.contains(qMakePair(componentReference, busReference)) == false;
 }
 
 //-----------------------------------------------------------------------------
@@ -333,11 +309,11 @@ bool InterconnectionValidator::hasValidMonitorInterfaces(QSharedPointer<MonitorI
         return false;
     }
 
-    QMap<QString, QString> interfaceReferences;
+    QSet<QPair<QString, QString> > interfaceReferences;
     if (connection->getMonitoredActiveInterface())
     {
-        interfaceReferences.insert(connection->getMonitoredActiveInterface()->getComponentReference(),
-            connection->getMonitoredActiveInterface()->getBusReference());
+        interfaceReferences.insert(qMakePair(connection->getMonitoredActiveInterface()->getComponentReference(),
+            connection->getMonitoredActiveInterface()->getBusReference()));
     }
 
     for (auto const& monitorInterface : *connection->getMonitorInterfaces())
@@ -350,7 +326,8 @@ bool InterconnectionValidator::hasValidMonitorInterfaces(QSharedPointer<MonitorI
         }
         else
         {
-            interfaceReferences.insert(monitorInterface->getComponentReference(), monitorInterface->getBusReference());
+            interfaceReferences.insert(qMakePair(monitorInterface->getComponentReference(),
+                monitorInterface->getBusReference()));
         }
     }
 
@@ -492,7 +469,8 @@ void InterconnectionValidator::findErrorsInExcludePorts(QVector<QString>& errors
 {
     if (!activeInterface->getExcludePorts()->isEmpty())
     {
-        auto busInterface = referencedComponent->getBusInterface(activeInterface->getBusReference());
+        auto busInterface =
+            validationContext_->getBusInterface(referencedComponent, activeInterface->getBusReference());
         if (busInterface == nullptr)
         {
             return;
@@ -525,12 +503,12 @@ void InterconnectionValidator::findErrorsInInterfaces(QVector<QString>& errors,
     }
     else
     {
-        QMap<QString, QString> interfaceReferences;
+        QSet<QPair<QString, QString> > interfaceReferences;
 
         if (interConnection->getStartInterface())
         {
-            interfaceReferences.insert(interConnection->getStartInterface()->getComponentReference(),
-                interConnection->getStartInterface()->getBusReference());
+            interfaceReferences.insert(qMakePair(interConnection->getStartInterface()->getComponentReference(),
+                interConnection->getStartInterface()->getBusReference()));
         }
 
         for (QSharedPointer<ActiveInterface> currentInterface : *interConnection->getActiveInterfaces())
@@ -545,14 +523,14 @@ void InterconnectionValidator::findErrorsInInterfaces(QVector<QString>& errors,
             }
             else
             {
-                interfaceReferences.insert(currentInterface->getComponentReference(),
-                    currentInterface->getBusReference());
+                interfaceReferences.insert(qMakePair(currentInterface->getComponentReference(),
+                    currentInterface->getBusReference()));
             }
 
             findErrorsInActiveInterface(errors, currentInterface, innerContext, context);
         }
 
-        QVector<QString> usedHierBusReferences;
+        QSet<QString> usedHierBusReferences;
         for (QSharedPointer<HierInterface> hierarchicalInterface : *interConnection->getHierInterfaces())
         {
             if (usedHierBusReferences.contains(hierarchicalInterface->getBusReference()))
@@ -563,7 +541,7 @@ void InterconnectionValidator::findErrorsInInterfaces(QVector<QString>& errors,
             }
             else
             {
-                usedHierBusReferences.append(hierarchicalInterface->getBusReference());
+                usedHierBusReferences.insert(hierarchicalInterface->getBusReference());
             }
 
             findErrorsInIsPresent(errors, hierarchicalInterface->getIsPresent(), innerContext, context);
@@ -632,11 +610,11 @@ void InterconnectionValidator::findErrorsInMonitorInterfaces(QVector<QString>& e
 {
     if (!connection->getMonitorInterfaces()->isEmpty())
     {
-        QMap<QString, QString> interfaceReferences;
+        QSet<QPair<QString, QString> > interfaceReferences;
         if (connection->getMonitoredActiveInterface())
         {
-            interfaceReferences.insert(connection->getMonitoredActiveInterface()->getComponentReference(),
-                connection->getMonitoredActiveInterface()->getBusReference());
+            interfaceReferences.insert(qMakePair(connection->getMonitoredActiveInterface()->getComponentReference(),
+                connection->getMonitoredActiveInterface()->getBusReference()));
         }
 
         QString elementName = QLatin1String("monitor interface");
@@ -652,8 +630,8 @@ void InterconnectionValidator::findErrorsInMonitorInterfaces(QVector<QString>& e
             }
             else
             {
-                interfaceReferences.insert(monitorInterface->getComponentReference(),
-                    monitorInterface->getBusReference());
+                interfaceReferences.insert(qMakePair(monitorInterface->getComponentReference(),
+                    monitorInterface->getBusReference()));
             }
 
             findErrorsInSingleMonitorInterface(errors, monitorInterface, elementName, innerContext, context);
@@ -14,6 +14,8 @@
 
 #include <IPXACTmodels/ipxactmodels_global.h>
 
+#include <QPair>
+#include <QSet>
 #include <QSharedPointer>
 #include <QString>
 #include <QVector>
@@ -32,6 +34,8 @@ class ComponentInstance;
 class BusInterface;
 class PortMap;
 
+class DesignValidationContext;
+
 //-----------------------------------------------------------------------------
 //! Validator for the ipxact:interconnection and ipxact:monitorInterconnection.
 //-----------------------------------------------------------------------------
@@ -51,12 +55,20 @@ public:
 	~InterconnectionValidator();
     
     /*!
-     *  Change the available component instances.
+     *  Change the available component instances. The instances are indexed by name, so this must be called
+     *  again after instances are added, removed or renamed.
      *
      *    @param [in] newInstances    The new component instances.
      */
     void changeComponentInstances(QSharedPointer<QList<QSharedPointer<ComponentInstance> > > newInstances);
 
+    /*!
+     *  Change the validation context holding the available component instances.
+     *
+     *    @param [in] context     The validation context of the design.
+     */
+    void setValidationContext(QSharedPointer<DesignValidationContext> context);
+
     /*!
      *  Validates the given interconnection.
      *
@@ -164,7 +176,7 @@ private:
      *
      *    @return True, if the component / bus interface reference pair is unique, otherwise false.
      */
-    bool referenceCombinationIsUnique(QMap<QString, QString> referenceCombinations,
+    bool referenceCombinationIsUnique(QSet<QPair<QString, QString> > const& referenceCombinations,
         QString const& componentReference, QString const& busReference) const;
 
     /*!
@@ -375,9 +387,8 @@ private:
     //! The containing library.
     LibraryInterface* libraryHandler_;
 
-    //! The currently available component instances.
-    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > availableComponentInstances_ =
-        QSharedPointer<QList<QSharedPointer<ComponentInstance> > >(new QList<QSharedPointer<ComponentInstance> >());
+    //! The currently available component instances and their referenced components.
+    QSharedPointer<DesignValidationContext> validationContext_;
 };
 
 #endif // INTERCONNETIONVALIDATOR_H
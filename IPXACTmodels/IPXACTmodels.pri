@@ -135,6 +135,7 @@ HEADERS += ./generaldeclarations.h \
     ./Design/DesignWriter.h \
     ./Design/validator/AdHocConnectionValidator.h \
     ./Design/validator/ComponentInstanceValidator.h \
+    ./Design/validator/DesignValidationContext.h \
     ./Design/validator/DesignValidator.h \
     ./Design/validator/InterconnectionValidator.h \
     ./Component/AccessPolicy.h \
@@ -440,6 +441,7 @@ SOURCES += ./Component/validators/CollectionValidators.cpp \
     ./Design/PortReference.cpp \
     ./Design/validator/AdHocConnectionValidator.cpp \
     ./Design/validator/ComponentInstanceValidator.cpp \
+    ./Design/validator/DesignValidationContext.cpp \
     ./Design/validator/DesignValidator.cpp \
     ./Design/validator/InterconnectionValidator.cpp \
     ./Component/AccessPolicy.cpp \
@@ -198,6 +198,8 @@ HEADERS += ./common/widgets/instanceWidgets/InstanceWidgets.h \
     ./wizards/ImportWizard/ImportInstancesEditor/ImportInstancesEditor.h \
     ./wizards/ImportWizard/ImportInstancesEditor/ImportInstancesDelegate.h \
     ./wizards/common/IPXactDiff.h \
+    ./wizards/common/StructuralDiff/StructuralDiff.h \
+    ./wizards/common/StructuralDiff/StructuralHashTree.h \
     ./wizards/common/IPXactElementComparator.h \
     ./wizards/common/ListComparator.h \
     ./wizards/common/ComponentComparator/ComponentComparator.h \
@@ -678,6 +680,7 @@ HEADERS += ./common/widgets/instanceWidgets/InstanceWidgets.h \
     ./editors/BusDefinitionEditor/SystemGroupListEditor.h \
     ./editors/common/ColumnTypes.h \
     ./editors/common/DefaultRouting.h \
+    ./editors/common/OrthogonalRouter.h \
     ./editors/common/DesignDiagramResolver.h \
     ./editors/common/DesignWidgetFactory.h \
     ./editors/common/DesignWidgetFactoryImplementation.h \
@@ -691,6 +694,7 @@ HEADERS += ./common/widgets/instanceWidgets/InstanceWidgets.h \
     ./editors/common/PortUtilities.h \
     ./editors/common/TopComponentParameterFinder.h \
     ./editors/common/ComponentDesignDiagram.h \
+    ./editors/common/ComponentSnapshots.h \
     ./editors/common/DesignCompletionModel.h \
     ./editors/common/DesignDiagram.h \
     ./editors/common/DesignWidget.h \
@@ -1085,6 +1089,8 @@ SOURCES += ./editors/ComponentEditor/busInterfaces/general/MasterModeEditor.cpp
     ./wizards/ImportWizard/ImportInstancesEditor/ImportInstancesDelegate.cpp \
     ./wizards/ImportWizard/ImportInstancesEditor/ImportInstancesEditor.cpp \
     ./wizards/common/IPXactDiff.cpp \
+    ./wizards/common/StructuralDiff/StructuralDiff.cpp \
+    ./wizards/common/StructuralDiff/StructuralHashTree.cpp \
     ./wizards/common/ComponentComparator/ComponentComparator.cpp \
     ./wizards/common/ComponentDiffWidget/ComponentDiffWidget.cpp \
     ./wizards/common/VLNVComparator/VLNVComparator.cpp \
@@ -1507,7 +1513,9 @@ SOURCES += ./editors/ComponentEditor/busInterfaces/general/MasterModeEditor.cpp
     ./editors/CatalogEditor/CatalogFileModel.cpp \
     ./editors/CatalogEditor/CatalogFileView.cpp \
     ./editors/common/ComponentDesignDiagram.cpp \
+    ./editors/common/ComponentSnapshots.cpp \
     ./editors/common/DefaultRouting.cpp \
+    ./editors/common/OrthogonalRouter.cpp \
     ./editors/common/DesignCompletionModel.cpp \
     ./editors/common/DesignDiagram.cpp \
     ./editors/common/DesignDiagramResolver.cpp \
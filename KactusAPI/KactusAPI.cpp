@@ -13,6 +13,7 @@
 
 #include <KactusAPI/include/VersionHelper.h>
 #include <KactusAPI/include/ConsoleMediator.h>
+#include <KactusAPI/include/TraceRecorder.h>
 
 #include <IPXACTmodels/Component/Component.h>
 #include <IPXACTmodels/Design/Design.h>
@@ -28,6 +29,7 @@
 #include <CLIGenerator.h>
 
 #include <KactusAPI/include/ImportRunner.h>
+#include <KactusAPI/include/BatchGenerationRunner.h>
 
 #include <QFileInfo>
 
@@ -345,6 +347,9 @@ void KactusAPI::runGenerator(IGeneratorPlugin* plugin, VLNV const& componentVLNV
 
     PluginUtilityAdapter adapter(library_, messageChannel_, VersionHelper::createVersionString(), parentWidget);
 
+    TRACE_SCOPE_DETAIL("generation", "IGeneratorPlugin::runGenerator",
+        (plugin ? plugin->getName() : QString()) + QStringLiteral(" ") + componentVLNV.toString());
+
     CLIGenerator* cliRunnable = dynamic_cast<CLIGenerator*>(plugin);
     if (parentWidget == nullptr && cliRunnable)
     {
@@ -356,6 +361,29 @@ void KactusAPI::runGenerator(IGeneratorPlugin* plugin, VLNV const& componentVLNV
     }    
 }
 
+//-----------------------------------------------------------------------------
+// Function: KactusAPI::runBatchGeneration()
+//-----------------------------------------------------------------------------
+int KactusAPI::runBatchGeneration(QString const& manifestPath, QString const& reportPath, int workerCount)
+{
+    BatchGenerationRunner runner(library_, messageChannel_);
+    if (runner.readManifest(manifestPath) == false)
+    {
+        return -1;
+    }
+
+    runner.setWorkerCount(workerCount);
+
+    int failedJobs = runner.run(getPlugins());
+
+    if (reportPath.isEmpty() == false)
+    {
+        runner.writeReport(reportPath);
+    }
+
+    return failedJobs;
+}
+
 //-----------------------------------------------------------------------------
 // Function: KactusAPI::getPlugins()
 //-----------------------------------------------------------------------------
@@ -159,6 +159,17 @@ public:
     static void runGenerator(IGeneratorPlugin* plugin, VLNV const& componentVLNV, QString const& viewName,
         QString const& outputDirectory, KactusAttribute::Implementation implementation, QWidget* parentWidget = nullptr);
 
+    /*!
+     * Run the generation jobs listed in a manifest file using the already loaded library.
+     *
+     *    @param [in] manifestPath        Path to the JSON manifest listing the generation jobs.
+     *    @param [in] reportPath          Path for the JSON report of the jobs. No report is written, if empty.
+     *    @param [in] workerCount         The maximum number of concurrent jobs. Values below one use all cores.
+     *
+     *    @return The number of failed jobs, or -1 if the manifest could not be read.
+     */
+    static int runBatchGeneration(QString const& manifestPath, QString const& reportPath, int workerCount);
+
     /*!
      * Get the list of available plugins.     
      *
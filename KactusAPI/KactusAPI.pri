@@ -17,6 +17,7 @@ HEADERS += ./include/KactusColors.h \
     ./include/AddressBlockInterface.h \
     ./include/AddressSpaceExpressionsGatherer.h \
     ./include/AdHocConnectionInterface.h \
+    ./include/BatchGenerationRunner.h \
     ./include/BusInterfaceInterface.h \
     ./include/BusInterfaceInterfaceFactory.h \
     ./include/BusInterfaceUtilities.h \
@@ -48,6 +49,7 @@ HEADERS += ./include/KactusColors.h \
     ./include/ImportColors.h \
     ./include/ImportPlugin.h \
     ./include/IncludeImportPlugin.h \
+    ./include/IncludePathSupport.h \
     ./include/InterconnectGenerator.h \
     ./include/InterconnectionInterface.h \
     ./include/InterconnectRTLWriter.h \
@@ -56,6 +58,7 @@ HEADERS += ./include/KactusColors.h \
     ./include/IPXactSystemVerilogParser.h \
     ./include/LibraryInterface.h \
     ./include/LibraryLoader.h \
+    ./include/LibraryWatcher.h \
     ./include/ListHelper.h \
     ./include/ListParameterFinder.h \
     ./include/MasterPortInterface.h \
@@ -85,6 +88,7 @@ HEADERS += ./include/KactusColors.h \
     ./include/PortAbstractionInterface.h \
     ./include/PortMapInterface.h \
     ./include/PortsInterface.h \
+    ./include/RecordingParameterFinder.h \
     ./include/RegisterExpressionsGatherer.h \
     ./include/RegisterFileExpressionsGatherer.h \
     ./include/RegisterInterface.h \
@@ -95,6 +99,7 @@ HEADERS += ./include/KactusColors.h \
     ./include/TagManager.h \
     ./include/TransparentBridgeInterface.h \
     ./include/utils.h \
+    ./include/TraceRecorder.h \
     ./include/VersionHelper.h \
     ./include/ComponentInstanceParameterFinder.h \
     ./include/hierarchyitem.h \
@@ -106,6 +111,7 @@ HEADERS += ./include/KactusColors.h \
     ./include/ArrayableMemoryInterface.h \
     ./include/LibraryModel.h \
     ./include/ParameterCache.h \
+    ./include/SerializedLibraryInterface.h \
     ./include/ListFinder.h
 SOURCES += ./KactusAPI.cpp \
     ./expressions/AddressBlockExpressionsGatherer.cpp \
@@ -128,6 +134,7 @@ SOURCES += ./KactusAPI.cpp \
     ./expressions/NullParser.cpp \
     ./expressions/ParameterCache.cpp \
     ./expressions/ParameterConfigurableElementFinder.cpp \
+    ./expressions/RecordingParameterFinder.cpp \
     ./expressions/RegisterExpressionsGatherer.cpp \
     ./expressions/RegisterFileExpressionsGatherer.cpp \
     ./expressions/SystemVerilogExpressionParser.cpp \
@@ -162,6 +169,7 @@ SOURCES += ./KactusAPI.cpp \
     ./interfaces/design/AdHocConnectionInterface.cpp \
     ./interfaces/design/ComponentInstanceInterface.cpp \
     ./interfaces/design/InterconnectionInterface.cpp \
+    ./plugins/BatchGenerationRunner.cpp \
     ./plugins/ImportHighlighter.cpp \
     ./plugins/ImportRunner.cpp \
     ./plugins/PluginManager.cpp \
@@ -174,6 +182,7 @@ SOURCES += ./KactusAPI.cpp \
     ./utilities/KactusColors.cpp \
     ./utilities/NullChannel.cpp \
     ./utilities/utils.cpp \
+    ./utilities/TraceRecorder.cpp \
     ./utilities/VersionHelper.cpp \
     ./library/DocumentFileAccess.cpp \
     ./library/DocumentValidator.cpp \
@@ -182,6 +191,8 @@ SOURCES += ./KactusAPI.cpp \
     ./library/LibraryHandler.cpp \
     ./library/LibraryItem.cpp \
     ./library/LibraryLoader.cpp \
+    ./library/LibraryWatcher.cpp \
+    ./library/SerializedLibraryInterface.cpp \
     ./interfaces/component/ArrayableMemoryInterface.cpp \
     ./library/LibraryModel.cpp \
     ./library/TagManager.cpp
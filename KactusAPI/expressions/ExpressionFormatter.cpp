@@ -15,9 +15,20 @@
 
 #include <IPXACTmodels/common/validators/ValueFormatter.h>
 
-#include <QStringList>
-#include <QRegularExpression>
+#include <QStringView>
 
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: isReferenceCharacter()
+    //-----------------------------------------------------------------------------
+    bool isReferenceCharacter(QChar character)
+    {
+        char16_t const code = character.unicode();
+        return (code >= u'a' && code <= u'z') || (code >= u'A' && code <= u'Z') ||
+            (code >= u'0' && code <= u'9') || code == u':' || code == u'_' || code == u'.';
+    }
+}
 
 //-----------------------------------------------------------------------------
 // Function: ExpressionFormatter::ExpressionFormatter()
@@ -57,12 +68,19 @@ QString ExpressionFormatter::format(QString const& expression, QSharedPointer<Ex
 //-----------------------------------------------------------------------------
 QString ExpressionFormatter::getFormattedValue(QString const& expression, QSharedPointer<ExpressionParser> parser, bool* expressionIsValid)
 {
-    QString value = parser->parseExpression(expression, expressionIsValid);
+    int base = 0;
+    bool isValid = false;
+    QString value = parser->parseExpressionAndBase(expression, &isValid, &base);
 
-    if (expressionIsValid && *expressionIsValid == true)
+    if (expressionIsValid)
+    {
+        *expressionIsValid = isValid;
+    }
+
+    if (isValid)
     {
         ValueFormatter formatter;
-        return formatter.format(value, parser->baseForExpression(expression));
+        return formatter.format(value, base);
     }
     else
     {
@@ -75,16 +93,39 @@ QString ExpressionFormatter::getFormattedValue(QString const& expression, QShare
 //-----------------------------------------------------------------------------
 QString ExpressionFormatter::formatReferringExpression(QString const& expression) const
 {
-    static const QRegularExpression NON_ALPHA_CHARACTERS("[^a-zA-Z0-9:_.]+");
+    QString formattedExpression;
+    formattedExpression.reserve(expression.size());
+
+    // Copy the expression in a single pass, replacing each reference token with the referenced name.
+    QString name;
+    int const length = expression.size();
+    int position = 0;
+    while (position < length)
+    {
+        int tokenEnd = position;
+        while (tokenEnd < length && isReferenceCharacter(expression.at(tokenEnd)))
+        {
+            ++tokenEnd;
+        }
 
-    QString formattedExpression = expression;
+        if (tokenEnd == position)
+        {
+            formattedExpression.append(expression.at(position));
+            ++position;
+            continue;
+        }
 
-    for (QString const& valueID : expression.split(NON_ALPHA_CHARACTERS, Qt::SkipEmptyParts))
-    {
-        if (parameterFinder_->hasId(valueID))
+        QStringView token = QStringView(expression).mid(position, tokenEnd - position);
+        if (parameterFinder_->findNameForId(token, name))
+        {
+            formattedExpression.append(name);
+        }
+        else
         {
-            formattedExpression.replace(valueID, parameterFinder_->nameForId(valueID));
+            formattedExpression.append(token);
         }
+
+        position = tokenEnd;
     }
 
     return formattedExpression;
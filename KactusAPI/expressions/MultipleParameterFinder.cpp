@@ -78,6 +78,15 @@ QString MultipleParameterFinder::nameForId(QStringView id) const
     return getParameterWithID(id)->name();
 }
 
+//-----------------------------------------------------------------------------
+// Function: MultipleParameterFinder::findNameForId()
+//-----------------------------------------------------------------------------
+bool MultipleParameterFinder::findNameForId(QStringView id, QString& name) const
+{
+    return std::any_of(finders_.cbegin(), finders_.cend(),
+        [id, &name](const auto& finder) { return finder->findNameForId(id, name); });
+}
+
 //-----------------------------------------------------------------------------
 // Function: MultipleParameterFinder::valueForId()
 //-----------------------------------------------------------------------------
@@ -32,6 +32,21 @@ bool ParameterCache::hasId(QStringView id) const
     return availableParameters_.contains(id.toString());
 }
 
+//-----------------------------------------------------------------------------
+// Function: ParameterCache::findNameForId()
+//-----------------------------------------------------------------------------
+bool ParameterCache::findNameForId(QStringView id, QString& name) const
+{
+    auto parameter = availableParameters_.constFind(id.toString());
+    if (parameter == availableParameters_.cend())
+    {
+        return false;
+    }
+
+    name = parameter.value()->name();
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ParameterCache::getAllParameterIds()
 //-----------------------------------------------------------------------------
@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------------
+// File: RecordingParameterFinder.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Parameter finder recording the ids of the parameters searched through it.
+//-----------------------------------------------------------------------------
+
+#include "RecordingParameterFinder.h"
+
+#include <IPXACTmodels/common/Parameter.h>
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::RecordingParameterFinder()
+//-----------------------------------------------------------------------------
+RecordingParameterFinder::RecordingParameterFinder(QSharedPointer<ParameterFinder> finder):
+finder_(finder)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::beginRecording()
+//-----------------------------------------------------------------------------
+void RecordingParameterFinder::beginRecording() const
+{
+    recordings_.append(QSet<QString>());
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::endRecording()
+//-----------------------------------------------------------------------------
+QSet<QString> RecordingParameterFinder::endRecording() const
+{
+    Q_ASSERT(recordings_.isEmpty() == false);
+
+    return recordings_.takeLast();
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::getParameterWithID()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> RecordingParameterFinder::getParameterWithID(QStringView parameterId) const
+{
+    record(parameterId);
+    return finder_->getParameterWithID(parameterId);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::hasId()
+//-----------------------------------------------------------------------------
+bool RecordingParameterFinder::hasId(QStringView id) const
+{
+    record(id);
+    return finder_->hasId(id);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::nameForId()
+//-----------------------------------------------------------------------------
+QString RecordingParameterFinder::nameForId(QStringView id) const
+{
+    record(id);
+    return finder_->nameForId(id);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::findNameForId()
+//-----------------------------------------------------------------------------
+bool RecordingParameterFinder::findNameForId(QStringView id, QString& name) const
+{
+    record(id);
+    return finder_->findNameForId(id, name);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::valueForId()
+//-----------------------------------------------------------------------------
+QString RecordingParameterFinder::valueForId(QStringView id) const
+{
+    record(id);
+    return finder_->valueForId(id);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::getAllParameterIds()
+//-----------------------------------------------------------------------------
+QStringList RecordingParameterFinder::getAllParameterIds() const
+{
+    return finder_->getAllParameterIds();
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::getNumberOfParameters()
+//-----------------------------------------------------------------------------
+int RecordingParameterFinder::getNumberOfParameters() const
+{
+    return finder_->getNumberOfParameters();
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::registerParameterModel()
+//-----------------------------------------------------------------------------
+void RecordingParameterFinder::registerParameterModel(QAbstractItemModel const* model)
+{
+    finder_->registerParameterModel(model);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RecordingParameterFinder::record()
+//-----------------------------------------------------------------------------
+void RecordingParameterFinder::record(QStringView id) const
+{
+    if (recordings_.isEmpty() == false)
+    {
+        recordings_.last().insert(id.toString());
+    }
+}
@@ -12,6 +12,8 @@
 #include "SystemVerilogExpressionParser.h"
 #include "SystemVerilogSyntax.h"
 
+#include <KactusAPI/include/TraceRecorder.h>
+
 #include <QRegularExpression>
 #include <QMap>
 #include <QStringBuilder>
@@ -64,6 +66,8 @@ namespace
 //-----------------------------------------------------------------------------
 QString SystemVerilogExpressionParser::parseExpression(QStringView expression, bool* validExpression) const
 {
+    TRACE_SCOPE("expression", "SystemVerilogExpressionParser::parseExpression");
+
 	// Copy of expression needs to be created for replacing unary minuses with special character.
 	QString expressionCopy = expression.toString();
 	return solveRPN(convertToRPN(expressionCopy), validExpression);
@@ -90,9 +94,44 @@ bool SystemVerilogExpressionParser::isPlainValue(QStringView expression) const
 //-----------------------------------------------------------------------------
 int SystemVerilogExpressionParser::baseForExpression(QStringView expression) const
 {
-    int greatestBase = 0;
     QString asStr = expression.toString();
-    for (auto const& token : convertToRPN(asStr))
+    return baseForRPN(convertToRPN(asStr));
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::parseExpressionAndBase()
+//-----------------------------------------------------------------------------
+QString SystemVerilogExpressionParser::parseExpressionAndBase(QStringView expression, bool* validExpression,
+    int* base) const
+{
+    TRACE_SCOPE("expression", "SystemVerilogExpressionParser::parseExpressionAndBase");
+
+    QString expressionCopy = expression.toString();
+    QVector<QStringView> rpn = convertToRPN(expressionCopy);
+
+    bool isValid = false;
+    QString value = solveRPN(rpn, &isValid);
+
+    if (validExpression != nullptr)
+    {
+        *validExpression = isValid;
+    }
+
+    if (isValid && base != nullptr)
+    {
+        *base = baseForRPN(rpn);
+    }
+
+    return value;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::baseForRPN()
+//-----------------------------------------------------------------------------
+int SystemVerilogExpressionParser::baseForRPN(QVector<QStringView> const& rpn) const
+{
+    int greatestBase = 0;
+    for (auto const& token : rpn)
     {
         if (isLiteral(token))
         {
@@ -0,0 +1,155 @@
+//-----------------------------------------------------------------------------
+// File: BatchGenerationRunner.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Runs a manifest of generation jobs against a single loaded library using a pool of worker threads.
+//-----------------------------------------------------------------------------
+
+#ifndef BATCHGENERATIONRUNNER_H
+#define BATCHGENERATIONRUNNER_H
+
+#include <KactusAPI/KactusAPIGlobal.h>
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class IPlugin;
+class LibraryInterface;
+class MessageMediator;
+
+//-----------------------------------------------------------------------------
+//! Runs a manifest of generation jobs against a single loaded library using a pool of worker threads.
+//!
+//! The manifest is a JSON document of the form
+//! { "jobs": [ { "vlnv": "vendor:library:name:version", "view": "rtl",
+//!               "generator": "Verilog generator", "output": "path/to/output" }, ... ] }
+//-----------------------------------------------------------------------------
+class KACTUS2_API BatchGenerationRunner
+{
+public:
+
+    //! A single generation to run.
+    struct Job
+    {
+        //! The component to run the generation for.
+        VLNV componentVLNV;
+
+        //! The component view to run the generation for.
+        QString viewName;
+
+        //! The name of the generator plugin to run.
+        QString generatorName;
+
+        //! The target directory for generated files.
+        QString outputDirectory;
+    };
+
+    //! The outcome of a single generation.
+    struct JobResult
+    {
+        //! The executed job.
+        Job job;
+
+        //! Exit status of the job, 0 for success.
+        int exitStatus = 0;
+
+        //! Time spent in the job in milliseconds.
+        qint64 elapsedTime = 0;
+
+        //! Errors reported during the job.
+        QStringList errors;
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] library         The library to run the generations against.
+     *    @param [in] messageChannel  The channel for output and error messages.
+     */
+    BatchGenerationRunner(LibraryInterface* library, MessageMediator* messageChannel);
+
+    //! The destructor.
+    ~BatchGenerationRunner() = default;
+
+    // Disable copying.
+    BatchGenerationRunner(BatchGenerationRunner const& rhs) = delete;
+    BatchGenerationRunner& operator=(BatchGenerationRunner const& rhs) = delete;
+
+    /*!
+     *  Reads the jobs from a manifest file.
+     *
+     *    @param [in] manifestPath    Path to the manifest file.
+     *
+     *    @return True, if the manifest was read successfully, otherwise false.
+     */
+    bool readManifest(QString const& manifestPath);
+
+    /*!
+     *  Sets the maximum number of concurrently running jobs.
+     *
+     *    @param [in] workerCount     The number of workers. Values below one use the ideal thread count.
+     */
+    void setWorkerCount(int workerCount);
+
+    /*!
+     *  Runs all the jobs in the manifest.
+     *
+     *    @param [in] plugins     The available plugins.
+     *
+     *    @return The number of failed jobs.
+     */
+    int run(QList<IPlugin*> const& plugins);
+
+    /*!
+     *  Writes the results of the previous run into a JSON report.
+     *
+     *    @param [in] reportPath  Path to the report file.
+     *
+     *    @return True, if the report was written successfully, otherwise false.
+     */
+    bool writeReport(QString const& reportPath) const;
+
+    /*!
+     *  Gets the jobs read from the manifest.
+     *
+     *    @return The jobs to run.
+     */
+    QVector<Job> getJobs() const;
+
+    /*!
+     *  Gets the results of the previous run.
+     *
+     *    @return The job results in manifest order.
+     */
+    QVector<JobResult> getResults() const;
+
+private:
+
+    //! The library to run the generations against.
+    LibraryInterface* library_;
+
+    //! The channel for output and error messages.
+    MessageMediator* messageChannel_;
+
+    //! The maximum number of concurrently running jobs.
+    int workerCount_ = 0;
+
+    //! Time spent in the whole run in milliseconds.
+    qint64 totalElapsedTime_ = 0;
+
+    //! The jobs to run.
+    QVector<Job> jobs_;
+
+    //! The results of the previous run.
+    QVector<JobResult> results_;
+};
+
+#endif // BATCHGENERATIONRUNNER_H
@@ -14,6 +14,7 @@
 
 #include <KactusAPI/KactusAPIGlobal.h>
 
+#include <QByteArray>
 #include <QSharedPointer>
 #include <QString>
 
@@ -32,6 +33,12 @@ namespace DocumentFileAccess
     //! Writes to document model to the given path.
     KACTUS2_API bool writeDocument(QSharedPointer<Document> model, QString const& path);
 
+    //! Serializes the document model into a buffer. Returns an empty buffer for unknown document types.
+    KACTUS2_API QByteArray serializeDocument(QSharedPointer<Document> model);
+
+    //! Writes the contents to the given path through a temporary file. Files with identical contents are skipped.
+    KACTUS2_API bool writeContents(QByteArray const& contents, QString const& path);
+
 };
 
 #endif // DOCUMENTFILEACCESS_H
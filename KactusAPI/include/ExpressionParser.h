@@ -52,6 +52,33 @@ public:
      *    @return The common base for the expression.
      */
     virtual int baseForExpression(QStringView expression) const = 0;
+
+    /*!
+     *  Parses an expression to decimal number and finds the common base in the expression.
+     *
+     *    @param [in]  expression         The expression to parse.
+     *    @param [out] validExpression    Set to true, if the parsing was successful, otherwise false. May be null.
+     *    @param [out] base               The common base for a valid expression. May be null.
+     *
+     *    @return The decimal value of the evaluated expression.
+     */
+    virtual QString parseExpressionAndBase(QStringView expression, bool* validExpression, int* base) const
+    {
+        bool isValid = false;
+        QString value = parseExpression(expression, &isValid);
+
+        if (validExpression != nullptr)
+        {
+            *validExpression = isValid;
+        }
+
+        if (isValid && base != nullptr)
+        {
+            *base = baseForExpression(expression);
+        }
+
+        return value;
+    }
 };
 
 #endif // EXPRESSIONPARSER_H
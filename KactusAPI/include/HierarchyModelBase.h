@@ -204,6 +204,14 @@ public slots:
 
     //! Remove the specified vlnv from the tree.
     void onRemoveVLNV(VLNV const& vlnv);
+
+    /*! Add the specified vlnv to the tree without resetting the model.
+     *
+     * Designs and configurations are not added, since they are shown under their top-components.
+     * 
+     *    @param [in] vlnv Identifies the document that was added to the library.
+    */
+    void onAddVLNV(VLNV const& vlnv);
     
     /*! This function should be called when an IP-XACT document has changed.
      * 
@@ -142,6 +142,17 @@ private:
      */
     QList<ImportPlugin*> includeImportPluginsForFileTypes(QStringList const& filetypes) const;
 
+    /*!
+     *  Finds the include directories of a given component.
+     *
+     *    @param [in] componentXmlPath    The path to the component XML file.
+     *    @param [in] component           The component whose include directories to find.
+     *
+     *    @return Absolute paths to the file set dependencies and the directories of the include files.
+     */
+    QStringList findIncludeDirectories(QString const& componentXmlPath,
+        QSharedPointer<const Component> component) const;
+
     /*!
      *  Finds the file types of a given file.
      *
@@ -245,6 +256,9 @@ private:
 
     //! List of currently available component declarations.
     QVector<AvailableComponent> componentsInFile_;
+
+    //! The include directories of the component being imported.
+    QStringList includeDirectories_;
 };
 
 #endif // IMPORTRUNNER_H
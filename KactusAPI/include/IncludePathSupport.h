@@ -0,0 +1,35 @@
+//-----------------------------------------------------------------------------
+// File: IncludePathSupport.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Interface for import plugins resolving the files included by the imported file.
+//-----------------------------------------------------------------------------
+
+#ifndef INCLUDEPATHSUPPORT_H
+#define INCLUDEPATHSUPPORT_H
+
+#include <QString>
+#include <QStringList>
+
+class IncludePathSupport
+{
+public:
+
+	//! The destructor.
+    virtual ~IncludePathSupport() {};
+
+    /*!
+     *  Sets the location of the next imported file.
+     *
+     *    @param [in] filePath              Absolute path to the imported file.
+     *    @param [in] includeDirectories    Absolute paths to the directories to search the included files from.
+     */
+    virtual void setInputLocation(QString const& filePath, QStringList const& includeDirectories) = 0;
+
+};
+
+#endif // INCLUDEPATHSUPPORT_H
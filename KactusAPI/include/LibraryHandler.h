@@ -15,6 +15,7 @@
 #include "LibraryInterface.h"
 #include "LibraryLoader.h"
 #include "LibraryModel.h"
+#include "LibraryWatcher.h"
 
 #include "HierarchyModelBase.h"
 
@@ -34,8 +35,12 @@
 #include <QString>
 #include <QStringList>
 #include <QList>
+#include <QMap>
+#include <QMutex>
 #include <QSharedPointer>
 #include <QObject>
+#include <QSet>
+#include <QVector>
 
 class LibraryItem;
 class MessageMediator;
@@ -49,6 +54,22 @@ class KACTUS2_API LibraryHandler : public QObject, public LibraryInterface
 
 public:
 
+    //! Statistics of the parsed documents in the library cache.
+    struct CacheStatistics
+    {
+        //! Number of document requests served from the cache.
+        quint64 hits = 0;
+
+        //! Number of document requests that read the document from disk.
+        quint64 misses = 0;
+
+        //! Number of documents evicted from the cache.
+        quint64 evictions = 0;
+
+        //! Estimated memory used by the parsed documents in the cache in bytes.
+        qint64 residentBytes = 0;
+    };
+
     //! The the instance of the library.
     static LibraryHandler& getInstance();
 
@@ -80,9 +101,35 @@ public:
      */
     void replaceHierarchyModel(HierarchyModelBase* model);
 
+    /*!
+     *  Set the memory budget for the parsed documents in the library cache.
+     *
+     *  When the budget is exceeded, the least recently used documents that are not in use outside the library
+     *  are evicted. The VLNV, path, validity and references of an evicted document are kept, and the document
+     *  is read again when it is next requested.
+     *
+     *    @param [in] budgetBytes     The budget in bytes, or zero for no limit.
+     */
+    void setCacheBudget(qint64 budgetBytes);
+
+    /*!
+     *  Get the memory budget for the parsed documents in the library cache.
+     *
+     *    @return The budget in bytes, or zero for no limit.
+     */
+    qint64 getCacheBudget() const;
+
+    /*!
+     *  Get the statistics of the library cache.
+     *
+     *    @return The cache statistics.
+     */
+    CacheStatistics getCacheStatistics() const;
+
     /*! Get a model that matches given VLNV.
      *
      * This function can be called to get a model that matches an IP-Xact document.
+     * Safe to call concurrently with itself and getModelReadOnly().
      * 
      *    @param [in] vlnv Identifies the desired document.
      *
@@ -93,6 +140,7 @@ public:
     /*! Get a model that matches given VLNV for read-only access.
      *
      * This function can be called to get a model that matches an IP-Xact document.
+     * Safe to call concurrently with itself and getModel().
      * 
      *    @param [in] vlnv Identifies the desired document.
      *
@@ -352,7 +400,8 @@ public slots:
     *
     * When calling this before saving and then using writeModelToFile() the 
     * library is not update between each save operation thus making the program
-    * faster.
+    * faster. The documents are written to disk in parallel when the save ends.
+    * Save operations may be nested, in which case the outermost save writes the documents.
     * 
     * Be sure to call endSave() after all items are saved.
     */
@@ -361,8 +410,12 @@ public slots:
     /*! End the saving operation and update the library.
     *
     * This function must be called always after calling the beginSave().
+    *
+    * @return False, if any document saved within the operation could not be written, otherwise true.
+    *         The documents of a nested save operation are written by the outermost one, so only the
+    *         outermost operation can report write failures.
     */
-    void endSave();
+    bool endSave();
 
 signals:
 
@@ -430,6 +483,18 @@ private slots:
     */
     void onItemSaved(VLNV const& vlnv);
 
+    /*! Updates the library for files changed outside the library.
+    *
+    * Only the changed documents and the documents referencing them are read and validated again, and the
+    * models are updated item by item.
+    * 
+    *    @param [in] addedFiles      Paths of the added files.
+    *    @param [in] removedFiles    Paths of the removed files.
+    *    @param [in] modifiedFiles   Paths of the modified files.
+    */
+    void onLibraryFilesChanged(QStringList const& addedFiles, QStringList const& removedFiles,
+        QStringList const& modifiedFiles);
+
 private:
 
     //! All relevant data about an IP-XACT document is stored in DocumentInfo.
@@ -438,6 +503,9 @@ private:
         QSharedPointer<Document> document;  //<! The model for the document.
         QString path;                       //<! The path to the file containing the document.
         bool isValid;                       //<! Flag for well-formed content.
+        QList<VLNV> references;             //<! The VLNVs referenced by the document, kept when evicted.
+        qint64 size = 0;                    //<! Estimated memory used by the parsed document.
+        quint64 lastUse = 0;                //<! The cache clock value at the latest request of the document.
 
         //! Constructor.
         explicit DocumentInfo(QString const& filePath = QString(), 
@@ -476,6 +544,50 @@ private:
     //! Clears the library cache of documents.
     void clearCache();
 
+    /*!
+     * Gets the parsed document of a cache entry, reading it from disk if it is not in the cache.
+     * The cache lock must be held by the caller.
+     *
+     *    @param [in] vlnv    The VLNV of the document.
+     *    @param [in] info    The cache entry of the document.
+     *
+     *    @return The parsed document.
+     */
+    QSharedPointer<Document> loadDocument(VLNV const& vlnv, DocumentInfo& info);
+
+    /*!
+     * Replaces the parsed document of a cache entry and updates the memory use of the cache.
+     * The cache lock must be held by the caller.
+     *
+     *    @param [in] vlnv        The VLNV of the document.
+     *    @param [in] info        The cache entry of the document.
+     *    @param [in] document    The new parsed document.
+     */
+    void setCachedDocument(VLNV const& vlnv, DocumentInfo& info, QSharedPointer<Document> document);
+
+    /*!
+     * Removes a document from the library cache.
+     *
+     *    @param [in] vlnv    The VLNV of the document to remove.
+     */
+    void removeCachedDocument(VLNV const& vlnv);
+
+    /*!
+     * Evicts the least recently used documents until the memory use of the cache is within the budget.
+     * Documents waiting to be written or whose write failed are not evicted, since their files are not up to date.
+     * The cache lock must be held by the caller.
+     *
+     *    @param [in] keep    The VLNV of a document that must not be evicted.
+     */
+    void enforceCacheBudget(VLNV const& keep);
+
+    /*!
+     * Writes the documents saved during the save operation to disk using a pool of worker threads.
+     *
+     *    @return True, if all the documents were written, otherwise false.
+     */
+    bool writePendingDocuments();
+
     //! Loads all available VLNVs into the library cache.
     void loadAvailableVLNVs();
 
@@ -485,6 +597,15 @@ private:
     //! Shows the results of the library integrity check.
     void showIntegrityResults() const;
 
+    /*!
+     * Finds the documents referencing any of the given documents.
+     *
+     *    @param [in] changedItems    The VLNVs of the changed documents as strings.
+     *
+     *    @return The referencing documents that are not in the changed documents.
+     */
+    QVector<VLNV> findReferencingDocuments(QSet<QString> const& changedItems) const;
+
     /*!
      * Removes the given file from the file system.
      *
@@ -573,6 +694,9 @@ private:
     //! Loads the library content.
     LibraryLoader loader_{ };
 
+    //! Watches the library locations for changes made outside the library.
+    LibraryWatcher watcher_{ };
+
     /*! Cache of documents in the library.
      *
      * Key = VLNV that identifies the library object.
@@ -580,6 +704,20 @@ private:
      */
     QMap<VLNV, DocumentInfo> documentCache_;
 
+    /*! Guards the document cache, when documents are requested from several threads.
+     *  Recursive, since validating a document under the lock queries the library again.
+     */
+    mutable QRecursiveMutex cacheMutex_;
+
+    //! The memory budget for the parsed documents in bytes, or zero for no limit.
+    qint64 cacheBudget_{ 0 };
+
+    //! The clock incremented on every document request, for finding the least recently used documents.
+    quint64 cacheClock_{ 0 };
+
+    //! Statistics of the document cache.
+    CacheStatistics cacheStatistics_;
+
     //! Checks if the given string is a URL (invalids are allowed) or not.
     QRegularExpressionValidator urlTester_{ Utils::URL_VALIDITY_REG_EXP, this };
 
@@ -593,8 +731,22 @@ private:
     //! The model for the hierarchy view
     QScopedPointer<HierarchyModelBase> hierarchyModel_ = QScopedPointer<HierarchyModelBase>(new HierarchyModelBase{ this, this });
 
-    //! If true then items are being saved and library is not refreshed
-    bool saveInProgress_{ false };
+    //! The number of nested save operations. While positive, items are saved and library is not refreshed.
+    int saveDepth_{ 0 };
+
+    /*! Copies of the documents to write when the save operation ends, with target file paths as keys.
+     *  Modified under the cache lock, since the cached documents of pending writes are not evicted.
+     */
+    QMap<QString, QSharedPointer<Document> > pendingWrites_;
+
+    /*! Target paths of the documents whose last write failed. The cached documents are newer than their files,
+     *  so they are not evicted until they are written, removed or read again from the changed files.
+     *  Modified under the cache lock.
+     */
+    QSet<QString> unwrittenPaths_;
+
+    //! The documents added to the library during the save operation.
+    QVector<VLNV> pendingAddedItems_;
 
     //! Statistics for library integrity check.
     DocumentStatistics checkResults_;
@@ -282,8 +282,12 @@ public slots:
     /*! End the saving operation and update the library.
     *
     * This function must be called always after calling the beginSave().
+    *
+    * @return False, if any document saved within the operation could not be written, otherwise true.
+    *         The documents of a nested save operation are written by the outermost one, so only the
+    *         outermost operation can report write failures.
     */
-    virtual void endSave() = 0;
+    virtual bool endSave() = 0;
 
 signals:
 
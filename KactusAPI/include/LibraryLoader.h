@@ -50,8 +50,6 @@ public:
 	*/
     QVector<LoadTarget> parseLibrary(MessageMediator const* messageChannel) const;
 
-private:
-
     /*! Finds the VLNV in the given file.
     *
     *    @param [in]		path	The file path to search.
@@ -60,6 +58,14 @@ private:
     */
     VLNV getDocumentVLNV(QString const& path, MessageMediator const* messageChannel) const;
 
+	/*! Gets the library locations that are searched for IP-XACT files.
+	*
+	*    @return The active library locations.
+	*/
+    QStringList getActiveLocations() const;
+
+private:
+
     /*! Clear the empty directories from the disk within given path.
      *
      *    @param [in] dirPath The path that is removed until one of the base library locations is reached.
@@ -0,0 +1,189 @@
+//-----------------------------------------------------------------------------
+// File: LibraryWatcher.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Watches the library locations for added, removed and modified IP-XACT files.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYWATCHER_H
+#define LIBRARYWATCHER_H
+
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QTimer>
+
+//-----------------------------------------------------------------------------
+//! Watches the library locations for added, removed and modified IP-XACT files.
+//!
+//! The watcher keeps the modification time and size of every XML file in the watched directories. File system
+//! notifications only mark directories for scanning, and the scan is delayed until the notifications stop, so
+//! that e.g. a version control checkout is reported as a single change.
+//!
+//! Directories are always watched. Files are watched individually only up to a limit, since every watched path
+//! consumes a system resource. Changes to the files beyond the limit are found when their directory changes,
+//! e.g. when a file is saved by replacing it.
+//-----------------------------------------------------------------------------
+class LibraryWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] parent  The parent object.
+     */
+    explicit LibraryWatcher(QObject* parent = nullptr);
+
+    //! The destructor.
+    ~LibraryWatcher() final = default;
+
+    // Disable copying.
+    LibraryWatcher(LibraryWatcher const& rhs) = delete;
+    LibraryWatcher& operator=(LibraryWatcher const& rhs) = delete;
+
+    /*!
+     *  Starts watching the given library locations and their subdirectories. Any previously watched locations
+     *  are no longer watched.
+     *
+     *    @param [in] locations   The library locations to watch.
+     */
+    void watch(QStringList const& locations);
+
+    /*!
+     *  Sets the maximum number of individually watched files. Applies to the files found after the call.
+     *
+     *    @param [in] limit   The maximum number of watched files.
+     */
+    void setWatchedFileLimit(int limit);
+
+    /*!
+     *  Updates the stored state of a file changed by the library itself, so the change is not reported.
+     *
+     *    @param [in] filePath    Path to the written or removed file.
+     */
+    void acknowledgeFile(QString const& filePath);
+
+signals:
+
+    /*!
+     *  Emitted when files in the watched locations have changed.
+     *
+     *    @param [in] addedFiles      Absolute paths of the added XML files.
+     *    @param [in] removedFiles    Absolute paths of the removed XML files.
+     *    @param [in] modifiedFiles   Absolute paths of the modified XML files.
+     */
+    void filesChanged(QStringList const& addedFiles, QStringList const& removedFiles,
+        QStringList const& modifiedFiles);
+
+private slots:
+
+    //! Marks a changed directory for scanning.
+    void onDirectoryChanged(QString const& path);
+
+    //! Marks the directory of a changed file for scanning.
+    void onFileChanged(QString const& path);
+
+    //! Scans the changed directories and reports the changed files.
+    void onScanTimeout();
+
+private:
+
+    //! The stored state of a file.
+    struct FileState
+    {
+        //! The last modification time in milliseconds since epoch.
+        qint64 modified = 0;
+
+        //! The file size in bytes.
+        qint64 size = 0;
+
+        bool operator==(FileState const& other) const
+        {
+            return modified == other.modified && size == other.size;
+        }
+    };
+
+    /*!
+     *  Reads the current state of a file.
+     *
+     *    @param [in] fileInfo    Information of the file.
+     *
+     *    @return The state of the file.
+     */
+    static FileState readState(QFileInfo const& fileInfo);
+
+    /*!
+     *  Adds a new directory and its subdirectories to the watched directories.
+     *
+     *    @param [in] directoryPath   Absolute path to the directory.
+     *    @param [out] addedFiles     The XML files found in the directories.
+     */
+    void addDirectory(QString const& directoryPath, QStringList& addedFiles);
+
+    /*!
+     *  Removes a directory and its subdirectories from the watched directories.
+     *
+     *    @param [in] directoryPath   Absolute path to the directory.
+     *    @param [out] removedFiles   The XML files that were in the directories.
+     */
+    void removeDirectory(QString const& directoryPath, QStringList& removedFiles);
+
+    /*!
+     *  Compares the contents of a directory to the stored state.
+     *
+     *    @param [in] directoryPath   Absolute path to the directory.
+     *    @param [out] addedFiles     The added XML files.
+     *    @param [out] removedFiles   The removed XML files.
+     *    @param [out] modifiedFiles  The modified XML files.
+     */
+    void scanDirectory(QString const& directoryPath, QStringList& addedFiles, QStringList& removedFiles,
+        QStringList& modifiedFiles);
+
+    /*!
+     *  Starts watching a file individually, if the limit of watched files allows.
+     *
+     *    @param [in] filePath    Absolute path to the file.
+     */
+    void watchFile(QString const& filePath);
+
+    /*!
+     *  Stops watching a file individually.
+     *
+     *    @param [in] filePath    Absolute path to the file.
+     */
+    void unwatchFile(QString const& filePath);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The file system watcher for the directories and files.
+    QFileSystemWatcher watcher_;
+
+    //! Delays scanning until the file system notifications stop.
+    QTimer scanTimer_;
+
+    //! The directories marked for scanning.
+    QSet<QString> changedDirectories_;
+
+    //! The states of the XML files by path, grouped by directory path.
+    QHash<QString, QHash<QString, FileState> > directories_;
+
+    //! The individually watched files.
+    QSet<QString> watchedFiles_;
+
+    //! The maximum number of individually watched files.
+    int watchedFileLimit_;
+};
+
+#endif // LIBRARYWATCHER_H
@@ -88,6 +88,16 @@ public:
      */
     QString nameForId(QStringView id) const final;
 
+    /*!
+     *  Finds the name of the parameter with the given id, if the parameter exists.
+     *
+     *    @param [in]  id     The id to search for.
+     *    @param [out] name   The name of the found parameter.
+     *
+     *    @return True, if the parameter with the given id exists, otherwise false.
+     */
+    bool findNameForId(QStringView id, QString& name) const final;
+
     /*!
      *  Finds the value of the parameter with the given id.
      *
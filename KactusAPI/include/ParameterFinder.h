@@ -55,6 +55,25 @@ public:
      */
     virtual QString nameForId(QStringView id) const = 0;
 
+    /*!
+     *  Finds the name of the parameter with the given id, if the parameter exists.
+     *
+     *    @param [in]  id     The id to search for.
+     *    @param [out] name   The name of the found parameter.
+     *
+     *    @return True, if the parameter with the given id exists, otherwise false.
+     */
+    virtual bool findNameForId(QStringView id, QString& name) const
+    {
+        if (hasId(id) == false)
+        {
+            return false;
+        }
+
+        name = nameForId(id);
+        return true;
+    }
+
     /*!
      *  Finds the value of the parameter with the given id.
      *
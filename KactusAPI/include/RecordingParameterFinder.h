@@ -0,0 +1,146 @@
+//-----------------------------------------------------------------------------
+// File: RecordingParameterFinder.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Parameter finder recording the ids of the parameters searched through it.
+//-----------------------------------------------------------------------------
+
+#ifndef RECORDINGPARAMETERFINDER_H
+#define RECORDINGPARAMETERFINDER_H
+
+#include "ParameterFinder.h"
+
+#include "KactusAPI/KactusAPIGlobal.h"
+
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Parameter finder recording the ids of the parameters searched through it.
+//-----------------------------------------------------------------------------
+class KACTUS2_API RecordingParameterFinder : public ParameterFinder
+{
+
+public:
+
+    /*!
+     *  Constructor.
+     *
+     *    @param [in] finder  The finder used to search the parameters.
+     */
+    explicit RecordingParameterFinder(QSharedPointer<ParameterFinder> finder);
+
+    /*!
+     *  Destructor.
+     */
+    ~RecordingParameterFinder() final = default;
+
+    //! No copying
+    RecordingParameterFinder(const RecordingParameterFinder& other) = delete;
+    //! No assignment
+    RecordingParameterFinder& operator=(const RecordingParameterFinder& other) = delete;
+
+    /*!
+     *  Starts recording the searched parameter ids. Recordings can be nested, in which case the ids are
+     *  recorded only to the innermost recording.
+     */
+    void beginRecording() const;
+
+    /*!
+     *  Ends the innermost recording.
+     *
+     *    @return The ids of the parameters searched during the recording.
+     */
+    QSet<QString> endRecording() const;
+
+    /*!
+     *  Get the parameter corresponding the id.
+     *
+     *    @param [in] parameterId     The id of the parameter being searched for.
+     */
+    QSharedPointer<Parameter> getParameterWithID(QStringView parameterId) const final;
+
+    /*!
+     *  Checks if a parameter with the given id exists.
+     *
+     *    @param [in] id      The id to search for.
+     *
+     *    @return True, if the parameter with the given id exists, otherwise false.
+     */
+    bool hasId(QStringView id) const final;
+
+    /*!
+     *  Finds the name of the parameter with the given id.
+     *
+     *    @param [in] id      The id to search for.
+     *
+     *    @return The name of the parameter.
+     */
+    QString nameForId(QStringView id) const final;
+
+    /*!
+     *  Finds the name of the parameter with the given id, if the parameter exists.
+     *
+     *    @param [in]  id     The id to search for.
+     *    @param [out] name   The name of the found parameter.
+     *
+     *    @return True, if the parameter with the given id exists, otherwise false.
+     */
+    bool findNameForId(QStringView id, QString& name) const final;
+
+    /*!
+     *  Finds the value of the parameter with the given id.
+     *
+     *    @param [in] id      The id of the parameter to search for.
+     *
+     *    @return The value of the parameter.
+     */
+    QString valueForId(QStringView id) const final;
+
+    /*!
+     *  Gets all of the ids of components parameters.
+     *
+     *    @return A list containing all of the ids.
+     */
+    QStringList getAllParameterIds() const final;
+
+    /*!
+     *  Gets the number of parameters in the component.
+     *
+     *    @return The number of parameters in the component.
+     */
+    int getNumberOfParameters() const final;
+
+    /*!
+     *  Registers a parameter model that can modify parameters for the finder.
+     *
+     *    @param [in] model   The model to register.
+     */
+    void registerParameterModel(QAbstractItemModel const* model) final;
+
+private:
+
+    /*!
+     *  Records the given id to the innermost recording, if any.
+     *
+     *    @param [in] id      The searched id.
+     */
+    void record(QStringView id) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The finder used to search the parameters.
+    QSharedPointer<ParameterFinder> finder_;
+
+    //! The ids recorded in the active recordings, innermost recording last.
+    mutable QVector<QSet<QString> > recordings_;
+};
+
+#endif // RECORDINGPARAMETERFINDER_H
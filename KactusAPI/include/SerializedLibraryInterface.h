@@ -0,0 +1,114 @@
+//-----------------------------------------------------------------------------
+// File: SerializedLibraryInterface.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Library interface that serializes the calls to another library interface.
+//-----------------------------------------------------------------------------
+
+#ifndef SERIALIZEDLIBRARYINTERFACE_H
+#define SERIALIZEDLIBRARYINTERFACE_H
+
+#include "LibraryInterface.h"
+
+#include <KactusAPI/KactusAPIGlobal.h>
+
+class QRecursiveMutex;
+
+//-----------------------------------------------------------------------------
+//! Library interface that serializes the calls to another library interface.
+//!
+//! The library handler parses documents into its cache lazily and is not safe for concurrent use. Threads
+//! sharing a library use serialized interfaces with the same lock. The lock is recursive, so the serialized
+//! interfaces may also be nested.
+//-----------------------------------------------------------------------------
+class KACTUS2_API SerializedLibraryInterface : public LibraryInterface
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] library     The library whose calls are serialized.
+     *    @param [in] lock        The lock shared by all users of the library.
+     */
+    SerializedLibraryInterface(LibraryInterface* library, QRecursiveMutex* lock);
+
+    /*!
+     *  The destructor.
+     */
+    virtual ~SerializedLibraryInterface() = default;
+
+    // No copying. No assignment.
+    SerializedLibraryInterface(SerializedLibraryInterface const& other) = delete;
+    SerializedLibraryInterface& operator=(SerializedLibraryInterface const& other) = delete;
+
+    QSharedPointer<Document> getModel(VLNV const& vlnv) override;
+
+    QSharedPointer<Document const> getModelReadOnly(VLNV const& vlnv) override;
+
+    bool contains(VLNV const& vlnv) const override;
+
+    QList<VLNV> getAllVLNVs() const override;
+
+    const QString getPath(VLNV const& vlnv) const override;
+
+    QString getDirectoryPath(VLNV const& vlnv) const override;
+
+    bool writeModelToFile(QString const& path, QSharedPointer<Document> model) override;
+
+    bool writeModelToFile(QSharedPointer<Document> model) override;
+
+    void searchForIPXactFiles() override;
+
+    void getNeededVLNVs(VLNV const& vlnv, QList<VLNV>& list) override;
+
+    void getDependencyFiles(VLNV const& vlnv, QStringList& list) override;
+
+    LibraryItem const* getTreeRoot() const override;
+
+    VLNV::IPXactType getDocumentType(VLNV const& vlnv) override;
+
+    int referenceCount(VLNV const& vlnv) const override;
+
+    int getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const override;
+
+    int getChildren(QList<VLNV>& list, VLNV const& vlnvToSearch) const override;
+
+    VLNV getDesignVLNV(VLNV const& hierarchyRef) override;
+
+    QSharedPointer<Design> getDesign(VLNV const& hierarchyRef) override;
+
+    bool isValid(VLNV const& vlnv) override;
+
+    void onCheckLibraryIntegrity() override;
+
+    void onEditItem(VLNV const& vlnv) override;
+
+    void onOpenDesign(VLNV const& vlnv, QString const& viewName) override;
+
+    void removeObject(VLNV const& vlnv) override;
+
+    void removeObjects(const QList<VLNV>& vlnvList) override;
+
+    void beginSave() override;
+
+    bool endSave() override;
+
+private:
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The library whose calls are serialized.
+    LibraryInterface* library_;
+
+    //! The lock shared by all users of the library.
+    QRecursiveMutex* lock_;
+};
+
+#endif // SERIALIZEDLIBRARYINTERFACE_H
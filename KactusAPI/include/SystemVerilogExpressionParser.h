@@ -73,6 +73,18 @@ public:
      */
     int baseForExpression(QStringView expression) const override;
 
+    /*!
+     *  Parses an expression to decimal number and finds the common base in the expression.
+     *  The expression is converted into tokens only once for both.
+     *
+     *    @param [in]  expression         The expression to parse.
+     *    @param [out] validExpression    Set to true, if the parsing was successful, otherwise false. May be null.
+     *    @param [out] base               The common base for a valid expression. May be null.
+     *
+     *    @return The decimal value of the evaluated expression.
+     */
+    QString parseExpressionAndBase(QStringView expression, bool* validExpression, int* base) const override;
+
 protected:
      
     /*!
@@ -161,6 +173,15 @@ private:
      */
     QString solveRPN(QVector<QStringView> rpn, bool* validExpression) const;
 
+    /*!
+     *  Finds the common base in the given RPN expression.
+     *
+     *    @param [in] rpn     The expression to search in.
+     *
+     *    @return The common base for the expression.
+     */
+    int baseForRPN(QVector<QStringView> const& rpn) const;
+
     /*!
      *  Checks if the given expression is a string.
      *
@@ -0,0 +1,173 @@
+//-----------------------------------------------------------------------------
+// File: TraceRecorder.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Records timed spans and counters of the core operations for profiling.
+//-----------------------------------------------------------------------------
+
+#ifndef TRACERECORDER_H
+#define TRACERECORDER_H
+
+#include <KactusAPI/KactusAPIGlobal.h>
+
+#include <QByteArray>
+#include <QString>
+
+//-----------------------------------------------------------------------------
+//! Records timed spans and counters of the core operations for profiling.
+//!
+//! The recorded events are kept in per-thread buffers, which are released when their thread finishes. The events
+//! can be written in the Chrome trace event format, which can be opened in chrome://tracing or Perfetto.
+//! When recording is not enabled, a span costs a single check. Defining KACTUS2_NO_TRACING removes the trace
+//! macros from the build completely.
+//-----------------------------------------------------------------------------
+namespace TraceRecorder
+{
+    /*!
+     *  Discards the previously recorded events and starts recording.
+     */
+    KACTUS2_API void start();
+
+    /*!
+     *  Stops recording. The recorded events are kept until the next start.
+     */
+    KACTUS2_API void stop();
+
+    /*!
+     *  Checks if the events are being recorded.
+     *
+     *    @return True, if the recording is enabled, otherwise false.
+     */
+    KACTUS2_API bool isEnabled() noexcept;
+
+    /*!
+     *  Gets the current trace time.
+     *
+     *    @return The time in microseconds since the recorder was first used.
+     */
+    KACTUS2_API qint64 currentTime() noexcept;
+
+    /*!
+     *  Records a completed span for the calling thread.
+     *
+     *    @param [in] category    The category of the span.
+     *    @param [in] name        The name of the span.
+     *    @param [in] startTime   The start time of the span in microseconds.
+     *    @param [in] duration    The duration of the span in microseconds.
+     *    @param [in] detail      Optional details, e.g. the processed document.
+     */
+    KACTUS2_API void addSpan(const char* category, const char* name, qint64 startTime, qint64 duration,
+        QString const& detail);
+
+    /*!
+     *  Records the current value of a counter.
+     *
+     *    @param [in] category    The category of the counter.
+     *    @param [in] name        The name of the counter.
+     *    @param [in] value       The counter value.
+     */
+    KACTUS2_API void addCounter(const char* category, const char* name, qint64 value);
+
+    /*!
+     *  Gets the number of recorded events in all threads.
+     *
+     *    @return The number of recorded spans and counter values.
+     */
+    KACTUS2_API int eventCount();
+
+    /*!
+     *  Creates a Chrome trace event document of the recorded events.
+     *
+     *    @return The trace in JSON format.
+     */
+    KACTUS2_API QByteArray toChromeTrace();
+
+    /*!
+     *  Writes the recorded events into a Chrome trace event file.
+     *
+     *    @param [in] filePath    Path to the file to write.
+     *
+     *    @return True, if the file was written, otherwise false.
+     */
+    KACTUS2_API bool writeChromeTrace(QString const& filePath);
+}
+
+//-----------------------------------------------------------------------------
+//! Records the lifetime of the span object as a trace span, if recording is enabled at construction.
+//-----------------------------------------------------------------------------
+class KACTUS2_API TraceSpan
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] category    The category of the span. Must be a string literal.
+     *    @param [in] name        The name of the span. Must be a string literal.
+     */
+    TraceSpan(const char* category, const char* name) noexcept;
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] category    The category of the span. Must be a string literal.
+     *    @param [in] name        The name of the span. Must be a string literal.
+     *    @param [in] detail      Details of the span, e.g. the processed document.
+     */
+    TraceSpan(const char* category, const char* name, QString const& detail);
+
+    //! The destructor. Records the span.
+    ~TraceSpan();
+
+    // Disable copying.
+    TraceSpan(TraceSpan const& rhs) = delete;
+    TraceSpan& operator=(TraceSpan const& rhs) = delete;
+
+private:
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The category of the span.
+    const char* category_;
+
+    //! The name of the span.
+    const char* name_;
+
+    //! The start time of the span, or negative if the span is not recorded.
+    qint64 startTime_ = -1;
+
+    //! Details of the span.
+    QString detail_;
+};
+
+#ifndef KACTUS2_NO_TRACING
+
+#define KACTUS2_TRACE_JOIN_INNER(first, second) first##second
+#define KACTUS2_TRACE_JOIN(first, second) KACTUS2_TRACE_JOIN_INNER(first, second)
+
+//! Records the enclosing scope as a span.
+#define TRACE_SCOPE(category, name) TraceSpan KACTUS2_TRACE_JOIN(traceSpan_, __LINE__)(category, name)
+
+//! Records the enclosing scope as a span with details. The details are only evaluated when recording.
+#define TRACE_SCOPE_DETAIL(category, name, detail) TraceSpan KACTUS2_TRACE_JOIN(traceSpan_, __LINE__)(\
+    category, name, TraceRecorder::isEnabled() ? QString(detail) : QString())
+
+//! Records the current value of a counter. The value is only evaluated when recording.
+#define TRACE_COUNTER(category, name, value) do { if (TraceRecorder::isEnabled()) {\
+    TraceRecorder::addCounter(category, name, value); } } while (false)
+
+#else
+
+#define TRACE_SCOPE(category, name) static_cast<void>(0)
+#define TRACE_SCOPE_DETAIL(category, name, detail) static_cast<void>(0)
+#define TRACE_COUNTER(category, name, value) static_cast<void>(0)
+
+#endif // KACTUS2_NO_TRACING
+
+#endif // TRACERECORDER_H
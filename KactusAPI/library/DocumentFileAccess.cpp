@@ -44,8 +44,12 @@
 #include <IPXACTmodels/kactusExtensions/ApiDefinitionWriter.h>
 
 #include <KactusAPI/include/MessageMediator.h>
+#include <KactusAPI/include/TraceRecorder.h>
 
+#include <QCryptographicHash>
+#include <QFile>
 #include <QObject>
+#include <QSaveFile>
 #include <QDomElement>
 #include <QXmlStreamWriter>
 
@@ -54,6 +58,8 @@
 //-----------------------------------------------------------------------------
 QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
 {
+    TRACE_SCOPE_DETAIL("library", "DocumentFileAccess::readDocument", path);
+
     // Create file handle and use it to read the IP-XACT document into memory.
     QFile file(path);
     file.open(QIODevice::ReadOnly);
@@ -114,14 +120,26 @@ QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
 //-----------------------------------------------------------------------------
 bool DocumentFileAccess::writeDocument(QSharedPointer<Document> model, QString const& path)
 {
-    QFile targetFile(path);
-    if (!targetFile.open(QFile::WriteOnly | QFile::Truncate))
-    {      
+    TRACE_SCOPE_DETAIL("library", "DocumentFileAccess::writeDocument", path);
+
+    QByteArray contents = serializeDocument(model);
+    if (contents.isEmpty())
+    {
         return false;
     }
 
+    return writeContents(contents, path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::serializeDocument()
+//-----------------------------------------------------------------------------
+QByteArray DocumentFileAccess::serializeDocument(QSharedPointer<Document> model)
+{
+    QByteArray contents;
+
     // write the parsed model
-    QXmlStreamWriter xmlWriter(&targetFile);
+    QXmlStreamWriter xmlWriter(&contents);
     xmlWriter.setAutoFormatting(true);
     xmlWriter.setAutoFormattingIndent(-1);
 
@@ -173,11 +191,41 @@ bool DocumentFileAccess::writeDocument(QSharedPointer<Document> model, QString c
     }
     else
     {
-        Q_ASSERT_X(false, "DocumentFileAccess::writeDocument().", "Trying to write unknown document type to file.");
-        targetFile.close();
+        Q_ASSERT_X(false, "DocumentFileAccess::serializeDocument().", "Trying to write unknown document type to file.");
+        return QByteArray();
+    }
+
+    return contents;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::writeContents()
+//-----------------------------------------------------------------------------
+bool DocumentFileAccess::writeContents(QByteArray const& contents, QString const& path)
+{
+    // Skip the write if the file already has the same contents.
+    QFile existingFile(path);
+    if (existingFile.size() == contents.size() && existingFile.open(QFile::ReadOnly))
+    {
+        QCryptographicHash existingHash(QCryptographicHash::Sha1);
+        existingHash.addData(&existingFile);
+        existingFile.close();
+
+        if (existingHash.result() == QCryptographicHash::hash(contents, QCryptographicHash::Sha1))
+        {
+            return true;
+        }
+    }
+
+    // Write into a temporary file that replaces the target only when completely written.
+    QSaveFile targetFile(path);
+    targetFile.setDirectWriteFallback(true);
+    if (!targetFile.open(QFile::WriteOnly))
+    {
         return false;
     }
 
-    targetFile.close();
-    return true;
+    // Commit fails and the target is left untouched if any of the writes failed.
+    targetFile.write(contents);
+    return targetFile.commit();
 }
@@ -17,6 +17,7 @@
 #include <KactusAPI/include/ParameterCache.h>
 #include <KactusAPI/include/SystemVerilogExpressionParser.h>
 #include <KactusAPI/include/ModeConditionParserInterface.h>
+#include <KactusAPI/include/TraceRecorder.h>
 
 #include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
 #include <IPXACTmodels/BusDefinition/BusDefinition.h>
@@ -44,6 +45,8 @@ DocumentValidator::DocumentValidator(LibraryInterface* library) :
 //-----------------------------------------------------------------------------
 bool DocumentValidator::validate(QSharedPointer<Document> document)
 {
+    TRACE_SCOPE_DETAIL("validation", "DocumentValidator::validate", document->getVlnv().toString());
+
     VLNV::IPXactType documentType = document->getVlnv().getType();
     if (documentType == VLNV::ABSTRACTIONDEFINITION)
     {
@@ -23,6 +23,35 @@
 #include <QStringBuilder>
 #include <QIcon>
 
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: isRootItemType()
+    //-----------------------------------------------------------------------------
+    bool isRootItemType(VLNV::IPXactType documentType)
+    {
+        return documentType == VLNV::ABSTRACTIONDEFINITION || documentType == VLNV::BUSDEFINITION ||
+            documentType == VLNV::CATALOG || documentType == VLNV::COMPONENT ||
+            documentType == VLNV::APIDEFINITION || documentType == VLNV::COMDEFINITION;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: hasDirectChild()
+    //-----------------------------------------------------------------------------
+    bool hasDirectChild(HierarchyItem const* parent, VLNV const& vlnv)
+    {
+        for (int i = 0; i < parent->getNumberOfChildren(); ++i)
+        {
+            if (parent->child(i)->getVLNV() == vlnv)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: HierarchyModelBase::HierarchyModelBase()
 //-----------------------------------------------------------------------------
@@ -54,9 +83,7 @@ void HierarchyModelBase::onResetModel()
         VLNV::IPXactType documentType = itemVlnv.getType();
 
         //! Add supported item types only. Designs and configurations will be created by their top-components.
-        if (documentType == VLNV::ABSTRACTIONDEFINITION || documentType == VLNV::BUSDEFINITION ||
-            documentType == VLNV::CATALOG || documentType == VLNV::COMPONENT ||
-            documentType == VLNV::APIDEFINITION || documentType == VLNV::COMDEFINITION)
+        if (isRootItemType(documentType))
         {
             rootItem_->createChild(itemVlnv);
 
@@ -510,6 +537,60 @@ void HierarchyModelBase::onRemoveVLNV(VLNV const& vlnv)
     endResetModel();
 }
 
+//-----------------------------------------------------------------------------
+// Function: HierarchyModelBase::onAddVLNV()
+//-----------------------------------------------------------------------------
+void HierarchyModelBase::onAddVLNV(VLNV const& vlnv)
+{
+    VLNV::IPXactType documentType = handler_->getDocumentType(vlnv);
+    if (vlnv.isValid() == false || isRootItemType(documentType) == false || hasDirectChild(rootItem_, vlnv))
+    {
+        return;
+    }
+
+    int row = rootItem_->getNumberOfChildren();
+    beginInsertRows(QModelIndex(), row, row);
+    rootItem_->createChild(vlnv);
+    endInsertRows();
+
+    HierarchyItem* addedItem = rootItem_->child(row);
+
+    // Mark duplicates in the same way as onResetModel(): an item contained in a later item is a duplicate.
+    for (int i = 0; i < row; ++i)
+    {
+        HierarchyItem* existingItem = rootItem_->child(i);
+        if (existingItem->isDuplicate() == false && addedItem->contains(existingItem->getVLNV()))
+        {
+            existingItem->setDuplicate(true);
+
+            QModelIndex existingIndex = index(existingItem);
+            emit dataChanged(existingIndex, existingIndex.sibling(existingIndex.row(), COLUMN_COUNT - 1));
+        }
+    }
+
+    if (documentType == VLNV::ABSTRACTIONDEFINITION)
+    {
+        QSharedPointer<AbstractionDefinition const> absDef =
+            handler_->getModelReadOnly(vlnv).dynamicCast<AbstractionDefinition const>();
+
+        if (absDef)
+        {
+            for (HierarchyItem* busDefItem : rootItem_->findItems(absDef->getBusType()))
+            {
+                if (hasDirectChild(busDefItem, vlnv))
+                {
+                    continue;
+                }
+
+                int childRow = busDefItem->getNumberOfChildren();
+                beginInsertRows(index(busDefItem), childRow, childRow);
+                busDefItem->createChild(vlnv);
+                endInsertRows();
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: HierarchyModelBase::referenceCount()
 //-----------------------------------------------------------------------------
@@ -19,6 +19,8 @@
 
 #include "TagManager.h"
 
+#include "TraceRecorder.h"
+
 #include <IPXACTmodels/common/Document.h>
 
 #include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
@@ -37,12 +39,27 @@
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QHash>
 #include <QSharedPointer>
 #include <QList>
 #include <QMap>
+#include <QMutex>
+#include <QRunnable>
+#include <QThreadPool>
 #include <QString>
 #include <QStringList>
 
+#include <algorithm>
+
+namespace
+{
+    //! Estimated ratio of the memory used by a parsed document to the size of its file.
+    constexpr qint64 PARSED_SIZE_RATIO = 4;
+
+    //! Memory assumed for a parsed document whose file size is not known.
+    constexpr qint64 MINIMUM_DOCUMENT_SIZE = 4096;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getInstance()
 //-----------------------------------------------------------------------------
@@ -62,6 +79,10 @@ LibraryInterface()
 {   
     // create the connections between models and library handler
     syncronizeModels();
+
+    connect(&watcher_, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)),
+        this, SLOT(onLibraryFilesChanged(QStringList const&, QStringList const&, QStringList const&)),
+        Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -139,28 +160,66 @@ void LibraryHandler::replaceHierarchyModel(HierarchyModelBase* model)
         hierarchyModel_.data(), SLOT(onResetModel()), Qt::UniqueConnection);
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::setCacheBudget()
+//-----------------------------------------------------------------------------
+void LibraryHandler::setCacheBudget(qint64 budgetBytes)
+{
+    QMutexLocker cacheLock(&cacheMutex_);
+
+    cacheBudget_ = qMax<qint64>(0, budgetBytes);
+    enforceCacheBudget(VLNV());
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getCacheBudget()
+//-----------------------------------------------------------------------------
+qint64 LibraryHandler::getCacheBudget() const
+{
+    QMutexLocker cacheLock(&cacheMutex_);
+    return cacheBudget_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getCacheStatistics()
+//-----------------------------------------------------------------------------
+LibraryHandler::CacheStatistics LibraryHandler::getCacheStatistics() const
+{
+    QMutexLocker cacheLock(&cacheMutex_);
+    return cacheStatistics_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getModel()
 //-----------------------------------------------------------------------------
 QSharedPointer<Document> LibraryHandler::getModel(VLNV const& vlnv)
 {
-    auto info = documentCache_.find(vlnv);
-    if (info == documentCache_.end())
+    TRACE_SCOPE_DETAIL("library", "LibraryHandler::getModel", vlnv.toString());
+
+    QSharedPointer<Document> document;
+    bool found = false;
     {
-        showNotFoundError(vlnv);
-        return QSharedPointer<Document>();
+        QMutexLocker cacheLock(&cacheMutex_);
+
+        auto info = documentCache_.find(vlnv);
+        if (info != documentCache_.end())
+        {
+            found = true;
+            document = loadDocument(vlnv, *info);
+        }
     }
 
-    // If object has not already been parsed, read it from the disk.
-    if (info->document.isNull())
+    if (found == false)
     {
-        info->document = DocumentFileAccess::readDocument(info->path);
+        showNotFoundError(vlnv);
+        return QSharedPointer<Document>();
     }
 
+    // The cached document is only read, so it can be cloned without holding the lock.
     QSharedPointer<Document> copy;
-    if (info->document.isNull() == false)
+    if (document.isNull() == false)
     {
-        copy = info->document->clone();
+        copy = document->clone();
     }
 
     return copy;
@@ -171,18 +230,15 @@ QSharedPointer<Document> LibraryHandler::getModel(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 QSharedPointer<Document const> LibraryHandler::getModelReadOnly(VLNV const& vlnv)
 {
+    QMutexLocker cacheLock(&cacheMutex_);
+
     auto info = documentCache_.find(vlnv);
     if (info == documentCache_.end())
     {
         return QSharedPointer<Document const>();
     }
 
-    if (info->document.isNull())
-    {
-        info->document = DocumentFileAccess::readDocument(info->path);
-    }
-
-    return info->document;
+    return loadDocument(vlnv, *info);
 }
 
 //-----------------------------------------------------------------------------
@@ -190,6 +246,7 @@ QSharedPointer<Document const> LibraryHandler::getModelReadOnly(VLNV const& vlnv
 //-----------------------------------------------------------------------------
 QList<VLNV> LibraryHandler::getAllVLNVs() const
 {
+    QMutexLocker cacheLock(&cacheMutex_);
     return documentCache_.keys();
 }
 
@@ -198,6 +255,7 @@ QList<VLNV> LibraryHandler::getAllVLNVs() const
 //-----------------------------------------------------------------------------
 bool LibraryHandler::contains(const VLNV& vlnv) const
 {
+    QMutexLocker cacheLock(&cacheMutex_);
     return documentCache_.contains(vlnv);
 }
 
@@ -206,7 +264,15 @@ bool LibraryHandler::contains(const VLNV& vlnv) const
 //-----------------------------------------------------------------------------
 const QString LibraryHandler::getPath(VLNV const& vlnv) const
 {
-    return documentCache_.value(vlnv).path;
+    QMutexLocker cacheLock(&cacheMutex_);
+
+    auto info = documentCache_.constFind(vlnv);
+    if (info == documentCache_.cend())
+    {
+        return QString();
+    }
+
+    return info->path;
 }
 
 //-----------------------------------------------------------------------------
@@ -239,6 +305,13 @@ bool LibraryHandler::writeModelToFile(QString const& path, QSharedPointer<Docume
         return false;
     }
 
+    // The models are updated once for all the documents added within a save operation.
+    if (saveDepth_ > 0)
+    {
+        pendingAddedItems_.append(vlnv);
+        return true;
+    }
+
     // the hierarchy model must be re-built
     hierarchyModel_->onResetModel();
     treeModel_->onAddVLNV(vlnv);
@@ -259,8 +332,13 @@ bool LibraryHandler::writeModelToFile(QSharedPointer<Document> model)
 //-----------------------------------------------------------------------------
 void LibraryHandler::searchForIPXactFiles()
 {
+    TRACE_SCOPE("library", "LibraryHandler::searchForIPXactFiles");
+
     clearCache();
 
+    // Start watching before loading, so that no change during the load is missed.
+    watcher_.watch(loader_.getActiveLocations());
+
     loadAvailableVLNVs();
 
     onCheckLibraryIntegrity();
@@ -332,6 +410,8 @@ LibraryItem const* LibraryHandler::getTreeRoot() const
 //-----------------------------------------------------------------------------
 VLNV::IPXactType LibraryHandler::getDocumentType(VLNV const& vlnv)
 {
+    QMutexLocker cacheLock(&cacheMutex_);
+
     auto it = documentCache_.constFind(vlnv);
     if (it == documentCache_.constEnd())
     {
@@ -428,10 +508,12 @@ QSharedPointer<Design> LibraryHandler::getDesign(VLNV const& hierarchyRef)
 //-----------------------------------------------------------------------------
 bool LibraryHandler::isValid(VLNV const& vlnv)
 {    
+    QMutexLocker cacheLock(&cacheMutex_);
+
     auto it = documentCache_.constFind(vlnv);
     if (it != documentCache_.cend())
     {
-        return documentCache_.value(vlnv).isValid;
+        return it->isValid;
     }
 
     return false;
@@ -458,22 +540,20 @@ LibraryModel* LibraryHandler::getTreeModel()
 //-----------------------------------------------------------------------------
 void LibraryHandler::onCheckLibraryIntegrity()
 {
+    TRACE_SCOPE("validation", "LibraryHandler::onCheckLibraryIntegrity");
+
     messageChannel_->showStatusMessage(tr("Validating items. Please wait..."));
 
     checkResults_.documentCount = 0;
     checkResults_.fileCount = 0;
 
     QVector<TagData> documentTags;
+
+    QMutexLocker cacheLock(&cacheMutex_);
     for (auto it = documentCache_.begin(); it != documentCache_.end(); ++it)
     {
-        // TODO: Add model to cache only, if it is already previously cached.
-        // Current hierarchy model forces all models to be loaded, but this should be changed.
-        QSharedPointer<Document> model = it->document;
-        if (model.isNull())
-        {
-            model = DocumentFileAccess::readDocument(it->path);
-            it->document = model;
-        }           
+        // Models over the cache budget are evicted as the check proceeds.
+        QSharedPointer<Document> model = loadDocument(it.key(), it.value());
 
         if (model.isNull() == false)
         {
@@ -487,6 +567,8 @@ void LibraryHandler::onCheckLibraryIntegrity()
         }
     }
 
+    cacheLock.unlock();
+
     TagManager& manager = TagManager::getInstance();
     manager.setTags(documentTags);
 
@@ -631,14 +713,22 @@ void LibraryHandler::removeObject(VLNV const& vlnv)
         return;
     }
 
-    QString path = documentCache_.find(vlnv)->path;
+    QString path = getPath(vlnv);
 
-    documentCache_.remove(vlnv);
+    {
+        QMutexLocker cacheLock(&cacheMutex_);
+
+        removeCachedDocument(vlnv);
+        pendingWrites_.remove(path);
+    }
+
+    pendingAddedItems_.removeAll(vlnv);
 
     treeModel_->onRemoveVLNV(vlnv);
     hierarchyModel_->onRemoveVLNV(vlnv);
 
     removeFile(path);
+    watcher_.acknowledgeFile(path);
 }
 
 //-----------------------------------------------------------------------------
@@ -666,15 +756,38 @@ void LibraryHandler::removeObjects(QList<VLNV> const& vlnvList)
 //-----------------------------------------------------------------------------
 void LibraryHandler::beginSave()
 {
-    saveInProgress_ = true;
+    ++saveDepth_;
 }
 
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::endSave()
 //-----------------------------------------------------------------------------
-void LibraryHandler::endSave()
+bool LibraryHandler::endSave()
 {
-    saveInProgress_ = false;
+    if (saveDepth_ > 0)
+    {
+        --saveDepth_;
+    }
+
+    if (saveDepth_ > 0)
+    {
+        return true;
+    }
+
+    bool allWritten = writePendingDocuments();
+
+    if (pendingAddedItems_.isEmpty() == false)
+    {
+        hierarchyModel_->onResetModel();
+        for (VLNV const& addedItem : pendingAddedItems_)
+        {
+            treeModel_->onAddVLNV(addedItem);
+        }
+
+        pendingAddedItems_.clear();
+    }
+
+    return allWritten;
 }
 
 //-----------------------------------------------------------------------------
@@ -692,12 +805,185 @@ void LibraryHandler::onItemSaved(VLNV const& vlnv)
 
     // Replace overwritten item with new and check validity.
     QSharedPointer<Document> model = getModel(vlnv);
-    documentCache_.insert(vlnv, DocumentInfo(getPath(vlnv), model, validateDocument(model, getPath(vlnv))));
+
+    {
+        QMutexLocker cacheLock(&cacheMutex_);
+
+        DocumentInfo& info = documentCache_[vlnv];
+        info.isValid = validateDocument(model, info.path);
+        setCachedDocument(vlnv, info, model);
+    }
     
     treeModel_->onDocumentUpdated(vlnv);
     hierarchyModel_->onDocumentUpdated(vlnv);
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::onLibraryFilesChanged()
+//-----------------------------------------------------------------------------
+void LibraryHandler::onLibraryFilesChanged(QStringList const& addedFiles, QStringList const& removedFiles,
+    QStringList const& modifiedFiles)
+{
+    messageChannel_->showStatusMessage(tr("Updating library. Please wait..."));
+
+    QMutexLocker cacheLock(&cacheMutex_);
+
+    QHash<QString, VLNV> vlnvsByPath;
+    vlnvsByPath.reserve(documentCache_.size());
+    for (auto it = documentCache_.cbegin(); it != documentCache_.cend(); ++it)
+    {
+        vlnvsByPath.insert(QFileInfo(it->path).absoluteFilePath(), it.key());
+    }
+
+    QVector<VLNV> removedItems;
+    for (QString const& path : removedFiles)
+    {
+        VLNV removedVLNV = vlnvsByPath.value(path);
+        if (removedVLNV.isValid())
+        {
+            removedItems.append(removedVLNV);
+        }
+    }
+
+    // Only the VLNV is read from the new and modified files before the library content is updated.
+    QVector<LibraryLoader::LoadTarget> addedTargets;
+    QVector<VLNV> updatedItems;
+    for (QString const& path : modifiedFiles)
+    {
+        VLNV previousVLNV = vlnvsByPath.value(path);
+        VLNV currentVLNV = loader_.getDocumentVLNV(path, messageChannel_);
+
+        if (previousVLNV.isValid() && previousVLNV == currentVLNV &&
+            previousVLNV.getType() == currentVLNV.getType())
+        {
+            updatedItems.append(previousVLNV);
+            continue;
+        }
+
+        if (previousVLNV.isValid())
+        {
+            removedItems.append(previousVLNV);
+        }
+
+        if (currentVLNV.isValid())
+        {
+            addedTargets.append(LibraryLoader::LoadTarget(currentVLNV, path));
+        }
+    }
+
+    for (QString const& path : addedFiles)
+    {
+        VLNV addedVLNV = loader_.getDocumentVLNV(path, messageChannel_);
+        if (addedVLNV.isValid())
+        {
+            addedTargets.append(LibraryLoader::LoadTarget(addedVLNV, path));
+        }
+    }
+
+    QSet<QString> changedItems;
+
+    for (VLNV const& removedItem : removedItems)
+    {
+        removeCachedDocument(removedItem);
+        changedItems.insert(removedItem.toString());
+
+        treeModel_->onRemoveVLNV(removedItem);
+        hierarchyModel_->onRemoveVLNV(removedItem);
+    }
+
+    QVector<VLNV> addedItems;
+    for (auto const& target : addedTargets)
+    {
+        if (contains(target.vlnv))
+        {
+            messageChannel_->showMessage(tr("VLNV %1 was already found in the library").arg(
+                target.vlnv.toString()));
+        }
+        else
+        {
+            documentCache_.insert(target.vlnv, DocumentInfo(target.path));
+            changedItems.insert(target.vlnv.toString());
+            addedItems.append(target.vlnv);
+        }
+    }
+
+    // The hierarchy must be rebuilt, if the references of a document change.
+    bool hierarchyChanged = false;
+    for (VLNV const& updatedItem : updatedItems)
+    {
+        DocumentInfo& info = documentCache_[updatedItem];
+
+        // The references are kept also for evicted documents.
+        QList<VLNV> previousReferences = info.references;
+
+        // The document is read again from the changed file, so it no longer waits to be written.
+        unwrittenPaths_.remove(info.path);
+
+        setCachedDocument(updatedItem, info, DocumentFileAccess::readDocument(info.path));
+        if (info.document.isNull() || info.references != previousReferences)
+        {
+            hierarchyChanged = true;
+        }
+
+        changedItems.insert(updatedItem.toString());
+    }
+
+    QVector<VLNV> referencingItems = findReferencingDocuments(changedItems);
+
+    // A document referencing an added document now has a new child in the hierarchy.
+    if (addedItems.isEmpty() == false && referencingItems.isEmpty() == false)
+    {
+        hierarchyChanged = true;
+    }
+
+    QVector<VLNV> revalidatedItems = addedItems + updatedItems + referencingItems;
+    for (VLNV const& revalidatedItem : revalidatedItems)
+    {
+        DocumentInfo& info = documentCache_[revalidatedItem];
+        QSharedPointer<Document> document = loadDocument(revalidatedItem, info);
+
+        if (document.isNull() == false)
+        {
+            TagManager::getInstance().addNewTags(document->getTags());
+        }
+
+        info.isValid = validateDocument(document, info.path);
+    }
+
+    for (VLNV const& addedItem : addedItems)
+    {
+        treeModel_->onAddVLNV(addedItem);
+    }
+
+    for (VLNV const& changedItem : updatedItems + referencingItems)
+    {
+        treeModel_->onDocumentUpdated(changedItem);
+    }
+
+    if (hierarchyChanged)
+    {
+        hierarchyModel_->onResetModel();
+    }
+    else
+    {
+        for (VLNV const& addedItem : addedItems)
+        {
+            hierarchyModel_->onAddVLNV(addedItem);
+        }
+
+        for (VLNV const& changedItem : updatedItems + referencingItems)
+        {
+            hierarchyModel_->onDocumentUpdated(changedItem);
+        }
+    }
+
+    messageChannel_->showMessage(tr("Library updated: %1 added, %2 removed and %3 modified item(s).").arg(
+        QString::number(addedItems.size()), QString::number(removedItems.size()),
+        QString::number(updatedItems.size())));
+
+    messageChannel_->showStatusMessage(tr("Ready."));
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::syncronizeModels()
 //-----------------------------------------------------------------------------
@@ -758,11 +1044,40 @@ bool LibraryHandler::addObject(QSharedPointer<Document> model, QString const& fi
         targetPath = pathInfo.symLinkTarget();
     }
 
-    DocumentFileAccess::writeDocument(model, targetPath);
+    bool written = true;
+    if (saveDepth_ > 0)
+    {
+        // Write a copy, since the model may still change before the save operation ends.
+        QMutexLocker cacheLock(&cacheMutex_);
+        pendingWrites_.insert(targetPath, model->clone());
+    }
+    else if (DocumentFileAccess::writeDocument(model, targetPath) == false)
+    {
+        written = false;
+        messageChannel_->showError(tr("Could not write file %1.").arg(targetPath));
+    }
+    else
+    {
+        watcher_.acknowledgeFile(targetPath);
+    }
 
     TagManager::getInstance().addNewTags(model->getTags());
 
-    documentCache_.insert(model->getVlnv(), DocumentInfo(targetPath, model->clone(), validateDocument(model, targetPath)));
+    QMutexLocker cacheLock(&cacheMutex_);
+
+    if (written)
+    {
+        unwrittenPaths_.remove(targetPath);
+    }
+    else
+    {
+        unwrittenPaths_.insert(targetPath);
+    }
+
+    DocumentInfo& info = documentCache_[model->getVlnv()];
+    info.path = targetPath;
+    info.isValid = validateDocument(model, targetPath);
+    setCachedDocument(model->getVlnv(), info, model->clone());
 
     return true;
 }
@@ -772,7 +1087,184 @@ bool LibraryHandler::addObject(QSharedPointer<Document> model, QString const& fi
 //-----------------------------------------------------------------------------
 void LibraryHandler::clearCache()
 {
+    QMutexLocker cacheLock(&cacheMutex_);
+
     documentCache_.clear();
+    unwrittenPaths_.clear();
+    cacheStatistics_.residentBytes = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::loadDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> LibraryHandler::loadDocument(VLNV const& vlnv, DocumentInfo& info)
+{
+    info.lastUse = ++cacheClock_;
+
+    // If object has not already been parsed or it has been evicted, read it from the disk.
+    if (info.document.isNull())
+    {
+        ++cacheStatistics_.misses;
+        setCachedDocument(vlnv, info, DocumentFileAccess::readDocument(info.path));
+    }
+    else
+    {
+        ++cacheStatistics_.hits;
+    }
+
+    return info.document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::setCachedDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::setCachedDocument(VLNV const& vlnv, DocumentInfo& info, QSharedPointer<Document> document)
+{
+    cacheStatistics_.residentBytes -= info.size;
+
+    info.document = document;
+    info.size = 0;
+    info.references.clear();
+
+    if (document.isNull() == false)
+    {
+        info.references = document->getDependentVLNVs();
+        info.size = qMax(MINIMUM_DOCUMENT_SIZE, QFileInfo(info.path).size()) * PARSED_SIZE_RATIO;
+    }
+
+    cacheStatistics_.residentBytes += info.size;
+
+    enforceCacheBudget(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::removeCachedDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::removeCachedDocument(VLNV const& vlnv)
+{
+    QMutexLocker cacheLock(&cacheMutex_);
+
+    DocumentInfo const removedInfo = documentCache_.take(vlnv);
+    cacheStatistics_.residentBytes -= removedInfo.size;
+    unwrittenPaths_.remove(removedInfo.path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::enforceCacheBudget()
+//-----------------------------------------------------------------------------
+void LibraryHandler::enforceCacheBudget(VLNV const& keep)
+{
+    if (cacheBudget_ == 0 || cacheStatistics_.residentBytes <= cacheBudget_)
+    {
+        return;
+    }
+
+    QVector<QPair<quint64, DocumentInfo*> > candidates;
+    for (auto it = documentCache_.begin(); it != documentCache_.end(); ++it)
+    {
+        if (it->document.isNull() == false && it.key() != keep && pendingWrites_.contains(it->path) == false &&
+            unwrittenPaths_.contains(it->path) == false)
+        {
+            candidates.append(qMakePair(it->lastUse, &it.value()));
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+        [](auto const& first, auto const& second) { return first.first < second.first; });
+
+    // Evict well below the budget, so that the cache is not scanned again on every read.
+    qint64 const targetBytes = cacheBudget_ / 4 * 3;
+    for (auto const& candidate : candidates)
+    {
+        if (cacheStatistics_.residentBytes <= targetBytes)
+        {
+            break;
+        }
+
+        DocumentInfo* info = candidate.second;
+
+        QWeakPointer<Document> evicted = info->document;
+        info->document.clear();
+
+        // A document still in use outside the library would not free any memory and would only be read again.
+        if (evicted.isNull() == false)
+        {
+            info->document = evicted.toStrongRef();
+            continue;
+        }
+
+        cacheStatistics_.residentBytes -= info->size;
+        info->size = 0;
+        ++cacheStatistics_.evictions;
+    }
+
+    TRACE_COUNTER("library", "Cache resident bytes", cacheStatistics_.residentBytes);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::writePendingDocuments()
+//-----------------------------------------------------------------------------
+bool LibraryHandler::writePendingDocuments()
+{
+    QStringList failedPaths;
+    QMutex failureMutex;
+
+    QThreadPool writers;
+    for (auto it = pendingWrites_.cbegin(); it != pendingWrites_.cend(); ++it)
+    {
+        QString const path = it.key();
+        QSharedPointer<Document> model = it.value();
+
+        writers.start(QRunnable::create([path, model, &failedPaths, &failureMutex]()
+            {
+                if (DocumentFileAccess::writeDocument(model, path) == false)
+                {
+                    QMutexLocker failureLock(&failureMutex);
+                    failedPaths.append(path);
+                }
+            }));
+    }
+
+    writers.waitForDone();
+
+    // A failed write leaves the file as it was, so any external change to it must still be reported.
+    for (auto it = pendingWrites_.cbegin(); it != pendingWrites_.cend(); ++it)
+    {
+        if (failedPaths.contains(it.key()) == false)
+        {
+            watcher_.acknowledgeFile(it.key());
+        }
+    }
+
+    {
+        QMutexLocker cacheLock(&cacheMutex_);
+
+        // The documents that could not be written stay in the cache until a later save succeeds.
+        for (auto it = pendingWrites_.cbegin(); it != pendingWrites_.cend(); ++it)
+        {
+            if (failedPaths.contains(it.key()))
+            {
+                unwrittenPaths_.insert(it.key());
+            }
+            else
+            {
+                unwrittenPaths_.remove(it.key());
+            }
+        }
+
+        pendingWrites_.clear();
+
+        // The written documents can now be evicted.
+        enforceCacheBudget(VLNV());
+    }
+
+    failedPaths.sort();
+    for (QString const& path : failedPaths)
+    {
+        messageChannel_->showError(tr("Could not write file %1.").arg(path));
+    }
+
+    return failedPaths.isEmpty();
 }
 
 //-----------------------------------------------------------------------------
@@ -793,6 +1285,7 @@ void LibraryHandler::loadAvailableVLNVs()
         }
         else
         {
+            QMutexLocker cacheLock(&cacheMutex_);
             documentCache_.insert(target.vlnv, DocumentInfo(target.path));
         }
     }
@@ -816,9 +1309,15 @@ void LibraryHandler::resetModels()
 //-----------------------------------------------------------------------------
 void LibraryHandler::showIntegrityResults() const
 {
+    QMutexLocker cacheLock(&cacheMutex_);
+
     messageChannel_->showMessage(tr("========== Library integrity check complete =========="));
     messageChannel_->showMessage(tr("Total library object count: %1").arg(documentCache_.size()));
     messageChannel_->showMessage(tr("Total file count in the library: %1").arg(checkResults_.fileCount));
+    messageChannel_->showMessage(tr("Document cache: %1 hits, %2 misses, %3 evictions, %4 MB resident").arg(
+        QString::number(cacheStatistics_.hits), QString::number(cacheStatistics_.misses),
+        QString::number(cacheStatistics_.evictions),
+        QString::number(cacheStatistics_.residentBytes / (1024 * 1024))));
 
     // if errors were found then print the summary of error types
     if (checkResults_.documentCount > 0)
@@ -827,6 +1326,40 @@ void LibraryHandler::showIntegrityResults() const
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::findReferencingDocuments()
+//-----------------------------------------------------------------------------
+QVector<VLNV> LibraryHandler::findReferencingDocuments(QSet<QString> const& changedItems) const
+{
+    QVector<VLNV> referencingItems;
+    if (changedItems.isEmpty())
+    {
+        return referencingItems;
+    }
+
+    // The integrity check reads all the documents, and the references are kept when documents are evicted,
+    // so the references are available without reading files.
+    QMutexLocker cacheLock(&cacheMutex_);
+    for (auto it = documentCache_.cbegin(); it != documentCache_.cend(); ++it)
+    {
+        if (changedItems.contains(it.key().toString()))
+        {
+            continue;
+        }
+
+        for (VLNV const& reference : it->references)
+        {
+            if (changedItems.contains(reference.toString()))
+            {
+                referencingItems.append(it.key());
+                break;
+            }
+        }
+    }
+
+    return referencingItems;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryData::removeFile()
 //-----------------------------------------------------------------------------
@@ -869,6 +1402,8 @@ QVector<QString> LibraryHandler::findErrorsInDocument(QSharedPointer<Document> d
     {
         if (path.isEmpty() == false)
         {
+            QMutexLocker cacheLock(&cacheMutex_);
+
             auto it = std::find_if(documentCache_.cbegin(), documentCache_.cend(),
                 [path](DocumentInfo const& info) { return info.path == path;  });
             
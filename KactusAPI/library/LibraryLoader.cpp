@@ -11,6 +11,8 @@
 
 #include "LibraryLoader.h"
 
+#include <KactusAPI/include/TraceRecorder.h>
+
 #include <QDir>
 #include <QDirIterator>
 #include <QFileInfo>
@@ -22,10 +24,12 @@
 //-----------------------------------------------------------------------------
 QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary(MessageMediator const* messageChannel) const
 {
+    TRACE_SCOPE("library", "LibraryLoader::parseLibrary");
+
     QVector<LoadTarget> vlnvPaths;
     QStringList xmlFilter{ QStringLiteral("*.xml") };
 
-    for (QString const& location : QSettings().value(QStringLiteral("Library/ActiveLocations")).toStringList())
+    for (QString const& location : getActiveLocations())
     {        
         QDirIterator fileIterator(location, xmlFilter, QDir::Files,
             QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
@@ -42,9 +46,18 @@ QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary(MessageMediator c
         }
     }
 
+    TRACE_COUNTER("library", "Library documents", vlnvPaths.size());
     return vlnvPaths;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::getActiveLocations()
+//-----------------------------------------------------------------------------
+QStringList LibraryLoader::getActiveLocations() const
+{
+    return QSettings().value(QStringLiteral("Library/ActiveLocations")).toStringList();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::clean()
 //-----------------------------------------------------------------------------
@@ -0,0 +1,375 @@
+//-----------------------------------------------------------------------------
+// File: LibraryWatcher.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Watches the library locations for added, removed and modified IP-XACT files.
+//-----------------------------------------------------------------------------
+
+#include "LibraryWatcher.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+
+namespace
+{
+    //! Time to wait after the last file system notification before scanning.
+    const int SCAN_DELAY_MS = 500;
+
+    //! The default maximum number of individually watched files.
+    const int WATCHED_FILE_LIMIT = 1024;
+
+    //! The file name filter for IP-XACT files.
+    const QStringList XML_FILTER{ QStringLiteral("*.xml") };
+
+    /*!
+     *  Checks if a path is within a directory.
+     *
+     *    @param [in] path            The path to check.
+     *    @param [in] directoryPath   Absolute path to the directory.
+     *
+     *    @return True, if the path is the directory or within it, otherwise false.
+     */
+    bool isWithin(QString const& path, QString const& directoryPath);
+
+    //-----------------------------------------------------------------------------
+    // Function: isWithin()
+    //-----------------------------------------------------------------------------
+    bool isWithin(QString const& path, QString const& directoryPath)
+    {
+        return path == directoryPath ||
+            (path.startsWith(directoryPath) && path.at(directoryPath.size()) == QLatin1Char('/'));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::LibraryWatcher()
+//-----------------------------------------------------------------------------
+LibraryWatcher::LibraryWatcher(QObject* parent):
+QObject(parent),
+watchedFileLimit_(WATCHED_FILE_LIMIT)
+{
+    scanTimer_.setSingleShot(true);
+    scanTimer_.setInterval(SCAN_DELAY_MS);
+
+    connect(&watcher_, SIGNAL(directoryChanged(QString const&)),
+        this, SLOT(onDirectoryChanged(QString const&)), Qt::UniqueConnection);
+    connect(&watcher_, SIGNAL(fileChanged(QString const&)),
+        this, SLOT(onFileChanged(QString const&)), Qt::UniqueConnection);
+    connect(&scanTimer_, SIGNAL(timeout()), this, SLOT(onScanTimeout()), Qt::UniqueConnection);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::watch()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::watch(QStringList const& locations)
+{
+    scanTimer_.stop();
+    changedDirectories_.clear();
+    directories_.clear();
+    watchedFiles_.clear();
+
+    if (watcher_.files().isEmpty() == false)
+    {
+        watcher_.removePaths(watcher_.files());
+    }
+
+    if (watcher_.directories().isEmpty() == false)
+    {
+        watcher_.removePaths(watcher_.directories());
+    }
+
+    // The initial files are already known to the library.
+    QStringList ignoredFiles;
+    for (QString const& location : locations)
+    {
+        QFileInfo locationInfo(location);
+        if (locationInfo.isDir())
+        {
+            addDirectory(locationInfo.absoluteFilePath(), ignoredFiles);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::setWatchedFileLimit()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::setWatchedFileLimit(int limit)
+{
+    watchedFileLimit_ = limit;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::acknowledgeFile()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::acknowledgeFile(QString const& filePath)
+{
+    QFileInfo fileInfo(filePath);
+    QString directoryPath = fileInfo.absolutePath();
+    QString absolutePath = fileInfo.absoluteFilePath();
+
+    if (fileInfo.exists() == false)
+    {
+        auto directory = directories_.find(directoryPath);
+        if (directory != directories_.end())
+        {
+            directory->remove(absolutePath);
+        }
+
+        unwatchFile(absolutePath);
+        return;
+    }
+
+    if (directories_.contains(directoryPath) == false)
+    {
+        // A new directory within a watched location, e.g. for a newly created document.
+        bool withinLocation = false;
+        for (auto it = directories_.cbegin(); it != directories_.cend() && withinLocation == false; ++it)
+        {
+            withinLocation = isWithin(directoryPath, it.key());
+        }
+
+        if (withinLocation == false)
+        {
+            return;
+        }
+
+        QStringList ignoredFiles;
+        addDirectory(directoryPath, ignoredFiles);
+        return;
+    }
+
+    bool isNew = directories_[directoryPath].contains(absolutePath) == false;
+    directories_[directoryPath].insert(absolutePath, readState(fileInfo));
+
+    if (isNew)
+    {
+        watchFile(absolutePath);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::onDirectoryChanged()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::onDirectoryChanged(QString const& path)
+{
+    changedDirectories_.insert(QFileInfo(path).absoluteFilePath());
+    scanTimer_.start();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::onFileChanged()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::onFileChanged(QString const& path)
+{
+    changedDirectories_.insert(QFileInfo(path).absolutePath());
+    scanTimer_.start();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::onScanTimeout()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::onScanTimeout()
+{
+    QStringList addedFiles;
+    QStringList removedFiles;
+    QStringList modifiedFiles;
+
+    QStringList scannedDirectories = changedDirectories_.values();
+    changedDirectories_.clear();
+
+    // Scan parents before children, so that removed subdirectories are handled once.
+    scannedDirectories.sort();
+    for (QString const& directoryPath : scannedDirectories)
+    {
+        if (directories_.contains(directoryPath))
+        {
+            scanDirectory(directoryPath, addedFiles, removedFiles, modifiedFiles);
+        }
+    }
+
+    if (addedFiles.isEmpty() && removedFiles.isEmpty() && modifiedFiles.isEmpty())
+    {
+        return;
+    }
+
+    emit filesChanged(addedFiles, removedFiles, modifiedFiles);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::readState()
+//-----------------------------------------------------------------------------
+LibraryWatcher::FileState LibraryWatcher::readState(QFileInfo const& fileInfo)
+{
+    FileState state;
+    state.modified = fileInfo.lastModified().toMSecsSinceEpoch();
+    state.size = fileInfo.size();
+
+    return state;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::addDirectory()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::addDirectory(QString const& directoryPath, QStringList& addedFiles)
+{
+    if (directories_.contains(directoryPath))
+    {
+        return;
+    }
+
+    QDir directory(directoryPath);
+    QHash<QString, FileState>& files = directories_[directoryPath];
+
+    watcher_.addPath(directoryPath);
+
+    for (QFileInfo const& fileInfo : directory.entryInfoList(XML_FILTER, QDir::Files))
+    {
+        QString filePath = fileInfo.absoluteFilePath();
+
+        files.insert(filePath, readState(fileInfo));
+        watchFile(filePath);
+        addedFiles.append(filePath);
+    }
+
+    for (QFileInfo const& subdirectory : directory.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+    {
+        addDirectory(subdirectory.absoluteFilePath(), addedFiles);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::removeDirectory()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::removeDirectory(QString const& directoryPath, QStringList& removedFiles)
+{
+    for (auto it = directories_.begin(); it != directories_.end(); )
+    {
+        if (isWithin(it.key(), directoryPath))
+        {
+            for (auto file = it->cbegin(); file != it->cend(); ++file)
+            {
+                removedFiles.append(file.key());
+                unwatchFile(file.key());
+            }
+
+            watcher_.removePath(it.key());
+            it = directories_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::scanDirectory()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::scanDirectory(QString const& directoryPath, QStringList& addedFiles,
+    QStringList& removedFiles, QStringList& modifiedFiles)
+{
+    QDir directory(directoryPath);
+    if (directory.exists() == false)
+    {
+        removeDirectory(directoryPath, removedFiles);
+        return;
+    }
+
+    QHash<QString, FileState>& storedFiles = directories_[directoryPath];
+    QSet<QString> foundFiles;
+
+    for (QFileInfo const& fileInfo : directory.entryInfoList(XML_FILTER, QDir::Files))
+    {
+        QString filePath = fileInfo.absoluteFilePath();
+        foundFiles.insert(filePath);
+
+        FileState state = readState(fileInfo);
+
+        auto storedFile = storedFiles.find(filePath);
+        if (storedFile == storedFiles.end())
+        {
+            storedFiles.insert(filePath, state);
+            watchFile(filePath);
+            addedFiles.append(filePath);
+        }
+        else if ((*storedFile == state) == false)
+        {
+            *storedFile = state;
+
+            // Files replaced by renaming are no longer watched, so watch the path again.
+            if (watchedFiles_.contains(filePath))
+            {
+                watcher_.removePath(filePath);
+                watcher_.addPath(filePath);
+            }
+            modifiedFiles.append(filePath);
+        }
+    }
+
+    for (auto it = storedFiles.begin(); it != storedFiles.end(); )
+    {
+        if (foundFiles.contains(it.key()) == false)
+        {
+            removedFiles.append(it.key());
+            unwatchFile(it.key());
+            it = storedFiles.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    QSet<QString> foundDirectories;
+    for (QFileInfo const& subdirectory : directory.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+    {
+        QString subdirectoryPath = subdirectory.absoluteFilePath();
+        foundDirectories.insert(subdirectoryPath);
+        addDirectory(subdirectoryPath, addedFiles);
+    }
+
+    // Find the removed direct subdirectories.
+    QStringList removedDirectories;
+    for (auto it = directories_.cbegin(); it != directories_.cend(); ++it)
+    {
+        QString const& watchedPath = it.key();
+        if (watchedPath != directoryPath && QFileInfo(watchedPath).absolutePath() == directoryPath &&
+            foundDirectories.contains(watchedPath) == false)
+        {
+            removedDirectories.append(watchedPath);
+        }
+    }
+
+    for (QString const& removedDirectory : removedDirectories)
+    {
+        removeDirectory(removedDirectory, removedFiles);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::watchFile()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::watchFile(QString const& filePath)
+{
+    // Files beyond the limit are found by scanning their directory.
+    if (watchedFiles_.size() < watchedFileLimit_ && watcher_.addPath(filePath))
+    {
+        watchedFiles_.insert(filePath);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryWatcher::unwatchFile()
+//-----------------------------------------------------------------------------
+void LibraryWatcher::unwatchFile(QString const& filePath)
+{
+    if (watchedFiles_.remove(filePath))
+    {
+        watcher_.removePath(filePath);
+    }
+}
@@ -0,0 +1,263 @@
+//-----------------------------------------------------------------------------
+// File: SerializedLibraryInterface.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Library interface that serializes the calls to another library interface.
+//-----------------------------------------------------------------------------
+
+#include "SerializedLibraryInterface.h"
+
+#include <IPXACTmodels/common/Document.h>
+#include <IPXACTmodels/Design/Design.h>
+
+#include <QMutexLocker>
+#include <QRecursiveMutex>
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::SerializedLibraryInterface()
+//-----------------------------------------------------------------------------
+SerializedLibraryInterface::SerializedLibraryInterface(LibraryInterface* library, QRecursiveMutex* lock):
+library_(library),
+lock_(lock)
+{
+    Q_ASSERT(library_);
+    Q_ASSERT(lock_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getModel()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> SerializedLibraryInterface::getModel(VLNV const& vlnv)
+{
+    QMutexLocker locker(lock_);
+    return library_->getModel(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getModelReadOnly()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document const> SerializedLibraryInterface::getModelReadOnly(VLNV const& vlnv)
+{
+    QMutexLocker locker(lock_);
+    return library_->getModelReadOnly(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::contains()
+//-----------------------------------------------------------------------------
+bool SerializedLibraryInterface::contains(VLNV const& vlnv) const
+{
+    QMutexLocker locker(lock_);
+    return library_->contains(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getAllVLNVs()
+//-----------------------------------------------------------------------------
+QList<VLNV> SerializedLibraryInterface::getAllVLNVs() const
+{
+    QMutexLocker locker(lock_);
+    return library_->getAllVLNVs();
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getPath()
+//-----------------------------------------------------------------------------
+const QString SerializedLibraryInterface::getPath(VLNV const& vlnv) const
+{
+    QMutexLocker locker(lock_);
+    return library_->getPath(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getDirectoryPath()
+//-----------------------------------------------------------------------------
+QString SerializedLibraryInterface::getDirectoryPath(VLNV const& vlnv) const
+{
+    QMutexLocker locker(lock_);
+    return library_->getDirectoryPath(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::writeModelToFile()
+//-----------------------------------------------------------------------------
+bool SerializedLibraryInterface::writeModelToFile(QString const& path, QSharedPointer<Document> model)
+{
+    QMutexLocker locker(lock_);
+    return library_->writeModelToFile(path, model);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::writeModelToFile()
+//-----------------------------------------------------------------------------
+bool SerializedLibraryInterface::writeModelToFile(QSharedPointer<Document> model)
+{
+    QMutexLocker locker(lock_);
+    return library_->writeModelToFile(model);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::searchForIPXactFiles()
+//-----------------------------------------------------------------------------
+void SerializedLibraryInterface::searchForIPXactFiles()
+{
+    QMutexLocker locker(lock_);
+    library_->searchForIPXactFiles();
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getNeededVLNVs()
+//-----------------------------------------------------------------------------
+void SerializedLibraryInterface::getNeededVLNVs(VLNV const& vlnv, QList<VLNV>& list)
+{
+    QMutexLocker locker(lock_);
+    library_->getNeededVLNVs(vlnv, list);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getDependencyFiles()
+//-----------------------------------------------------------------------------
+void SerializedLibraryInterface::getDependencyFiles(VLNV const& vlnv, QStringList& list)
+{
+    QMutexLocker locker(lock_);
+    library_->getDependencyFiles(vlnv, list);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getTreeRoot()
+//-----------------------------------------------------------------------------
+LibraryItem const* SerializedLibraryInterface::getTreeRoot() const
+{
+    QMutexLocker locker(lock_);
+    return library_->getTreeRoot();
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getDocumentType()
+//-----------------------------------------------------------------------------
+VLNV::IPXactType SerializedLibraryInterface::getDocumentType(VLNV const& vlnv)
+{
+    QMutexLocker locker(lock_);
+    return library_->getDocumentType(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::referenceCount()
+//-----------------------------------------------------------------------------
+int SerializedLibraryInterface::referenceCount(VLNV const& vlnv) const
+{
+    QMutexLocker locker(lock_);
+    return library_->referenceCount(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getOwners()
+//-----------------------------------------------------------------------------
+int SerializedLibraryInterface::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
+{
+    QMutexLocker locker(lock_);
+    return library_->getOwners(list, vlnvToSearch);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getChildren()
+//-----------------------------------------------------------------------------
+int SerializedLibraryInterface::getChildren(QList<VLNV>& list, VLNV const& vlnvToSearch) const
+{
+    QMutexLocker locker(lock_);
+    return library_->getChildren(list, vlnvToSearch);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getDesignVLNV()
+//-----------------------------------------------------------------------------
+VLNV SerializedLibraryInterface::getDesignVLNV(VLNV const& hierarchyRef)
+{
+    QMutexLocker locker(lock_);
+    return library_->getDesignVLNV(hierarchyRef);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::getDesign()
+//-----------------------------------------------------------------------------
+QSharedPointer<Design> SerializedLibraryInterface::getDesign(VLNV const& hierarchyRef)
+{
+    QMutexLocker locker(lock_);
+    return library_->getDesign(hierarchyRef);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::isValid()
+//-----------------------------------------------------------------------------
+bool SerializedLibraryInterface::isValid(VLNV const& vlnv)
+{
+    QMutexLocker locker(lock_);
+    return library_->isValid(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::onCheckLibraryIntegrity()
+//-----------------------------------------------------------------------------
+void SerializedLibraryInterface::onCheckLibraryIntegrity()
+{
+    QMutexLocker locker(lock_);
+    library_->onCheckLibraryIntegrity();
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::onEditItem()
+//-----------------------------------------------------------------------------
+void SerializedLibraryInterface::onEditItem(VLNV const& vlnv)
+{
+    QMutexLocker locker(lock_);
+    library_->onEditItem(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::onOpenDesign()
+//-----------------------------------------------------------------------------
+void SerializedLibraryInterface::onOpenDesign(VLNV const& vlnv, QString const& viewName)
+{
+    QMutexLocker locker(lock_);
+    library_->onOpenDesign(vlnv, viewName);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::removeObject()
+//-----------------------------------------------------------------------------
+void SerializedLibraryInterface::removeObject(VLNV const& vlnv)
+{
+    QMutexLocker locker(lock_);
+    library_->removeObject(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::removeObjects()
+//-----------------------------------------------------------------------------
+void SerializedLibraryInterface::removeObjects(const QList<VLNV>& vlnvList)
+{
+    QMutexLocker locker(lock_);
+    library_->removeObjects(vlnvList);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::beginSave()
+//-----------------------------------------------------------------------------
+void SerializedLibraryInterface::beginSave()
+{
+    QMutexLocker locker(lock_);
+    library_->beginSave();
+}
+
+//-----------------------------------------------------------------------------
+// Function: SerializedLibraryInterface::endSave()
+//-----------------------------------------------------------------------------
+bool SerializedLibraryInterface::endSave()
+{
+    QMutexLocker locker(lock_);
+    return library_->endSave();
+}
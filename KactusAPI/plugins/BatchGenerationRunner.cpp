@@ -0,0 +1,367 @@
+//-----------------------------------------------------------------------------
+// File: BatchGenerationRunner.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Runs a manifest of generation jobs against a single loaded library using a pool of worker threads.
+//-----------------------------------------------------------------------------
+
+#include "BatchGenerationRunner.h"
+
+#include <KactusAPI/include/CLIGenerator.h>
+#include <KactusAPI/include/IGeneratorPlugin.h>
+#include <KactusAPI/include/IPlugin.h>
+#include <KactusAPI/include/LibraryInterface.h>
+#include <KactusAPI/include/MessageMediator.h>
+#include <KactusAPI/include/PluginUtilityAdapter.h>
+#include <KactusAPI/include/SerializedLibraryInterface.h>
+#include <KactusAPI/include/TraceRecorder.h>
+#include <KactusAPI/include/VersionHelper.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Design/Design.h>
+#include <IPXACTmodels/DesignConfiguration/DesignConfiguration.h>
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QRecursiveMutex>
+#include <QRunnable>
+#include <QThreadPool>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Message channel for a single job. Collects the errors and forwards all messages to a shared channel.
+    //-----------------------------------------------------------------------------
+    class JobMessageChannel : public MessageMediator
+    {
+    public:
+
+        JobMessageChannel(MessageMediator* target, QRecursiveMutex* lock, QString const& prefix):
+            target_(target), lock_(lock), prefix_(prefix) {}
+
+        ~JobMessageChannel() final = default;
+
+        void showMessage(QString const& message) const final
+        {
+            QMutexLocker locker(lock_);
+            target_->showMessage(prefix_ + message);
+        }
+
+        void showError(QString const& error) const final
+        {
+            QMutexLocker locker(lock_);
+            errors_.append(error);
+            target_->showError(prefix_ + error);
+        }
+
+        void showFailure(QString const& error) const final
+        {
+            QMutexLocker locker(lock_);
+            errors_.append(error);
+            target_->showFailure(prefix_ + error);
+        }
+
+        void showStatusMessage(QString const& status) const final
+        {
+            QMutexLocker locker(lock_);
+            target_->showStatusMessage(prefix_ + status);
+        }
+
+        QStringList getErrors() const
+        {
+            QMutexLocker locker(lock_);
+            return errors_;
+        }
+
+    private:
+
+        //! The shared channel.
+        MessageMediator* target_;
+
+        //! The lock for the shared channel.
+        QRecursiveMutex* lock_;
+
+        //! Prefix identifying the job in the shared output.
+        QString prefix_;
+
+        //! The errors reported by the job.
+        mutable QStringList errors_;
+    };
+
+    //-----------------------------------------------------------------------------
+    // Function: runJob()
+    //-----------------------------------------------------------------------------
+    void runJob(BatchGenerationRunner::Job const& job, IGeneratorPlugin* plugin, QMutex* pluginLock,
+        LibraryInterface* library, MessageMediator* messages)
+    {
+        QSharedPointer<Component> component = library->getModel<Component>(job.componentVLNV);
+        if (component.isNull())
+        {
+            messages->showError(QStringLiteral("Component %1 was not found in the library.").arg(
+                job.componentVLNV.toString()));
+            return;
+        }
+
+        VLNV configVLNV = component->getHierRef(job.viewName);
+        if (configVLNV.isValid() == false)
+        {
+            configVLNV = component->getHierSystemRef(job.viewName);
+        }
+
+        VLNV designVLNV;
+        QSharedPointer<DesignConfiguration> designConfiguration;
+        if (configVLNV.getType() == VLNV::DESIGNCONFIGURATION)
+        {
+            designConfiguration = library->getModel<DesignConfiguration>(configVLNV);
+            if (designConfiguration)
+            {
+                designVLNV = designConfiguration->getDesignRef();
+            }
+        }
+        else if (configVLNV.getType() == VLNV::DESIGN)
+        {
+            designVLNV = configVLNV;
+        }
+
+        QSharedPointer<Design> design;
+        if (designVLNV.isEmpty() == false)
+        {
+            design = library->getModel<Design>(designVLNV);
+        }
+
+        PluginUtilityAdapter adapter(library, messages, VersionHelper::createVersionString());
+
+        // Generator plugins keep state of the current run in the plugin instance.
+        // Jobs sharing a plugin are serialized, jobs of different generators run concurrently.
+        QMutexLocker locker(pluginLock);
+
+        TRACE_SCOPE_DETAIL("generation", "IGeneratorPlugin::runGenerator",
+            plugin->getName() + QStringLiteral(" ") + component->getVlnv().toString());
+        dynamic_cast<CLIGenerator*>(plugin)->runGenerator(&adapter, component, design, designConfiguration,
+            job.viewName, job.outputDirectory);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchGenerationRunner::BatchGenerationRunner()
+//-----------------------------------------------------------------------------
+BatchGenerationRunner::BatchGenerationRunner(LibraryInterface* library, MessageMediator* messageChannel):
+library_(library),
+messageChannel_(messageChannel)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchGenerationRunner::readManifest()
+//-----------------------------------------------------------------------------
+bool BatchGenerationRunner::readManifest(QString const& manifestPath)
+{
+    jobs_.clear();
+
+    QFile manifestFile(manifestPath);
+    if (manifestFile.open(QIODevice::ReadOnly) == false)
+    {
+        messageChannel_->showError(QStringLiteral("Could not open manifest %1.").arg(manifestPath));
+        return false;
+    }
+
+    QJsonParseError parseError;
+    QJsonDocument manifest = QJsonDocument::fromJson(manifestFile.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError || manifest.isObject() == false)
+    {
+        messageChannel_->showError(QStringLiteral("Could not parse manifest %1: %2").arg(manifestPath,
+            parseError.errorString()));
+        return false;
+    }
+
+    bool manifestValid = true;
+
+    const QJsonArray jobList = manifest.object().value(QStringLiteral("jobs")).toArray();
+    for (int i = 0; i < jobList.size(); ++i)
+    {
+        QJsonObject jobObject = jobList.at(i).toObject();
+
+        Job job;
+        job.componentVLNV = VLNV(VLNV::COMPONENT, jobObject.value(QStringLiteral("vlnv")).toString());
+        job.viewName = jobObject.value(QStringLiteral("view")).toString();
+        job.generatorName = jobObject.value(QStringLiteral("generator")).toString();
+        job.outputDirectory = jobObject.value(QStringLiteral("output")).toString();
+
+        if (job.componentVLNV.isValid() == false || job.generatorName.isEmpty() ||
+            job.outputDirectory.isEmpty())
+        {
+            messageChannel_->showError(QStringLiteral("Manifest job %1 must define vlnv, generator and output.").arg(
+                QString::number(i)));
+            manifestValid = false;
+        }
+
+        jobs_.append(job);
+    }
+
+    return manifestValid;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchGenerationRunner::setWorkerCount()
+//-----------------------------------------------------------------------------
+void BatchGenerationRunner::setWorkerCount(int workerCount)
+{
+    workerCount_ = workerCount;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchGenerationRunner::run()
+//-----------------------------------------------------------------------------
+int BatchGenerationRunner::run(QList<IPlugin*> const& plugins)
+{
+    QElapsedTimer totalTimer;
+    totalTimer.start();
+
+    QHash<QString, IGeneratorPlugin*> generators;
+    for (IPlugin* plugin : plugins)
+    {
+        auto generator = dynamic_cast<IGeneratorPlugin*>(plugin);
+        if (generator != nullptr && dynamic_cast<CLIGenerator*>(plugin) != nullptr)
+        {
+            generators.insert(plugin->getName(), generator);
+        }
+    }
+
+    QRecursiveMutex coreLock;
+    SerializedLibraryInterface library(library_, &coreLock);
+
+    QHash<IGeneratorPlugin*, QSharedPointer<QMutex> > pluginLocks;
+    for (IGeneratorPlugin* generator : generators)
+    {
+        pluginLocks.insert(generator, QSharedPointer<QMutex>(new QMutex()));
+    }
+
+    results_ = QVector<JobResult>(jobs_.size());
+
+    QThreadPool workers;
+    if (workerCount_ > 0)
+    {
+        workers.setMaxThreadCount(workerCount_);
+    }
+
+    for (int i = 0; i < jobs_.size(); ++i)
+    {
+        JobResult& result = results_[i];
+        result.job = jobs_.at(i);
+
+        IGeneratorPlugin* generator = generators.value(result.job.generatorName, nullptr);
+        if (generator == nullptr)
+        {
+            result.exitStatus = 1;
+            result.errors.append(QStringLiteral("No command-line generator named '%1' is available.").arg(
+                result.job.generatorName));
+
+            // The jobs already started report to the same channel.
+            QMutexLocker locker(&coreLock);
+            messageChannel_->showError(result.errors.last());
+            continue;
+        }
+
+        QMutex* pluginLock = pluginLocks.value(generator).data();
+        QString prefix = QStringLiteral("[%1] ").arg(QString::number(i));
+
+        workers.start(QRunnable::create([&result, generator, pluginLock, &library, &coreLock, prefix, this]()
+        {
+            QElapsedTimer timer;
+            timer.start();
+
+            JobMessageChannel messages(messageChannel_, &coreLock, prefix);
+            runJob(result.job, generator, pluginLock, &library, &messages);
+
+            result.elapsedTime = timer.elapsed();
+            result.errors = messages.getErrors();
+            result.exitStatus = result.errors.isEmpty() ? 0 : 1;
+        }));
+    }
+
+    workers.waitForDone();
+
+    totalElapsedTime_ = totalTimer.elapsed();
+
+    int failedJobs = 0;
+    for (JobResult const& result : results_)
+    {
+        if (result.exitStatus != 0)
+        {
+            ++failedJobs;
+        }
+    }
+
+    messageChannel_->showMessage(QStringLiteral("Batch generation finished: %1 job(s), %2 failed, %3 ms.").arg(
+        QString::number(results_.size()), QString::number(failedJobs), QString::number(totalElapsedTime_)));
+
+    return failedJobs;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchGenerationRunner::writeReport()
+//-----------------------------------------------------------------------------
+bool BatchGenerationRunner::writeReport(QString const& reportPath) const
+{
+    QJsonArray jobList;
+    int failedJobs = 0;
+    for (JobResult const& result : results_)
+    {
+        QJsonObject jobObject;
+        jobObject.insert(QStringLiteral("vlnv"), result.job.componentVLNV.toString());
+        jobObject.insert(QStringLiteral("view"), result.job.viewName);
+        jobObject.insert(QStringLiteral("generator"), result.job.generatorName);
+        jobObject.insert(QStringLiteral("output"), result.job.outputDirectory);
+        jobObject.insert(QStringLiteral("exitStatus"), result.exitStatus);
+        jobObject.insert(QStringLiteral("elapsedMs"), result.elapsedTime);
+        jobObject.insert(QStringLiteral("errors"), QJsonArray::fromStringList(result.errors));
+
+        jobList.append(jobObject);
+
+        if (result.exitStatus != 0)
+        {
+            ++failedJobs;
+        }
+    }
+
+    QJsonObject report;
+    report.insert(QStringLiteral("jobs"), jobList);
+    report.insert(QStringLiteral("failed"), failedJobs);
+    report.insert(QStringLiteral("elapsedMs"), totalElapsedTime_);
+
+    QFile reportFile(reportPath);
+    if (reportFile.open(QIODevice::WriteOnly | QIODevice::Truncate) == false)
+    {
+        messageChannel_->showError(QStringLiteral("Could not write report %1.").arg(reportPath));
+        return false;
+    }
+
+    reportFile.write(QJsonDocument(report).toJson());
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchGenerationRunner::getJobs()
+//-----------------------------------------------------------------------------
+QVector<BatchGenerationRunner::Job> BatchGenerationRunner::getJobs() const
+{
+    return jobs_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchGenerationRunner::getResults()
+//-----------------------------------------------------------------------------
+QVector<BatchGenerationRunner::JobResult> BatchGenerationRunner::getResults() const
+{
+    return results_;
+}
@@ -18,6 +18,7 @@
 
 #include <KactusAPI/include/HighlightSource.h>
 #include <KactusAPI/include/ExpressionSupport.h>
+#include <KactusAPI/include/IncludePathSupport.h>
 
 #include <FileHandler.h>
 #include <KactusAPI/include/NullParser.h>
@@ -47,7 +48,8 @@ analyzerPlugins_(),
 parameterFinder_(parameterFinder),
 displayTabs_(displayTabs),
 fileSuffixTable_(FileHandler::constructFileSuffixTable()),
-componentsInFile_()
+componentsInFile_(),
+includeDirectories_()
 {
     
 }
@@ -96,6 +98,8 @@ QSharedPointer<Component> ImportRunner::run(QString const& componentName, QStrin
     QSharedPointer<Component> importComponent(new Component(*targetComponent.data()));
     parameterFinder_->setComponent(importComponent);
 
+    includeDirectories_ = findIncludeDirectories(componentXmlPath, importComponent);
+
     importIncludes(filePath, componentXmlPath, importComponent);
 
     QStringList filetypes = filetypesOf(filePath, *importComponent->getFileSets().data());
@@ -222,6 +226,36 @@ void ImportRunner::importIncludes(QString const& filePath, QString const& compon
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: ImportRunner::findIncludeDirectories()
+//-----------------------------------------------------------------------------
+QStringList ImportRunner::findIncludeDirectories(QString const& componentXmlPath,
+    QSharedPointer<const Component> component) const
+{
+    QStringList directories;
+
+    for (auto const& fileSet : *component->getFileSets())
+    {
+        for (QString const& dependency : *fileSet->getDependencies())
+        {
+            directories.append(General::getAbsolutePath(componentXmlPath, dependency));
+        }
+
+        for (auto const& file : *fileSet->getFiles())
+        {
+            if (file->isIncludeFile())
+            {
+                directories.append(QFileInfo(General::getAbsolutePath(componentXmlPath, file->name())).absolutePath());
+            }
+        }
+    }
+
+    directories.removeAll(QString());
+    directories.removeDuplicates();
+
+    return directories;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ImportRunner::filetypesOf()
 //-----------------------------------------------------------------------------
@@ -308,7 +342,14 @@ void ImportRunner::importFile(QString const& componentName, QString const& fileP
     for (ImportPlugin* parser : importPluginsForFile)
     {
         compatibilityWarnings.append(parser->getCompatibilityWarnings());
-        
+
+        IncludePathSupport* includePathSupport = dynamic_cast<IncludePathSupport*>(parser);
+        if (includePathSupport)
+        {
+            includePathSupport->setInputLocation(General::getAbsolutePath(absoluteBasePath, filePath),
+                includeDirectories_);
+        }
+
         HighlightSource* highlightSource = dynamic_cast<HighlightSource*>(parser);
         if (highlightSource)
         {
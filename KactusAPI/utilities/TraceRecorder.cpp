@@ -0,0 +1,475 @@
+//-----------------------------------------------------------------------------
+// File: TraceRecorder.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Records timed spans and counters of the core operations for profiling.
+//-----------------------------------------------------------------------------
+
+#include <KactusAPI/include/TraceRecorder.h>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QSharedPointer>
+#include <QThread>
+#include <QVector>
+
+#include <atomic>
+
+namespace
+{
+    //! A single recorded event.
+    struct TraceEvent
+    {
+        //! The Chrome trace phase of the event, 'X' for a complete span and 'C' for a counter.
+        char phase = 'X';
+
+        //! The category of the event.
+        const char* category = nullptr;
+
+        //! The name of the event.
+        const char* name = nullptr;
+
+        //! The start time in microseconds.
+        qint64 timestamp = 0;
+
+        //! The duration of a span or the value of a counter.
+        qint64 value = 0;
+
+        //! Details of a span.
+        QString detail;
+    };
+
+    //! The events recorded by a single thread.
+    struct ThreadBuffer
+    {
+        //! Guards the events against concurrent writing of the trace.
+        QMutex mutex;
+
+        //! Sequential identifier of the thread in the trace.
+        int threadId = 0;
+
+        //! Name of the thread in the trace.
+        QString threadName;
+
+        //! The recorded events.
+        QVector<TraceEvent> events;
+    };
+
+    //! The shared state of the recorder.
+    struct TraceState
+    {
+        TraceState()
+        {
+            clock.start();
+        }
+
+        //! Is recording enabled.
+        std::atomic<bool> enabled{ false };
+
+        //! The trace time base.
+        QElapsedTimer clock;
+
+        //! Guards the buffer registry.
+        QMutex registryMutex;
+
+        //! The identifier given to the next thread recording events.
+        int nextThreadId = 1;
+
+        //! The buffers of the running threads that have recorded events.
+        QVector<QSharedPointer<ThreadBuffer> > buffers;
+
+        //! The buffers of the finished threads that still hold recorded events.
+        QVector<QSharedPointer<ThreadBuffer> > finishedBuffers;
+    };
+
+    //! Owns the buffer of a thread and releases it when the thread finishes.
+    struct ThreadBufferOwner
+    {
+        //! The destructor. Releases the buffer.
+        ~ThreadBufferOwner();
+
+        //! The buffer of the thread.
+        QSharedPointer<ThreadBuffer> buffer;
+    };
+
+    /*!
+     *  Gets the shared state of the recorder.
+     *
+     *    @return The recorder state.
+     */
+    TraceState& state();
+
+    /*!
+     *  Gets the buffer of the calling thread, registering it on first use.
+     *
+     *    @return The event buffer of the thread.
+     */
+    ThreadBuffer& threadBuffer();
+
+    /*!
+     *  Removes the buffer of a finished thread from the registry. The recorded events of the buffer are kept until
+     *  the next start.
+     *
+     *    @param [in] buffer  The buffer to release.
+     */
+    void releaseThreadBuffer(QSharedPointer<ThreadBuffer> buffer);
+
+    /*!
+     *  Gets the buffers holding recorded events. The registry must be locked by the caller.
+     *
+     *    @param [in] traceState  The recorder state.
+     *
+     *    @return The buffers of the finished and the running threads.
+     */
+    QVector<QSharedPointer<ThreadBuffer> > recordedBuffers(TraceState const& traceState);
+
+    /*!
+     *  Stores an event in the buffer of the calling thread.
+     *
+     *    @param [in] event   The event to store.
+     */
+    void storeEvent(TraceEvent const& event);
+
+    /*!
+     *  Creates the Chrome trace representation of an event.
+     *
+     *    @param [in] event       The event to convert.
+     *    @param [in] processId   The process id for the trace.
+     *    @param [in] threadId    The thread id for the trace.
+     *
+     *    @return The event as a JSON object.
+     */
+    QJsonObject toJson(TraceEvent const& event, qint64 processId, int threadId);
+
+    //-----------------------------------------------------------------------------
+    // Function: state()
+    //-----------------------------------------------------------------------------
+    TraceState& state()
+    {
+        static TraceState traceState;
+        return traceState;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: threadBuffer()
+    //-----------------------------------------------------------------------------
+    ThreadBuffer& threadBuffer()
+    {
+        thread_local ThreadBufferOwner owner;
+        QSharedPointer<ThreadBuffer>& buffer = owner.buffer;
+
+        if (buffer.isNull())
+        {
+            buffer = QSharedPointer<ThreadBuffer>(new ThreadBuffer());
+
+            QThread* currentThread = QThread::currentThread();
+            buffer->threadName = currentThread->objectName();
+
+            TraceState& traceState = state();
+            QMutexLocker registryLocker(&traceState.registryMutex);
+
+            buffer->threadId = traceState.nextThreadId++;
+            if (buffer->threadName.isEmpty())
+            {
+                QCoreApplication* application = QCoreApplication::instance();
+                if (application && application->thread() == currentThread)
+                {
+                    buffer->threadName = QStringLiteral("Main thread");
+                }
+                else
+                {
+                    buffer->threadName = QStringLiteral("Thread %1").arg(buffer->threadId);
+                }
+            }
+
+            traceState.buffers.append(buffer);
+        }
+
+        return *buffer;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: ThreadBufferOwner::~ThreadBufferOwner()
+    //-----------------------------------------------------------------------------
+    ThreadBufferOwner::~ThreadBufferOwner()
+    {
+        if (buffer.isNull() == false)
+        {
+            releaseThreadBuffer(buffer);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: releaseThreadBuffer()
+    //-----------------------------------------------------------------------------
+    void releaseThreadBuffer(QSharedPointer<ThreadBuffer> buffer)
+    {
+        TraceState& traceState = state();
+
+        QMutexLocker registryLocker(&traceState.registryMutex);
+        traceState.buffers.removeOne(buffer);
+
+        QMutexLocker bufferLocker(&buffer->mutex);
+        if (buffer->events.isEmpty() == false)
+        {
+            buffer->events.squeeze();
+            traceState.finishedBuffers.append(buffer);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: recordedBuffers()
+    //-----------------------------------------------------------------------------
+    QVector<QSharedPointer<ThreadBuffer> > recordedBuffers(TraceState const& traceState)
+    {
+        return traceState.finishedBuffers + traceState.buffers;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: storeEvent()
+    //-----------------------------------------------------------------------------
+    void storeEvent(TraceEvent const& event)
+    {
+        ThreadBuffer& buffer = threadBuffer();
+
+        QMutexLocker bufferLocker(&buffer.mutex);
+        buffer.events.append(event);
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: toJson()
+    //-----------------------------------------------------------------------------
+    QJsonObject toJson(TraceEvent const& event, qint64 processId, int threadId)
+    {
+        QString name = QString::fromLatin1(event.name);
+
+        QJsonObject eventObject;
+        eventObject.insert(QStringLiteral("name"), name);
+        eventObject.insert(QStringLiteral("cat"), QString::fromLatin1(event.category));
+        eventObject.insert(QStringLiteral("ph"), QString(QLatin1Char(event.phase)));
+        eventObject.insert(QStringLiteral("ts"), event.timestamp);
+        eventObject.insert(QStringLiteral("pid"), processId);
+        eventObject.insert(QStringLiteral("tid"), threadId);
+
+        QJsonObject arguments;
+        if (event.phase == 'X')
+        {
+            eventObject.insert(QStringLiteral("dur"), event.value);
+
+            if (event.detail.isEmpty() == false)
+            {
+                arguments.insert(QStringLiteral("detail"), event.detail);
+            }
+        }
+        else
+        {
+            arguments.insert(name, event.value);
+        }
+
+        if (arguments.isEmpty() == false)
+        {
+            eventObject.insert(QStringLiteral("args"), arguments);
+        }
+
+        return eventObject;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceRecorder::start()
+//-----------------------------------------------------------------------------
+void TraceRecorder::start()
+{
+    TraceState& traceState = state();
+
+    QMutexLocker registryLocker(&traceState.registryMutex);
+    traceState.finishedBuffers.clear();
+    for (QSharedPointer<ThreadBuffer> const& buffer : traceState.buffers)
+    {
+        QMutexLocker bufferLocker(&buffer->mutex);
+        buffer->events.clear();
+    }
+
+    traceState.enabled.store(true, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceRecorder::stop()
+//-----------------------------------------------------------------------------
+void TraceRecorder::stop()
+{
+    state().enabled.store(false, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceRecorder::isEnabled()
+//-----------------------------------------------------------------------------
+bool TraceRecorder::isEnabled() noexcept
+{
+    return state().enabled.load(std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceRecorder::currentTime()
+//-----------------------------------------------------------------------------
+qint64 TraceRecorder::currentTime() noexcept
+{
+    return state().clock.nsecsElapsed() / 1000;
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceRecorder::addSpan()
+//-----------------------------------------------------------------------------
+void TraceRecorder::addSpan(const char* category, const char* name, qint64 startTime, qint64 duration,
+    QString const& detail)
+{
+    TraceEvent event;
+    event.phase = 'X';
+    event.category = category;
+    event.name = name;
+    event.timestamp = startTime;
+    event.value = duration;
+    event.detail = detail;
+
+    storeEvent(event);
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceRecorder::addCounter()
+//-----------------------------------------------------------------------------
+void TraceRecorder::addCounter(const char* category, const char* name, qint64 value)
+{
+    TraceEvent event;
+    event.phase = 'C';
+    event.category = category;
+    event.name = name;
+    event.timestamp = currentTime();
+    event.value = value;
+
+    storeEvent(event);
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceRecorder::eventCount()
+//-----------------------------------------------------------------------------
+int TraceRecorder::eventCount()
+{
+    TraceState& traceState = state();
+
+    int count = 0;
+
+    QMutexLocker registryLocker(&traceState.registryMutex);
+    for (QSharedPointer<ThreadBuffer> const& buffer : recordedBuffers(traceState))
+    {
+        QMutexLocker bufferLocker(&buffer->mutex);
+        count += buffer->events.size();
+    }
+
+    return count;
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceRecorder::toChromeTrace()
+//-----------------------------------------------------------------------------
+QByteArray TraceRecorder::toChromeTrace()
+{
+    TraceState& traceState = state();
+    qint64 processId = QCoreApplication::applicationPid();
+
+    QJsonArray traceEvents;
+
+    QMutexLocker registryLocker(&traceState.registryMutex);
+    for (QSharedPointer<ThreadBuffer> const& buffer : recordedBuffers(traceState))
+    {
+        QMutexLocker bufferLocker(&buffer->mutex);
+        if (buffer->events.isEmpty())
+        {
+            continue;
+        }
+
+        QJsonObject nameArguments;
+        nameArguments.insert(QStringLiteral("name"), buffer->threadName);
+
+        QJsonObject threadName;
+        threadName.insert(QStringLiteral("name"), QStringLiteral("thread_name"));
+        threadName.insert(QStringLiteral("ph"), QStringLiteral("M"));
+        threadName.insert(QStringLiteral("pid"), processId);
+        threadName.insert(QStringLiteral("tid"), buffer->threadId);
+        threadName.insert(QStringLiteral("args"), nameArguments);
+        traceEvents.append(threadName);
+
+        for (TraceEvent const& event : buffer->events)
+        {
+            traceEvents.append(toJson(event, processId, buffer->threadId));
+        }
+    }
+
+    QJsonObject trace;
+    trace.insert(QStringLiteral("traceEvents"), traceEvents);
+    trace.insert(QStringLiteral("displayTimeUnit"), QStringLiteral("ms"));
+
+    return QJsonDocument(trace).toJson(QJsonDocument::Compact);
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceRecorder::writeChromeTrace()
+//-----------------------------------------------------------------------------
+bool TraceRecorder::writeChromeTrace(QString const& filePath)
+{
+    QSaveFile traceFile(filePath);
+    if (traceFile.open(QIODevice::WriteOnly) == false)
+    {
+        return false;
+    }
+
+    traceFile.write(toChromeTrace());
+    return traceFile.commit();
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceSpan::TraceSpan()
+//-----------------------------------------------------------------------------
+TraceSpan::TraceSpan(const char* category, const char* name) noexcept:
+category_(category),
+name_(name)
+{
+    if (TraceRecorder::isEnabled())
+    {
+        startTime_ = TraceRecorder::currentTime();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceSpan::TraceSpan()
+//-----------------------------------------------------------------------------
+TraceSpan::TraceSpan(const char* category, const char* name, QString const& detail):
+category_(category),
+name_(name),
+detail_(detail)
+{
+    if (TraceRecorder::isEnabled())
+    {
+        startTime_ = TraceRecorder::currentTime();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: TraceSpan::~TraceSpan()
+//-----------------------------------------------------------------------------
+TraceSpan::~TraceSpan()
+{
+    if (startTime_ >= 0)
+    {
+        TraceRecorder::addSpan(category_, name_, startTime_, TraceRecorder::currentTime() - startTime_, detail_);
+    }
+}
@@ -86,20 +86,9 @@ void MakefileGenerator::generateInstanceMakefile(QString const& targetPath, QStr
         return;
     }
 
-    // Create the makefile.
-    QFile makeFile(pathString);
-    
-	// If it cannot be written, then it is too bad.
-    if (!makeFile.open(QIODevice::WriteOnly))
-    {
-        utility_->printError("Could not open the makefile at location " + pathString);
-		utility_->printError("Reason: " + makeFile.errorString());
-		utility_->printError("Top instance: " + makeData->name);
-		return;
-    }
-
-	// Nicer to handle as a stream.
-    QTextStream outStream(&makeFile);
+    // The makefile is composed in memory, so that it can be compared to the existing one.
+    QString makeContent;
+    QTextStream outStream(&makeContent);
 
     // Write the paths of directories containing includes.
     outStream << "_INCLUDES=";
@@ -139,9 +128,13 @@ void MakefileGenerator::generateInstanceMakefile(QString const& targetPath, QStr
 
 	// Write the compilation rules for the object files.
     writeMakeObjects(outStream, makeData->swObjects, absolutePathString);
+    outStream.flush();
 
-    // Close after it is done.
-    makeFile.close();
+    if (!writeIfChanged(pathString, makeContent))
+    {
+        utility_->printError("Top instance: " + makeData->name);
+        return;
+    }
 
     // The file set is the instance file set earlier defined for the make file.
     QSharedPointer<FileSet> fileSet = makeData->instanceFileSet;
@@ -169,58 +162,48 @@ void MakefileGenerator::generateMainMakefile(QString const& targetPath, QString
     QStringList& makeNames) const
 {
     QString pathString = targetPath + "/" + MakeCommon::MAKEFILE_MASTER_NAME;
-    // Create the master makefile.
-    QFile makeFile(pathString);
 
-    // If it cannot be written, then it is too bad.
-    if (!makeFile.open(QIODevice::WriteOnly))
-    {
-        utility_->printError("Could not open the makefile at location " + pathString);
-        utility_->printError("Reason: " + makeFile.errorString());
-        return;
-    }
+    // The master makefile is composed in memory, so that it can be compared to the existing one.
+    QString makeContent;
+    QTextStream outStream(&makeContent);
 
-    // Nicer to handle as a stream.
-    QTextStream outStream(&makeFile);
+    // Each goal has its own target for each directory, so that the directories are made in parallel with make -j.
+    // The sub-makes are invoked through $(MAKE) to share the job slots of the master make.
+    QStringList const goals({ "make", "clean", "debug", "profile" });
 
-    // Default target for each directory.
-    outStream << "make:";
+    outStream << ".PHONY: " << goals.join(" ");
 
-    for (auto const& directory : makeNames)
+    for (QString const& goal : goals)
     {
-        QFileInfo qfi(targetPath + "/" + directory);
-        outStream << Qt::endl << "\t(cd " << General::getRelativePath(targetPath, qfi.absolutePath()) << "; make -f " << qfi.fileName() << ")";
-    }
+        outStream << Qt::endl << Qt::endl << goal << ":";
 
-    // Needs also cleaner for each directory.
-    outStream << Qt::endl << Qt::endl << "clean:";
+        for (auto const& directory : makeNames)
+        {
+            outStream << " " << goal << "-" << directory;
+        }
+    }
 
-    for (auto const& directory : makeNames)
+    for (QString const& goal : goals)
     {
-        QFileInfo qfi(targetPath + "/" + directory);
-        outStream << Qt::endl << "\t(cd " << General::getRelativePath(targetPath, qfi.absolutePath()) << "; make clean -f " << qfi.fileName() << ")";
-	}
-
-	// Debug target for each directory.
-	outStream << Qt::endl << Qt::endl << "debug:";
+        for (auto const& directory : makeNames)
+        {
+            QFileInfo qfi(targetPath + "/" + directory);
+            QString makeGoal = goal == "make" ? QString() : " " + goal;
 
-	for (auto const& directory : makeNames)
-    {
-        QFileInfo qfi(targetPath + "/" + directory);
-        outStream << Qt::endl << "\t(cd " << General::getRelativePath(targetPath, qfi.absolutePath()) << "; make debug -f " << qfi.fileName() << ")";
-	}
+            outStream << Qt::endl << Qt::endl << ".PHONY: " << goal << "-" << directory << Qt::endl;
+            outStream << goal << "-" << directory << ":" << Qt::endl;
+            outStream << "\t$(MAKE) -C " << General::getRelativePath(targetPath, qfi.absolutePath()) << 
+                " -f " << qfi.fileName() << makeGoal;
+        }
+    }
 
-	// Profiling target for each directory.
-	outStream << Qt::endl << Qt::endl << "profile:";
+    outStream << Qt::endl;
+    outStream.flush();
 
-	for (auto const& directory : makeNames)
+    if (!writeIfChanged(pathString, makeContent))
     {
-        QFileInfo qfi(targetPath + "/" + directory);
-		outStream << Qt::endl << "\t(cd " << General::getRelativePath(targetPath, qfi.absolutePath()) << "; make profile -f " << qfi.fileName() << ")";
-	}
-
-    // Close after it is done.
-    makeFile.close();
+        return;
+    }
 
     // The path in the fileSet must be relative to the basePath.
     QString relDir = General::getRelativePath(componentPath, pathString);
@@ -235,6 +218,40 @@ void MakefileGenerator::generateMainMakefile(QString const& targetPath, QString
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: MakefileGenerator::writeIfChanged()
+//-----------------------------------------------------------------------------
+bool MakefileGenerator::writeIfChanged(QString const& pathString, QString const& content) const
+{
+    QByteArray newContent = content.toUtf8();
+    QFile makeFile(pathString);
+
+    // An unchanged makefile is left untouched, so that its timestamp does not trigger a rebuild.
+    if (makeFile.open(QIODevice::ReadOnly))
+    {
+        bool unchanged = makeFile.size() == newContent.size() && makeFile.readAll() == newContent;
+        makeFile.close();
+
+        if (unchanged)
+        {
+            return true;
+        }
+    }
+
+    // If it cannot be written, then it is too bad.
+    if (!makeFile.open(QIODevice::WriteOnly))
+    {
+        utility_->printError("Could not open the makefile at location " + pathString);
+        utility_->printError("Reason: " + makeFile.errorString());
+        return false;
+    }
+
+    makeFile.write(newContent);
+    makeFile.close();
+
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: MakefileGenerator::writeFinalFlagsAndBuilder()
 //-----------------------------------------------------------------------------
@@ -75,6 +75,16 @@ private:
      */
     void generateMainMakefile(QString const& targetPath, QString const& componentPath, QStringList& makeNames) const;
 
+    /*!
+     *  Writes the content to the makefile, unless the makefile already has the same content.
+     *
+     *    @param [in] pathString  The path of the makefile.
+     *    @param [in] content     The content of the makefile.
+     *
+     *    @return False, if the makefile could not be written, otherwise true.
+     */
+    bool writeIfChanged(QString const& pathString, QString const& content) const;
+
     /*!
      *  Writes data used in building the executable to the stream.
      *
@@ -12,6 +12,7 @@
 #include "MakefileParser.h"
 
 #include <QFileInfo>
+#include <QHash>
 #include <QSet>
 
 #include <IPXACTmodels/kactusExtensions/ApiInterface.h>
@@ -276,35 +277,31 @@ QString MakefileParser::getFileFlags(QSharedPointer<Component> component,
 //-----------------------------------------------------------------------------
 void MakefileParser::findConflicts(QSharedPointer<MakeFileData> makeData)
 {
-	// Take a copy of the list, so that they may be removed while evaluating.
-	QList<QSharedPointer<MakeObjectData> > objects = makeData->swObjects;
+	// The objects grouped by their files, in the order the files were first found.
+	QVector<QSet<QSharedPointer<MakeObjectData> > > filesObjects;
+	QHash<QPair<QString, QString>, int> fileIndices;
 
-	// Go on until the list is empty.
-	while (!objects.empty())
+	for (QSharedPointer<MakeObjectData> mod : makeData->swObjects)
 	{
-		// Remove the object, so that there will not be a double entry nor self-evaluation.
-		QSharedPointer<MakeObjectData> mod = objects.first();
-		objects.removeFirst();
+		// Absolute path is same means that the file is definitely same.
+		// Must also consider the filename, as it is omitted from the path.
+		QPair<QString, QString> fileKey(mod->path, mod->fileName);
 
-		// List of the entires that conflict each other.
-		QSet<QSharedPointer<MakeObjectData> > conflictingFiles;
-
-		// The object itself must be one of the sides of the conflict.
-		conflictingFiles.insert(mod);
-
-		// Compare it to the others
-		foreach (QSharedPointer<MakeObjectData> modCompare, objects)
+		auto index = fileIndices.constFind(fileKey);
+		if (index == fileIndices.constEnd())
 		{
-			// Absolute path is same means that the file is definitely same.
-			// Must also consider the filename, as it is omitted from the path.
-			if (modCompare->path == mod->path && modCompare->fileName == mod->fileName)
-			{
-                conflictingFiles.insert(modCompare);
-                objects.removeOne(modCompare);
-            }
+			fileIndices.insert(fileKey, filesObjects.size());
+			filesObjects.append(QSet<QSharedPointer<MakeObjectData> >({ mod }));
 		}
+		else
+		{
+			filesObjects[*index].insert(mod);
+		}
+	}
 
-		// One side of the conflict is the file compared to others, there has to be two conflicting files.
+	// There has to be two objects of the same file for a conflict.
+	for (QSet<QSharedPointer<MakeObjectData> > const& conflictingFiles : filesObjects)
+	{
 		if (conflictingFiles.size() > 1)
 		{
 			makeData->conflicts.append(conflictingFiles);
@@ -266,7 +266,7 @@ void BaseMemoryMapHeaderWriter::writeRegistersFromAddressBlock(AddressContainer
     bool useAddressBlockID,
     QString const& idString /* = QString() */) const
 {
-    auto addressBlockOffset = blockItem->getAddress().toULongLong() + addressContainer.baseAddress_;
+    auto addressBlockOffset = blockItem->getAddressValue() + addressContainer.baseAddress_;
 
     QString id;
     if (!idString.isEmpty())
@@ -361,7 +361,7 @@ void BaseMemoryMapHeaderWriter::writeRegister(quint64 const& addressBlockOffset,
     QSharedPointer<MemoryItem> registerItem,
     QString const& idString /* = QString() */) const
 {
-    auto registerOffsetInt = registerItem->getOffset().toULongLong() + addressBlockOffset;
+    auto registerOffsetInt = registerItem->getOffsetValue() + addressBlockOffset;
     QString registerOffsetString = QString::number(registerOffsetInt, 16);
     registerOffsetString.prepend("0x");
 
@@ -494,11 +494,11 @@ void BaseMemoryMapHeaderWriter::writeMemoryAddresses(AddressContainer const& add
 
 		if (blockItem->getUsage() == General::MEMORY || blockItem->getUsage() == General::RESERVED)
         {
-            quint64 addressOffset = blockItem->getAddress().toULongLong() + addressContainer.baseAddress_;
+            quint64 addressOffset = blockItem->getAddressValue() + addressContainer.baseAddress_;
             QString addressStart = QString::number(addressOffset, 16);
             addressStart.prepend("0x");
 
-            quint64 endAddressInt = addressOffset + blockItem->getRange().toULongLong();
+            quint64 endAddressInt = addressOffset + blockItem->getRangeValue();
 			if (endAddressInt > 0)
 			{
 				endAddressInt -= 1;
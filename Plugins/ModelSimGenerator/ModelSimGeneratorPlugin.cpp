@@ -44,7 +44,7 @@ QString ModelSimGeneratorPlugin::getName() const
 //-----------------------------------------------------------------------------
 QString ModelSimGeneratorPlugin::getVersion() const
 {
-    return "2.2";
+    return "3.0";
 }
 
 //-----------------------------------------------------------------------------
@@ -52,7 +52,7 @@ QString ModelSimGeneratorPlugin::getVersion() const
 //-----------------------------------------------------------------------------
 QString ModelSimGeneratorPlugin::getDescription() const
 {
-	return "Generates a ModelSim do file, which adds the files in design to the active ModelSim project.";
+	return "Generates a ModelSim do file, which compiles the changed files of the design in dependency order.";
 }
 
 //-----------------------------------------------------------------------------
@@ -13,6 +13,34 @@
 
 #include <IPXACTmodels/generaldeclarations.h>
 
+#include <QPair>
+#include <QVector>
+
+namespace
+{
+    //! The file storing the file signatures between the script runs.
+    const QString STATE_FILE = QStringLiteral("kactus2_compile_state.tcl");
+
+    /*!
+     *  Quotes a word for Tcl.
+     *
+     *    @param [in] word    The word to quote.
+     *
+     *    @return The quoted word.
+     */
+    QString quote(QString const& word);
+
+    /*!
+     *  Creates a Tcl list of paths relative to the output directory.
+     *
+     *    @param [in] paths               The absolute paths.
+     *    @param [in] outputDirectory     The directory of the written script.
+     *
+     *    @return The Tcl list.
+     */
+    QString relativePathList(QStringList const& paths, QString const& outputDirectory);
+}
+
 //-----------------------------------------------------------------------------
 // Function: ModelSimWriter::ModelSimWriter()
 //-----------------------------------------------------------------------------
@@ -26,22 +54,52 @@ ModelSimWriter::ModelSimWriter()
 void ModelSimWriter::write(QTextStream& output, QString const& outputDirectory) const
 {
     // Inform user when executing the script.
-    output << "echo " << QObject::tr("\"Adding files to the project\"") << Qt::endl;
+    output << "echo " << QObject::tr("\"Compiling the changed files\"") << Qt::endl;
 
     output << Qt::endl;
 
-    // Each path gets a line: Create a relative path from output directory to the location.
-    foreach (QString absolutePath, paths_)
+    writeChangeDetection(output, STATE_FILE);
+
+    QList<SourceFile> compileOrder = getCompileOrder();
+
+    // Create and map the libraries before compiling anything into them.
+    QStringList libraries;
+    for (SourceFile const& file : compileOrder)
     {
-        QString relativePath = General::getRelativePath(outputDirectory, absolutePath);
+        if (file.compiler.isEmpty() == false && libraries.contains(file.library) == false)
+        {
+            libraries.append(file.library);
 
-        output << "project addfile " << relativePath << Qt::endl;
+            output << "if {![file exists " << quote(file.library) << "]} {vlib " << quote(file.library) << "}" <<
+                Qt::endl;
+            output << "vmap " << quote(file.library) << " " << quote(file.library) << Qt::endl;
+        }
     }
 
     output << Qt::endl;
 
-    // Latsly, compile the project.
-    output << "project compileall" << Qt::endl;
+    // Each group of consecutive files with the same options is compiled in one invocation.
+    QList<SourceFile> group;
+    for (SourceFile const& file : compileOrder)
+    {
+        if (group.isEmpty() == false && hasSameCompileOptions(group.first(), file) == false)
+        {
+            writeCompileGroup(output, group, outputDirectory);
+            group.clear();
+        }
+
+        group.append(file);
+    }
+
+    if (group.isEmpty() == false)
+    {
+        writeCompileGroup(output, group, outputDirectory);
+    }
+
+    // Lastly, store the signatures of the successfully compiled files for the next run.
+    output << "set channel [open $kactus2_stateFile w]" << Qt::endl;
+    output << "puts $channel [list array set kactus2_previous [array get kactus2_current]]" << Qt::endl;
+    output << "close $channel" << Qt::endl;
 
     output << Qt::endl;
 
@@ -50,12 +108,204 @@ void ModelSimWriter::write(QTextStream& output, QString const& outputDirectory)
 }
 
 //-----------------------------------------------------------------------------
-// Function: ModelSimWriter::addPath()
+// Function: ModelSimWriter::addFile()
+//-----------------------------------------------------------------------------
+void ModelSimWriter::addFile(SourceFile const& file)
+{
+    if (fileIndices_.contains(file.path) == false)
+    {
+        fileIndices_.insert(file.path, files_.size());
+        files_.append(file);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ModelSimWriter::getCompileOrder()
+//-----------------------------------------------------------------------------
+QList<ModelSimWriter::SourceFile> ModelSimWriter::getCompileOrder() const
+{
+    enum VisitState
+    {
+        UNVISITED,
+        VISITING,
+        VISITED
+    };
+
+    QList<SourceFile> compileOrder;
+    QVector<VisitState> states(files_.size(), UNVISITED);
+
+    // Depth-first search over the dependencies, adding each file after the files it depends on.
+    for (int root = 0; root < files_.size(); ++root)
+    {
+        if (states.at(root) != UNVISITED)
+        {
+            continue;
+        }
+
+        // The files being visited with the position of the next dependency to visit.
+        QVector<QPair<int, int> > stack;
+        stack.append(qMakePair(root, 0));
+        states[root] = VISITING;
+
+        while (stack.isEmpty() == false)
+        {
+            int current = stack.last().first;
+            QStringList const& dependencies = files_.at(current).dependencies;
+
+            if (stack.last().second < dependencies.size())
+            {
+                int dependency = fileIndices_.value(dependencies.at(stack.last().second), -1);
+                ++stack.last().second;
+
+                // Dependencies outside the compiled files and dependency cycles are ignored.
+                if (dependency >= 0 && states.at(dependency) == UNVISITED)
+                {
+                    states[dependency] = VISITING;
+                    stack.append(qMakePair(dependency, 0));
+                }
+            }
+            else
+            {
+                states[current] = VISITED;
+                compileOrder.append(files_.at(current));
+                stack.removeLast();
+            }
+        }
+    }
+
+    return compileOrder;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ModelSimWriter::writeChangeDetection()
+//-----------------------------------------------------------------------------
+void ModelSimWriter::writeChangeDetection(QTextStream& output, QString const& stateFile) const
+{
+    // The signature is a checksum of the content, or the size and modification time without zlib support.
+    output << "proc kactus2_signature {path} {" << Qt::endl;
+    output << "    set channel [open $path r]" << Qt::endl;
+    output << "    fconfigure $channel -translation binary" << Qt::endl;
+    output << "    set content [read $channel]" << Qt::endl;
+    output << "    close $channel" << Qt::endl;
+    output << Qt::endl;
+    output << "    if {[catch {zlib crc32 $content} signature]} {" << Qt::endl;
+    output << "        set signature \"[file size $path]-[file mtime $path]\"" << Qt::endl;
+    output << "    }" << Qt::endl;
+    output << Qt::endl;
+    output << "    return $signature" << Qt::endl;
+    output << "}" << Qt::endl;
+    output << Qt::endl;
+
+    // A file has changed, if its content has changed or any of the files it depends on has changed.
+    output << "proc kactus2_changed {path dependencies} {" << Qt::endl;
+    output << "    global kactus2_previous kactus2_current kactus2_changedFiles" << Qt::endl;
+    output << Qt::endl;
+    output << "    set kactus2_current($path) [kactus2_signature $path]" << Qt::endl;
+    output << "    set changed [expr {![info exists kactus2_previous($path)] || "
+        "$kactus2_previous($path) ne $kactus2_current($path)}]" << Qt::endl;
+    output << Qt::endl;
+    output << "    foreach dependency $dependencies {" << Qt::endl;
+    output << "        if {[info exists kactus2_changedFiles($dependency)]} {" << Qt::endl;
+    output << "            set changed 1" << Qt::endl;
+    output << "        }" << Qt::endl;
+    output << "    }" << Qt::endl;
+    output << Qt::endl;
+    output << "    if {$changed} {" << Qt::endl;
+    output << "        set kactus2_changedFiles($path) 1" << Qt::endl;
+    output << "    }" << Qt::endl;
+    output << Qt::endl;
+    output << "    return $changed" << Qt::endl;
+    output << "}" << Qt::endl;
+    output << Qt::endl;
+
+    output << "array set kactus2_previous {}" << Qt::endl;
+    output << "array set kactus2_current {}" << Qt::endl;
+    output << "array set kactus2_changedFiles {}" << Qt::endl;
+    output << "set kactus2_stateFile " << quote(stateFile) << Qt::endl;
+    output << "if {[file exists $kactus2_stateFile]} {source $kactus2_stateFile}" << Qt::endl;
+    output << Qt::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ModelSimWriter::writeCompileGroup()
+//-----------------------------------------------------------------------------
+void ModelSimWriter::writeCompileGroup(QTextStream& output, QList<SourceFile> const& group,
+    QString const& outputDirectory) const
+{
+    SourceFile const& options = group.first();
+
+    // Included files are not compiled, but their changes cause the including files to be compiled.
+    if (options.compiler.isEmpty())
+    {
+        for (SourceFile const& file : group)
+        {
+            output << "kactus2_changed " << quote(General::getRelativePath(outputDirectory, file.path)) << " " <<
+                relativePathList(file.dependencies, outputDirectory) << Qt::endl;
+        }
+
+        output << Qt::endl;
+        return;
+    }
+
+    output << "set kactus2_files {}" << Qt::endl;
+
+    for (SourceFile const& file : group)
+    {
+        QString relativePath = quote(General::getRelativePath(outputDirectory, file.path));
+
+        output << "if {[kactus2_changed " << relativePath << " " <<
+            relativePathList(file.dependencies, outputDirectory) << "]} {lappend kactus2_files " <<
+            relativePath << "}" << Qt::endl;
+    }
+
+    output << "if {[llength $kactus2_files] > 0} {" << Qt::endl;
+    output << "    " << options.compiler << " -work " << quote(options.library);
+
+    for (QString const& directory : options.includeDirectories)
+    {
+        output << " " << quote("+incdir+" + General::getRelativePath(outputDirectory, directory));
+    }
+
+    for (QString const& define : options.defines)
+    {
+        output << " " << quote("+define+" + define);
+    }
+
+    output << " {*}$kactus2_files" << Qt::endl;
+    output << "}" << Qt::endl;
+    output << Qt::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ModelSimWriter::hasSameCompileOptions()
 //-----------------------------------------------------------------------------
-void ModelSimWriter::addPath(QString const& path)
+bool ModelSimWriter::hasSameCompileOptions(SourceFile const& first, SourceFile const& second)
+{
+    return first.compiler == second.compiler && first.library == second.library &&
+        first.includeDirectories == second.includeDirectories && first.defines == second.defines;
+}
+
+namespace
 {
-    if (!paths_.contains(path))
+    //-----------------------------------------------------------------------------
+    // Function: quote()
+    //-----------------------------------------------------------------------------
+    QString quote(QString const& word)
     {
-        paths_.append(path);
+        return QLatin1Char('{') + word + QLatin1Char('}');
     }
-}
\ No newline at end of file
+
+    //-----------------------------------------------------------------------------
+    // Function: relativePathList()
+    //-----------------------------------------------------------------------------
+    QString relativePathList(QStringList const& paths, QString const& outputDirectory)
+    {
+        QStringList relativePaths;
+        for (QString const& path : paths)
+        {
+            relativePaths.append(quote(General::getRelativePath(outputDirectory, path)));
+        }
+
+        return quote(relativePaths.join(QLatin1Char(' ')));
+    }
+}
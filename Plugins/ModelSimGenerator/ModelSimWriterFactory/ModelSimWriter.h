@@ -12,32 +12,108 @@
 #ifndef MODELSIMWRITER_H
 #define MODELSIMWRITER_H
 
+#include <QHash>
 #include <QList>
 #include <QString>
+#include <QStringList>
 #include <QTextStream>
 
 //-----------------------------------------------------------------------------
 // Executes writing a ModelSim do file.
+//
+// The written script compiles the files in dependency order with one vlog or vcom invocation for each group of
+// files sharing the library and the compile options. The script stores a signature of each file content and
+// compiles only the files whose content or dependencies have changed since the previous run.
 //-----------------------------------------------------------------------------
 struct ModelSimWriter
 {
+    //! A source file to compile.
+    struct SourceFile
+    {
+        //! Absolute path to the file.
+        QString path;
+
+        //! The library into which the file is compiled.
+        QString library = QStringLiteral("work");
+
+        //! The compile command, vlog or vcom. Empty for files that are only included in other files.
+        QString compiler;
+
+        //! Absolute paths to the include directories of the file.
+        QStringList includeDirectories;
+
+        //! The preprocessor defines of the file in form name or name=value.
+        QStringList defines;
+
+        //! Absolute paths to the files this file depends on.
+        QStringList dependencies;
+    };
+
     //! The constructor.
     ModelSimWriter();
 
     /*!
      *  Writes the content to the given output.
      *
-     *    @param [in] output   The output to write to.
+     *    @param [in] output              The output to write to.
+     *    @param [in] outputDirectory     The directory of the written script.
      */
     void write(QTextStream& output, QString const& outputDirectory) const;
-    
+
     /*!
-     *  Adds an absolute path to the list of paths that needs to be referred.
+     *  Adds a file to compile. Files already added are ignored.
+     *
+     *    @param [in] file    The file to add.
      */
-    void addPath(QString const& path);
-    
+    void addFile(SourceFile const& file);
+
+    /*!
+     *  Gets the files ordered so that each file comes after the files it depends on. Files in a dependency cycle
+     *  are ordered by the first file of the cycle that was added.
+     *
+     *    @return The files in compile order.
+     */
+    QList<SourceFile> getCompileOrder() const;
+
 private:
-    QList<QString> paths_;
+
+    /*!
+     *  Writes the Tcl procedures for detecting the changed files.
+     *
+     *    @param [in] output      The output to write to.
+     *    @param [in] stateFile   The file storing the file signatures between the runs.
+     */
+    void writeChangeDetection(QTextStream& output, QString const& stateFile) const;
+
+    /*!
+     *  Writes the commands for compiling a group of files with the same compile options.
+     *
+     *    @param [in] output              The output to write to.
+     *    @param [in] group               The files to compile.
+     *    @param [in] outputDirectory     The directory of the written script.
+     */
+    void writeCompileGroup(QTextStream& output, QList<SourceFile> const& group,
+        QString const& outputDirectory) const;
+
+    /*!
+     *  Checks if two files can be compiled in the same invocation.
+     *
+     *    @param [in] first   The first file.
+     *    @param [in] second  The second file.
+     *
+     *    @return True, if the files have the same library and compile options.
+     */
+    static bool hasSameCompileOptions(SourceFile const& first, SourceFile const& second);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The files to compile in the order they were added.
+    QList<SourceFile> files_;
+
+    //! The positions of the files by their paths.
+    QHash<QString, int> fileIndices_;
 };
 
 #endif // MODELSIMWRITER_H
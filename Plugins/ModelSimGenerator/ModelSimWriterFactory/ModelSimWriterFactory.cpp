@@ -18,6 +18,10 @@
 
 #include <IPXACTmodels/Component/File.h>
 #include <IPXACTmodels/Component/FileSet.h>
+#include <IPXACTmodels/common/NameValuePair.h>
+#include <IPXACTmodels/kactusExtensions/FileDependency.h>
+
+#include <QMultiHash>
 
 //-----------------------------------------------------------------------------
 // Function: ModelSimWriterFactory::ModelSimWriterFactory()
@@ -69,14 +73,49 @@ QList<QSharedPointer<GenerationOutput> > ModelSimWriterFactory::prepareDesign(QL
     {
         QString basePath = library_->getPath(mComponent->getComponent()->getVlnv());
 
+        QMultiHash<QString, QString> dependencies = findFileDependencies(mComponent->getComponent(), basePath);
+
         for (QSharedPointer<FileSet> fileSet : *mComponent->getFileSets())
         {
+            QStringList fileSetIncludeDirectories = toAbsolutePaths(*fileSet->getDependencies(), basePath);
+
             for (QSharedPointer<File> file : *fileSet->getFiles())
             {
-                // Fetch the absolute path to the file
-                QString absolutePath = General::getAbsolutePath(basePath, file->name());
+                // Only HDL files can be compiled by the simulator.
+                if (file->isRTLFile() == false)
+                {
+                    continue;
+                }
 
-                writer->addPath(absolutePath);
+                ModelSimWriter::SourceFile source;
+
+                // Fetch the absolute path to the file
+                source.path = General::getAbsolutePath(basePath, file->name());
+                source.dependencies = dependencies.values(source.path);
+
+                if (file->getLogicalName().isEmpty() == false)
+                {
+                    source.library = file->getLogicalName();
+                }
+
+                if (file->isVhdlFile())
+                {
+                    source.compiler = QStringLiteral("vcom");
+                }
+                else if (file->isIncludeFile() == false)
+                {
+                    source.compiler = QStringLiteral("vlog");
+                    source.includeDirectories = fileSetIncludeDirectories +
+                        toAbsolutePaths(*file->getDependencies(), basePath);
+
+                    for (QSharedPointer<NameValuePair> define : *file->getDefines())
+                    {
+                        QString value = define->getValue();
+                        source.defines.append(value.isEmpty() ? define->name() : define->name() + "=" + value);
+                    }
+                }
+
+                writer->addFile(source);
             }
         }
     }
@@ -87,6 +126,41 @@ QList<QSharedPointer<GenerationOutput> > ModelSimWriterFactory::prepareDesign(QL
     return retval;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ModelSimWriterFactory::findFileDependencies()
+//-----------------------------------------------------------------------------
+QMultiHash<QString, QString> ModelSimWriterFactory::findFileDependencies(QSharedPointer<Component> component,
+    QString const& basePath) const
+{
+    QMultiHash<QString, QString> dependencies;
+
+    for (QSharedPointer<FileDependency> dependency : component->getFileDependencies())
+    {
+        // Two-way dependencies give no order for the files.
+        if (dependency->isBidirectional() == false)
+        {
+            dependencies.insert(General::getAbsolutePath(basePath, dependency->getFile1()),
+                General::getAbsolutePath(basePath, dependency->getFile2()));
+        }
+    }
+
+    return dependencies;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ModelSimWriterFactory::toAbsolutePaths()
+//-----------------------------------------------------------------------------
+QStringList ModelSimWriterFactory::toAbsolutePaths(QStringList const& paths, QString const& basePath) const
+{
+    QStringList absolutePaths;
+    for (QString const& path : paths)
+    {
+        absolutePaths.append(General::getAbsolutePath(basePath, path));
+    }
+
+    return absolutePaths;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ModelSimWriterFactory::getLanguage()
 //-----------------------------------------------------------------------------
@@ -95,6 +169,14 @@ QString ModelSimWriterFactory::getLanguage() const
     return QString();
 }
 
+//-----------------------------------------------------------------------------
+// Function: ModelSimWriterFactory::getFileSuffix()
+//-----------------------------------------------------------------------------
+QString ModelSimWriterFactory::getFileSuffix() const
+{
+    return "do";
+}
+
 //-----------------------------------------------------------------------------
 // Function: ModelSimWriterFactory::getSaveToFileset()
 //-----------------------------------------------------------------------------
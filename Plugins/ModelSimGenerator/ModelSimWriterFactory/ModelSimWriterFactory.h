@@ -16,6 +16,10 @@
 
 #include <Plugins/PluginSystem/GeneratorPlugin/IWriterFactory.h>
 
+#include <QMultiHash>
+#include <QStringList>
+
+class Component;
 struct GenerationSettings;
 
 //-----------------------------------------------------------------------------
@@ -69,6 +73,11 @@ public:
      *  Returns the language of the factory.
      */
     virtual QString getLanguage() const;
+
+    /*!
+     *  Returns the file suffix of the produced files without the leading dot.
+     */
+    virtual QString getFileSuffix() const;
     
     /*!
      *  Returns true, if it is desirable to save the output to file set by default.
@@ -82,6 +91,27 @@ public:
 
 private:
 
+    /*!
+     *  Finds the file dependencies found by the source analyzers of the component.
+     *
+     *    @param [in] component   The component whose dependencies to find.
+     *    @param [in] basePath    The path to the component.
+     *
+     *    @return The absolute paths of the dependencies by the absolute path of the depending file.
+     */
+    QMultiHash<QString, QString> findFileDependencies(QSharedPointer<Component> component,
+        QString const& basePath) const;
+
+    /*!
+     *  Converts the given paths relative to the component into absolute paths.
+     *
+     *    @param [in] paths       The paths to convert.
+     *    @param [in] basePath    The path to the component.
+     *
+     *    @return The absolute paths.
+     */
+    QStringList toAbsolutePaths(QStringList const& paths, QString const& basePath) const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
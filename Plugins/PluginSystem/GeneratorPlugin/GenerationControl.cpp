@@ -29,8 +29,8 @@
 //-----------------------------------------------------------------------------
 GenerationControl::GenerationControl(LibraryInterface* library,
     IWriterFactory* factory, GenerationTuple input, GenerationSettings* settings) :
-	library_(library), factory_(factory), input_(input), settings_(settings), isDesignGeneration_(input.design != 0),
-    outputControl_(new OutputControl)
+	library_(library), factory_(factory), factories_({ factory }), input_(input), settings_(settings),
+    isDesignGeneration_(input.design != 0), outputControl_(new OutputControl)
 {
     // Find views usable for the generation.
     QSharedPointer<QList<QSharedPointer<View> > > possibleViews;
@@ -58,6 +58,17 @@ GenerationControl::GenerationControl(LibraryInterface* library,
     outputControl_->setOutputPath(defaultOutputPath());
 }
 
+//-----------------------------------------------------------------------------
+// Function: GenerationControl::addWriterFactory()
+//-----------------------------------------------------------------------------
+void GenerationControl::addWriterFactory(IWriterFactory* factory)
+{
+    if (factory && factories_.contains(factory) == false)
+    {
+        factories_.append(factory);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: GenerationControl::writeDocuments()
 //-----------------------------------------------------------------------------
@@ -84,10 +95,14 @@ bool GenerationControl::writeDocuments()
             fileSet = QSharedPointer<FileSet>(new FileSet(viewSelection_->getFileSetName(), factory_->getGroupIdentifier()));
             input_.component->getFileSets()->append(fileSet);
         }
-        else if (!factory_->getGroupIdentifier().isEmpty() &&
-            !fileSet->getGroups()->contains(factory_->getGroupIdentifier()))
+
+        for (IWriterFactory* factory : factories_)
         {
-            fileSet->getGroups()->append(factory_->getGroupIdentifier());
+            if (!factory->getGroupIdentifier().isEmpty() &&
+                !fileSet->getGroups()->contains(factory->getGroupIdentifier()))
+            {
+                fileSet->getGroups()->append(factory->getGroupIdentifier());
+            }
         }
 
         // If instantiation exists, make sure that the instantiation refers to the file set.
@@ -207,6 +222,7 @@ void GenerationControl::initializeDocuments()
 {
     // Clear the existing list of files.
     outputControl_->getOutputs()->clear();
+    outputFactories_.clear();
     auto locale = QLocale::system();
     if (isDesignGeneration_)
     {
@@ -230,7 +246,7 @@ void GenerationControl::initializeDocuments()
             locale.dateFormat(QLocale::ShortFormat)), locale.toString(QTime::currentTime(), locale.timeFormat(QLocale::ShortFormat))));
 
         // Pass the topmost design.
-        QList<QSharedPointer<GenerationOutput> > documents = factory_->prepareDesign(designs);
+        QList<QSharedPointer<GenerationOutput> > documents = prepareDesignDocuments(designs);
 
         // Go through the parsed designs.
         for (QSharedPointer<GenerationOutput> output : documents)
@@ -257,22 +273,27 @@ void GenerationControl::initializeDocuments()
             (new MetaComponent(input_.messages, input_.component, viewSelection_->getView()));
         componentParser->formatComponent();
 
-        // Form writers from parsed data.
-        QSharedPointer<GenerationOutput> output = factory_->
-            prepareComponent(outputControl_->getOutputPath(), componentParser);
-
-        if (!output)
+        for (IWriterFactory* factory : factories_)
         {
-            return;
-        }
+            // Form writers from parsed data.
+            QSharedPointer<GenerationOutput> output = factory->
+                prepareComponent(outputControl_->getOutputPath(), componentParser);
 
-        // Write outputs.
-        input_.messages->showMessage(QObject::tr("Writing content for preview %1 %2.").arg(locale.toString(QDate::currentDate(),
-            locale.dateFormat(QLocale::ShortFormat)), locale.toString(QTime::currentTime(), locale.timeFormat(QLocale::ShortFormat))));
-        output->write(outputControl_->getOutputPath());
+            if (!output)
+            {
+                return;
+            }
 
-        // Append to the list of proposed outputs.
-        outputControl_->getOutputs()->append(output);
+            outputFactories_.insert(output.data(), factory);
+
+            // Write outputs.
+            input_.messages->showMessage(QObject::tr("Writing content for preview %1 %2.").arg(locale.toString(QDate::currentDate(),
+                locale.dateFormat(QLocale::ShortFormat)), locale.toString(QTime::currentTime(), locale.timeFormat(QLocale::ShortFormat))));
+            output->write(outputControl_->getOutputPath());
+
+            // Append to the list of proposed outputs.
+            outputControl_->getOutputs()->append(output);
+        }
     }
 }
 
@@ -292,7 +313,7 @@ void GenerationControl::reInitializeDocuments(
         QList<QSharedPointer<MetaDesign> > designs =
             MetaDesign::parseHierarchy(library_, input_, viewSelection_->getView());
 
-        QList<QSharedPointer<GenerationOutput> > documents = factory_->prepareDesign(designs);
+        QList<QSharedPointer<GenerationOutput> > documents = prepareDesignDocuments(designs);
         for (auto output : documents)
         {
             if (!output)
@@ -326,10 +347,12 @@ void GenerationControl::reInitializeDocuments(
                 newComponentParser->formatComponent();
                 newComponentParser->setModuleName(componentParser->getModuleName());
 
+                IWriterFactory* factory = findFactory(selection);
                 QSharedPointer<GenerationOutput> output =
-                    factory_->prepareComponent(outputControl_->getOutputPath(), componentParser);
+                    factory->prepareComponent(outputControl_->getOutputPath(), componentParser);
                 if (output)
                 {
+                    outputFactories_.insert(output.data(), factory);
                     output->fileName_ = selection->fileName_;
                     output->write(outputControl_->getOutputPath());
                     newGenerations.append(output);
@@ -357,6 +380,12 @@ QSharedPointer<GenerationOutput> GenerationControl::getMatchingMetaDesignOutput(
     {
         auto comparisonTopInstance = designOutput->metaDesign_->getTopInstance();
 
+        // Documents of different languages are written by different factories.
+        if (findFactory(output) != findFactory(designOutput))
+        {
+            continue;
+        }
+
 		if (originalTopInstance->getComponent()->getVlnv() == comparisonTopInstance->getComponent()->getVlnv() &&
             (originalTopInstance->getComponentInstance() == nullptr || 
             (originalTopInstance->getComponentInstance() && comparisonTopInstance->getComponentInstance() && 
@@ -369,6 +398,37 @@ QSharedPointer<GenerationOutput> GenerationControl::getMatchingMetaDesignOutput(
     return QSharedPointer<GenerationOutput>();
 }
 
+//-----------------------------------------------------------------------------
+// Function: GenerationControl::findFactory()
+//-----------------------------------------------------------------------------
+IWriterFactory* GenerationControl::findFactory(QSharedPointer<GenerationOutput> output) const
+{
+    return outputFactories_.value(output.data(), factory_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: GenerationControl::prepareDesignDocuments()
+//-----------------------------------------------------------------------------
+QList<QSharedPointer<GenerationOutput> > GenerationControl::prepareDesignDocuments(
+    QList<QSharedPointer<MetaDesign> >& designs)
+{
+    // Every factory writes its documents from the same parsed hierarchy.
+    QList<QSharedPointer<GenerationOutput> > documents;
+    for (IWriterFactory* factory : factories_)
+    {
+        for (QSharedPointer<GenerationOutput> const& output : factory->prepareDesign(designs))
+        {
+            if (output)
+            {
+                outputFactories_.insert(output.data(), factory);
+                documents.append(output);
+            }
+        }
+    }
+
+    return documents;
+}
+
 //-----------------------------------------------------------------------------
 // Function: GenerationControl::getViewSelection()
 //-----------------------------------------------------------------------------
@@ -538,19 +598,21 @@ QSharedPointer<GenerationOutput> GenerationControl::setupRenamedSelection(int co
     QSharedPointer < QList<QSharedPointer<GenerationOutput> > > generationOutputs = outputControl_->getOutputs();
     QSharedPointer<GenerationOutput> selection = generationOutputs->at(fileIndex);
     QString selectionFileName = selection->fileName_;
-    if (selectionFileName.right(2) == ".v")
+    IWriterFactory* factory = findFactory(selection);
+
+    QString fileSuffix = QLatin1Char('.') + factory->getFileSuffix();
+    if (selectionFileName.endsWith(fileSuffix))
     {
-        selectionFileName = selectionFileName.left(selectionFileName.size() - 2);
+        selectionFileName.chop(fileSuffix.size());
     }
 
     if (isDesignGeneration_)
     {
         selection->metaDesign_->getTopInstance()->setModuleName(selectionFileName);
 
-        if (auto correctedFileName = selection->fileName_; correctedFileName.right(2) != ".v")
+        if (selection->fileName_.endsWith(fileSuffix) == false)
         {
-            correctedFileName.append(".v");
-            selection->fileName_ = correctedFileName;
+            selection->fileName_.append(fileSuffix);
         }
 
         selection->write(outputControl_->getOutputPath());
@@ -569,12 +631,13 @@ QSharedPointer<GenerationOutput> GenerationControl::setupRenamedSelection(int co
         componentParser->setModuleName(selectionFileName);
 
         QSharedPointer<GenerationOutput> output =
-            factory_->prepareComponent(outputControl_->getOutputPath(), componentParser);
+            factory->prepareComponent(outputControl_->getOutputPath(), componentParser);
         if (output)
         {
             input_.messages->showMessage(QObject::tr("Writing content for preview %1 %2.").arg(locale.toString(QDate::currentDate(),
                 locale.dateFormat(QLocale::ShortFormat)), locale.toString(QTime::currentTime(), locale.timeFormat(QLocale::ShortFormat))));
 
+            outputFactories_.insert(output.data(), factory);
             output->write(outputControl_->getOutputPath());
 
             selection = output;
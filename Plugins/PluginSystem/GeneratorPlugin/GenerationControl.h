@@ -17,6 +17,8 @@
 
 #include <Plugins/PluginSystem/GeneratorPlugin/IWriterFactory.h>
 
+#include <QHash>
+
 class LibraryInterface;
 
 struct GenerationSettings
@@ -48,6 +50,14 @@ public:
 	//! The destructor.
     virtual ~GenerationControl() = default;
 
+    /*!
+     *  Adds a factory writing documents in another language. All the factories write their documents from the
+     *  same parsed hierarchy.
+     *
+     *    @param [in] factory     The factory to add.
+     */
+    void addWriterFactory(IWriterFactory* factory);
+
     /*!
      *  Tries to write documents to file system. Returns true if succeeds, else false.
      */
@@ -147,6 +157,24 @@ private:
      */
     QSharedPointer<GenerationOutput> getMatchingMetaDesignOutput(QSharedPointer<GenerationOutput> output) const;
 
+    /*!
+     *  Finds the factory that writes the given generation output.
+     *
+     *    @param [in] output  The generation output.
+     *
+     *    @return The factory that produced the output, or the main factory if the output is not known.
+     */
+    IWriterFactory* findFactory(QSharedPointer<GenerationOutput> output) const;
+
+    /*!
+     *  Creates the documents of every factory for the given meta designs.
+     *
+     *    @param [in] designs     The designs that will yield documents.
+     *
+     *    @return The documents of all the factories.
+     */
+    QList<QSharedPointer<GenerationOutput> > prepareDesignDocuments(QList<QSharedPointer<MetaDesign> >& designs);
+
     /*!
      *  Returns the default output path.     
      */
@@ -177,6 +205,10 @@ private:
 
     //! The language dependent factory for this generation session.
     IWriterFactory* factory_;
+    //! All the factories of this generation session, the main factory first.
+    QList<IWriterFactory*> factories_;
+    //! The factories that produced the proposed outputs.
+    QHash<GenerationOutput const*, IWriterFactory*> outputFactories_;
     //! Has the input objects for the generation.
     GenerationTuple input_;
     //! Points to the memorized settings.
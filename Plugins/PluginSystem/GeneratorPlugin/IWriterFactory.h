@@ -49,6 +49,11 @@ public:
      *  Returns the language of the factory.
      */
     virtual QString getLanguage() const = 0;
+
+    /*!
+     *  Returns the file suffix of the produced files without the leading dot.
+     */
+    virtual QString getFileSuffix() const = 0;
     
     /*!
      *  Returns true, if it is desirable to save the output to file set by default.
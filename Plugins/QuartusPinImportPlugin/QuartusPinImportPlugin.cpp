@@ -13,11 +13,15 @@
 #include "QuartusPinImportPlugin.h"
 #include "QuartusPinSyntax.h"
 
+#include <Plugins/common/PinTable/PinTableReader.h>
+
 #include <KactusAPI/include/KactusColors.h>
 
 #include <IPXACTmodels/Component/Component.h>
 #include <IPXACTmodels/Component/Port.h>
 
+#include <QTextStream>
+
 //-----------------------------------------------------------------------------
 // Function: QuartusPinImportPlugin::QuartusPinImportPlugin()
 //-----------------------------------------------------------------------------
@@ -45,7 +49,7 @@ QString QuartusPinImportPlugin::getName() const
 //-----------------------------------------------------------------------------
 QString QuartusPinImportPlugin::getVersion() const
 {
-    return tr("1.1");
+    return tr("1.2");
 }
 
 //-----------------------------------------------------------------------------
@@ -53,7 +57,7 @@ QString QuartusPinImportPlugin::getVersion() const
 //-----------------------------------------------------------------------------
 QString QuartusPinImportPlugin::getDescription() const
 {
-    return tr("Imports ports from Quartus pin file.");
+    return tr("Imports ports from Quartus pin file or CSV pin list.");
 }
 
 //-----------------------------------------------------------------------------
@@ -150,16 +154,32 @@ void QuartusPinImportPlugin::import(QString const& input, QString const& /*compo
 
     //! The existing ports are changed to phantom in order to keep the component error-free.
     //! These ports can then be deleted later.
-    foreach (QSharedPointer<Port> existingPort, *targetComponent->getPorts())
+    QHash<QString, QSharedPointer<Port> > ports;
+    for (QSharedPointer<Port> existingPort : *targetComponent->getPorts())
     {
         existingPort->setDirection(DirectionTypes::DIRECTION_PHANTOM);
+        ports.insert(existingPort->name(), existingPort);
     }
 
-    foreach (QString line, input.split(QRegularExpression("(\\r\\n?|\\n\\r?)")))
+    PinTableReader reader(QList<PinTableFormat>({ QuartusPinSyntax::pinTableFormat(),
+        PinTableFormat::csvPinList() }));
+
+    QString text(input);
+    QTextStream stream(&text, QIODevice::ReadOnly);
+
+    QString line;
+    PinDefinition pin;
+    while (stream.readLineInto(&line))
     {
-        if (QuartusPinSyntax::pinDefinition.match(line).hasMatch())
+        if (reader.readLine(line, pin))
         {
-            createPort(line, targetComponent);
+            if (highlighter_)
+            {
+                highlighter_->applyFontColor(line, Qt::black);
+                highlighter_->applyHighlight(line, KactusColors::Importer::PORT);
+            }
+
+            createPort(pin, ports, targetComponent);
         }
     }
 }
@@ -167,60 +187,23 @@ void QuartusPinImportPlugin::import(QString const& input, QString const& /*compo
 //-----------------------------------------------------------------------------
 // Function: QuartusPinImportPlugin::createPort()
 //-----------------------------------------------------------------------------
-void QuartusPinImportPlugin::createPort(QString const& line, QSharedPointer<Component> targetComponent)
+void QuartusPinImportPlugin::createPort(PinDefinition const& pin, QHash<QString, QSharedPointer<Port> >& ports,
+    QSharedPointer<Component> targetComponent)
 {
-    if (highlighter_)
-    {
-        highlighter_->applyFontColor(line, Qt::black);
-        highlighter_->applyHighlight(line, KactusColors::Importer::PORT);
-    }
-
-    QRegularExpressionMatch lineMatch = QuartusPinSyntax::pinDefinition.match(line);
-    
-    QString portName = lineMatch.captured(QuartusPinSyntax::LOCATION);
-
-    QString direction = lineMatch.captured(QuartusPinSyntax::DIRECTION);
-    DirectionTypes::Direction portDirection = parseDirection(direction);
-
-    QString description = lineMatch.captured(QuartusPinSyntax::PINUSAGE);
-
-    QSharedPointer<Port> port = targetComponent->getPort(portName);
+    QSharedPointer<Port> port = ports.value(pin.portName_);
     if (port.isNull())
     {
         QSharedPointer<Wire> portWire(new Wire());
         portWire->setDirection(DirectionTypes::DIRECTION_PHANTOM);
 
-        port = QSharedPointer<Port>(new Port(portName));
+        port = QSharedPointer<Port>(new Port(pin.portName_));
         port->setWire(portWire);
 
         targetComponent->getPorts()->append(port);
+        ports.insert(pin.portName_, port);
     }
 
-    port->setDirection(portDirection);
-    port->setDescription(description);
+    port->setDirection(pin.direction_);
+    port->setDescription(pin.description_);
     port->setPortSize(1);
 }
-
-//-----------------------------------------------------------------------------
-// Function: QuartusPinImportPlugin::parseDirection()
-//-----------------------------------------------------------------------------
-DirectionTypes::Direction QuartusPinImportPlugin::parseDirection(QString const& direction)
-{
-    if (QRegularExpression("input", QRegularExpression::CaseInsensitiveOption).match(direction).hasMatch())
-    {
-        return DirectionTypes::IN;
-    }
-    else if (QRegularExpression("output", QRegularExpression::CaseInsensitiveOption).match(direction).hasMatch())
-    {
-        return DirectionTypes::OUT;
-    }
-    else if (QRegularExpression("bidir|power|gnd",
-        QRegularExpression::CaseInsensitiveOption).match(direction).hasMatch())
-    {
-        return DirectionTypes::INOUT;
-    }
-    else
-    {
-        return DirectionTypes::DIRECTION_PHANTOM;
-    }
-}
@@ -18,10 +18,13 @@
 #include <KactusAPI/include/ImportPlugin.h>
 #include <KactusAPI/include/HighlightSource.h>
 
-#include <IPXACTmodels/common/DirectionTypes.h>
+#include <QHash>
+#include <QSharedPointer>
 
 class Component;
 class Highlighter;
+class Port;
+struct PinDefinition;
 //-----------------------------------------------------------------------------
 // Plugin for importing component ports from Quartus II pin file.
 //-----------------------------------------------------------------------------
@@ -137,21 +140,14 @@ private:
     QuartusPinImportPlugin& operator=(const QuartusPinImportPlugin& other);
 
     /*!
-     *  Creates a port in the component from the given line in the pin file.
+     *  Creates or updates a port in the component for the given pin.
      *
-     *    @param [in] line                The line to parse as port.
+     *    @param [in] pin                 The pin read from the pin file.
+     *    @param [in/out] ports           The ports of the component by name.
      *    @param [in] targetComponent     The component to add the port into.
      */
-    void createPort(QString const& line, QSharedPointer<Component> targetComponent);
-
-    /*!
-     *  Parses pin direction to IP-XACT port direction.
-     *
-     *    @param [in] direction   The direction to parse.
-     *
-     *    @return The port direction.
-     */
-    DirectionTypes::Direction parseDirection(QString const& direction);
+    void createPort(PinDefinition const& pin, QHash<QString, QSharedPointer<Port> >& ports,
+        QSharedPointer<Component> targetComponent);
 
     //! The highlighter to use.
     Highlighter* highlighter_;
@@ -4,6 +4,10 @@
 
 HEADERS += ./QuartusPinImportPlugin_global.h \
     ./QuartusPinSyntax.h \
-    ./QuartusPinImportPlugin.h
+    ./QuartusPinImportPlugin.h \
+    ../common/PinTable/PinTableFormat.h \
+    ../common/PinTable/PinTableReader.h
 
-SOURCES += ./QuartusPinImportPlugin.cpp
+SOURCES += ./QuartusPinImportPlugin.cpp \
+    ../common/PinTable/PinTableFormat.cpp \
+    ../common/PinTable/PinTableReader.cpp
@@ -12,40 +12,21 @@
 #ifndef QUARTUSPINSYNTAX_H
 #define QUARTUSPINSYNTAX_H
 
-#include <QRegularExpression>
+#include <Plugins/common/PinTable/PinTableFormat.h>
 
 namespace QuartusPinSyntax
 {
     // Delimiter for properties.
     const char DELIMITER = ':';
 
-    //! Whitespace without line end.
-    const QString SPACE = "[ \\t]*";    
+    // Lines starting with the prefix are comments.
+    const QString COMMENT = QStringLiteral("--");
 
     // Each pin assignment is described on its own line using the following syntax:
-    // Pin Name/Usage : Location : Dir. : I/O Standard : Voltage : I/O Bank  : User Assignment    
-    const QString pinName = "[^ :]+(?: / [^ :]+)*";
-    const QString location = "\\w+";
-    const QString direction = "input|output|bidir|power|gnd";
-    const QString ioStandard = "[^ :]+(?:" + SPACE + "[^ :]+)*";
-    const QString voltage = "\\d+\\.\\d+" + SPACE +"V";
-    const QString ioBank = "\\w+";
-    const QString userAssignment = "Y|N";
-
-    // Pin definition line.
-    const QRegularExpression pinDefinition = QRegularExpression("\\b(" + pinName + ")" + SPACE + DELIMITER + SPACE +        
-                                   "(" + location + ")" + SPACE + DELIMITER + SPACE +
-                                   "(" + direction + ")?" + SPACE + DELIMITER + SPACE +
-                                   "(" + ioStandard + ")?" + SPACE + DELIMITER + SPACE +
-                                   "(" + voltage + ")?" + SPACE + DELIMITER + SPACE +
-                                   "(" + ioBank + ")?" + SPACE + DELIMITER + SPACE +
-                                   "(" + userAssignment + ")?(?=\\s*$)", 
-                                   QRegularExpression::CaseInsensitiveOption);
-
-    // Property capture positions.
+    // Pin Name/Usage : Location : Dir. : I/O Standard : Voltage : I/O Bank  : User Assignment
     enum propertyPos
     {
-        PINUSAGE = 1,
+        PINUSAGE = 0,
         LOCATION,
         DIRECTION,
         IOSTANDARD,
@@ -54,6 +35,31 @@ namespace QuartusPinSyntax
         USERASSIGNMENT,
         PROPERTY_COUNT
     };
+
+    /*!
+     *  Creates the table format of the pin definition lines.
+     *
+     *    @return The format description.
+     */
+    inline PinTableFormat pinTableFormat()
+    {
+        PinTableFormat format;
+        format.name_ = QStringLiteral("Quartus pin file");
+        format.delimiter_ = QLatin1Char(DELIMITER);
+        format.commentPrefix_ = COMMENT;
+        format.columnCount_ = PROPERTY_COUNT;
+        format.portColumn_ = LOCATION;
+        format.descriptionColumn_ = PINUSAGE;
+        format.directionColumn_ = DIRECTION;
+        format.directions_ = {
+            { QStringLiteral("input"), DirectionTypes::IN },
+            { QStringLiteral("output"), DirectionTypes::OUT },
+            { QStringLiteral("bidir"), DirectionTypes::INOUT },
+            { QStringLiteral("power"), DirectionTypes::INOUT },
+            { QStringLiteral("gnd"), DirectionTypes::INOUT } };
+
+        return format;
+    }
 }
 
-#endif // QUARTUSPINSYNTAX_H
\ No newline at end of file
+#endif // QUARTUSPINSYNTAX_H
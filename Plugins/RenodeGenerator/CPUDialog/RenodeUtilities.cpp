@@ -12,10 +12,10 @@
 #include "RenodeUtilities.h"
 
 #include <Plugins/common/ConnectivityGraphUtilities.h>
+#include <Plugins/common/GlobalAddressMap.h>
 
 #include <editors/MemoryDesigner/MemoryItem.h>
 #include <editors/MemoryDesigner/MemoryDesignerConstants.h>
-#include <editors/MemoryDesigner/MemoryConnectionAddressCalculator.h>
 
 #include <QJsonArray>
 
@@ -63,7 +63,7 @@ namespace
         QMultiMap<quint64, QSharedPointer<MemoryItem>> blockItems;
         for (auto const& subItem : mapItem->getChildItems())
         {
-            blockItems.insert(subItem->getAddress().toULongLong(), subItem);
+            blockItems.insert(subItem->getAddressValue(), subItem);
         }
 
         return blockItems;
@@ -105,7 +105,7 @@ namespace
         QSharedPointer<MemoryItem> firstBlock = currentMemoryBlock.first();
         QSharedPointer<MemoryItem> lastBlock = currentMemoryBlock.last();
 
-        quint64 offset = mapBaseAddress + firstBlock->getAddress().toULongLong();
+        quint64 offset = mapBaseAddress + firstBlock->getAddressValue();
         qint64 endAddress = mapBaseAddress + lastBlock->getAddress().toLongLong() + lastBlock->getRange().toLongLong() - 1;
 
         quint64 size = endAddress - offset + 1;
@@ -133,7 +133,7 @@ namespace
         QSharedPointer<MemoryItem> firstBlock = currentMemoryBlock.first();
         QSharedPointer<MemoryItem> lastBlock = currentMemoryBlock.last();
 
-        quint64 offset = mapBaseAddress + firstBlock->getAddress().toULongLong();
+        quint64 offset = mapBaseAddress + firstBlock->getAddressValue();
         qint64 endAddress = mapBaseAddress + lastBlock->getAddress().toLongLong() + lastBlock->getRange().toLongLong() - 1;
 
         quint64 size = endAddress - offset + 1;
@@ -360,64 +360,53 @@ QVector<QSharedPointer<RenodeCpuRoutesContainer> > RenodeUtilities::getRenodeCpu
 
         for (auto cpuInterfaceContainer : defaultCPU->getRoutes())
         {
-            QSharedPointer<const ConnectivityInterface> cpuInterface = cpuInterfaceContainer->cpuInterface_;
-            for (auto const& masterSlaveRoute : cpuInterfaceContainer->routes_)
+            for (auto const& target : GlobalAddressMap::getAddressMap(cpuInterfaceContainer)->getTargets())
             {
-                for (auto routeInterface : masterSlaveRoute)
-                {
-                    QSharedPointer<const ConnectivityComponent> interfacedComponent = routeInterface->getInstance();
-                    QSharedPointer<MemoryItem> interfaceMemory = routeInterface->getConnectedMemory();
+                QSharedPointer<MemoryItem> interfaceMemory = target.memoryItem_;
 
-                    if (interfaceMemory && interfaceMemory->getType().compare(MemoryDesignerConstants::MEMORYMAP_TYPE, Qt::CaseInsensitive) == 0)
-                    {
-                        MemoryConnectionAddressCalculator::CalculatedPathAddresses pathAddresses =
-                            MemoryConnectionAddressCalculator::calculatePathAddresses(cpuInterface, routeInterface, masterSlaveRoute);
+                quint64 memoryBaseAddress = target.baseAddress_;
 
-                        quint64 memoryBaseAddress = pathAddresses.connectionBaseAddress_;
+                QVector<QPair<General::Usage, QVector<QSharedPointer<MemoryItem> > > > subItemBlocks;
 
-                        QVector<QPair<General::Usage, QVector<QSharedPointer<MemoryItem> > > > subItemBlocks;
+                QPair<General::Usage, QVector<QSharedPointer<MemoryItem> > > currentItemBlock;
 
-                        QPair<General::Usage, QVector<QSharedPointer<MemoryItem> > > currentItemBlock;
+                QMultiMap<quint64, QSharedPointer<MemoryItem> > orderedChildItems = getOrderedChildItems(interfaceMemory);
+                currentItemBlock.first = getFirstBlockUsage(orderedChildItems);
 
-                        QMultiMap<quint64, QSharedPointer<MemoryItem> > orderedChildItems = getOrderedChildItems(interfaceMemory);
-                        currentItemBlock.first = getFirstBlockUsage(orderedChildItems);
+                QMultiMapIterator blockIterator(orderedChildItems);
+                while (blockIterator.hasNext())
+                {
+                    blockIterator.next();
+                    QSharedPointer<MemoryItem> blockItem = blockIterator.value();
 
-                        QMultiMapIterator blockIterator(orderedChildItems);
-                        while (blockIterator.hasNext())
+                    if (blockItem->getType().compare(MemoryDesignerConstants::ADDRESSBLOCK_TYPE, Qt::CaseInsensitive) == 0)
+                    {
+                        if (usageIsMatching(currentItemBlock.first, blockItem->getUsage()))
+                        {
+                            currentItemBlock.second.append(blockItem);
+                        }
+                        else
                         {
-                            blockIterator.next();
-                            QSharedPointer<MemoryItem> blockItem = blockIterator.value();
-
-                            if (blockItem->getType().compare(MemoryDesignerConstants::ADDRESSBLOCK_TYPE, Qt::CaseInsensitive) == 0)
-                            {
-                                if (usageIsMatching(currentItemBlock.first, blockItem->getUsage()))
-                                {
-                                    currentItemBlock.second.append(blockItem);
-                                }
-                                else
-                                {
-                                    createItemBlock(currentItemBlock.first, currentItemBlock.second,
-                                        peripherals, memories, interfaceMemory, memoryBaseAddress, peripheralNames, memoryNames);
-
-                                    currentItemBlock.first = blockItem->getUsage();
-                                    currentItemBlock.second.clear();
-                                    currentItemBlock.second.append(blockItem);
-                                }
-                            }
-                            else
-                            {
-                                createItemBlock(currentItemBlock.first, currentItemBlock.second,
-                                    peripherals, memories, interfaceMemory, memoryBaseAddress, peripheralNames, memoryNames);
-
-                                currentItemBlock.first = General::USAGE_COUNT;
-                                currentItemBlock.second.clear();
-                            }
+                            createItemBlock(currentItemBlock.first, currentItemBlock.second,
+                                peripherals, memories, interfaceMemory, memoryBaseAddress, peripheralNames, memoryNames);
+
+                            currentItemBlock.first = blockItem->getUsage();
+                            currentItemBlock.second.clear();
+                            currentItemBlock.second.append(blockItem);
                         }
+                    }
+                    else
+                    {
+                        createItemBlock(currentItemBlock.first, currentItemBlock.second,
+                            peripherals, memories, interfaceMemory, memoryBaseAddress, peripheralNames, memoryNames);
 
-                        createItemBlock(currentItemBlock.first, currentItemBlock.second, peripherals, memories, interfaceMemory,
-                            memoryBaseAddress, peripheralNames, memoryNames);
+                        currentItemBlock.first = General::USAGE_COUNT;
+                        currentItemBlock.second.clear();
                     }
                 }
+
+                createItemBlock(currentItemBlock.first, currentItemBlock.second, peripherals, memories, interfaceMemory,
+                    memoryBaseAddress, peripheralNames, memoryNames);
             }
         }
 
@@ -50,6 +50,7 @@ HEADERS += ./RenodeSettingsModel.h \
     ./CPUDialog/TemplateEditor/PeripheralTemplateDelegate.h \
     ../common/ConfigurationManager.h \
     ../common/ConnectivityGraphUtilities.h \
+    ../common/GlobalAddressMap.h \
     ../common/CpuRoutesContainer.h \
     ../common/PluginConfigurationManager.h \
     ../common/SingleCpuRoutesContainer.h \
@@ -96,6 +97,7 @@ SOURCES += ./RenodeConfigurationManager.cpp \
     ../../common/views/EditableTableView/editabletableview.cpp \
     ../common/ConfigurationManager.cpp \
     ../common/ConnectivityGraphUtilities.cpp \
+    ../common/GlobalAddressMap.cpp \
     ../common/CpuRoutesContainer.cpp \
     ../common/PluginConfigurationManager.cpp \
     ../common/SingleCpuRoutesContainer.cpp \
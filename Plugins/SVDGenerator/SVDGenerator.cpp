@@ -23,7 +23,8 @@
 #include <editors/MemoryDesigner/MasterSlavePathSearch.h>
 #include <editors/MemoryDesigner/MemoryItem.h>
 #include <editors/MemoryDesigner/MemoryDesignerConstants.h>
-#include <editors/MemoryDesigner/MemoryConnectionAddressCalculator.h>
+
+#include <Plugins/common/GlobalAddressMap.h>
 
 #include <Plugins/SVDGenerator/CPUDialog/SVDCpuRoutesContainer.h>
 #include <Plugins/SVDGenerator/CPUDialog/SVDUtilities.h>
@@ -282,28 +283,18 @@ void SVDGenerator::writePeripherals(QXmlStreamWriter& writer, QVector<QSharedPoi
 
     for (auto singleRouteDetails : cpuRouteDetails)
     {
-        for (auto& masterSlaveRoute : singleRouteDetails->routes_)
+        for (auto const& target : GlobalAddressMap::getAddressMap(singleRouteDetails)->getTargets())
         {
-            for (int i = 1; i < masterSlaveRoute.size(); ++i)
+            // The initiator itself is not a peripheral.
+            if (target.routePosition_ > 0)
             {
-                QSharedPointer<const ConnectivityInterface> routeInterface = masterSlaveRoute.at(i);
-                QSharedPointer<const ConnectivityComponent> interfacedComponent = routeInterface->getInstance();
-                QSharedPointer<MemoryItem> interfaceMemory = routeInterface->getConnectedMemory();
-
-                if (interfaceMemory && interfaceMemory->getType().compare(
-                    MemoryDesignerConstants::MEMORYMAP_TYPE, Qt::CaseInsensitive) == 0)
-                {
-                    QSharedPointer<const Component> component =
-                        ConnectivityGraphUtilities::getInterfacedComponent(library_, interfacedComponent);
-
-                    MemoryConnectionAddressCalculator::CalculatedPathAddresses pathAddresses =
-                        MemoryConnectionAddressCalculator::calculatePathAddresses(singleRouteDetails->cpuInterface_, routeInterface, masterSlaveRoute);
+                QSharedPointer<const Component> component =
+                    ConnectivityGraphUtilities::getInterfacedComponent(library_, target.targetInterface_->getInstance());
 
-                    quint64 memoryBaseAddress = pathAddresses.connectionBaseAddress_;
-                    QString baseAddressInHexa = valueToHexa(memoryBaseAddress);
+                quint64 memoryBaseAddress = target.baseAddress_;
+                QString baseAddressInHexa = valueToHexa(memoryBaseAddress);
 
-                    writePeripheral(writer, component, interfaceMemory, memoryBaseAddress, baseAddressInHexa);
-                }
+                writePeripheral(writer, component, target.memoryItem_, memoryBaseAddress, baseAddressInHexa);
             }
         }
     }
@@ -364,7 +355,7 @@ void SVDGenerator::writeAddressBlocks(QXmlStreamWriter& writer,
 {
     for (auto const& blockItem : getAddressBlockItems(mapItem))
     {
-        quint64 blockBaseAddress = blockItem->getAddress().toULongLong();
+        quint64 blockBaseAddress = blockItem->getAddressValue();
         if (blockBaseAddress >= mapBaseAddress)
         {
             blockBaseAddress = blockBaseAddress - mapBaseAddress;
@@ -420,7 +411,7 @@ void SVDGenerator::writeSingleAddressBlock(QXmlStreamWriter& writer, quint64 con
     writer.writeStartElement(SVDConstants::ADDRESSBLOCKELEMENT);
 
     QString addressOffsetInHexa = valueToHexa(offset);
-    QString rangeInHexa = valueToHexa(blockItem->getRange().toULongLong());
+    QString rangeInHexa = valueToHexa(blockItem->getRangeValue());
 
     writer.writeTextElement(SVDConstants::ADDRESSBLOCKOFFSET, addressOffsetInHexa);
     writer.writeTextElement(SVDConstants::SIZE, rangeInHexa);
@@ -457,7 +448,7 @@ void SVDGenerator::writeRegisters(QXmlStreamWriter& writer, QSharedPointer<const
             continue;
         }
 
-        quint64 blockBaseAddress = blockItem->getAddress().toULongLong();
+        quint64 blockBaseAddress = blockItem->getAddressValue();
         if (blockBaseAddress >= mapBaseAddress)
         {
             blockBaseAddress = blockBaseAddress - mapBaseAddress;
@@ -516,7 +507,7 @@ void SVDGenerator::writeRegister(QXmlStreamWriter& writer, QSharedPointer<Memory
     }
 
     QString name = registerItem->getName();
-    quint64 registerOffset = registerItem->getOffset().toULongLong();
+    quint64 registerOffset = registerItem->getOffsetValue();
     QString addressOffsetInHexa = valueToHexa(registerOffset);
     QString sizeString = registerItem->getSize();
 
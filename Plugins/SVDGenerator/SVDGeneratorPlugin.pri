@@ -37,6 +37,7 @@ HEADERS += ./SVDConfigurationManager.h \
     ./CPUDialog/SVDCPUDelegate.h \
     ../common/ConfigurationManager.h \
     ../common/ConnectivityGraphUtilities.h \
+    ../common/GlobalAddressMap.h \
     ../common/CpuRoutesContainer.h \
     ../common/PluginConfigurationManager.h \
     ../common/SingleCpuRoutesContainer.h
@@ -68,6 +69,7 @@ SOURCES += ./SVDConfigurationManager.cpp \
     ./CPUDialog/SVDCPUModel.cpp \
     ../common/ConfigurationManager.cpp \
     ../common/ConnectivityGraphUtilities.cpp \
+    ../common/GlobalAddressMap.cpp \
     ../common/CpuRoutesContainer.cpp \
     ../common/PluginConfigurationManager.cpp \
     ../common/SingleCpuRoutesContainer.cpp
@@ -5,38 +5,45 @@
 
 HEADERS += ../../IPXACTmodels/utilities/ComponentSearch.h \
     ../../IPXACTmodels/utilities/Search.h \
+    ../../common/expressions/utilities.h \
+    ../../editors/common/TopComponentParameterFinder.h \
+    ../../mainwindow/MessageConsole/messageconsole.h \
+    ../common/HDLParser/HDLParserCommon.h \
+    ../common/HDLParser/MetaComponent.h \
+    ../common/HDLParser/MetaDesign.h \
+    ../common/HDLParser/MetaInstance.h \
+    ../common/PortSorter/InterfaceDirectionNameSorter.h \
+    ../common/PortSorter/PortSorter.h \
+    ../PluginSystem/GeneratorPlugin/FileOutputWidget.h \
+    ../PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../PluginSystem/GeneratorPlugin/HDLGenerationDialog.h \
+    ../PluginSystem/GeneratorPlugin/IWriterFactory.h \
+    ../PluginSystem/GeneratorPlugin/MessagePasser.h \
+    ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
-    ./vhdlcomponentdeclaration.h \
-    ./vhdlconnectionendpoint.h \
+    ../PluginSystem/GeneratorPlugin/ViewSelectionWidget.h \
     ./vhdlgeneral.h \
-    ./vhdlgeneric.h \
-    ./vhdlobject.h \
-    ./vhdlport.h \
-    ./vhdlportmap.h \
-    ./vhdlportsorter.h \
-    ./vhdlsignal.h \
-    ./VhdlTypedObject.h \
     ./VHDLGenerator_global.h \
-    ../PluginSystem/GeneratorPlugin/ViewSelectionWidget.h \
-    ./VHDLGeneratorDialog.h \
     ./VHDLGeneratorPlugin.h \
-    ./vhdlgenerator2.h \
-    ./vhdlcomponentinstance.h
+    ./VHDLWriterFactory/VHDLDocument.h \
+    ./VHDLWriterFactory/VHDLWriterFactory.h
 SOURCES += ../../IPXACTmodels/utilities/ComponentSearch.cpp \
+    ../../common/expressions/utilities.cpp \
+    ../../editors/common/TopComponentParameterFinder.cpp \
+    ../../mainwindow/MessageConsole/messageconsole.cpp \
+    ../common/HDLParser/MetaComponent.cpp \
+    ../common/HDLParser/MetaDesign.cpp \
+    ../common/HDLParser/MetaInstance.cpp \
+    ../common/PortSorter/InterfaceDirectionNameSorter.cpp \
+    ../PluginSystem/GeneratorPlugin/FileOutputWidget.cpp \
+    ../PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../PluginSystem/GeneratorPlugin/HDLGenerationDialog.cpp \
+    ../PluginSystem/GeneratorPlugin/MessagePasser.cpp \
+    ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelectionWidget.cpp \
-    ./vhdlcomponentdeclaration.cpp \
-    ./vhdlcomponentinstance.cpp \
-    ./vhdlconnectionendpoint.cpp \
     ./vhdlgeneral.cpp \
-    ./vhdlgenerator2.cpp \
-    ./VHDLGeneratorDialog.cpp \
     ./VHDLGeneratorPlugin.cpp \
-    ./vhdlgeneric.cpp \
-    ./vhdlobject.cpp \
-    ./vhdlport.cpp \
-    ./vhdlportmap.cpp \
-    ./vhdlportsorter.cpp \
-    ./vhdlsignal.cpp \
-    ./VhdlTypedObject.cpp
+    ./VHDLWriterFactory/VHDLDocument.cpp \
+    ./VHDLWriterFactory/VHDLWriterFactory.cpp
 RESOURCES += VHDLGenerator.qrc
@@ -11,31 +11,25 @@
 
 #include "VHDLGeneratorPlugin.h"
 
-#include "vhdlgenerator2.h"
-#include "VHDLGeneratorDialog.h"
+#include "VHDLWriterFactory/VHDLWriterFactory.h"
 
 #include <KactusAPI/include/LibraryInterface.h>
 
-#include <IPXACTmodels/Component/Component.h>
-
-#include <Plugins/PluginSystem/GeneratorPlugin/ViewSelection.h>
-#include <Plugins/common/HDLParser/HDLCommandLineParser.h>
+#include <Plugins/PluginSystem/GeneratorPlugin/HDLGenerationDialog.h>
+#include <Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h>
 
-#include <KactusAPI/include/ComponentParameterFinder.h>
-#include <KactusAPI/include/IPXactSystemVerilogParser.h>
-#include <KactusAPI/include/FileHandler.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Design/Design.h>
+#include <IPXACTmodels/DesignConfiguration/DesignConfiguration.h>
 
-#include <QCoreApplication>
-#include <QFileDialog>
-#include <QFileInfo>
-#include <QMessageBox>
+#include <QDir>
 
 //-----------------------------------------------------------------------------
 // Function: VHDLGeneratorPlugin::VHDLGeneratorPlugin()
 //-----------------------------------------------------------------------------
-VHDLGeneratorPlugin::VHDLGeneratorPlugin() : QObject(0), utility_(0), generationSettings_()
+VHDLGeneratorPlugin::VHDLGeneratorPlugin() : QObject(0), generationSettings_()
 {
-
+    generationSettings_.generateInterfaces_ = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -51,7 +45,7 @@ QString VHDLGeneratorPlugin::getName() const
 //-----------------------------------------------------------------------------
 QString VHDLGeneratorPlugin::getVersion() const
 {
-    return "1.4";
+    return "2.0";
 }
 
 //-----------------------------------------------------------------------------
@@ -114,9 +108,20 @@ QIcon VHDLGeneratorPlugin::getIcon() const
 // Function: VHDLGeneratorPlugin::checkGeneratorSupport()
 //-----------------------------------------------------------------------------
 bool VHDLGeneratorPlugin::checkGeneratorSupport(QSharedPointer<Component const> component,
-    QSharedPointer<Design const> /*design*/,
-    QSharedPointer<DesignConfiguration const> /*designConfiguration*/) const
+    QSharedPointer<Design const> design,
+    QSharedPointer<DesignConfiguration const> designConfiguration) const
 {
+    // If design or design configuration exists, their implementation overrides the top component.
+    if (design)
+    {
+        return design->getImplementation() == KactusAttribute::HW;
+    }
+
+    if (designConfiguration)
+    {
+        return designConfiguration->getImplementation() == KactusAttribute::HW;
+    }
+
     return component && component->getImplementation() == KactusAttribute::HW;
 }
 
@@ -125,28 +130,50 @@ bool VHDLGeneratorPlugin::checkGeneratorSupport(QSharedPointer<Component const>
 //-----------------------------------------------------------------------------
 void VHDLGeneratorPlugin::runGenerator(IPluginUtility* utility, 
     QSharedPointer<Component> component,
-    QSharedPointer<Design> /*design*/,
-    QSharedPointer<DesignConfiguration> /*designConfiguration*/)
+    QSharedPointer<Design> design,
+    QSharedPointer<DesignConfiguration> designConfiguration)
 {
-    utility_ = utility;
+    utility->printInfo(tr("Running %1 %2.").arg(getName(), getVersion()));
+
+    // Must have a component under any condition.
+    if (component.isNull())
+    {
+        utility->printError(tr("Invalid component given as a parameter."));
+        return;
+    }
+
+    MessagePasser messages;
 
-    QFileInfo targetInfo(utility_->getLibraryInterface()->getPath(component->getVlnv()));
+    GenerationTuple input;
+    input.component = component;
+    input.design = design;
+    input.designConfiguration = designConfiguration;
+    input.messages = &messages;
 
-    const bool saveToFileset = true;
-    QSharedPointer<ViewSelection> viewSettings(new ViewSelection(QStringLiteral("vhdl"), saveToFileset,
-        QString(), &generationSettings_, component->getViews(), component->getComponentInstantiations(),
-        component->getFileSets()));
+    VHDLWriterFactory factory(utility->getLibraryInterface(), &messages, &generationSettings_,
+        utility->getKactusVersion(), getVersion());
 
-    QString suggestedPath = targetInfo.absolutePath();
-    suggestedPath.append(QLatin1Char('/'));
-    suggestedPath.append(findEntityName(component, viewSettings->getViewName()));
-    suggestedPath.append(QStringLiteral(".vhd"));
+    // Create model for the configuration widget.
+    QSharedPointer<GenerationControl> configuration(new GenerationControl
+        (utility->getLibraryInterface(), &factory, input, &generationSettings_));
 
-    VHDLGeneratorDialog dialog(viewSettings, suggestedPath, utility->getParentWidget());
+    // Create the dialog and execute: The user will accept/decline the configuration.
+    HDLGenerationDialog dialog(configuration, QStringLiteral("VHDL"), utility->getParentWidget());
+
+    connect(&messages, SIGNAL(errorMessage(const QString&)),
+        &dialog, SLOT(onErrorMessage(const QString&)), Qt::UniqueConnection);
+    connect(&messages, SIGNAL(noticeMessage(const QString&)),
+        &dialog, SLOT(onNoticeMessage(const QString&)), Qt::UniqueConnection);
+
+    dialog.onViewChanged();
 
     if (dialog.exec() == QDialog::Accepted)
     {
-        generate(component, dialog.getOutputPath(), viewSettings);
+        utility->printInfo(tr("VHDL generation complete."));
+    }
+    else
+    {
+        utility->printInfo(tr("Generation aborted."));
     }
 }
 
@@ -162,135 +189,63 @@ QString VHDLGeneratorPlugin::getOutputFormat() const
 // Function: VHDLGeneratorPlugin::runGenerator()
 //-----------------------------------------------------------------------------
 void VHDLGeneratorPlugin::runGenerator(IPluginUtility* utility, QSharedPointer<Component> component, 
-    QSharedPointer<Design> /*design*/, QSharedPointer<DesignConfiguration> /*designConfiguration*/, 
+    QSharedPointer<Design> design, QSharedPointer<DesignConfiguration> designConfiguration, 
     QString const& viewName, QString const& outputDirectory)
 {
-    utility_ = utility;
-
-    utility_->printInfo(tr("Running %1 %2.").arg(getName(), getVersion()));
+    utility->printInfo(tr("Running %1 %2.").arg(getName(), getVersion()));
 
     // Must have a component under any condition.
     if (component == nullptr)
     {
-        utility_->printError(tr("Invalid component given as a parameter."));
+        utility->printError(tr("Invalid component given as a parameter."));
         return;
     }
 
-    utility_->printInfo(tr("Running generation for %1 and view '%2'.").arg(component->getVlnv().toString(),
+    utility->printInfo(tr("Running generation for %1 and view '%2'.").arg(component->getVlnv().toString(),
         viewName));
 
     QDir targetDirectory;
     if (!targetDirectory.mkpath(outputDirectory))
     {
-        utility_->printError(tr("Could not create target directory: %1").arg(outputDirectory));
+        utility->printError(tr("Could not create target directory: %1").arg(outputDirectory));
         return;
     }
 
-    utility_->printInfo(tr("Target directory: %1").arg(outputDirectory));
+    utility->printInfo(tr("Target directory: %1").arg(outputDirectory));
 
-    const bool saveToFileset = false;
-    QSharedPointer<ViewSelection> viewSettings(new ViewSelection(QStringLiteral("vhdl"), saveToFileset,
-        QString(), &generationSettings_, component->getViews(), component->getComponentInstantiations(),
-        component->getFileSets()));
+    generationSettings_.lastViewName_ = viewName;
 
-    QString filePath = outputDirectory;
-    filePath.append(QLatin1Char('/'));
-    filePath.append(findEntityName(component, viewName));
-    filePath.append(QStringLiteral(".vhd"));
+    MessagePasser messages;
 
-    generate(component, filePath, viewSettings);
-}
+    GenerationTuple input;
+    input.component = component;
+    input.design = design;
+    input.designConfiguration = designConfiguration;
+    input.messages = &messages;
 
-//-----------------------------------------------------------------------------
-// Function: VHDLGeneratorPlugin::getProgramRequirements()
-//-----------------------------------------------------------------------------
-QList<IPlugin::ExternalProgramRequirement> VHDLGeneratorPlugin::getProgramRequirements()
-{
-    return QList<IPlugin::ExternalProgramRequirement>();
-}
-
-//-----------------------------------------------------------------------------
-// Function: VHDLGeneratorPlugin::noticeMessage()
-//-----------------------------------------------------------------------------
-void VHDLGeneratorPlugin::noticeMessage(QString const& message)
-{
-    utility_->printInfo(message);
-}
+    VHDLWriterFactory factory(utility->getLibraryInterface(), &messages, &generationSettings_,
+        utility->getKactusVersion(), getVersion());
 
-//-----------------------------------------------------------------------------
-// Function: VHDLGeneratorPlugin::errorMessage()
-//-----------------------------------------------------------------------------
-void VHDLGeneratorPlugin::errorMessage(QString const& message)
-{
-    utility_->printError(message);
-}
+    // Use configuration to drive the generation.
+    GenerationControl configuration(utility->getLibraryInterface(), &factory, input, &generationSettings_);
+    configuration.getOutputControl()->setOutputPath(outputDirectory);
+    configuration.getViewSelection()->setSaveToFileset(false);
 
-//-----------------------------------------------------------------------------
-// Function: VHDLGeneratorPlugin::findEntityName()
-//-----------------------------------------------------------------------------
-QString VHDLGeneratorPlugin::findEntityName(QSharedPointer<Component> component, QString const& viewName) const
-{
-    foreach (QSharedPointer<View> componentView, *component->getViews())
+    configuration.parseDocuments();
+    if (configuration.writeDocuments())
     {
-        if (componentView->name().compare(viewName) == 0)
-        {
-            QString componentInstantiation = componentView->getComponentInstantiationRef();
-
-            for (QList<QSharedPointer<ComponentInstantiation> >::const_iterator iter = 
-                component->getComponentInstantiations()->cbegin();
-                iter != component->getComponentInstantiations()->cend(); ++iter)
-            {
-                if ((*iter)->name().compare(componentInstantiation) == 0)
-                {
-                    return (*iter)->getModuleName();
-                }
-            }
-        }
+        utility->printInfo(tr("VHDL generation complete."));
+    }
+    else
+    {
+        utility->printInfo(tr("Generation failed."));
     }
-
-    return component->getVlnv().getName();
 }
 
 //-----------------------------------------------------------------------------
-// Function: VHDLGeneratorPlugin::generate()
+// Function: VHDLGeneratorPlugin::getProgramRequirements()
 //-----------------------------------------------------------------------------
-void VHDLGeneratorPlugin::generate(QSharedPointer<Component> component, QString const& filePath, 
-    QSharedPointer<ViewSelection> viewSettings)
+QList<IPlugin::ExternalProgramRequirement> VHDLGeneratorPlugin::getProgramRequirements()
 {
-    auto generatorFilePath = filePath;
-    if (filePath.endsWith(".vhd") == false && filePath.endsWith(".vhdl") == false)
-    {
-        generatorFilePath = FileHandler::getModifiedPathWithExtension(filePath, QString("vhd"));
-    }
-
-    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
-    QSharedPointer<ExpressionParser> expressionParser(new IPXactSystemVerilogParser(finder));
-
-    VhdlGenerator2 generator(expressionParser, utility_->getLibraryInterface(), this);
-
-    connect(&generator, SIGNAL(errorMessage(const QString&)),
-        this, SLOT(errorMessage(const QString&)), Qt::UniqueConnection);
-    connect(&generator, SIGNAL(noticeMessage(const QString&)),
-        this, SLOT(noticeMessage(const QString&)), Qt::UniqueConnection);
-
-    // if errors are detected during parsing
-    if (!generator.parse(component, viewSettings->getViewName()))
-    {
-        return;
-    }
-
-    // Generate the VHDL code.
-	generator.generate(generatorFilePath);
-
-    if (viewSettings->getSaveToFileset())
-    {
-        QString basePath = utility_->getLibraryInterface()->getPath(component->getVlnv());
-		QString relativePath = General::getRelativePath(basePath, generatorFilePath);
-
-        generator.addRTLView(viewSettings->getFileSetName(), relativePath);
-        utility_->getLibraryInterface()->writeModelToFile(component);
-    }
-
-    // Inform when done.
-    utility_->printInfo( "VHDL generation complete." );
+    return QList<IPlugin::ExternalProgramRequirement>();
 }
@@ -20,8 +20,6 @@
 #include <KactusAPI/include/IGeneratorPlugin.h>
 #include <KactusAPI/include/CLIGenerator.h>
 
-#include <QCommandLineParser>
-
 //-----------------------------------------------------------------------------
 //! Kactus2 plugin for VHDL file generation.
 //-----------------------------------------------------------------------------
@@ -139,40 +137,14 @@ public:
          QString const& viewName, QString const& outputDirectory) override;
 
 
-private slots:
-    
-    //! Called when a user notification should be shown.
-    void noticeMessage(QString const& message);
-
-    //! Called when an error should be shown.
-    void errorMessage(QString const& message);
-   
 private:
-    //! The plugin utility provided by call runGenerator.
-    IPluginUtility* utility_;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
 
     //! Settings for the generation.
     GenerationSettings generationSettings_;
-
-    /*!
-     *  Finds the name of the component entity.
-     *
-     *    @param [in] component   The component to search.
-     *    @param [in] viewName    The selected view to search.
-     *
-     *    @return The name of the VHDL entity for the component.
-     */
-    QString findEntityName(QSharedPointer<Component> component, QString const& viewName) const;
-
-    /*!
-     *  Runs the VHDL generation for the given component.
-     *
-     *    @param [in] component       The component to generate VHDL from.
-     *    @param [in] filePath        The file path to save the VHDL file.
-     *    @param [in] viewSettings    The view settings for the generation.
-     */
-    void generate(QSharedPointer<Component> component, QString const& filePath,
-        QSharedPointer<ViewSelection> viewSettings);
 };
 
 #endif // VHDLGENERATORPLUGIN_H
@@ -0,0 +1,1159 @@
+//-----------------------------------------------------------------------------
+// File: VHDLDocument.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// VHDL document written from the elaborated HDL model.
+//-----------------------------------------------------------------------------
+
+#include "VHDLDocument.h"
+
+#include <Plugins/VHDLGenerator/vhdlgeneral.h>
+
+#include <KactusAPI/include/MessageMediator.h>
+
+#include <Plugins/common/HDLParser/MetaComponent.h>
+#include <Plugins/common/HDLParser/MetaDesign.h>
+#include <Plugins/common/HDLParser/MetaInstance.h>
+#include <Plugins/common/PortSorter/PortSorter.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Design/ComponentInstance.h>
+
+#include <QFile>
+#include <QObject>
+#include <QRegularExpression>
+#include <QSet>
+
+namespace
+{
+    //! The tags around the user written code, shared with the earlier versions of the generator.
+    const QString BLACK_BOX_DECL_START = QStringLiteral("-- ##KACTUS2_BLACK_BOX_DECLARATIONS_BEGIN##");
+    const QString BLACK_BOX_DECL_END = QStringLiteral("-- ##KACTUS2_BLACK_BOX_DECLARATIONS_END##");
+    const QString BLACK_BOX_ASSIGN_START = QStringLiteral("-- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_BEGIN##");
+    const QString BLACK_BOX_ASSIGN_END = QStringLiteral("-- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_END##");
+
+    const QString INDENT = QStringLiteral("    ");
+
+    //! The VHDL array types, which are given a range.
+    const QStringList VECTOR_TYPES = { QStringLiteral("bit_vector"), QStringLiteral("std_logic_vector"),
+        QStringLiteral("std_ulogic_vector"), QStringLiteral("signed"), QStringLiteral("unsigned") };
+
+    //! The Verilog net and variable types, which are written as the standard logic types.
+    const QStringList VERILOG_LOGIC_TYPES = { QStringLiteral("wire"), QStringLiteral("reg"),
+        QStringLiteral("logic"), QStringLiteral("bit"), QStringLiteral("uwire"), QStringLiteral("tri"),
+        QStringLiteral("tri0"), QStringLiteral("tri1"), QStringLiteral("triand"), QStringLiteral("trior"),
+        QStringLiteral("trireg"), QStringLiteral("wand"), QStringLiteral("wor"), QStringLiteral("supply0"),
+        QStringLiteral("supply1") };
+
+    /*!
+     *  Checks if the given type name is a VHDL type known to the generator.
+     */
+    bool isVhdlType(QString const& typeName)
+    {
+        for (unsigned int i = 0; i < VhdlGeneral::VHDL_TYPE_COUNT; ++i)
+        {
+            if (VhdlGeneral::VHDL_TYPES[i].compare(typeName, Qt::CaseInsensitive) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /*!
+     *  Finds the ports of a component to write, in sorted order.
+     */
+    QList<QSharedPointer<MetaPort> > portsToWrite(QSharedPointer<MetaComponent> component,
+        QSharedPointer<PortSorter> sorter)
+    {
+        QList<QSharedPointer<MetaPort> > ports;
+        for (QSharedPointer<Port> cPort : sorter->sortedPorts(component->getComponent()))
+        {
+            QSharedPointer<MetaPort> mPort = component->getPorts()->value(cPort->name());
+
+            if (mPort && mPort->isTransactional_ == false &&
+                cPort->getDirection() != DirectionTypes::DIRECTION_PHANTOM &&
+                cPort->getDirection() != DirectionTypes::DIRECTION_INVALID)
+            {
+                ports.append(mPort);
+            }
+        }
+
+        return ports;
+    }
+
+    /*!
+     *  Forms the comment introducing the ports of an interface, if the interface changes.
+     */
+    QString interfaceIntroduction(QSharedPointer<Component> component, QString const& portName,
+        QString& previousInterface)
+    {
+        QSharedPointer<QList<QSharedPointer<BusInterface> > > busInterfaces =
+            component->getInterfacesUsedByPort(portName);
+
+        QString interfaceName = QStringLiteral("none");
+        if (busInterfaces->size() == 1)
+        {
+            interfaceName = busInterfaces->first()->name();
+        }
+        else if (busInterfaces->isEmpty() == false)
+        {
+            interfaceName = QStringLiteral("several");
+        }
+
+        if (interfaceName == previousInterface)
+        {
+            return QString();
+        }
+
+        previousInterface = interfaceName;
+
+        if (interfaceName == QLatin1String("none"))
+        {
+            return QStringLiteral("-- These ports are not in any interface");
+        }
+        else if (interfaceName == QLatin1String("several"))
+        {
+            return QStringLiteral("-- These ports are contained in many interfaces");
+        }
+
+        return QStringLiteral("-- Interface: ") + interfaceName;
+    }
+
+    /*!
+     *  Writes a list of declarations or associations separated with the given separator.
+     */
+    void writeList(QTextStream& output, QStringList const& comments, QStringList const& items,
+        QString const& indent, QString const& separator)
+    {
+        for (int i = 0; i < items.size(); ++i)
+        {
+            if (comments.at(i).isEmpty() == false)
+            {
+                output << indent << comments.at(i) << Qt::endl;
+            }
+
+            output << indent << items.at(i);
+            if (i < items.size() - 1)
+            {
+                output << separator;
+            }
+            output << Qt::endl;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::write()
+//-----------------------------------------------------------------------------
+void VHDLDocument::write(QString const& outputDirectory)
+{
+    // Keep the user written code of the file being replaced.
+    userDeclarations_.clear();
+    userAssignments_.clear();
+
+    QFile existingFile(outputDirectory + QLatin1Char('/') + fileName_);
+    if (existingFile.open(QIODevice::ReadOnly))
+    {
+        QString existingCode = QString::fromUtf8(existingFile.readAll());
+        existingCode.remove(QLatin1Char('\r'));
+        selectUserCode(existingCode, userDeclarations_, userAssignments_);
+    }
+
+    QSharedPointer<MetaComponent> component = metaComponent_;
+    if (metaDesign_)
+    {
+        component = metaDesign_->getTopInstance();
+    }
+
+    fileContent_.clear();
+    QTextStream output(&fileContent_);
+
+    QString entityName = legalizeName(component->getModuleName());
+
+    writeHeader(output, QDateTime::currentDateTime());
+    writeLibraries(output, component);
+
+    output << "entity " << entityName << " is" << Qt::endl;
+    writeGenerics(output, component, INDENT);
+    writePorts(output, component, INDENT);
+    output << "end " << entityName << ";" << Qt::endl << Qt::endl;
+
+    output << "architecture " << architectureName_ << " of " << entityName << " is" << Qt::endl << Qt::endl;
+
+    if (metaDesign_)
+    {
+        writeSignals(output);
+        writeComponentDeclarations(output);
+    }
+
+    output << INDENT << "-- You can write VHDL code after this tag and it is saved through the generator." << Qt::endl;
+    output << INDENT << BLACK_BOX_DECL_START << Qt::endl;
+    output << userDeclarations_;
+    output << INDENT << BLACK_BOX_DECL_END << Qt::endl;
+    output << INDENT << "-- Do not write your code after this tag." << Qt::endl << Qt::endl;
+
+    output << "begin" << Qt::endl << Qt::endl;
+
+    output << INDENT << "-- You can write VHDL code after this tag and it is saved through the generator." << Qt::endl;
+    output << INDENT << BLACK_BOX_ASSIGN_START << Qt::endl;
+    output << userAssignments_;
+    output << INDENT << BLACK_BOX_ASSIGN_END << Qt::endl;
+    output << INDENT << "-- Do not write your code after this tag." << Qt::endl << Qt::endl;
+
+    if (metaDesign_)
+    {
+        writeAssignments(output);
+        writeInstances(output);
+    }
+
+    output << "end " << architectureName_ << ";" << Qt::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::getBodyHighlight()
+//-----------------------------------------------------------------------------
+void VHDLDocument::getBodyHighlight(int& begin, int& end) const
+{
+    begin = fileContent_.indexOf(BLACK_BOX_DECL_START);
+    end = fileContent_.indexOf(BLACK_BOX_ASSIGN_END);
+
+    if (begin == -1 || end == -1)
+    {
+        begin = -1;
+        end = -1;
+        return;
+    }
+
+    end += BLACK_BOX_ASSIGN_END.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::selectUserCode()
+//-----------------------------------------------------------------------------
+void VHDLDocument::selectUserCode(QString const& code, QString& declarations, QString& assignments)
+{
+    QString* target = nullptr;
+
+    for (QString const& line : code.split(QLatin1Char('\n')))
+    {
+        QString tag = line.trimmed();
+
+        if (tag == BLACK_BOX_DECL_START)
+        {
+            target = &declarations;
+        }
+        else if (tag == BLACK_BOX_ASSIGN_START)
+        {
+            target = &assignments;
+        }
+        else if (tag == BLACK_BOX_DECL_END || tag == BLACK_BOX_ASSIGN_END)
+        {
+            target = nullptr;
+        }
+        else if (target)
+        {
+            target->append(line);
+            target->append(QLatin1Char('\n'));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::legalizeName()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::legalizeName(QString const& name)
+{
+    static const QRegularExpression illegalCharacters(QStringLiteral("[^A-Za-z0-9_]+"));
+    static const QRegularExpression repeatedUnderscores(QStringLiteral("__+"));
+
+    QString legitName = name;
+    legitName.replace(illegalCharacters, QStringLiteral("_"));
+    legitName.replace(repeatedUnderscores, QStringLiteral("_"));
+
+    while (legitName.endsWith(QLatin1Char('_')))
+    {
+        legitName.chop(1);
+    }
+
+    if (legitName.isEmpty() == false && legitName.at(0).isLetter() == false)
+    {
+        legitName.prepend(QLatin1Char('x'));
+    }
+
+    return legitName;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::formatType()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::formatType(QString const& typeName, QPair<QString, QString> const& bounds)
+{
+    bool hasBounds = bounds.first.isEmpty() == false && bounds.second.isEmpty() == false;
+    bool isVector = hasBounds && bounds.first != bounds.second;
+
+    if (isVhdlType(typeName))
+    {
+        if (VECTOR_TYPES.contains(typeName.toLower()) && hasBounds)
+        {
+            return typeName + QLatin1Char('(') + formatRange(bounds) + QLatin1Char(')');
+        }
+
+        // Array types without bounds are unconstrained.
+        return typeName;
+    }
+
+    // Verilog and unknown types are written as the standard logic types.
+    if (isVector)
+    {
+        return QStringLiteral("std_logic_vector(") + formatRange(bounds) + QLatin1Char(')');
+    }
+
+    return QStringLiteral("std_logic");
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::formatValue()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::formatValue(QString const& value, QPair<QString, QString> const& bounds)
+{
+    static const QRegularExpression verilogLiteral(
+        QStringLiteral("^\\s*(\\d*)\\s*'[sS]?([bBoOdDhH])\\s*([0-9a-fA-FxXzZ?_]+)\\s*$"));
+    static const QRegularExpression fillLiteral(QStringLiteral("^\\s*'([01xXzZ])\\s*$"));
+    static const QRegularExpression decimalLiteral(QStringLiteral("^\\s*(\\d+)\\s*$"));
+
+    bool isScalar = bounds.first == bounds.second;
+
+    // Unsized fill literals e.g. '1 set every bit.
+    QRegularExpressionMatch match = fillLiteral.match(value);
+    if (match.hasMatch())
+    {
+        QString bit = QLatin1Char('\'') + match.captured(1).toUpper() + QLatin1Char('\'');
+        if (isScalar)
+        {
+            return bit;
+        }
+
+        return QStringLiteral("(others => ") + bit + QLatin1Char(')');
+    }
+
+    QString bits;
+
+    match = verilogLiteral.match(value);
+    if (match.hasMatch())
+    {
+        QChar baseLetter = match.captured(2).toLower().at(0);
+        QString digits = match.captured(3).remove(QLatin1Char('_'));
+
+        int bitsPerDigit = 0;
+        if (baseLetter == QLatin1Char('b'))
+        {
+            bitsPerDigit = 1;
+        }
+        else if (baseLetter == QLatin1Char('o'))
+        {
+            bitsPerDigit = 3;
+        }
+        else if (baseLetter == QLatin1Char('h'))
+        {
+            bitsPerDigit = 4;
+        }
+
+        if (bitsPerDigit == 0)
+        {
+            bool valueOk = false;
+            quint64 number = digits.toULongLong(&valueOk, 10);
+            if (valueOk == false)
+            {
+                return QString();
+            }
+
+            bits = QString::number(number, 2);
+        }
+        else
+        {
+            // Each digit of a binary, octal or hexadecimal literal is expanded to bits, so the value may be
+            // wider than 64 bits and contain unknown or high impedance digits.
+            for (QChar const& digit : digits)
+            {
+                QChar lowerDigit = digit.toLower();
+                if (lowerDigit == QLatin1Char('x'))
+                {
+                    bits.append(QString(bitsPerDigit, QLatin1Char('X')));
+                    continue;
+                }
+                else if (lowerDigit == QLatin1Char('z') || lowerDigit == QLatin1Char('?'))
+                {
+                    bits.append(QString(bitsPerDigit, QLatin1Char('Z')));
+                    continue;
+                }
+
+                bool digitOk = false;
+                int digitValue = QString(digit).toInt(&digitOk, 1 << bitsPerDigit);
+                if (digitOk == false)
+                {
+                    return QString();
+                }
+
+                bits.append(QString::number(digitValue, 2).rightJustified(bitsPerDigit, QLatin1Char('0')));
+            }
+        }
+    }
+    else
+    {
+        match = decimalLiteral.match(value);
+        if (match.hasMatch() == false)
+        {
+            // Expressions are written as such, unless they contain Verilog literals or macros.
+            if (value.contains(QLatin1Char('\'')) || value.contains(QLatin1Char('`')))
+            {
+                return QString();
+            }
+
+            return value;
+        }
+
+        bool valueOk = false;
+        quint64 number = match.captured(1).toULongLong(&valueOk);
+        if (valueOk == false)
+        {
+            return QString();
+        }
+
+        bits = QString::number(number, 2);
+    }
+
+    // Leading zeros do not affect the value.
+    int firstSignificant = 0;
+    while (firstSignificant < bits.size() - 1 && bits.at(firstSignificant) == QLatin1Char('0'))
+    {
+        ++firstSignificant;
+    }
+    QString significantBits = bits.mid(firstSignificant);
+
+    if (isScalar)
+    {
+        // A value wider than one bit cannot be assigned to a scalar.
+        if (significantBits.size() > 1)
+        {
+            return QString();
+        }
+
+        return QLatin1Char('\'') + significantBits + QLatin1Char('\'');
+    }
+
+    if (significantBits == QLatin1String("0"))
+    {
+        return QStringLiteral("(others => '0')");
+    }
+
+    bool leftOk = false;
+    bool rightOk = false;
+    qint64 left = bounds.first.toLongLong(&leftOk);
+    qint64 right = bounds.second.toLongLong(&rightOk);
+    if (leftOk == false || rightOk == false)
+    {
+        // The width of the bit string cannot be known.
+        return QString();
+    }
+
+    qint64 width = qAbs(left - right) + 1;
+
+    if (bits.size() > width)
+    {
+        bits = bits.right(width);
+    }
+    else
+    {
+        // Unknown and high impedance values are extended like in Verilog.
+        QChar fill = QLatin1Char('0');
+        if (bits.at(0) == QLatin1Char('X') || bits.at(0) == QLatin1Char('Z'))
+        {
+            fill = bits.at(0);
+        }
+
+        bits = bits.rightJustified(width, fill);
+    }
+
+    return QLatin1Char('"') + bits + QLatin1Char('"');
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::convertValue()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::convertValue(QString const& value, QPair<QString, QString> const& bounds,
+    QString const& target) const
+{
+    QString vhdlValue = formatValue(value, bounds);
+    if (vhdlValue.isEmpty() && messages_)
+    {
+        messages_->showError(QObject::tr("Value %1 of %2 in %3 cannot be written as VHDL and is omitted.").arg(
+            value, target, fileName_));
+    }
+
+    return vhdlValue;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::convertType()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::convertType(QString const& typeName, QPair<QString, QString> const& bounds,
+    QString const& target) const
+{
+    QString vhdlType = formatType(typeName, bounds);
+    if (messages_ && typeName.isEmpty() == false && isVhdlType(typeName) == false &&
+        VERILOG_LOGIC_TYPES.contains(typeName.toLower()) == false)
+    {
+        messages_->showError(QObject::tr("Type %1 of %2 in %3 is not supported in VHDL and is written as %4.").arg(
+            typeName, target, fileName_, vhdlType));
+    }
+
+    return vhdlType;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::writeHeader()
+//-----------------------------------------------------------------------------
+void VHDLDocument::writeHeader(QTextStream& output, QDateTime const& generationTime) const
+{
+    QStringList descriptionLines = description_.split(QLatin1Char('\n'));
+
+    output << "-------------------------------------------------------------------------------" << Qt::endl;
+    output << "-- File          : " << fileName_ << Qt::endl;
+    output << "-- Creation date : " << generationTime.date().toString("dd.MM.yyyy") << Qt::endl;
+    output << "-- Creation time : " << generationTime.time().toString("hh:mm:ss") << Qt::endl;
+    output << "-- Description   : " << descriptionLines.first() << Qt::endl;
+
+    for (int i = 1; i < descriptionLines.count(); i++)
+    {
+        output << "--                 " << descriptionLines.at(i) << Qt::endl;
+    }
+
+    output << "-- Created by    : " << author_ << Qt::endl;
+    output << "-- Tool : Kactus2 " << kactusVersion_ << Qt::endl;
+    output << "-- Plugin : VHDL generator " << generatorVersion_ << Qt::endl;
+    output << "-- This file was generated based on IP-XACT component " << componentVlnv_.toString() << Qt::endl;
+    output << "-- whose XML file is " << xmlPath_ << Qt::endl;
+    output << "-------------------------------------------------------------------------------" << Qt::endl;
+    output << Qt::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::writeLibraries()
+//-----------------------------------------------------------------------------
+void VHDLDocument::writeLibraries(QTextStream& output, QSharedPointer<MetaComponent> component) const
+{
+    QList<QSharedPointer<MetaComponent> > components({ component });
+    if (metaDesign_)
+    {
+        for (QSharedPointer<MetaInstance> const& instance : *metaDesign_->getInstances())
+        {
+            components.append(instance);
+        }
+    }
+
+    QStringList typeDefinitions({ QStringLiteral("IEEE.std_logic_1164.all") });
+    for (QSharedPointer<MetaComponent> const& mComponent : components)
+    {
+        for (QSharedPointer<MetaPort> const& mPort : *mComponent->getPorts())
+        {
+            QString definition = VhdlGeneral::getDefaultVhdlTypeDef(mPort->port_->getTypeName());
+            if (definition.isEmpty() == false && typeDefinitions.contains(definition) == false)
+            {
+                typeDefinitions.append(definition);
+            }
+        }
+    }
+
+    output << "library IEEE;" << Qt::endl;
+    for (QString const& definition : typeDefinitions)
+    {
+        output << "use " << definition << ";" << Qt::endl;
+    }
+
+    output << Qt::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::writeGenerics()
+//-----------------------------------------------------------------------------
+void VHDLDocument::writeGenerics(QTextStream& output, QSharedPointer<MetaComponent> component,
+    QString const& indent) const
+{
+    QStringList comments;
+    QStringList declarations;
+
+    for (QSharedPointer<Parameter> parameter : *component->getMetaParameters())
+    {
+        if (parameter->name().isEmpty() == false)
+        {
+            comments.append(QString());
+            declarations.append(genericDeclaration(parameter));
+        }
+    }
+
+    if (declarations.isEmpty())
+    {
+        return;
+    }
+
+    output << indent << "generic (" << Qt::endl;
+    writeList(output, comments, declarations, indent + INDENT, QStringLiteral(";"));
+    output << indent << ");" << Qt::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::writePorts()
+//-----------------------------------------------------------------------------
+void VHDLDocument::writePorts(QTextStream& output, QSharedPointer<MetaComponent> component,
+    QString const& indent) const
+{
+    QStringList comments;
+    QStringList declarations;
+    QString previousInterface;
+
+    for (QSharedPointer<MetaPort> const& mPort : portsToWrite(component, sorter_))
+    {
+        DirectionTypes::Direction direction = mPort->port_->getDirection();
+
+        QString declaration = legalizeName(mPort->port_->name()).leftJustified(20) + QStringLiteral(" : ") +
+            DirectionTypes::direction2Str(direction).leftJustified(5) +
+            convertType(mPort->port_->getTypeName(), mPort->vectorBounds_, mPort->port_->name());
+
+        if (direction == DirectionTypes::IN && mPort->defaultValue_.isEmpty() == false)
+        {
+            QString defaultValue = convertValue(mPort->defaultValue_, mPort->vectorBounds_, mPort->port_->name());
+            if (defaultValue.isEmpty() == false)
+            {
+                declaration.append(QStringLiteral(" := ") + defaultValue);
+            }
+        }
+
+        comments.append(interfaceIntroduction(component->getComponent(), mPort->port_->name(),
+            previousInterface));
+        declarations.append(declaration);
+    }
+
+    if (declarations.isEmpty())
+    {
+        return;
+    }
+
+    output << indent << "port (" << Qt::endl;
+    writeList(output, comments, declarations, indent + INDENT, QStringLiteral(";"));
+    output << indent << ");" << Qt::endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::writeSignals()
+//-----------------------------------------------------------------------------
+void VHDLDocument::writeSignals(QTextStream& output) const
+{
+    auto writeSignal = [&output](QString const& name, QString const& type)
+    {
+        output << INDENT << "signal " << name.leftJustified(20) << " : " << type << ";" << Qt::endl;
+    };
+
+    for (QSharedPointer<MetaInterconnection> const& mInterconnect : *metaDesign_->getInterconnections())
+    {
+        if (mInterconnect->wires_.isEmpty())
+        {
+            continue;
+        }
+
+        output << INDENT << "-- " << mInterconnect->name_ << " wires:" << Qt::endl;
+        for (QSharedPointer<MetaWire> const& wire : mInterconnect->wires_)
+        {
+            // Hierarchical inout ports are connected directly to the instance ports.
+            if (isConnectedToHierarchicalInout(wire) == false)
+            {
+                writeSignal(legalizeName(wire->name_), formatType(QString(), wire->bounds_));
+            }
+        }
+        output << Qt::endl;
+    }
+
+    if (metaDesign_->getAdHocWires()->isEmpty() == false)
+    {
+        output << INDENT << "-- Ad-hoc wires:" << Qt::endl;
+        for (QSharedPointer<MetaWire> const& wire : *metaDesign_->getAdHocWires())
+        {
+            if (isConnectedToHierarchicalInout(wire) == false)
+            {
+                writeSignal(legalizeName(wire->name_), formatType(QString(), wire->bounds_));
+            }
+        }
+        output << Qt::endl;
+    }
+
+    for (QSharedPointer<MetaInstance> const& instance : *metaDesign_->getInstances())
+    {
+        QString instanceName = instance->getComponentInstance()->getInstanceName();
+
+        bool headerWritten = false;
+        for (QSharedPointer<MetaPort> const& mPort : *instance->getPorts())
+        {
+            // Instance inout ports are connected directly to the wires or hierarchical ports.
+            if (mPort->isTransactional_ || mPort->upAssignments_.isEmpty() ||
+                mPort->port_->getDirection() == DirectionTypes::INOUT)
+            {
+                continue;
+            }
+
+            if (headerWritten == false)
+            {
+                output << INDENT << "-- " << instanceName << " port wires:" << Qt::endl;
+                headerWritten = true;
+            }
+
+            writeSignal(legalizeName(instanceName + QLatin1Char('_') + mPort->port_->name()),
+                convertType(mPort->port_->getTypeName(), mPort->vectorBounds_, mPort->port_->name()));
+        }
+
+        if (headerWritten)
+        {
+            output << Qt::endl;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::writeComponentDeclarations()
+//-----------------------------------------------------------------------------
+void VHDLDocument::writeComponentDeclarations(QTextStream& output) const
+{
+    QSet<QString> declaredComponents;
+
+    for (QSharedPointer<MetaInstance> const& instance : *metaDesign_->getInstances())
+    {
+        QString componentName = legalizeName(instance->getModuleName());
+        if (declaredComponents.contains(componentName))
+        {
+            continue;
+        }
+
+        declaredComponents.insert(componentName);
+
+        output << INDENT << "component " << componentName << Qt::endl;
+        writeGenerics(output, instance, INDENT.repeated(2));
+        writePorts(output, instance, INDENT.repeated(2));
+        output << INDENT << "end component;" << Qt::endl << Qt::endl;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::writeAssignments()
+//-----------------------------------------------------------------------------
+void VHDLDocument::writeAssignments(QTextStream& output) const
+{
+    QSharedPointer<MetaInstance> topInstance = metaDesign_->getTopInstance();
+
+    QStringList topAssignments;
+    for (QSharedPointer<MetaPort> const& mPort : *topInstance->getPorts())
+    {
+        if (mPort->isTransactional_)
+        {
+            continue;
+        }
+
+        DirectionTypes::Direction direction = mPort->port_->getDirection();
+        QString portName = legalizeName(mPort->port_->name());
+
+        if (mPort->downAssignments_.isEmpty())
+        {
+            if ((direction == DirectionTypes::OUT || direction == DirectionTypes::INOUT) &&
+                mPort->defaultValue_.isEmpty() == false)
+            {
+                QString defaultValue = convertValue(mPort->defaultValue_, mPort->vectorBounds_, portName);
+                if (defaultValue.isEmpty() == false)
+                {
+                    topAssignments.append(portName + QStringLiteral(" <= ") + defaultValue + QLatin1Char(';'));
+                }
+            }
+
+            continue;
+        }
+
+        for (QSharedPointer<MetaPortAssignment> const& assignment : mPort->downAssignments_)
+        {
+            // Hierarchical inout ports are connected directly, but may have a default value assignment.
+            if (direction != DirectionTypes::INOUT || assignment->wire_.isNull())
+            {
+                QString statement = assignmentForPort(portName, assignment, mPort, true);
+                if (statement.isEmpty() == false)
+                {
+                    topAssignments.append(statement);
+                }
+            }
+        }
+    }
+
+    if (topAssignments.isEmpty() == false)
+    {
+        output << INDENT << "-- Assignments for the ports of the encompassing component:" << Qt::endl;
+        for (QString const& statement : topAssignments)
+        {
+            output << INDENT << statement << Qt::endl;
+        }
+        output << Qt::endl;
+    }
+
+    for (QSharedPointer<MetaInstance> const& instance : *metaDesign_->getInstances())
+    {
+        QString instanceName = instance->getComponentInstance()->getInstanceName();
+
+        QStringList instanceAssignments;
+        for (QSharedPointer<MetaPort> const& mPort : *instance->getPorts())
+        {
+            if (mPort->isTransactional_ || mPort->port_->getDirection() == DirectionTypes::INOUT)
+            {
+                continue;
+            }
+
+            QString signalName = legalizeName(instanceName + QLatin1Char('_') + mPort->port_->name());
+            for (QSharedPointer<MetaPortAssignment> const& assignment : mPort->upAssignments_)
+            {
+                QString statement = assignmentForPort(signalName, assignment, mPort, false);
+                if (statement.isEmpty() == false)
+                {
+                    instanceAssignments.append(statement);
+                }
+            }
+        }
+
+        if (instanceAssignments.isEmpty() == false)
+        {
+            output << INDENT << "-- " << instanceName << " assignments:" << Qt::endl;
+            for (QString const& statement : instanceAssignments)
+            {
+                output << INDENT << statement << Qt::endl;
+            }
+            output << Qt::endl;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::writeInstances()
+//-----------------------------------------------------------------------------
+void VHDLDocument::writeInstances(QTextStream& output) const
+{
+    for (QSharedPointer<MetaInstance> const& instance : *metaDesign_->getInstances())
+    {
+        QSharedPointer<ComponentInstance> componentInstance = instance->getComponentInstance();
+
+        QString description = componentInstance->description();
+        if (description.isEmpty() == false)
+        {
+            for (QString const& line : description.split(QLatin1Char('\n')))
+            {
+                output << INDENT << "-- " << line << Qt::endl;
+            }
+        }
+        output << INDENT << "-- IP-XACT VLNV: " << instance->getComponent()->getVlnv().toString() << Qt::endl;
+
+        output << INDENT << legalizeName(componentInstance->getInstanceName()) << " : " <<
+            legalizeName(instance->getModuleName()) << Qt::endl;
+
+        // Only the generics of the component declaration may be mapped.
+        QSet<QString> genericNames;
+        for (QSharedPointer<Parameter> const& parameter : *instance->getMetaParameters())
+        {
+            genericNames.insert(parameter->name());
+        }
+
+        QStringList genericComments;
+        QStringList genericAssociations;
+        for (QSharedPointer<Parameter> const& parameter : *instance->getParameters())
+        {
+            // If the parameters are not user resolved nor generated, there cannot be any override by the design.
+            if ((parameter->getValueResolve() == QLatin1String("user") ||
+                parameter->getValueResolve() == QLatin1String("generated")) &&
+                genericNames.contains(parameter->name()))
+            {
+                genericComments.append(QString());
+                genericAssociations.append(parameter->name().leftJustified(20) + QStringLiteral(" => ") +
+                    parameter->getValue());
+            }
+        }
+
+        if (genericAssociations.isEmpty() == false)
+        {
+            output << INDENT.repeated(2) << "generic map (" << Qt::endl;
+            writeList(output, genericComments, genericAssociations, INDENT.repeated(3), QStringLiteral(","));
+            output << INDENT.repeated(2) << ")" << Qt::endl;
+        }
+
+        QStringList portComments;
+        QStringList portAssociations;
+        QString previousInterface;
+        for (QSharedPointer<MetaPort> const& mPort : portsToWrite(instance, sorter_))
+        {
+            portComments.append(interfaceIntroduction(instance->getComponent(), mPort->port_->name(),
+                previousInterface));
+            portAssociations.append(legalizeName(mPort->port_->name()).leftJustified(20) + QStringLiteral(" => ") +
+                actualForInstancePort(instance, mPort));
+        }
+
+        if (portAssociations.isEmpty() == false)
+        {
+            output << INDENT.repeated(2) << "port map (" << Qt::endl;
+            writeList(output, portComments, portAssociations, INDENT.repeated(3), QStringLiteral(","));
+            output << INDENT.repeated(2) << ")";
+        }
+
+        output << ";" << Qt::endl << Qt::endl;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::assignmentForPort()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::assignmentForPort(QString const& portWireName, QSharedPointer<MetaPortAssignment> assignment,
+    QSharedPointer<MetaPort> mPort, bool isHierarchical) const
+{
+    DirectionTypes::Direction direction = mPort->port_->getDirection();
+    bool isOutPort = (direction == DirectionTypes::OUT || direction == DirectionTypes::INOUT);
+    bool isInPort = (direction == DirectionTypes::IN || direction == DirectionTypes::INOUT);
+
+    bool assignToPort = (!isHierarchical && isInPort) || (isHierarchical && isOutPort);
+    bool assignToWire = (isHierarchical && isInPort) || (!isHierarchical && isOutPort);
+
+    QString logicalAssign;
+    if (assignment->wire_)
+    {
+        logicalAssign = slice(legalizeName(assignment->wire_->name_), assignment->logicalBounds_,
+            assignment->wire_->bounds_);
+    }
+    else if (assignToPort)
+    {
+        // If a default value is assigned to a physical port, it shall be used.
+        QString defaultValue = assignment->defaultValue_;
+        if (defaultValue.isEmpty())
+        {
+            defaultValue = mPort->defaultValue_;
+        }
+
+        if (defaultValue.isEmpty() == false)
+        {
+            QPair<QString, QString> assignedBounds = assignment->physicalBounds_;
+            if (assignedBounds.first.isEmpty())
+            {
+                assignedBounds = mPort->vectorBounds_;
+            }
+
+            logicalAssign = convertValue(defaultValue, assignedBounds, portWireName);
+        }
+    }
+
+    if (logicalAssign.isEmpty())
+    {
+        return QString();
+    }
+
+    QString physicalAssign = slice(portWireName, assignment->physicalBounds_, mPort->vectorBounds_);
+
+    QString invert;
+    if (assignment->invert_ && !isHierarchical)
+    {
+        invert = QStringLiteral("not ");
+    }
+
+    if (assignToPort)
+    {
+        return physicalAssign + QStringLiteral(" <= ") + invert + logicalAssign + QLatin1Char(';');
+    }
+    else if (assignToWire)
+    {
+        return logicalAssign + QStringLiteral(" <= ") + invert + physicalAssign + QLatin1Char(';');
+    }
+
+    return QString();
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::actualForInstancePort()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::actualForInstancePort(QSharedPointer<MetaInstance> instance,
+    QSharedPointer<MetaPort> mPort) const
+{
+    DirectionTypes::Direction direction = mPort->port_->getDirection();
+
+    // Use the default value of port, if no assignments exist.
+    if (mPort->upAssignments_.isEmpty())
+    {
+        if (direction == DirectionTypes::IN && mPort->defaultValue_.isEmpty() == false)
+        {
+            QString defaultValue = convertValue(mPort->defaultValue_, mPort->vectorBounds_,
+                instance->getComponentInstance()->getInstanceName() + QLatin1Char('.') + mPort->port_->name());
+            if (defaultValue.isEmpty() == false)
+            {
+                return defaultValue;
+            }
+        }
+
+        return QStringLiteral("open");
+    }
+
+    // In case of an inout port, connect it directly the first encountered wire or hierarchical port.
+    if (direction == DirectionTypes::INOUT)
+    {
+        for (QSharedPointer<MetaPortAssignment> const& assignment : mPort->upAssignments_)
+        {
+            QSharedPointer<MetaWire> wire = assignment->wire_;
+            if (wire.isNull())
+            {
+                continue;
+            }
+
+            if (isConnectedToHierarchicalInout(wire) == false)
+            {
+                return legalizeName(wire->name_);
+            }
+
+            for (QSharedPointer<MetaPort> const& hierarchicalPort : wire->hierPorts_)
+            {
+                for (QSharedPointer<MetaPortAssignment> const& hierarchicalAssignment :
+                    hierarchicalPort->downAssignments_)
+                {
+                    if (hierarchicalAssignment->wire_ == wire)
+                    {
+                        return slice(legalizeName(hierarchicalPort->port_->name()),
+                            hierarchicalAssignment->physicalBounds_, hierarchicalPort->vectorBounds_);
+                    }
+                }
+            }
+        }
+
+        return QStringLiteral("open");
+    }
+
+    return legalizeName(instance->getComponentInstance()->getInstanceName() + QLatin1Char('_') +
+        mPort->port_->name());
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::isConnectedToHierarchicalInout()
+//-----------------------------------------------------------------------------
+bool VHDLDocument::isConnectedToHierarchicalInout(QSharedPointer<MetaWire> wire)
+{
+    for (QSharedPointer<MetaPort> const& mPort : wire->hierPorts_)
+    {
+        if (mPort->port_->getDirection() == DirectionTypes::INOUT)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::slice()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::slice(QString const& name, QPair<QString, QString> const& slice,
+    QPair<QString, QString> const& bounds)
+{
+    if (slice == bounds || slice.first.isEmpty() || slice.second.isEmpty())
+    {
+        return name;
+    }
+
+    if (slice.first == slice.second)
+    {
+        // A single bit of a scalar is the scalar itself.
+        if (bounds.first == bounds.second)
+        {
+            return name;
+        }
+
+        return name + QLatin1Char('(') + slice.first + QLatin1Char(')');
+    }
+
+    return name + QLatin1Char('(') + formatRange(slice) + QLatin1Char(')');
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::formatRange()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::formatRange(QPair<QString, QString> const& bounds)
+{
+    bool leftOk = false;
+    bool rightOk = false;
+    qint64 left = bounds.first.toLongLong(&leftOk);
+    qint64 right = bounds.second.toLongLong(&rightOk);
+
+    if (leftOk && rightOk && left < right)
+    {
+        return bounds.first + QStringLiteral(" to ") + bounds.second;
+    }
+
+    return bounds.first + QStringLiteral(" downto ") + bounds.second;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLDocument::genericDeclaration()
+//-----------------------------------------------------------------------------
+QString VHDLDocument::genericDeclaration(QSharedPointer<Parameter> parameter) const
+{
+    QPair<QString, QString> bounds(parameter->getVectorLeft(), parameter->getVectorRight());
+
+    QString type = parameter->getAttribute(QStringLiteral("dataType"));
+    if (isVhdlType(type) == false)
+    {
+        QString ipxactType = parameter->getType();
+        if (ipxactType == QLatin1String("bit"))
+        {
+            type = QStringLiteral("std_logic");
+        }
+        else if (ipxactType == QLatin1String("real") || ipxactType == QLatin1String("shortreal"))
+        {
+            type = QStringLiteral("real");
+        }
+        else if (ipxactType == QLatin1String("string"))
+        {
+            type = QStringLiteral("string");
+        }
+        else
+        {
+            type = QStringLiteral("integer");
+        }
+    }
+
+    QString declaration = parameter->name().leftJustified(20) + QStringLiteral(" : ");
+
+    QString value = parameter->getValue();
+    if (type.compare(QLatin1String("string"), Qt::CaseInsensitive) == 0)
+    {
+        declaration.append(type);
+
+        if (value.isEmpty() == false && value.startsWith(QLatin1Char('"')) == false)
+        {
+            value = QLatin1Char('"') + value + QLatin1Char('"');
+        }
+    }
+    else
+    {
+        declaration.append(formatType(type, bounds));
+
+        if (type.startsWith(QLatin1String("std_"), Qt::CaseInsensitive))
+        {
+            value = convertValue(value, bounds, parameter->name());
+        }
+    }
+
+    if (value.isEmpty() == false)
+    {
+        declaration.append(QStringLiteral(" := ") + value);
+    }
+
+    return declaration;
+}
@@ -0,0 +1,244 @@
+//-----------------------------------------------------------------------------
+// File: VHDLDocument.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// VHDL document written from the elaborated HDL model.
+//-----------------------------------------------------------------------------
+
+#ifndef VHDLDOCUMENT_H
+#define VHDLDOCUMENT_H
+
+#include <Plugins/PluginSystem/GeneratorPlugin/OutputControl.h>
+
+#include <Plugins/common/HDLParser/HDLParserCommon.h>
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QDateTime>
+#include <QSharedPointer>
+#include <QString>
+#include <QTextStream>
+
+class MessageMediator;
+class MetaComponent;
+class MetaInstance;
+class Parameter;
+class PortSorter;
+
+//-----------------------------------------------------------------------------
+// VHDL document.
+//-----------------------------------------------------------------------------
+struct VHDLDocument : public GenerationOutput
+{
+    //! The VLNV of the component the document is written for.
+    VLNV componentVlnv_;
+
+    //! The path to the IP-XACT file of the component.
+    QString xmlPath_;
+
+    //! The user running the generation.
+    QString author_;
+
+    //! The description of the component.
+    QString description_;
+
+    //! Version of Kactus2.
+    QString kactusVersion_;
+
+    //! Version of the generator.
+    QString generatorVersion_;
+
+    //! The name of the written architecture.
+    QString architectureName_;
+
+    //! The user written declarations kept from the existing file.
+    QString userDeclarations_;
+
+    //! The user written assignments kept from the existing file.
+    QString userAssignments_;
+
+    //! Sorter for the ports of the entity and the instances.
+    QSharedPointer<PortSorter> sorter_;
+
+    //! Receives the errors of values that cannot be written as VHDL.
+    MessageMediator* messages_ = nullptr;
+
+    //! The constructor.
+    VHDLDocument() = default;
+
+    //! The destructor.
+    virtual ~VHDLDocument() = default;
+
+    /*!
+     *  Writes the content.
+     *
+     *    @param [in] outputDirectory         The possible output directory.
+     */
+    virtual void write(QString const& outputDirectory) override;
+
+    /*!
+     *  Finds position for body text highlight in document, if any exists.
+     *
+     *    @param [out] begin                  The position where the highlight begins, if successful.
+     *    @param [out] end                    The position where the highlight ends, if successful.
+     */
+    virtual void getBodyHighlight(int& begin, int& end) const override;
+
+    /*!
+     *  Finds the user written declarations and assignments in existing VHDL code.
+     *
+     *    @param [in] code                    The code that will be inspected.
+     *    @param [out] declarations           The found declarations.
+     *    @param [out] assignments            The found assignments.
+     */
+    static void selectUserCode(QString const& code, QString& declarations, QString& assignments);
+
+    /*!
+     *  Makes a legal VHDL identifier of the given name.
+     *
+     *    @param [in] name    The name to legalize.
+     *
+     *    @return The legal identifier.
+     */
+    static QString legalizeName(QString const& name);
+
+    /*!
+     *  Forms the VHDL type of a port or a signal with the given bounds. VHDL array types without bounds are
+     *  left unconstrained.
+     *
+     *    @param [in] typeName    The type name of the port, or empty for a signal.
+     *    @param [in] bounds      The vector bounds.
+     *
+     *    @return The type with its range.
+     */
+    static QString formatType(QString const& typeName, QPair<QString, QString> const& bounds);
+
+    /*!
+     *  Forms a VHDL literal of a value assigned to an element with the given bounds. Verilog literals are
+     *  converted to VHDL literals and other expressions are kept as such.
+     *
+     *    @param [in] value       The value as formatted in the elaborated model.
+     *    @param [in] bounds      The vector bounds of the assigned element.
+     *
+     *    @return The value as VHDL, or empty if the value cannot be written as VHDL.
+     */
+    static QString formatValue(QString const& value, QPair<QString, QString> const& bounds);
+
+private:
+
+    //! Writes the header comment of the file.
+    void writeHeader(QTextStream& output, QDateTime const& generationTime) const;
+
+    //! Writes the library clauses of the file.
+    void writeLibraries(QTextStream& output, QSharedPointer<MetaComponent> component) const;
+
+    //! Writes the generics of the given component, in entity or component declaration.
+    void writeGenerics(QTextStream& output, QSharedPointer<MetaComponent> component, QString const& indent) const;
+
+    //! Writes the ports of the given component, in entity or component declaration.
+    void writePorts(QTextStream& output, QSharedPointer<MetaComponent> component, QString const& indent) const;
+
+    //! Writes the signal declarations of the design.
+    void writeSignals(QTextStream& output) const;
+
+    //! Writes the component declarations of the design instances.
+    void writeComponentDeclarations(QTextStream& output) const;
+
+    //! Writes the signal assignments of the design.
+    void writeAssignments(QTextStream& output) const;
+
+    //! Writes the component instances of the design.
+    void writeInstances(QTextStream& output) const;
+
+    /*!
+     *  Forms a VHDL literal of a value and reports the values that cannot be written as VHDL.
+     *
+     *    @param [in] value       The value as formatted in the elaborated model.
+     *    @param [in] bounds      The vector bounds of the assigned element.
+     *    @param [in] target      The name of the element the value is assigned to.
+     *
+     *    @return The value as VHDL, or empty if the value cannot be written as VHDL.
+     */
+    QString convertValue(QString const& value, QPair<QString, QString> const& bounds,
+        QString const& target) const;
+
+    /*!
+     *  Forms the VHDL type of a port and reports the types that are neither VHDL types nor Verilog logic types.
+     *
+     *    @param [in] typeName    The type name of the port.
+     *    @param [in] bounds      The vector bounds of the port.
+     *    @param [in] target      The name of the port.
+     *
+     *    @return The type with its range.
+     */
+    QString convertType(QString const& typeName, QPair<QString, QString> const& bounds,
+        QString const& target) const;
+
+    /*!
+     *  Creates a signal assignment for a port assignment.
+     *
+     *    @param [in] portWireName    The name of the port or the signal of an instance port.
+     *    @param [in] assignment      The assignment of the port.
+     *    @param [in] mPort           The assigned port.
+     *    @param [in] isHierarchical  True for the ports of the top component.
+     *
+     *    @return The assignment statement, or empty if none is needed.
+     */
+    QString assignmentForPort(QString const& portWireName, QSharedPointer<MetaPortAssignment> assignment,
+        QSharedPointer<MetaPort> mPort, bool isHierarchical) const;
+
+    /*!
+     *  Finds the actual of an instance port in the port map.
+     *
+     *    @param [in] instance    The instance containing the port.
+     *    @param [in] mPort       The instance port.
+     *
+     *    @return The connected signal, port or value.
+     */
+    QString actualForInstancePort(QSharedPointer<MetaInstance> instance, QSharedPointer<MetaPort> mPort) const;
+
+    /*!
+     *  Checks if a wire is connected to a hierarchical inout port, which replaces the wire.
+     *
+     *    @param [in] wire    The wire to check.
+     *
+     *    @return True, if the wire is connected to a hierarchical inout port.
+     */
+    static bool isConnectedToHierarchicalInout(QSharedPointer<MetaWire> wire);
+
+    /*!
+     *  Forms a slice of a signal or a port.
+     *
+     *    @param [in] name        The name of the sliced element.
+     *    @param [in] slice       The bounds of the slice.
+     *    @param [in] bounds      The bounds of the whole element.
+     *
+     *    @return The sliced name.
+     */
+    static QString slice(QString const& name, QPair<QString, QString> const& slice,
+        QPair<QString, QString> const& bounds);
+
+    /*!
+     *  Forms the VHDL range of the given bounds.
+     *
+     *    @param [in] bounds      The bounds.
+     *
+     *    @return The range, e.g. "7 downto 0".
+     */
+    static QString formatRange(QPair<QString, QString> const& bounds);
+
+    /*!
+     *  Forms the declaration of a generic.
+     *
+     *    @param [in] parameter   The parameter declared as the generic.
+     *
+     *    @return The generic declaration.
+     */
+    QString genericDeclaration(QSharedPointer<Parameter> parameter) const;
+};
+
+#endif // VHDLDOCUMENT_H
@@ -0,0 +1,133 @@
+//-----------------------------------------------------------------------------
+// File: VHDLWriterFactory.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Creates VHDL documents from the elaborated HDL model.
+//-----------------------------------------------------------------------------
+
+#include "VHDLWriterFactory.h"
+
+#include <KactusAPI/include/LibraryInterface.h>
+#include <KactusAPI/include/MessageMediator.h>
+
+#include <Plugins/common/HDLParser/MetaDesign.h>
+#include <Plugins/common/PortSorter/InterfaceDirectionNameSorter.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/View.h>
+
+#include <QSettings>
+
+//-----------------------------------------------------------------------------
+// Function: VHDLWriterFactory::VHDLWriterFactory()
+//-----------------------------------------------------------------------------
+VHDLWriterFactory::VHDLWriterFactory(LibraryInterface* library,
+    MessageMediator* messages, GenerationSettings* settings,
+    QString const& kactusVersion, QString const& generatorVersion) :
+    library_(library),
+    messages_(messages),
+    settings_(settings),
+    generatorVersion_(generatorVersion),
+    kactusVersion_(kactusVersion),
+    sorter_(new InterfaceDirectionNameSorter())
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLWriterFactory::prepareComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<GenerationOutput> VHDLWriterFactory::prepareComponent(QString const& /*outputPath*/,
+    QSharedPointer<MetaComponent> component)
+{
+    // The user code of an existing file is read when the document is written.
+    QSharedPointer<VHDLDocument> document = createDocument(component);
+    document->metaComponent_ = component;
+
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLWriterFactory::prepareDesign()
+//-----------------------------------------------------------------------------
+QList<QSharedPointer<GenerationOutput> > VHDLWriterFactory::prepareDesign(QList<QSharedPointer<MetaDesign> >& designs)
+{
+    QList<QSharedPointer<GenerationOutput> > retval;
+
+    for (QSharedPointer<MetaDesign> const& mDesign : designs)
+    {
+        QSharedPointer<VHDLDocument> document = createDocument(mDesign->getTopInstance());
+        document->metaDesign_ = mDesign;
+
+        retval.append(document);
+    }
+
+    return retval;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLWriterFactory::getLanguage()
+//-----------------------------------------------------------------------------
+QString VHDLWriterFactory::getLanguage() const
+{
+    return QStringLiteral("VHDL");
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLWriterFactory::getFileSuffix()
+//-----------------------------------------------------------------------------
+QString VHDLWriterFactory::getFileSuffix() const
+{
+    return QStringLiteral("vhd");
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLWriterFactory::getSaveToFileset()
+//-----------------------------------------------------------------------------
+bool VHDLWriterFactory::getSaveToFileset() const
+{
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLWriterFactory::getGroupIdentifier()
+//-----------------------------------------------------------------------------
+QString VHDLWriterFactory::getGroupIdentifier() const
+{
+    return QStringLiteral("generatedFiles");
+}
+
+//-----------------------------------------------------------------------------
+// Function: VHDLWriterFactory::createDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<VHDLDocument> VHDLWriterFactory::createDocument(QSharedPointer<MetaComponent> component) const
+{
+    QSharedPointer<VHDLDocument> document(new VHDLDocument());
+
+    VLNV componentVlnv = component->getComponent()->getVlnv();
+
+    QSettings settings;
+    document->author_ = settings.value("General/Username").toString();
+
+    document->fileName_ = component->getModuleName() + QStringLiteral(".vhd");
+    document->vlnv_ = componentVlnv.toString();
+    document->componentVlnv_ = componentVlnv;
+    document->xmlPath_ = library_->getPath(componentVlnv);
+    document->description_ = component->getComponent()->getDescription();
+    document->kactusVersion_ = kactusVersion_;
+    document->generatorVersion_ = generatorVersion_;
+    document->sorter_ = sorter_;
+    document->messages_ = messages_;
+
+    document->architectureName_ = QStringLiteral("structural");
+    if (component->getActiveView() && component->getActiveView()->name().isEmpty() == false)
+    {
+        document->architectureName_ = VHDLDocument::legalizeName(component->getActiveView()->name());
+    }
+
+    return document;
+}
@@ -0,0 +1,124 @@
+//-----------------------------------------------------------------------------
+// File: VHDLWriterFactory.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Creates VHDL documents from the elaborated HDL model.
+//-----------------------------------------------------------------------------
+
+#ifndef VHDLWRITERFACTORY_H
+#define VHDLWRITERFACTORY_H
+
+#include "VHDLDocument.h"
+
+#include <Plugins/PluginSystem/GeneratorPlugin/IWriterFactory.h>
+
+struct GenerationSettings;
+class MessageMediator;
+
+//-----------------------------------------------------------------------------
+// VHDL file generator.
+//-----------------------------------------------------------------------------
+class VHDLWriterFactory : public IWriterFactory
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] library                 The component library.
+     *    @param [in] messages                For message output.
+     *    @param [in] settings                Points to the settings to be used within the generation.
+     *    @param [in] kactusVersion           The version of the current Kactus build.
+     *    @param [in] generatorVersion        The current version of the generator.
+     */
+    VHDLWriterFactory(LibraryInterface* library,
+        MessageMediator* messages, GenerationSettings* settings,
+        QString const& kactusVersion, QString const& generatorVersion);
+
+    //! The destructor.
+    virtual ~VHDLWriterFactory() = default;
+
+    // Disable copying.
+    VHDLWriterFactory(VHDLWriterFactory const& rhs) = delete;
+    VHDLWriterFactory& operator=(VHDLWriterFactory const& rhs) = delete;
+
+    /*!
+     *  Creates a document for the given formatted HDL component.
+     *
+     *    @param [in] outputPath          The path to the output file.
+     *    @param [in] component           The component which is needs writing.
+     *
+     *    @return The document. Will be null, if could not be created.
+     */
+    virtual QSharedPointer<GenerationOutput> prepareComponent(QString const& outputPath,
+        QSharedPointer<MetaComponent> component) override final;
+
+    /*!
+     *  Creates documents for the given meta designs.
+     *
+     *    @param [in] designs             The designs that will yield documents.
+     *
+     *    @return The documents.
+     */
+    virtual QList<QSharedPointer<GenerationOutput> > prepareDesign(QList<QSharedPointer<MetaDesign> >& designs)
+        override final;
+
+    /*!
+     *  Returns the language of the factory.
+     */
+    virtual QString getLanguage() const override final;
+
+    /*!
+     *  Returns the file suffix of the produced files without the leading dot.
+     */
+    virtual QString getFileSuffix() const override final;
+
+    /*!
+     *  Returns true, if it is desirable to save the output to file set by default.
+     */
+    virtual bool getSaveToFileset() const override final;
+
+    /*!
+     *  Returns the group identifier suitable for the produced files.
+     */
+    virtual QString getGroupIdentifier() const override final;
+
+private:
+
+    /*!
+     *  Creates a document for the given component.
+     *
+     *    @param [in] component       The component, which entity will be written.
+     *
+     *    @return The document with its header information.
+     */
+    QSharedPointer<VHDLDocument> createDocument(QSharedPointer<MetaComponent> component) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The component library.
+    LibraryInterface* library_;
+
+    //! The messages.
+    MessageMediator* messages_;
+
+    //! Points to the settings to be used within the generation.
+    GenerationSettings* settings_;
+
+    //! Version of the generator.
+    QString generatorVersion_;
+
+    //! Version of Kactus2.
+    QString kactusVersion_;
+
+    //! Sorter for component ports.
+    QSharedPointer<PortSorter> sorter_;
+};
+
+#endif // VHDLWRITERFACTORY_H
@@ -13,6 +13,8 @@
 
 #include "VHDLSyntax.h"
 
+#include <Plugins/common/HDLLexer.h>
+
 #include <KactusAPI/include/KactusColors.h>
 
 #include <IPXACTmodels/Component/Component.h>
@@ -23,20 +25,8 @@
 
 namespace
 {
-    //! Generics are declared inside entity by GENERIC ( <generic_declarations> );
-    const QRegularExpression GENERICS_BEGIN_EXP = QRegularExpression("(GENERIC)\\s*[(]", 
-        QRegularExpression::CaseInsensitiveOption);    
-
-    const QRegularExpression GENERICS_END_EXP = QRegularExpression("[)]\\s*[;](?=(?:(\\s*" + VHDLSyntax::COMMENT +
-        ")\\s*)*\\s*(END|BEGIN|PORT|GENERIC))", QRegularExpression::CaseInsensitiveOption);   
-
-    const QString GENERIC_TYPE = "(\\w+)(?:\\s+range\\s+\\d+\\s+to\\s+\\d+)?";
-
-    //! Generic declaration is <generic_names> : <type> [<default>] [pragma]; [description]
-    const QRegularExpression GENERIC_EXP = QRegularExpression(
-        "(" + VHDLSyntax::NAMES + ")\\s*[:]\\s*" + GENERIC_TYPE + "(?:\\s*" + VHDLSyntax::DEFAULT + ")?" +
-        "(?:\\s*" + VHDLSyntax::PRAGMA + ")?(?:" + VHDLSyntax::DECLARATION_END + ")", 
-        QRegularExpression::CaseInsensitiveOption);
+    //! Pragmas are not used as generic descriptions.
+    const QRegularExpression PRAGMA_EXP("^" + VHDLSyntax::PRAGMA, QRegularExpression::CaseInsensitiveOption);
 }
 
 //-----------------------------------------------------------------------------
@@ -51,19 +41,22 @@ VHDLGenericParser::VHDLGenericParser(QObject* parent): QObject(parent), highligh
 // Function: VHDLGenericParser::import()
 //-----------------------------------------------------------------------------
 void VHDLGenericParser::import(QString const& input, QSharedPointer<Component> targetComponent,
-    QSharedPointer<ComponentInstantiation> targetComponentInstantiation)
+    QSharedPointer<ComponentInstantiation> targetComponentInstantiation, int inputPosition)
 {
     foreach (QSharedPointer<ModuleParameter> modelParameter, *targetComponentInstantiation->getModuleParameters())
     {
         modelParameter->setAttribute("kactus2:import", "no");
     }
 
-    foreach(QString const& declaration, findGenericDeclarations(input))
+    HDLLexer lexer(input, HDLLexer::Language::VHDL);
+
+    for (GenericDeclaration const& declaration : findGenericDeclarations(lexer))
     {
         createModelParameterFromDeclaration(declaration, targetComponentInstantiation);
-        if (highlighter_)
+        if (highlighter_ && inputPosition != -1)
         {
-            highlighter_->applyHighlight(declaration, KactusColors::Importer::MODELPARAMETER, input);
+            highlighter_->applyHighlight(inputPosition + declaration.begin, inputPosition + declaration.end,
+                KactusColors::Importer::MODELPARAMETER);
         }
     }
 
@@ -89,95 +82,171 @@ void VHDLGenericParser::setHighlighter(Highlighter* highlighter)
 //-----------------------------------------------------------------------------
 // Function: VHDLGenericParser::findGenericDeclarations()
 //-----------------------------------------------------------------------------
-QStringList VHDLGenericParser::findGenericDeclarations(QString const& input) const
+QVector<VHDLGenericParser::GenericDeclaration> VHDLGenericParser::findGenericDeclarations(
+    HDLLexer const& lexer) const
 {
-    QString genericSection = findGenericsSection(input);
-    QString sectionWithoutCommentLines = removeCommentLines(genericSection);
+    QVector<GenericDeclaration> genericDeclarations;
+
+    int sectionBegin = findGenericsSection(lexer);
+    if (sectionBegin == -1)
+    {
+        return genericDeclarations;
+    }
 
-    return genericDeclarationsIn(sectionWithoutCommentLines);
+    // Declarations are separated by semicolons.
+    int sectionEnd = lexer.matching(sectionBegin);
+    int declarationBegin = lexer.next(sectionBegin);
+    for (int i = declarationBegin; i <= sectionEnd; i = lexer.next(i))
+    {
+        if (i == sectionEnd || lexer.isOperator(i, QStringLiteral(";")))
+        {
+            GenericDeclaration declaration;
+            if (declarationBegin < i && parseDeclaration(lexer, declarationBegin, lexer.previous(i), declaration))
+            {
+                genericDeclarations.append(declaration);
+            }
+
+            declarationBegin = lexer.next(i);
+        }
+        else if (lexer.matching(i) > i)
+        {
+            i = lexer.matching(i);
+        }
+    }
+
+    return genericDeclarations;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VHDLGenericParser::genericsSection()
+// Function: VHDLGenericParser::findGenericsSection()
 //-----------------------------------------------------------------------------
-QString VHDLGenericParser::findGenericsSection(QString const &input) const
+int VHDLGenericParser::findGenericsSection(HDLLexer const& lexer) const
 {
-    int entityBegin = input.indexOf(VHDLSyntax::ENTITY_BEGIN_EXP);
-    int entityEnd = input.indexOf(VHDLSyntax::ENTITY_END_EXP, entityBegin);
-
-    int genericsBeginIndex = GENERICS_BEGIN_EXP.match(input).capturedEnd(); 
+    // Entity declaration is ENTITY <name> IS ... END [ENTITY] [<name>];
+    int entityBegin = 0;
+    while (entityBegin < lexer.count() && (lexer.isWord(entityBegin, QStringLiteral("entity")) == false ||
+        lexer.isWord(lexer.next(lexer.next(entityBegin)), QStringLiteral("is")) == false ||
+        lexer.token(lexer.next(entityBegin)).type != HDLLexer::TokenType::Identifier))
+    {
+        ++entityBegin;
+    }
 
-    if (genericsBeginIndex > entityEnd)
+    if (entityBegin == lexer.count())
     {
-        return QString();
+        return -1;
     }
 
-    int genericsEndIndex = input.indexOf(GENERICS_END_EXP, genericsBeginIndex);
+    for (int i = lexer.next(lexer.next(lexer.next(entityBegin))); i < lexer.count() &&
+        lexer.isWord(i, QStringLiteral("end")) == false; i = lexer.next(i))
+    {
+        int genericsBegin = lexer.next(i);
+        if (lexer.isWord(i, QStringLiteral("generic")) && lexer.isOperator(genericsBegin, QStringLiteral("(")) &&
+            lexer.matching(genericsBegin) != -1)
+        {
+            return genericsBegin;
+        }
+        else if (lexer.matching(i) > i)
+        {
+            i = lexer.matching(i);
+        }
+    }
 
-    return input.mid(genericsBeginIndex, genericsEndIndex - genericsBeginIndex);
+    return -1;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VHDLGenericParser::removeCommentLines()
+// Function: VHDLGenericParser::parseDeclaration()
 //-----------------------------------------------------------------------------
-QString VHDLGenericParser::removeCommentLines(QString section) const
+bool VHDLGenericParser::parseDeclaration(HDLLexer const& lexer, int first, int last,
+    GenericDeclaration& declaration) const
 {
-    QRegularExpression commentLine("^" + VHDLSyntax::SPACE + VHDLSyntax::COMMENT_LINE_EXP + "|" +
-        VHDLSyntax::ENDLINE + VHDLSyntax::SPACE + VHDLSyntax::COMMENT_LINE_EXP);
+    // Generic declaration is [constant] <generic_names> : <type> [<range>] [<default>] [pragma]; [description]
+    int index = first;
+    if (lexer.isWord(index, QStringLiteral("constant")))
+    {
+        index = lexer.next(index);
+    }
 
-    return section.remove(commentLine);
-}
+    while (index <= last && lexer.token(index).type == HDLLexer::TokenType::Identifier)
+    {
+        declaration.names.append(lexer.text(index).toString());
 
-//-----------------------------------------------------------------------------
-// Function: VHDLGenericParser::genericDeclarationsIn()
-//-----------------------------------------------------------------------------
-QStringList VHDLGenericParser::genericDeclarationsIn(QString const& sectionWithoutCommentLines) const
-{
-    QStringList genericDeclarations;
+        index = lexer.next(index);
+        if (lexer.isOperator(index, QStringLiteral(",")))
+        {
+            index = lexer.next(index);
+        }
+        else
+        {
+            break;
+        }
+    }
 
-    QRegularExpressionMatchIterator i = GENERIC_EXP.globalMatch(sectionWithoutCommentLines);
-    while(i.hasNext())
-    {    
-        genericDeclarations.append(i.next().captured());
+    int typeIndex = lexer.next(index);
+    if (declaration.names.isEmpty() || lexer.isOperator(index, QStringLiteral(":")) == false ||
+        typeIndex > last || lexer.token(typeIndex).type != HDLLexer::TokenType::Identifier)
+    {
+        return false;
     }
 
-    return genericDeclarations;
+    declaration.dataType = lexer.text(typeIndex).toString();
+
+    // Skip the range constraint of the type.
+    index = lexer.next(typeIndex);
+    while (index <= last && lexer.isOperator(index, QStringLiteral(":=")) == false)
+    {
+        index = lexer.next(qMax(index, lexer.matching(index)));
+    }
+
+    if (index < last)
+    {
+        declaration.defaultValue = lexer.simplifiedText(lexer.next(index), last);
+    }
+
+    // The description is a comment on the same line after the declaration or its ending semicolon.
+    int descriptionIndex = last + 1;
+    if (lexer.isOperator(descriptionIndex, QStringLiteral(";")))
+    {
+        ++descriptionIndex;
+    }
+
+    declaration.begin = lexer.token(first).position;
+    declaration.end = lexer.token(last).end();
+
+    if (descriptionIndex < lexer.count() && lexer.token(descriptionIndex).type == HDLLexer::TokenType::Comment &&
+        lexer.onSameLine(declaration.end, lexer.token(descriptionIndex).position) &&
+        PRAGMA_EXP.match(lexer.text(descriptionIndex).toString()).hasMatch() == false)
+    {
+        declaration.description = lexer.commentText(descriptionIndex);
+        declaration.end = lexer.token(descriptionIndex).end();
+    }
+
+    return true;
 }
 
 //-----------------------------------------------------------------------------
 // Function: VHDLGenericParser::createModelParameterFromDeclaration()
 //-----------------------------------------------------------------------------
-void VHDLGenericParser::createModelParameterFromDeclaration(QString const& declaration, 
+void VHDLGenericParser::createModelParameterFromDeclaration(GenericDeclaration const& declaration, 
     QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const
 {
-    QRegularExpressionMatch matchedDeclaration = GENERIC_EXP.match(declaration);
-
-    QStringList genericNames = matchedDeclaration.captured(1).split(QRegularExpression("\\s*[,]\\s*"),
-        Qt::SkipEmptyParts);
-    QString dataType = matchedDeclaration.captured(2);
+    QString const& dataType = declaration.dataType;
     QString type = findMatchingType(dataType);
-    QString defaultValue = matchedDeclaration.captured(3);
-
-    QString description = matchedDeclaration.captured(5).trimmed();
-    if (description.isEmpty())
-    {
-        description = matchedDeclaration.captured(6).trimmed();
-    }
 
-    for (QString const& name : genericNames)
+    for (QString const& name : declaration.names)
     {   
-        QSharedPointer<ModuleParameter> parameter = findModuleParameter(name.trimmed(), targetComponentInstantiation);
+        QSharedPointer<ModuleParameter> parameter = findModuleParameter(name, targetComponentInstantiation);
         if (parameter.isNull())
         {
             parameter = QSharedPointer<ModuleParameter>(new ModuleParameter());
             targetComponentInstantiation->getModuleParameters()->append(parameter);
         }
 
-        parameter->setName(name.trimmed());
+        parameter->setName(name);
         parameter->setDataType(dataType);
         parameter->setType(type);
-        parameter->setDescription(description);
-        parameter->setValue(defaultValue);
+        parameter->setDescription(declaration.description);
+        parameter->setValue(declaration.defaultValue);
         parameter->setUsageType("nontyped");
         parameter->setAttribute("kactus2:import", "");
     } 
@@ -16,10 +16,13 @@
 
 #include <QSharedPointer>
 #include <QString>
+#include <QStringList>
+#include <QVector>
 
 #include <IPXACTmodels/Component/ComponentInstantiation.h>
 
 class Component;
+class HDLLexer;
 class ModuleParameter;
 class ComponentInstantiation;
 
@@ -43,9 +46,10 @@ public:
      *    @param [in] input                           The input text to parse.
      *    @param [in/out] targetComponent             The component to add the parameters to.
      *    @param [in] targetComponentInstantiation    The component instantiation to add the module parameters to.
+     *    @param [in] inputPosition                   The position of the input in the highlighted text.
      */
     void import(QString const& input, QSharedPointer<Component> targetComponent,
-        QSharedPointer<ComponentInstantiation> targetComponentInstantiation);
+        QSharedPointer<ComponentInstantiation> targetComponentInstantiation, int inputPosition = 0);
 
     /*!
      *  Sets the given highlighter to be used by the generic parser.
@@ -60,42 +64,57 @@ private:
 	VHDLGenericParser(VHDLGenericParser const& rhs);
 	VHDLGenericParser& operator=(VHDLGenericParser const& rhs);
 
+    //! A generic declaration found in the input.
+    struct GenericDeclaration
+    {
+        //! The names of the generics in the declaration.
+        QStringList names;
+
+        //! The data type of the generics.
+        QString dataType;
+
+        //! The default value of the generics.
+        QString defaultValue;
+
+        //! The description from a comment tailing the declaration.
+        QString description;
+
+        //! The position of the declaration in the input.
+        int begin = 0;
+
+        //! The position after the declaration and its tailing comment in the input.
+        int end = 0;
+    };
+
     /*!
-     *  Finds all generic declarations from input.
+     *  Finds all generic declarations from the tokenized input.
      *
-     *    @param [in] input   The input to search for generic declarations.
+     *    @param [in] lexer   The tokenized input to search for generic declarations.
      *
      *    @return Found generic declarations.
      */
-    QStringList findGenericDeclarations(QString const& input) const;
+    QVector<GenericDeclaration> findGenericDeclarations(HDLLexer const& lexer) const;
 
     /*!
-     *  Finds the section defining the generics of an entity.
+     *  Finds the generic clause of the first entity in the tokenized input.
      *
-     *    @param [in] input   The input to search for generic section.
+     *    @param [in] lexer   The tokenized input to search for the generic clause.
      *
-     *    @return The sections containing all generics in entity.
+     *    @return The token index of the opening parenthesis of the generic clause, or -1 if not found.
      */
-    QString findGenericsSection(QString const& input) const;
+    int findGenericsSection(HDLLexer const& lexer) const;
 
     /*!
-     *  Removes all comment lines from a given input.
-     *
-     *    @param [in] input   The input to remove comments from.
-     *
-     *    @return The input without comment lines.
-     */
-    QString removeCommentLines(QString section) const;
-    
-    /*!
-     *  Finds all generic declarations from a generics section without comment lines.
+     *  Parses a generic declaration from the given tokens.
      *
-     *    @param [in] sectionWithoutCommentLines   The section of the VHDL containing the generics in entity
-     *                                               without comment lines.
+     *    @param [in] lexer           The tokenized input.
+     *    @param [in] first           The index of the first token in the declaration.
+     *    @param [in] last            The index of the last token in the declaration, excluding the semicolon.
+     *    @param [out] declaration    The parsed declaration.
      *
-     *    @return The VHDL generic declarations.
+     *    @return True, if the tokens are a valid generic declaration, otherwise false.
      */
-    QStringList genericDeclarationsIn(QString const& sectionWithoutCommentLines) const;
+    bool parseDeclaration(HDLLexer const& lexer, int first, int last, GenericDeclaration& declaration) const;
 
     /*!
      *  Creates a module parameter from a given VHDL declaration and adds it to the target component instantiation.
@@ -104,7 +123,7 @@ private:
      *    @param [in] declaration                         The declaration from which to create a model parameter.
      *    @param [in/out] targetComponentInstantiation    The component instantiation to which add the module parameter.
      */
-    void createModelParameterFromDeclaration(QString const& declaration, 
+    void createModelParameterFromDeclaration(GenericDeclaration const& declaration, 
         QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const;
 
     /*!
@@ -13,6 +13,8 @@
 
 #include "VHDLSyntax.h"
 
+#include <Plugins/common/HDLLexer.h>
+
 #include <KactusAPI/include/KactusColors.h>
 
 #include <IPXACTmodels/Component/Component.h>
@@ -24,29 +26,11 @@
 
 namespace
 {
-    //! VHDL port direction.
-    const QString DIRECTION = "in|out|inout|buffer|linkage";
-
-    //! VHDL vector port boundary.
-    const QString BOUNDARY = "[\\w\\d )(+*/-]+";
-
-    //! VHDL port type definition is <typename>[(<left> to/downto <right>)].
-    const QString PORT_TYPE = "(?:\\w+)"
-        "(?:\\s*[(]\\s*(?:" + BOUNDARY + ")\\s+(?:down)?to\\s+(?:" + BOUNDARY + ")\\s*[)])?";
-
-    /*! Port declaration is <port_names> : <direction> <type> [<default>] [pragma] ; [description]    
-     *  A pragma e.g. synthesis translate_off may be inserted in the declaration before the ending
-     *  semicolon or string's end.
-     */
-    const QRegularExpression PORT_EXP(
-        "(" + VHDLSyntax::NAMES + ")+\\s*[:]\\s*(" + DIRECTION + ")\\s+(" + PORT_TYPE + ")" +
-        "(?:\\s*" + VHDLSyntax::DEFAULT + ")?(?:\\s*" + VHDLSyntax::PRAGMA + ")?"
-        "(?:" + VHDLSyntax::DECLARATION_END + ")", QRegularExpression::CaseInsensitiveOption);
-
-    //! Ports are declared inside entity by PORT ( <port_declarations> );
-    const QRegularExpression PORTS_BEGIN("(PORT)\\s*[(]", QRegularExpression::CaseInsensitiveOption);
-    const QRegularExpression PORTS_END("[)]\\s*[;](?=\\s*(((PORT\\s*[(])|BEGIN)|(END\\s+(ENTITY\\s+)?\\w+)))",
-        QRegularExpression::CaseInsensitiveOption);
+    //! VHDL port directions.
+    const QStringList DIRECTIONS({"in", "out", "inout", "buffer", "linkage"});
+
+    //! Pragmas are not used as port descriptions.
+    const QRegularExpression PRAGMA_EXP("^" + VHDLSyntax::PRAGMA, QRegularExpression::CaseInsensitiveOption);
 }
 
 //-----------------------------------------------------------------------------
@@ -61,7 +45,7 @@ VHDLPortParser::VHDLPortParser(QObject* parent): QObject(parent), highlighter_(0
 // Function: VHDLPortParser::import()
 //-----------------------------------------------------------------------------
 void VHDLPortParser::import(QString const& input, QSharedPointer<Component> targetComponent,
-    QSharedPointer<ComponentInstantiation> /*targetComponentInstantiation*/)
+    QSharedPointer<ComponentInstantiation> /*targetComponentInstantiation*/, int inputPosition)
 {
     //! The existing ports are changed to phantom in order to keep the component error-free.
     //! These ports can then be deleted later.
@@ -70,12 +54,15 @@ void VHDLPortParser::import(QString const& input, QSharedPointer<Component> targ
         existingPort->setDirection(DirectionTypes::DIRECTION_PHANTOM);
     }
 
-    foreach (QString const& portDeclaration, findPortDeclarations(input))
+    HDLLexer lexer(input, HDLLexer::Language::VHDL);
+
+    for (PortDeclaration const& portDeclaration : findPortDeclarations(lexer))
     {
         createPortFromDeclaration(portDeclaration, targetComponent);
-        if (highlighter_)
+        if (highlighter_ && inputPosition != -1)
         {
-            highlighter_->applyHighlight(portDeclaration, KactusColors::Importer::PORT, input);
+            highlighter_->applyHighlight(inputPosition + portDeclaration.begin, inputPosition + portDeclaration.end,
+                KactusColors::Importer::PORT);
         }
     }
 }
@@ -89,81 +76,190 @@ void VHDLPortParser::setHighlighter(Highlighter* highlighter)
 }
 
 //-----------------------------------------------------------------------------
-// Function: VHDLPortParser::parsePortDeclarations()
+// Function: VHDLPortParser::findPortDeclarations()
 //-----------------------------------------------------------------------------
-QStringList VHDLPortParser::findPortDeclarations(QString const& input) const
+QVector<VHDLPortParser::PortDeclaration> VHDLPortParser::findPortDeclarations(HDLLexer const& lexer) const
 {
-    QString portSectionInEntity = findPortsSection(input);
-    QString portSectionWithoutCommentLines = removeCommentLines(portSectionInEntity);
+    QVector<PortDeclaration> portDeclarations;
+
+    int sectionBegin = findPortsSection(lexer);
+    if (sectionBegin == -1)
+    {
+        return portDeclarations;
+    }
+
+    // Declarations are separated by semicolons.
+    int sectionEnd = lexer.matching(sectionBegin);
+    int declarationBegin = lexer.next(sectionBegin);
+    for (int i = declarationBegin; i <= sectionEnd; i = lexer.next(i))
+    {
+        if (i == sectionEnd || lexer.isOperator(i, QStringLiteral(";")))
+        {
+            PortDeclaration declaration;
+            if (declarationBegin < i && parseDeclaration(lexer, declarationBegin, lexer.previous(i), declaration))
+            {
+                portDeclarations.append(declaration);
+            }
+
+            declarationBegin = lexer.next(i);
+        }
+        else if (lexer.matching(i) > i)
+        {
+            i = lexer.matching(i);
+        }
+    }
 
-    return portDeclarationsIn(portSectionWithoutCommentLines);
+    return portDeclarations;
 }
 
 //-----------------------------------------------------------------------------
 // Function: VHDLPortParser::findPortsSection()
 //-----------------------------------------------------------------------------
-QString VHDLPortParser::findPortsSection(QString const& input) const
+int VHDLPortParser::findPortsSection(HDLLexer const& lexer) const
 {
-    int entityBegin = input.indexOf(VHDLSyntax::ENTITY_BEGIN_EXP);
-    int entityEnd = input.indexOf(VHDLSyntax::ENTITY_END_EXP, entityBegin);
-
-    int portsBeginIndex = PORTS_BEGIN.match(input, entityBegin).capturedEnd();
+    // Entity declaration is ENTITY <name> IS ... END [ENTITY] [<name>];
+    int entityBegin = 0;
+    while (entityBegin < lexer.count() && (lexer.isWord(entityBegin, QStringLiteral("entity")) == false ||
+        lexer.isWord(lexer.next(lexer.next(entityBegin)), QStringLiteral("is")) == false ||
+        lexer.token(lexer.next(entityBegin)).type != HDLLexer::TokenType::Identifier))
+    {
+        ++entityBegin;
+    }
 
-    if (portsBeginIndex > entityEnd)
+    if (entityBegin == lexer.count())
     {
-        return QString();
+        return -1;
     }
 
-    int portsEndIndex = input.indexOf(PORTS_END, portsBeginIndex);
+    for (int i = lexer.next(lexer.next(lexer.next(entityBegin))); i < lexer.count() &&
+        lexer.isWord(i, QStringLiteral("end")) == false; i = lexer.next(i))
+    {
+        int portsBegin = lexer.next(i);
+        if (lexer.isWord(i, QStringLiteral("port")) && lexer.isOperator(portsBegin, QStringLiteral("(")) &&
+            lexer.matching(portsBegin) != -1)
+        {
+            return portsBegin;
+        }
+        else if (lexer.matching(i) > i)
+        {
+            i = lexer.matching(i);
+        }
+    }
 
-    return input.mid(portsBeginIndex, portsEndIndex - portsBeginIndex);
+    return -1;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VHDLPortParser::removeCommentLines()
+// Function: VHDLPortParser::parseDeclaration()
 //-----------------------------------------------------------------------------
-QString VHDLPortParser::removeCommentLines(QString input) const
+bool VHDLPortParser::parseDeclaration(HDLLexer const& lexer, int first, int last,
+    PortDeclaration& declaration) const
 {
-    QRegularExpression commentLine("^" + VHDLSyntax::SPACE + VHDLSyntax::COMMENT_LINE_EXP + "|" +
-        VHDLSyntax::ENDLINE + VHDLSyntax::SPACE + VHDLSyntax::COMMENT_LINE_EXP);
+    // Port declaration is [signal] <port_names> : <direction> <type> [<default>] [pragma] ; [description]
+    int index = first;
+    if (lexer.isWord(index, QStringLiteral("signal")))
+    {
+        index = lexer.next(index);
+    }
 
-    return input.remove(commentLine);
-}
+    while (index <= last && lexer.token(index).type == HDLLexer::TokenType::Identifier)
+    {
+        declaration.names.append(lexer.text(index).toString());
 
-//-----------------------------------------------------------------------------
-// Function: VHDLPortParser::parsePortDeclarations()
-//-----------------------------------------------------------------------------
-QStringList VHDLPortParser::portDeclarationsIn(QString const& portSectionWithoutCommentLines) const
-{
-    QStringList portDeclarations;
+        index = lexer.next(index);
+        if (lexer.isOperator(index, QStringLiteral(",")))
+        {
+            index = lexer.next(index);
+        }
+        else
+        {
+            break;
+        }
+    }
 
-    QRegularExpressionMatchIterator i = PORT_EXP.globalMatch(portSectionWithoutCommentLines);
-    while (i.hasNext())
+    int directionIndex = lexer.next(index);
+    int typeIndex = lexer.next(directionIndex);
+    if (declaration.names.isEmpty() || lexer.isOperator(index, QStringLiteral(":")) == false ||
+        typeIndex > last || lexer.token(directionIndex).type != HDLLexer::TokenType::Identifier ||
+        DIRECTIONS.contains(lexer.text(directionIndex).toString().toLower()) == false ||
+        lexer.token(typeIndex).type != HDLLexer::TokenType::Identifier)
     {
-        portDeclarations.append(i.next().captured());
+        return false;
     }
 
-    return portDeclarations;
+    declaration.direction = DirectionTypes::str2Direction(lexer.text(directionIndex).toString().toLower(),
+        DirectionTypes::DIRECTION_INVALID);
+    declaration.type = lexer.text(typeIndex).toString();
+
+    // Vector bounds are given as (<left> to/downto <right>).
+    index = lexer.next(typeIndex);
+    int boundsEnd = lexer.matching(index);
+    if (lexer.isOperator(index, QStringLiteral("(")) && boundsEnd != -1 && boundsEnd <= last)
+    {
+        for (int i = lexer.next(index); i < boundsEnd; i = lexer.next(i))
+        {
+            if (lexer.isWord(i, QStringLiteral("to")) || lexer.isWord(i, QStringLiteral("downto")))
+            {
+                declaration.leftBound = lexer.slice(lexer.next(index), lexer.previous(i));
+                declaration.rightBound = lexer.slice(lexer.next(i), lexer.previous(boundsEnd));
+                break;
+            }
+            else if (lexer.matching(i) > i)
+            {
+                i = lexer.matching(i);
+            }
+        }
+
+        index = lexer.next(boundsEnd);
+    }
+
+    while (index <= last && lexer.isOperator(index, QStringLiteral(":=")) == false)
+    {
+        index = lexer.next(qMax(index, lexer.matching(index)));
+    }
+
+    if (index < last)
+    {
+        declaration.defaultValue = lexer.simplifiedText(lexer.next(index), last);
+    }
+
+    // The description is a comment on the same line after the declaration or its ending semicolon.
+    int descriptionIndex = last + 1;
+    if (lexer.isOperator(descriptionIndex, QStringLiteral(";")))
+    {
+        ++descriptionIndex;
+    }
+
+    declaration.begin = lexer.token(first).position;
+    declaration.end = lexer.token(last).end();
+
+    if (descriptionIndex < lexer.count() && lexer.token(descriptionIndex).type == HDLLexer::TokenType::Comment &&
+        lexer.onSameLine(declaration.end, lexer.token(descriptionIndex).position))
+    {
+        if (PRAGMA_EXP.match(lexer.text(descriptionIndex).toString()).hasMatch() == false)
+        {
+            declaration.description = lexer.commentText(descriptionIndex);
+            declaration.end = lexer.token(descriptionIndex).end();
+        }
+    }
+
+    return true;
 }
 
 //-----------------------------------------------------------------------------
 // Function: VHDLPortParser::createPort()
 //-----------------------------------------------------------------------------
-void VHDLPortParser::createPortFromDeclaration(QString const& declaration,
+void VHDLPortParser::createPortFromDeclaration(PortDeclaration const& declaration,
     QSharedPointer<Component> targetComponent) const
 {
-    QStringList portNames = parsePortNames(declaration);
-    DirectionTypes::Direction direction =  parsePortDirection(declaration); 
-    QString type = parsePortType(declaration);
+    QString const& type = declaration.type;
     QString typeDefinition;
-    QString defaultValue = parseDefaultValue(declaration, targetComponent);
-    QString description = parseDescription(declaration);
+    QString defaultValue = replaceNameReferencesWithIds(declaration.defaultValue, targetComponent);
 
-    QPair<QString, QString> bounds = parsePortBounds(declaration, targetComponent);
-    QString leftBound = bounds.first;
-    QString rightBound = bounds.second;
+    QString leftBound = replaceNameReferencesWithIds(declaration.leftBound, targetComponent);
+    QString rightBound = replaceNameReferencesWithIds(declaration.rightBound, targetComponent);
 
-    foreach(QString const& name, portNames)
+    foreach(QString const& name, declaration.names)
     {   
         QSharedPointer<Port> port;        
         if (targetComponent->hasPort(name))
@@ -179,68 +275,14 @@ void VHDLPortParser::createPortFromDeclaration(QString const& declaration,
             targetComponent->getPorts()->append(port);
         }
 
-        port->setDirection(direction);
+        port->setDirection(declaration.direction);
         port->setLeftBound(leftBound);
         port->setRightBound(rightBound);
         port->setTypeName(type);
         port->setTypeDefinition(type, typeDefinition);
         port->setDefaultValue(defaultValue);
-        port->setDescription(description);
-    }
-}
-
-//-----------------------------------------------------------------------------
-// Function: VHDLPortParser::parsePortNames()
-//-----------------------------------------------------------------------------
-QStringList VHDLPortParser::parsePortNames(QString const& declaration) const
-{
-    QString portNames = PORT_EXP.match(declaration).captured(1);
-    return portNames.split(QRegularExpression("\\s*[,]\\s*"), Qt::SkipEmptyParts);
-}
-
-//-----------------------------------------------------------------------------
-// Function: VHDLPortParser::parsePortDirection()
-//-----------------------------------------------------------------------------
-DirectionTypes::Direction VHDLPortParser::parsePortDirection(QString const& declaration) const
-{
-    QString direction = PORT_EXP.match(declaration).captured(2).toLower();    
-    return DirectionTypes::str2Direction(direction, DirectionTypes::DIRECTION_INVALID);
-}
-
-//-----------------------------------------------------------------------------
-// Function: VHDLPortParser::parsePortType()
-//-----------------------------------------------------------------------------
-QString VHDLPortParser::parsePortType(QString const& declaration) const
-{
-    QString typePattern = PORT_TYPE;
-    typePattern.replace("(?:","(");
-
-    QRegularExpression typeExpression(typePattern, QRegularExpression::CaseInsensitiveOption);    
-   
-    QString fullType = PORT_EXP.match(declaration).captured(3);
-    return typeExpression.match(fullType).captured(1);
-}
-
-//-----------------------------------------------------------------------------
-// Function: VHDLPortParser::parseDescription()
-//-----------------------------------------------------------------------------
-QString VHDLPortParser::parseDescription(QString const& declaration) const
-{
-    QString description = PORT_EXP.match(declaration).captured(6).trimmed();
-    if (description.isEmpty())
-    {
-        description = PORT_EXP.match(declaration).captured(7).trimmed();
+        port->setDescription(declaration.description);
     }
-
-    return description;
-}
-
-//-----------------------------------------------------------------------------
-// Function: VHDLPortParser::parseDefaultValue()
-//-----------------------------------------------------------------------------
-QString VHDLPortParser::parseDefaultValue(QString const& input, QSharedPointer<Component> targetComponent) const
-{
-    return replaceNameReferencesWithIds(PORT_EXP.match(input).captured(4).trimmed(), targetComponent);
 }
 
 //-----------------------------------------------------------------------------
@@ -268,65 +310,6 @@ QString VHDLPortParser::replaceNameReferencesWithIds(QString const& expression,
     return result;
 }
 
-//-----------------------------------------------------------------------------
-// Function: VHDLPortParser::parsePortBounds()
-//-----------------------------------------------------------------------------
-QPair<QString, QString> VHDLPortParser::parsePortBounds(QString const& declaration, 
-    QSharedPointer<Component> targetComponent) const
-{
-    QString fullType = PORT_EXP.match(declaration).captured(3);
-
-    QString leftValue = QString();
-    QString rightValue = QString();
-
-    int firstParenthesis = fullType.indexOf(QLatin1Char('('));
-    if (firstParenthesis != -1)
-    {
-        int endParenthesis = findMatchingEndParenthesis(fullType, firstParenthesis);
-        QString vectorBounds = fullType.mid(firstParenthesis + 1, endParenthesis - firstParenthesis - 1);
-
-        if (!vectorBounds.isEmpty())
-        {
-            QRegularExpression splitter(QString("\\s+(down)?to\\s+"), QRegularExpression::CaseInsensitiveOption);
-            QRegularExpressionMatch splitMatch = splitter.match(vectorBounds);
-            QString leftEquation = vectorBounds.left(splitMatch.capturedStart());
-            QString rightEquation = vectorBounds.mid(splitMatch.capturedEnd());
-            
-            leftValue = replaceNameReferencesWithIds(leftEquation, targetComponent);
-            rightValue = replaceNameReferencesWithIds(rightEquation, targetComponent);
-        }
-    }
-
-    return qMakePair(leftValue, rightValue);
-}
-
-//-----------------------------------------------------------------------------
-// Function: VHDLPortParser::findMatchingEndParenthesis()
-//-----------------------------------------------------------------------------
-int VHDLPortParser::findMatchingEndParenthesis(QString const& equation, int parenthesesStart) const
-{
-    QRegularExpression parenthesesExpression("[()]");
-
-    int position = parenthesesStart + 1;
-    int depth = 1;
-
-    while (depth > 0)
-    {
-        position = equation.indexOf(parenthesesExpression, position);
-        if (parenthesesExpression.match(equation.at(position)).captured() == "(")
-        {
-            depth++;
-        }
-        else
-        {
-            depth--;
-        }
-        position++;
-    }
-
-    return position - 1;
-}
-
 //-----------------------------------------------------------------------------
 // Function: VHDLPortParser::getDefaultTypeDefinition()
 //-----------------------------------------------------------------------------
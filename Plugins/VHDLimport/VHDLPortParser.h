@@ -20,9 +20,12 @@
 #include <QMap>
 #include <QSharedPointer>
 #include <QString>
+#include <QStringList>
 #include <QObject>
+#include <QVector>
 
 class Component;
+class HDLLexer;
 class ComponentInstantiation;
 class Port;
 
@@ -55,9 +58,10 @@ public:
      *    @param [in] input                               The input text to parse.
      *    @param [in/out] targetComponent                 The component to add all the imported ports to.
      *    @param [in] targetComponentInstantiation        The component instantiation for the import.
+     *    @param [in] inputPosition                       The position of the input in the highlighted text.
      */
     virtual void import(QString const& input, QSharedPointer<Component> targetComponent,
-        QSharedPointer<ComponentInstantiation> targetComponentInstantiation);
+        QSharedPointer<ComponentInstantiation> targetComponentInstantiation, int inputPosition = 0);
 
     /*!
      *  Sets the given highlighter to be used by the port parser.
@@ -68,96 +72,75 @@ public:
 
 private:
 
-    /*!
-     *  Finds all port declarations from input.
-     *
-     *    @param [in] input   The input to search for port declarations.
-     *
-     *    @return Found port declarations.
-     */
-    QStringList findPortDeclarations(QString const& input) const;
+    //! A port declaration found in the input.
+    struct PortDeclaration
+    {
+        //! The names of the ports in the declaration.
+        QStringList names;
 
-    /*!
-     *  Finds the section defining the ports of an entity.
-     *
-     *    @param [in] input   The input to search for port section.
-     *
-     *    @return The sections containing all ports in entity.
-     */
-    QString findPortsSection(QString const& input) const;
+        //! The port direction.
+        DirectionTypes::Direction direction = DirectionTypes::DIRECTION_INVALID;
 
-    /*!
-     *  Removes all comment lines from a given input.
-     *
-     *    @param [in] input   The input to remove comments from.
-     *
-     *    @return The input without comment lines.
-     */
-    QString removeCommentLines(QString input) const;
+        //! The port type.
+        QString type;
 
-    /*!
-     *  Finds all port declarations from a ports section without comment lines.
-     *
-     *    @param [in] portSectionWithoutCommentLines   The section of the VHDL containing the ports in entity
-     *                                                   without comment lines.
-     *
-     *    @return The VHDL port declarations.
-     */
-    QStringList portDeclarationsIn(QString const& portSectionWithoutCommentLines) const;
+        //! The left bound of the port vector.
+        QString leftBound;
 
-    /*!
-     *  Creates a port from a given VHDL declaration and adds it to the target component.
-     *
-     *    @param [in] declaration             The declaration from which to create a port.
-     *    @param [in/out] targetComponent     The component to which add the port.
-     */
-    void createPortFromDeclaration(QString const& declaration,
-        QSharedPointer<Component> targetComponent) const;
+        //! The right bound of the port vector.
+        QString rightBound;
 
-    /*!
-     *  Parses the port names from a VHDL port declaration.
-     *
-     *    @param [in] declaration   The VHDL port declaration to parse.
-     *
-     *    @return The port names in the declaration.
-     */
-    QStringList parsePortNames(QString const& declaration) const;
+        //! The default value of the ports.
+        QString defaultValue;
+
+        //! The description from a comment tailing the declaration.
+        QString description;
+
+        //! The position of the declaration in the input.
+        int begin = 0;
+
+        //! The position after the declaration and its tailing comment in the input.
+        int end = 0;
+    };
 
     /*!
-     *  Parses the port direction from a VHDL port declaration.
+     *  Finds all port declarations from the tokenized input.
      *
-     *    @param [in] declaration   The VHDL port declaration to parse.
+     *    @param [in] lexer   The tokenized input to search for port declarations.
      *
-     *    @return The port direction in the declaration.
+     *    @return Found port declarations.
      */
-    DirectionTypes::Direction parsePortDirection(QString const& declaration) const;
+    QVector<PortDeclaration> findPortDeclarations(HDLLexer const& lexer) const;
 
     /*!
-     *  Parses the port type from a VHDL port declaration.
+     *  Finds the port clause of the first entity in the tokenized input.
      *
-     *    @param [in] declaration   The VHDL port declaration to parse.
+     *    @param [in] lexer   The tokenized input to search for the port clause.
      *
-     *    @return The port type in the declaration.
+     *    @return The token index of the opening parenthesis of the port clause, or -1 if not found.
      */
-    QString parsePortType(QString const& declaration) const;
+    int findPortsSection(HDLLexer const& lexer) const;
 
     /*!
-     *  Parses the port description from a comment tailing a VHDL port declaration.
+     *  Parses a port declaration from the given tokens.
      *
-     *    @param [in] declaration   The VHDL port declaration to parse.
+     *    @param [in] lexer           The tokenized input.
+     *    @param [in] first           The index of the first token in the declaration.
+     *    @param [in] last            The index of the last token in the declaration, excluding the semicolon.
+     *    @param [out] declaration    The parsed declaration.
      *
-     *    @return The port description.
+     *    @return True, if the tokens are a valid port declaration, otherwise false.
      */
-    QString parseDescription(QString const& declaration) const;
+    bool parseDeclaration(HDLLexer const& lexer, int first, int last, PortDeclaration& declaration) const;
 
     /*!
-     *  Parses the port default value from a VHDL port declaration.
-     *
-     *    @param [in] declaration   The VHDL port declaration to parse.
+     *  Creates a port from a given VHDL declaration and adds it to the target component.
      *
-     *    @return The port default value in the declaration.
+     *    @param [in] declaration             The declaration from which to create a port.
+     *    @param [in/out] targetComponent     The component to which add the port.
      */
-    QString parseDefaultValue(QString const& input, QSharedPointer<Component> targetComponent) const;
+    void createPortFromDeclaration(PortDeclaration const& declaration,
+        QSharedPointer<Component> targetComponent) const;
 
     /*!
      *  Replaces all name references in the given expression to parameter id references.
@@ -169,19 +152,6 @@ private:
      */
     QString replaceNameReferencesWithIds(QString const& expression, QSharedPointer<Component> targetComponent) const;
 
-    /*!
-     *  Parses the port bounds from a VHDL port declaration.
-     *
-     *    @param [in] declaration         The VHDL port declaration to parse.
-     *    @param [in] targetComponent     The component to which add the port.
-     *
-     *    @return The port bounds <left, right> in the given declaration.
-     */
-    QPair<QString, QString> parsePortBounds(QString const& declaration,
-        QSharedPointer<Component> targetComponent) const;
-   
-    int findMatchingEndParenthesis(QString const& equation, int parenthesesStart) const;
-
     /*!
      *  Creates a default type definition for the given type.
      *
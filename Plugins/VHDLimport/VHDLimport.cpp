@@ -157,8 +157,13 @@ void VHDLimport::import(QString const& input, QString const& componentDeclaratio
 		QSharedPointer<ComponentInstantiation> targetComponentInstantiation = setupComponentInstantiation();
         parseModelNameAndArchitecture(input, componentDeclaration, targetComponentInstantiation);
 
-        genericParser_->import(componentDeclaration, targetComponent, targetComponentInstantiation);
-        portParser_->import(componentDeclaration, targetComponent, targetComponentInstantiation);
+        // The parsers highlight the declarations by their positions in the whole input.
+        int declarationPosition = input.indexOf(componentDeclaration);
+
+        genericParser_->import(componentDeclaration, targetComponent, targetComponentInstantiation,
+            declarationPosition);
+        portParser_->import(componentDeclaration, targetComponent, targetComponentInstantiation,
+            declarationPosition);
     }
 }
 
@@ -6,9 +6,11 @@ HEADERS += ../../common/NameGenerationPolicy.h \
     ./VHDLSyntax.h \
     ./vhdlimport_global.h \
     ./VHDLimport.h \
+    ../common/HDLLexer.h \
     ./VHDLPortParser.h \
     ./VHDLGenericParser.h
 SOURCES += ../../common/NameGenerationPolicy.cpp \
     ./VHDLGenericParser.cpp \
     ./VHDLimport.cpp \
+    ../common/HDLLexer.cpp \
     ./VHDLPortParser.cpp
@@ -13,6 +13,7 @@ HEADERS += ../../IPXACTmodels/utilities/ComponentSearch.h \
     ../common/SourceHighlightStyle.h \
     ./VerilogSourceHighlight.h \
     ../VerilogImport/VerilogSyntax.h \
+    ../common/HDLLexer.h \
     ../common/LanguageHighlighter.h \
     ./VerilogGeneratorPlugin.h \
     ./common/Writer.h \
@@ -53,6 +54,7 @@ SOURCES += ../../IPXACTmodels/utilities/ComponentSearch.cpp \
     ../common/LanguageHighlighter.cpp \
     ../common/SourceHighlightStyle.cpp \
     ../VerilogImport/VerilogSyntax.cpp \
+    ../common/HDLLexer.cpp \
     ./VerilogGeneratorPlugin.cpp \
     ./VerilogSourceHighlight.cpp \
     ./ComponentInstanceVerilogWriter/ComponentInstanceVerilogWriter.cpp \
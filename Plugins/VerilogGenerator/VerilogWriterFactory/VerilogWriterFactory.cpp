@@ -109,6 +109,14 @@ QString VerilogWriterFactory::getLanguage() const
     return "Verilog";
 }
 
+//-----------------------------------------------------------------------------
+// Function: VerilogWriterFactory::getFileSuffix()
+//-----------------------------------------------------------------------------
+QString VerilogWriterFactory::getFileSuffix() const
+{
+    return "v";
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogWriterFactory::getSaveToFileset()
 //-----------------------------------------------------------------------------
@@ -67,6 +67,11 @@ public:
      *  Returns the language of the factory.
      */
     virtual QString getLanguage() const override final;
+
+    /*!
+     *  Returns the file suffix of the produced files without the leading dot.
+     */
+    virtual QString getFileSuffix() const override final;
     
     /*!
      *  Returns true, if it is desirable to save the output to file set by default.
@@ -11,6 +11,8 @@ HEADERS += ../../common/expressions/utilities.h \
     ./VerilogInstanceParser.h \
     ./VerilogParameterParser.h \
     ./VerilogPortParser.h \
+    ./VerilogPreprocessor.h \
+    ../common/HDLLexer.h \
     ./VerilogSyntax.h \
     ./verilogimport_global.h \
     ./VerilogImporter.h
@@ -20,4 +22,6 @@ SOURCES += ../../common/expressions/utilities.cpp \
     ./VerilogInstanceParser.cpp \
     ./VerilogParameterParser.cpp \
     ./VerilogPortParser.cpp \
+    ./VerilogPreprocessor.cpp \
+    ../common/HDLLexer.cpp \
     ./VerilogSyntax.cpp
@@ -14,6 +14,7 @@
 #include "VerilogSyntax.h"
 
 #include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Port.h>
 
 #include <common/NameGenerationPolicy.h>
 
@@ -35,7 +36,9 @@ QObject(0),
 portParser_(),
 parameterParser_(),
 instanceParser_(),
-highlighter_(0)
+highlighter_(0),
+preprocessor_(),
+filePath_()
 {
 
 }
@@ -172,10 +175,28 @@ void VerilogImporter::import(QString const& input, QString const& componentDecla
 		setLanguageAndEnvironmentalIdentifiers(targetComponent, targetComponentInstantiation);
         importModelName(componentDeclaration, targetComponentInstantiation);
 
-        parameterParser_.import(componentDeclaration, targetComponent, targetComponentInstantiation);
-		portParser_.import(componentDeclaration, targetComponent);
-        instanceParser_.import(input, componentDeclaration, targetComponent);
+        // The inactive conditional code and the directives are blanked out, keeping the positions in the input.
+        QString activeInput = preprocessor_.preprocess(input, filePath_,
+            VerilogPreprocessor::Output::KeepPositions);
+
+        // The parsers highlight the declarations by their positions in the whole input.
+        int declarationPosition = input.indexOf(componentDeclaration);
+
+        QString activeDeclaration = componentDeclaration;
+        if (declarationPosition != -1)
+        {
+            activeDeclaration = activeInput.mid(declarationPosition, componentDeclaration.size());
+        }
+
+        parameterParser_.import(activeDeclaration, targetComponent, targetComponentInstantiation,
+            declarationPosition);
+		portParser_.import(activeDeclaration, targetComponent, declarationPosition);
+        instanceParser_.import(activeInput, activeDeclaration, targetComponent);
+
+        expandMacroUsages(targetComponent, targetComponentInstantiation);
     }
+
+    filePath_.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -198,6 +219,15 @@ void VerilogImporter::setExpressionParser(QSharedPointer<ExpressionParser> parse
     portParser_.setExpressionParser(parser);
 }
 
+//-----------------------------------------------------------------------------
+// Function: VerilogImporter::setInputLocation()
+//-----------------------------------------------------------------------------
+void VerilogImporter::setInputLocation(QString const& filePath, QStringList const& includeDirectories)
+{
+    filePath_ = filePath;
+    preprocessor_.setIncludeDirectories(includeDirectories);
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogImporter::hasModuleDeclaration()
 //-----------------------------------------------------------------------------
@@ -306,3 +336,57 @@ void VerilogImporter::setLanguageAndEnvironmentalIdentifiers(QSharedPointer<Comp
 		flatView->setComponentInstantiationRef( instaName );
 	}
 }
+
+//-----------------------------------------------------------------------------
+// Function: VerilogImporter::expandMacroUsages()
+//-----------------------------------------------------------------------------
+void VerilogImporter::expandMacroUsages(QSharedPointer<Component> targetComponent,
+    QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const
+{
+    // The macros known as component parameters e.g. from the include import are already replaced with references.
+    for (QSharedPointer<Parameter> parameter : *targetComponent->getParameters())
+    {
+        expandMacroUsages(parameter);
+    }
+
+    if (targetComponentInstantiation)
+    {
+        for (QSharedPointer<ModuleParameter> parameter : *targetComponentInstantiation->getModuleParameters())
+        {
+            expandMacroUsages(parameter);
+        }
+    }
+
+    for (QSharedPointer<Port> port : *targetComponent->getPorts())
+    {
+        port->setLeftBound(expandMacroUsages(port->getLeftBound()));
+        port->setRightBound(expandMacroUsages(port->getRightBound()));
+        port->setArrayLeft(expandMacroUsages(port->getArrayLeft()));
+        port->setArrayRight(expandMacroUsages(port->getArrayRight()));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogImporter::expandMacroUsages()
+//-----------------------------------------------------------------------------
+void VerilogImporter::expandMacroUsages(QSharedPointer<Parameter> parameter) const
+{
+    parameter->setValue(expandMacroUsages(parameter->getValue()));
+    parameter->setVectorLeft(expandMacroUsages(parameter->getVectorLeft()));
+    parameter->setVectorRight(expandMacroUsages(parameter->getVectorRight()));
+    parameter->setArrayLeft(expandMacroUsages(parameter->getArrayLeft()));
+    parameter->setArrayRight(expandMacroUsages(parameter->getArrayRight()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogImporter::expandMacroUsages()
+//-----------------------------------------------------------------------------
+QString VerilogImporter::expandMacroUsages(QString const& expression) const
+{
+    if (expression.contains(QLatin1Char('`')) == false)
+    {
+        return expression;
+    }
+
+    return preprocessor_.expandMacros(expression).simplified();
+}
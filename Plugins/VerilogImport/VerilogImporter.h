@@ -17,22 +17,25 @@
 #include "VerilogPortParser.h"
 #include "VerilogParameterParser.h"
 #include "Plugins/VerilogImport/VerilogInstanceParser.h"
+#include "VerilogPreprocessor.h"
 
 #include <KactusAPI/include/ExpressionSupport.h>
 #include <KactusAPI/include/ImportPlugin.h>
 #include <KactusAPI/include/HighlightSource.h>
+#include <KactusAPI/include/IncludePathSupport.h>
 
 #include <QSharedPointer>
 #include <QString>
 
 class Component;
+class Parameter;
 class View;
 
 //-----------------------------------------------------------------------------
 //! Import plugin for verilog source files.
 //-----------------------------------------------------------------------------
 class VERILOGIMPORT_EXPORT VerilogImporter: public QObject, public ImportPlugin, public HighlightSource, 
-    public ExpressionSupport
+    public ExpressionSupport, public IncludePathSupport
 {
     Q_OBJECT
     Q_PLUGIN_METADATA(IID "kactus2.plugins.verilogimportplugin" FILE "verilogimportplugin.json")
@@ -148,6 +151,14 @@ public:
      */
     virtual void setExpressionParser(QSharedPointer<ExpressionParser> parser) override final;
 
+    /*!
+     *  Sets the location of the next imported file for resolving the included files.
+     *
+     *    @param [in] filePath              Absolute path to the imported file.
+     *    @param [in] includeDirectories    Absolute paths to the directories to search the included files from.
+     */
+    virtual void setInputLocation(QString const& filePath, QStringList const& includeDirectories) override final;
+
 private:
 
 	// Disable copying.
@@ -194,6 +205,31 @@ private:
     void setLanguageAndEnvironmentalIdentifiers(QSharedPointer<Component> targetComponent,
 		QSharedPointer<ComponentInstantiation>& targetComponentInstantiation) const;    
 
+    /*!
+     *  Replaces the macro usages left in the imported parameters and ports with the macro definitions.
+     *
+     *    @param [in] targetComponent                 The component containing the imported items.
+     *    @param [in] targetComponentInstantiation    The component instantiation containing the module parameters.
+     */
+    void expandMacroUsages(QSharedPointer<Component> targetComponent,
+        QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const;
+
+    /*!
+     *  Replaces the macro usages in the value and the bounds of a parameter with the macro definitions.
+     *
+     *    @param [in] parameter   The parameter to expand.
+     */
+    void expandMacroUsages(QSharedPointer<Parameter> parameter) const;
+
+    /*!
+     *  Replaces the macro usages in an expression with the macro definitions.
+     *
+     *    @param [in] expression  The expression to expand.
+     *
+     *    @return The expanded expression.
+     */
+    QString expandMacroUsages(QString const& expression) const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -209,6 +245,12 @@ private:
 
     //! The highlighter to use.
     Highlighter* highlighter_;
+
+    //! Preprocessor for the conditional compilation, the included files and the macros.
+    VerilogPreprocessor preprocessor_;
+
+    //! Absolute path to the next imported file, if known.
+    QString filePath_;
 };
 
 #endif // VERILOGIMPORTER_H
@@ -12,7 +12,7 @@
 #include "VerilogInstanceParser.h"
 #include "VerilogSyntax.h"
 
-#include <common/expressions/utilities.h>
+#include <Plugins/common/HDLLexer.h>
 
 #include <KactusAPI/include/KactusColors.h>
 
@@ -23,7 +23,18 @@
 #include <IPXACTmodels/kactusExtensions/Kactus2Value.h>
 #include <IPXACTmodels/kactusExtensions/Kactus2Group.h>
 
-#include <QRegularExpression>
+#include <QStringList>
+
+namespace
+{
+    //! Identifies the VLNV of the instantiated component in a comment.
+    const QString VLNV_IDENTIFIER("IP-XACT VLNV:");
+
+    //! Keywords that may directly precede an instantiation.
+    const QStringList STATEMENT_KEYWORDS({
+        "begin", "end", "else", "generate", "endgenerate", "endcase", "endfunction", "endtask", "fork", "join",
+        "join_any", "join_none"});
+}
 
 //-----------------------------------------------------------------------------
 // Function: VerilogInstanceParser::VerilogInstanceParser()
@@ -48,60 +59,43 @@ void VerilogInstanceParser::setHighlighter(Highlighter* highlighter)
 void VerilogInstanceParser::import(QString const& input, QString const& componentDeclaration,
     QSharedPointer<Component> targetComponent)
 {
-    QVector<QRegularExpressionMatch> instanceDeclarations = findInstances(input, componentDeclaration);
+    QVector<InstanceDeclaration> instanceDeclarations = findInstances(input, componentDeclaration);
 
     if (!instanceDeclarations.isEmpty())
     {
-		QString vlnvIdentifier = "IP-XACT VLNV:";
         QSharedPointer<Kactus2Group> instancesGroup(new Kactus2Group(InstanceData::VERILOGINSTANCES));
 
-        for (auto& instanceMatch : instanceDeclarations)
+        for (auto const& instance : instanceDeclarations)
         {
-			QString instanceModuleName = instanceMatch.captured(2);
-			QString parameterDeclarations = instanceMatch.captured(3);
-			QString instanceName = instanceMatch.captured(4);
-			QString connectionDeclarations = instanceMatch.captured(5);
-
             QSharedPointer<Kactus2Group> instanceExtension(new Kactus2Group(InstanceData::SINGLEINSTANCE));
 
-			QString instanceVLNV = instanceMatch.captured(1);
-            if (instanceVLNV.isEmpty() == false)
+            if (instance.vlnv.isEmpty() == false)
             {
-				instanceVLNV = instanceVLNV.remove(0, instanceVLNV.indexOf(vlnvIdentifier) + vlnvIdentifier.size()).simplified().remove(" ");
-				
                 QSharedPointer<Kactus2Value> componentVLNVExtension(new Kactus2Value(
-					InstanceData::COMPONENTVLNV, instanceVLNV));
+					InstanceData::COMPONENTVLNV, instance.vlnv));
 
 				instanceExtension->addToGroup(componentVLNVExtension);
             }
             QSharedPointer<Kactus2Value> instanceNameExtension(new Kactus2Value(
-                InstanceData::INSTANCENAME, instanceName));
+                InstanceData::INSTANCENAME, instance.instanceName));
             QSharedPointer<Kactus2Value> moduleExtension(new Kactus2Value(
-                InstanceData::MODULENAME, instanceModuleName));
+                InstanceData::MODULENAME, instance.moduleName));
 
             instanceExtension->addToGroup(instanceNameExtension);
             instanceExtension->addToGroup(moduleExtension);
 
-            if (!parameterDeclarations.isEmpty())
+            QSharedPointer<Kactus2Group> parameterGroup = createSubItemGroup(
+                InstanceData::PARAMETERS, InstanceData::SINGLEPARAMETER, instance.parameters);
+            if (parameterGroup)
             {
-                QVector<QPair<QString, QString> > instanceParameters = getSeparatedSubItems(parameterDeclarations);
-                QSharedPointer<Kactus2Group> parameterGroup = createSubItemGroup(
-                    InstanceData::PARAMETERS, InstanceData::SINGLEPARAMETER, instanceParameters);
-                if (parameterGroup)
-                {
-                    instanceExtension->addToGroup(parameterGroup);
-                }
+                instanceExtension->addToGroup(parameterGroup);
             }
 
-            if (!connectionDeclarations.isEmpty())
+            QSharedPointer<Kactus2Group> connectionGroup = createSubItemGroup(
+                InstanceData::CONNECTIONS, InstanceData::SINGLECONNECTION, instance.connections);
+            if (connectionGroup)
             {
-                QVector<QPair<QString, QString> > instanceConnections = getSeparatedSubItems(connectionDeclarations);
-                QSharedPointer<Kactus2Group> connectionGroup = createSubItemGroup(
-                    InstanceData::CONNECTIONS, InstanceData::SINGLECONNECTION, instanceConnections);
-                if (connectionGroup)
-                {
-                    instanceExtension->addToGroup(connectionGroup);
-                }
+                instanceExtension->addToGroup(connectionGroup);
             }
 
             instancesGroup->addToGroup(instanceExtension);
@@ -114,36 +108,27 @@ void VerilogInstanceParser::import(QString const& input, QString const& componen
 //-----------------------------------------------------------------------------
 // Function: VerilogInstanceParser::findInstances()
 //-----------------------------------------------------------------------------
-QVector<QRegularExpressionMatch> VerilogInstanceParser::findInstances(QString const& input,
+QVector<VerilogInstanceParser::InstanceDeclaration> VerilogInstanceParser::findInstances(QString const& input,
     QString const& componentDeclaration)
 {
-    QVector<QRegularExpressionMatch> instances;
-    QString inspect = componentDeclaration;
+    QVector<InstanceDeclaration> instances;
 
-    QRegularExpression multilineComment(VerilogSyntax::MULTILINE_COMMENT);
-//     QRegularExpression strayComment(VerilogSyntax::COMMENT);
-//     inspect = inspect.remove(VerilogSyntax::COMMENTLINE).remove(multilineComment).remove(strayComment);
-    QRegularExpression commentsWithoutVLNVs("[\\n\\r]?[\\t\\f\\cK ]*[/]{2}(?! IP-XACT VLNV:).*");
-    inspect = inspect.remove(commentsWithoutVLNVs).remove(multilineComment);
+    HDLLexer lexer(componentDeclaration, HDLLexer::Language::Verilog);
+    int declarationPosition = input.indexOf(componentDeclaration);
 
-    QString VLNVString = "(\\/\\/\\s*IP-XACT VLNV:\\s*.*\\s*)?";
-    QString expressionString =
-        "\\b([a-zA-Z_][\\w$]*)(\\s+#(?:(?:.|\\n)(?!(?:[)]\\s*[a-zA-Z_]|;)))*(?:.|\\n)\\))?\\s+([a-zA-Z_][\\w$]*)\\s*(\\((?:(?:.|\\n)(?!\\);))*\\s*\\)+;)";
-    expressionString = VLNVString + expressionString;
-    QRegularExpression instanceExpression(expressionString);
-    QRegularExpressionMatchIterator instanceMatchIterator = instanceExpression.globalMatch(inspect);
-
-    QRegularExpressionMatchIterator multilineCommentIterator = multilineComment.globalMatch(input);
-
-    while (instanceMatchIterator.hasNext())
+    for (int i = 0; i < lexer.count(); i = lexer.next(i))
     {
-        QRegularExpressionMatch instanceMatch = instanceMatchIterator.next();
-
-        QString instanceModuleName = instanceMatch.captured(1);
-		if (instanceMatch.captured(2).compare(QStringLiteral("module"), Qt::CaseInsensitive) != 0)
+        QVector<int> nameIndexes;
+        int instantiationEnd = parseInstances(lexer, i, instances, nameIndexes);
+        if (instantiationEnd != -1)
         {
-            instances.append(instanceMatch);
-            highlightInstance(input, componentDeclaration, instanceMatch, multilineCommentIterator);
+            highlightToken(lexer, i, declarationPosition);
+            for (int nameIndex : nameIndexes)
+            {
+                highlightToken(lexer, nameIndex, declarationPosition);
+            }
+
+            i = instantiationEnd;
         }
     }
 
@@ -151,92 +136,163 @@ QVector<QRegularExpressionMatch> VerilogInstanceParser::findInstances(QString co
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogInstanceParser::highlightInstance()
+// Function: VerilogInstanceParser::parseInstances()
 //-----------------------------------------------------------------------------
-void VerilogInstanceParser::highlightInstance(QString const& input, QString const& /*moduleDeclaration*/,
-    QRegularExpressionMatch const& instanceMatch, QRegularExpressionMatchIterator const& multilineCommentIterator)
+int VerilogInstanceParser::parseInstances(HDLLexer const& lexer, int moduleIndex,
+    QVector<InstanceDeclaration>& instances, QVector<int>& nameIndexes) const
 {
-    QString instanceModuleName = instanceMatch.captured(2);
-    QString instanceName = instanceMatch.captured(4);
+    auto isName = [&lexer](int index)
+    {
+        if (index >= lexer.count() || lexer.token(index).type != HDLLexer::TokenType::Identifier)
+        {
+            return false;
+        }
+
+        QChar first = lexer.text(index).front();
+        return (first.isLetter() || first == QLatin1Char('_')) &&
+            VerilogSyntax::KEYWORDS.contains(lexer.text(index)) == false;
+    };
+
+    if (isName(moduleIndex) == false)
+    {
+        return -1;
+    }
+
+    // Instantiations are statements, so they cannot follow other identifiers except block keywords and labels.
+    int previous = lexer.previous(moduleIndex);
+    if (previous >= 0 && lexer.token(previous).type == HDLLexer::TokenType::Identifier &&
+        STATEMENT_KEYWORDS.contains(lexer.text(previous)) == false &&
+        lexer.isOperator(lexer.previous(previous), QStringLiteral(":")) == false)
+    {
+        return -1;
+    }
 
-    QRegularExpression inputInstanceExpression("\\b(" + instanceModuleName +
-        "\\s+(?:[^;])*?" +
-        instanceName + ")\\s*(\\((?:(?:.|\\n)(?!\\);))*\\s*\\)+;)", QRegularExpression::DotMatchesEverythingOption);
+    int parametersBegin = -1;
 
-    QRegularExpressionMatchIterator instanceIntroductionIterator = inputInstanceExpression.globalMatch(input);
-    while (instanceIntroductionIterator.hasNext())
+    int index = lexer.next(moduleIndex);
+    if (lexer.isOperator(index, QStringLiteral("#")))
     {
-        QRegularExpressionMatch instanceIntroductionMatch = instanceIntroductionIterator.next();
-        if (!matchIsWithinComments(instanceIntroductionMatch, multilineCommentIterator))
+        parametersBegin = lexer.next(index);
+        if (lexer.isOperator(parametersBegin, QStringLiteral("(")) == false || lexer.matching(parametersBegin) == -1)
         {
-            QString matchedIntroduction = instanceIntroductionMatch.captured(1);
-            int instanceModuleBeginIndex =
-                instanceIntroductionMatch.capturedStart() + matchedIntroduction.indexOf(instanceModuleName);
-            int instanceModuleEndIndex = instanceModuleBeginIndex + instanceModuleName.length();
-
-            int instanceNameBeginIndex =
-                instanceIntroductionMatch.capturedStart() + matchedIntroduction.lastIndexOf(instanceName);
-            int instanceNameEndIndex = instanceNameBeginIndex + instanceName.length();
-
-            highlighter_->applyHighlight(
-                instanceModuleBeginIndex, instanceModuleEndIndex, KactusColors::Importer::INSTANCECOLOR);
-            highlighter_->applyHighlight(
-                instanceNameBeginIndex, instanceNameEndIndex, KactusColors::Importer::INSTANCECOLOR);
+            return -1;
         }
+
+        index = lexer.next(lexer.matching(parametersBegin));
     }
-}
 
-//-----------------------------------------------------------------------------
-// Function: VerilogInstanceParser::matchIsWithinComments()
-//-----------------------------------------------------------------------------
-bool VerilogInstanceParser::matchIsWithinComments(QRegularExpressionMatch const& expressionMatch,
-    QRegularExpressionMatchIterator commentMatchIterator) const
-{
-    int expressionStart = expressionMatch.capturedStart();
+    // The VLNV of the instantiated component may be given in a comment directly before the instance.
+    QString vlnv;
+    if (moduleIndex > 0 && lexer.token(moduleIndex - 1).type == HDLLexer::TokenType::Comment)
+    {
+        QString comment = lexer.text(moduleIndex - 1).toString();
+        int identifierIndex = comment.indexOf(VLNV_IDENTIFIER);
+        if (identifierIndex != -1)
+        {
+            vlnv = comment.mid(identifierIndex + VLNV_IDENTIFIER.size()).simplified().remove(QLatin1Char(' '));
+        }
+    }
 
-    while (commentMatchIterator.hasNext())
+    QVector<InstanceDeclaration> parsedInstances;
+    QVector<int> parsedNames;
+    while (isName(index))
     {
-        QRegularExpressionMatch commentMatch = commentMatchIterator.next();
-        int commentStart = commentMatch.capturedStart();
-        int commentEnd = commentMatch.capturedEnd();
+        int nameIndex = index;
+
+        // Skip the range of an instance array.
+        index = lexer.next(nameIndex);
+        if (lexer.isOperator(index, QStringLiteral("[")) && lexer.matching(index) != -1)
+        {
+            index = lexer.next(lexer.matching(index));
+        }
+
+        if (lexer.isOperator(index, QStringLiteral("(")) == false || lexer.matching(index) == -1)
+        {
+            return -1;
+        }
+
+        InstanceDeclaration instance;
+        instance.moduleName = lexer.text(moduleIndex).toString();
+        instance.instanceName = lexer.text(nameIndex).toString();
+        instance.vlnv = vlnv;
+        instance.connections = getSeparatedSubItems(lexer, index);
 
-        if (expressionStart > commentStart && expressionStart < commentEnd)
+        parsedInstances.append(instance);
+        parsedNames.append(nameIndex);
+
+        index = lexer.next(lexer.matching(index));
+        if (lexer.isOperator(index, QStringLiteral(";")))
+        {
+            if (parametersBegin != -1)
+            {
+                QVector<QPair<QString, QString> > parameters = getSeparatedSubItems(lexer, parametersBegin);
+                for (InstanceDeclaration& parsedInstance : parsedInstances)
+                {
+                    parsedInstance.parameters = parameters;
+                }
+            }
+
+            instances.append(parsedInstances);
+            nameIndexes.append(parsedNames);
+            return index;
+        }
+        else if (lexer.isOperator(index, QStringLiteral(",")))
         {
-            return true;
+            index = lexer.next(index);
+        }
+        else
+        {
+            return -1;
         }
     }
 
-    return false;
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogInstanceParser::highlightToken()
+//-----------------------------------------------------------------------------
+void VerilogInstanceParser::highlightToken(HDLLexer const& lexer, int index, int declarationPosition)
+{
+    if (highlighter_ && declarationPosition != -1)
+    {
+        HDLLexer::Token const& token = lexer.token(index);
+        highlighter_->applyHighlight(declarationPosition + token.position, declarationPosition + token.end(),
+            KactusColors::Importer::INSTANCECOLOR);
+    }
 }
 
 //-----------------------------------------------------------------------------
 // Function: VerilogInstanceParser::getSeparatedSubItems()
 //-----------------------------------------------------------------------------
-QVector<QPair<QString, QString> > VerilogInstanceParser::getSeparatedSubItems(QString& subItemDeclarations) const
+QVector<QPair<QString, QString> > VerilogInstanceParser::getSeparatedSubItems(HDLLexer const& lexer,
+    int listBegin) const
 {
     QVector<QPair<QString, QString> > subItemReDeclarations;
 
-    QRegularExpression subItemSeparatorExpression(QStringLiteral("((?:.(?!\\())*.)(.*)"));
-
-    QRegularExpression subItemExpression(QStringLiteral("\\.(?:(.|\\s)(?!(,|(\\)\\s*\\s))))*.*\\)"));
-    QRegularExpressionMatchIterator subItemMatchIterator = subItemExpression.globalMatch(subItemDeclarations);
-
-    while (subItemMatchIterator.hasNext())
+    // Only named sub items e.g. .name(value) are supported.
+    int listEnd = lexer.matching(listBegin);
+    for (int i = lexer.next(listBegin); i < listEnd; i = lexer.next(i))
     {
-        QRegularExpressionMatch subItemMatch = subItemMatchIterator.next();
-        QString subItemText = subItemMatch.captured().remove(0, 1);
-
-        QRegularExpressionMatch separatedSubItemMatch = subItemSeparatorExpression.match(subItemText);
-        QString subItemName = separatedSubItemMatch.captured(1).simplified();
-        QString subItemValue = separatedSubItemMatch.captured(2).remove(0, 1);
-        subItemValue.chop(1);
-        subItemValue = subItemValue.simplified();
+        int nameIndex = lexer.next(i);
+        int valueBegin = lexer.next(nameIndex);
+        if (lexer.isOperator(i, QStringLiteral(".")) && nameIndex < listEnd &&
+            lexer.token(nameIndex).type == HDLLexer::TokenType::Identifier &&
+            lexer.isOperator(valueBegin, QStringLiteral("(")) && lexer.matching(valueBegin) != -1)
+        {
+            int valueEnd = lexer.matching(valueBegin);
 
-        QPair<QString, QString> subItem;
-        subItem.first = subItemName;
-        subItem.second = subItemValue;
+            QPair<QString, QString> subItem;
+            subItem.first = lexer.text(nameIndex).toString();
+            subItem.second = lexer.simplifiedText(valueBegin + 1, valueEnd - 1);
 
-        subItemReDeclarations.append(subItem);
+            subItemReDeclarations.append(subItem);
+            i = valueEnd;
+        }
+        else if (lexer.matching(i) > i)
+        {
+            i = lexer.matching(i);
+        }
     }
 
     return subItemReDeclarations;
@@ -14,10 +14,13 @@
 
 #include <KactusAPI/include/HighlightSource.h>
 
+#include <QPair>
 #include <QSharedPointer>
-#include <QRegularExpressionMatchIterator>
+#include <QString>
+#include <QVector>
 
 class Component;
+class HDLLexer;
 class Kactus2Group;
 
 //-----------------------------------------------------------------------------
@@ -60,47 +63,66 @@ public:
 
 private:
 
+    //! A component instance found in the component declaration.
+    struct InstanceDeclaration
+    {
+        //! The name of the instantiated module.
+        QString moduleName;
+
+        //! The name of the instance.
+        QString instanceName;
+
+        //! The VLNV given in a comment preceding the instance.
+        QString vlnv;
+
+        //! The parameter name value pairs of the instance.
+        QVector<QPair<QString, QString> > parameters;
+
+        //! The port connection name value pairs of the instance.
+        QVector<QPair<QString, QString> > connections;
+    };
+
     /*!
-     *  Find matches for the component instances in the selected verilog file.
+     *  Find the component instances in the selected component declaration and highlight them.
      *
      *    @param [in] input                   The selected verilog file.
      *    @param [in] componentDeclaration    The selected component declaration.
      *
-     *    @return List of component instance matches.
+     *    @return List of component instances.
      */
-    QVector<QRegularExpressionMatch> findInstances(QString const& input, QString const& componentDeclaration);
+    QVector<InstanceDeclaration> findInstances(QString const& input, QString const& componentDeclaration);
 
     /*!
-     *  Highlight the selected component instance.
+     *  Parses the instances of a module beginning in the given token.
+     *
+     *    @param [in] lexer           The tokenized component declaration.
+     *    @param [in] moduleIndex     The index of the token containing the module name.
+     *    @param [out] instances      The parsed instances.
+     *    @param [out] nameIndexes    The token indexes of the parsed instance names.
      *
-     *    @param [in] input                       The selected verilog file.
-     *    @param [in] moduleDeclaration           The selected component declaration.
-     *    @param [in] instanceMatch               The selected component instance match.
-     *    @param [in] multilineCommentIterator    Regular expression Match iterator for multi line comments.
+     *    @return The index of the semicolon ending the instantiation, or -1 if the tokens are not an instantiation.
      */
-    void highlightInstance(QString const& input, QString const& moduleDeclaration,
-        QRegularExpressionMatch const& instanceMatch,
-        QRegularExpressionMatchIterator const& multilineCommentIterator);
+    int parseInstances(HDLLexer const& lexer, int moduleIndex, QVector<InstanceDeclaration>& instances,
+        QVector<int>& nameIndexes) const;
 
     /*!
-     *  Check if a regular expression match is located within comments.
-     *
-     *    @param [in] expressionMatch         The selected regular expression match.
-     *    @param [in] commentMatchIterator    Regular expression Match iterator for multi line comments.
+     *  Highlight a token in the component declaration.
      *
-     *    @return True, if the match is located within comments, false otherwise.
+     *    @param [in] lexer                   The tokenized component declaration.
+     *    @param [in] index                   The index of the token to highlight.
+     *    @param [in] declarationPosition     The position of the component declaration in the input.
      */
-    bool matchIsWithinComments(QRegularExpressionMatch const& expressionMatch,
-        QRegularExpressionMatchIterator commentMatchIterator) const;
+    void highlightToken(HDLLexer const& lexer, int index, int declarationPosition);
 
     /*!
      *  Get a list of separated sub items and their values from the selected sub item declarations.
      *
-     *    @param [in] subItemDeclarations     The selected sub item declarations.
+     *    @param [in] lexer           The tokenized component declaration.
+     *    @param [in] listBegin       The index of the opening parenthesis of the sub item declarations.
      *
      *    @return List of sub item name value pairs.
      */
-    QVector<QPair<QString, QString> > getSeparatedSubItems(QString& subItemDeclarations) const;
+    QVector<QPair<QString, QString> > getSeparatedSubItems(HDLLexer const& lexer, int listBegin) const;
 
     /*!
      *  Create a vendor extension group for the contained sub items.
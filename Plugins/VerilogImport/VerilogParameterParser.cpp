@@ -23,7 +23,7 @@
 
 #include <KactusAPI/include/IPXactSystemVerilogParser.h>
 
-#include <common/expressions/utilities.h>
+#include <Plugins/common/HDLLexer.h>
 
 #include <QList>
 #include <QString>
@@ -62,9 +62,9 @@ void VerilogParameterParser::setHighlighter(Highlighter* highlighter)
 // Function: VerilogParameterParser::import()
 //-----------------------------------------------------------------------------
 void VerilogParameterParser::import(QString const& componentDeclaration, QSharedPointer<Component> targetComponent,
-    QSharedPointer<ComponentInstantiation> targetComponentInstantiation)
+    QSharedPointer<ComponentInstantiation> targetComponentInstantiation, int declarationPosition)
 {
-    auto declarations = findDeclarations(componentDeclaration);
+    auto declarations = findDeclarations(componentDeclaration, declarationPosition);
 
     QList<QPair<QSharedPointer<ModuleParameter>, QString> > parsedParameters; // For mapping parameter type (localparam/parameter) to parsed parameter
     for (auto const& declaration : declarations)
@@ -111,43 +111,38 @@ void VerilogParameterParser::import(QString const& componentDeclaration, QShared
 //-----------------------------------------------------------------------------
 // Function: VerilogParameterParser::findDeclarations()
 //-----------------------------------------------------------------------------
-// QStringList VerilogParameterParser::findDeclarations(QString const& input)
-QList<VerilogParameterParser::ParameterDeclaration> VerilogParameterParser::findDeclarations(QString const& input)
+QList<VerilogParameterParser::ParameterDeclaration> VerilogParameterParser::findDeclarations(QString const& input,
+    int inputPosition)
 {    
-    return findParameterDeclarations(input, findParameterSection(input));
+    HDLLexer lexer(input, HDLLexer::Language::Verilog);
+
+    QPair<int, int> section = findParameterSection(lexer);
+    return findParameterDeclarations(lexer, section.first, section.second, inputPosition);
 }
 
 //-----------------------------------------------------------------------------
 // Function: VerilogParameterParser::findParameterSection()
 //-----------------------------------------------------------------------------
-QString VerilogParameterParser::findParameterSection(QString const &input)
+QPair<int, int> VerilogParameterParser::findParameterSection(HDLLexer const& lexer) const
 {
-    QString inspect = VerilogSyntax::cullStrayComments(input);
-
     // Priority on parameters declared in ANSI-style at module header.
     // Otherwise, search the whole input.
-    QRegularExpression parameterStart(QStringLiteral("#\\s*[(]"));
-    QRegularExpressionMatch match = parameterStart.match(inspect);
-
-    int beginIndex = match.capturedEnd();
-    int endIndex = -1;
-    if (beginIndex != -1)
+    int moduleIndex = 0;
+    while (moduleIndex < lexer.count() && lexer.isWord(moduleIndex, QStringLiteral("module")) == false &&
+        lexer.isWord(moduleIndex, QStringLiteral("macromodule")) == false)
     {
-        endIndex =
-            ExpressionUtilities::findMatchingEndParenthesis(inspect, beginIndex - 1, VerilogSyntax::COMMENT);
+        ++moduleIndex;
     }
 
-    int length = input.length();
-    if (beginIndex == -1)
+    int parameterStart = lexer.next(lexer.next(moduleIndex));
+    int listBegin = lexer.next(parameterStart);
+    if (lexer.isOperator(parameterStart, QStringLiteral("#")) && lexer.isOperator(listBegin, QStringLiteral("(")) &&
+        lexer.matching(listBegin) != -1)
     {
-        ++length;
-    }
-    else if (endIndex != -1)
-    {
-        length = endIndex - beginIndex;
+        return qMakePair(listBegin + 1, lexer.matching(listBegin));
     }
 
-    return inspect.mid(beginIndex, length);
+    return qMakePair(0, lexer.count());
 }
 
 //-----------------------------------------------------------------------------
@@ -236,44 +231,66 @@ QString VerilogParameterParser::createTypeFromDataType(QString const& dataType)
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::findDeclarations()
+// Function: VerilogParameterParser::findParameterDeclarations()
 //-----------------------------------------------------------------------------
-// QStringList VerilogParameterParser::findParameterDeclarations(QString const& componentDeclaration,
-QList<VerilogParameterParser::ParameterDeclaration > VerilogParameterParser::findParameterDeclarations(QString const& componentDeclaration,
-    QString const& parameterArea)
+QList<VerilogParameterParser::ParameterDeclaration> VerilogParameterParser::findParameterDeclarations(
+    HDLLexer const& lexer, int sectionBegin, int sectionEnd, int inputPosition)
 {
+    auto isDeclarationKeyword = [&lexer](int index)
+    {
+        return lexer.isWord(index, QStringLiteral("parameter")) || lexer.isWord(index, QStringLiteral("localparam"));
+    };
+
     // List of detected parameter declarations.
     QList<ParameterDeclaration> declarations;
 
-    // Rule used to detect parameter declarations.
-    QRegularExpression declarationRule("\\b(localparam|parameter)\\s+.*(?:"
-        "(;[ \\t]*" + VerilogSyntax::COMMENT + ")|"
-        "(;|$)|"
-        "(,([ \\t]*" + VerilogSyntax::COMMENT +")?(?=\\s*\\b(?:localparam|parameter)\\b)))",
-        QRegularExpression::CaseInsensitiveOption | QRegularExpression::InvertedGreedinessOption |
-        QRegularExpression::DotMatchesEverythingOption);
-    
-    QRegularExpression commentBegin(QStringLiteral("//"));
-    QRegularExpression lineBegin(QStringLiteral("^|\\r?\\n"));
-
-    QRegularExpressionMatchIterator iter = declarationRule.globalMatch(parameterArea);
-    while (iter.hasNext())
-    {        
-        QRegularExpressionMatch match = iter.next();
-        auto fullDeclaration = match.captured();
-        auto paramType = match.captured(1); // get the param type: localparam or parameter
-        int declarationBegin = match.capturedStart();
-
-        // Check keyword parameter is not inside a comment.
-        if (parameterArea.lastIndexOf(lineBegin, declarationBegin) > parameterArea.lastIndexOf(commentBegin, declarationBegin))
+    for (int declarationBegin = sectionBegin; declarationBegin < sectionEnd; ++declarationBegin)
+    {
+        if (isDeclarationKeyword(declarationBegin) == false)
+        {
+            continue;
+        }
+
+        // The declaration ends in a semicolon, before the next declaration or at the end of the section.
+        int declarationEnd = -1;
+        int index = lexer.next(declarationBegin);
+        while (declarationEnd == -1)
         {
-            if (highlighter_)
+            if (index >= sectionEnd || isDeclarationKeyword(index) || lexer.isWord(index, QStringLiteral("endmodule")))
+            {
+                declarationEnd = lexer.previous(qMin(index, sectionEnd));
+            }
+            else if (lexer.isOperator(index, QStringLiteral(";")) || (lexer.isOperator(index, QStringLiteral(",")) &&
+                (lexer.next(index) >= sectionEnd || isDeclarationKeyword(lexer.next(index)))))
             {
-                highlighter_->applyHighlight(fullDeclaration, KactusColors::Importer::MODELPARAMETER, componentDeclaration);
+                declarationEnd = index;
             }
+            else
+            {
+                // Skip nested expressions e.g. concatenations and ranges.
+                index = lexer.next(qMax(index, lexer.matching(index)));
+            }
+        }
 
-            declarations.append(ParameterDeclaration{paramType, fullDeclaration});
+        // Include a comment on the same line as the description.
+        int commentIndex = declarationEnd + 1;
+        if (commentIndex < sectionEnd && lexer.token(commentIndex).type == HDLLexer::TokenType::Comment &&
+            lexer.onSameLine(lexer.token(declarationEnd).end(), lexer.token(commentIndex).position))
+        {
+            declarationEnd = commentIndex;
+        }
+
+        QString fullDeclaration = lexer.slice(declarationBegin, declarationEnd);
+        if (highlighter_ && inputPosition != -1)
+        {
+            highlighter_->applyHighlight(inputPosition + lexer.token(declarationBegin).position,
+                inputPosition + lexer.token(declarationEnd).end(), KactusColors::Importer::MODELPARAMETER);
         }
+
+        declarations.append(ParameterDeclaration{lexer.text(declarationBegin).toString(),
+            VerilogSyntax::cullStrayComments(fullDeclaration)});
+
+        declarationBegin = declarationEnd;
     }
 
     return declarations;
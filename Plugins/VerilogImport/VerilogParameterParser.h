@@ -23,6 +23,7 @@
 #include "IPXACTmodels/Component/ComponentInstantiation.h"
 
 class Component;
+class HDLLexer;
 
 //-----------------------------------------------------------------------------
 //! Parser for Verilog parameters.
@@ -54,9 +55,11 @@ public:
      *    @param [in] componentDeclaration            The selected component declaration from the input text.
      *    @param [in] targetComponent                 The component to add all the imported parameters to.
      *    @param [in] targetComponentInstantiation    The instantiation to add all the imported parameters to.
+     *    @param [in] declarationPosition             The position of the component declaration in the
+     *                                                highlighted text.
      */
     virtual void import(QString const& componentDeclaration, QSharedPointer<Component> targetComponent,
-        QSharedPointer<ComponentInstantiation> targetComponentInstantiation);
+        QSharedPointer<ComponentInstantiation> targetComponentInstantiation, int declarationPosition = 0);
 
     /*!
      *  Sets the given highlighter to be used by the generic parser.
@@ -68,11 +71,12 @@ public:
     /*!
      *  Finds parameter declarations in the given input.
      *
-     *    @param [in] input   The input text to parse.
+     *    @param [in] input           The input text to parse.
+     *    @param [in] inputPosition   The position of the input in the highlighted text.
      *
      *    @return   The resulting list of parameter declarations.
      */
-    QList<ParameterDeclaration> findDeclarations(QString const& input);
+    QList<ParameterDeclaration> findDeclarations(QString const& input, int inputPosition = 0);
 
     /*!
      *  Parses parameters out of declaration.
@@ -86,24 +90,26 @@ public:
 private:
 
     /*!
-     * Find the section in the input containing the parameter declarations.
+     *  Finds the section in the tokenized input containing the parameter declarations.
      *
-     *    @param [in] input  The input text to search.
+     *    @param [in] lexer   The tokenized input to search.
      *
-     *    @return The section of the text containing parameter declarations.
+     *    @return The first token index of the section and the token index after the section.
      */
-     QString findParameterSection(QString const &input);
+    QPair<int, int> findParameterSection(HDLLexer const& lexer) const;
 
     /*!
-     *  Finds parameter declarations from the given string.
+     *  Finds parameter declarations from the given section of the tokenized input and highlights them.
      *
-     *    @param [in] componentDeclaration    The component declaration containing the parameters.
-     *    @param [in] parameterArea           The input text containing the declarations.     
+     *    @param [in] lexer           The tokenized component declaration containing the parameters.
+     *    @param [in] sectionBegin    The first token index of the section containing the declarations.
+     *    @param [in] sectionEnd      The token index after the section containing the declarations.
+     *    @param [in] inputPosition   The position of the tokenized input in the highlighted text.
      *
      *    @return   The resulting list of declarations.
      */
-    //  QStringList findParameterDeclarations(QString const& componentDeclaration, QString const& parameterArea);
-     QList<ParameterDeclaration> findParameterDeclarations(QString const& componentDeclaration, QString const& parameterArea);
+    QList<ParameterDeclaration> findParameterDeclarations(HDLLexer const& lexer, int sectionBegin, int sectionEnd,
+        int inputPosition);
 
     /*!
      *  Create an IP-XACT type for the parameter according to the given data type.
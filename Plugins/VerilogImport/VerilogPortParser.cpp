@@ -13,6 +13,8 @@
 
 #include "VerilogSyntax.h"
 
+#include <Plugins/common/HDLLexer.h>
+
 #include <common/expressions/utilities.h>
 
 #include <KactusAPI/include/KactusColors.h>
@@ -23,65 +25,60 @@
 #include <IPXACTmodels/Component/Component.h>
 #include <IPXACTmodels/Component/Port.h>
 
+#include <QHash>
+#include <QSet>
 #include <QString>
 #include <QRegularExpression>
 
 namespace
 {
-    //! Verilog port directions.
-    const QString PORT_DIRECTION("input|output|inout");
-
-    //! Verilog port types.
-    const QString PORT_TYPE("\\w+");
-
-    //! Subset of Verilog preprocessor commands.
-    const QString PREPROCESSOR_COMMAND("`(?:ifdef|ifndef|endif)[^\\r\\n]*");
-
-    //! Port declaration ends if preprocessor command is found. Preceding comment will be included.
-    const QString END_BEFORE_PREPROCESSOR("(?:[ \\t]*" + VerilogSyntax::COMMENT + ")?"
-        "(?=\\s*" + PREPROCESSOR_COMMAND + ")");
-
-    //! Port declaration ends if next port declaration is found.
-    const QString END_BEFORE_NEXT_ITEM("\\s*[,;][ \\t]*(?:"+ VerilogSyntax::COMMENT + ")?");
-
-    //! Port declaration ends if no more ports follow the declaration.
-    const QString LAST_PORT("(?:[ \\t]*" + VerilogSyntax::COMMENT + ")?(?=\\s*$)");
-
-    //! Port declaration must end with one of the conditions above.
-    const QString PORT_DECLARATION_END("(?:" + END_BEFORE_PREPROCESSOR + ")|"
-        "(?:" + END_BEFORE_NEXT_ITEM + ")|"
-        "(?:" + LAST_PORT +")");
-
-    //! Verilog ports in both ANSI-C and Verilog-1995 style.
-    const QRegularExpression PORT_EXP("(" + PORT_DIRECTION + ")\\s+(?:wire\\s+)?(?:(" + PORT_TYPE + ")\\s+)?"
-        "(?:signed)?\\s*(?:(" + VerilogSyntax::RANGE +")?\\s*(" + VerilogSyntax::RANGE + "))?\\s*"
-        "(" + VerilogSyntax::NAMES + ")(?:" + PORT_DECLARATION_END + ")");
-
-    //! Verilog ports in Verilog-1995 style.
-    const QRegularExpression PORT_1995("(" + PORT_DIRECTION + ")\\s+"
-        "(?:(" + PORT_TYPE + ")\\s+)?(" + VerilogSyntax::RANGE + ")?\\s*"
-        "(" + VerilogSyntax::NAMES + ")\\s*[;](?:[ \\t]*"+ VerilogSyntax::COMMENT + ")?");
-
-	//! Declaration for verilog parameters.
-    const QString MODULE_PARAMETER_DECLARATION("\\s*#\\(([\\s\\S]*?)\\)"); // just match the parameter list section, not the stuff inside (allow e.g. system verilog localparams)
-
-    //! Port declaration for Verilog-1995 style.
-    const QString PORT_DECLARATION_1995("\\((\\s*\\w*,)*\\s*\\w+\\s*\\);");
-
-    //! Combination declaration for verilog module and parameters.
-	const QString MODULE_AND_PARAMETERS_DECLARATION(VerilogSyntax::MODULE_BEGIN.pattern() + "(" + MODULE_PARAMETER_DECLARATION + ")?\\s*");
-
-    //! Full declaration for verilog-1995
-    const QString DECLARATION_1995(MODULE_AND_PARAMETERS_DECLARATION + PORT_DECLARATION_1995);
-
-    //! Modified module declaration for use in checking ports
-    const QString NEW_MODULE_DECLARATION("(?:^|\\r?\\n)[ \t]*(?:macro)?module\\s+\\w+");
+    //! Keywords of the Verilog port directions.
+    const QStringList PORT_DIRECTIONS({"input", "output", "inout"});
+
+    /*!
+     *  Checks if the token is a port direction keyword.
+     *
+     *    @param [in] lexer   The tokenized input.
+     *    @param [in] index   The index of the token.
+     *
+     *    @return True, if the token is a port direction, otherwise false.
+     */
+    bool isDirection(HDLLexer const& lexer, int index);
+
+    /*!
+     *  Checks if the token is a simple identifier that can be used as a port name.
+     *
+     *    @param [in] lexer   The tokenized input.
+     *    @param [in] index   The index of the token.
+     *
+     *    @return True, if the token can be a port name, otherwise false.
+     */
+    bool isPortName(HDLLexer const& lexer, int index);
+
+    //-----------------------------------------------------------------------------
+    // Function: isDirection()
+    //-----------------------------------------------------------------------------
+    bool isDirection(HDLLexer const& lexer, int index)
+    {
+        return index < lexer.count() && lexer.token(index).type == HDLLexer::TokenType::Identifier &&
+            PORT_DIRECTIONS.contains(lexer.text(index));
+    }
 
-    //! Everything after module and parameter declaration.
-    const QString MODULE_DECLARATION_REST("\\s*\\([^;]*");
+    //-----------------------------------------------------------------------------
+    // Function: isPortName()
+    //-----------------------------------------------------------------------------
+    bool isPortName(HDLLexer const& lexer, int index)
+    {
+        if (index >= lexer.count() || lexer.token(index).type != HDLLexer::TokenType::Identifier ||
+            isDirection(lexer, index))
+        {
+            return false;
+        }
 
-    //! Full declaration of a verilog module.
-    const QString FULL_MODULE_DECLARATION(NEW_MODULE_DECLARATION + "(" + MODULE_PARAMETER_DECLARATION  + ")?" + MODULE_DECLARATION_REST);
+        // Macro usages, system names and escaped identifiers are not supported as port names.
+        QChar first = lexer.text(index).front();
+        return first.isLetter() || first == QLatin1Char('_');
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -95,7 +92,7 @@ VerilogPortParser::VerilogPortParser(): highlighter_(0), parser_(new NullParser)
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::runParser()
 //-----------------------------------------------------------------------------
-void VerilogPortParser::import(QString const& input, QSharedPointer<Component> targetComponent)
+void VerilogPortParser::import(QString const& input, QSharedPointer<Component> targetComponent, int inputPosition)
 {
     //! The existing ports are changed to phantom in order to keep the component error-free.
     //! These ports can then be deleted later.
@@ -104,10 +101,12 @@ void VerilogPortParser::import(QString const& input, QSharedPointer<Component> t
         existingPort->setDirection(DirectionTypes::DIRECTION_PHANTOM);
     }
 
-    foreach (QString portDeclaration, findPortDeclarations(input))
+    HDLLexer lexer(input, HDLLexer::Language::Verilog);
+
+    for (PortDeclaration const& portDeclaration : findPortDeclarations(lexer))
     {
 		createPortFromDeclaration(portDeclaration, targetComponent);
-        highlight(portDeclaration, input);
+        highlight(portDeclaration, inputPosition);
     }
 }
 
@@ -130,207 +129,354 @@ void VerilogPortParser::setExpressionParser(QSharedPointer<ExpressionParser> par
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::findPortDeclarations()
 //-----------------------------------------------------------------------------
-QStringList VerilogPortParser::findPortDeclarations(QString const& input) const
+QVector<VerilogPortParser::PortDeclaration> VerilogPortParser::findPortDeclarations(HDLLexer const& lexer) const
 {
-    QString portSection = findPortsSection(removeIgnoredLines(input));
+    int listBegin = findPortList(lexer);
+    if (listBegin == -1)
+    {
+        return QVector<PortDeclaration>();
+    }
+
+    QStringList verilog1995PortNames = findVerilog1995PortNames(lexer, listBegin);
+    if (verilog1995PortNames.isEmpty() == false)
+    {
+        return findVerilog1995Ports(lexer, listBegin, verilog1995PortNames);
+    }
 
-    return portDeclarationsIn(portSection);
+    return findVerilog2001Ports(lexer, listBegin);
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogPortParser::findPortsSection()
+// Function: VerilogPortParser::findPortList()
 //-----------------------------------------------------------------------------
-QString VerilogPortParser::findPortsSection(QString const& input) const
+int VerilogPortParser::findPortList(HDLLexer const& lexer) const
 {
-    bool noValidModule = input.indexOf(VerilogSyntax::MODULE_BEGIN) == -1 || 
-        input.indexOf(VerilogSyntax::MODULE_END) == -1;
+    int moduleIndex = 0;
+    while (moduleIndex < lexer.count() &&
+        lexer.isWord(moduleIndex, QStringLiteral("module")) == false &&
+        lexer.isWord(moduleIndex, QStringLiteral("macromodule")) == false)
+    {
+        ++moduleIndex;
+    }
+
+    bool hasModuleEnd = false;
+    for (int i = moduleIndex + 1; i < lexer.count() && hasModuleEnd == false; ++i)
+    {
+        hasModuleEnd = lexer.isWord(i, QStringLiteral("endmodule"));
+    }
 
-    if (noValidModule)
+    int nameIndex = lexer.next(moduleIndex);
+    if (hasModuleEnd == false || nameIndex >= lexer.count() ||
+        lexer.token(nameIndex).type != HDLLexer::TokenType::Identifier)
     {
-        return QString();
+        return -1;
     }
 
-    QString portSection;
-    if (hasVerilog1995Ports(input))
+    int index = lexer.next(nameIndex);
+
+    // Skip the parameter declarations.
+    if (lexer.isOperator(index, QStringLiteral("#")) && lexer.isOperator(lexer.next(index), QStringLiteral("(")))
     {
-        portSection = findVerilog1995PortsSectionInModule(input);
+        int parametersEnd = lexer.matching(lexer.next(index));
+        if (parametersEnd == -1)
+        {
+            return -1;
+        }
+
+        index = lexer.next(parametersEnd);
     }
-    else
+
+    if (lexer.isOperator(index, QStringLiteral("(")) && lexer.matching(index) != -1)
     {
-        portSection = findVerilog2001PortsSection(input);
+        return index;
     }
 
-    return portSection;
+    return -1;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogPortParser::hasVerilog1995Ports()
+// Function: VerilogPortParser::findVerilog1995PortNames()
 //-----------------------------------------------------------------------------
-bool VerilogPortParser::hasVerilog1995Ports(QString const& input) const
+QStringList VerilogPortParser::findVerilog1995PortNames(HDLLexer const& lexer, int listBegin) const
 {
-	QString simplifiedAndCommentsRemoved = removeAllComments(input).simplified();
+    int listEnd = lexer.matching(listBegin);
+    if (lexer.isOperator(lexer.next(listEnd), QStringLiteral(";")) == false)
+    {
+        return QStringList();
+    }
 
-    QRegularExpression declaractionExpression(DECLARATION_1995);
-    QRegularExpressionMatch match = declaractionExpression.match(simplifiedAndCommentsRemoved);
+    // The list may only contain names separated by commas.
+    QStringList portNames;
+    bool previousIsName = false;
+    for (int i = lexer.next(listBegin); i < listEnd; i = lexer.next(i))
+    {
+        HDLLexer::TokenType type = lexer.token(i).type;
+        if (type == HDLLexer::TokenType::Identifier && previousIsName == false && isDirection(lexer, i) == false)
+        {
+            portNames.append(lexer.text(i).toString());
+            previousIsName = true;
+        }
+        else if (lexer.isOperator(i, QStringLiteral(",")))
+        {
+            previousIsName = false;
+        }
+        else if (type != HDLLexer::TokenType::Directive)
+        {
+            return QStringList();
+        }
+    }
 
-    return match.hasMatch();
+    return portNames;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogPortParser::removeAllComments()
+// Function: VerilogPortParser::findVerilog1995Ports()
 //-----------------------------------------------------------------------------
-QString VerilogPortParser::removeAllComments(QString const& input) const
+QVector<VerilogPortParser::PortDeclaration> VerilogPortParser::findVerilog1995Ports(HDLLexer const& lexer,
+    int listBegin, QStringList const& portNames) const
 {
-    auto commentsRemoved = input;
-    return commentsRemoved.remove(VerilogSyntax::MULTILINE_COMMENT).remove(QRegularExpression("\\/\\/.*"));
+    QSet<QString> listedNames(portNames.cbegin(), portNames.cend());
+
+    QVector<PortDeclaration> declarations;
+    QHash<QString, int> declarationForName;
+
+    bool inSubroutine = false;
+    for (int i = lexer.next(lexer.next(lexer.matching(listBegin))); i < lexer.count() &&
+        lexer.isWord(i, QStringLiteral("endmodule")) == false; i = lexer.next(i))
+    {
+        // Function and task inputs are not module ports.
+        if (lexer.isWord(i, QStringLiteral("function")) || lexer.isWord(i, QStringLiteral("task")))
+        {
+            inSubroutine = true;
+        }
+        else if (lexer.isWord(i, QStringLiteral("endfunction")) || lexer.isWord(i, QStringLiteral("endtask")))
+        {
+            inSubroutine = false;
+        }
+        else if (inSubroutine == false && isDirection(lexer, i))
+        {
+            PortDeclaration declaration;
+            int declarationEnd = parseDeclaration(lexer, i, lexer.count(), true, declaration);
+            if (declarationEnd == -1)
+            {
+                continue;
+            }
+
+            for (QString const& name : declaration.names)
+            {
+                if (listedNames.contains(name) && declarationForName.contains(name) == false)
+                {
+                    declarationForName.insert(name, declarations.size());
+                }
+            }
+
+            declarations.append(declaration);
+            i = declarationEnd;
+        }
+    }
+
+    // Declarations are created in the order of the port list.
+    QVector<PortDeclaration> orderedDeclarations;
+    QSet<int> addedDeclarations;
+    for (QString const& name : portNames)
+    {
+        int declarationIndex = declarationForName.value(name, -1);
+        if (declarationIndex != -1 && addedDeclarations.contains(declarationIndex) == false)
+        {
+            orderedDeclarations.append(declarations.at(declarationIndex));
+            addedDeclarations.insert(declarationIndex);
+        }
+    }
+
+    return orderedDeclarations;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogPortParser::findStartOfPortList()
+// Function: VerilogPortParser::findVerilog2001Ports()
 //-----------------------------------------------------------------------------
-int VerilogPortParser::findStartOfPortList(QString const& input) const
+QVector<VerilogPortParser::PortDeclaration> VerilogPortParser::findVerilog2001Ports(HDLLexer const& lexer,
+    int listBegin) const
 {
-    auto portStartIndex = -1;
+    QVector<PortDeclaration> declarations;
 
-    QRegularExpression moduleExpression(FULL_MODULE_DECLARATION);
-	if (auto moduleMatch = moduleExpression.match(input); moduleMatch.hasMatch())
+    int listEnd = lexer.matching(listBegin);
+    for (int i = lexer.next(listBegin); i < listEnd; i = lexer.next(i))
     {
-        auto moduleDeclaration = moduleMatch.captured();
-
-        QRegularExpression moduleAndParameterExpression(NEW_MODULE_DECLARATION + "(" + MODULE_PARAMETER_DECLARATION + ")?");
-		auto moduleWithoutPortsMatch = moduleAndParameterExpression.match(moduleDeclaration);
-        if (moduleWithoutPortsMatch.hasMatch())
+        if (isDirection(lexer, i))
+        {
+            PortDeclaration declaration;
+            int declarationEnd = parseDeclaration(lexer, i, listEnd, false, declaration);
+            if (declarationEnd != -1)
+            {
+                declarations.append(declaration);
+                i = declarationEnd;
+            }
+        }
+        else if (lexer.matching(i) > i)
         {
-			auto moduleBeginIndex = moduleMatch.capturedStart();
-            portStartIndex = moduleBeginIndex + moduleWithoutPortsMatch.capturedEnd();
+            // Skip nested expressions.
+            i = lexer.matching(i);
         }
     }
 
-    return portStartIndex;
+    return declarations;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogPortParser::findVerilog1995PortsSectionInModule()
+// Function: VerilogPortParser::parseDeclaration()
 //-----------------------------------------------------------------------------
-QString VerilogPortParser::findVerilog1995PortsSectionInModule(QString const& input) const
-{    
-    QString section = input;
-
-	QRegularExpression fullModuleExpression(FULL_MODULE_DECLARATION);
-    QString portDeclaration = "";
-    if (auto moduleMatch = fullModuleExpression.match(input); moduleMatch.hasMatch())
+int VerilogPortParser::parseDeclaration(HDLLexer const& lexer, int directionIndex, int listEnd,
+    bool verilog1995, PortDeclaration& declaration) const
+{
+    auto isIdentifierOrRange = [&lexer](int index)
     {
-        //! This can be used to find the port definitions from the declaration.
-        //! Just remove the module and parameter declarations. What is left is the port declarations.
-        portDeclaration = moduleMatch.captured();
+        return index < lexer.count() && (lexer.token(index).type == HDLLexer::TokenType::Identifier ||
+            lexer.isOperator(index, QStringLiteral("[")));
+    };
 
-        QRegularExpression moduleExpression(NEW_MODULE_DECLARATION);
-        QRegularExpression parameterExpression(MODULE_PARAMETER_DECLARATION);
+    declaration.direction = parseDirection(lexer.text(directionIndex));
 
-        portDeclaration.remove(moduleExpression);
-        portDeclaration.remove(parameterExpression);
+    // Verilog-1995 declarations may have only one of wire, type or signed.
+    int qualifierCount = 0;
 
-        portDeclaration = removeAllComments(portDeclaration).simplified().remove(" ");
-        portDeclaration = portDeclaration.mid(1, portDeclaration.size() - 2);
+    int index = lexer.next(directionIndex);
+    if (lexer.isWord(index, QStringLiteral("wire")) && isIdentifierOrRange(lexer.next(index)))
+    {
+        index = lexer.next(index);
+        ++qualifierCount;
     }
 
-	auto startOfDeclaration = findStartOfPortList(section);
-	auto endOfModule = section.indexOf(VerilogSyntax::MODULE_END, startOfDeclaration);
+    if (isPortName(lexer, index))
+    {
+        int typeEnd = index;
+        while (lexer.isOperator(lexer.next(typeEnd), QStringLiteral("::")) &&
+            isPortName(lexer, lexer.next(lexer.next(typeEnd))))
+        {
+            typeEnd = lexer.next(lexer.next(typeEnd));
+        }
 
-    section = input.mid(startOfDeclaration, endOfModule - startOfDeclaration);
+        if (isIdentifierOrRange(lexer.next(typeEnd)))
+        {
+            declaration.type = lexer.slice(index, typeEnd);
+            index = lexer.next(typeEnd);
+            ++qualifierCount;
+        }
+    }
 
-	QString portSection = "";
+    if (declaration.type.compare(QLatin1String("signed")) == 0)
+    {
+        declaration.type.clear();
+    }
 
-		for (auto const& currentPort : portDeclaration.split(','))
-		{
-			QRegularExpression currentPortExpression("(" + PORT_DIRECTION + ")\\s*.*\\s*" + currentPort + "\\s*;.*");
-			auto currentPortMatch = currentPortExpression.match(section);
-            if (currentPortMatch.hasMatch())
-            {
-                auto capturedPortMatch = currentPortMatch.captured();
-                if (PORT_1995.match(capturedPortMatch).hasMatch())
-                {
-					portSection.append(capturedPortMatch + "\n");
-                }
-            }
-		}
+    if (lexer.isWord(index, QStringLiteral("signed")))
+    {
+        index = lexer.next(index);
+        ++qualifierCount;
+    }
 
-    return portSection;
-}
+    QStringList ranges;
+    while (ranges.size() < 2 && lexer.isOperator(index, QStringLiteral("[")) && lexer.matching(index) != -1)
+    {
+        ranges.append(lexer.slice(index, lexer.matching(index)));
+        index = lexer.next(lexer.matching(index));
+    }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::findVerilog2001PortsSection()
-//-----------------------------------------------------------------------------
-QString VerilogPortParser::findVerilog2001PortsSection(QString const& input) const
-{
-    QRegularExpression portsEnd("[)];");
+    if (verilog1995 && (qualifierCount > 1 || ranges.size() > 1))
+    {
+        return -1;
+    }
 
-    int portSectionBegin = findStartOfPortList(input);
-    int portSectionEnd = input.indexOf(portsEnd, portSectionBegin);
+    if (ranges.size() == 2)
+    {
+        declaration.arrayBounds = ranges.first();
+    }
 
-    bool noPortSection = (portSectionBegin == -1 || portSectionEnd == -1);
+    if (ranges.isEmpty() == false)
+    {
+        declaration.vectorBounds = ranges.last();
+    }
 
-    if (noPortSection)
+    int lastIndex = -1;
+    while (isPortName(lexer, index))
     {
-        return QString();
+        declaration.names.append(lexer.text(index).toString());
+        lastIndex = index;
+
+        int separator = lexer.next(index);
+        if (lexer.isOperator(separator, QStringLiteral(",")) && isPortName(lexer, lexer.next(separator)))
+        {
+            index = lexer.next(separator);
+        }
+        else
+        {
+            index = lexer.count();
+        }
     }
 
-    int portSectionLength = portSectionEnd - portSectionBegin;
+    if (lastIndex == -1)
+    {
+        return -1;
+    }
 
-    return input.mid(portSectionBegin, portSectionLength);
-}
+    // Unpacked array range after the port name.
+    int arrayBegin = lexer.next(lastIndex);
+    if (verilog1995 == false && declaration.names.size() == 1 && declaration.arrayBounds.isEmpty() &&
+        lexer.isOperator(arrayBegin, QStringLiteral("[")) && lexer.matching(arrayBegin) != -1)
+    {
+        declaration.arrayBounds = lexer.slice(arrayBegin, lexer.matching(arrayBegin));
+        lastIndex = lexer.matching(arrayBegin);
+    }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::removeIgnoredLines()
-//-----------------------------------------------------------------------------
-QString VerilogPortParser::removeIgnoredLines(QString const& portSection) const
-{
-    QString portSectionWithoutComments = portSection;
-    QRegularExpression multilineComment(VerilogSyntax::MULTILINE_COMMENT);
+    int terminator = lexer.next(lastIndex);
+    bool validEnd = lexer.isOperator(terminator, QStringLiteral(";"));
+    if (verilog1995 == false)
+    {
+        validEnd = validEnd || terminator >= listEnd || lexer.isOperator(terminator, QStringLiteral(",")) ||
+            lexer.token(terminator).type == HDLLexer::TokenType::Directive;
+    }
 
-    return  portSectionWithoutComments.remove(VerilogSyntax::COMMENTLINE).remove(multilineComment);
-}
+    if (validEnd == false)
+    {
+        return -1;
+    }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::portDeclarationsIn()
-//-----------------------------------------------------------------------------
-QStringList VerilogPortParser::portDeclarationsIn(QString const& portSection) const
-{
-    QStringList portDeclarations;
+    // The highlighted declaration includes a directly following separator and a comment on the same line.
+    int highlightEnd = lastIndex;
+    if (terminator == lastIndex + 1 && terminator < listEnd &&
+        (lexer.isOperator(terminator, QStringLiteral(",")) || lexer.isOperator(terminator, QStringLiteral(";"))))
+    {
+        highlightEnd = terminator;
+    }
 
-    QRegularExpressionMatchIterator matches = PORT_EXP.globalMatch(portSection);
-    while (matches.hasNext())
+    int commentIndex = highlightEnd + 1;
+    if (commentIndex < lexer.count() && lexer.token(commentIndex).type == HDLLexer::TokenType::Comment &&
+        lexer.onSameLine(lexer.token(highlightEnd).end(), lexer.token(commentIndex).position))
     {
-        portDeclarations.append(matches.next().captured());
+        declaration.description = lexer.commentText(commentIndex);
+        highlightEnd = commentIndex;
     }
 
-    return portDeclarations;
+    declaration.begin = lexer.token(directionIndex).position;
+    declaration.end = lexer.token(highlightEnd).end();
+
+    return lastIndex;
 }
 
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::createPortFromDeclaration()
 //-----------------------------------------------------------------------------
-void VerilogPortParser::createPortFromDeclaration(QString const& portDeclaration,
+void VerilogPortParser::createPortFromDeclaration(PortDeclaration const& portDeclaration,
     QSharedPointer<Component> targetComponent) const
 {
-    DirectionTypes::Direction direction = parseDirection(portDeclaration);
-
-    QString type = PORT_EXP.match(portDeclaration).captured(2);
-    if (type.compare(QLatin1String("signed")) == 0)
-    {
-        type.clear();
-    }
-
+    QString const& type = portDeclaration.type;
     QString typeDefinition;
 
-    QPair<QString, QString> vectorBounds = parseVectorBounds(portDeclaration, targetComponent);
-    QPair<QString, QString> arrayBounds = parseArrayBounds(portDeclaration, targetComponent);
-
-    QStringList portNames = parsePortNames(portDeclaration);
+    QPair<QString, QString> vectorBounds = parseLeftAndRight(portDeclaration.vectorBounds, targetComponent);
+    QPair<QString, QString> arrayBounds = parseLeftAndRight(portDeclaration.arrayBounds, targetComponent);
 
-    QString description = parseDescription(portDeclaration);
+    QString const& description = portDeclaration.description;
 
-    for (QString const& name : portNames)
+    for (QString const& name : portDeclaration.names)
     {
         QSharedPointer<Port> port;
         if (targetComponent->hasPort(name))
@@ -345,7 +491,7 @@ void VerilogPortParser::createPortFromDeclaration(QString const& portDeclaration
         }
 
         port->setName(name);
-        port->setDirection(direction);
+        port->setDirection(portDeclaration.direction);
         port->setLeftBound(vectorBounds.first);
         port->setRightBound(vectorBounds.second);
         port->setArrayLeft(arrayBounds.first);
@@ -363,21 +509,20 @@ void VerilogPortParser::createPortFromDeclaration(QString const& portDeclaration
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::highlight()
 //-----------------------------------------------------------------------------
-void VerilogPortParser::highlight(QString const& portDeclaration, QString const& componentDeclaration)
+void VerilogPortParser::highlight(PortDeclaration const& portDeclaration, int inputPosition)
 {
-    if (highlighter_)
+    if (highlighter_ && inputPosition != -1)
     {
-        highlighter_->applyHighlight(portDeclaration, KactusColors::Importer::PORT, componentDeclaration);
+        highlighter_->applyHighlight(inputPosition + portDeclaration.begin, inputPosition + portDeclaration.end,
+            KactusColors::Importer::PORT);
     }
 }
 
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::parseDirection()
 //-----------------------------------------------------------------------------
-DirectionTypes::Direction VerilogPortParser::parseDirection(QString const& portDeclaration) const
+DirectionTypes::Direction VerilogPortParser::parseDirection(QStringView directionString) const
 {
-    QString directionString = PORT_EXP.match(portDeclaration).captured(1);
-
     DirectionTypes::Direction portDirection = DirectionTypes::DIRECTION_INVALID;
     if (directionString == QLatin1String("input"))
     {
@@ -395,17 +540,6 @@ DirectionTypes::Direction VerilogPortParser::parseDirection(QString const& portD
     return portDirection;
 }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::parseArrayBounds()
-//-----------------------------------------------------------------------------
-QPair<QString, QString> VerilogPortParser::parseArrayBounds(QString const& portDeclaration,
-	QSharedPointer<Component> targetComponent ) const
-{
-    QString vectorBounds = PORT_EXP.match(portDeclaration).captured(3);
-
-    return parseLeftAndRight(vectorBounds, targetComponent);
-}
-
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::parseLeftAndRight()
 //-----------------------------------------------------------------------------
@@ -458,17 +592,6 @@ QPair<QString, QString> VerilogPortParser::parseLeftAndRight(QString const& boun
     return qMakePair(leftBound, rightBound);
 }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::parseVectorBounds()
-//-----------------------------------------------------------------------------
-QPair<QString, QString> VerilogPortParser::parseVectorBounds(QString const& portDeclaration,
-	QSharedPointer<Component> targetComponent) const
-{
-    QString vectorBounds = PORT_EXP.match(portDeclaration).captured(4);
-
-    return parseLeftAndRight(vectorBounds, targetComponent);
-}
-
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::replaceNameReferencesWithIds()
 //-----------------------------------------------------------------------------
@@ -493,22 +616,3 @@ QString VerilogPortParser::replaceNameReferencesWithIds(QString const& expressio
 
     return result;
 }
-
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::parsePortNames()
-//-----------------------------------------------------------------------------
-QStringList VerilogPortParser::parsePortNames(QString const& portDeclaration) const
-{
-    QString names = PORT_EXP.match(portDeclaration).captured(5);
-    
-    return names.split(QRegularExpression(QStringLiteral("\\s*[,]\\s*")), Qt::SkipEmptyParts);
-}
-
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::parseDescription()
-//-----------------------------------------------------------------------------
-QString VerilogPortParser::parseDescription(QString const& portDeclaration) const
-{
-    QRegularExpression commentExp(VerilogSyntax::COMMENT);
-    return commentExp.match(portDeclaration).captured(1).trimmed();
-}
@@ -18,10 +18,14 @@
 
 #include <QSharedPointer>
 #include <QString>
+#include <QStringList>
+#include <QStringView>
+#include <QVector>
 #include "IPXACTmodels/Component/ComponentInstantiation.h"
 
 class Component;
 class ExpressionParser;
+class HDLLexer;
 
 //-----------------------------------------------------------------------------
 //! Parser for Verilog ports.
@@ -41,8 +45,9 @@ public:
      *
      *    @param [in] input               The input text to parse.
      *    @param [in] targetComponent     The component to add all the imported ports to.
+     *    @param [in] inputPosition       The position of the input in the highlighted text.
      */
-	virtual void import(QString const& input, QSharedPointer<Component> targetComponent);
+	virtual void import(QString const& input, QSharedPointer<Component> targetComponent, int inputPosition = 0);
 
     /*!
      *  Sets the given highlighter to be used by the port parser.
@@ -64,87 +69,97 @@ private:
     VerilogPortParser(VerilogPortParser const& rhs);
     VerilogPortParser& operator=(VerilogPortParser const& rhs);
 
-    /*!
-     *  Finds all port declarations from input.
-     *
-     *    @param [in] input   The input to search for port declarations.
-     *
-     *    @return Found port declarations.
-     */
-    QStringList findPortDeclarations(QString const& input) const;
-    
-    /*!
-     *  Finds the section defining the ports of an module.
-     *
-     *    @param [in] input   The input to search for port section.
-     *
-     *    @return The sections containing all ports in module.
-     */
-    QString findPortsSection(QString const& input) const;
+    //! A port declaration found in the input.
+    struct PortDeclaration
+    {
+        //! The port direction.
+        DirectionTypes::Direction direction = DirectionTypes::DIRECTION_INVALID;
+
+        //! The port type, if any.
+        QString type;
+
+        //! The unpacked array range including the brackets, if any.
+        QString arrayBounds;
+
+        //! The vector range including the brackets, if any.
+        QString vectorBounds;
+
+        //! The names of the ports in the declaration.
+        QStringList names;
+
+        //! The description from a comment tailing the declaration.
+        QString description;
+
+        //! The position of the declaration in the input.
+        int begin = 0;
+
+        //! The position after the declaration and its tailing comment in the input.
+        int end = 0;
+    };
 
     /*!
-     *  Checks if the given input has ports declared in Verilog-1995 style.
-     *
-     *    @param [in] input   The input to check.
-     *
-     *    @return True, if Verilog-1995 style ports are found, otherwise false.
-     */
-    bool hasVerilog1995Ports(QString const& input) const;
-    
-    /*!
-     *  Finds the end of module declaration in given input.
+     *  Finds all port declarations from the tokenized input.
      *
-     *    @param [in] input   The input to search for module declaration end.
+     *    @param [in] lexer   The tokenized input to search for port declarations.
      *
-     *    @return The character index in the input for the end of module declaration.
+     *    @return Found port declarations.
      */
-    int findStartOfPortList(QString const& input) const;
+    QVector<PortDeclaration> findPortDeclarations(HDLLexer const& lexer) const;
 
     /*!
-     *  Finds the section in the input containing all Verilog-1995 style ports.
+     *  Finds the port list of the first module in the tokenized input.
      *
-     *    @param [in] input   The input to search for.
+     *    @param [in] lexer   The tokenized input to search for the port list.
      *
-     *    @return The section of the input containing all Verilog-1995 style ports.
+     *    @return The token index of the opening parenthesis of the port list, or -1 if not found.
      */
-    QString findVerilog1995PortsSectionInModule(QString const& input) const;
+    int findPortList(HDLLexer const& lexer) const;
 
     /*!
-     *  Finds the section in the input containing all Verilog-2001 style ports.
+     *  Finds the names in a Verilog-1995 style port list containing only port names.
      *
-     *    @param [in] input   The input to search for.
+     *    @param [in] lexer       The tokenized input.
+     *    @param [in] listBegin   The token index of the opening parenthesis of the port list.
      *
-     *    @return The section of the input containing all Verilog-2001 style ports.
+     *    @return The port names, or an empty list if the port list is not in Verilog-1995 style.
      */
-    QString findVerilog2001PortsSection(QString const& input) const;
+    QStringList findVerilog1995PortNames(HDLLexer const& lexer, int listBegin) const;
 
     /*!
-     *  Removes all ignored lines e.g. comments from a given input.
+     *  Finds the Verilog-1995 style port declarations in the module body.
      *
-     *    @param [in] input   The input to remove lines from.
+     *    @param [in] lexer       The tokenized input.
+     *    @param [in] listBegin   The token index of the opening parenthesis of the port list.
+     *    @param [in] portNames   The port names in the port list.
      *
-     *    @return The input without ignored lines.
+     *    @return The port declarations in the order of the port list.
      */
-    QString removeIgnoredLines(QString const& portSection) const ;
+    QVector<PortDeclaration> findVerilog1995Ports(HDLLexer const& lexer, int listBegin,
+        QStringList const& portNames) const;
 
     /*!
-     *  Removes all the comments from the given input.
+     *  Finds the Verilog-2001 style port declarations in the port list.
      *
-     *    @param [in] input     The selected input.
+     *    @param [in] lexer       The tokenized input.
+     *    @param [in] listBegin   The token index of the opening parenthesis of the port list.
      *
-     *    @return Input without comments.
+     *    @return The port declarations.
      */
-    QString removeAllComments(QString const& input) const;
+    QVector<PortDeclaration> findVerilog2001Ports(HDLLexer const& lexer, int listBegin) const;
 
     /*!
-     *  Finds all port declarations from a ports section without comment lines.
+     *  Parses a port declaration beginning with a port direction.
      *
-     *    @param [in] portSectionWithoutCommentLines   The section of the Verilog containing the ports in module
-     *                                                   without comment lines.
+     *    @param [in] lexer           The tokenized input.
+     *    @param [in] directionIndex  The token index of the port direction.
+     *    @param [in] listEnd         The token index ending the declaration list.
+     *    @param [in] verilog1995     Flag for parsing a Verilog-1995 style declaration in the module body.
+     *    @param [out] declaration    The parsed declaration.
      *
-     *    @return The Verilog port declarations.
+     *    @return The index of the last token in the declaration, or -1 if the declaration is not valid.
      */
-    QStringList portDeclarationsIn(QString const& portSection) const;
+    int parseDeclaration(HDLLexer const& lexer, int directionIndex, int listEnd, bool verilog1995,
+        PortDeclaration& declaration) const;
 
     /*!
      *  Creates a port from a given Verilog declaration and adds it to the target component.
@@ -152,35 +167,25 @@ private:
      *    @param [in] declaration         The declaration from which to create a port.
      *    @param [in] targetComponent     The component to which add the port.
      */
-	void createPortFromDeclaration(QString const& portDeclaration, QSharedPointer<Component> targetComponent) const;
+	void createPortFromDeclaration(PortDeclaration const& portDeclaration,
+        QSharedPointer<Component> targetComponent) const;
 
     /*!
      *  Highlights the given port declaration.
      *
-     *    @param [in] portDeclaration         The port declaration to highlight.
-     *    @param [in] componentDeclaration    Component declaration containing the selected port.
+     *    @param [in] portDeclaration     The port declaration to highlight.
+     *    @param [in] inputPosition       The position of the parsed input in the highlighted text.
      */
-    void highlight(QString const& portDeclaration, QString const& componentDeclaration);
+    void highlight(PortDeclaration const& portDeclaration, int inputPosition);
 
     /*!
      *  Parses the port direction from a Verilog port declaration.
      *
-     *    @param [in] declaration   The Verilog port declaration to parse.
-     *
-     *    @return The port direction in the declaration.
-     */
-    DirectionTypes::Direction parseDirection(QString const& portDeclaration) const;
-    
-    /*!
-     *  Parses the port array bounds from a Verilog port declaration.
-     *
-     *    @param [in] portDeclaration     The Verilog port declaration to parse.
-     *    @param [in] ownerComponent      The owner component of the port.
+     *    @param [in] directionString   The Verilog port direction keyword.
      *
-     *    @return The port left and right array bound value in the declaration.
+     *    @return The port direction.
      */
-    QPair<QString, QString> parseArrayBounds(QString const& portDeclaration, 
-        QSharedPointer<Component> targetComponent) const;
+    DirectionTypes::Direction parseDirection(QStringView directionString) const;
 
     /*!
      *  Parses the left and right bounds of a bounds that is of format [left:right].
@@ -194,17 +199,6 @@ private:
     QPair<QString, QString> parseLeftAndRight(QString const& bounds,
         QSharedPointer<Component> targetComponent) const;
 
-    /*!
-     *  Parses the port vector bounds from a Verilog port declaration.
-     *
-     *    @param [in] portDeclaration     The Verilog port declaration to parse.
-     *    @param [in] ownerComponent      The owner component of the port.
-     *
-     *    @return The port left and right vector bound value in the declaration.
-     */
-    QPair<QString, QString> parseVectorBounds(QString const& portDeclaration,
-        QSharedPointer<Component> targetComponent) const;
-
     /*!
      *  Replaces any parameter names with their ids in an expression.
      *
@@ -216,24 +210,6 @@ private:
     QString replaceNameReferencesWithIds(QString const& expression, 
         QSharedPointer<Component> targetComponent) const;
 
-    /*!
-     *  Parses the port names from a Verilog port declaration.
-     *
-     *    @param [in] declaration   The Verilog port declaration to parse.
-     *
-     *    @return The port names in the declaration.
-     */
-    QStringList parsePortNames(QString const& portDeclaration) const;
-
-    /*!
-     *  Parses the port description from a comment tailing a Verilog port declaration.
-     *
-     *    @param [in] declaration   The Verilog port declaration to parse.
-     *
-     *    @return The port description.
-     */
-    QString parseDescription(QString const& portDeclaration) const;
-    
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
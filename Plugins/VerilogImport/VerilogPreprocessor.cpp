@@ -0,0 +1,755 @@
+//-----------------------------------------------------------------------------
+// File: VerilogPreprocessor.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Preprocessor for Verilog and SystemVerilog source text.
+//-----------------------------------------------------------------------------
+
+#include "VerilogPreprocessor.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+namespace
+{
+    /*!
+     *  Appends the given text to the output with every character except line breaks replaced by a space.
+     *
+     *    @param [in/out] output  The output to append to.
+     *    @param [in] text        The text to blank.
+     */
+    void appendBlank(QString& output, QStringView text);
+
+    /*!
+     *  Gets the name of a compiler directive.
+     *
+     *    @param [in] directive   The source text of the directive.
+     *
+     *    @return The directive name without the grave accent.
+     */
+    QString directiveName(QStringView directive);
+
+    /*!
+     *  Splits the argument list of a macro usage.
+     *
+     *    @param [in] lexer   The lexer of the text containing the usage.
+     *    @param [in] open    The index of the opening parenthesis.
+     *    @param [in] close   The index of the closing parenthesis.
+     *
+     *    @return The arguments.
+     */
+    QStringList splitArguments(HDLLexer const& lexer, int open, int close);
+
+    /*!
+     *  Checks if the token in the given index is a macro usage e.g. `WIDTH.
+     *
+     *    @param [in] lexer   The lexer containing the token.
+     *    @param [in] index   The index of the token.
+     *
+     *    @return True, if the token is a macro usage, otherwise false.
+     */
+    bool isMacroUsage(HDLLexer const& lexer, int index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::Macro::operator==()
+//-----------------------------------------------------------------------------
+bool VerilogPreprocessor::Macro::operator==(Macro const& other) const
+{
+    return name == other.name && functionLike == other.functionLike && parameters == other.parameters &&
+        defaults == other.defaults && body == other.body;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::VerilogPreprocessor()
+//-----------------------------------------------------------------------------
+VerilogPreprocessor::VerilogPreprocessor()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::setIncludeDirectories()
+//-----------------------------------------------------------------------------
+void VerilogPreprocessor::setIncludeDirectories(QStringList const& directories)
+{
+    includeDirectories_ = directories;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::define()
+//-----------------------------------------------------------------------------
+void VerilogPreprocessor::define(QString const& name, QString const& value)
+{
+    Macro macro;
+    macro.name = name;
+    macro.body = value;
+
+    predefinedMacros_.insert(name, macro);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::preprocess()
+//-----------------------------------------------------------------------------
+QString VerilogPreprocessor::preprocess(QString const& input, QString const& filePath, Output output)
+{
+    macros_ = predefinedMacros_;
+    definitions_.clear();
+    includedFiles_.clear();
+    missingIncludes_.clear();
+    includeStack_.clear();
+
+    if (filePath.isEmpty() == false)
+    {
+        includeStack_.append(QFileInfo(filePath).absoluteFilePath());
+    }
+
+    return process(input, filePath, output, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::getMacros()
+//-----------------------------------------------------------------------------
+QHash<QString, VerilogPreprocessor::Macro> VerilogPreprocessor::getMacros() const
+{
+    return macros_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::expandMacros()
+//-----------------------------------------------------------------------------
+QString VerilogPreprocessor::expandMacros(QString const& text) const
+{
+    return expand(text, QSet<QString>());
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::getDefinitions()
+//-----------------------------------------------------------------------------
+QList<VerilogPreprocessor::Definition> VerilogPreprocessor::getDefinitions() const
+{
+    return definitions_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::getIncludedFiles()
+//-----------------------------------------------------------------------------
+QStringList VerilogPreprocessor::getIncludedFiles() const
+{
+    return includedFiles_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::getMissingIncludes()
+//-----------------------------------------------------------------------------
+QStringList VerilogPreprocessor::getMissingIncludes() const
+{
+    return missingIncludes_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::clearCache()
+//-----------------------------------------------------------------------------
+void VerilogPreprocessor::clearCache()
+{
+    cache_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::process()
+//-----------------------------------------------------------------------------
+QString VerilogPreprocessor::process(QString const& input, QString const& filePath, Output output, bool topLevel)
+{
+    HDLLexer lexer(input, HDLLexer::Language::Verilog);
+
+    QString result;
+    result.reserve(input.size());
+
+    QVector<Condition> conditions;
+    bool active = true;
+    int copiedEnd = 0;
+
+    for (int i = 0; i < lexer.count(); ++i)
+    {
+        HDLLexer::Token const& token = lexer.token(i);
+
+        // White space between the tokens belongs to the enclosing block.
+        QStringView gap = QStringView(input).mid(copiedEnd, token.position - copiedEnd);
+        if (active)
+        {
+            result.append(gap);
+        }
+        else
+        {
+            appendBlank(result, gap);
+        }
+
+        copiedEnd = token.end();
+
+        if (token.type == HDLLexer::TokenType::Directive)
+        {
+            QStringView directive = lexer.text(i);
+            QString name = directiveName(directive);
+            QString argument = directive.mid(name.size() + 1).trimmed().toString();
+
+            if (name == QLatin1String("ifdef") || name == QLatin1String("ifndef"))
+            {
+                bool defined = macros_.contains(argument);
+                bool taken = name == QLatin1String("ifdef") ? defined : defined == false;
+
+                conditions.append(Condition{ active, taken });
+                active = active && taken;
+            }
+            else if (name == QLatin1String("elsif") && conditions.isEmpty() == false)
+            {
+                Condition& condition = conditions.last();
+                active = condition.parentActive && condition.taken == false && macros_.contains(argument);
+                condition.taken = condition.taken || active;
+            }
+            else if (name == QLatin1String("else") && conditions.isEmpty() == false)
+            {
+                Condition& condition = conditions.last();
+                active = condition.parentActive && condition.taken == false;
+                condition.taken = true;
+            }
+            else if (name == QLatin1String("endif") && conditions.isEmpty() == false)
+            {
+                active = conditions.takeLast().parentActive;
+            }
+            else if (active && name == QLatin1String("define"))
+            {
+                Macro macro = parseDefinition(directive.toString());
+                macros_.insert(macro.name, macro);
+
+                if (topLevel)
+                {
+                    // The declaration includes the line break, if any.
+                    int declarationEnd = token.end();
+                    if (input.mid(declarationEnd, 2) == QLatin1String("\r\n"))
+                    {
+                        declarationEnd += 2;
+                    }
+                    else if (declarationEnd < input.size() && input.at(declarationEnd) == QLatin1Char('\n'))
+                    {
+                        declarationEnd += 1;
+                    }
+
+                    QString declaration = input.mid(token.position, declarationEnd - token.position);
+                    definitions_.append(Definition{ macro, declaration });
+                }
+            }
+            else if (active && name == QLatin1String("undef"))
+            {
+                macros_.remove(argument);
+            }
+            else if (active && name == QLatin1String("undefineall"))
+            {
+                macros_.clear();
+            }
+            else if (active && name == QLatin1String("include"))
+            {
+                QString includedText = includeFile(argument, filePath);
+                if (output == Output::Expanded)
+                {
+                    result.append(includedText);
+                    continue;
+                }
+            }
+            else if (active)
+            {
+                // Other directives e.g. `timescale are left for the compiler.
+                result.append(directive);
+                continue;
+            }
+
+            appendBlank(result, directive);
+        }
+        else if (active == false)
+        {
+            appendBlank(result, lexer.text(i));
+        }
+        else if (output == Output::Expanded && isMacroUsage(lexer, i))
+        {
+            i = expandUsage(lexer, i, result, QSet<QString>());
+            copiedEnd = lexer.token(i).end();
+        }
+        else
+        {
+            result.append(lexer.text(i));
+        }
+    }
+
+    QStringView tail = QStringView(input).mid(copiedEnd);
+    if (active)
+    {
+        result.append(tail);
+    }
+    else
+    {
+        appendBlank(result, tail);
+    }
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::includeFile()
+//-----------------------------------------------------------------------------
+QString VerilogPreprocessor::includeFile(QString const& argument, QString const& currentFile)
+{
+    QString target = argument;
+    if (target.startsWith(QLatin1Char('`')))
+    {
+        target = expand(target, QSet<QString>()).trimmed();
+    }
+
+    // The file name is given in quotes or angle brackets.
+    QString fileName;
+    if (target.startsWith(QLatin1Char('"')))
+    {
+        fileName = target.mid(1, target.indexOf(QLatin1Char('"'), 1) - 1);
+    }
+    else if (target.startsWith(QLatin1Char('<')))
+    {
+        fileName = target.mid(1, target.indexOf(QLatin1Char('>'), 1) - 1);
+    }
+
+    if (fileName.isEmpty())
+    {
+        return QString();
+    }
+
+    QString path = resolveIncludePath(fileName, currentFile);
+    if (path.isEmpty())
+    {
+        missingIncludes_.append(fileName);
+        return QString();
+    }
+
+    // Recursive inclusion is stopped at the first repetition.
+    if (includeStack_.contains(path))
+    {
+        return QString();
+    }
+
+    if (includedFiles_.contains(path) == false)
+    {
+        includedFiles_.append(path);
+    }
+
+    QFileInfo fileInfo(path);
+    QString cacheKey = path + QLatin1Char('|') + QString::number(macrosHash());
+
+    auto cached = cache_.constFind(cacheKey);
+    if (cached != cache_.constEnd() && cached->lastModified == fileInfo.lastModified() &&
+        cached->size == fileInfo.size() && cached->macrosBefore == macros_)
+    {
+        macros_ = cached->macrosAfter;
+        for (QString const& includedFile : cached->includedFiles)
+        {
+            if (includedFiles_.contains(includedFile) == false)
+            {
+                includedFiles_.append(includedFile);
+            }
+        }
+
+        return cached->text;
+    }
+
+    QFile file(path);
+    if (file.open(QIODevice::ReadOnly) == false)
+    {
+        missingIncludes_.append(fileName);
+        return QString();
+    }
+
+    QString content = QString::fromUtf8(file.readAll());
+    file.close();
+
+    CacheEntry entry;
+    entry.macrosBefore = macros_;
+    entry.lastModified = fileInfo.lastModified();
+    entry.size = fileInfo.size();
+
+    int includedBefore = includedFiles_.size();
+
+    includeStack_.append(path);
+    entry.text = process(content, path, Output::Expanded, false);
+    includeStack_.removeLast();
+
+    entry.macrosAfter = macros_;
+    entry.includedFiles = includedFiles_.mid(includedBefore);
+
+    cache_.insert(cacheKey, entry);
+
+    return entry.text;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::resolveIncludePath()
+//-----------------------------------------------------------------------------
+QString VerilogPreprocessor::resolveIncludePath(QString const& fileName, QString const& currentFile) const
+{
+    if (QFileInfo(fileName).isAbsolute())
+    {
+        return QFileInfo::exists(fileName) ? QDir::cleanPath(fileName) : QString();
+    }
+
+    QStringList searchDirectories;
+    if (currentFile.isEmpty() == false)
+    {
+        searchDirectories.append(QFileInfo(currentFile).absolutePath());
+    }
+
+    searchDirectories.append(includeDirectories_);
+
+    for (QString const& directory : searchDirectories)
+    {
+        QFileInfo candidate(QDir(directory), fileName);
+        if (candidate.isFile())
+        {
+            return QDir::cleanPath(candidate.absoluteFilePath());
+        }
+    }
+
+    return QString();
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::parseDefinition()
+//-----------------------------------------------------------------------------
+VerilogPreprocessor::Macro VerilogPreprocessor::parseDefinition(QString const& directive) const
+{
+    QString text = directive.mid(QStringLiteral("`define").size());
+    text.remove(QStringLiteral("\\\r\n"));
+    text.remove(QStringLiteral("\\\n"));
+
+    int position = 0;
+    while (position < text.size() && (text.at(position) == QLatin1Char(' ') || text.at(position) == QLatin1Char('\t')))
+    {
+        ++position;
+    }
+
+    int nameEnd = position;
+    while (nameEnd < text.size() && (text.at(nameEnd).isLetterOrNumber() || text.at(nameEnd) == QLatin1Char('_') ||
+        text.at(nameEnd) == QLatin1Char('$')))
+    {
+        ++nameEnd;
+    }
+
+    Macro macro;
+    macro.name = text.mid(position, nameEnd - position);
+    position = nameEnd;
+
+    // A macro takes arguments only if the parenthesis follows the name directly.
+    if (position < text.size() && text.at(position) == QLatin1Char('('))
+    {
+        int depth = 0;
+        int parameterStart = position + 1;
+        for (; position < text.size(); ++position)
+        {
+            QChar const character = text.at(position);
+            if (character == QLatin1Char('('))
+            {
+                ++depth;
+            }
+            else if (character == QLatin1Char(')'))
+            {
+                --depth;
+            }
+
+            if ((character == QLatin1Char(',') && depth == 1) || depth == 0)
+            {
+                QString parameter = text.mid(parameterStart, position - parameterStart);
+                int defaultStart = parameter.indexOf(QLatin1Char('='));
+
+                macro.parameters.append(parameter.left(defaultStart).trimmed());
+                macro.defaults.append(defaultStart == -1 ? QString() : parameter.mid(defaultStart + 1).trimmed());
+
+                parameterStart = position + 1;
+            }
+
+            if (depth == 0)
+            {
+                ++position;
+                break;
+            }
+        }
+
+        macro.functionLike = true;
+        if (macro.parameters.size() == 1 && macro.parameters.first().isEmpty())
+        {
+            macro.parameters.clear();
+            macro.defaults.clear();
+        }
+    }
+
+    // The comments are not a part of the replacement text, but the line comment describes the macro.
+    QString body = text.mid(position);
+    HDLLexer lexer(body, HDLLexer::Language::Verilog);
+
+    int copiedEnd = 0;
+    for (int i = 0; i < lexer.count(); ++i)
+    {
+        HDLLexer::Token const& token = lexer.token(i);
+        if (token.type == HDLLexer::TokenType::Comment)
+        {
+            macro.body.append(QStringView(body).mid(copiedEnd, token.position - copiedEnd));
+            copiedEnd = token.end();
+
+            if (lexer.text(i).startsWith(QLatin1String("//")))
+            {
+                macro.description = lexer.commentText(i).simplified();
+            }
+            else
+            {
+                macro.body.append(QLatin1Char(' '));
+            }
+        }
+    }
+
+    macro.body.append(QStringView(body).mid(copiedEnd));
+    macro.body = macro.body.trimmed();
+
+    return macro;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::expand()
+//-----------------------------------------------------------------------------
+QString VerilogPreprocessor::expand(QString const& text, QSet<QString> const& expanding) const
+{
+    HDLLexer lexer(text, HDLLexer::Language::Verilog);
+
+    QString result;
+    int copiedEnd = 0;
+    for (int i = 0; i < lexer.count(); ++i)
+    {
+        HDLLexer::Token const& token = lexer.token(i);
+        result.append(QStringView(text).mid(copiedEnd, token.position - copiedEnd));
+
+        if (isMacroUsage(lexer, i))
+        {
+            i = expandUsage(lexer, i, result, expanding);
+        }
+        else
+        {
+            result.append(lexer.text(i));
+        }
+
+        copiedEnd = lexer.token(i).end();
+    }
+
+    result.append(QStringView(text).mid(copiedEnd));
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::expandUsage()
+//-----------------------------------------------------------------------------
+int VerilogPreprocessor::expandUsage(HDLLexer const& lexer, int index, QString& output,
+    QSet<QString> const& expanding) const
+{
+    QStringView usage = lexer.text(index);
+    QString name = usage.mid(1).toString();
+
+    // Unknown macros e.g. `__FILE__ and macros used in their own definition are left as is.
+    auto macro = macros_.constFind(name);
+    if (macro == macros_.constEnd() || expanding.contains(name))
+    {
+        output.append(usage);
+        return index;
+    }
+
+    int last = index;
+    QStringList arguments;
+    if (macro->functionLike)
+    {
+        int open = lexer.next(index);
+        if (open >= lexer.count() || lexer.isOperator(open, QStringLiteral("(")) == false ||
+            lexer.matching(open) == -1)
+        {
+            output.append(usage);
+            return index;
+        }
+
+        last = lexer.matching(open);
+        arguments = splitArguments(lexer, open, last);
+    }
+
+    QSet<QString> nestedExpanding = expanding;
+    nestedExpanding.insert(name);
+
+    output.append(expand(substitute(*macro, arguments), nestedExpanding));
+    return last;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::substitute()
+//-----------------------------------------------------------------------------
+QString VerilogPreprocessor::substitute(Macro const& macro, QStringList const& arguments) const
+{
+    if (macro.parameters.isEmpty())
+    {
+        return macro.body;
+    }
+
+    // The body is scanned by characters, since the arguments are substituted also inside the `" quotes.
+    QString const& body = macro.body;
+
+    QString result;
+    int position = 0;
+    while (position < body.size())
+    {
+        QChar const current = body.at(position);
+        bool const escaped = position > 0 && body.at(position - 1) == QLatin1Char('`');
+
+        if (current == QLatin1Char('"') && escaped == false)
+        {
+            // Plain string literals are copied as is.
+            int end = position + 1;
+            while (end < body.size() && body.at(end) != QLatin1Char('"'))
+            {
+                end += body.at(end) == QLatin1Char('\\') ? 2 : 1;
+            }
+
+            end = qMin(end + 1, int(body.size()));
+            result.append(QStringView(body).mid(position, end - position));
+            position = end;
+        }
+        else if (current.isLetter() || current == QLatin1Char('_'))
+        {
+            int end = position + 1;
+            while (end < body.size() && (body.at(end).isLetterOrNumber() || body.at(end) == QLatin1Char('_') ||
+                body.at(end) == QLatin1Char('$')))
+            {
+                ++end;
+            }
+
+            // Macro usages are not arguments, but the names joined with `` are.
+            bool const macroUsage = escaped && (position < 2 || body.at(position - 2) != QLatin1Char('`'));
+
+            QString word = body.mid(position, end - position);
+            int parameterIndex = macroUsage ? -1 : macro.parameters.indexOf(word);
+
+            if (parameterIndex == -1)
+            {
+                result.append(word);
+            }
+            else if (parameterIndex < arguments.size() && arguments.at(parameterIndex).isEmpty() == false)
+            {
+                result.append(arguments.at(parameterIndex));
+            }
+            else
+            {
+                result.append(macro.defaults.at(parameterIndex));
+            }
+
+            position = end;
+        }
+        else
+        {
+            result.append(current);
+            ++position;
+        }
+    }
+
+    // Resolve the escaped quotes, the quotes allowing substitution inside strings and the token pasting.
+    result.replace(QStringLiteral("`\\`\""), QStringLiteral("\\\""));
+    result.replace(QStringLiteral("`\""), QStringLiteral("\""));
+    result.remove(QStringLiteral("``"));
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPreprocessor::macrosHash()
+//-----------------------------------------------------------------------------
+size_t VerilogPreprocessor::macrosHash() const
+{
+    // The sum of the hashes does not depend on the iteration order.
+    size_t hash = 0;
+    for (Macro const& macro : macros_)
+    {
+        hash += qHash(macro.name) ^ (qHash(macro.body) * 31) ^ qHash(macro.parameters.join(QLatin1Char(',')));
+    }
+
+    return hash;
+}
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: appendBlank()
+    //-----------------------------------------------------------------------------
+    void appendBlank(QString& output, QStringView text)
+    {
+        for (QChar const& character : text)
+        {
+            if (character == QLatin1Char('\n') || character == QLatin1Char('\r'))
+            {
+                output.append(character);
+            }
+            else
+            {
+                output.append(QLatin1Char(' '));
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: directiveName()
+    //-----------------------------------------------------------------------------
+    QString directiveName(QStringView directive)
+    {
+        int nameEnd = 1;
+        while (nameEnd < directive.size() && (directive.at(nameEnd).isLetterOrNumber() ||
+            directive.at(nameEnd) == QLatin1Char('_')))
+        {
+            ++nameEnd;
+        }
+
+        return directive.mid(1, nameEnd - 1).toString();
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: splitArguments()
+    //-----------------------------------------------------------------------------
+    QStringList splitArguments(HDLLexer const& lexer, int open, int close)
+    {
+        QString const& source = lexer.source();
+
+        QStringList arguments;
+        int argumentStart = lexer.token(open).end();
+        for (int i = open + 1; i < close; ++i)
+        {
+            // Commas inside nested brackets do not separate the arguments.
+            if (lexer.matching(i) > i)
+            {
+                i = lexer.matching(i);
+            }
+            else if (lexer.isOperator(i, QStringLiteral(",")))
+            {
+                arguments.append(source.mid(argumentStart, lexer.token(i).position - argumentStart).trimmed());
+                argumentStart = lexer.token(i).end();
+            }
+        }
+
+        arguments.append(source.mid(argumentStart, lexer.token(close).position - argumentStart).trimmed());
+        return arguments;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: isMacroUsage()
+    //-----------------------------------------------------------------------------
+    bool isMacroUsage(HDLLexer const& lexer, int index)
+    {
+        return lexer.token(index).type == HDLLexer::TokenType::Identifier &&
+            lexer.text(index).startsWith(QLatin1Char('`'));
+    }
+}
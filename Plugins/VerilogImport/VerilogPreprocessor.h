@@ -0,0 +1,306 @@
+//-----------------------------------------------------------------------------
+// File: VerilogPreprocessor.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Preprocessor for Verilog and SystemVerilog source text.
+//-----------------------------------------------------------------------------
+
+#ifndef VERILOGPREPROCESSOR_H
+#define VERILOGPREPROCESSOR_H
+
+#include <Plugins/common/HDLLexer.h>
+
+#include <QDateTime>
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+//-----------------------------------------------------------------------------
+//! Preprocessor for Verilog and SystemVerilog source text.
+//!
+//! Evaluates the conditional compilation directives, follows the `include chains and expands object-like and
+//! function-like macros. The included files are searched from the directory of the including file and then
+//! from the include directories. The result of each included file is cached by the file and the macros defined
+//! before the inclusion, so that a header shared by many files is preprocessed only once.
+//-----------------------------------------------------------------------------
+class VerilogPreprocessor
+{
+public:
+
+    //! The output modes of the preprocessor.
+    enum class Output
+    {
+        Expanded,       //!< The included files are inserted and the macro usages expanded.
+        KeepPositions   //!< The inactive code and the preprocessor directives are replaced with whitespace.
+    };
+
+    //! A macro defined with `define.
+    struct Macro
+    {
+        //! The name of the macro.
+        QString name;
+
+        //! True, if the macro takes arguments.
+        bool functionLike = false;
+
+        //! The names of the macro arguments.
+        QStringList parameters;
+
+        //! The default values of the macro arguments, empty if not given.
+        QStringList defaults;
+
+        //! The replacement text of the macro.
+        QString body;
+
+        //! The comment following the definition on the same line.
+        QString description;
+
+        /*!
+         *  Checks if the macro is defined the same way as another macro.
+         *
+         *    @param [in] other   The macro to compare to.
+         *
+         *    @return True, if the macros are the same, otherwise false.
+         */
+        bool operator==(Macro const& other) const;
+    };
+
+    //! A macro definition in the preprocessed input.
+    struct Definition
+    {
+        //! The defined macro.
+        Macro macro;
+
+        //! The source text of the definition, including the line break after it.
+        QString declaration;
+    };
+
+    //! The constructor.
+    VerilogPreprocessor();
+
+    //! The destructor.
+    ~VerilogPreprocessor() = default;
+
+    // Disable copying.
+    VerilogPreprocessor(VerilogPreprocessor const& rhs) = delete;
+    VerilogPreprocessor& operator=(VerilogPreprocessor const& rhs) = delete;
+
+    /*!
+     *  Sets the directories to search the included files from.
+     *
+     *    @param [in] directories     Absolute paths to the include directories.
+     */
+    void setIncludeDirectories(QStringList const& directories);
+
+    /*!
+     *  Defines a macro before any input is preprocessed e.g. from the compiler defines.
+     *
+     *    @param [in] name    The name of the macro.
+     *    @param [in] value   The replacement text of the macro.
+     */
+    void define(QString const& name, QString const& value);
+
+    /*!
+     *  Preprocesses the given input.
+     *
+     *    @param [in] input       The input text to preprocess.
+     *    @param [in] filePath    Absolute path to the input file, if known. Used to find the included files.
+     *    @param [in] output      The output mode.
+     *
+     *    @return The preprocessed text.
+     */
+    QString preprocess(QString const& input, QString const& filePath = QString(),
+        Output output = Output::Expanded);
+
+    /*!
+     *  Gets the macros defined after the latest preprocessed input.
+     *
+     *    @return The macros by their names.
+     */
+    QHash<QString, Macro> getMacros() const;
+
+    /*!
+     *  Expands the macro usages in the given text with the macros defined after the latest preprocessed input.
+     *
+     *    @param [in] text    The text to expand.
+     *
+     *    @return The expanded text.
+     */
+    QString expandMacros(QString const& text) const;
+
+    /*!
+     *  Gets the macros defined in the active code of the latest preprocessed input, excluding the included files.
+     *
+     *    @return The definitions in the order they appear in the input.
+     */
+    QList<Definition> getDefinitions() const;
+
+    /*!
+     *  Gets the files included by the latest preprocessed input, directly or through other included files.
+     *
+     *    @return Absolute paths to the included files.
+     */
+    QStringList getIncludedFiles() const;
+
+    /*!
+     *  Gets the included files of the latest preprocessed input that could not be found.
+     *
+     *    @return The names of the missing files.
+     */
+    QStringList getMissingIncludes() const;
+
+    /*!
+     *  Removes all the cached results of the included files.
+     */
+    void clearCache();
+
+private:
+
+    //! A conditional compilation block being processed.
+    struct Condition
+    {
+        //! True, if the code enclosing the block is active.
+        bool parentActive;
+
+        //! True, if a branch of the block has already been taken.
+        bool taken;
+    };
+
+    //! A cached result of preprocessing an included file.
+    struct CacheEntry
+    {
+        //! The macros defined before the inclusion.
+        QHash<QString, Macro> macrosBefore;
+
+        //! The macros defined after the inclusion.
+        QHash<QString, Macro> macrosAfter;
+
+        //! The preprocessed text of the file.
+        QString text;
+
+        //! The files included by the file.
+        QStringList includedFiles;
+
+        //! The modification time of the file when it was preprocessed.
+        QDateTime lastModified;
+
+        //! The size of the file when it was preprocessed.
+        qint64 size = 0;
+    };
+
+    /*!
+     *  Preprocesses the text of a file.
+     *
+     *    @param [in] input       The text to preprocess.
+     *    @param [in] filePath    Absolute path to the file, or empty if not known.
+     *    @param [in] output      The output mode.
+     *    @param [in] topLevel    True for the input of preprocess(), false for the included files.
+     *
+     *    @return The preprocessed text.
+     */
+    QString process(QString const& input, QString const& filePath, Output output, bool topLevel);
+
+    /*!
+     *  Preprocesses an included file or takes its result from the cache.
+     *
+     *    @param [in] argument        The argument of the `include directive.
+     *    @param [in] currentFile     Absolute path to the including file, or empty if not known.
+     *
+     *    @return The preprocessed text of the included file.
+     */
+    QString includeFile(QString const& argument, QString const& currentFile);
+
+    /*!
+     *  Finds an included file from the directory of the including file and the include directories.
+     *
+     *    @param [in] fileName        The name of the included file.
+     *    @param [in] currentFile     Absolute path to the including file, or empty if not known.
+     *
+     *    @return Absolute path to the included file, or empty if the file was not found.
+     */
+    QString resolveIncludePath(QString const& fileName, QString const& currentFile) const;
+
+    /*!
+     *  Parses a macro from a `define directive.
+     *
+     *    @param [in] directive   The source text of the directive.
+     *
+     *    @return The defined macro.
+     */
+    Macro parseDefinition(QString const& directive) const;
+
+    /*!
+     *  Expands the macro usages in the given text.
+     *
+     *    @param [in] text        The text to expand.
+     *    @param [in] expanding   The names of the macros being expanded, which are not expanded again.
+     *
+     *    @return The expanded text.
+     */
+    QString expand(QString const& text, QSet<QString> const& expanding) const;
+
+    /*!
+     *  Expands a macro usage and its arguments.
+     *
+     *    @param [in] lexer       The lexer of the text containing the usage.
+     *    @param [in] index       The index of the macro usage token.
+     *    @param [in/out] output  The output to append the expansion to.
+     *    @param [in] expanding   The names of the macros being expanded, which are not expanded again.
+     *
+     *    @return The index of the last token of the usage, including the argument list.
+     */
+    int expandUsage(HDLLexer const& lexer, int index, QString& output, QSet<QString> const& expanding) const;
+
+    /*!
+     *  Replaces the arguments of a macro in its body.
+     *
+     *    @param [in] macro       The macro to substitute.
+     *    @param [in] arguments   The given arguments.
+     *
+     *    @return The body of the macro with the arguments substituted.
+     */
+    QString substitute(Macro const& macro, QStringList const& arguments) const;
+
+    /*!
+     *  Calculates a hash of the currently defined macros, independent of their definition order.
+     *
+     *    @return The hash of the macros.
+     */
+    size_t macrosHash() const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The directories to search the included files from.
+    QStringList includeDirectories_;
+
+    //! The macros defined before any input.
+    QHash<QString, Macro> predefinedMacros_;
+
+    //! The currently defined macros.
+    QHash<QString, Macro> macros_;
+
+    //! The definitions in the latest top-level input.
+    QList<Definition> definitions_;
+
+    //! The files included by the latest input.
+    QStringList includedFiles_;
+
+    //! The included files of the latest input that were not found.
+    QStringList missingIncludes_;
+
+    //! The files being included, used to detect recursive inclusion.
+    QStringList includeStack_;
+
+    //! The results of the included files by the file path and the hash of the macros defined before them.
+    QHash<QString, CacheEntry> cache_;
+};
+
+#endif // VERILOGPREPROCESSOR_H
@@ -11,6 +11,8 @@
 
 #include "VerilogSyntax.h"
 
+#include <Plugins/common/HDLLexer.h>
+
 #include <QTextStream>
 #include <QFile>
 
@@ -31,10 +33,57 @@ QString VerilogSyntax::legalizeName(QString const& name)
 //-----------------------------------------------------------------------------
 QString VerilogSyntax::cullStrayComments(QString const& input)
 {
-    // Make a copy, remove all multiline comments as well as lines that are purely comments.
-    QString inspectWithoutComments = input;
-    inspectWithoutComments.remove(VerilogSyntax::MULTILINE_COMMENT);
-    inspectWithoutComments.remove(VerilogSyntax::COMMENTLINE);
+    // Remove all multiline comments as well as lines that are purely comments in a single pass.
+    HDLLexer lexer(input, HDLLexer::Language::Verilog);
+
+    QString inspectWithoutComments;
+    inspectWithoutComments.reserve(input.size());
+
+    int copiedEnd = 0;
+    for (int i = 0; i < lexer.count(); ++i)
+    {
+        HDLLexer::Token const& token = lexer.token(i);
+        if (token.type != HDLLexer::TokenType::Comment)
+        {
+            continue;
+        }
+
+        inspectWithoutComments.append(input.constData() + copiedEnd, token.position - copiedEnd);
+        copiedEnd = token.end();
+
+        if (lexer.text(i).startsWith(QLatin1String("//")))
+        {
+            // Remove the comment line including its indentation and the preceding line break.
+            int lineBegin = inspectWithoutComments.size();
+            while (lineBegin > 0 && (inspectWithoutComments.at(lineBegin - 1) == QLatin1Char(' ') ||
+                inspectWithoutComments.at(lineBegin - 1) == QLatin1Char('\t')))
+            {
+                --lineBegin;
+            }
+
+            if (lineBegin == 0)
+            {
+                inspectWithoutComments.truncate(0);
+            }
+            else if (inspectWithoutComments.at(lineBegin - 1) == QLatin1Char('\n'))
+            {
+                --lineBegin;
+                if (lineBegin > 0 && inspectWithoutComments.at(lineBegin - 1) == QLatin1Char('\r'))
+                {
+                    --lineBegin;
+                }
+
+                inspectWithoutComments.truncate(lineBegin);
+            }
+            else
+            {
+                // Comments after code on the same line are kept.
+                inspectWithoutComments.append(lexer.text(i));
+            }
+        }
+    }
+
+    inspectWithoutComments.append(input.constData() + copiedEnd, input.size() - copiedEnd);
 
     return inspectWithoutComments;
 }
@@ -19,16 +19,11 @@
 
 #include <QRegularExpression>
 
-namespace
-{
-    QRegularExpression const DEFINE("`define (\\w+(?!\\s?[(].*?[)])) ((?:(?:\\\\\\\n)|(.*?))*)?[ \\t]*(" +
-        VerilogSyntax::COMMENT + ")?\\n");
-}
-
 //-----------------------------------------------------------------------------
 // Function: VerilogIncludeImport::VerilogIncludeImport()
 //-----------------------------------------------------------------------------
-VerilogIncludeImport::VerilogIncludeImport() : QObject(0), parameterParser_(), highlighter_(0)
+VerilogIncludeImport::VerilogIncludeImport() : QObject(0), parameterParser_(), highlighter_(0), preprocessor_(),
+    filePath_()
 {
 
 }
@@ -54,7 +49,7 @@ QString VerilogIncludeImport::getName() const
 //-----------------------------------------------------------------------------
 QString VerilogIncludeImport::getVersion() const
 {
-    return "1.1";
+    return "1.2";
 }
 
 //-----------------------------------------------------------------------------
@@ -164,22 +159,24 @@ QString VerilogIncludeImport::getComponentName(QString const& /*componentDeclara
 void VerilogIncludeImport::import(QString const& input, QString const& /*componentDeclaration*/,
     QSharedPointer<Component> targetComponent)
 {
-    QString nonCommentedInput = VerilogSyntax::cullStrayComments(input);
+    // The inactive conditional code is blanked out, keeping the positions for the parameter parser.
+    QString activeInput = preprocessor_.preprocess(input, filePath_, VerilogPreprocessor::Output::KeepPositions);
 
-    int position = 0;
-    QRegularExpressionMatch defineMatch = DEFINE.match(nonCommentedInput, position);
-    while (defineMatch.hasMatch())
+    for (VerilogPreprocessor::Definition const& definition : preprocessor_.getDefinitions())
     {
-        QString definition = defineMatch.captured();
-
-        highlightDefinition(definition);
-        createParameterFromDefinition(definition, targetComponent);
+        // Macros with arguments cannot be represented as parameters.
+        if (definition.macro.functionLike || definition.macro.body.startsWith(QLatin1Char('(')))
+        {
+            continue;
+        }
 
-        position = defineMatch.capturedStart() + defineMatch.capturedLength();
-        defineMatch = DEFINE.match(nonCommentedInput, position);
+        highlightDefinition(definition.declaration);
+        createParameterFromDefinition(definition.macro, targetComponent);
     }
 
-    parseParameters(input, targetComponent);
+    parseParameters(activeInput, targetComponent);
+
+    filePath_.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -191,6 +188,15 @@ void VerilogIncludeImport::setHighlighter(Highlighter* highlighter)
     parameterParser_.setHighlighter(highlighter);
 }
 
+//-----------------------------------------------------------------------------
+// Function: VerilogIncludeImport::setInputLocation()
+//-----------------------------------------------------------------------------
+void VerilogIncludeImport::setInputLocation(QString const& filePath, QStringList const& includeDirectories)
+{
+    filePath_ = filePath;
+    preprocessor_.setIncludeDirectories(includeDirectories);
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogIncludeImport::highlightDefinition()
 //-----------------------------------------------------------------------------
@@ -206,30 +212,25 @@ void VerilogIncludeImport::highlightDefinition(QString const& definition)
 //-----------------------------------------------------------------------------
 // Function: VerilogIncludeImport::createParameterFromDefinition()
 //-----------------------------------------------------------------------------
-void VerilogIncludeImport::createParameterFromDefinition(QString const& definition, 
+void VerilogIncludeImport::createParameterFromDefinition(VerilogPreprocessor::Macro const& macro,
     QSharedPointer<Component> targetComponent)
 {
-    QRegularExpressionMatch match = DEFINE.match(definition);
-
-    QString name = match.captured(1);
-    QString value = match.captured(2).remove(QRegularExpression("\\\\\\\n"));
-    QString description = match.captured(5).simplified();
-
-    QSharedPointer<Parameter> parameter = findParameterByName(targetComponent, name);
+    QSharedPointer<Parameter> parameter = findParameterByName(targetComponent, macro.name);
     if (parameter.isNull())
     {
         parameter = QSharedPointer<Parameter>(new Parameter());                    
-        parameter->setName(name);        
+        parameter->setName(macro.name);        
         targetComponent->getParameters()->append(parameter);
     }
 
+    QString value = macro.body;
     if (value.isEmpty())
     {
         value = QStringLiteral("1");
     }
 
     parameter->setValue(value);
-    parameter->setDescription(description);
+    parameter->setDescription(macro.description);
     parameter->setAttribute("imported", "true");
 }
 
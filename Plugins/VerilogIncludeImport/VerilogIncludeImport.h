@@ -18,8 +18,10 @@
 #include <KactusAPI/include/ImportPlugin.h>
 #include <KactusAPI/include/IncludeImportPlugin.h>
 #include <KactusAPI/include/HighlightSource.h>
+#include <KactusAPI/include/IncludePathSupport.h>
 
 #include <Plugins/VerilogImport/VerilogParameterParser.h>
+#include <Plugins/VerilogImport/VerilogPreprocessor.h>
 
 #include <QSharedPointer>
 #include <QObject>
@@ -29,7 +31,8 @@ class Parameter;
 //-----------------------------------------------------------------------------
 //! Import plugin for Verilog definitions.
 //-----------------------------------------------------------------------------
-class VERILOGINCLUDEIMPORT_EXPORT VerilogIncludeImport : public QObject, public IncludeImportPlugin, public HighlightSource
+class VERILOGINCLUDEIMPORT_EXPORT VerilogIncludeImport : public QObject, public IncludeImportPlugin,
+    public HighlightSource, public IncludePathSupport
 {
     Q_OBJECT
     Q_PLUGIN_METADATA(IID "kactus2.plugins.verilogincludeimportplugin" FILE "verilogincludeimportplugin.json")
@@ -138,6 +141,14 @@ public:
      */
     virtual void setHighlighter(Highlighter* highlighter);
 
+    /*!
+     *  Sets the location of the next imported file for resolving the included files.
+     *
+     *    @param [in] filePath              Absolute path to the imported file.
+     *    @param [in] includeDirectories    Absolute paths to the directories to search the included files from.
+     */
+    virtual void setInputLocation(QString const& filePath, QStringList const& includeDirectories) override;
+
 private:
 
 	// Disable copying.
@@ -152,13 +163,14 @@ private:
     void highlightDefinition(QString const& definition);
 
     /*!
-     *  Creates a parameter from the given definition and adds it to the component.
+     *  Creates a parameter from the given macro and adds it to the component.
      *  Existing parameter with the same name will be updated and no new parameter is added.
      *
-     *    @param [in] definition          The definition to create the parameter from.
+     *    @param [in] macro               The macro to create the parameter from.
      *    @param [in] targetComponent     The component to add the parameter to.
      */
-    void createParameterFromDefinition(QString const& definition, QSharedPointer<Component> targetComponent);
+    void createParameterFromDefinition(VerilogPreprocessor::Macro const& macro,
+        QSharedPointer<Component> targetComponent);
 
     /*!
      *  Finds a parameter in the given component by the given name.
@@ -197,6 +209,12 @@ private:
 
     //! The highlighter to use.
     Highlighter* highlighter_;
+
+    //! Preprocessor for the conditional compilation and the included files.
+    VerilogPreprocessor preprocessor_;
+
+    //! Absolute path to the next imported file, if known.
+    QString filePath_;
 };
 
 #endif // VERILOGINCLUDEIMPORT_H
@@ -5,9 +5,13 @@
 
 HEADERS += ../../common/expressions/utilities.h \
     ../VerilogImport/VerilogParameterParser.h \
+    ../VerilogImport/VerilogPreprocessor.h \
+    ../common/HDLLexer.h \
     ./verilogincludeimport_global.h \
     ./VerilogIncludeImport.h
 SOURCES += ../../common/expressions/utilities.cpp \
     ../VerilogImport/VerilogParameterParser.cpp \
+    ../VerilogImport/VerilogPreprocessor.cpp \
+    ../common/HDLLexer.cpp \
     ../VerilogImport/VerilogSyntax.cpp \
     ./VerilogIncludeImport.cpp
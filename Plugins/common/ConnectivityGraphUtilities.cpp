@@ -13,13 +13,168 @@
 
 #include <KactusAPI/include/IPluginUtility.h>
 
+#include <IPXACTmodels/Component/ComponentWriter.h>
+
 #include <editors/MemoryDesigner/ConnectivityGraphFactory.h>
 #include <editors/MemoryDesigner/MasterSlavePathSearch.h>
 #include <editors/MemoryDesigner/MemoryItem.h>
 #include <editors/MemoryDesigner/MemoryDesignerConstants.h>
 
+#include <QCryptographicHash>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QXmlStreamWriter>
+
 namespace
 {
+    //! The default CPUs found for a top component view, with the revision of the hierarchy they were found from.
+    struct CachedCpuRoutes
+    {
+        //! The revision of the top component and the documents in its hierarchy.
+        QByteArray revision_;
+
+        //! The found CPUs. These are never modified, the callers get copies of them.
+        QVector<QSharedPointer<SingleCpuRoutesContainer> > cpus_;
+    };
+
+    //! Guards the cached CPU routes, as generators may be run in parallel.
+    QMutex cacheMutex;
+
+    //! The cached CPU routes by the top component VLNV and view name.
+    QHash<QString, CachedCpuRoutes> cpuRouteCache;
+
+    //! The keys of the cached CPU routes, the least recently used first.
+    QStringList cpuRouteCacheOrder;
+
+    //-----------------------------------------------------------------------------
+    // Function: ConnectivityGraphUtilities::addDocumentRevision()
+    //-----------------------------------------------------------------------------
+    bool addDocumentRevision(LibraryInterface* library, VLNV const& vlnv, QCryptographicHash& revision,
+        QList<VLNV>& visited)
+    {
+        visited.append(vlnv);
+
+        // Documents not stored in files, e.g. in tests, cannot be tracked for changes.
+        QFileInfo documentFile(library->getPath(vlnv));
+        QSharedPointer<const Document> document = library->getModelReadOnly(vlnv);
+        if (document.isNull() || documentFile.exists() == false)
+        {
+            return false;
+        }
+
+        revision.addData(documentFile.absoluteFilePath().toUtf8());
+        revision.addData(QByteArray::number(documentFile.lastModified().toMSecsSinceEpoch()));
+        revision.addData(QByteArray::number(documentFile.size()));
+
+        for (VLNV const& dependentVLNV : document->getDependentVLNVs())
+        {
+            if (dependentVLNV.isValid() && visited.contains(dependentVLNV) == false &&
+                addDocumentRevision(library, dependentVLNV, revision, visited) == false)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: ConnectivityGraphUtilities::getHierarchyRevision()
+    //-----------------------------------------------------------------------------
+    QByteArray getHierarchyRevision(LibraryInterface* library, QSharedPointer<Component> component)
+    {
+        QCryptographicHash revision(QCryptographicHash::Md5);
+
+        // The top component may have unsaved changes, so its content is used instead of its file.
+        QByteArray componentContent;
+        QXmlStreamWriter xmlWriter(&componentContent);
+        ComponentWriter componentWriter;
+        componentWriter.writeComponent(xmlWriter, component);
+        revision.addData(componentContent);
+
+        QList<VLNV> visited({ component->getVlnv() });
+        for (VLNV const& dependentVLNV : component->getDependentVLNVs())
+        {
+            if (dependentVLNV.isValid() && visited.contains(dependentVLNV) == false &&
+                addDocumentRevision(library, dependentVLNV, revision, visited) == false)
+            {
+                return QByteArray();
+            }
+        }
+
+        return revision.result();
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: ConnectivityGraphUtilities::copyCpus()
+    //-----------------------------------------------------------------------------
+    QVector<QSharedPointer<SingleCpuRoutesContainer> > copyCpus(
+        QVector<QSharedPointer<SingleCpuRoutesContainer> > const& cpus)
+    {
+        QVector<QSharedPointer<SingleCpuRoutesContainer> > copies;
+        copies.reserve(cpus.size());
+
+        for (auto const& cpu : cpus)
+        {
+            copies.append(QSharedPointer<SingleCpuRoutesContainer>(new SingleCpuRoutesContainer(*cpu)));
+        }
+
+        return copies;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: ConnectivityGraphUtilities::remapCpus()
+    //-----------------------------------------------------------------------------
+    bool remapCpus(LibraryInterface* library, QSharedPointer<Component> component,
+        QVector<QSharedPointer<SingleCpuRoutesContainer> > const& cpus)
+    {
+        for (auto const& cpuContainer : cpus)
+        {
+            if (cpuContainer->getCpu().isNull() || cpuContainer->getRoutes().isEmpty())
+            {
+                return false;
+            }
+
+            // The CPU objects of the cached routes may since have been replaced in the library.
+            QSharedPointer<const ConnectivityComponent> routeComponent =
+                cpuContainer->getRoutes().first()->cpuInterface_->getInstance();
+
+            QSharedPointer<const Component> containingComponent;
+            if (routeComponent && routeComponent->getVlnv() == component->getVlnv().toString())
+            {
+                containingComponent = component;
+            }
+            else
+            {
+                containingComponent = ConnectivityGraphUtilities::getInterfacedComponent(library, routeComponent);
+            }
+
+            if (containingComponent.isNull())
+            {
+                return false;
+            }
+
+            QSharedPointer<Cpu> currentCpu;
+            for (auto const& componentCpu : *containingComponent->getCpus())
+            {
+                if (componentCpu->name() == cpuContainer->getCpu()->name())
+                {
+                    currentCpu = componentCpu;
+                }
+            }
+
+            if (currentCpu.isNull())
+            {
+                return false;
+            }
+
+            cpuContainer->setCpu(currentCpu);
+        }
+
+        return true;
+    }
+
     //-----------------------------------------------------------------------------
     // Function: ConnectivityGraphUtilities::interfacedCpuExists()
     //-----------------------------------------------------------------------------
@@ -157,6 +312,67 @@ namespace
 // Function: ConnectivityGraphUtilities::getDefaultCPUs()
 //-----------------------------------------------------------------------------
 QVector<QSharedPointer<SingleCpuRoutesContainer> > ConnectivityGraphUtilities::getDefaultCPUs(LibraryInterface* library, QSharedPointer<Component> component, QString const& viewName)
+{
+    QString cacheKey = component->getVlnv().toString() + QLatin1Char('|') + viewName;
+    QByteArray revision = getHierarchyRevision(library, component);
+
+    if (revision.isEmpty() == false)
+    {
+        bool cacheHit = false;
+        QVector<QSharedPointer<SingleCpuRoutesContainer> > cachedCPUs;
+        {
+            QMutexLocker cacheLock(&cacheMutex);
+
+            auto cached = cpuRouteCache.constFind(cacheKey);
+            if (cached != cpuRouteCache.constEnd() && cached->revision_ == revision)
+            {
+                cacheHit = true;
+                cachedCPUs = copyCpus(cached->cpus_);
+
+                cpuRouteCacheOrder.removeOne(cacheKey);
+                cpuRouteCacheOrder.append(cacheKey);
+            }
+        }
+
+        if (cacheHit && remapCpus(library, component, cachedCPUs))
+        {
+            return cachedCPUs;
+        }
+    }
+
+    QVector<QSharedPointer<SingleCpuRoutesContainer> > defaultCPUs = findDefaultCPUs(library, component, viewName);
+
+    if (revision.isEmpty() == false)
+    {
+        QMutexLocker cacheLock(&cacheMutex);
+        cpuRouteCache.insert(cacheKey, CachedCpuRoutes{ revision, copyCpus(defaultCPUs) });
+
+        cpuRouteCacheOrder.removeOne(cacheKey);
+        cpuRouteCacheOrder.append(cacheKey);
+
+        while (cpuRouteCacheOrder.size() > CPU_ROUTE_CACHE_SIZE)
+        {
+            cpuRouteCache.remove(cpuRouteCacheOrder.takeFirst());
+        }
+    }
+
+    return defaultCPUs;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectivityGraphUtilities::clearCpuRouteCache()
+//-----------------------------------------------------------------------------
+void ConnectivityGraphUtilities::clearCpuRouteCache()
+{
+    QMutexLocker cacheLock(&cacheMutex);
+    cpuRouteCache.clear();
+    cpuRouteCacheOrder.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectivityGraphUtilities::findDefaultCPUs()
+//-----------------------------------------------------------------------------
+QVector<QSharedPointer<SingleCpuRoutesContainer> > ConnectivityGraphUtilities::findDefaultCPUs(LibraryInterface* library, QSharedPointer<Component> component, QString const& viewName)
 {
     QVector<QSharedPointer<SingleCpuRoutesContainer> > defaultCPUs;
 
@@ -176,13 +392,13 @@ QVector<QSharedPointer<SingleCpuRoutesContainer> > ConnectivityGraphUtilities::g
                 QSharedPointer<CpuRouteStructs::CpuRoute> cpuRouteDetail = getRouteForInterface(master, checkInterface->getRoutes());
                 if (cpuRouteDetail)
                 {
-                    cpuRouteDetail->routes_.append(masterRoute);
+                    cpuRouteDetail->addRoute(masterRoute);
                 }
                 else
                 {
                     QSharedPointer<CpuRouteStructs::CpuRoute> newRoute(new CpuRouteStructs::CpuRoute());
                     newRoute->cpuInterface_ = master;
-                    newRoute->routes_.append(masterRoute);
+                    newRoute->addRoute(masterRoute);
 
                     checkInterface->addRoute(newRoute);
                 }
@@ -206,7 +422,7 @@ QVector<QSharedPointer<SingleCpuRoutesContainer> > ConnectivityGraphUtilities::g
                         {
                             QSharedPointer<CpuRouteStructs::CpuRoute> newRoute(new CpuRouteStructs::CpuRoute());
                             newRoute->cpuInterface_ = master;
-                            newRoute->routes_.append(masterRoute);
+                            newRoute->addRoute(masterRoute);
 
                             existingRoute->addRoute(newRoute);
                         }
@@ -219,7 +435,7 @@ QVector<QSharedPointer<SingleCpuRoutesContainer> > ConnectivityGraphUtilities::g
 
                         QSharedPointer<CpuRouteStructs::CpuRoute> newRoute(new CpuRouteStructs::CpuRoute());
                         newRoute->cpuInterface_ = master;
-                        newRoute->routes_.append(masterRoute);
+                        newRoute->addRoute(masterRoute);
 
                         cpuInterface->addRoute(newRoute);
 
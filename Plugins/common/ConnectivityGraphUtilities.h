@@ -34,6 +34,9 @@ namespace ConnectivityGraphUtilities
 {
     const QString REVISION_FORMAT = "rNpM(N, M = [0 - 99])";
 
+    //! The maximum number of top component views whose CPU routes are cached.
+    const int CPU_ROUTE_CACHE_SIZE = 8;
+
     /*!
      *  Get the component contained within the connectivity component.
      *
@@ -46,7 +49,9 @@ namespace ConnectivityGraphUtilities
         QSharedPointer<const ConnectivityComponent> masterComponent);
 
     /*!
-     *  Get the CPUs of the selected component.
+     *  Get the CPUs of the selected component. The routes are searched once for each revision of the component
+     *  hierarchy and shared by all the generators, each call returning its own copies of the route containers
+     *  with the CPUs of the current documents. Only the most recently used views are kept in the cache.
      *
      *    @param [in] library     The library interface containing the selected component.
      *    @param [in] component   The selected component.
@@ -56,6 +61,22 @@ namespace ConnectivityGraphUtilities
      */
     QVector<QSharedPointer<SingleCpuRoutesContainer> > getDefaultCPUs(LibraryInterface* library, QSharedPointer<Component> component, QString const& viewName);
 
+    /*!
+     *  Find the CPUs of the selected component from a new connectivity graph, bypassing the cached routes.
+     *
+     *    @param [in] library     The library interface containing the selected component.
+     *    @param [in] component   The selected component.
+     *    @param [in] viewName    Name of the selected view.
+     *
+     *    @return List of the component CPU routes.
+     */
+    QVector<QSharedPointer<SingleCpuRoutesContainer> > findDefaultCPUs(LibraryInterface* library, QSharedPointer<Component> component, QString const& viewName);
+
+    /*!
+     *  Remove all the cached CPU routes.
+     */
+    void clearCpuRouteCache();
+
     /*!
      *  Get the name of the design view.
      *
@@ -37,6 +37,8 @@ routeContainers_()
         QSharedPointer<CpuRouteStructs::CpuRoute> newRoute(new CpuRouteStructs::CpuRoute());
         newRoute->cpuInterface_ = route->cpuInterface_;
         newRoute->routes_ = route->routes_;
+        newRoute->routesRevision_ = route->routesRevision_;
+        newRoute->addressMap_ = route->addressMap_;
 
         routeContainers_.append(newRoute);
     }
@@ -18,6 +18,7 @@
 #include <QSharedPointer>
 
 class Cpu;
+class GlobalAddressMap;
 
 //! CPU route utilities.
 namespace CpuRouteStructs
@@ -28,8 +29,36 @@ namespace CpuRouteStructs
         //! Interface containing the CPU.
         QSharedPointer<const ConnectivityInterface> cpuInterface_;
 
-        //! Routes connected to the master cpu interface.
+        //! Routes connected to the master cpu interface. Changed through addRoute() and setRoutes().
         QVector<QVector<QSharedPointer<const ConnectivityInterface> > > routes_;
+
+        //! Revision of the routes, incremented on every change.
+        quint64 routesRevision_ = 0;
+
+        //! Flattened address map of the routes, calculated on first use.
+        QSharedPointer<GlobalAddressMap const> addressMap_;
+
+        /*!
+         *  Add a route connected to the master cpu interface.
+         *
+         *    @param [in] route   The new route.
+         */
+        void addRoute(QVector<QSharedPointer<const ConnectivityInterface> > const& route)
+        {
+            routes_.append(route);
+            ++routesRevision_;
+        }
+
+        /*!
+         *  Set the routes connected to the master cpu interface.
+         *
+         *    @param [in] routes  The new routes.
+         */
+        void setRoutes(QVector<QVector<QSharedPointer<const ConnectivityInterface> > > const& routes)
+        {
+            routes_ = routes;
+            ++routesRevision_;
+        }
     };
 };
 
@@ -0,0 +1,221 @@
+//-----------------------------------------------------------------------------
+// File: GlobalAddressMap.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Flattened address map of the memory map targets visible to a single initiator interface.
+//-----------------------------------------------------------------------------
+
+#include "GlobalAddressMap.h"
+
+#include <editors/MemoryDesigner/ConnectivityInterface.h>
+#include <editors/MemoryDesigner/MemoryConnectionAddressCalculator.h>
+#include <editors/MemoryDesigner/MemoryDesignerConstants.h>
+#include <editors/MemoryDesigner/MemoryItem.h>
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::GlobalAddressMap()
+//-----------------------------------------------------------------------------
+GlobalAddressMap::GlobalAddressMap(QSharedPointer<CpuRouteStructs::CpuRoute const> cpuRoute):
+initiator_(cpuRoute->cpuInterface_),
+routesRevision_(cpuRoute->routesRevision_)
+{
+    for (auto const& route : cpuRoute->routes_)
+    {
+        for (int i = 0; i < route.size(); ++i)
+        {
+            QSharedPointer<ConnectivityInterface const> routeInterface = route.at(i);
+            QSharedPointer<MemoryItem> interfaceMemory = routeInterface->getConnectedMemory();
+
+            if (interfaceMemory && interfaceMemory->getKind() == MemoryItem::Kind::MEMORY_MAP)
+            {
+                MemoryConnectionAddressCalculator::CalculatedPathAddresses pathAddresses =
+                    MemoryConnectionAddressCalculator::calculatePathAddresses(initiator_, routeInterface, route);
+
+                Target target;
+                target.targetInterface_ = routeInterface;
+                target.memoryItem_ = interfaceMemory;
+                target.route_ = route;
+                target.routePosition_ = i;
+                target.baseAddress_ = pathAddresses.connectionBaseAddress_;
+                target.lastAddress_ = pathAddresses.connectionLastAddress_;
+                target.isAddressable_ = pathAddresses.createConnection_;
+
+                targets_.append(target);
+            }
+        }
+    }
+
+    buildTree();
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::getAddressMap()
+//-----------------------------------------------------------------------------
+QSharedPointer<GlobalAddressMap const> GlobalAddressMap::getAddressMap(
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute)
+{
+    if (cpuRoute->addressMap_.isNull() || cpuRoute->addressMap_->getRoutesRevision() != cpuRoute->routesRevision_)
+    {
+        cpuRoute->addressMap_ = QSharedPointer<GlobalAddressMap const>(new GlobalAddressMap(cpuRoute));
+    }
+
+    return cpuRoute->addressMap_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::getInitiator()
+//-----------------------------------------------------------------------------
+QSharedPointer<ConnectivityInterface const> GlobalAddressMap::getInitiator() const
+{
+    return initiator_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::getRoutesRevision()
+//-----------------------------------------------------------------------------
+quint64 GlobalAddressMap::getRoutesRevision() const
+{
+    return routesRevision_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::getTargets()
+//-----------------------------------------------------------------------------
+QVector<GlobalAddressMap::Target> const& GlobalAddressMap::getTargets() const
+{
+    return targets_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::findTarget()
+//-----------------------------------------------------------------------------
+GlobalAddressMap::Target const* GlobalAddressMap::findTarget(quint64 address) const
+{
+    QVector<Target const*> containingTargets = findOverlapping(address, address);
+    if (containingTargets.isEmpty())
+    {
+        return nullptr;
+    }
+
+    return containingTargets.first();
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::findOverlapping()
+//-----------------------------------------------------------------------------
+QVector<GlobalAddressMap::Target const*> GlobalAddressMap::findOverlapping(quint64 firstAddress,
+    quint64 lastAddress) const
+{
+    QVector<Target const*> results;
+    collectOverlapping(0, orderedTargets_.size() - 1, firstAddress, lastAddress, results);
+
+    return results;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::findConflicts()
+//-----------------------------------------------------------------------------
+QVector<QPair<GlobalAddressMap::Target const*, GlobalAddressMap::Target const*> >
+    GlobalAddressMap::findConflicts() const
+{
+    QVector<QPair<Target const*, Target const*> > conflicts;
+
+    for (int targetIndex : orderedTargets_)
+    {
+        Target const* target = &targets_.at(targetIndex);
+
+        // Targets are reported in base address order, so only the ones starting within the target are new pairs.
+        for (Target const* overlapping : findOverlapping(target->baseAddress_, target->lastAddress_))
+        {
+            if (overlapping != target && (overlapping->baseAddress_ > target->baseAddress_ ||
+                (overlapping->baseAddress_ == target->baseAddress_ && overlapping > target)))
+            {
+                conflicts.append(qMakePair(target, overlapping));
+            }
+        }
+    }
+
+    return conflicts;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::buildTree()
+//-----------------------------------------------------------------------------
+void GlobalAddressMap::buildTree()
+{
+    for (int i = 0; i < targets_.size(); ++i)
+    {
+        if (targets_.at(i).isAddressable_)
+        {
+            orderedTargets_.append(i);
+        }
+    }
+
+    std::stable_sort(orderedTargets_.begin(), orderedTargets_.end(), [this](int first, int second)
+        {
+            return targets_.at(first).baseAddress_ < targets_.at(second).baseAddress_;
+        });
+
+    subtreeLastAddress_.fill(0, orderedTargets_.size());
+    buildSubtree(0, orderedTargets_.size() - 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::buildSubtree()
+//-----------------------------------------------------------------------------
+quint64 GlobalAddressMap::buildSubtree(int first, int last)
+{
+    if (first > last)
+    {
+        return 0;
+    }
+
+    int middle = first + (last - first) / 2;
+
+    quint64 largestLastAddress = targets_.at(orderedTargets_.at(middle)).lastAddress_;
+    largestLastAddress = qMax(largestLastAddress, buildSubtree(first, middle - 1));
+    largestLastAddress = qMax(largestLastAddress, buildSubtree(middle + 1, last));
+
+    subtreeLastAddress_[middle] = largestLastAddress;
+    return largestLastAddress;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalAddressMap::collectOverlapping()
+//-----------------------------------------------------------------------------
+void GlobalAddressMap::collectOverlapping(int first, int last, quint64 firstAddress, quint64 lastAddress,
+    QVector<Target const*>& results) const
+{
+    if (first > last)
+    {
+        return;
+    }
+
+    int middle = first + (last - first) / 2;
+    if (subtreeLastAddress_.at(middle) < firstAddress)
+    {
+        return;
+    }
+
+    collectOverlapping(first, middle - 1, firstAddress, lastAddress, results);
+
+    Target const& target = targets_.at(orderedTargets_.at(middle));
+    if (target.baseAddress_ > lastAddress)
+    {
+        // All the targets in the right subtree start after the searched range.
+        return;
+    }
+
+    if (target.lastAddress_ >= firstAddress)
+    {
+        results.append(&target);
+    }
+
+    collectOverlapping(middle + 1, last, firstAddress, lastAddress, results);
+}
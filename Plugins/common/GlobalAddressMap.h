@@ -0,0 +1,179 @@
+//-----------------------------------------------------------------------------
+// File: GlobalAddressMap.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Flattened address map of the memory map targets visible to a single initiator interface.
+//-----------------------------------------------------------------------------
+
+#ifndef GLOBALADDRESSMAP_H
+#define GLOBALADDRESSMAP_H
+
+#include <Plugins/common/CpuRoutesContainer.h>
+
+#include <QPair>
+#include <QSharedPointer>
+#include <QVector>
+
+class ConnectivityInterface;
+class MemoryItem;
+
+//-----------------------------------------------------------------------------
+//! Flattened address map of the memory map targets visible to a single initiator interface.
+//!
+//! The addresses of each target are calculated once from the initiator routes. Addressable targets are
+//! stored in a static interval tree for logarithmic address lookups and overlap queries.
+//-----------------------------------------------------------------------------
+class GlobalAddressMap
+{
+public:
+
+    //! A memory map target in the global address space of the initiator.
+    struct Target
+    {
+        //! The target interface connected to the memory map.
+        QSharedPointer<ConnectivityInterface const> targetInterface_;
+
+        //! The memory map of the target.
+        QSharedPointer<MemoryItem> memoryItem_;
+
+        //! The initiator route leading to the target.
+        QVector<QSharedPointer<ConnectivityInterface const> > route_;
+
+        //! Position of the target interface in the route.
+        int routePosition_ = 0;
+
+        //! The first address of the target as seen by the initiator.
+        quint64 baseAddress_ = 0;
+
+        //! The last address of the target as seen by the initiator.
+        quint64 lastAddress_ = 0;
+
+        //! Flag for targets reachable within the address range of the initiator.
+        bool isAddressable_ = false;
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] cpuRoute    The initiator interface and its routes.
+     */
+    explicit GlobalAddressMap(QSharedPointer<CpuRouteStructs::CpuRoute const> cpuRoute);
+
+    //! The destructor.
+    ~GlobalAddressMap() = default;
+
+    // Disable copying.
+    GlobalAddressMap(GlobalAddressMap const& rhs) = delete;
+    GlobalAddressMap& operator=(GlobalAddressMap const& rhs) = delete;
+
+    /*!
+     *  Get the address map of the selected initiator. The map is calculated on first use and stored in the route
+     *  until the routes change.
+     *
+     *    @param [in] cpuRoute    The initiator interface and its routes.
+     *
+     *    @return The address map of the initiator.
+     */
+    static QSharedPointer<GlobalAddressMap const> getAddressMap(QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute);
+
+    /*!
+     *  Get the initiator interface of the map.
+     *
+     *    @return The initiator interface.
+     */
+    QSharedPointer<ConnectivityInterface const> getInitiator() const;
+
+    /*!
+     *  Get the revision of the routes the map was calculated from.
+     *
+     *    @return The revision of the initiator routes.
+     */
+    quint64 getRoutesRevision() const;
+
+    /*!
+     *  Get all the targets in route order.
+     *
+     *    @return The targets of the initiator.
+     */
+    QVector<Target> const& getTargets() const;
+
+    /*!
+     *  Find the addressable target containing the selected address.
+     *
+     *    @param [in] address     The address to look for.
+     *
+     *    @return The target with the lowest base address containing the address, or nullptr if none is found.
+     */
+    Target const* findTarget(quint64 address) const;
+
+    /*!
+     *  Find the addressable targets overlapping the selected address range.
+     *
+     *    @param [in] firstAddress    The first address of the range.
+     *    @param [in] lastAddress     The last address of the range.
+     *
+     *    @return The overlapping targets in base address order.
+     */
+    QVector<Target const*> findOverlapping(quint64 firstAddress, quint64 lastAddress) const;
+
+    /*!
+     *  Find the pairs of addressable targets with overlapping address ranges.
+     *
+     *    @return The overlapping target pairs.
+     */
+    QVector<QPair<Target const*, Target const*> > findConflicts() const;
+
+private:
+
+    /*!
+     *  Build the interval tree of the addressable targets.
+     */
+    void buildTree();
+
+    /*!
+     *  Build the subtree maximums for the selected range of the ordered targets.
+     *
+     *    @param [in] first   Index of the first target in the range.
+     *    @param [in] last    Index of the last target in the range.
+     *
+     *    @return The largest last address in the range.
+     */
+    quint64 buildSubtree(int first, int last);
+
+    /*!
+     *  Collect the targets overlapping the selected address range within a subtree.
+     *
+     *    @param [in] first           Index of the first target in the subtree.
+     *    @param [in] last            Index of the last target in the subtree.
+     *    @param [in] firstAddress    The first address of the searched range.
+     *    @param [in] lastAddress     The last address of the searched range.
+     *    @param [in/out] results     The overlapping targets.
+     */
+    void collectOverlapping(int first, int last, quint64 firstAddress, quint64 lastAddress,
+        QVector<Target const*>& results) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The initiator interface.
+    QSharedPointer<ConnectivityInterface const> initiator_;
+
+    //! The revision of the routes the map was calculated from.
+    quint64 routesRevision_ = 0;
+
+    //! All the targets in route order.
+    QVector<Target> targets_;
+
+    //! Indexes of the addressable targets ordered by base address. Nodes of the implicit balanced tree.
+    QVector<int> orderedTargets_;
+
+    //! The largest last address within the subtree rooted at each ordered target.
+    QVector<quint64> subtreeLastAddress_;
+};
+
+#endif // GLOBALADDRESSMAP_H
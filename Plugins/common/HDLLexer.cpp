@@ -0,0 +1,797 @@
+//-----------------------------------------------------------------------------
+// File: HDLLexer.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Single-pass tokenizer for Verilog, SystemVerilog and VHDL source text.
+//-----------------------------------------------------------------------------
+
+#include "HDLLexer.h"
+
+namespace
+{
+    //! Verilog multi-character operators, longest first.
+    const QStringList VERILOG_OPERATORS({
+        "<<<=", ">>>=", "===", "!==", "==?", "!=?", "<<<", ">>>", "<<=", ">>=", "|->", "|=>", "<->", "->>",
+        "&&&", "**", "==", "!=", "<=", ">=", "&&", "||", "<<", ">>", "::", "->", "+:", "-:", "##", "++", "--",
+        "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "~&", "~|", "~^", "^~", ".*", "@@"});
+
+    //! VHDL multi-character operators, longest first.
+    const QStringList VHDL_OPERATORS({
+        "?/=", "?<=", "?>=", "**", ":=", "<=", ">=", "=>", "/=", "<>", "??", "?=", "?<", "?>", "<<", ">>"});
+
+    //! Verilog directives that take the rest of the line as arguments.
+    const QStringList VERILOG_LINE_DIRECTIVES({
+        "define", "include", "timescale", "default_nettype", "line", "pragma", "begin_keywords",
+        "unconnected_drive", "default_decay_time", "default_trireg_strength", "delay_mode_distributed",
+        "delay_mode_path", "delay_mode_unit", "delay_mode_zero"});
+
+    //! Verilog directives that take a single identifier as an argument.
+    const QStringList VERILOG_CONDITIONAL_DIRECTIVES({"ifdef", "ifndef", "elsif", "undef"});
+
+    //! Verilog directives without arguments.
+    const QStringList VERILOG_PLAIN_DIRECTIVES({
+        "else", "endif", "resetall", "celldefine", "endcelldefine", "undefineall", "end_keywords",
+        "nounconnected_drive"});
+
+    //! VHDL reserved words that may directly precede a character literal.
+    const QStringList VHDL_KEYWORDS_BEFORE_LITERAL({
+        "abs", "and", "downto", "else", "elsif", "if", "in", "is", "mod", "nand", "nor", "not", "or", "others",
+        "rem", "report", "return", "select", "severity", "then", "to", "until", "when", "while", "xnor", "xor"});
+
+    //! Prefixes of VHDL bit string literals e.g. x"FF".
+    const QStringList VHDL_BIT_STRING_PREFIXES({"b", "o", "x", "d", "ub", "uo", "ux", "sb", "so", "sx"});
+
+    /*!
+     *  Checks if the character may be a part of an identifier.
+     *
+     *    @param [in] character   The character to check.
+     *
+     *    @return True, if the character is a letter, a digit or an underscore, otherwise false.
+     */
+    bool isWordCharacter(QChar const& character);
+
+    /*!
+     *  Checks if the character is an opening bracket.
+     *
+     *    @param [in] character   The character to check.
+     *
+     *    @return True, if the character is (, [ or {, otherwise false.
+     */
+    bool isOpeningBracket(QChar const& character);
+
+    /*!
+     *  Gets the opening bracket for a closing bracket.
+     *
+     *    @param [in] character   The closing bracket.
+     *
+     *    @return The corresponding opening bracket, or a null character if the character is not a bracket.
+     */
+    QChar openingBracketFor(QChar const& character);
+
+    //-----------------------------------------------------------------------------
+    // Function: isWordCharacter()
+    //-----------------------------------------------------------------------------
+    bool isWordCharacter(QChar const& character)
+    {
+        return character.isLetterOrNumber() || character == QLatin1Char('_');
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: isOpeningBracket()
+    //-----------------------------------------------------------------------------
+    bool isOpeningBracket(QChar const& character)
+    {
+        return character == QLatin1Char('(') || character == QLatin1Char('[') || character == QLatin1Char('{');
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: openingBracketFor()
+    //-----------------------------------------------------------------------------
+    QChar openingBracketFor(QChar const& character)
+    {
+        if (character == QLatin1Char(')'))
+        {
+            return QLatin1Char('(');
+        }
+        else if (character == QLatin1Char(']'))
+        {
+            return QLatin1Char('[');
+        }
+        else if (character == QLatin1Char('}'))
+        {
+            return QLatin1Char('{');
+        }
+
+        return QChar();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::HDLLexer()
+//-----------------------------------------------------------------------------
+HDLLexer::HDLLexer(QString const& source, Language language):
+source_(source),
+language_(language)
+{
+    // Most tokens are longer than a few characters, so this avoids most of the reallocations.
+    tokens_.reserve(source_.size() / 4);
+    matches_.reserve(source_.size() / 4);
+
+    if (language_ == Language::Verilog)
+    {
+        tokenizeVerilog();
+    }
+    else
+    {
+        tokenizeVHDL();
+    }
+
+    openBrackets_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::source()
+//-----------------------------------------------------------------------------
+QString const& HDLLexer::source() const
+{
+    return source_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::count()
+//-----------------------------------------------------------------------------
+int HDLLexer::count() const
+{
+    return tokens_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::token()
+//-----------------------------------------------------------------------------
+HDLLexer::Token const& HDLLexer::token(int index) const
+{
+    return tokens_.at(index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::text()
+//-----------------------------------------------------------------------------
+QStringView HDLLexer::text(int index) const
+{
+    Token const& current = tokens_.at(index);
+    return QStringView(source_).mid(current.position, current.length);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::slice()
+//-----------------------------------------------------------------------------
+QString HDLLexer::slice(int first, int last) const
+{
+    if (first < 0 || last < first || last >= tokens_.size())
+    {
+        return QString();
+    }
+
+    int begin = tokens_.at(first).position;
+    return source_.mid(begin, tokens_.at(last).end() - begin);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::isWord()
+//-----------------------------------------------------------------------------
+bool HDLLexer::isWord(int index, QString const& word) const
+{
+    if (index < 0 || index >= tokens_.size() || tokens_.at(index).type != TokenType::Identifier)
+    {
+        return false;
+    }
+
+    Qt::CaseSensitivity sensitivity = language_ == Language::VHDL ? Qt::CaseInsensitive : Qt::CaseSensitive;
+    return text(index).compare(word, sensitivity) == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::isOperator()
+//-----------------------------------------------------------------------------
+bool HDLLexer::isOperator(int index, QString const& operation) const
+{
+    return index >= 0 && index < tokens_.size() && tokens_.at(index).type == TokenType::Operator &&
+        text(index).compare(operation) == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::isTrivia()
+//-----------------------------------------------------------------------------
+bool HDLLexer::isTrivia(int index) const
+{
+    TokenType type = tokens_.at(index).type;
+    return type == TokenType::Comment || type == TokenType::Attribute;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::next()
+//-----------------------------------------------------------------------------
+int HDLLexer::next(int index) const
+{
+    int candidate = index + 1;
+    while (candidate < tokens_.size() && isTrivia(candidate))
+    {
+        ++candidate;
+    }
+
+    return candidate;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::previous()
+//-----------------------------------------------------------------------------
+int HDLLexer::previous(int index) const
+{
+    int candidate = index - 1;
+    while (candidate >= 0 && isTrivia(candidate))
+    {
+        --candidate;
+    }
+
+    return candidate;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::matching()
+//-----------------------------------------------------------------------------
+int HDLLexer::matching(int index) const
+{
+    if (index < 0 || index >= matches_.size())
+    {
+        return -1;
+    }
+
+    return matches_.at(index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::onSameLine()
+//-----------------------------------------------------------------------------
+bool HDLLexer::onSameLine(int from, int to) const
+{
+    for (int i = from; i < to && i < source_.size(); ++i)
+    {
+        if (source_.at(i) == QLatin1Char('\n'))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::commentText()
+//-----------------------------------------------------------------------------
+QString HDLLexer::commentText(int index) const
+{
+    QStringView comment = text(index);
+    if (comment.startsWith(QLatin1String("/*")))
+    {
+        comment = comment.mid(2);
+        if (comment.endsWith(QLatin1String("*/")))
+        {
+            comment.chop(2);
+        }
+    }
+    else
+    {
+        // Both // and -- are two characters long.
+        comment = comment.mid(2);
+    }
+
+    return comment.trimmed().toString();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::simplifiedText()
+//-----------------------------------------------------------------------------
+QString HDLLexer::simplifiedText(int first, int last) const
+{
+    QString simplified;
+    int previousEnd = -1;
+    for (int i = qMax(first, 0); i <= last && i < tokens_.size(); ++i)
+    {
+        if (isTrivia(i))
+        {
+            continue;
+        }
+
+        Token const& current = tokens_.at(i);
+        if (previousEnd != -1 && current.position > previousEnd)
+        {
+            simplified.append(QLatin1Char(' '));
+        }
+
+        simplified.append(source_.constData() + current.position, current.length);
+        previousEnd = current.end();
+    }
+
+    return simplified;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::tokenizeVerilog()
+//-----------------------------------------------------------------------------
+void HDLLexer::tokenizeVerilog()
+{
+    const int size = source_.size();
+
+    int i = 0;
+    while (i < size)
+    {
+        QChar current = source_.at(i);
+        QChar following = i + 1 < size ? source_.at(i + 1) : QChar();
+
+        // Attribute instance (* ... *), but not the event control @(*).
+        int attributeEnd = -1;
+        if (current == QLatin1Char('(') && following == QLatin1Char('*') &&
+            (i + 2 >= size || source_.at(i + 2) != QLatin1Char(')')))
+        {
+            attributeEnd = source_.indexOf(QLatin1String("*)"), i + 2);
+        }
+
+        if (current.isSpace())
+        {
+            ++i;
+        }
+        else if (current == QLatin1Char('/') && following == QLatin1Char('/'))
+        {
+            int end = findLineEnd(i);
+            addToken(TokenType::Comment, i, end - i);
+            i = end;
+        }
+        else if (current == QLatin1Char('/') && following == QLatin1Char('*'))
+        {
+            int end = findBlockCommentEnd(i);
+            addToken(TokenType::Comment, i, end - i);
+            i = end;
+        }
+        else if (attributeEnd != -1)
+        {
+            int end = attributeEnd + 2;
+            addToken(TokenType::Attribute, i, end - i);
+            i = end;
+        }
+        else if (current == QLatin1Char('"'))
+        {
+            int end = i + 1;
+            while (end < size && source_.at(end) != QLatin1Char('"') && source_.at(end) != QLatin1Char('\n'))
+            {
+                end += source_.at(end) == QLatin1Char('\\') ? 2 : 1;
+            }
+
+            end = qMin(end + 1, size);
+            addToken(TokenType::String, i, end - i);
+            i = end;
+        }
+        else if (current == QLatin1Char('`') && (following.isLetter() || following == QLatin1Char('_')))
+        {
+            int nameEnd = i + 1;
+            while (nameEnd < size && (isWordCharacter(source_.at(nameEnd)) || source_.at(nameEnd) == QLatin1Char('$')))
+            {
+                ++nameEnd;
+            }
+
+            QString name = source_.mid(i + 1, nameEnd - i - 1);
+            if (VERILOG_LINE_DIRECTIVES.contains(name))
+            {
+                // The directive continues to the next line, if the line ends in a backslash.
+                int end = findLineEnd(i);
+                while (end < size && end > 0 && source_.at(end - 1) == QLatin1Char('\\'))
+                {
+                    end = findLineEnd(source_.indexOf(QLatin1Char('\n'), end) + 1);
+                }
+
+                addToken(TokenType::Directive, i, end - i);
+                i = end;
+            }
+            else if (VERILOG_CONDITIONAL_DIRECTIVES.contains(name))
+            {
+                int end = nameEnd;
+                while (end < size && (source_.at(end) == QLatin1Char(' ') || source_.at(end) == QLatin1Char('\t')))
+                {
+                    ++end;
+                }
+
+                int argumentEnd = end;
+                while (argumentEnd < size && (isWordCharacter(source_.at(argumentEnd)) ||
+                    source_.at(argumentEnd) == QLatin1Char('$')))
+                {
+                    ++argumentEnd;
+                }
+
+                end = argumentEnd == end ? nameEnd : argumentEnd;
+                addToken(TokenType::Directive, i, end - i);
+                i = end;
+            }
+            else if (VERILOG_PLAIN_DIRECTIVES.contains(name))
+            {
+                addToken(TokenType::Directive, i, nameEnd - i);
+                i = nameEnd;
+            }
+            else
+            {
+                // Macro usage is treated as an identifier.
+                addToken(TokenType::Identifier, i, nameEnd - i);
+                i = nameEnd;
+            }
+        }
+        else if (current.isLetter() || current == QLatin1Char('_') || current == QLatin1Char('$'))
+        {
+            int end = i + 1;
+            while (end < size && (isWordCharacter(source_.at(end)) || source_.at(end) == QLatin1Char('$')))
+            {
+                ++end;
+            }
+
+            addToken(TokenType::Identifier, i, end - i);
+            i = end;
+        }
+        else if (current == QLatin1Char('\\'))
+        {
+            // Escaped identifier ends in white space.
+            int end = i + 1;
+            while (end < size && source_.at(end).isSpace() == false)
+            {
+                ++end;
+            }
+
+            addToken(TokenType::Identifier, i, end - i);
+            i = end;
+        }
+        else if (current.isDigit() || (current == QLatin1Char('\'') &&
+            (isWordCharacter(following) || following == QLatin1Char('?'))))
+        {
+            int end = i;
+            if (current.isDigit())
+            {
+                while (end < size && (source_.at(end).isDigit() || source_.at(end) == QLatin1Char('_')))
+                {
+                    ++end;
+                }
+
+                if (end + 1 < size && source_.at(end) == QLatin1Char('.') && source_.at(end + 1).isDigit())
+                {
+                    end += 2;
+                    while (end < size && (source_.at(end).isDigit() || source_.at(end) == QLatin1Char('_')))
+                    {
+                        ++end;
+                    }
+                }
+
+                if (end + 1 < size && (source_.at(end) == QLatin1Char('e') || source_.at(end) == QLatin1Char('E')) &&
+                    (source_.at(end + 1) == QLatin1Char('+') || source_.at(end + 1) == QLatin1Char('-')) &&
+                    end + 2 < size && source_.at(end + 2).isDigit())
+                {
+                    end += 2;
+                }
+
+                // Exponents, time units and the digits of based literals without size.
+                while (end < size && isWordCharacter(source_.at(end)))
+                {
+                    ++end;
+                }
+            }
+
+            // Based literal e.g. 8'hFF, 'b1 or '0.
+            if (end + 1 < size && source_.at(end) == QLatin1Char('\'') &&
+                (isWordCharacter(source_.at(end + 1)) || source_.at(end + 1) == QLatin1Char('?')))
+            {
+                int baseBegin = end + 1;
+                end = baseBegin;
+                while (end < size && (isWordCharacter(source_.at(end)) || source_.at(end) == QLatin1Char('?')))
+                {
+                    ++end;
+                }
+
+                // Digits may be separated from the base by white space, e.g. 'h FF.
+                QString base = source_.mid(baseBegin, end - baseBegin).toLower();
+                if (base == QLatin1String("b") || base == QLatin1String("o") || base == QLatin1String("d") ||
+                    base == QLatin1String("h") || base == QLatin1String("sb") || base == QLatin1String("so") ||
+                    base == QLatin1String("sd") || base == QLatin1String("sh"))
+                {
+                    int digitBegin = end;
+                    while (digitBegin < size &&
+                        (source_.at(digitBegin) == QLatin1Char(' ') || source_.at(digitBegin) == QLatin1Char('\t')))
+                    {
+                        ++digitBegin;
+                    }
+
+                    int digitEnd = digitBegin;
+                    while (digitEnd < size &&
+                        (isWordCharacter(source_.at(digitEnd)) || source_.at(digitEnd) == QLatin1Char('?')))
+                    {
+                        ++digitEnd;
+                    }
+
+                    if (digitEnd != digitBegin)
+                    {
+                        end = digitEnd;
+                    }
+                }
+            }
+
+            addToken(TokenType::Number, i, end - i);
+            i = end;
+        }
+        else if (current == QLatin1Char('\'') && following == QLatin1Char('{'))
+        {
+            addToken(TokenType::Operator, i, 2);
+            matches_.last() = -1;
+            openBrackets_.append(tokens_.size() - 1);
+            i += 2;
+        }
+        else
+        {
+            int length = operatorLength(i, VERILOG_OPERATORS);
+            addToken(TokenType::Operator, i, length);
+            i += length;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::tokenizeVHDL()
+//-----------------------------------------------------------------------------
+void HDLLexer::tokenizeVHDL()
+{
+    const int size = source_.size();
+
+    int i = 0;
+    while (i < size)
+    {
+        QChar current = source_.at(i);
+        QChar following = i + 1 < size ? source_.at(i + 1) : QChar();
+
+        if (current.isSpace())
+        {
+            ++i;
+        }
+        else if (current == QLatin1Char('-') && following == QLatin1Char('-'))
+        {
+            int end = findLineEnd(i);
+            addToken(TokenType::Comment, i, end - i);
+            i = end;
+        }
+        else if (current == QLatin1Char('/') && following == QLatin1Char('*'))
+        {
+            int end = findBlockCommentEnd(i);
+            addToken(TokenType::Comment, i, end - i);
+            i = end;
+        }
+        else if (current == QLatin1Char('"'))
+        {
+            // Quotation marks are escaped by doubling them.
+            int end = i + 1;
+            while (end < size && source_.at(end) != QLatin1Char('\n') && (source_.at(end) != QLatin1Char('"') ||
+                (end + 1 < size && source_.at(end + 1) == QLatin1Char('"'))))
+            {
+                end += source_.at(end) == QLatin1Char('"') ? 2 : 1;
+            }
+
+            end = qMin(end + 1, size);
+            addToken(TokenType::String, i, end - i);
+            i = end;
+        }
+        else if (current == QLatin1Char('\'') && i + 2 < size && source_.at(i + 2) == QLatin1Char('\''))
+        {
+            // A tick after a name or a closing bracket is an attribute or a qualified expression.
+            int previousToken = tokens_.isEmpty() ? -1 : tokens_.size() - 1;
+            bool isTick = previousToken != -1 && ((tokens_.at(previousToken).type == TokenType::Identifier &&
+                VHDL_KEYWORDS_BEFORE_LITERAL.contains(text(previousToken).toString().toLower()) == false) ||
+                isOperator(previousToken, QStringLiteral(")")) || isOperator(previousToken, QStringLiteral("]")));
+
+            if (isTick)
+            {
+                addToken(TokenType::Operator, i, 1);
+                ++i;
+            }
+            else
+            {
+                addToken(TokenType::String, i, 3);
+                i += 3;
+            }
+        }
+        else if (current.isDigit())
+        {
+            int end = i;
+            while (end < size && (source_.at(end).isDigit() || source_.at(end) == QLatin1Char('_')))
+            {
+                ++end;
+            }
+
+            if (end < size && source_.at(end) == QLatin1Char('#'))
+            {
+                // Based literal e.g. 16#FF#.
+                int baseEnd = source_.indexOf(QLatin1Char('#'), end + 1);
+                if (baseEnd != -1 && onSameLine(end, baseEnd))
+                {
+                    end = baseEnd + 1;
+                }
+            }
+            else if (end + 1 < size && source_.at(end) == QLatin1Char('.') && source_.at(end + 1).isDigit())
+            {
+                end += 2;
+                while (end < size && (source_.at(end).isDigit() || source_.at(end) == QLatin1Char('_')))
+                {
+                    ++end;
+                }
+            }
+
+            if (end + 1 < size && (source_.at(end) == QLatin1Char('e') || source_.at(end) == QLatin1Char('E')) &&
+                (source_.at(end + 1).isDigit() || ((source_.at(end + 1) == QLatin1Char('+') ||
+                source_.at(end + 1) == QLatin1Char('-')) && end + 2 < size && source_.at(end + 2).isDigit())))
+            {
+                end += 2;
+                while (end < size && source_.at(end).isDigit())
+                {
+                    ++end;
+                }
+            }
+
+            // Sized bit string literal e.g. 12x"FF".
+            int prefixEnd = end;
+            while (prefixEnd < size && source_.at(prefixEnd).isLetter())
+            {
+                ++prefixEnd;
+            }
+
+            if (prefixEnd < size && source_.at(prefixEnd) == QLatin1Char('"') &&
+                VHDL_BIT_STRING_PREFIXES.contains(source_.mid(end, prefixEnd - end).toLower()))
+            {
+                int stringEnd = source_.indexOf(QLatin1Char('"'), prefixEnd + 1);
+                end = stringEnd == -1 ? size : stringEnd + 1;
+            }
+
+            addToken(TokenType::Number, i, end - i);
+            i = end;
+        }
+        else if (current.isLetter())
+        {
+            int end = i + 1;
+            while (end < size && isWordCharacter(source_.at(end)))
+            {
+                ++end;
+            }
+
+            if (end < size && source_.at(end) == QLatin1Char('"') &&
+                VHDL_BIT_STRING_PREFIXES.contains(source_.mid(i, end - i).toLower()))
+            {
+                int stringEnd = source_.indexOf(QLatin1Char('"'), end + 1);
+                end = stringEnd == -1 ? size : stringEnd + 1;
+                addToken(TokenType::Number, i, end - i);
+            }
+            else
+            {
+                addToken(TokenType::Identifier, i, end - i);
+            }
+
+            i = end;
+        }
+        else if (current == QLatin1Char('\\'))
+        {
+            // Extended identifier, backslashes are escaped by doubling them.
+            int end = i + 1;
+            while (end < size && source_.at(end) != QLatin1Char('\n') && (source_.at(end) != QLatin1Char('\\') ||
+                (end + 1 < size && source_.at(end + 1) == QLatin1Char('\\'))))
+            {
+                end += source_.at(end) == QLatin1Char('\\') ? 2 : 1;
+            }
+
+            end = qMin(end + 1, size);
+            addToken(TokenType::Identifier, i, end - i);
+            i = end;
+        }
+        else if (current == QLatin1Char('`'))
+        {
+            // Tool directive.
+            int end = findLineEnd(i);
+            addToken(TokenType::Directive, i, end - i);
+            i = end;
+        }
+        else
+        {
+            int length = operatorLength(i, VHDL_OPERATORS);
+            addToken(TokenType::Operator, i, length);
+            i += length;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::addToken()
+//-----------------------------------------------------------------------------
+void HDLLexer::addToken(TokenType type, int position, int length)
+{
+    int index = tokens_.size();
+    tokens_.append(Token{ type, position, length });
+    matches_.append(-1);
+
+    if (type != TokenType::Operator || length != 1)
+    {
+        return;
+    }
+
+    QChar character = source_.at(position);
+    if (isOpeningBracket(character))
+    {
+        openBrackets_.append(index);
+        return;
+    }
+
+    QChar opening = openingBracketFor(character);
+    if (opening.isNull() || openBrackets_.isEmpty())
+    {
+        return;
+    }
+
+    // Verilog '{ is closed with a plain brace.
+    int openIndex = openBrackets_.last();
+    QChar openCharacter = source_.at(tokens_.at(openIndex).end() - 1);
+    if (openCharacter == opening)
+    {
+        openBrackets_.removeLast();
+        matches_[openIndex] = index;
+        matches_[index] = openIndex;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::findLineEnd()
+//-----------------------------------------------------------------------------
+int HDLLexer::findLineEnd(int position) const
+{
+    int end = source_.indexOf(QLatin1Char('\n'), position);
+    if (end == -1)
+    {
+        return source_.size();
+    }
+
+    if (end > position && source_.at(end - 1) == QLatin1Char('\r'))
+    {
+        --end;
+    }
+
+    return end;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::findBlockCommentEnd()
+//-----------------------------------------------------------------------------
+int HDLLexer::findBlockCommentEnd(int position) const
+{
+    int end = source_.indexOf(QLatin1String("*/"), position + 2);
+    if (end == -1)
+    {
+        return source_.size();
+    }
+
+    return end + 2;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HDLLexer::operatorLength()
+//-----------------------------------------------------------------------------
+int HDLLexer::operatorLength(int position, QStringList const& operators) const
+{
+    QStringView remaining = QStringView(source_).mid(position);
+    for (QString const& operation : operators)
+    {
+        if (remaining.startsWith(operation))
+        {
+            return operation.size();
+        }
+    }
+
+    return 1;
+}
@@ -0,0 +1,275 @@
+//-----------------------------------------------------------------------------
+// File: HDLLexer.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Single-pass tokenizer for Verilog, SystemVerilog and VHDL source text.
+//-----------------------------------------------------------------------------
+
+#ifndef HDLLEXER_H
+#define HDLLEXER_H
+
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Single-pass tokenizer for Verilog, SystemVerilog and VHDL source text.
+//!
+//! The source is scanned once and every token keeps its exact position in the source, so that parsers can
+//! take declarations, expressions and comments as slices of the original text. Whitespace is not tokenized.
+//! Bracket pairs are matched during tokenization to allow skipping nested expressions in constant time.
+//-----------------------------------------------------------------------------
+class HDLLexer
+{
+public:
+
+    //! The supported languages.
+    enum class Language
+    {
+        Verilog,
+        VHDL
+    };
+
+    //! The token types.
+    enum class TokenType
+    {
+        Identifier,     //!< Identifiers and keywords, including Verilog macro usages e.g. `WIDTH.
+        Number,         //!< Numeric literals, including sized, based and bit string literals.
+        String,         //!< String literals and VHDL character literals.
+        Operator,       //!< Operators, brackets and other punctuation.
+        Comment,        //!< Line and block comments.
+        Attribute,      //!< Verilog attribute instances (* ... *).
+        Directive       //!< Compiler directive lines e.g. `define or `ifdef, including line continuations.
+    };
+
+    //! A token in the source.
+    struct Token
+    {
+        //! The type of the token.
+        TokenType type;
+
+        //! The position of the first character of the token in the source.
+        int position;
+
+        //! The number of characters in the token.
+        int length;
+
+        //! The position after the last character of the token.
+        int end() const { return position + length; }
+    };
+
+    /*!
+     *  The constructor. Tokenizes the given source.
+     *
+     *    @param [in] source      The source text to tokenize.
+     *    @param [in] language    The language of the source.
+     */
+    HDLLexer(QString const& source, Language language);
+
+    //! The destructor.
+    ~HDLLexer() = default;
+
+    /*!
+     *  Gets the tokenized source text.
+     *
+     *    @return The source text.
+     */
+    QString const& source() const;
+
+    /*!
+     *  Gets the number of tokens in the source.
+     *
+     *    @return The number of tokens.
+     */
+    int count() const;
+
+    /*!
+     *  Gets the token in the given index.
+     *
+     *    @param [in] index   The index of the token.
+     *
+     *    @return The token in the index.
+     */
+    Token const& token(int index) const;
+
+    /*!
+     *  Gets the source text of the token in the given index.
+     *
+     *    @param [in] index   The index of the token.
+     *
+     *    @return The token text.
+     */
+    QStringView text(int index) const;
+
+    /*!
+     *  Gets the source text from the beginning of a token to the end of another.
+     *
+     *    @param [in] first   The index of the first token.
+     *    @param [in] last    The index of the last token.
+     *
+     *    @return The source text between the tokens, or an empty string if last is before first.
+     */
+    QString slice(int first, int last) const;
+
+    /*!
+     *  Checks if the token in the given index is the given identifier or keyword. VHDL is compared case
+     *  insensitively.
+     *
+     *    @param [in] index   The index of the token.
+     *    @param [in] word    The word to compare to.
+     *
+     *    @return True, if the token is an identifier matching the word, otherwise false.
+     */
+    bool isWord(int index, QString const& word) const;
+
+    /*!
+     *  Checks if the token in the given index is the given operator.
+     *
+     *    @param [in] index       The index of the token.
+     *    @param [in] operation   The operator to compare to.
+     *
+     *    @return True, if the token is the operator, otherwise false.
+     */
+    bool isOperator(int index, QString const& operation) const;
+
+    /*!
+     *  Checks if the token in the given index has no effect on the structure, i.e. is a comment or an attribute.
+     *
+     *    @param [in] index   The index of the token.
+     *
+     *    @return True, if the token is a comment or an attribute, otherwise false.
+     */
+    bool isTrivia(int index) const;
+
+    /*!
+     *  Finds the next token that is not a comment or an attribute.
+     *
+     *    @param [in] index   The index to start searching after.
+     *
+     *    @return The index of the next significant token, or count() if none found.
+     */
+    int next(int index) const;
+
+    /*!
+     *  Finds the previous token that is not a comment or an attribute.
+     *
+     *    @param [in] index   The index to start searching before.
+     *
+     *    @return The index of the previous significant token, or -1 if none found.
+     */
+    int previous(int index) const;
+
+    /*!
+     *  Finds the matching bracket for a bracket token.
+     *
+     *    @param [in] index   The index of an opening or closing bracket.
+     *
+     *    @return The index of the matching bracket, or -1 if the token is not a bracket or has no pair.
+     */
+    int matching(int index) const;
+
+    /*!
+     *  Checks if there is no line break in the source between the given positions.
+     *
+     *    @param [in] from    The first position.
+     *    @param [in] to      The position after the last position to check.
+     *
+     *    @return True, if the positions are on the same line, otherwise false.
+     */
+    bool onSameLine(int from, int to) const;
+
+    /*!
+     *  Finds the text of a comment without the comment delimiters.
+     *
+     *    @param [in] index   The index of a comment token.
+     *
+     *    @return The comment text, trimmed.
+     */
+    QString commentText(int index) const;
+
+    /*!
+     *  Gets the source text between two tokens without comments and attributes. Tokens separated by whitespace
+     *  or removed comments are separated by a single space.
+     *
+     *    @param [in] first   The index of the first token.
+     *    @param [in] last    The index of the last token.
+     *
+     *    @return The simplified source text between the tokens.
+     */
+    QString simplifiedText(int first, int last) const;
+
+private:
+
+    /*!
+     *  Tokenizes Verilog or SystemVerilog source.
+     */
+    void tokenizeVerilog();
+
+    /*!
+     *  Tokenizes VHDL source.
+     */
+    void tokenizeVHDL();
+
+    /*!
+     *  Adds a token and matches it against the open brackets, if the token is a bracket.
+     *
+     *    @param [in] type        The token type.
+     *    @param [in] position    The position of the token.
+     *    @param [in] length      The length of the token.
+     */
+    void addToken(TokenType type, int position, int length);
+
+    /*!
+     *  Finds the end of a line comment beginning in the given position.
+     *
+     *    @param [in] position    The position of the comment start.
+     *
+     *    @return The position of the line break ending the comment or the end of the source.
+     */
+    int findLineEnd(int position) const;
+
+    /*!
+     *  Finds the end of a block comment beginning in the given position.
+     *
+     *    @param [in] position    The position of the comment start.
+     *
+     *    @return The position after the comment end, or the end of the source if the comment is not closed.
+     */
+    int findBlockCommentEnd(int position) const;
+
+    /*!
+     *  Checks if the character in the given position starts a multi-character operator.
+     *
+     *    @param [in] position    The position to check.
+     *    @param [in] operators   The multi-character operators of the language, longest first.
+     *
+     *    @return The length of the operator in the position.
+     */
+    int operatorLength(int position, QStringList const& operators) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The tokenized source text.
+    QString source_;
+
+    //! The language of the source.
+    Language language_;
+
+    //! The tokens in the source.
+    QVector<Token> tokens_;
+
+    //! The index of the matching bracket for each token, or -1.
+    QVector<int> matches_;
+
+    //! The indexes of the currently open brackets during tokenization.
+    QVector<int> openBrackets_;
+};
+
+#endif // HDLLEXER_H
@@ -15,6 +15,8 @@
 
 #include <KactusAPI/include/LibraryInterface.h>
 
+#include <KactusAPI/include/TraceRecorder.h>
+
 #include <IPXACTmodels/utilities/Search.h>
 
 #include <IPXACTmodels/utilities/ComponentSearch.h>
@@ -61,6 +63,8 @@ adHocWires_(new QList<QSharedPointer<MetaWire> >)
 QList<QSharedPointer<MetaDesign> > MetaDesign::parseHierarchy(LibraryInterface* library, GenerationTuple input,
     QSharedPointer<View> topComponentView)
 {
+    TRACE_SCOPE_DETAIL("generation", "MetaDesign::parseHierarchy", input.component->getVlnv().toString());
+
     QSharedPointer<ComponentInstance> componentInstance(nullptr);
     QSharedPointer<QList<QSharedPointer<Parameter> > > topList(new QList<QSharedPointer<Parameter> >);
     QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > cevs(nullptr);
@@ -128,6 +132,8 @@ QList<QSharedPointer<MetaDesign> > MetaDesign::parseHierarchy(LibraryInterface*
          parsedDesigns.append(currentDesign);
     }
 
+    TRACE_COUNTER("generation", "Parsed designs", parsedDesigns.size());
+
     return parsedDesigns;
 }
 
@@ -707,8 +713,8 @@ void MetaDesign::parseAdHocAssignmentForPort(QSharedPointer<MetaPort> mPort,
     // Determine the part of the wire that shall be assigned to the port:
     // This is [abs(physical.left  physical.right):0]
     QPair<QString, QString> newBounds;
-    newBounds.first = QString::number(assignment->physicalBounds_.first.toInt() -
-        assignment->physicalBounds_.second.toInt());
+    newBounds.first = QString::number(assignment->physicalBounds_.first.toLongLong() -
+        assignment->physicalBounds_.second.toLongLong());
     newBounds.second = QStringLiteral("0");
 
     assignment->logicalBounds_ = newBounds;
@@ -1020,25 +1026,25 @@ void MetaDesign::assignLargerBounds(QSharedPointer<MetaWire> wire, QPair<QString
     // Do the comparison only if there are existing bounds.
     if (!wire->bounds_.first.isEmpty() && !wire->bounds_.second.isEmpty())
     {
-        QPair<int,int> newBounds;
+        QPair<qint64, qint64> newBounds;
 
         // Check the size of the new bounds.
-        newBounds.first = boundCand.first.toInt();
-        newBounds.second = boundCand.second.toInt();
+        newBounds.first = boundCand.first.toLongLong();
+        newBounds.second = boundCand.second.toLongLong();
 
         // Find the widest alignment order of the new bounds.
-        int maxAlignment1 = qMax(newBounds.first, newBounds.second);
-        int minAlignment1 = qMin(newBounds.first, newBounds.second);
+        qint64 maxAlignment1 = qMax(newBounds.first, newBounds.second);
+        qint64 minAlignment1 = qMin(newBounds.first, newBounds.second);
 
-        QPair<int,int> existingBound;
+        QPair<qint64, qint64> existingBound;
 
         // Check the size of the existing bounds.
-        existingBound.first = wire->bounds_.first.toInt();
-        existingBound.second = wire->bounds_.second.toInt();
+        existingBound.first = wire->bounds_.first.toLongLong();
+        existingBound.second = wire->bounds_.second.toLongLong();
 
         // Find the widest alignment order of the existing bounds.
-        int maxAlignment2 = qMax(existingBound.first, existingBound.second);
-        int minAlignment2 = qMin(existingBound.first, existingBound.second);
+        qint64 maxAlignment2 = qMax(existingBound.first, existingBound.second);
+        qint64 minAlignment2 = qMin(existingBound.first, existingBound.second);
 
         // Finally, compare and assign.
         wire->bounds_.first = QString::number(qMax(maxAlignment1,maxAlignment2));
@@ -207,11 +207,11 @@ void MetaInstance::parsePortAssignments(IPXactSystemVerilogParser const& parser)
             if (logicalBounds.first.isEmpty() || logicalBounds.second.isEmpty())
             {
                 // Pick the total width of the physical bounds.
-                int left = parseExpression(parser, physicalBounds.first).toInt();
-                int right = parseExpression(parser, physicalBounds.second).toInt();
+                qint64 left = parseExpression(parser, physicalBounds.first).toLongLong();
+                qint64 right = parseExpression(parser, physicalBounds.second).toLongLong();
 
                 // This is [abs(physical.left  physical.right):0]
-                logicalBounds.first = QString::number(abs(left - right));
+                logicalBounds.first = QString::number(qAbs(left - right));
                 logicalBounds.second = QStringLiteral("0");
             }
 
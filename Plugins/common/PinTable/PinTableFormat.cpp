@@ -0,0 +1,36 @@
+//-----------------------------------------------------------------------------
+// File: PinTableFormat.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Description of a text table listing the pins of a device.
+//-----------------------------------------------------------------------------
+
+#include "PinTableFormat.h"
+
+//-----------------------------------------------------------------------------
+// Function: PinTableFormat::csvPinList()
+//-----------------------------------------------------------------------------
+PinTableFormat PinTableFormat::csvPinList()
+{
+    PinTableFormat format;
+    format.name_ = QStringLiteral("CSV pin list");
+    format.delimiter_ = QLatin1Char(',');
+    format.commentPrefix_ = QStringLiteral("#");
+    format.columnCount_ = 3;
+    format.portColumn_ = 0;
+    format.descriptionColumn_ = 1;
+    format.directionColumn_ = 2;
+    format.directions_ = {
+        { QStringLiteral("in"), DirectionTypes::IN },
+        { QStringLiteral("input"), DirectionTypes::IN },
+        { QStringLiteral("out"), DirectionTypes::OUT },
+        { QStringLiteral("output"), DirectionTypes::OUT },
+        { QStringLiteral("inout"), DirectionTypes::INOUT },
+        { QStringLiteral("bidir"), DirectionTypes::INOUT } };
+
+    return format;
+}
@@ -0,0 +1,57 @@
+//-----------------------------------------------------------------------------
+// File: PinTableFormat.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Description of a text table listing the pins of a device.
+//-----------------------------------------------------------------------------
+
+#ifndef PINTABLEFORMAT_H
+#define PINTABLEFORMAT_H
+
+#include <IPXACTmodels/common/DirectionTypes.h>
+
+#include <QHash>
+#include <QString>
+
+//-----------------------------------------------------------------------------
+//! Description of a text table listing the pins of a device, one pin per line.
+//-----------------------------------------------------------------------------
+struct PinTableFormat
+{
+    //! The name of the format.
+    QString name_;
+
+    //! The character separating the columns of a line.
+    QChar delimiter_ = QLatin1Char(',');
+
+    //! Lines starting with this prefix are comments.
+    QString commentPrefix_;
+
+    //! The number of columns a pin line must have at least.
+    int columnCount_ = 0;
+
+    //! The column giving the name of the port created for the pin.
+    int portColumn_ = 0;
+
+    //! The column giving the description of the port, or -1 if the format has none.
+    int descriptionColumn_ = -1;
+
+    //! The column giving the direction of the pin.
+    int directionColumn_ = -1;
+
+    //! The port directions of the direction column values. The keys are in lower case.
+    QHash<QString, DirectionTypes::Direction> directions_;
+
+    /*!
+     *  Creates the format for plain comma separated pin lists with the columns location, name and direction.
+     *
+     *    @return The format description.
+     */
+    static PinTableFormat csvPinList();
+};
+
+#endif // PINTABLEFORMAT_H
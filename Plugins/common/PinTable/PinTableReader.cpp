@@ -0,0 +1,135 @@
+//-----------------------------------------------------------------------------
+// File: PinTableReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Reads pin definitions from the lines of a pin table.
+//-----------------------------------------------------------------------------
+
+#include "PinTableReader.h"
+
+#include <QVarLengthArray>
+
+//-----------------------------------------------------------------------------
+// Function: PinTableReader::PinTableReader()
+//-----------------------------------------------------------------------------
+PinTableReader::PinTableReader(QList<PinTableFormat> const& formats): formats_(formats)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: PinTableReader::readLine()
+//-----------------------------------------------------------------------------
+bool PinTableReader::readLine(QStringView line, PinDefinition& pin)
+{
+    if (formatIndex_ != -1)
+    {
+        return readLine(line, formats_.at(formatIndex_), pin);
+    }
+
+    for (int i = 0; i < formats_.size(); ++i)
+    {
+        if (readLine(line, formats_.at(i), pin))
+        {
+            formatIndex_ = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PinTableReader::getFormat()
+//-----------------------------------------------------------------------------
+PinTableFormat const* PinTableReader::getFormat() const
+{
+    if (formatIndex_ == -1)
+    {
+        return nullptr;
+    }
+
+    return &formats_.at(formatIndex_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PinTableReader::readLine()
+//-----------------------------------------------------------------------------
+bool PinTableReader::readLine(QStringView line, PinTableFormat const& format, PinDefinition& pin)
+{
+    QStringView content = line.trimmed();
+    if (content.isEmpty() ||
+        (format.commentPrefix_.isEmpty() == false && content.startsWith(format.commentPrefix_)))
+    {
+        return false;
+    }
+
+    QVarLengthArray<QStringView, 16> columns;
+    for (QStringView field : content.tokenize(format.delimiter_))
+    {
+        columns.append(columnValue(field));
+    }
+
+    if (columns.size() < format.columnCount_ || format.portColumn_ >= columns.size() ||
+        format.directionColumn_ >= columns.size() || format.descriptionColumn_ >= columns.size())
+    {
+        return false;
+    }
+
+    QStringView portName = columns.at(format.portColumn_);
+    if (portName.isEmpty())
+    {
+        return false;
+    }
+
+    for (QChar character : portName)
+    {
+        if (character.isLetterOrNumber() == false && character != QLatin1Char('_'))
+        {
+            return false;
+        }
+    }
+
+    // Pins without a direction are created as phantom ports. Unknown directions mark lines that are not pins,
+    // such as the column titles.
+    DirectionTypes::Direction direction = DirectionTypes::DIRECTION_PHANTOM;
+    if (format.directionColumn_ >= 0 && columns.at(format.directionColumn_).isEmpty() == false)
+    {
+        auto directionIterator = format.directions_.constFind(columns.at(format.directionColumn_).toString().toLower());
+        if (directionIterator == format.directions_.constEnd())
+        {
+            return false;
+        }
+
+        direction = directionIterator.value();
+    }
+
+    pin.portName_ = portName.toString();
+    pin.direction_ = direction;
+    pin.description_.clear();
+
+    if (format.descriptionColumn_ >= 0)
+    {
+        pin.description_ = columns.at(format.descriptionColumn_).toString();
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PinTableReader::columnValue()
+//-----------------------------------------------------------------------------
+QStringView PinTableReader::columnValue(QStringView field)
+{
+    QStringView value = field.trimmed();
+    if (value.size() >= 2 && value.startsWith(QLatin1Char('"')) && value.endsWith(QLatin1Char('"')))
+    {
+        value = value.mid(1, value.size() - 2).trimmed();
+    }
+
+    return value;
+}
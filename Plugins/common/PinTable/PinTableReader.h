@@ -0,0 +1,106 @@
+//-----------------------------------------------------------------------------
+// File: PinTableReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Reads pin definitions from the lines of a pin table.
+//-----------------------------------------------------------------------------
+
+#ifndef PINTABLEREADER_H
+#define PINTABLEREADER_H
+
+#include "PinTableFormat.h"
+
+#include <QList>
+#include <QString>
+#include <QStringView>
+
+//-----------------------------------------------------------------------------
+//! A pin read from a pin table.
+//-----------------------------------------------------------------------------
+struct PinDefinition
+{
+    //! The name of the port for the pin.
+    QString portName_;
+
+    //! The description of the port.
+    QString description_;
+
+    //! The direction of the port.
+    DirectionTypes::Direction direction_ = DirectionTypes::DIRECTION_PHANTOM;
+};
+
+//-----------------------------------------------------------------------------
+//! Reads pin definitions from the lines of a pin table.
+//!
+//! The lines are given one at a time, so the table can be read while it is streamed. The first line accepted
+//! by any of the given formats selects the format for the rest of the table.
+//-----------------------------------------------------------------------------
+class PinTableReader
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] formats     The accepted formats in the order of preference.
+     */
+    explicit PinTableReader(QList<PinTableFormat> const& formats);
+
+    //! The destructor.
+    ~PinTableReader() = default;
+
+    /*!
+     *  Reads a pin definition from a line of the table.
+     *
+     *    @param [in] line    The line to read.
+     *    @param [out] pin    The pin defined on the line.
+     *
+     *    @return True, if the line defines a pin, otherwise false.
+     */
+    bool readLine(QStringView line, PinDefinition& pin);
+
+    /*!
+     *  Gets the format of the table.
+     *
+     *    @return The format selected by the lines read, or null if no pin has been read.
+     */
+    PinTableFormat const* getFormat() const;
+
+private:
+
+    /*!
+     *  Reads a pin definition from a line in the given format.
+     *
+     *    @param [in] line        The line to read.
+     *    @param [in] format      The format of the line.
+     *    @param [out] pin        The pin defined on the line.
+     *
+     *    @return True, if the line defines a pin in the format, otherwise false.
+     */
+    static bool readLine(QStringView line, PinTableFormat const& format, PinDefinition& pin);
+
+    /*!
+     *  Gets the value of a column without surrounding whitespace and quotes.
+     *
+     *    @param [in] field   The column as written on the line.
+     *
+     *    @return The value of the column.
+     */
+    static QStringView columnValue(QStringView field);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The accepted formats.
+    QList<PinTableFormat> formats_;
+
+    //! The index of the format of the table, or -1 if not yet known.
+    int formatIndex_ = -1;
+};
+
+#endif // PINTABLEREADER_H
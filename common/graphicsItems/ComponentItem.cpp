@@ -194,6 +194,14 @@ QSharedPointer<Component> ComponentItem::componentModel() const
     return component_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentItem::setComponentModel()
+//-----------------------------------------------------------------------------
+void ComponentItem::setComponentModel(QSharedPointer<Component> component)
+{
+    component_ = component;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentItem::getComponentInstance()
 //-----------------------------------------------------------------------------
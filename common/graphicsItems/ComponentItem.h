@@ -210,6 +210,13 @@ protected:
      */
     LibraryInterface* getLibraryInterface();
 
+    /*!
+     *  Replaces the component model, e.g. with a private copy of a shared component.
+     *
+     *    @param [in] component   The new component model.
+     */
+    void setComponentModel(QSharedPointer<Component> component);
+
     /*!
      *  Updates the name label with the given text.
      *
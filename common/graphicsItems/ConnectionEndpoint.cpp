@@ -256,6 +256,14 @@ QSharedPointer<ApiInterface> ConnectionEndpoint::getApiInterface() const
     return nullptr;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ConnectionEndpoint::prepareInterfaceEdit()
+//-----------------------------------------------------------------------------
+void ConnectionEndpoint::prepareInterfaceEdit()
+{
+
+}
+
 //-----------------------------------------------------------------------------
 // Function: ConnectionEndpoint::getPort()
 //-----------------------------------------------------------------------------
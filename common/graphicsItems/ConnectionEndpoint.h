@@ -261,6 +261,13 @@ public:
      */
     virtual QSharedPointer<ApiInterface> getApiInterface() const;
 
+    /*!
+     *  Prepares the interface model of the endpoint for modification.
+     *
+     *      @remarks Endpoints sharing their interface model with other items take a private copy of it.
+     */
+    virtual void prepareInterfaceEdit();
+
     /*!
      *  Returns the ad-hoc port of the endpoint.
      *
@@ -178,6 +178,11 @@ void GraphicsConnection::setRoute(QList<QPointF> path)
 
     route_->setRoute(path);
 
+    if (parent_ != nullptr && scene() != nullptr)
+    {
+        parent_->updateRoutingIndex(this);
+    }
+
     paintConnectionPath();
     positionUpdated();
 }
@@ -634,8 +639,16 @@ void GraphicsConnection::createRoute(ConnectionEndpoint* endpoint1, ConnectionEn
         }
     }
 
-    pathPoints_ = DefaultRouting::createRoute(startPoint, endPoint, 
-        endpoint1->getDirection(), endpoint2->getDirection());
+    if (parent_ != nullptr)
+    {
+        pathPoints_ = parent_->createConnectionRoute(this, startPoint, endpoint1->getDirection(),
+            endPoint, endpoint2->getDirection());
+    }
+    else
+    {
+        pathPoints_ = DefaultRouting::createRoute(startPoint, endPoint,
+            endpoint1->getDirection(), endpoint2->getDirection());
+    }
     
     setRoute(pathPoints_);
 
@@ -737,6 +750,18 @@ QVariant GraphicsConnection::itemChange(GraphicsItemChange change, const QVarian
             endpoint2_->setSelectionHighlight(selected);
         }
     }
+    else if (change == ItemSceneHasChanged && parent_ != nullptr)
+    {
+        // Keep the routing index in sync with the connections shown in the diagram.
+        if (scene() != nullptr)
+        {
+            parent_->updateRoutingIndex(this);
+        }
+        else
+        {
+            parent_->removeFromRoutingIndex(this);
+        }
+    }
 
     return QGraphicsPathItem::itemChange(change, value);
 }
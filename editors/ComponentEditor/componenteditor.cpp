@@ -51,6 +51,7 @@
 #include <editors/common/ExpressionSet.h>
 
 #include <KactusAPI/include/ParameterCache.h>
+#include <KactusAPI/include/RecordingParameterFinder.h>
 #include <KactusAPI/include/IPXactSystemVerilogParser.h>
 #include <KactusAPI/include/ComponentAndInstantiationsParameterFinder.h>
 #include <KactusAPI/include/ModeConditionParserInterface.h>
@@ -96,12 +97,13 @@ visualizerSlot_(&editorVisualizerSplitter_),
 //! This is the reason for weird sorting of the parameters, parameter cache uses uuid as the key, which is semi-random and causes weird sorting behaviour.
 //! 
 parameterFinder_(new ParameterCache(component_)),
+recordingParameterFinder_(new RecordingParameterFinder(parameterFinder_)),
 fullParameterFinder_(QSharedPointer<ComponentAndInstantiationsParameterFinder>(
     new ComponentAndInstantiationsParameterFinder(component))),
 referenceCounter_(QSharedPointer<ComponentParameterReferenceCounter>(new ComponentParameterReferenceCounter(
     fullParameterFinder_, component))),
 expressionFormatter_(new ExpressionFormatter(parameterFinder_)),
-expressionParser_(new IPXactSystemVerilogParser(parameterFinder_)),
+expressionParser_(new IPXactSystemVerilogParser(recordingParameterFinder_)),
 absDefFinder_(new ListParameterFinder()),
 absDefParser_(new IPXactSystemVerilogParser(absDefFinder_)),
 modeConditionParserInterface_(new ModeConditionParserInterface(parameterFinder_)),
@@ -145,6 +147,7 @@ validator_(new ComponentValidator(expressionParser_, absDefParser_, absDefFinder
     setupLayout();
 
 	// set the component to be displayed in the navigation model
+    navigationModel_.setParameterFinder(recordingParameterFinder_);
     navigationModel_.setRootItem(createNavigationRootForComponent());
 
 	QSettings settings;
@@ -252,15 +255,17 @@ void ComponentEditor::refresh()
     }
 	// rebuild the navigation tree
 	component_ = comp;
+
+    // The parameters of the new component must be available when validating the new navigation tree.
+    parameterFinder_->setComponent(comp);
+    fullParameterFinder_->setComponent(comp);
+
 	navigationModel_.setRootItem(createNavigationRootForComponent());
 	//component_.clear();
 
     referenceCounter_->setComponent(component_);
     parameterReferenceTree_->setComponent(component_);
 
-    parameterFinder_->setComponent(comp);
-    fullParameterFinder_->setComponent(comp);
-
 	// open the general editor.
 	onItemActivated(proxy_.index(0, 0, QModelIndex()));
 
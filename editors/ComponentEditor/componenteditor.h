@@ -60,6 +60,7 @@ class Component;
 class ExpressionParser;
 class ParameterFinder;
 class ListParameterFinder;
+class RecordingParameterFinder;
 class ExpressionFormatter;
 class ParameterReferenceTreeWindow;
 class ComponentParameterReferenceTree;
@@ -389,6 +390,9 @@ private:
     //! Finds the specified parameter inside the component (does not include instantiations).
     QSharedPointer<ComponentParameterFinder> parameterFinder_;
 
+    //! Records the parameters used in validating the navigation tree items.
+    QSharedPointer<RecordingParameterFinder> recordingParameterFinder_;
+
     //! Parameter finder for all the contained parameters (includes instantiations).
     QSharedPointer<ComponentAndInstantiationsParameterFinder> fullParameterFinder_;
 
@@ -92,7 +92,7 @@ void AddressBlockGraphItem::fillGapsBetweenChildren()
         if (auto current = i.value(); current->isPresent())
         {
             auto addrBlockOffset = getOffset();
-            quint64 currentChildOffset = childItems_.key(current);
+            quint64 currentChildOffset = i.key();
             auto relativeOffset = currentChildOffset - addrBlockOffset;
 
             if (currentChildOffset > 0 && relativeOffset > 0 && i == childItems_.begin())
@@ -115,7 +115,7 @@ void RegisterFileGraphItem::fillGapsBetweenChildren()
         if (auto current = i.value(); current->isPresent())
         {
             auto thisOffset = getOffset();
-            quint64 currentOffset = childItems_.key(current);
+            quint64 currentOffset = i.key();
             auto relativeOffset = currentOffset - thisOffset;
 
             if (currentOffset > 0 && relativeOffset > 0 && i == childItems_.begin())
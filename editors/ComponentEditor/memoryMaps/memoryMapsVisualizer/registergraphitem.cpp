@@ -78,10 +78,17 @@ void RegisterGraphItem::addChild(MemoryVisualizationItem* childItem)
 //-----------------------------------------------------------------------------
 void RegisterGraphItem::removeChild( MemoryVisualizationItem* childItem )
 {
-    quint64 offset = childItems_.key(childItem);
+    if (auto stored = childItems_.find(childItem->getOffset(), childItem); stored != childItems_.end())
+    {
+        childItems_.erase(stored);
+    }
+    else
+    {
+        quint64 offset = childItems_.key(childItem);
 
-    Q_ASSERT(childItems_.contains(offset));
-    childItems_.remove(offset, childItem);
+        Q_ASSERT(childItems_.contains(offset));
+        childItems_.remove(offset, childItem);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -357,49 +364,6 @@ QMultiMap<quint64, MemoryVisualizationItem*>::iterator RegisterGraphItem::addOut
 //-----------------------------------------------------------------------------
 void RegisterGraphItem::markConflictingChildren()
 {
-    if (childItems_.isEmpty())
-    {
-        return;
-    }
-
-    auto registerMSB = getRegisterMSB();
-    quint64 highestBitHandled = 0;
-
-    // QMap sorts children by ascending offsets.
-    for (auto i = childItems_.begin(); i != childItems_.end(); ++i)
-    {
-        auto currentChild = i.value();
-        auto currentOffset = currentChild->getOffset();
-
-        if (!currentChild->isPresent())
-        {
-            continue;
-        }
-
-        bool overlaps = currentOffset < highestBitHandled;
-        bool isOutsideRegister = currentOffset > registerMSB ||
-            currentChild->getLastAddress() > registerMSB;
-
-        currentChild->setConflicted(overlaps || isOutsideRegister);
-
-        if (overlaps && i != childItems_.begin())
-        {
-            // Walk in the opposite direction and mark any overlapping items conflicted.
-            for (auto previous = std::prev(i); previous != childItems_.begin(); --previous)
-            {
-                if ((*previous)->getLastAddress() >= currentOffset)
-                {
-                    (*previous)->setConflicted(true);
-                }
-            }
-
-            // Check first item separately to avoid undefined iterator behavior.
-            if (childItems_.first()->getLastAddress() >= currentOffset)
-            {
-                childItems_.first()->setConflicted(true);
-            }
-        }
-
-        highestBitHandled = qMax(highestBitHandled, currentChild->getLastAddress() + 1);
-    }
+    // The fields may use the bits from 0 to the register MSB.
+    markOverlappingChildren(0, getRegisterMSB());
 }
@@ -126,3 +126,19 @@ bool ComponentEditorIndirectInterfacesItem::isValid() const
     indirectInterfacesValidator_->childrenHaveUniqueNames(indirectInterfacesAsNameGroup);
     return ComponentEditorItem::isValid();
 }
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorIndirectInterfacesItem::isCoupledToLocalValidationScopes()
+//-----------------------------------------------------------------------------
+bool ComponentEditorIndirectInterfacesItem::isCoupledToLocalValidationScopes() const
+{
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorIndirectInterfacesItem::dependsOnLocalValidationScopeContents()
+//-----------------------------------------------------------------------------
+bool ComponentEditorIndirectInterfacesItem::dependsOnLocalValidationScopeContents() const
+{
+    return true;
+}
@@ -100,6 +100,12 @@ public:
 	 */
 	bool isValid() const override;
 
+protected:
+
+	bool isCoupledToLocalValidationScopes() const override;
+
+	bool dependsOnLocalValidationScopeContents() const override;
+
 private:
 
     //-----------------------------------------------------------------------------
@@ -101,5 +101,5 @@ bool ComponentEditorTreeProxyModel::filterAcceptsRow(int sourceRow, QModelIndex
 //-----------------------------------------------------------------------------
 bool ComponentEditorTreeProxyModel::itemIsValidAndCanBeHidden(QModelIndex const& index) const
 {
-	return !(index.isValid() && !static_cast<ComponentEditorItem*>(index.internalPointer())->isValid());
+	return !(index.isValid() && !static_cast<ComponentEditorItem*>(index.internalPointer())->getCachedValidity());
 }
@@ -92,8 +92,8 @@ QString MemoryRemapItem::text() const
 //-----------------------------------------------------------------------------
 bool MemoryRemapItem::isValid() const
 {
-    bool baseIsValid = memoryMapValidator_->MemoryMapBaseValidator::validate(
-        memoryRemap_, parentMemoryMap_->getAddressUnitBits());
+    bool baseIsValid = memoryMapValidator_->MemoryMapBaseValidator::validateShallow(
+        memoryRemap_, parentMemoryMap_->getAddressUnitBits()) && ComponentEditorItem::isValid();
 
     QSharedPointer<MemoryRemap> transformedMemoryRemap = memoryRemap_.dynamicCast<MemoryRemap>();
 
@@ -107,6 +107,14 @@ bool MemoryRemapItem::isValid() const
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryRemapItem::hasLocalValidationScope()
+//-----------------------------------------------------------------------------
+bool MemoryRemapItem::hasLocalValidationScope() const
+{
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryRemapItem::editor()
 //-----------------------------------------------------------------------------
@@ -216,6 +216,10 @@ signals:
      */
     void memoryRemapNameChanged(QString const& parentName, QString const& oldName, QString const& newName);
 
+protected:
+
+	bool hasLocalValidationScope() const override;
+
 private:
 
     void createGraphicsItemsForChild(ComponentEditorItem* childEditor);
@@ -125,3 +125,19 @@ bool ModesItem::isValid() const
     modesValidator_->childrenHaveUniqueNames(modesAsNameGroup);
     return ComponentEditorItem::isValid();
 }
+
+//-----------------------------------------------------------------------------
+// Function: ModesItem::isCoupledToLocalValidationScopes()
+//-----------------------------------------------------------------------------
+bool ModesItem::isCoupledToLocalValidationScopes() const
+{
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ModesItem::dependsOnLocalValidationScopeContents()
+//-----------------------------------------------------------------------------
+bool ModesItem::dependsOnLocalValidationScopeContents() const
+{
+    return true;
+}
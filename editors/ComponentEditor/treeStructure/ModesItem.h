@@ -96,6 +96,12 @@ public:
      */
     bool isValid() const override;
 
+protected:
+
+    bool isCoupledToLocalValidationScopes() const override;
+
+    bool dependsOnLocalValidationScopeContents() const override;
+
 private:
 	//! No copying
     ModesItem(const ModesItem& other);
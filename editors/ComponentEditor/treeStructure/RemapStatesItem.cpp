@@ -104,3 +104,11 @@ void RemapStatesItem::createChild(int index)
 
     childItems_.insert(index, remapItem);
 }
+
+//-----------------------------------------------------------------------------
+// Function: RemapStatesItem::isCoupledToLocalValidationScopes()
+//-----------------------------------------------------------------------------
+bool RemapStatesItem::isCoupledToLocalValidationScopes() const
+{
+    return true;
+}
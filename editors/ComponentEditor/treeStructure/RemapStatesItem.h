@@ -88,6 +88,10 @@ public:
      */
     virtual void createChild(int index);
 
+protected:
+
+    bool isCoupledToLocalValidationScopes() const override;
+
 private:
 	//! No copying
     RemapStatesItem(const RemapStatesItem& other);
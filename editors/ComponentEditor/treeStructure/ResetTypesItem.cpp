@@ -83,3 +83,11 @@ bool ResetTypesItem::isValid() const
 {
     return componentValidator_->hasValidResetTypes(component_);
 }
+
+//-----------------------------------------------------------------------------
+// Function: ResetTypesItem::isCoupledToLocalValidationScopes()
+//-----------------------------------------------------------------------------
+bool ResetTypesItem::isCoupledToLocalValidationScopes() const
+{
+    return true;
+}
@@ -77,6 +77,10 @@ public:
      */
 	virtual bool isValid() const;
 
+protected:
+
+    bool isCoupledToLocalValidationScopes() const override;
+
 private:
 	//! No copying.
 	ResetTypesItem(const ResetTypesItem& other);
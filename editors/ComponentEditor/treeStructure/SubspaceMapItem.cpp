@@ -71,6 +71,14 @@ bool SubspaceMapItem::isValid() const
     return subspaceValidator_->validate(subspaceMap_);
 }
 
+//-----------------------------------------------------------------------------
+// Function: SubspaceMapItem::hasLocalValidationScope()
+//-----------------------------------------------------------------------------
+bool SubspaceMapItem::hasLocalValidationScope() const
+{
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: SubspaceMapItem::editor()
 //-----------------------------------------------------------------------------
@@ -168,6 +168,10 @@ signals:
      */
     void subspaceNameChanged(QString const& oldName, QString const& newName);
 
+protected:
+
+	bool hasLocalValidationScope() const override;
+
 private:
 	
     //! Memory map containing the edited address block.
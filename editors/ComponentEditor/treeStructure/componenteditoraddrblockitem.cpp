@@ -12,6 +12,7 @@
 #include "componenteditoraddrblockitem.h"
 #include "componenteditorregisteritem.h"
 #include "componenteditorregisterfileitem.h"
+#include "componenteditortreemodel.h"
 
 #include <editors/ComponentEditor/memoryMaps/SingleAddressBlockEditor.h>
 #include <KactusAPI/include/RegisterInterface.h>
@@ -31,6 +32,9 @@
 #include <IPXACTmodels/Component/validators/AddressBlockValidator.h>
 
 #include <QApplication>
+
+#include <algorithm>
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorAddrBlockItem::ComponentEditorAddrBlockItem()
 //-----------------------------------------------------------------------------
@@ -55,11 +59,7 @@ blockInterface_(blockInterface)
 
 	setObjectName(tr("ComponentEditorAddrBlockItem"));
 
-    const int registerCount = addrBlock_->getRegisterData()->count();
-    for (int i = 0; i < registerCount; ++i)
-    {
-        createChild(i);
-    }
+    // The register items are created when the address block is expanded, see fetchChildren().
 }
 
 //-----------------------------------------------------------------------------
@@ -83,7 +83,22 @@ QString ComponentEditorAddrBlockItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorAddrBlockItem::isValid() const 
 {
-    return addressBlockValidator_->validate(addrBlock_, QString::number(addressUnitBits_));
+    // Registers not fetched yet have no cached validity.
+    if (canFetchChildren())
+    {
+        return addressBlockValidator_->validate(addrBlock_, QString::number(addressUnitBits_));
+    }
+
+    return addressBlockValidator_->validateShallow(addrBlock_, QString::number(addressUnitBits_)) &&
+        ComponentEditorItem::isValid();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::hasLocalValidationScope()
+//-----------------------------------------------------------------------------
+bool ComponentEditorAddrBlockItem::hasLocalValidationScope() const
+{
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -128,6 +143,78 @@ ItemEditor* ComponentEditorAddrBlockItem::editor()
 // Function: ComponentEditorAddrBlockItem::createChild()
 //-----------------------------------------------------------------------------
 void ComponentEditorAddrBlockItem::createChild( int index )
+{
+    auto child = createChildItem(index);
+
+    if (child && visualizer_)
+    {
+        createGraphicsItemsForChild(child.data());
+        onLayoutRefreshRequested();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::canFetchChildren()
+//-----------------------------------------------------------------------------
+bool ComponentEditorAddrBlockItem::canFetchChildren() const
+{
+    return childrenFetched_ == false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::getUnfetchedChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorAddrBlockItem::getUnfetchedChildCount() const
+{
+    if (childrenFetched_)
+    {
+        return 0;
+    }
+
+    return addrBlock_->getRegisterData()->count();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::fetchChildren()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::fetchChildren()
+{
+    if (childrenFetched_)
+    {
+        return;
+    }
+
+    childrenFetched_ = true;
+
+    // Lay out each address block graph item only once after all the registers have been added to it.
+    for (auto const& graphItem : graphItems_)
+    {
+        static_cast<AddressBlockGraphItem*>(graphItem)->beginChildUpdate();
+    }
+
+    auto registerData = addrBlock_->getRegisterData();
+    const int registerCount = registerData->count();
+    for (int i = 0; i < registerCount; ++i)
+    {
+        auto child = createChildItem(i);
+        if (child && visualizer_)
+        {
+            adoptModelGraphicsItems(child, registerData->at(i).data());
+        }
+    }
+
+    removeModelGraphicsItems();
+
+    for (auto const& graphItem : graphItems_)
+    {
+        static_cast<AddressBlockGraphItem*>(graphItem)->endChildUpdate();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::createChildItem()
+//-----------------------------------------------------------------------------
+QSharedPointer<ComponentEditorItem> ComponentEditorAddrBlockItem::createChildItem(int index)
 {
     QSharedPointer<RegisterBase> regmodel = addrBlock_->getRegisterData()->at(index);
 	
@@ -144,26 +231,24 @@ void ComponentEditorAddrBlockItem::createChild( int index )
             regItem.data(), SIGNAL(registerNameChanged(QString const&, QString const&)), Qt::UniqueConnection);
 
 		regItem->setLocked(locked_);
-		
-		if (visualizer_)
-        {
-            regItem->setVisualizer(visualizer_);
-            createGraphicsItemsForChild(regItem.data());
-            onLayoutRefreshRequested();
-        }
-        
+
+        // The field item is created when the register is expanded.
         if (reg->getFields()->isEmpty())
         {
             FieldInterface* fieldInterface = regInterface->getSubInterface();
             fieldInterface->setFields(reg->getFields());
             fieldInterface->addField(0);
+        }
 
-            regItem->createChild(0);
+		if (visualizer_)
+        {
+            regItem->setVisualizer(visualizer_);
         }
 
         connect(regItem.data(), SIGNAL(addressingChanged()),
             this, SLOT(onChildAddressingChanged()), Qt::UniqueConnection);
 		childItems_.insert(index, regItem);
+        return regItem;
 	}
     else if (auto regFile = regmodel.dynamicCast<RegisterFile>())
     {
@@ -176,15 +261,16 @@ void ComponentEditorAddrBlockItem::createChild( int index )
         if (visualizer_)
         {
             regFileItem->setVisualizer(visualizer_);
-            createGraphicsItemsForChild(regFileItem.data());
-            onLayoutRefreshRequested();
         }
 
         connect(regFileItem.data(), SIGNAL(refreshLayout()), this, SLOT(onLayoutRefreshRequested()), Qt::UniqueConnection);
         connect(regFileItem.data(), SIGNAL(addressingChanged()),
             this, SLOT(onChildAddressingChanged()), Qt::UniqueConnection);
         childItems_.insert(index, regFileItem);
+        return regFileItem;
     }
+
+    return QSharedPointer<ComponentEditorItem>();
 }
 
 //-----------------------------------------------------------------------------
@@ -230,7 +316,70 @@ void ComponentEditorAddrBlockItem::onGraphicsChanged()
 //-----------------------------------------------------------------------------
 void ComponentEditorAddrBlockItem::onChildGraphicsChanged(int index)
 {
-    childItems_.at(index)->updateGraphics();
+    if (childrenFetched_)
+    {
+        childItems_.at(index)->updateGraphics();
+        return;
+    }
+
+    if (auto registerData = addrBlock_->getRegisterData()->value(index))
+    {
+        for (auto const& graphItem : modelGraphItems_.values(registerData.data()))
+        {
+            graphItem->updateDisplay();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::onAddChild()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::onAddChild(int index)
+{
+    ComponentEditorItem::onAddChild(index);
+
+    // Registers not fetched yet are drawn from the register data, which already contains the added child.
+    if (childrenFetched_ == false)
+    {
+        recreateModelGraphicsItems();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::onRemoveChild()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::onRemoveChild(int index)
+{
+    ComponentEditorItem::onRemoveChild(index);
+
+    // Registers not fetched yet are drawn from the register data, from which the child is already removed.
+    if (childrenFetched_ == false)
+    {
+        recreateModelGraphicsItems();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::onModelItemSelected()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::onModelItemSelected()
+{
+    if (auto child = fetchChildForModelItem(sender()))
+    {
+        emit selectItem(child.data());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::onModelItemChildrenRequested()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::onModelItemChildrenRequested()
+{
+    auto child = fetchChildForModelItem(sender());
+    if (child && child->canFetchChildren())
+    {
+        model_->fetchMore(model_->index(child.data()));
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -301,7 +450,11 @@ void ComponentEditorAddrBlockItem::onChildAddressingChangedLocally(int index)
     // Index corresponds to register data index in address block register data 
     // (also: register data index == order in component editor tree)
 
-    if (auto childRegister = childItems_.at(index).dynamicCast<ComponentEditorRegisterItem>())
+    if (childrenFetched_ == false)
+    {
+        recreateModelGraphicsItems();
+    }
+    else if (auto childRegister = childItems_.at(index).dynamicCast<ComponentEditorRegisterItem>())
     {
         // Need to delete register graph items as well as field graph items
         childRegister->removeGraphicsItems();
@@ -453,9 +606,27 @@ void ComponentEditorAddrBlockItem::createGraphicsItems(QGraphicsItem* parentItem
 //-----------------------------------------------------------------------------
 void ComponentEditorAddrBlockItem::createGraphicsItemsForChildren()
 {
-    for (auto const& child : childItems_)
+    // Lay out each graphics item only once after all the children have been added to it.
+    for (auto const& graphItem : graphItems_)
     {
-        createGraphicsItemsForChild(child.data());
+        static_cast<AddressBlockGraphItem*>(graphItem)->beginChildUpdate();
+    }
+
+    if (childrenFetched_)
+    {
+        for (auto const& child : childItems_)
+        {
+            createGraphicsItemsForChild(child.data());
+        }
+    }
+    else
+    {
+        createModelGraphicsItems();
+    }
+
+    for (auto const& graphItem : graphItems_)
+    {
+        static_cast<AddressBlockGraphItem*>(graphItem)->endChildUpdate();
     }
 }
 
@@ -469,6 +640,11 @@ void ComponentEditorAddrBlockItem::updateGraphics()
         static_cast<AddressBlockGraphItem*>(graphItem)->updateDisplay();
 	}
 
+    for (auto const& graphItem : modelGraphItems_)
+    {
+        graphItem->updateDisplay();
+    }
+
     for (auto const& child : childItems_)
     {
         child->updateGraphics();
@@ -481,6 +657,8 @@ void ComponentEditorAddrBlockItem::updateGraphics()
 void ComponentEditorAddrBlockItem::removeGraphicsItems()
 {
     // First remove child graph items
+    removeModelGraphicsItems();
+
     for (auto const& child : childItems_)
     {
         if (auto registerFileItem = child.dynamicCast<ComponentEditorRegisterFileItem>())
@@ -541,3 +719,132 @@ void ComponentEditorAddrBlockItem::addressUnitBitsChanged(int newAddressUnitBits
 
     emit changeInAddressUnitBits(newAddressUnitBits);
 }
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::createModelGraphicsItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::createModelGraphicsItems()
+{
+    for (auto const& graphItem : graphItems_)
+    {
+        auto addrBlockGraphItem = static_cast<AddressBlockGraphItem*>(graphItem);
+
+        for (auto const& registerData : *addrBlock_->getRegisterData())
+        {
+            QList<MemoryVisualizationItem*> registerItems;
+            bool hasChildren = false;
+
+            if (auto reg = registerData.dynamicCast<Register>())
+            {
+                registerItems = ComponentEditorRegisterItem::createRegisterGraphItems(reg, expressionParser_,
+                    addrBlockGraphItem);
+                hasChildren = reg->getFields()->isEmpty() == false;
+            }
+            else if (auto regFile = registerData.dynamicCast<RegisterFile>())
+            {
+                registerItems = ComponentEditorRegisterFileItem::createRegisterFileGraphItems(regFile,
+                    expressionParser_, addrBlockGraphItem);
+                hasChildren = regFile->getRegisterData()->isEmpty() == false;
+            }
+
+            for (auto const& registerItem : registerItems)
+            {
+                addrBlockGraphItem->addChild(registerItem);
+                registerItem->setChildrenPending(hasChildren);
+                modelGraphItems_.insert(registerData.data(), registerItem);
+
+                connect(registerItem, SIGNAL(selectEditor()), this, SLOT(onModelItemSelected()), Qt::UniqueConnection);
+                connect(registerItem, SIGNAL(childrenRequested()),
+                    this, SLOT(onModelItemChildrenRequested()), Qt::UniqueConnection);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::recreateModelGraphicsItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::recreateModelGraphicsItems()
+{
+    if (graphItems_.isEmpty())
+    {
+        return;
+    }
+
+    removeModelGraphicsItems();
+    createModelGraphicsItems();
+
+    // Redo layout of child registers, inform parent item of addressing changes
+    onLayoutRefreshRequested();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::removeModelGraphicsItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::removeModelGraphicsItems()
+{
+    for (auto const& graphItem : modelGraphItems_)
+    {
+        Q_ASSERT(graphItem->parentItem());
+        static_cast<MemoryVisualizationItem*>(graphItem->parentItem())->removeChild(graphItem);
+
+        delete graphItem;
+    }
+
+    modelGraphItems_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::adoptModelGraphicsItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::adoptModelGraphicsItems(QSharedPointer<ComponentEditorItem> child,
+    RegisterBase const* registerData)
+{
+    QList<MemoryVisualizationItem*> registerItems = modelGraphItems_.values(registerData);
+    modelGraphItems_.remove(registerData);
+
+    if (registerItems.isEmpty())
+    {
+        createGraphicsItemsForChild(child.data());
+        return;
+    }
+
+    for (auto const& registerItem : registerItems)
+    {
+        disconnect(registerItem, nullptr, this, nullptr);
+    }
+
+    if (auto regItem = child.dynamicCast<ComponentEditorRegisterItem>())
+    {
+        regItem->adoptGraphicsItems(registerItems);
+        regItem->createGraphicsItemsForChildren();
+    }
+    else if (auto regFileItem = child.dynamicCast<ComponentEditorRegisterFileItem>())
+    {
+        regFileItem->adoptGraphicsItems(registerItems);
+        regFileItem->createGraphicsItemsForChildren();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::fetchChildForModelItem()
+//-----------------------------------------------------------------------------
+QSharedPointer<ComponentEditorItem> ComponentEditorAddrBlockItem::fetchChildForModelItem(QObject* graphItem)
+{
+    RegisterBase const* registerData =
+        modelGraphItems_.key(static_cast<MemoryVisualizationItem*>(graphItem), nullptr);
+
+    auto registers = addrBlock_->getRegisterData();
+    auto dataPosition = std::find_if(registers->cbegin(), registers->cend(),
+        [registerData](QSharedPointer<RegisterBase> const& candidate) { return candidate.data() == registerData; });
+
+    if (registerData == nullptr || dataPosition == registers->cend())
+    {
+        return QSharedPointer<ComponentEditorItem>();
+    }
+
+    // Fetch through the model, so that the navigation tree is informed of the new rows.
+    model_->fetchMore(model_->index(this));
+
+    return childItems_.value(std::distance(registers->cbegin(), dataPosition));
+}
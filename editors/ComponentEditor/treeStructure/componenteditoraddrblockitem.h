@@ -17,15 +17,18 @@
 #include <IPXACTmodels/Component/AddressBlock.h>
 
 #include <QFont>
+#include <QMultiHash>
 #include <QSharedPointer>
 
 class MemoryMapsVisualizer;
+class MemoryVisualizationItem;
 class AddressBlockGraphItem;
 class ExpressionParser;
 class AddressBlockValidator;
 class RegisterInterface;
 class AddressBlockInterface;
 class MemoryMapBase;
+class RegisterBase;
 
 //-----------------------------------------------------------------------------
 //! The item for a single address block in component editor's navigation tree.
@@ -110,6 +113,25 @@ public:
 
     virtual void removeChild(int index) final;
 
+    /*!
+     *  Check if the register items have not been created yet.
+     *
+     *    @return True, if the register items can be fetched, otherwise false.
+     */
+    bool canFetchChildren() const final;
+
+    /*!
+     *  Get the number of register items created by fetchChildren().
+     *
+     *    @return The number of registers and register files in the address block, if not fetched yet.
+     */
+    int getUnfetchedChildCount() const final;
+
+    /*!
+     *  Create the register items of the address block.
+     */
+    void fetchChildren() final;
+
     /*!
      *  Get pointer to the visualizer of this item.
 	 * 
@@ -176,6 +198,28 @@ protected slots:
 
     void onChildGraphicsChanged(int index);    
 
+    /*!
+     *  Handles the addition of a register from the editor.
+     *
+     *    @param [in] index   The index of the added register.
+     */
+    void onAddChild(int index) final;
+
+    /*!
+     *  Handles the removal of a register from the editor.
+     *
+     *    @param [in] index   The index of the removed register.
+     */
+    void onRemoveChild(int index) final;
+
+private slots:
+
+    //! Handle the selection of a register graph item drawn before the register items were fetched.
+    void onModelItemSelected();
+
+    //! Handle the expansion of a register graph item drawn before the register items were fetched.
+    void onModelItemChildrenRequested();
+
 signals:
     
     /*!
@@ -208,6 +252,10 @@ signals:
      */
     void addressBlockNameChanged(QString const& oldName, QString const& newName);
 
+protected:
+
+	bool hasLocalValidationScope() const override;
+
 private:
 
     /*!
@@ -216,6 +264,47 @@ private:
      *    @param [in] childEditor     The child to create items for.
      */
     void createGraphicsItemsForChild(ComponentEditorItem* childEditor);
+
+    /*!
+     *	Create the item for the register or register file in the given index without its graph items.
+     *
+     *    @param [in] index   The index of the register data to create the item for.
+     *
+     *    @return The created child item.
+     */
+    QSharedPointer<ComponentEditorItem> createChildItem(int index);
+
+    /*!
+     *	Create the register graph items directly from the register data, before the register items are fetched.
+     */
+    void createModelGraphicsItems();
+
+    /*!
+     *	Recreate the register graph items drawn from the register data and redo the layout.
+     */
+    void recreateModelGraphicsItems();
+
+    /*!
+     *	Remove the register graph items drawn from the register data.
+     */
+    void removeModelGraphicsItems();
+
+    /*!
+     *	Give the graph items drawn from the register data to the fetched child item.
+     *
+     *    @param [in] child           The fetched child item.
+     *    @param [in] registerData    The register or register file of the child item.
+     */
+    void adoptModelGraphicsItems(QSharedPointer<ComponentEditorItem> child, RegisterBase const* registerData);
+
+    /*!
+     *	Fetch the register items and find the item for a graph item drawn from the register data.
+     *
+     *    @param [in] graphItem   The graph item drawn from the register data.
+     *
+     *    @return The child item of the graph item.
+     */
+    QSharedPointer<ComponentEditorItem> fetchChildForModelItem(QObject* graphItem);
 	
     //! Memory map containing the edited address block.
     QSharedPointer<MemoryMapBase> containingMap_;
@@ -238,6 +327,12 @@ private:
 
     //! Interface for address blocks.
     AddressBlockInterface* blockInterface_;
+
+    //! Register graph items drawn from the register data, until the register items are fetched.
+    QMultiHash<RegisterBase const*, MemoryVisualizationItem*> modelGraphItems_;
+
+    //! Flag for register items already created.
+    bool childrenFetched_ = false;
 };
 
 #endif // COMPONENTEDITORADDRBLOCKITEM_H
@@ -162,6 +162,14 @@ bool ComponentEditorAddrSpacesItem::isValid() const
     return ComponentEditorItem::isValid();
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrSpacesItem::isCoupledToLocalValidationScopes()
+//-----------------------------------------------------------------------------
+bool ComponentEditorAddrSpacesItem::isCoupledToLocalValidationScopes() const
+{
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditoraddrspacesitem::createAddressSpaceValidator()
 //-----------------------------------------------------------------------------
@@ -105,6 +105,10 @@ public:
 	 */
 	bool isValid() const override;
 
+protected:
+
+	bool isCoupledToLocalValidationScopes() const override;
+
 private slots:
 
     /*!
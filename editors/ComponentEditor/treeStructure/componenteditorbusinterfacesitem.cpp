@@ -177,3 +177,11 @@ bool ComponentEditorBusInterfacesItem::isValid() const
     busInterfacesValidator_->childrenHaveUniqueNames(interfacesAsNameGroup);
     return ComponentEditorItem::isValid();
 }
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorBusInterfacesItem::isCoupledToLocalValidationScopes()
+//-----------------------------------------------------------------------------
+bool ComponentEditorBusInterfacesItem::isCoupledToLocalValidationScopes() const
+{
+    return true;
+}
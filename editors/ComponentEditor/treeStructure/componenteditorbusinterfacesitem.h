@@ -115,6 +115,10 @@ public:
 	 */
 	bool isValid() const override;
 
+protected:
+
+	bool isCoupledToLocalValidationScopes() const override;
+
 signals:
 	void openAbsDef(VLNV const& absDefVLNV);
 
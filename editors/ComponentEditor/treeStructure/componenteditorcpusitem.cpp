@@ -105,6 +105,14 @@ bool ComponentEditorCpusItem::isValid() const
     return ComponentEditorItem::isValid();
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorCpusItem::isCoupledToLocalValidationScopes()
+//-----------------------------------------------------------------------------
+bool ComponentEditorCpusItem::isCoupledToLocalValidationScopes() const
+{
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorCpusItem::createChild()
 //-----------------------------------------------------------------------------
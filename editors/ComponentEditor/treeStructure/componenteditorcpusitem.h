@@ -92,6 +92,10 @@ public:
 	void createChild(int index) final;
 
 
+protected:
+
+	bool isCoupledToLocalValidationScopes() const override;
+
 private:
 
 	//! The cpus being edited
@@ -75,6 +75,14 @@ bool ComponentEditorFieldItem::isValid() const
     return fieldValidator_->validate(field_);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorFieldItem::hasLocalValidationScope()
+//-----------------------------------------------------------------------------
+bool ComponentEditorFieldItem::hasLocalValidationScope() const
+{
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorFieldItem::editor()
 //-----------------------------------------------------------------------------
@@ -165,6 +165,10 @@ protected slots:
      */
     virtual void onGraphicsChanged() override final;
 
+protected:
+
+	bool hasLocalValidationScope() const override;
+
 private:
 
 	//! The register which contains this field.
@@ -138,7 +138,31 @@ int ComponentEditorItem::rowCount() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorItem::hasChildren() const
 {
-	return !childItems_.isEmpty();
+	return !childItems_.isEmpty() || getUnfetchedChildCount() > 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditoritem::canFetchChildren()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::canFetchChildren() const
+{
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditoritem::getUnfetchedChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorItem::getUnfetchedChildCount() const
+{
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditoritem::fetchChildren()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::fetchChildren()
+{
+	// Child items are created eagerly by default.
 }
 
 //-----------------------------------------------------------------------------
@@ -177,7 +201,211 @@ bool ComponentEditorItem::isValid() const
 {
 	// if at least one child is not valid then this is not valid
 	return std::all_of(childItems_.cbegin(), childItems_.cend(),
-		[](auto const& childItem) { return childItem->isValid(); });
+		[](auto const& childItem) { return childItem->getCachedValidity(); });
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::getCachedValidity()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::getCachedValidity() const
+{
+	// The parent marks the validity of its sub items compared to each other, so it is validated first.
+	if (validity_ == ValidityState::UNKNOWN && parent_ && parent_->parent_ &&
+		parent_->validity_ == ValidityState::UNKNOWN)
+	{
+		parent_->getCachedValidity();
+	}
+
+	if (validity_ == ValidityState::UNKNOWN)
+	{
+		validity_ = ValidityState::VALIDATING;
+
+		model_->beginValidation();
+		bool valid = isValid();
+		parameterDependencies_ = model_->endValidation();
+		knownName_ = text();
+
+		validity_ = valid ? ValidityState::VALID : ValidityState::INVALID;
+	}
+
+	return validity_ == ValidityState::VALID;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateValidity()
+{
+	// Items coupled to the local validation scopes refer to the local items by their names.
+	QString currentName = text();
+	bool nameChanged = currentName != knownName_;
+	knownName_ = currentName;
+
+	invalidateSubItemValidity();
+	invalidateDependentValidity(nameChanged);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateChildValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateChildValidity()
+{
+	validity_ = ValidityState::UNKNOWN;
+
+	for (auto const& childItem : childItems_)
+	{
+		childItem->validity_ = ValidityState::UNKNOWN;
+	}
+
+	// The names of the added and removed sub items may be referred to.
+	invalidateDependentValidity(true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateParameterDependents()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateParameterDependents(QSet<QString> const& parameterIds)
+{
+	if (parameterDependencies_.intersects(parameterIds))
+	{
+		validity_ = ValidityState::UNKNOWN;
+
+		// The sub items are compared to each other when validating this item.
+		for (auto const& childItem : childItems_)
+		{
+			childItem->validity_ = ValidityState::UNKNOWN;
+		}
+
+		invalidateParentValidity();
+	}
+
+	for (auto const& childItem : childItems_)
+	{
+		childItem->invalidateParameterDependents(parameterIds);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateSubItemValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateSubItemValidity()
+{
+	validity_ = ValidityState::UNKNOWN;
+
+	for (auto const& childItem : childItems_)
+	{
+		childItem->invalidateSubItemValidity();
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateNonLocalItemValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateNonLocalItemValidity()
+{
+	validity_ = ValidityState::UNKNOWN;
+
+	for (auto const& childItem : childItems_)
+	{
+		if (childItem->hasLocalValidationScope() == false)
+		{
+			childItem->invalidateNonLocalItemValidity();
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateDependentValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateDependentValidity(bool nameChanged)
+{
+	ComponentEditorItem* rootItem = this;
+	while (rootItem->parent_)
+	{
+		rootItem = rootItem->parent_;
+	}
+
+	if (hasLocalValidationScope())
+	{
+		// Siblings are validated compared to each other, e.g. for unique names and overlapping.
+		if (parent_)
+		{
+			for (auto const& siblingItem : parent_->childItems_)
+			{
+				siblingItem->validity_ = ValidityState::UNKNOWN;
+			}
+		}
+
+		invalidateParentValidity();
+
+		for (auto const& topLevelItem : rootItem->childItems_)
+		{
+			if (topLevelItem->isCoupledToLocalValidationScopes() &&
+				(nameChanged || topLevelItem->dependsOnLocalValidationScopeContents()))
+			{
+				topLevelItem->invalidateSubItemValidity();
+			}
+		}
+	}
+	else if (inheritsLocalValidationScopeCoupling())
+	{
+		rootItem->invalidateSubItemValidity();
+	}
+	else
+	{
+		rootItem->invalidateNonLocalItemValidity();
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateParentValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateParentValidity()
+{
+	for (ComponentEditorItem* parentItem = parent_; parentItem != nullptr; parentItem = parentItem->parent_)
+	{
+		parentItem->validity_ = ValidityState::UNKNOWN;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::inheritsLocalValidationScopeCoupling()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::inheritsLocalValidationScopeCoupling() const
+{
+	for (ComponentEditorItem const* item = this; item != nullptr; item = item->parent_)
+	{
+		if (item->isCoupledToLocalValidationScopes())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::hasLocalValidationScope()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::hasLocalValidationScope() const
+{
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::isCoupledToLocalValidationScopes()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::isCoupledToLocalValidationScopes() const
+{
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::dependsOnLocalValidationScopeContents()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::dependsOnLocalValidationScopeContents() const
+{
+	return false;
 }
 
 //-----------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include <QSharedPointer>
 #include <QFont>
 #include <QList>
+#include <QSet>
 #include <QGraphicsItem>
 
 class LibraryInterface;
@@ -96,6 +97,23 @@ public:
 	 */
 	bool hasChildren() const;
 
+	/*!
+	 *  Checks if the child items are created on demand and have not been created yet.
+	 *
+	 *    @return True, if the child items should be fetched before accessing them.
+	 */
+	virtual bool canFetchChildren() const;
+
+	/*!
+	 *  Get the number of child items that have not been created yet.
+	 *
+	 *    @return The number of child items created by fetchChildren().
+	 */
+	virtual int getUnfetchedChildCount() const;
+
+	//! Creates the child items that have not been created yet.
+	virtual void fetchChildren();
+
 	/*!
 	 *  Get pointer to the child in given index.
 	 *
@@ -165,12 +183,45 @@ public:
 	virtual QString text() const = 0;
 
 	/*!
-	 *  Check the validity of this item and sub items.
+	 *  Check the validity of this item and sub items. The default implementation aggregates the cached
+	 *  validity of the sub items, so items should only check their own elements in addition to it.
 	 *
 	 *    @return bool True if item is in valid state.
 	 */
 	virtual bool isValid() const;
 
+	/*!
+	 *  Get the validity of this item. The result of isValid() is cached until the item is invalidated.
+	 *
+	 *    @return True if item is in valid state.
+	 */
+	bool getCachedValidity() const;
+
+	/*!
+	 *  Invalidate the cached validity of the items affected by a change in this item.
+	 *
+	 *  A change within a local validation scope affects this item, its sub items, its siblings and its
+	 *  parents, as well as the items depending on the contents of the local validation scopes. Renaming
+	 *  the item affects also the other items coupled to the local validation scopes. A change outside of the local
+	 *  validation scopes affects all the items outside of them, and all the items if this item is coupled
+	 *  to the local validation scopes.
+	 */
+	void invalidateValidity();
+
+	/*!
+	 *  Invalidate the cached validity of the items affected by adding, removing or moving the sub items of
+	 *  this item. The affected items are the same as in invalidateValidity(), except for the sub items of
+	 *  the sub items.
+	 */
+	void invalidateChildValidity();
+
+	/*!
+	 *  Invalidate the cached validity of the items in this branch whose validity depends on the given parameters.
+	 *
+	 *    @param [in] parameterIds    The ids of the changed parameters.
+	 */
+	void invalidateParameterDependents(QSet<QString> const& parameterIds);
+
 
 	bool isModified() const;
 
@@ -393,6 +444,31 @@ protected:
 	//! Sets the item as modified.
 	void setModified();
 
+	/*!
+	 *  Check if the validity of this item depends only on its parents, siblings and sub items, the items
+	 *  coupled to the local validation scopes and the parameters used in validating it. The validity of other
+	 *  items may depend on this item only, if they are coupled to the local validation scopes.
+	 *
+	 *    @return True, if the item can be revalidated locally, otherwise false.
+	 */
+	virtual bool hasLocalValidationScope() const;
+
+	/*!
+	 *  Check if the validity of this item and the validity of the items in the local validation scopes may
+	 *  depend on each other, e.g. through references by name. The coupling is inherited by the sub items.
+	 *
+	 *    @return True, if the item is coupled to the local validation scopes, otherwise false.
+	 */
+	virtual bool isCoupledToLocalValidationScopes() const;
+
+	/*!
+	 *  Check if the validity of this item depends on the contents of the items in the local validation scopes
+	 *  in addition to their names, e.g. on the bit ranges of the fields. Only applies to coupled items.
+	 *
+	 *    @return True, if any change in the local validation scopes affects this item, otherwise false.
+	 */
+	virtual bool dependsOnLocalValidationScopeContents() const;
+
 	//! Pointer to the instance that manages the library.
 	LibraryInterface* libHandler_ = nullptr;
 
@@ -472,8 +548,55 @@ private:
 	ComponentEditorItem(const ComponentEditorItem& other);
 	ComponentEditorItem& operator=(const ComponentEditorItem& other);
 
+	/*!
+	 *  Mark the cached validity of this item and all its sub items as outdated.
+	 */
+	void invalidateSubItemValidity();
+
+	/*!
+	 *  Mark the cached validity of this item and all its sub items outside of local validation scopes as outdated.
+	 */
+	void invalidateNonLocalItemValidity();
+
+	/*!
+	 *  Invalidate the cached validity of the items depending on this item, excluding the sub items.
+	 *
+	 *    @param [in] nameChanged     Flag for changed names of this item or its sub items.
+	 */
+	void invalidateDependentValidity(bool nameChanged);
+
+	/*!
+	 *  Mark the cached validity of the parents of this item as outdated.
+	 */
+	void invalidateParentValidity();
+
+	/*!
+	 *  Check if this item or any of its parents is coupled to the local validation scopes.
+	 *
+	 *    @return True, if the item is coupled to the local validation scopes, otherwise false.
+	 */
+	bool inheritsLocalValidationScopeCoupling() const;
+
+	//! The cached validity states of an item.
+	enum class ValidityState
+	{
+		UNKNOWN,
+		VALIDATING,
+		VALID,
+		INVALID
+	};
+
 	//! Pointer to the parent item.
 	ComponentEditorItem* parent_ = nullptr;
+
+	//! The cached validity of this item.
+	mutable ValidityState validity_ = ValidityState::UNKNOWN;
+
+	//! The ids of the parameters used when the validity of this item was last calculated.
+	mutable QSet<QString> parameterDependencies_;
+
+	//! The name of the item when its validity was last calculated or invalidated.
+	mutable QString knownName_;
 };
 
 #endif // COMPONENTEDITORITEM_H
@@ -83,7 +83,15 @@ QString ComponentEditorMemMapItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorMemMapItem::isValid() const
 {
-    return memoryMapValidator_->validate(memoryMap_);
+    return memoryMapValidator_->validateShallow(memoryMap_) && ComponentEditorItem::isValid();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditormemmapitem::hasLocalValidationScope()
+//-----------------------------------------------------------------------------
+bool ComponentEditorMemMapItem::hasLocalValidationScope() const
+{
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -175,6 +175,10 @@ signals:
      */
     void memoryRemapNameChanged(QString const& parentName, QString const& oldName, QString const& newName);
 
+protected:
+
+	bool hasLocalValidationScope() const override;
+
 private:
 
 	//! The memory map being edited.
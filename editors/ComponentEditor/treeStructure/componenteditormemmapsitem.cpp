@@ -203,6 +203,14 @@ bool ComponentEditorMemMapsItem::isValid() const
     return ComponentEditorItem::isValid();
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorMemMapsItem::hasLocalValidationScope()
+//-----------------------------------------------------------------------------
+bool ComponentEditorMemMapsItem::hasLocalValidationScope() const
+{
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditormemmapsitem::createMemoryMapValidator()
 //-----------------------------------------------------------------------------
@@ -149,6 +149,10 @@ signals:
      */
     void memoryRemapNameChanged(QString const& parentName, QString const& oldName, QString const& newName);
 
+protected:
+
+    bool hasLocalValidationScope() const override;
+
 private:
 	//! No copying.
 	ComponentEditorMemMapsItem(const ComponentEditorMemMapsItem& other);
@@ -90,7 +90,16 @@ QString ComponentEditorRegisterFileItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorRegisterFileItem::isValid() const
 {
-    return registerFileValidator_->validate(registerFile_, QString::number(addressUnitBits_), containingBlock_->getWidth());
+    return registerFileValidator_->validateShallow(registerFile_, QString::number(addressUnitBits_)) &&
+        ComponentEditorItem::isValid();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterFileItem::hasLocalValidationScope()
+//-----------------------------------------------------------------------------
+bool ComponentEditorRegisterFileItem::hasLocalValidationScope() const
+{
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -112,19 +121,18 @@ void ComponentEditorRegisterFileItem::createChild( int index )
 
         regItem->setLocked(locked_);
 
-        if (visualizer_)
-        {
-            regItem->setVisualizer(visualizer_);
-            createGraphicsItemsForChild(regItem.data());
-            onLayoutRefreshRequested();
-        }
-
+        // The field item is created when the register is expanded.
         if (reg->getFields()->isEmpty())
         {
             QSharedPointer<Field> newField (new Field());
             reg->getFields()->append(newField);
+        }
 
-            regItem->createChild(0);
+        if (visualizer_)
+        {
+            regItem->setVisualizer(visualizer_);
+            createGraphicsItemsForChild(regItem.data());
+            onLayoutRefreshRequested();
         }
         
         connect(regItem.data(), SIGNAL(addressingChanged()),
@@ -299,21 +307,46 @@ void ComponentEditorRegisterFileItem::onChildGraphicsChanged(int index)
 // Function: ComponentEditorRegisterFileItem::createGraphicsItems()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterFileItem::createGraphicsItems(QGraphicsItem* parentItem)
+{
+    adoptGraphicsItems(createRegisterFileGraphItems(registerFile_, expressionParser_, parentItem));
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterFileItem::adoptGraphicsItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterFileItem::adoptGraphicsItems(QList<MemoryVisualizationItem*> const& registerFileItems)
+{
+    for (auto const& registerFileItem : registerFileItems)
+    {
+        // The child registers are always created with the register file item.
+        registerFileItem->setChildrenPending(false);
+
+        graphItems_.insert(registerFileItem->parentItem(), registerFileItem);
+        connect(registerFileItem, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterFileItem::createRegisterFileGraphItems()
+//-----------------------------------------------------------------------------
+QList<MemoryVisualizationItem*> ComponentEditorRegisterFileItem::createRegisterFileGraphItems(
+    QSharedPointer<RegisterFile> registerFile, QSharedPointer<ExpressionParser> expressionParser,
+    QGraphicsItem* parentItem)
 {
     auto memoryParent = static_cast<MemoryVisualizationItem*>(parentItem);
     Q_ASSERT(memoryParent);
 
     auto parentOffset = memoryParent->getOffset();
 
-    auto registerFileOffset = expressionParser_->parseExpression(registerFile_->getAddressOffset()).toULongLong();
+    auto registerFileOffset = expressionParser->parseExpression(registerFile->getAddressOffset()).toULongLong();
 
-    bool hasDim = registerFile_->getDimension().isEmpty() == false;
-    auto regDim = expressionParser_->parseExpression(registerFile_->getDimension()).toULongLong();
+    bool hasDim = registerFile->getDimension().isEmpty() == false;
+    auto regDim = expressionParser->parseExpression(registerFile->getDimension()).toULongLong();
 
-    bool hasStride = registerFile_->getStride().isEmpty() == false;
-    auto registerFileStride = expressionParser_->parseExpression(registerFile_->getStride()).toULongLong();
+    bool hasStride = registerFile->getStride().isEmpty() == false;
+    auto registerFileStride = expressionParser->parseExpression(registerFile->getStride()).toULongLong();
 
-    auto registerFileRange = expressionParser_->parseExpression(registerFile_->getRange()).toULongLong();
+    auto registerFileRange = expressionParser->parseExpression(registerFile->getRange()).toULongLong();
     auto minimumStride = registerFileRange;
 
     if (!hasDim || regDim == 0)
@@ -321,6 +354,8 @@ void ComponentEditorRegisterFileItem::createGraphicsItems(QGraphicsItem* parentI
         regDim = 1;
     }
 
+    QList<MemoryVisualizationItem*> registerFileItems;
+
     // Create register replicas
     for (quint64 i = 0; i < regDim; ++i)
     {
@@ -340,7 +375,7 @@ void ComponentEditorRegisterFileItem::createGraphicsItems(QGraphicsItem* parentI
         // Total offset is register offset + parent offset (address block/register file)
         realOffset += parentOffset;
 
-        auto newItem = new RegisterFileGraphItem(registerFile_, expressionParser_, parentItem);
+        auto newItem = new RegisterFileGraphItem(registerFile, expressionParser, parentItem);
         newItem->setOffset(realOffset);
 
         // Mark fields with index per replica for identification
@@ -349,10 +384,11 @@ void ComponentEditorRegisterFileItem::createGraphicsItems(QGraphicsItem* parentI
             newItem->setReplicaIndex(i);
         }
 
-        graphItems_.insert(parentItem, newItem);
         newItem->updateDisplay();
-        connect(newItem, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+        registerFileItems.append(newItem);
     }
+
+    return registerFileItems;
 }
 
 //-----------------------------------------------------------------------------
@@ -360,10 +396,21 @@ void ComponentEditorRegisterFileItem::createGraphicsItems(QGraphicsItem* parentI
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterFileItem::createGraphicsItemsForChildren()
 {
+    // Lay out each graphics item only once after all the children have been added to it.
+    for (auto const& graphItem : graphItems_)
+    {
+        static_cast<RegisterFileGraphItem*>(graphItem)->beginChildUpdate();
+    }
+
     for (auto const& childEditor : childItems_)
     {
         createGraphicsItemsForChild(childEditor.data());
     }
+
+    for (auto const& graphItem : graphItems_)
+    {
+        static_cast<RegisterFileGraphItem*>(graphItem)->endChildUpdate();
+    }
 }
 
 //-----------------------------------------------------------------------------
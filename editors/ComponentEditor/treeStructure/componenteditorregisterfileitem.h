@@ -23,6 +23,7 @@ class RegisterFileGraphItem;
 class RegisterFileValidator;
 class RegisterInterface;
 class AddressBlock;
+class ExpressionParser;
 
 //-----------------------------------------------------------------------------
 //! Item representing a register file in the component editor browser tree.
@@ -117,6 +118,25 @@ public:
      */
     void createGraphicsItems(QGraphicsItem* parentItem);
 
+    /*!
+     *	Take the given register file graph items as the graph items of this item.
+     *
+     *    @param [in] registerFileItems  The register file graph items, already added to their parent items.
+     */
+    void adoptGraphicsItems(QList<MemoryVisualizationItem*> const& registerFileItems);
+
+    /*!
+     *	Create graph items for the given register file, one for each replica in case of dimensions.
+     *
+     *    @param [in] registerFile        The register file to create the items for.
+     *    @param [in] expressionParser    The expression parser to use.
+     *    @param [in] parentItem          The parent item for created item(s).
+     *
+     *    @return The created register file graph items.
+     */
+    static QList<MemoryVisualizationItem*> createRegisterFileGraphItems(QSharedPointer<RegisterFile> registerFile,
+        QSharedPointer<ExpressionParser> expressionParser, QGraphicsItem* parentItem);
+
     /*!
      *	Create graph items for all child items.
      */
@@ -187,6 +207,10 @@ protected slots:
 
     void onChildGraphicsChanged(int index);
 
+protected:
+
+    bool hasLocalValidationScope() const override;
+
 private:
     
     /*!
@@ -11,6 +11,7 @@
 
 #include "componenteditorregisteritem.h"
 #include "componenteditorfielditem.h"
+#include "componenteditortreemodel.h"
 
 #include <KactusAPI/include/ExpressionParser.h>
 
@@ -57,13 +58,7 @@ containingRegisterData_(containingRegisterData)
 
 	setObjectName(tr("ComponentEditorRegisterItem"));
 
-    const int fieldCount = reg_->getFields()->count();
-
-	for (int i = 0; i < fieldCount; ++i)
-    {
-        createChild(i);
-    }
-
+    // The field items are created when the register is expanded, see fetchChildren().
 }
 
 //-----------------------------------------------------------------------------
@@ -87,7 +82,21 @@ QString ComponentEditorRegisterItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorRegisterItem::isValid() const
 {
-    return registerValidator_->validate(reg_);
+    // Fields not fetched yet have no cached validity.
+    if (canFetchChildren())
+    {
+        return registerValidator_->validate(reg_);
+    }
+
+    return registerValidator_->validateShallow(reg_) && ComponentEditorItem::isValid();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::hasLocalValidationScope()
+//-----------------------------------------------------------------------------
+bool ComponentEditorRegisterItem::hasLocalValidationScope() const
+{
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -167,6 +176,59 @@ void ComponentEditorRegisterItem::removeChild(int index)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::canFetchChildren()
+//-----------------------------------------------------------------------------
+bool ComponentEditorRegisterItem::canFetchChildren() const
+{
+    return fieldsFetched_ == false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::getUnfetchedChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorRegisterItem::getUnfetchedChildCount() const
+{
+    if (fieldsFetched_)
+    {
+        return 0;
+    }
+
+    return reg_->getFields()->count();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::fetchChildren()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterItem::fetchChildren()
+{
+    if (fieldsFetched_)
+    {
+        return;
+    }
+
+    fieldsFetched_ = true;
+
+    // Lay out each register graph item only once after all the fields have been added to it.
+    for (auto const& graphItem : graphItems_)
+    {
+        auto registerItem = static_cast<RegisterGraphItem*>(graphItem);
+        registerItem->setChildrenPending(false);
+        registerItem->beginChildUpdate();
+    }
+
+    const int fieldCount = reg_->getFields()->count();
+    for (int i = 0; i < fieldCount; ++i)
+    {
+        createChild(i);
+    }
+
+    for (auto const& graphItem : graphItems_)
+    {
+        static_cast<RegisterGraphItem*>(graphItem)->endChildUpdate();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditorregisteritem::visualizer()
 //-----------------------------------------------------------------------------
@@ -219,7 +281,20 @@ void ComponentEditorRegisterItem::onGraphicsChanged()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterItem::onChildGraphicsChanged(int index)
 {
-    childItems_.at(index)->updateGraphics();
+    // Fields without items have no graphics to update.
+    if (fieldsFetched_)
+    {
+        childItems_.at(index)->updateGraphics();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterItem::onChildrenRequested()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterItem::onChildrenRequested()
+{
+    // Fetch through the model, so that the navigation tree is informed of the new rows.
+    model_->fetchMore(model_->index(this));
 }
 
 //-----------------------------------------------------------------------------
@@ -250,6 +325,29 @@ void ComponentEditorRegisterItem::createGraphicsItemsForChild(ComponentEditorIte
 // Function: ComponentEditorRegisterItem::createGraphicsItems()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterItem::createGraphicsItems(QGraphicsItem* parentItem)
+{
+    adoptGraphicsItems(createRegisterGraphItems(reg_, expressionParser_, parentItem));
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterItem::adoptGraphicsItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterItem::adoptGraphicsItems(QList<MemoryVisualizationItem*> const& registerItems)
+{
+    for (auto const& registerItem : registerItems)
+    {
+        graphItems_.insert(registerItem->parentItem(), registerItem);
+        registerItem->setChildrenPending(fieldsFetched_ == false && reg_->getFields()->isEmpty() == false);
+        connect(registerItem, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+        connect(registerItem, SIGNAL(childrenRequested()), this, SLOT(onChildrenRequested()), Qt::UniqueConnection);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterItem::createRegisterGraphItems()
+//-----------------------------------------------------------------------------
+QList<MemoryVisualizationItem*> ComponentEditorRegisterItem::createRegisterGraphItems(QSharedPointer<Register> reg,
+    QSharedPointer<ExpressionParser> expressionParser, QGraphicsItem* parentItem)
 {
     auto memoryParent = static_cast<MemoryVisualizationItem*>(parentItem);
     Q_ASSERT(memoryParent);
@@ -262,17 +360,17 @@ void ComponentEditorRegisterItem::createGraphicsItems(QGraphicsItem* parentItem)
 
     auto parentOffset = memoryParent->getOffset();
 
-    auto registerOffset = expressionParser_->parseExpression(reg_->getAddressOffset()).toULongLong();
+    auto registerOffset = expressionParser->parseExpression(reg->getAddressOffset()).toULongLong();
 
-    bool hasDim = reg_->getDimension().isEmpty() == false;
-    auto regDim = expressionParser_->parseExpression(reg_->getDimension()).toULongLong();
+    bool hasDim = reg->getDimension().isEmpty() == false;
+    auto regDim = expressionParser->parseExpression(reg->getDimension()).toULongLong();
 
-    bool hasStride = reg_->getStride().isEmpty() == false;
-    auto regStride = expressionParser_->parseExpression(reg_->getStride()).toULongLong();
+    bool hasStride = reg->getStride().isEmpty() == false;
+    auto regStride = expressionParser->parseExpression(reg->getStride()).toULongLong();
 
     // Address unit size needed for calculating minimum stride
     // Minimum stride is the size of the register in AUB (reg size is given in bits)
-    auto regSize = expressionParser_->parseExpression(reg_->getSize()).toULongLong();
+    auto regSize = expressionParser->parseExpression(reg->getSize()).toULongLong();
     auto minimumStride = regSize % addressUnitSize ? regSize / addressUnitSize + 1 : regSize / addressUnitSize;
 
     if (!hasDim || regDim == 0)
@@ -280,6 +378,8 @@ void ComponentEditorRegisterItem::createGraphicsItems(QGraphicsItem* parentItem)
         regDim = 1;
     }
 
+    QList<MemoryVisualizationItem*> registerItems;
+
     // Create register replicas
     for (quint64 i = 0; i < regDim; ++i)
     {
@@ -299,7 +399,7 @@ void ComponentEditorRegisterItem::createGraphicsItems(QGraphicsItem* parentItem)
         // Total offset is register offset + parent offset (address block/register file)
         realOffset += parentOffset;
 
-        auto newItem = new RegisterGraphItem(reg_, expressionParser_, parentItem);
+        auto newItem = new RegisterGraphItem(reg, expressionParser, parentItem);
         newItem->setOffset(realOffset);
 
         // Mark fields with index per replica for identification
@@ -308,10 +408,11 @@ void ComponentEditorRegisterItem::createGraphicsItems(QGraphicsItem* parentItem)
             newItem->setReplicaIndex(i);
         }
 
-        graphItems_.insert(parentItem, newItem);
         newItem->updateDisplay();
-        connect(newItem, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+        registerItems.append(newItem);
     }
+
+    return registerItems;
 }
 
 //-----------------------------------------------------------------------------
@@ -319,10 +420,21 @@ void ComponentEditorRegisterItem::createGraphicsItems(QGraphicsItem* parentItem)
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterItem::createGraphicsItemsForChildren()
 {
+    // Lay out each graphics item only once after all the children have been added to it.
+    for (auto const& graphItem : graphItems_)
+    {
+        static_cast<RegisterGraphItem*>(graphItem)->beginChildUpdate();
+    }
+
     for (auto const& childEditor : childItems_)
     {
         createGraphicsItemsForChild(childEditor.data());
     }
+
+    for (auto const& graphItem : graphItems_)
+    {
+        static_cast<RegisterGraphItem*>(graphItem)->endChildUpdate();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -358,6 +470,10 @@ void ComponentEditorRegisterItem::onChildAddressingChanged()
 void ComponentEditorRegisterItem::onChildAddressingChangedLocally(int childIndex)
 {
     // Signal from fields table editor (RegisterEditor) is handled here.
+    if (fieldsFetched_ == false)
+    {
+        return;
+    }
 
     Q_ASSERT(childIndex < childItems_.size());
     auto targetItem = childItems_.at(childIndex).dynamicCast<ComponentEditorFieldItem>();
@@ -116,6 +116,21 @@ public:
      */
     virtual void removeChild(int index) override final;
 
+	/*! Check if the field items have not been created yet.
+	 *
+	 *    @return True, if the field items should be fetched before accessing them.
+	 */
+	bool canFetchChildren() const override final;
+
+	/*! Get the number of field items that have not been created yet.
+	 *
+	 *    @return The number of field items created by fetchChildren().
+	 */
+	int getUnfetchedChildCount() const override final;
+
+	//! Creates the field items when the register is expanded for the first time.
+	void fetchChildren() override final;
+
 	/*! Get pointer to the visualizer of this item.
 	 * 
 	 *    @return Pointer to the visualizer to use for this item.
@@ -143,6 +158,25 @@ public:
 	 */
 	void createGraphicsItems(QGraphicsItem* parentItem);
 
+	/*!
+	 *	Take the given register graph items as the graph items of this item.
+	 *
+	 *    @param [in] registerItems  The register graph items, already added to their parent items.
+	 */
+	void adoptGraphicsItems(QList<MemoryVisualizationItem*> const& registerItems);
+
+	/*!
+	 *	Create graph items for the given register, one for each replica in case of dimensions.
+	 *
+	 *    @param [in] reg                 The register to create the items for.
+	 *    @param [in] expressionParser    The expression parser to use.
+	 *    @param [in] parentItem          The parent item for created item(s).
+	 *
+	 *    @return The created register graph items.
+	 */
+	static QList<MemoryVisualizationItem*> createRegisterGraphItems(QSharedPointer<Register> reg,
+        QSharedPointer<ExpressionParser> expressionParser, QGraphicsItem* parentItem);
+
 	/*!
 	 *	Create graph items for all child items.
 	 */
@@ -197,6 +231,13 @@ protected slots:
     //! Handle the change in child item's graphics.
     void onChildGraphicsChanged(int index);
 
+    //! Handle the request for the field items from an expanded register graph item.
+    void onChildrenRequested();
+
+protected:
+
+	bool hasLocalValidationScope() const override;
+
 private:
 
 	/*!
@@ -227,6 +268,9 @@ private:
 
     //! Register data containing the edited register.
     QSharedPointer<QList<QSharedPointer<RegisterBase> > > containingRegisterData_;
+
+    //! Flag for field items already created.
+    bool fieldsFetched_ = false;
 };
 
 #endif // COMPONENTEDITORREGISTERITEM_H
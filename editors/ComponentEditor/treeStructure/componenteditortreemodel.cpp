@@ -14,6 +14,7 @@
 #include <IPXACTmodels/Component/Component.h>
 
 #include <KactusAPI/include/KactusColors.h>
+#include <KactusAPI/include/RecordingParameterFinder.h>
 
 #include <QIcon>
 
@@ -42,6 +43,41 @@ void ComponentEditorTreeModel::setRootItem(QSharedPointer<ComponentEditorRootIte
 	beginResetModel();
     rootItem_ = root;
 	endResetModel();
+
+	parameterValues_ = getParameterValues();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::setParameterFinder()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::setParameterFinder(QSharedPointer<RecordingParameterFinder> finder)
+{
+	parameterFinder_ = finder;
+	parameterValues_ = getParameterValues();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::beginValidation()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::beginValidation() const
+{
+	if (parameterFinder_)
+	{
+		parameterFinder_->beginRecording();
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::endValidation()
+//-----------------------------------------------------------------------------
+QSet<QString> ComponentEditorTreeModel::endValidation() const
+{
+	if (parameterFinder_)
+	{
+		return parameterFinder_->endRecording();
+	}
+
+	return QSet<QString>();
 }
 
 //-----------------------------------------------------------------------------
@@ -92,6 +128,44 @@ bool ComponentEditorTreeModel::hasChildren( const QModelIndex& parent /*= QModel
 	return parentItem->hasChildren();
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::canFetchMore()
+//-----------------------------------------------------------------------------
+bool ComponentEditorTreeModel::canFetchMore(const QModelIndex& parent) const
+{
+	if (parent.column() > 0)
+	{
+		return false;
+	}
+
+	return getItem(parent)->canFetchChildren();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::fetchMore()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::fetchMore(const QModelIndex& parent)
+{
+	ComponentEditorItem* parentItem = getItem(parent);
+	if (parentItem->canFetchChildren() == false)
+	{
+		return;
+	}
+
+	int fetchedCount = parentItem->getUnfetchedChildCount();
+	if (fetchedCount == 0)
+	{
+		parentItem->fetchChildren();
+		return;
+	}
+
+	int firstRow = parentItem->rowCount();
+
+	beginInsertRows(parent, firstRow, firstRow + fetchedCount - 1);
+	parentItem->fetchChildren();
+	endInsertRows();
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditortreemodel::columnCount()
 //-----------------------------------------------------------------------------
@@ -131,7 +205,7 @@ QVariant ComponentEditorTreeModel::data( const QModelIndex& index, int role /*=
 	}
 	else if (role == Qt::ForegroundRole)
     {
-        if (item->parent() != rootItem_ && !item->isValid())
+        if (item->parent() != rootItem_ && !item->getCachedValidity())
         {
             return KactusColors::ERROR_COLOR;
         }
@@ -155,7 +229,7 @@ QVariant ComponentEditorTreeModel::data( const QModelIndex& index, int role /*=
     }
 	else if (role == Qt::DecorationRole)
 	{
-		if (item->parent() == rootItem_ && item->isValid() == false)
+		if (item->parent() == rootItem_ && item->getCachedValidity() == false)
 		{
 			return QIcon(":icons/common/graphics/exclamation--frame.png");
 		}
@@ -190,6 +264,9 @@ Qt::ItemFlags ComponentEditorTreeModel::flags( const QModelIndex& index ) const
 //-----------------------------------------------------------------------------
 void ComponentEditorTreeModel::onContentChanged(ComponentEditorItem* item )
 {
+	item->invalidateValidity();
+	invalidateChangedParameterDependents();
+
 	QModelIndex index = ComponentEditorTreeModel::index(item);
 	emit dataChanged(index, index);
 }
@@ -301,14 +378,27 @@ void ComponentEditorTreeModel::addItem( ComponentEditorItem* parentItem, int chi
 	Q_ASSERT(parentItem);
 	Q_ASSERT(childIndex >= 0);
 
+	// Children not fetched yet are created from the current data when fetched. Fetching here would create
+	// the children of several rows added at once, before the rest of the rows are reported.
+	bool childrenFetched = parentItem->canFetchChildren() == false;
+
 	// find the index of the parent item
 	QModelIndex parentIndex = index(parentItem);
 
-	beginInsertRows(parentIndex, childIndex, childIndex);
-	parentItem->createChild(childIndex);
-	endInsertRows();
+	if (childrenFetched)
+	{
+		beginInsertRows(parentIndex, childIndex, childIndex);
+		parentItem->createChild(childIndex);
+		endInsertRows();
+	}
+
+	parentItem->invalidateChildValidity();
+	invalidateChangedParameterDependents();
 
-	emit expandItem(parentIndex);
+	if (childrenFetched)
+	{
+		emit expandItem(parentIndex);
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -319,12 +409,19 @@ void ComponentEditorTreeModel::removeItem( ComponentEditorItem* parentItem, int
 	Q_ASSERT(parentItem);
 	Q_ASSERT(childIndex >= 0);
 
-	// find the index of the parent item
-	QModelIndex parentIndex = index(parentItem);
+	// Children not fetched yet do not need to be removed.
+	if (parentItem->canFetchChildren() == false)
+	{
+		// find the index of the parent item
+		QModelIndex parentIndex = index(parentItem);
 
-	beginRemoveRows(parentIndex, childIndex, childIndex);
-	parentItem->removeChild(childIndex);
-	endRemoveRows();
+		beginRemoveRows(parentIndex, childIndex, childIndex);
+		parentItem->removeChild(childIndex);
+		endRemoveRows();
+	}
+
+	parentItem->invalidateChildValidity();
+	invalidateChangedParameterDependents();
 }
 
 //-----------------------------------------------------------------------------
@@ -337,7 +434,7 @@ void ComponentEditorTreeModel::moveItem( ComponentEditorItem* parentItem, int ch
 	Q_ASSERT(childtarget >= 0);
 
 	// if the location of the item does not change
-	if (childSource == childtarget)
+	if (childSource == childtarget || parentItem->canFetchChildren())
     {
 		return;
 	}
@@ -359,6 +456,8 @@ void ComponentEditorTreeModel::moveItem( ComponentEditorItem* parentItem, int ch
 	beginMoveRows(parentIndex, childSource, childSource, parentIndex, childtarget);
 	parentItem->moveChild(childSource, targetIndex);
 	endMoveRows();
+
+	parentItem->invalidateChildValidity();
 }
 
 //-----------------------------------------------------------------------------
@@ -389,7 +488,7 @@ void ComponentEditorTreeModel::onSelectItem( ComponentEditorItem* item )
 //-----------------------------------------------------------------------------
 // Function: componenteditortreemodel::getIndexOfItem()
 //-----------------------------------------------------------------------------
-QModelIndex ComponentEditorTreeModel::getIndexOfItem(QVector<QString> itemIdentifierChain) const
+QModelIndex ComponentEditorTreeModel::getIndexOfItem(QVector<QString> itemIdentifierChain)
 {
     QModelIndex itemIndex;
 
@@ -413,8 +512,12 @@ void ComponentEditorTreeModel::clearItemsModified() const
 // Function: componenteditortreemodel::findIndexByItemIdentifier()
 //-----------------------------------------------------------------------------
 QModelIndex ComponentEditorTreeModel::findIndexByItemIdentifier(QString const& identifier, QModelIndex parentIndex)
-    const
 {
+    if (canFetchMore(parentIndex))
+    {
+        fetchMore(parentIndex);
+    }
+
     int numberOfRows = rowCount(parentIndex);
     int columnNumber = 0;
 
@@ -433,3 +536,68 @@ QModelIndex ComponentEditorTreeModel::findIndexByItemIdentifier(QString const& i
 
     return parentIndex;
 }
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::getItem()
+//-----------------------------------------------------------------------------
+ComponentEditorItem* ComponentEditorTreeModel::getItem(QModelIndex const& index) const
+{
+	// if the given item is invalid, it is interpreted as root item
+	if (!index.isValid())
+	{
+		return rootItem_.data();
+	}
+
+	return static_cast<ComponentEditorItem*>(index.internalPointer());
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::invalidateChangedParameterDependents()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::invalidateChangedParameterDependents()
+{
+	QHash<QString, QString> currentValues = getParameterValues();
+
+	QSet<QString> changedIds;
+	for (auto parameter = currentValues.cbegin(); parameter != currentValues.cend(); ++parameter)
+	{
+		auto previous = parameterValues_.constFind(parameter.key());
+		if (previous == parameterValues_.cend() || previous.value() != parameter.value())
+		{
+			changedIds.insert(parameter.key());
+		}
+	}
+
+	for (auto parameter = parameterValues_.cbegin(); parameter != parameterValues_.cend(); ++parameter)
+	{
+		if (currentValues.contains(parameter.key()) == false)
+		{
+			changedIds.insert(parameter.key());
+		}
+	}
+
+	parameterValues_.swap(currentValues);
+
+	if (changedIds.isEmpty() == false && rootItem_)
+	{
+		rootItem_->invalidateParameterDependents(changedIds);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::getParameterValues()
+//-----------------------------------------------------------------------------
+QHash<QString, QString> ComponentEditorTreeModel::getParameterValues() const
+{
+	QHash<QString, QString> values;
+
+	if (parameterFinder_)
+	{
+		for (QString const& id : parameterFinder_->getAllParameterIds())
+		{
+			values.insert(id, parameterFinder_->valueForId(id));
+		}
+	}
+
+	return values;
+}
@@ -15,10 +15,13 @@
 #include "componenteditorrootitem.h"
 
 #include <QAbstractItemModel>
+#include <QHash>
+#include <QSet>
 #include <QWidget>
 #include <QSharedPointer>
 
 class LibraryInterface;
+class RecordingParameterFinder;
 class PluginManager;
 class Component;
 class VLNV;
@@ -50,6 +53,26 @@ public:
 	 */
 	void setRootItem(QSharedPointer<ComponentEditorRootItem> root);
 
+	/*!
+	 *  Set the parameter finder used in validating the items. The parameters used in validating an item are
+	 *  recorded, so that the item is revalidated only when those parameters change.
+	 *
+	 *    @param [in] finder  The parameter finder used by the expression parser of the items.
+	 */
+	void setParameterFinder(QSharedPointer<RecordingParameterFinder> finder);
+
+	/*!
+	 *  Start recording the parameters used in validating an item.
+	 */
+	void beginValidation() const;
+
+	/*!
+	 *  End recording the parameters used in validating an item.
+	 *
+	 *    @return The ids of the parameters used in validating the item.
+	 */
+	QSet<QString> endValidation() const;
+
 	/*!
 	 *  Get the number of rows an item contains.
 	 *
@@ -68,6 +91,22 @@ public:
 	 */
 	virtual bool hasChildren(const QModelIndex& parent = QModelIndex()) const;
 
+	/*!
+	 *  Checks if the child items of the given item have not been created yet.
+	 *
+	 *    @param [in] parent  Model index of the item.
+	 *
+	 *    @return True, if the child items can be fetched.
+	 */
+	virtual bool canFetchMore(const QModelIndex& parent) const;
+
+	/*!
+	 *  Creates the child items of the given item.
+	 *
+	 *    @param [in] parent  Model index of the item.
+	 */
+	virtual void fetchMore(const QModelIndex& parent);
+
 	/*!
 	 *  Get the number of columns the item has to be displayed.
 	 *
@@ -132,14 +171,15 @@ public:
 	 *
 	 *    @return The model index of the selected item.
 	 */
-	QModelIndex getIndexOfItem(QVector<QString> itemIdentifierChain) const;
+	QModelIndex getIndexOfItem(QVector<QString> itemIdentifierChain);
 
 	void clearItemsModified() const;
 
 public slots:
 
 	/*!
-	 *  Handler for component editor item's content changed signal.
+	 *  Handler for component editor item's content changed signal. Invalidates the cached validity of the
+	 *  items affected by the change.
 	 *
 	 *    @param [in] item    Pointer to the item that changed.
 	 */
@@ -250,8 +290,28 @@ private:
 	 *
 	 *    @return The model index of the selected item.
 	 */
-	QModelIndex findIndexByItemIdentifier(QString const& identifier, QModelIndex parentIndex = QModelIndex())
-		const;
+	QModelIndex findIndexByItemIdentifier(QString const& identifier, QModelIndex parentIndex = QModelIndex());
+
+	/*!
+	 *  Get the item identified by the given model index.
+	 *
+	 *    @param [in] index   The model index of the item. Invalid index is interpreted as the root item.
+	 *
+	 *    @return The identified item.
+	 */
+	ComponentEditorItem* getItem(QModelIndex const& index) const;
+
+	/*!
+	 *  Invalidate the cached validity of the items depending on the parameters changed since the last call.
+	 */
+	void invalidateChangedParameterDependents();
+
+	/*!
+	 *  Get the current values of the parameters.
+	 *
+	 *    @return The parameter values by parameter id.
+	 */
+	QHash<QString, QString> getParameterValues() const;
 
 	//-----------------------------------------------------------------------------
 	// Data.
@@ -259,6 +319,12 @@ private:
 
 	//! Pointer to the root item of the tree.
 	QSharedPointer<ComponentEditorRootItem> rootItem_ = nullptr;
+
+	//! The parameter finder recording the parameters used in validating the items.
+	QSharedPointer<RecordingParameterFinder> parameterFinder_ = nullptr;
+
+	//! The parameter values when the validity of the items was last invalidated, by parameter id.
+	QHash<QString, QString> parameterValues_;
 };
 
 #endif // COMPONENTEDITORTREEMODEL_H
@@ -30,6 +30,8 @@ ExpandableItem(parent),
     QPen pen(KactusColors::MEM_GRAPH_ITEM_BORDER);
     setPen(pen);
     setExpansionPen(pen);
+
+    connect(this, SIGNAL(expandStateChanged()), this, SLOT(requestPendingChildren()), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -70,10 +72,18 @@ void MemoryVisualizationItem::addChild(MemoryVisualizationItem* childItem)
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::removeChild(MemoryVisualizationItem* childItem)
 {
-    quint64 offset = childItems_.key(childItem);
+    // The child is usually still stored with its current offset, which avoids a linear search.
+    if (auto stored = childItems_.find(childItem->getOffset(), childItem); stored != childItems_.end())
+    {
+        childItems_.erase(stored);
+    }
+    else
+    {
+        quint64 offset = childItems_.key(childItem);
 
-    Q_ASSERT(childItems_.contains(offset));
-    childItems_.remove(offset, childItem);
+        Q_ASSERT(childItems_.contains(offset));
+        childItems_.remove(offset, childItem);
+    }
 
     disconnect(childItem, SIGNAL(expandStateChanged()), this, SLOT(repositionChildren()));
     disconnect(childItem, SIGNAL(expandStateChanged()), this, SIGNAL(expandStateChanged()));
@@ -89,6 +99,15 @@ int MemoryVisualizationItem::getChildCount() const
     return childItems_.count();
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::setChildrenPending()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::setChildrenPending(bool pending)
+{
+    childrenPending_ = pending;
+    showExpandIconIfHasChildren();
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryVisualizationItem::setWidth()
 //-----------------------------------------------------------------------------
@@ -122,6 +141,12 @@ QRectF MemoryVisualizationItem::boundingRect() const
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::redoChildLayout()
 {    
+    if (childUpdateDepth_ > 0)
+    {
+        childLayoutPending_ = true;
+        return;
+    }
+
     updateChildMap();
 
     repositionChildren();
@@ -129,6 +154,29 @@ void MemoryVisualizationItem::redoChildLayout()
     showExpandIconIfHasChildren();
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::beginChildUpdate()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::beginChildUpdate()
+{
+    ++childUpdateDepth_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::endChildUpdate()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::endChildUpdate()
+{
+    Q_ASSERT(childUpdateDepth_ > 0);
+    --childUpdateDepth_;
+
+    if (childUpdateDepth_ == 0 && childLayoutPending_)
+    {
+        childLayoutPending_ = false;
+        redoChildLayout();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: memoryvisualizationitem::parseExpression()
 //-----------------------------------------------------------------------------
@@ -150,7 +198,7 @@ QSharedPointer<ExpressionParser> MemoryVisualizationItem::getExpressionParser()
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::showExpandIconIfHasChildren()
 {    
-    ExpandableItem::setShowExpandableItem(childItems_.isEmpty() == false);
+    ExpandableItem::setShowExpandableItem(childItems_.isEmpty() == false || childrenPending_);
 }
 
 //-----------------------------------------------------------------------------
@@ -214,7 +262,7 @@ void MemoryVisualizationItem::fillGapsBetweenChildren()
     {
         if (auto current = i.value(); current->isPresent())
         {
-            if (quint64 currentOffset = childItems_.key(current); 
+            if (quint64 currentOffset = i.key(); 
                 lastAddressInUse == 0 && currentOffset > 0 && i == childItems_.begin())
             {
                 i = createMemoryGap(0, currentOffset - 1);
@@ -241,39 +289,70 @@ void MemoryVisualizationItem::fillGapsBetweenChildren()
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::markConflictingChildren()
 {
-    for (auto child = childItems_.begin(); child != childItems_.end(); ++child)
-    {
-        markChildIfConflicting(child.value());
-    }
+    markOverlappingChildren(getOffset(), getLastAddress());
 }
 
 //-----------------------------------------------------------------------------
-// Function: MemoryVisualizationItem::markChildIfConflicting()
+// Function: MemoryVisualizationItem::markOverlappingChildren()
 //-----------------------------------------------------------------------------
-void MemoryVisualizationItem::markChildIfConflicting(MemoryVisualizationItem* child)
+void MemoryVisualizationItem::markOverlappingChildren(quint64 firstAddress, quint64 lastAddress)
 {
-    if (!child || !child->isPresent())
+    // Preceding children not yet marked conflicted, keyed by their last address.
+    QMultiMap<quint64, MemoryVisualizationItem*> unmarkedChildren;
+
+    bool hasPrecedingChild = false;
+    quint64 lastAddressInUse = 0;
+
+    for (auto child : childItems_)
     {
-        return;
-    }
+        if (child->isPresent() == false)
+        {
+            continue;
+        }
 
-    auto parentOffset = getOffset();
-    auto lastAddress = getLastAddress();
+        quint64 childOffset = child->getOffset();
+        quint64 childLastAddress = child->getLastAddress();
 
-    auto const& currentChildOffset = child->getOffset();
+        // Children ending before the current one cannot overlap it or any of the children after it.
+        while (unmarkedChildren.isEmpty() == false && unmarkedChildren.firstKey() < childOffset)
+        {
+            unmarkedChildren.erase(unmarkedChildren.begin());
+        }
 
-    bool isOutsideBounds = currentChildOffset < parentOffset || child->getLastAddress() > lastAddress;
+        bool overlapsPreceding = hasPrecedingChild && lastAddressInUse >= childOffset;
+        child->setConflicted(overlapsPreceding || childOffset < firstAddress || childLastAddress > lastAddress);
 
-    child->setConflicted(isOutsideBounds);
+        if (overlapsPreceding)
+        {
+            for (auto precedingChild : unmarkedChildren)
+            {
+                precedingChild->setConflicted(true);
+            }
 
-    // Check overlap with preceding children. Mark any overlapping items conflicted.
-    for (auto precedingChild = childItems_.begin(); precedingChild.value() != child; ++precedingChild)
-    {
-        if ((*precedingChild)->getLastAddress() >= currentChildOffset)
+            unmarkedChildren.clear();
+        }
+        else
         {
-            (*precedingChild)->setConflicted(true);
-            child->setConflicted(true);
+            unmarkedChildren.insert(childLastAddress, child);
         }
+
+        lastAddressInUse = hasPrecedingChild ? qMax(lastAddressInUse, childLastAddress) : childLastAddress;
+        hasPrecedingChild = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::requestPendingChildren()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::requestPendingChildren()
+{
+    if (childrenPending_ && isExpanded())
+    {
+        childrenPending_ = false;
+
+        // The children are created immediately, after which the expansion is redone to show them.
+        emit childrenRequested();
+        onExpandStateChange(true);
     }
 }
 
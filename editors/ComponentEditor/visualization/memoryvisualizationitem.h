@@ -87,6 +87,16 @@ public:
     //! Re-layouts the child items.
     virtual void redoChildLayout();
 
+    /*!
+     *  Starts a batch of child updates. The child layout is not redone until the matching endChildUpdate().
+     */
+    void beginChildUpdate();
+
+    /*!
+     *  Ends a batch of child updates and redoes the child layout once, if it was requested during the batch.
+     */
+    void endChildUpdate();
+
 	/*!
      *  Add a child visualization item for this item.
 	 *
@@ -103,6 +113,13 @@ public:
 
     int getChildCount() const;
 
+    /*!
+     *  Sets the item to have child items that are created only when the item is expanded for the first time.
+     *
+     *    @param [in] pending     True, if the item has child items not created yet.
+     */
+    void setChildrenPending(bool pending);
+
     /*!
      *  Set the width for the item.
 	 *
@@ -123,6 +140,9 @@ signals:
 	//! Emitted when this item's editor should be displayed.
 	void selectEditor();
 
+    //! Emitted when the item is expanded and its pending child items should be created.
+    void childrenRequested();
+
 protected slots:
 
     
@@ -164,6 +184,16 @@ protected:
     //! Mark all invalid children outside item boundaries.
     virtual void markConflictingChildren();
 
+    /*!
+     *  Marks the present children overlapping each other or the given address range conflicted.
+     *
+     *  The children are swept once in offset order, so the marking takes O(n log n) time.
+     *
+     *    @param [in] firstAddress    The first address available for the children.
+     *    @param [in] lastAddress     The last address available for the children.
+     */
+    void markOverlappingChildren(quint64 firstAddress, quint64 lastAddress);
+
 	//! Handler for mouse press events
 	virtual void mousePressEvent(QGraphicsSceneMouseEvent* event);
 
@@ -190,16 +220,12 @@ protected:
 	//! Contains the child memory items. The offset of the child is the key.
 	QMultiMap<quint64, MemoryVisualizationItem*> childItems_;
 
-private:
-    
+private slots:
 
-    /*!
-     *	Mark child and its preceding children conflicting, if overlapping.
-     *  
-     *    @param [in] child     The child to check.   
-     */
-    void markChildIfConflicting(MemoryVisualizationItem* child);
+    //! Requests the pending child items when the item is expanded.
+    void requestPendingChildren();
 
+private:
 
     //-----------------------------------------------------------------------------
     // Data.
@@ -211,6 +237,15 @@ private:
     //! The used expression parser.
     QSharedPointer<ExpressionParser> expressionParser_;
 
+    //! Nesting depth of the active child update batches.
+    int childUpdateDepth_ = 0;
+
+    //! Flag for a child layout requested during a child update batch.
+    bool childLayoutPending_ = false;
+
+    //! Flag for child items to create when the item is expanded.
+    bool childrenPending_ = false;
+
 };
 
 #endif // MEMORYVISUALIZATIONITEM_H
@@ -18,6 +18,8 @@
 
 #include <KactusAPI/include/KactusColors.h>
 
+#include <IPXACTmodels/Component/Component.h>
+
 #include <QPen>
 #include <QFont>
 #include <QGraphicsDropShadowEffect>
@@ -231,6 +233,25 @@ void AdHocItem::setPort(QSharedPointer<Port> newPort)
     port_ = newPort;
 }
 
+//-----------------------------------------------------------------------------
+// Function: AdHocItem::setOwnerComponent()
+//-----------------------------------------------------------------------------
+void AdHocItem::setOwnerComponent(QSharedPointer<Component> component)
+{
+    QSharedPointer<Component> previousComponent = getOwnerComponent();
+
+    // Ports not found in the previous component are shown only in the design and are kept as they are.
+    if (port_ && previousComponent && previousComponent->getPort(port_->name()) == port_)
+    {
+        if (QSharedPointer<Port> copiedPort = component->getPort(port_->name()))
+        {
+            port_ = copiedPort;
+        }
+    }
+
+    HWConnectionEndpoint::setOwnerComponent(component);
+}
+
 //-----------------------------------------------------------------------------
 // Function: AdHocItem::changeTieOffLabel()
 //-----------------------------------------------------------------------------
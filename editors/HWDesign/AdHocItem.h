@@ -119,6 +119,14 @@ public:
 
     void setPort(QSharedPointer<Port> newPort);
 
+    /*!
+     *  Sets the component that owns this end point item. A port of the previous component is replaced with the
+     *  port of the same name in the new component.
+     *
+     *    @param [in] component   The new owner component.
+     */
+    void setOwnerComponent(QSharedPointer<Component> component) override;
+
     /*!
      *  Check if the end point is an ad hoc port.
      *
@@ -171,6 +171,26 @@ void BusInterfaceEndPoint::setBusInterface(QSharedPointer<BusInterface> newBus)
     busInterface_ = newBus;
 }
 
+//-----------------------------------------------------------------------------
+// Function: BusInterfaceEndPoint::setOwnerComponent()
+//-----------------------------------------------------------------------------
+void BusInterfaceEndPoint::setOwnerComponent(QSharedPointer<Component> component)
+{
+    QSharedPointer<Component> previousComponent = getOwnerComponent();
+
+    // Only the interfaces of the previous component have copies in the new one.
+    if (busInterface_ && previousComponent &&
+        previousComponent->getBusInterface(busInterface_->name()) == busInterface_)
+    {
+        if (QSharedPointer<BusInterface> copiedInterface = component->getBusInterface(busInterface_->name()))
+        {
+            busInterface_ = copiedInterface;
+        }
+    }
+
+    HWConnectionEndpoint::setOwnerComponent(component);
+}
+
 //-----------------------------------------------------------------------------
 // Function: BusInterfaceEndPoint::description()
 //-----------------------------------------------------------------------------
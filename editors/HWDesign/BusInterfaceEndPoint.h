@@ -159,6 +159,14 @@ public:
      */
     void setBusInterface(QSharedPointer<BusInterface> newBus);
 
+    /*!
+     *  Sets the component that owns this end point item. A bus interface of the previous component is replaced
+     *  with the interface of the same name in the new component.
+     *
+     *    @param [in] component   The new owner component.
+     */
+    void setOwnerComponent(QSharedPointer<Component> component) override;
+
 protected:
 
     /*!
@@ -748,6 +748,9 @@ oldPortMaps_(),
 newPortMaps_(newPortMaps),
 component_(component)
 {
+    // The port maps are stored in the bus interface, so the interface must not be shared with other instances.
+    endpoint->prepareInterfaceEdit();
+
     QSharedPointer<BusInterface> endPointBus = endpoint->getBusInterface();
     if (endPointBus && endPointBus->getAbstractionTypes() && endPointBus->getAbstractionTypes()->size() > 0)
     {
@@ -23,6 +23,7 @@
 #include <common/graphicsItems/GraphicsConnection.h>
 #include <common/KactusUtils.h>
 
+#include <editors/common/ComponentSnapshots.h>
 #include <editors/common/diagramgrid.h>
 #include <editors/common/DesignDiagram.h>
 #include <editors/HWDesign/AdHocItem.h>
@@ -194,6 +195,8 @@ HWConnectionEndpoint* HWComponentItem::getDiagramAdHocPort(QString const& portNa
 //-----------------------------------------------------------------------------
 ActiveBusInterfaceItem* HWComponentItem::addPort(QPointF const& pos)
 {
+    detachComponentModel();
+
     // Determine a unique name for the bus interface.
     QString name = QStringLiteral("bus");
     unsigned int count = 0;
@@ -229,7 +232,10 @@ ActiveBusInterfaceItem* HWComponentItem::addPort(QPointF const& pos)
 //-----------------------------------------------------------------------------
 void HWComponentItem::addPort(HWConnectionEndpoint* port)
 {
+    detachComponentModel();
+
     port->setParentItem(this);
+    port->setOwnerComponent(componentModel());
 
     if (port->type() == ActiveBusInterfaceItem::Type)
     {
@@ -247,6 +253,8 @@ void HWComponentItem::addPort(HWConnectionEndpoint* port)
 //-----------------------------------------------------------------------------
 void HWComponentItem::removePort(HWConnectionEndpoint* port)
 {
+    detachComponentModel();
+
     disconnect(port, SIGNAL(moved(ConnectionEndpoint*)), this, SIGNAL(endpointMoved(ConnectionEndpoint*)));
 
     leftPorts_.removeAll(port);
@@ -260,6 +268,29 @@ void HWComponentItem::removePort(HWConnectionEndpoint* port)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: HWComponentItem::detachComponentModel()
+//-----------------------------------------------------------------------------
+void HWComponentItem::detachComponentModel()
+{
+    QSharedPointer<Component> component = ComponentSnapshots::detach(componentModel());
+    if (component == componentModel())
+    {
+        return;
+    }
+
+    setComponentModel(component);
+    setAdHocData(component, getPortAdHocVisibilities());
+
+    for (ConnectionEndpoint* endpoint : leftPorts_ + rightPorts_)
+    {
+        if (auto port = dynamic_cast<HWConnectionEndpoint*>(endpoint); port != nullptr)
+        {
+            port->setOwnerComponent(component);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: HWComponentItem::getBusPort()
 //-----------------------------------------------------------------------------
@@ -111,6 +111,12 @@ public:
      */
     void removePort(HWConnectionEndpoint* port);
 
+    /*!
+     *  Replaces a shared component model with a private copy before the model is modified.
+     *  The ports of the item are moved to the copy.
+     */
+    void detachComponentModel();
+
     /*! Get the BusPortItem that corresponds to the given bus interface name
      *
      */
@@ -104,6 +104,26 @@ QSharedPointer<Component> HWConnectionEndpoint::getOwnerComponent() const
     return containingComponent_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: HWConnectionEndPoint::setOwnerComponent()
+//-----------------------------------------------------------------------------
+void HWConnectionEndpoint::setOwnerComponent(QSharedPointer<Component> component)
+{
+    containingComponent_ = component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWConnectionEndPoint::prepareInterfaceEdit()
+//-----------------------------------------------------------------------------
+void HWConnectionEndpoint::prepareInterfaceEdit()
+{
+    // The component item moves all its end points, including this one, to the private copy.
+    if (auto parentHW = dynamic_cast<HWComponentItem*>(parentItem()); parentHW != nullptr)
+    {
+        parentHW->detachComponentModel();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: HWConnectionEndPoint::setName()
 //-----------------------------------------------------------------------------
@@ -75,6 +75,15 @@ public:
      */
     virtual QSharedPointer<Component> getOwnerComponent() const;
 
+    /*!
+     *  Sets the component that owns this end point item.
+     *
+     *    @param [in] component   The new owner component.
+     */
+    virtual void setOwnerComponent(QSharedPointer<Component> component);
+
+    void prepareInterfaceEdit() override;
+
     /*!
      *  Set the position for the bus interface name label.
      */
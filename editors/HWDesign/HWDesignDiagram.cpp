@@ -39,6 +39,7 @@
 #include <KactusAPI/include/ComponentParameterFinder.h>
 #include <KactusAPI/include/MultipleParameterFinder.h>
 
+#include <editors/common/ComponentSnapshots.h>
 #include <editors/common/DiagramUtil.h>
 #include <editors/common/diagramgrid.h>
 #include <editors/common/DesignDiagramResolver.h>
@@ -881,7 +882,7 @@ void HWDesignDiagram::dropEvent(QGraphicsSceneDragDropEvent *event)
         }
 
         // Create the component model.
-        QSharedPointer<Component> dropComponent = getLibraryInterface()->getModel(droppedVLNV).staticCast<Component>();
+        QSharedPointer<Component> dropComponent = ComponentSnapshots::getSnapshot(getLibraryInterface(), droppedVLNV);
 
         // Disallow instantiation of components marked as template.
         if (dropComponent->getFirmness() == KactusAttribute::TEMPLATE)
@@ -1683,6 +1684,9 @@ void HWDesignDiagram::copyPortMapsAndPhysicalPorts(QSharedPointer<Component> sou
 
     diagramResolver_->setContext(sourceComponent);
 
+    // The physical ports and port maps are added to the target, so it must not share its component.
+    target->prepareInterfaceEdit();
+
     General::InterfaceMode mode = target->getBusInterface()->getInterfaceMode();
     QStringList reservedNames = target->getOwnerComponent()->getPortNames();
 
@@ -1780,6 +1784,9 @@ QSharedPointer<Port> HWDesignDiagram::createConnectingPhysicalPort(QSharedPointe
 bool HWDesignDiagram::createPortMapsManually(ConnectionEndpoint* sourcePoint, ConnectionEndpoint* targetPoint,
     QUndoCommand* parentCommand)
 {
+    // The dialog edits the port maps of the target interface directly.
+    targetPoint->prepareInterfaceEdit();
+
     PortmapDialog dialog(getLibraryInterface(), targetPoint->getOwnerComponent(), 
         targetPoint->getBusInterface(), sourcePoint->getBusInterface(), getParent());
 
@@ -2013,9 +2020,10 @@ void HWDesignDiagram::createComponentItem(QSharedPointer<ComponentInstance> inst
 {
     QSharedPointer<Component> component;
 
+    // Packaged components are not modified in the design, so all their instances share one copy.
     if (!instance->isDraft())
     {
-        component = getLibraryInterface()->getModel<Component>(*instance->getComponentRef());
+        component = ComponentSnapshots::getSnapshot(getLibraryInterface(), *instance->getComponentRef());
 
         if (!component && instance->getComponentRef()->isValid())
         {
@@ -2104,18 +2112,10 @@ bool HWDesignDiagram::referenceFinderContainsComponent(QSharedPointer<Component>
 {
     for (QSharedPointer<ComponentInstance> instance : *getDesign()->getComponentInstances())
     {
-        if (instance->getComponentRef())
+        if (instance->getComponentRef() && *instance->getComponentRef() == component->getVlnv() &&
+            getLibraryInterface()->contains(component->getVlnv()))
         {
-            QSharedPointer<Document> componentDocument =
-                getLibraryInterface()->getModel(*instance->getComponentRef().data());
-            if (componentDocument)
-            {
-                QSharedPointer<Component> instancedComponent = componentDocument.dynamicCast<Component>();
-                if (instancedComponent && instancedComponent->getVlnv() == component->getVlnv())
-                {
-                    return true;
-                }
-            }
+            return true;
         }
     }
 
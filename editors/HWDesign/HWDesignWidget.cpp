@@ -340,7 +340,10 @@ bool HWDesignWidget::saveAs()
 		writeSucceeded = false;
 	}
 
-	getLibHandler()->endSave();
+	if (!getLibHandler()->endSave())
+	{
+		writeSucceeded = false;
+	}
 
 	if (writeSucceeded)
     {
@@ -21,6 +21,7 @@
 
 #include <QBrush>
 #include <QFont>
+#include <QMenu>
 
 //-----------------------------------------------------------------------------
 // Function: AddressBlockGraphicsItem::AddressBlockGraphicsItem()
@@ -29,15 +30,24 @@ AddressBlockGraphicsItem::AddressBlockGraphicsItem(QSharedPointer<MemoryItem con
     QVector<QString> identifierChain, bool isEmptyBlock, bool filterRegisters, bool filterFields,
     qreal addressBlockWidth, QSharedPointer<ConnectivityComponent const> containingInstance,
     MemoryMapGraphicsItem* memoryMapItem):
-MemoryDesignerChildGraphicsItem(blockItem, QStringLiteral("Address Block"), blockItem->getAddress().toULongLong(),
-    blockItem->getRange().toULongLong(), addressBlockWidth, identifierChain, containingInstance, memoryMapItem),
-SubMemoryLayout(blockItem, MemoryDesignerConstants::REGISTER_TYPE, filterRegisters, this),
+MemoryDesignerChildGraphicsItem(blockItem, QStringLiteral("Address Block"), blockItem->getAddressValue(),
+    blockItem->getRangeValue(), addressBlockWidth, identifierChain, containingInstance, memoryMapItem),
+SubMemoryLayout(blockItem, MemoryDesignerConstants::REGISTER_TYPE,
+    filterRegisters || blockItem->getCollapsedChildCount() > 0, this),
 addressUnitBits_(blockItem->getAUB()),
 filterFields_(filterFields),
-isEmpty_(isEmptyBlock)
+isEmpty_(isEmptyBlock),
+blockIdentifier_(blockItem->getIdentifier()),
+collapsedRegisterCount_(filterRegisters ? 0 : blockItem->getCollapsedChildCount())
 {
     setupAddressBlock();
 
+    if (collapsedRegisterCount_ > 0)
+    {
+        addToToolTip(QStringLiteral("<br><br><b>Collapsed registers:</b> ") +
+            QString::number(collapsedRegisterCount_));
+    }
+
     qreal xPosition = MemoryDesignerConstants::MAPSUBITEMPOSITIONX - 1;
     setupSubItems(xPosition, getSubItemType(), blockItem);
 }
@@ -50,7 +60,9 @@ MemoryDesignerChildGraphicsItem(other, memoryMapItem),
 SubMemoryLayout(other, this),
 addressUnitBits_(other.addressUnitBits_),
 filterFields_(other.filterFields_),
-isEmpty_(other.isEmpty_)
+isEmpty_(other.isEmpty_),
+blockIdentifier_(other.blockIdentifier_),
+collapsedRegisterCount_(other.collapsedRegisterCount_)
 {
     setupAddressBlock();
     cloneSubItems(other);
@@ -192,6 +204,20 @@ void AddressBlockGraphicsItem::addMemoryConnection(MemoryConnectionItem* connect
     addConnectionToSubItems(connectionItem);
 }
 
+//-----------------------------------------------------------------------------
+// Function: AddressBlockGraphicsItem::addContextMenuActions()
+//-----------------------------------------------------------------------------
+void AddressBlockGraphicsItem::addContextMenuActions(QMenu& contextMenu)
+{
+    if (collapsedRegisterCount_ > 0)
+    {
+        QAction* expandAction =
+            contextMenu.addAction(QStringLiteral("Show %1 registers").arg(collapsedRegisterCount_));
+
+        connect(expandAction, &QAction::triggered, this, [this]() { emit expandCollapsedItem(blockIdentifier_); });
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: AddressBlockGraphicsItem::getItemWidth()
 //-----------------------------------------------------------------------------
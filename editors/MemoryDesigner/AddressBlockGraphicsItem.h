@@ -105,6 +105,15 @@ public:
      */
     void createFieldOverlapItems();
 
+protected:
+
+    /*!
+     *  Add the action for expanding collapsed registers to the context menu.
+     *
+     *    @param [in] contextMenu     The context menu being constructed.
+     */
+    virtual void addContextMenuActions(QMenu& contextMenu) override;
+
 private:
     // Disable copying.
     AddressBlockGraphicsItem& operator=(AddressBlockGraphicsItem const& rhs);
@@ -183,6 +192,12 @@ private:
 
     //! Flag for empty address blocks.
     bool isEmpty_;
+
+    //! Identifier of the address block memory item.
+    QString blockIdentifier_;
+
+    //! Number of registers that have not been created for the address block.
+    int collapsedRegisterCount_;
 };
 
 //-----------------------------------------------------------------------------
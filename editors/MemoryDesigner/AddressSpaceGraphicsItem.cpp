@@ -47,7 +47,7 @@ cpuIcon_(new QGraphicsPixmapItem(QPixmap(":icons/common/graphics/settings-code_e
     itemPen.setColor(KactusColors::MEM_DESIGNER_CONNECTION);
     setPen(itemPen);
 
-    spaceRangeInt_ = memoryItem->getRange().toULongLong();
+    spaceRangeInt_ = memoryItem->getRangeValue();
     int spaceWidth = MemoryDesignerConstants::ITEMWIDTH;
 
     setGraphicsRectangle(spaceWidth + 1, spaceRangeInt_);
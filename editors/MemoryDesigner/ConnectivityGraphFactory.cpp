@@ -97,6 +97,31 @@ QSharedPointer<ConnectivityGraph> ConnectivityGraphFactory::createConnectivityGr
     return graph;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ConnectivityGraphFactory::setMemoryDetailLevel()
+//-----------------------------------------------------------------------------
+void ConnectivityGraphFactory::setMemoryDetailLevel(bool createRegisters, bool createFields)
+{
+    createRegisters_ = createRegisters;
+    createFields_ = createRegisters && createFields;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectivityGraphFactory::setRegisterExpansionLimit()
+//-----------------------------------------------------------------------------
+void ConnectivityGraphFactory::setRegisterExpansionLimit(int registerLimit)
+{
+    registerExpansionLimit_ = registerLimit;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectivityGraphFactory::setExpandedAddressBlocks()
+//-----------------------------------------------------------------------------
+void ConnectivityGraphFactory::setExpandedAddressBlocks(QSet<QString> const& blockIdentifiers)
+{
+    expandedBlocks_ = blockIdentifiers;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ConnectivityGraphFactory::analyzeDesign()
 //-----------------------------------------------------------------------------
@@ -387,6 +412,15 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createMemoryAddressBlockIte
 
     blockItem->setIsPresent(blockPresence);
 
+    // Registers of large address blocks are only counted until the block is expanded.
+    int registerCount = addressBlock->getRegisterData()->size();
+    if (createRegisters_ == false || (registerExpansionLimit_ > 0 && registerCount > registerExpansionLimit_ &&
+        expandedBlocks_.contains(blockIdentifier) == false))
+    {
+        blockItem->setCollapsedChildCount(registerCount);
+        return blockItem;
+    }
+
     for (QSharedPointer<RegisterBase> registerBase : *addressBlock->getRegisterData())
     {
         if (registerBase->getIsPresent().isEmpty() || 
@@ -475,29 +509,36 @@ void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> re
             regItem->setFormattedOffsetExpression(formatter_->formatReferringExpression(reg->getAddressOffset()));
         }
 
-        QVector<QSharedPointer<MemoryItem> > fieldItems;
-
-        for (QSharedPointer<Field> field : *reg->getFields())
+        if (createFields_)
         {
-            if (field->getIsPresent().isEmpty() ||
-                expressionParser_->parseExpression(field->getIsPresent()).toInt() == 1)
+            QVector<QSharedPointer<MemoryItem> > fieldItems;
+
+            for (QSharedPointer<Field> field : *reg->getFields())
             {
-                fieldItems.append(createField(field, registerIdentifier, registerAddress, addressableUnitBits));
+                if (field->getIsPresent().isEmpty() ||
+                    expressionParser_->parseExpression(field->getIsPresent()).toInt() == 1)
+                {
+                    fieldItems.append(createField(field, registerIdentifier, registerAddress, addressableUnitBits));
+                }
             }
-        }
 
-        QMap<quint64, QSharedPointer<MemoryItem> > orderedFieldItems = getOrderedFieldItems(regItem, fieldItems);
+            QMap<quint64, QSharedPointer<MemoryItem> > orderedFieldItems = getOrderedFieldItems(regItem, fieldItems);
+
+            QMapIterator<quint64, QSharedPointer<MemoryItem> > fieldIterator(orderedFieldItems);
+            while (fieldIterator.hasNext())
+            {
+                fieldIterator.next();
+                regItem->addChild(fieldIterator.value());
+            }
 
-        QMapIterator<quint64, QSharedPointer<MemoryItem> > fieldIterator(orderedFieldItems);
-        while (fieldIterator.hasNext())
+            regItem->addChild(
+                createRegisterResetItem(orderedFieldItems, regItem, registerIdentifier, addressableUnitBits));
+        }
+        else
         {
-            fieldIterator.next();
-            regItem->addChild(fieldIterator.value());
+            regItem->setCollapsedChildCount(reg->getFields()->size());
         }
 
-        regItem->addChild(
-            createRegisterResetItem(orderedFieldItems, regItem, registerIdentifier, addressableUnitBits));
-
         registerAddress += registerSize / addressableUnitBits;
 
         blockItem->addChild(regItem);
@@ -510,7 +551,7 @@ void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> re
 QMap<quint64, QSharedPointer<MemoryItem> > ConnectivityGraphFactory::getOrderedFieldItems(
     QSharedPointer<MemoryItem> registerItem, QVector<QSharedPointer<MemoryItem> > fieldItems) const
 {
-    quint64 registerOffset = registerItem->getAddress().toULongLong();
+    quint64 registerOffset = registerItem->getAddressValue();
     QMap<quint64, QSharedPointer<MemoryItem> > orderedFieldItems;
 
     for (auto fieldItem : fieldItems)
@@ -684,7 +725,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
         currentEnd = fieldEnd + 1;
     }
 
-    quint64 registerSize = registerItem->getSize().toULongLong();
+    quint64 registerSize = registerItem->getSizeValue();
     resetValue = resetValue.rightJustified(registerSize, '0', true);
     resetMask = resetMask.rightJustified(registerSize, '0', true);
 
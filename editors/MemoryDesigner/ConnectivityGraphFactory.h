@@ -50,6 +50,7 @@ class ExpressionFormatter;
 
 #include <QString>
 #include <QSharedPointer>
+#include <QSet>
 
 //-----------------------------------------------------------------------------
 //! Creates a connectivity graph from a given design and design configuration.
@@ -80,6 +81,28 @@ public:
     QSharedPointer<ConnectivityGraph> createConnectivityGraph(QSharedPointer<const Component> topComponent,
         QString const& activeView);
 
+    /*!
+     *  Set the level of detail for the created memory items. Registers and fields are created by default.
+     *
+     *    @param [in] createRegisters     Flag for creating the registers of address blocks.
+     *    @param [in] createFields        Flag for creating the fields of registers.
+     */
+    void setMemoryDetailLevel(bool createRegisters, bool createFields);
+
+    /*!
+     *  Set the number of registers above which the registers of an address block are left uncreated.
+     *
+     *    @param [in] registerLimit   The register limit. Zero creates the registers of all the address blocks.
+     */
+    void setRegisterExpansionLimit(int registerLimit);
+
+    /*!
+     *  Set the address blocks whose registers are created regardless of the register expansion limit.
+     *
+     *    @param [in] blockIdentifiers    Identifiers of the expanded address blocks.
+     */
+    void setExpandedAddressBlocks(QSet<QString> const& blockIdentifiers);
+
 private:
     // Disable copying.
     ConnectivityGraphFactory(ConnectivityGraphFactory const& rhs);
@@ -535,6 +558,18 @@ private:
 
     //! Formatter for expressions.
     ExpressionFormatter* formatter_;
+
+    //! Flag for creating the registers of address blocks.
+    bool createRegisters_ = true;
+
+    //! Flag for creating the fields of registers.
+    bool createFields_ = true;
+
+    //! Number of registers above which the address block registers are not created.
+    int registerExpansionLimit_ = 0;
+
+    //! Identifiers of the address blocks whose registers are always created.
+    QSet<QString> expandedBlocks_;
 };
 
 //-----------------------------------------------------------------------------
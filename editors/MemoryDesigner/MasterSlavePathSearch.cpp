@@ -19,6 +19,7 @@
 #include <editors/MemoryDesigner/MemoryDesignerConstants.h>
 
 #include <QQueue>
+#include <QThreadPool>
 
 //-----------------------------------------------------------------------------
 // Function: MasterSlavePathSearch::findMasterSlavePaths()
@@ -26,11 +27,35 @@
 QVector<QVector<QSharedPointer<ConnectivityInterface const> > > MasterSlavePathSearch::
     findMasterSlavePaths(QSharedPointer<const ConnectivityGraph> graph, bool allowOverlappingPaths) const
 {
-    QVector<MasterSlavePathSearch::Path> masterPaths;
+    QVector<QSharedPointer<ConnectivityInterface> > masterInterfaces = findInitialMasterInterfaces(graph);
+
+    // The paths of each master are independent, so they are searched in parallel and collected in master order.
+    QVector<QVector<MasterSlavePathSearch::Path> > pathsForMasters(masterInterfaces.size());
+    if (masterInterfaces.size() > 1)
+    {
+        QThreadPool workers;
+        for (int i = 0; i < masterInterfaces.size(); ++i)
+        {
+            QVector<MasterSlavePathSearch::Path>* result = &pathsForMasters[i];
+            QSharedPointer<ConnectivityInterface> masterInterface = masterInterfaces.at(i);
+
+            workers.start(QRunnable::create([this, result, masterInterface, &graph]()
+                {
+                    *result = findPaths(masterInterface, graph);
+                }));
+        }
+
+        workers.waitForDone();
+    }
+    else if (masterInterfaces.isEmpty() == false)
+    {
+        pathsForMasters.first() = findPaths(masterInterfaces.first(), graph);
+    }
 
-    for (auto const& masterInterface : findInitialMasterInterfaces(graph))
+    QVector<MasterSlavePathSearch::Path> masterPaths;
+    for (auto const& paths : pathsForMasters)
     {
-        masterPaths.append(findPaths(masterInterface,  graph));
+        masterPaths.append(paths);
     }
 
     masterPaths = findValidPathsIn(masterPaths, allowOverlappingPaths);
@@ -38,7 +38,7 @@ MemoryConnectionAddressCalculator::CalculatedPathAddresses MemoryConnectionAddre
     if (startInterface != endInterface)
     {
         auto pathMemoryItem = startInterface->getConnectedMemory();
-        auto memoryItemRange = pathMemoryItem->getRange().toULongLong();
+        auto memoryItemRange = pathMemoryItem->getRangeValue();
         availableLastAddress = memoryItemRange - 1;
 
         for (auto pathInterface : connectionPath)
@@ -51,7 +51,7 @@ MemoryConnectionAddressCalculator::CalculatedPathAddresses MemoryConnectionAddre
                 if (remapRange.isEmpty())
                 {
                     pathMemoryItem = pathInterface->getConnectedMemory();
-                    memoryItemRange = pathMemoryItem->getRange().toULongLong();
+                    memoryItemRange = pathMemoryItem->getRangeValue();
                 }
                 else
                 {
@@ -86,7 +86,7 @@ MemoryConnectionAddressCalculator::CalculatedPathAddresses MemoryConnectionAddre
     else
     {
         auto startMemory = startInterface->getConnectedMemory();
-        auto startRange = startMemory->getRange().toULongLong();
+        auto startRange = startMemory->getRangeValue();
         
         availableLastAddress = connectionBaseAddress + startRange - 1;
     }
@@ -138,10 +138,10 @@ QPair<quint64, quint64> MemoryConnectionAddressCalculator::getMemoryMapAddressRa
 
         foreach(QSharedPointer<MemoryItem const> blockItem, mapItem->getChildItems())
         {
-            if (blockItem->getType().compare(MemoryDesignerConstants::ADDRESSBLOCK_TYPE, Qt::CaseInsensitive) == 0)
+            if (blockItem->getKind() == MemoryItem::Kind::ADDRESS_BLOCK)
             {
-                quint64 blockBaseAddress = blockItem->getAddress().toULongLong();
-                quint64 blockRange = blockItem->getRange().toULongLong();
+                quint64 blockBaseAddress = blockItem->getAddressValue();
+                quint64 blockRange = blockItem->getRangeValue();
                 quint64 blockEndPoint = blockBaseAddress + blockRange - 1;
 
                 if (firstBlock)
@@ -31,6 +31,8 @@ widthBoundary_(0)
 {
     connect(itemHandler_.data(), SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)),
         this, SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)), Qt::UniqueConnection);
+    connect(itemHandler_.data(), SIGNAL(expandCollapsedItem(QString const&)),
+        this, SIGNAL(expandCollapsedItem(QString const&)), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -49,6 +49,9 @@ namespace MemoryDesignerConstants
     //! X-position of the memory map graphics item sub items.
     const qreal MAPSUBITEMPOSITIONX = ITEMWIDTH / 4;
 
+    //! Number of registers in an address block, above which the registers are created only on request.
+    const int MAXIMUM_EXPANDED_REGISTERS = 256;
+
     const QString RESERVED_NAME = QLatin1String("Reserved");
     const QString HARD_RESET_TYPE = QLatin1String("HARD");
 
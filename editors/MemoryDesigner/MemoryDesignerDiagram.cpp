@@ -41,6 +41,9 @@ memoryConstructor_(new MemoryDesignConstructor(layout_))
 {
     connect(memoryConstructor_, SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)),
         this, SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)), Qt::UniqueConnection);
+    // Queued, since the expansion rebuilds the scene containing the item requesting it.
+    connect(memoryConstructor_, SIGNAL(expandCollapsedItem(QString const&)),
+        this, SLOT(onExpandCollapsedItem(QString const&)), Qt::QueuedConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -203,6 +206,19 @@ bool MemoryDesignerDiagram::loadDesignFromCurrentView(QSharedPointer<const Compo
 {
     clearScene();
 
+    // Only the memory items visible with the current filtering are created. Large address blocks are shown
+    // collapsed until expanded, unless the blocks are filtered and their registers shown directly in the map.
+    graphFactory_.setMemoryDetailLevel(!addressBlockRegistersAreFiltered(), !fieldsAreFiltered());
+    graphFactory_.setExpandedAddressBlocks(expandedBlocks_);
+    if (addressBlocksAreFiltered())
+    {
+        graphFactory_.setRegisterExpansionLimit(0);
+    }
+    else
+    {
+        graphFactory_.setRegisterExpansionLimit(MemoryDesignerConstants::MAXIMUM_EXPANDED_REGISTERS);
+    }
+
     if (auto connectionGraph = graphFactory_.createConnectivityGraph(component, viewName))
     {
         bool constructionIsSuccess = memoryConstructor_->constructMemoryDesignItems(connectionGraph);
@@ -221,6 +237,19 @@ bool MemoryDesignerDiagram::loadDesignFromCurrentView(QSharedPointer<const Compo
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryDesignerDiagram::onExpandCollapsedItem()
+//-----------------------------------------------------------------------------
+void MemoryDesignerDiagram::onExpandCollapsedItem(QString const& itemIdentifier)
+{
+    expandedBlocks_.insert(itemIdentifier);
+
+    if (parentDocument_)
+    {
+        parentDocument_->refresh();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryDesignerDiagram::clearScene()
 //-----------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 
 #include <QGraphicsScene>
 #include <QSharedPointer>
+#include <QSet>
 
 class LibraryInterface;
 class MemoryDesignDocument;
@@ -222,6 +223,15 @@ signals:
      */
     void openComponentDocument(VLNV const& vlnv, QVector<QString> identifierChain);
 
+private slots:
+
+    /*!
+     *  Handle the expansion of a collapsed memory item.
+     *
+     *    @param [in] itemIdentifier  Identifier of the memory item to expand.
+     */
+    void onExpandCollapsedItem(QString const& itemIdentifier);
+
 private:
     // Disable copying.
     MemoryDesignerDiagram(MemoryDesignerDiagram const& rhs);
@@ -250,6 +260,9 @@ private:
 
     //! Constructor for memory design graphics items.
     MemoryDesignConstructor* memoryConstructor_;
+
+    //! Identifiers of the address blocks expanded regardless of their register count.
+    QSet<QString> expandedBlocks_;
 };
 
 //-----------------------------------------------------------------------------
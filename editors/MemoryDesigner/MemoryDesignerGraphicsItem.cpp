@@ -501,9 +501,19 @@ void MemoryDesignerGraphicsItem::contextMenuEvent(QGraphicsSceneContextMenuEvent
         contextMenu.addAction(openItemEditorAction_);
     }
 
+    addContextMenuActions(contextMenu);
+
     contextMenu.exec(event->screenPos());
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryDesignerGraphicsItem::addContextMenuActions()
+//-----------------------------------------------------------------------------
+void MemoryDesignerGraphicsItem::addContextMenuActions(QMenu& /*contextMenu*/)
+{
+
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryDesignerGraphicsItem::openContainingComponent()
 //-----------------------------------------------------------------------------
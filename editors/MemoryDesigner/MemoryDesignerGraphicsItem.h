@@ -29,6 +29,8 @@ class MemoryCollisionItem;
 class ConnectivityComponent;
 class MemoryItem;
 
+class QMenu;
+
 //-----------------------------------------------------------------------------
 //! Parent class for memory designer graphics items.
 //-----------------------------------------------------------------------------
@@ -274,6 +276,13 @@ protected:
      */
     void contextMenuEvent(QGraphicsSceneContextMenuEvent *event);
 
+    /*!
+     *  Add item specific actions to the context menu.
+     *
+     *    @param [in] contextMenu     The context menu being constructed.
+     */
+    virtual void addContextMenuActions(QMenu& contextMenu);
+
 signals:
 
     /*!
@@ -285,6 +294,13 @@ signals:
      */
     void openComponentDocument(VLNV const& vlnv, QVector<QString> identifierChain);
 
+    /*!
+     *  Create the sub items of a collapsed memory item.
+     *
+     *    @param [in] itemIdentifier  Identifier of the memory item to expand.
+     */
+    void expandCollapsedItem(QString const& itemIdentifier);
+
 private slots:
 
     /*!
@@ -253,6 +253,8 @@ void MemoryGraphicsItemHandler::connectGraphicsItemSignals(MainMemoryGraphicsIte
 {
     connect(graphicsItem, SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)),
         this, SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)), Qt::UniqueConnection);
+    connect(graphicsItem, SIGNAL(expandCollapsedItem(QString const&)),
+        this, SIGNAL(expandCollapsedItem(QString const&)), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
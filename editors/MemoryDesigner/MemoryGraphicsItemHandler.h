@@ -184,6 +184,13 @@ signals:
      */
     void openComponentDocument(VLNV const& vlnv, QVector<QString> identifierChain);
 
+    /*!
+     *  Create the sub items of a collapsed memory item.
+     *
+     *    @param [in] itemIdentifier  Identifier of the memory item to expand.
+     */
+    void expandCollapsedItem(QString const& itemIdentifier);
+
 private:
     // Disable copying.
     MemoryGraphicsItemHandler(MemoryGraphicsItemHandler const& rhs);
@@ -11,12 +11,69 @@
 
 #include "MemoryItem.h"
 
+#include <editors/MemoryDesigner/MemoryDesignerConstants.h>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: kindForType()
+    //-----------------------------------------------------------------------------
+    MemoryItem::Kind kindForType(QString const& type)
+    {
+        static const QVector<QPair<QString, MemoryItem::Kind> > TYPE_KINDS =
+        {
+            { MemoryDesignerConstants::ADDRESSSPACE_TYPE, MemoryItem::Kind::ADDRESS_SPACE },
+            { MemoryDesignerConstants::ADDRESSSEGMENT_TYPE, MemoryItem::Kind::ADDRESS_SEGMENT },
+            { MemoryDesignerConstants::MEMORYMAP_TYPE, MemoryItem::Kind::MEMORY_MAP },
+            { MemoryDesignerConstants::MEMORYREMAP_TYPE, MemoryItem::Kind::MEMORY_REMAP },
+            { MemoryDesignerConstants::ADDRESSBLOCK_TYPE, MemoryItem::Kind::ADDRESS_BLOCK },
+            { MemoryDesignerConstants::SUBSPACEMAP_TYPE, MemoryItem::Kind::SUBSPACE_MAP },
+            { MemoryDesignerConstants::REGISTER_TYPE, MemoryItem::Kind::REGISTER },
+            { MemoryDesignerConstants::FIELD_TYPE, MemoryItem::Kind::FIELD },
+            { MemoryDesignerConstants::ENUMERATED_VALUE_TYPE, MemoryItem::Kind::ENUMERATED_VALUE },
+            { MemoryDesignerConstants::RESET_TYPE, MemoryItem::Kind::RESET }
+        };
+
+        for (auto const& typeKind : TYPE_KINDS)
+        {
+            if (type.compare(typeKind.first, Qt::CaseInsensitive) == 0)
+            {
+                return typeKind.second;
+            }
+        }
+
+        return MemoryItem::Kind::UNKNOWN;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: isPlainNumber()
+    //-----------------------------------------------------------------------------
+    bool isPlainNumber(QString const& value)
+    {
+        if (value.isEmpty() || (value.size() > 1 && value.at(0) == QLatin1Char('0')))
+        {
+            return false;
+        }
+
+        for (QChar const& character : value)
+        {
+            if (character < QLatin1Char('0') || character > QLatin1Char('9'))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::MemoryItem()
 //-----------------------------------------------------------------------------
 MemoryItem::MemoryItem(QString const& name, QString const& type):
 name_(name),
-type_(type)
+type_(type),
+kind_(kindForType(type))
 {
 
 }
@@ -37,6 +94,14 @@ QString MemoryItem::getType() const
     return type_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getKind()
+//-----------------------------------------------------------------------------
+MemoryItem::Kind MemoryItem::getKind() const
+{
+    return kind_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::setDisplayName()
 //-----------------------------------------------------------------------------
@@ -90,7 +155,7 @@ QString MemoryItem::getIdentifier() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setAUB(QString const& aub)
 {
-    aub_ = aub;
+    setNumericProperty(AUB, aub);
 }
 
 //-----------------------------------------------------------------------------
@@ -98,7 +163,15 @@ void MemoryItem::setAUB(QString const& aub)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getAUB() const
 {
-    return aub_;
+    return getNumericPropertyText(AUB);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getAUBValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getAUBValue() const
+{
+    return getNumericPropertyValue(AUB);
 }
 
 //-----------------------------------------------------------------------------
@@ -106,7 +179,7 @@ QString MemoryItem::getAUB() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setAddress(QString const& address)
 {
-    address_ = address;
+    setNumericProperty(ADDRESS, address);
 }
 
 //-----------------------------------------------------------------------------
@@ -114,7 +187,15 @@ void MemoryItem::setAddress(QString const& address)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getAddress() const
 {
-    return address_;
+    return getNumericPropertyText(ADDRESS);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getAddressValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getAddressValue() const
+{
+    return getNumericPropertyValue(ADDRESS);
 }
 
 //-----------------------------------------------------------------------------
@@ -138,7 +219,7 @@ QString MemoryItem::getFormattedAddressExpression() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setRange(QString const& range)
 {
-    range_ = range;
+    setNumericProperty(RANGE, range);
 }
 
 //-----------------------------------------------------------------------------
@@ -146,7 +227,15 @@ void MemoryItem::setRange(QString const& range)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getRange() const
 {
-    return range_;
+    return getNumericPropertyText(RANGE);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getRangeValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getRangeValue() const
+{
+    return getNumericPropertyValue(RANGE);
 }
 
 //-----------------------------------------------------------------------------
@@ -170,7 +259,7 @@ QString MemoryItem::getFormattedRangeExpression() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setWidth(QString const& width)
 {
-    width_ = width;
+    setNumericProperty(WIDTH, width);
 }
 
 //-----------------------------------------------------------------------------
@@ -178,7 +267,15 @@ void MemoryItem::setWidth(QString const& width)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getWidth() const
 {
-    return width_;
+    return getNumericPropertyText(WIDTH);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getWidthValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getWidthValue() const
+{
+    return getNumericPropertyValue(WIDTH);
 }
 
 //-----------------------------------------------------------------------------
@@ -218,7 +315,7 @@ AccessTypes::Access MemoryItem::getAccess() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setSize(QString const& size)
 {
-    size_ = size;
+    setNumericProperty(SIZE, size);
 }
 
 //-----------------------------------------------------------------------------
@@ -226,7 +323,15 @@ void MemoryItem::setSize(QString const& size)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getSize() const
 {
-    return size_;
+    return getNumericPropertyText(SIZE);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getSizeValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getSizeValue() const
+{
+    return getNumericPropertyValue(SIZE);
 }
 
 //-----------------------------------------------------------------------------
@@ -234,7 +339,7 @@ QString MemoryItem::getSize() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setOffset(QString const& offset)
 {
-    offset_ = offset;
+    setNumericProperty(OFFSET, offset);
 }
 
 //-----------------------------------------------------------------------------
@@ -242,7 +347,15 @@ void MemoryItem::setOffset(QString const& offset)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getOffset() const
 {
-    return offset_;
+    return getNumericPropertyText(OFFSET);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getOffsetValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getOffsetValue() const
+{
+    return getNumericPropertyValue(OFFSET);
 }
 
 //-----------------------------------------------------------------------------
@@ -282,7 +395,7 @@ QVector<QSharedPointer<MemoryItem> > MemoryItem::getChildItems() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setDimension(QString const& dimension)
 {
-    dimension_ = dimension;
+    setNumericProperty(DIMENSION, dimension);
 }
 
 //-----------------------------------------------------------------------------
@@ -290,7 +403,7 @@ void MemoryItem::setDimension(QString const& dimension)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getDimension() const
 {
-    return dimension_;
+    return getNumericPropertyText(DIMENSION);
 }
 
 //-----------------------------------------------------------------------------
@@ -404,3 +517,79 @@ QString MemoryItem::getSegmentReference() const
 {
     return segmentReference_;
 }
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setCollapsedChildCount()
+//-----------------------------------------------------------------------------
+void MemoryItem::setCollapsedChildCount(int childCount)
+{
+    collapsedChildCount_ = childCount;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getCollapsedChildCount()
+//-----------------------------------------------------------------------------
+int MemoryItem::getCollapsedChildCount() const
+{
+    return collapsedChildCount_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setNumericProperty()
+//-----------------------------------------------------------------------------
+void MemoryItem::setNumericProperty(NumericProperty property, QString const& value)
+{
+    bool isNumber = isPlainNumber(value);
+    quint64 numericValue = 0;
+    if (isNumber)
+    {
+        numericValue = value.toULongLong(&isNumber);
+    }
+
+    if (isNumber)
+    {
+        numericProperties_[property] = numericValue;
+        numericPropertyMask_ |= (1 << property);
+        textProperties_.remove(property);
+    }
+    else
+    {
+        numericProperties_[property] = 0;
+        numericPropertyMask_ &= ~(1 << property);
+
+        if (value.isEmpty())
+        {
+            textProperties_.remove(property);
+        }
+        else
+        {
+            textProperties_.insert(property, value);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getNumericPropertyText()
+//-----------------------------------------------------------------------------
+QString MemoryItem::getNumericPropertyText(NumericProperty property) const
+{
+    if (numericPropertyMask_ & (1 << property))
+    {
+        return QString::number(numericProperties_[property]);
+    }
+
+    return textProperties_.value(property, QString(""));
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getNumericPropertyValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getNumericPropertyValue(NumericProperty property) const
+{
+    if (numericPropertyMask_ & (1 << property))
+    {
+        return numericProperties_[property];
+    }
+
+    return textProperties_.value(property).toULongLong();
+}
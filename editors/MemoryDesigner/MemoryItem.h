@@ -15,17 +15,39 @@
 #include <IPXACTmodels/common/AccessTypes.h>
 #include <IPXACTmodels/generaldeclarations.h>
 
+#include <QHash>
 #include <QString>
 #include <QSharedPointer>
 #include <QVector>
 
+#include <array>
+
 //-----------------------------------------------------------------------------
 //! A memory in a connectivity graph.
+//!
+//! Addresses, ranges, widths, sizes, offsets and dimensions are stored as 64-bit numbers. Values that are not
+//! plain decimal numbers, e.g. unresolved expressions, are kept as text.
 //-----------------------------------------------------------------------------
 class MemoryItem 
 {
 public:
 
+    //! The kinds of memory items.
+    enum class Kind : quint8
+    {
+        ADDRESS_SPACE,
+        ADDRESS_SEGMENT,
+        MEMORY_MAP,
+        MEMORY_REMAP,
+        ADDRESS_BLOCK,
+        SUBSPACE_MAP,
+        REGISTER,
+        FIELD,
+        ENUMERATED_VALUE,
+        RESET,
+        UNKNOWN
+    };
+
 	/*!
 	 *  The constructor.
 	 *
@@ -48,6 +70,55 @@ public:
      */
     QString getType() const;
 
+    /*!
+     *  Gets the kind of the memory.
+     *
+     *    @return The kind of the memory.
+     */
+    Kind getKind() const;
+
+    /*!
+     *  Gets the number of addressable unit bits as a number.
+     *
+     *    @return The number of addressable unit bits, or 0 if not a number.
+     */
+    quint64 getAUBValue() const;
+
+    /*!
+     *  Gets the address as a number.
+     *
+     *    @return The address, or 0 if not a number.
+     */
+    quint64 getAddressValue() const;
+
+    /*!
+     *  Gets the range as a number.
+     *
+     *    @return The range, or 0 if not a number.
+     */
+    quint64 getRangeValue() const;
+
+    /*!
+     *  Gets the width as a number.
+     *
+     *    @return The width, or 0 if not a number.
+     */
+    quint64 getWidthValue() const;
+
+    /*!
+     *  Gets the size as a number.
+     *
+     *    @return The size, or 0 if not a number.
+     */
+    quint64 getSizeValue() const;
+
+    /*!
+     *  Gets the offset as a number.
+     *
+     *    @return The offset, or 0 if not a number.
+     */
+    quint64 getOffsetValue() const;
+
     /*!
      *  Sets a display name for the memory.
      *
@@ -366,7 +437,61 @@ public:
      */
     QString getSegmentReference() const;
 
+    /*!
+     *  Set the number of sub-elements that have not been created for the memory.
+     *
+     *    @param [in] childCount  The number of uncreated sub-elements.
+     */
+    void setCollapsedChildCount(int childCount);
+
+    /*!
+     *  Get the number of sub-elements that have not been created for the memory.
+     *
+     *    @return The number of uncreated sub-elements.
+     */
+    int getCollapsedChildCount() const;
+
 private:
+
+    //! The properties stored as numbers.
+    enum NumericProperty
+    {
+        AUB = 0,
+        ADDRESS,
+        RANGE,
+        WIDTH,
+        SIZE,
+        OFFSET,
+        DIMENSION,
+        NUMERIC_PROPERTY_COUNT
+    };
+
+    /*!
+     *  Sets the value of a numeric property.
+     *
+     *    @param [in] property    The property to set.
+     *    @param [in] value       The new value.
+     */
+    void setNumericProperty(NumericProperty property, QString const& value);
+
+    /*!
+     *  Gets the value of a numeric property as text.
+     *
+     *    @param [in] property    The selected property.
+     *
+     *    @return The value of the property.
+     */
+    QString getNumericPropertyText(NumericProperty property) const;
+
+    /*!
+     *  Gets the value of a numeric property as a number.
+     *
+     *    @param [in] property    The selected property.
+     *
+     *    @return The value of the property, or 0 if not a number.
+     */
+    quint64 getNumericPropertyValue(NumericProperty property) const;
+
     //! The name of the memory element.
     QString name_ = "";
 
@@ -379,48 +504,39 @@ private:
     //! The type of the memory element.
     QString type_ = "";
 
-    //! The identifier for the memory.
-    QString identifier_ = "";
+    //! The kind of the memory element.
+    Kind kind_ = Kind::UNKNOWN;
+
+    //! Bit mask of the numeric properties holding a number.
+    quint8 numericPropertyMask_ = 0;
+
+    //! The values of the numeric properties holding a number.
+    std::array<quint64, NUMERIC_PROPERTY_COUNT> numericProperties_{};
 
-    //! The number of addressable unit bits in the memory.
-    QString aub_ = "";
+    //! The numeric properties with values other than plain numbers, e.g. unresolved expressions.
+    QHash<int, QString> textProperties_;
 
-    //! The address for the memory.
-    QString address_ = "";
+    //! The identifier for the memory.
+    QString identifier_ = "";
 
     //! Formatted address expression for the memory.
     QString formattedAddressExpression_ = "";
 
-    //! The range for the memory.
-    QString range_ = "";
-
 	//! Formatted range expression for the memory.
     QString formattedRangeExpressin_ = "";
 
-    //! The bit width for the memory.
-    QString width_ = "";
-
 	//! Formatted width expression for the memory.
     QString formattedWidthExpression_ = "";
 
     //! Access value of the memory.
     AccessTypes::Access access_ = AccessTypes::ACCESS_COUNT;
 
-    //! The size of the memory.
-    QString size_ = "";
-
-    //! The offset of the memory.
-    QString offset_ = "";
-
 	//! Formatted offset expression for the memory.
     QString formattedOffsetExpression_ = "";
 
     //! Value of the memory item.
     QString value_ = "";
 
-    //! The dimension for the memory.
-    QString dimension_ = "";
-
     //! The usage value of the memory item.
     General::Usage usage_{ General::USAGE_COUNT };
 
@@ -439,6 +555,9 @@ private:
     //! The segment reference.
     QString segmentReference_ = "";
 
+    //! The number of sub-elements left uncreated.
+    int collapsedChildCount_ = 0;
+
     //! The sub-elements of the memory.
     QVector<QSharedPointer<MemoryItem> > childItems_;
 };
@@ -127,10 +127,10 @@ void MemoryMapGraphicsItem::setupSubItems(qreal blockXPosition, QSharedPointer<M
 
         for (QSharedPointer<MemoryItem const> subItem : memoryItem->getChildItems())
         {
-            if (subItem->getType().compare(MemoryDesignerConstants::ADDRESSBLOCK_TYPE, Qt::CaseInsensitive) == 0)
+            if (subItem->getKind() == MemoryItem::Kind::ADDRESS_BLOCK)
             {
-                quint64 blockBaseAddress = subItem->getAddress().toULongLong();
-                quint64 blockRange = subItem->getRange().toULongLong();
+                quint64 blockBaseAddress = subItem->getAddressValue();
+                quint64 blockRange = subItem->getRangeValue();
 
                 FilteredBlock blockItem;
                 blockItem.blockName_ = subItem->getName();
@@ -222,6 +222,8 @@ MemoryDesignerChildGraphicsItem* MemoryMapGraphicsItem::createNewSubItem(
 
     connect(childItem, SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)),
         this, SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)), Qt::UniqueConnection);
+    connect(childItem, SIGNAL(expandCollapsedItem(QString const&)),
+        this, SIGNAL(expandCollapsedItem(QString const&)), Qt::UniqueConnection);
 
     return childItem;
 }
@@ -251,6 +253,8 @@ MemoryDesignerChildGraphicsItem* MemoryMapGraphicsItem::createCopyOfSubItem(Memo
     }
 
     connect(childItem, SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)), this, SIGNAL(openComponentDocument(VLNV const&, QVector<QString>)), Qt::UniqueConnection);
+    connect(childItem, SIGNAL(expandCollapsedItem(QString const&)),
+        this, SIGNAL(expandCollapsedItem(QString const&)), Qt::UniqueConnection);
     return childItem;
 }
 
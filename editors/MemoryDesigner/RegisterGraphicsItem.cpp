@@ -27,11 +27,11 @@
 RegisterGraphicsItem::RegisterGraphicsItem(QSharedPointer<MemoryItem const> registerItem, bool isEmptyRegister,
     qreal registerWidth, QVector<QString> identifierChain, bool filterFields,
     QSharedPointer<ConnectivityComponent const> containingInstance, MemoryDesignerGraphicsItem* parentItem):
-MemoryDesignerChildGraphicsItem(registerItem, QStringLiteral("Register"), registerItem->getAddress().toULongLong(),
-    getRegisterEnd(registerItem->getAUB().toUInt(), registerItem->getSize().toULongLong()), registerWidth,
+MemoryDesignerChildGraphicsItem(registerItem, QStringLiteral("Register"), registerItem->getAddressValue(),
+    getRegisterEnd(registerItem->getAUB().toUInt(), registerItem->getSizeValue()), registerWidth,
     identifierChain, containingInstance, parentItem),
 isEmpty_(isEmptyRegister),
-registerSize_(registerItem->getSize().toULongLong()),
+registerSize_(registerItem->getSizeValue()),
 addressUnitBits_(registerItem->getAUB().toUInt()),
 filterFields_(filterFields)
 {
@@ -192,11 +192,11 @@ QMultiMap<quint64, RegisterGraphicsItem::FieldMemoryItem> RegisterGraphicsItem::
 
     for (QSharedPointer<MemoryItem const> fieldItem : registerItem->getChildItems())
     {
-        if (fieldItem->getType().compare(MemoryDesignerConstants::FIELD_TYPE, Qt::CaseInsensitive) == 0)
+        if (fieldItem->getKind() == MemoryItem::Kind::FIELD)
         {
-            quint64 fieldOffset = fieldItem->getOffset().toULongLong();
+            quint64 fieldOffset = fieldItem->getOffsetValue();
 
-            quint64 fieldWidth = fieldItem->getWidth().toULongLong();
+            quint64 fieldWidth = fieldItem->getWidthValue();
             if (fieldWidth > 0)
             {
                 quint64 lastBit = fieldOffset + fieldWidth - 1;
@@ -63,6 +63,33 @@ QSharedPointer<Component> SWConnectionEndpoint::getOwnerComponent() const
     return containingComponent_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: SWConnectionEndpoint::setOwnerComponent()
+//-----------------------------------------------------------------------------
+void SWConnectionEndpoint::setOwnerComponent(QSharedPointer<Component> component)
+{
+    containingComponent_ = component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SWConnectionEndpoint::getEditableOwnerComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> SWConnectionEndpoint::getEditableOwnerComponent()
+{
+    if (parentItem_ != nullptr)
+    {
+        auto parentSW = static_cast<SystemComponentItem*>(parentItem_);
+        parentSW->detachComponentModel();
+
+        if (containingComponent_ != parentSW->componentModel())
+        {
+            setOwnerComponent(parentSW->componentModel());
+        }
+    }
+
+    return containingComponent_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: SWConnectionEndpoint::getNameLabel()
 //-----------------------------------------------------------------------------
@@ -122,8 +122,22 @@ public:
 	 */
 	virtual QSharedPointer<Component> getOwnerComponent() const;
 
+    /*!
+     *  Sets the component that owns this interface.
+     *
+     *    @param [in] component   The new owner component.
+     */
+    virtual void setOwnerComponent(QSharedPointer<Component> component);
+
 protected:
 
+    /*!
+     *  Gets the owner component for modifying it. A shared component is replaced with a private copy first.
+     *
+     *    @return The owner component that can be modified.
+     */
+    QSharedPointer<Component> getEditableOwnerComponent();
+
     /*!
      *  Set the type for the end point.
      *
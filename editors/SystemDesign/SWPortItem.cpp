@@ -137,6 +137,43 @@ QSharedPointer<ApiInterface> SWPortItem::getApiInterface() const
     return apiInterface_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: SWPortItem::setOwnerComponent()
+//-----------------------------------------------------------------------------
+void SWPortItem::setOwnerComponent(QSharedPointer<Component> component)
+{
+    QSharedPointer<Component> previousComponent = getOwnerComponent();
+
+    // Only the interfaces of the previous component have copies in the new one.
+    if (apiInterface_ && previousComponent &&
+        previousComponent->getApiInterface(apiInterface_->name()) == apiInterface_)
+    {
+        if (QSharedPointer<ApiInterface> copiedInterface = component->getApiInterface(apiInterface_->name()))
+        {
+            apiInterface_ = copiedInterface;
+        }
+    }
+
+    if (comInterface_ && previousComponent &&
+        previousComponent->getComInterface(comInterface_->name()) == comInterface_)
+    {
+        if (QSharedPointer<ComInterface> copiedInterface = component->getComInterface(comInterface_->name()))
+        {
+            comInterface_ = copiedInterface;
+        }
+    }
+
+    SWConnectionEndpoint::setOwnerComponent(component);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SWPortItem::prepareInterfaceEdit()
+//-----------------------------------------------------------------------------
+void SWPortItem::prepareInterfaceEdit()
+{
+    getEditableOwnerComponent();
+}
+
 //-----------------------------------------------------------------------------
 // Function: SWPortItem::updateInterface()
 //-----------------------------------------------------------------------------
@@ -289,7 +326,7 @@ bool SWPortItem::onConnect(ConnectionEndpoint const* other)
 
             if (!isInvalid())
             {
-                getOwnerComponent()->getVendorExtensions()->append(apiInterface_);
+                getEditableOwnerComponent()->getVendorExtensions()->append(apiInterface_);
             }
         }
         else if (other->getType() == ENDPOINT_TYPE_COM)
@@ -326,7 +363,7 @@ bool SWPortItem::onConnect(ConnectionEndpoint const* other)
 
             if (!isInvalid())
             {
-                getOwnerComponent()->getVendorExtensions()->append(comInterface_);
+                getEditableOwnerComponent()->getVendorExtensions()->append(comInterface_);
             }
         }
 
@@ -780,7 +817,7 @@ void SWPortItem::setTypeDefinition(VLNV const& type)
             apiInterface_->setName(getNameLabel()->getText());
             apiInterface_->setApiType(type);
 
-            getOwnerComponent()->getVendorExtensions()->append(apiInterface_);
+            getEditableOwnerComponent()->getVendorExtensions()->append(apiInterface_);
 
             setType(ENDPOINT_TYPE_API);
             setTypeLocked(true);
@@ -790,7 +827,7 @@ void SWPortItem::setTypeDefinition(VLNV const& type)
             comInterface_ = QSharedPointer<ComInterface>(new ComInterface());
             comInterface_->setName(getNameLabel()->getText());
             comInterface_->setComType(type);
-            getOwnerComponent()->getVendorExtensions()->append(comInterface_);
+            getEditableOwnerComponent()->getVendorExtensions()->append(comInterface_);
 
             setType(ENDPOINT_TYPE_COM);
             setTypeLocked(true);
@@ -802,7 +839,7 @@ void SWPortItem::setTypeDefinition(VLNV const& type)
         {
             if (!isInvalid())
             {
-                getOwnerComponent()->getVendorExtensions()->removeOne(apiInterface_);
+                getEditableOwnerComponent()->getVendorExtensions()->removeOne(apiInterface_);
             }
 
             apiInterface_.clear();
@@ -812,7 +849,7 @@ void SWPortItem::setTypeDefinition(VLNV const& type)
         {
             if (!isInvalid())
             {
-                getOwnerComponent()->getVendorExtensions()->removeOne(comInterface_);
+                getEditableOwnerComponent()->getVendorExtensions()->removeOne(comInterface_);
             }
 
             comInterface_.clear();
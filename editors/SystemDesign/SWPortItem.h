@@ -192,6 +192,18 @@ public:
      */
     virtual QSharedPointer<ApiInterface> getApiInterface() const;
 
+    /*!
+     *  Sets the component that owns this port and refers to the interface of the same name in it.
+     *
+     *    @param [in] component   The new owner component.
+     */
+    void setOwnerComponent(QSharedPointer<Component> component) override;
+
+    /*!
+     *  Takes a private copy of a shared owner component before the interface is modified.
+     */
+    void prepareInterfaceEdit() override;
+
     /*!
      *  Returns true if the port represents a hierarchical connection.
      */
@@ -15,6 +15,8 @@
 
 #include <common/layouts/VCollisionLayout.h>
 
+#include <editors/common/ComponentSnapshots.h>
+
 #include <IPXACTmodels/Component/Component.h>
 
 #include <IPXACTmodels/Design/ComponentInstance.h>
@@ -168,7 +170,10 @@ SWPortItem* SystemComponentItem::addPort(QPointF const& pos)
 //-----------------------------------------------------------------------------
 void SystemComponentItem::addPort(SWPortItem* port)
 {
+    detachComponentModel();
+
     port->setParentItem(this);
+    port->setOwnerComponent(componentModel());
 
     if (port->getType() == SWPortItem::ENDPOINT_TYPE_API)
     {
@@ -205,6 +210,8 @@ void SystemComponentItem::addPort(SWPortItem* port)
 //-----------------------------------------------------------------------------
 void SystemComponentItem::removePort(SWPortItem* port)
 {
+    detachComponentModel();
+
     leftPorts_.removeAll(port);
     rightPorts_.removeAll(port);
     
@@ -220,6 +227,28 @@ void SystemComponentItem::removePort(SWPortItem* port)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: SystemComponentItem::detachComponentModel()
+//-----------------------------------------------------------------------------
+void SystemComponentItem::detachComponentModel()
+{
+    QSharedPointer<Component> component = ComponentSnapshots::detach(componentModel());
+    if (component == componentModel())
+    {
+        return;
+    }
+
+    setComponentModel(component);
+
+    for (ConnectionEndpoint* endpoint : leftPorts_ + rightPorts_)
+    {
+        if (endpoint->type() == SWPortItem::Type)
+        {
+            static_cast<SWPortItem*>(endpoint)->setOwnerComponent(component);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: setImported()
 //-----------------------------------------------------------------------------
@@ -92,6 +92,12 @@ public:
      */
     void removePort(SWPortItem* port);
 
+    /*!
+     *  Replaces a shared component model with a private copy before the model is modified.
+     *  The ports of the item are moved to the copy.
+     */
+    void detachComponentModel();
+
     /*!
      *  Sets the flag whether the component has been imported or not.
      *
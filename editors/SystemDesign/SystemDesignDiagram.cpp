@@ -30,6 +30,7 @@
 #include <common/graphicsItems/ConnectionUndoCommands.h>
 #include <common/graphicsItems/GraphicsColumnConstants.h>
 
+#include <editors/common/ComponentSnapshots.h>
 #include <editors/common/DiagramUtil.h>
 #include <editors/common/StickyNote/StickyNote.h>
 #include <editors/common/Association/Association.h>
@@ -525,8 +526,7 @@ void SystemDesignDiagram::dragEnterEvent(QGraphicsSceneDragDropEvent * event)
         if (vlnv.getType() == VLNV::COMPONENT)
         {
             // Determine the component type.
-            QSharedPointer<Document> libComp = getLibraryInterface()->getModel(vlnv);
-            QSharedPointer<Component> comp = libComp.staticCast<Component>();
+            QSharedPointer<Component const> comp = getLibraryInterface()->getModelReadOnly<Component>(vlnv);
 
             // component with given vlnv was not found
             if (!comp) {
@@ -606,9 +606,8 @@ void SystemDesignDiagram::dropEvent(QGraphicsSceneDragDropEvent *event)
             return;
         }
 
-        // Retrieve the component model.
-        QSharedPointer<Document> libComp = getLibraryInterface()->getModel(droppedVLNV);
-        QSharedPointer<Component> comp = libComp.staticCast<Component>();
+        // Retrieve the component model. The instances edit their components only after taking a private copy.
+        QSharedPointer<Component> comp = ComponentSnapshots::getSnapshot(getLibraryInterface(), droppedVLNV);
 
         // Set the instance name for the new component instance.
         QString instanceName = createInstanceName(comp->getVlnv().getName());
@@ -1263,11 +1262,11 @@ void SystemDesignDiagram::loadDesign(QSharedPointer<Design> design)
     {
         for (auto const& instance : *design->getComponentInstances())
         {
-            QSharedPointer<Document> libComponent = getLibraryInterface()->getModel(*instance->getComponentRef());
-            QSharedPointer<Component> component = libComponent.staticCast<Component>();
+            QSharedPointer<Component> component =
+                ComponentSnapshots::getSnapshot(getLibraryInterface(), *instance->getComponentRef());
 
             // Only hardware components are applicable in this loop.
-            if (instance->isDraft() || component->getImplementation() != KactusAttribute::HW)
+            if (instance->isDraft() || component.isNull() || component->getImplementation() != KactusAttribute::HW)
             {
                 continue;
             }
@@ -1327,7 +1326,7 @@ void SystemDesignDiagram::loadDesign(QSharedPointer<Design> design)
 
         if (!instance->getComponentRef()->isEmpty())
         {
-             component = getLibraryInterface()->getModel(*instance->getComponentRef()).dynamicCast<Component>();
+             component = ComponentSnapshots::getSnapshot(getLibraryInterface(), *instance->getComponentRef());
 
              if (!component && instance->getComponentRef()->isValid())
              {
@@ -1832,8 +1831,8 @@ void SystemDesignDiagram::importDesign(QSharedPointer<Design> design, IGraphicsI
     // Import SW instances.
     for (QSharedPointer<ComponentInstance> instance : *design->getComponentInstances())
     {
-        QSharedPointer<Document> libComponent = getLibraryInterface()->getModel(*instance->getComponentRef());
-        QSharedPointer<Component> component = libComponent.staticCast<Component>();
+        QSharedPointer<Component> component =
+            ComponentSnapshots::getSnapshot(getLibraryInterface(), *instance->getComponentRef());
 
         if (!component)
         {
@@ -2417,7 +2416,12 @@ void SystemDesignDiagram::copySWInstances(QList<QGraphicsItem*> const& items,
             ComponentInstanceCopyData& instance = collection.instances.back();
 
             // Take a copy of the component model so that we are not influenced by any changes to the original.
-            instance.component = QSharedPointer<Component>(new Component(*comp->componentModel()));
+            // Shared snapshots are never changed, so they can be used as such.
+            instance.component = comp->componentModel();
+            if (!ComponentSnapshots::isShared(instance.component))
+            {
+                instance.component = QSharedPointer<Component>(new Component(*comp->componentModel()));
+            }
 
             QSharedPointer<ComponentInstance> copiedSWInstance = comp->getComponentInstance();
             instance.swInstance = QSharedPointer<ComponentInstance>(new ComponentInstance(*copiedSWInstance));
@@ -2439,9 +2443,9 @@ void SystemDesignDiagram::pasteSWInstances(ComponentCollectionCopyData const col
         QString instanceName = createInstanceName(instanceCopy.swInstance->getInstanceName());
         swInstanceCopy->setInstanceName(instanceName);
 
-        // Take a copy of the component in case of a draft.
+        // Take a copy of the component unless it is a shared snapshot.
         QSharedPointer<Component> component = instanceCopy.component;
-        if (!component->getVlnv().isValid())
+        if (!ComponentSnapshots::isShared(component))
         {
             component = QSharedPointer<Component>(new Component(*instanceCopy.component));
         }
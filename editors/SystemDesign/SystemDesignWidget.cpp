@@ -706,7 +706,10 @@ bool SystemDesignWidget::saveAs()
         writeSucceeded = false;
     }
 
-    getLibHandler()->endSave();
+    if (!getLibHandler()->endSave())
+    {
+        writeSucceeded = false;
+    }
 
     if (writeSucceeded)
     {
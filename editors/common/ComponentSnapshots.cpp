@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// File: ComponentSnapshots.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Shared read-only copies of library components for the component instances in designs.
+//-----------------------------------------------------------------------------
+
+#include "ComponentSnapshots.h"
+
+#include <KactusAPI/include/LibraryInterface.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QMap>
+#include <QSet>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! A snapshot and the library document it was copied from.
+    //-----------------------------------------------------------------------------
+    struct Snapshot
+    {
+        //! The shared copy of the component.
+        QWeakPointer<Component> component;
+
+        //! The library document the copy was taken from.
+        QWeakPointer<Document const> source;
+    };
+
+    //! The latest snapshots by component VLNV. The designs are only edited in the GUI thread.
+    QMap<VLNV, Snapshot> snapshots;
+
+    //! All live snapshots, including the ones replaced by a newer library document but still in use.
+    QSet<Component const*> sharedComponents;
+
+    //-----------------------------------------------------------------------------
+    //! Removes a snapshot from the shared components when its last user releases it.
+    //-----------------------------------------------------------------------------
+    void deleteSnapshot(Component* component)
+    {
+        sharedComponents.remove(component);
+        delete component;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentSnapshots::getSnapshot()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> ComponentSnapshots::getSnapshot(LibraryInterface* library, VLNV const& vlnv)
+{
+    QSharedPointer<Document const> libraryDocument = library->getModelReadOnly(vlnv);
+    QSharedPointer<Component const> libraryComponent = libraryDocument.dynamicCast<Component const>();
+    if (libraryComponent.isNull())
+    {
+        return QSharedPointer<Component>();
+    }
+
+    Snapshot& snapshot = snapshots[vlnv];
+
+    // A new library document means the component has been saved or reloaded, so the old snapshot is stale.
+    QSharedPointer<Component> component = snapshot.component.toStrongRef();
+    if (component.isNull() == false && snapshot.source.toStrongRef() == libraryDocument)
+    {
+        return component;
+    }
+
+    component = QSharedPointer<Component>(new Component(*libraryComponent), deleteSnapshot);
+    sharedComponents.insert(component.data());
+
+    snapshot.component = component;
+    snapshot.source = libraryDocument;
+
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentSnapshots::isShared()
+//-----------------------------------------------------------------------------
+bool ComponentSnapshots::isShared(QSharedPointer<Component> const& component)
+{
+    return sharedComponents.contains(component.data());
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentSnapshots::detach()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> ComponentSnapshots::detach(QSharedPointer<Component> const& component)
+{
+    if (isShared(component) == false)
+    {
+        return component;
+    }
+
+    return QSharedPointer<Component>(new Component(*component));
+}
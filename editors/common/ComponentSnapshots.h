@@ -0,0 +1,59 @@
+//-----------------------------------------------------------------------------
+// File: ComponentSnapshots.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Shared read-only copies of library components for the component instances in designs.
+//-----------------------------------------------------------------------------
+
+#ifndef COMPONENTSNAPSHOTS_H
+#define COMPONENTSNAPSHOTS_H
+
+#include <QSharedPointer>
+
+class Component;
+class LibraryInterface;
+class VLNV;
+
+//-----------------------------------------------------------------------------
+//! Shared read-only copies of library components for the component instances in designs.
+//!
+//! All instances of a component in the open designs share one copy of the component, which lives as long as
+//! any instance refers to it. A snapshot must not be modified: an item changing its component takes a private
+//! copy with detach() first.
+//-----------------------------------------------------------------------------
+namespace ComponentSnapshots
+{
+    /*!
+     *  Gets the shared snapshot of a library component.
+     *
+     *    @param [in] library     The library containing the component.
+     *    @param [in] vlnv        The VLNV of the component.
+     *
+     *    @return The snapshot, or null if the library has no component with the given VLNV.
+     */
+    QSharedPointer<Component> getSnapshot(LibraryInterface* library, VLNV const& vlnv);
+
+    /*!
+     *  Checks if the given component is a shared snapshot.
+     *
+     *    @param [in] component   The component to check.
+     *
+     *    @return True, if the component is shared, otherwise false.
+     */
+    bool isShared(QSharedPointer<Component> const& component);
+
+    /*!
+     *  Gets a component that can be modified in place of the given one.
+     *
+     *    @param [in] component   The component to modify.
+     *
+     *    @return A private copy of the component if it is a shared snapshot, otherwise the component itself.
+     */
+    QSharedPointer<Component> detach(QSharedPointer<Component> const& component);
+};
+
+#endif // COMPONENTSNAPSHOTS_H
@@ -16,14 +16,17 @@
 #include <common/IEditProvider.h>
 
 #include <KactusAPI/include/KactusColors.h>
+#include <KactusAPI/include/TraceRecorder.h>
 
 #include <common/graphicsItems/ComponentItem.h>
+#include <common/graphicsItems/GraphicsConnection.h>
 #include <common/graphicsItems/GraphicsColumnLayout.h>
 #include <common/graphicsItems/ConnectionEndpoint.h>
 #include <common/graphicsItems/GraphicsColumnConstants.h>
 
 #include <editors/common/Association/Association.h>
 #include <editors/common/diagramgrid.h>
+#include <editors/common/DefaultRouting.h>
 #include <editors/common/StickyNote/StickyNote.h>
 #include <editors/common/StickyNote/StickyNoteAddCommand.h>
 #include <editors/HWDesign/AdhocEditor/AdHocVisibilityEditor.h>
@@ -41,6 +44,7 @@
 #include <QGraphicsItem>
 #include <QMenu>
 #include <QPainter>
+#include <QSet>
 #include <QSharedPointer>
 #include <QWidget>
 
@@ -86,6 +90,10 @@ void DesignDiagram::clearScene()
 {
     clearLayout();
     clear();    
+
+    connectionRouter_.clearRoutes();
+    routeIds_.clear();
+    scheduledRoutes_.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -120,6 +128,7 @@ bool DesignDiagram::setDesign(QSharedPointer<Component> component, QString const
     loading_ = true;
     loadDesign(design);
     loadStickyNotes();
+    routeScheduledConnections();
 
     resetSceneRectangleForItems();
 
@@ -517,6 +526,52 @@ DesignWidget* DesignDiagram::getParent() const
     return parent_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::createConnectionRoute()
+//-----------------------------------------------------------------------------
+QList<QPointF> DesignDiagram::createConnectionRoute(GraphicsConnection* connection, QPointF const& start,
+    QVector2D const& startDirection, QPointF const& end, QVector2D const& endDirection)
+{
+    // All the connections are routed at once after loading, when the instances are in their final positions.
+    if (loading_)
+    {
+        scheduledRoutes_.append(connection);
+        return DefaultRouting::createRoute(start, end, startDirection, endDirection);
+    }
+
+    OrthogonalRouter::RouteRequest request;
+    request.routeId = routeIds_.value(connection, -1);
+    request.start = start;
+    request.startDirection = startDirection;
+    request.end = end;
+    request.endDirection = endDirection;
+
+    qreal const searchMargin = 2 * GraphicsColumnConstants::COMPONENT_COLUMN_WIDTH;
+    connectionRouter_.setObstacles(findRoutingObstacles(
+        QRectF(start, end).normalized().adjusted(-searchMargin, -searchMargin, searchMargin, searchMargin)));
+
+    return connectionRouter_.route(request);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::updateRoutingIndex()
+//-----------------------------------------------------------------------------
+void DesignDiagram::updateRoutingIndex(GraphicsConnection* connection)
+{
+    connectionRouter_.setRoute(getRouteId(connection), connection->route());
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::removeFromRoutingIndex()
+//-----------------------------------------------------------------------------
+void DesignDiagram::removeFromRoutingIndex(GraphicsConnection* connection)
+{
+    if (routeIds_.contains(connection))
+    {
+        connectionRouter_.removeRoute(routeIds_.take(connection));
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignDiagram::ensureOneTypeSelected()
 //-----------------------------------------------------------------------------
@@ -696,6 +751,89 @@ QString DesignDiagram::adHocIdentifier() const
     return tr("top-level");
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::routeScheduledConnections()
+//-----------------------------------------------------------------------------
+void DesignDiagram::routeScheduledConnections()
+{
+    TRACE_SCOPE("design", "DesignDiagram::routeScheduledConnections");
+
+    QVector<QRectF> obstacles;
+    for (ComponentItem* instance : getInstances())
+    {
+        obstacles.append(instance->sceneBoundingRect());
+    }
+    connectionRouter_.setObstacles(obstacles);
+
+    QSet<GraphicsConnection*> scheduled;
+    QList<GraphicsConnection*> connections;
+    QList<OrthogonalRouter::RouteRequest> requests;
+    for (GraphicsConnection* connection : scheduledRoutes_)
+    {
+        if (connection != nullptr && scheduled.contains(connection) == false &&
+            connection->endpoint1() != nullptr && connection->endpoint2() != nullptr &&
+            connection->getRoutingMode() == GraphicsConnection::ROUTING_MODE_NORMAL)
+        {
+            scheduled.insert(connection);
+            connections.append(connection);
+            requests.append(createRouteRequest(connection));
+        }
+    }
+    scheduledRoutes_.clear();
+
+    QList<QList<QPointF> > routes = connectionRouter_.routeAll(requests);
+    for (int i = 0; i < connections.size(); ++i)
+    {
+        connections.at(i)->setRoute(routes.at(i));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::findRoutingObstacles()
+//-----------------------------------------------------------------------------
+QVector<QRectF> DesignDiagram::findRoutingObstacles(QRectF const& area) const
+{
+    QVector<QRectF> obstacles;
+    for (QGraphicsItem* item : items(area))
+    {
+        if (dynamic_cast<ComponentItem*>(item) != nullptr)
+        {
+            obstacles.append(item->sceneBoundingRect());
+        }
+    }
+
+    return obstacles;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::createRouteRequest()
+//-----------------------------------------------------------------------------
+OrthogonalRouter::RouteRequest DesignDiagram::createRouteRequest(GraphicsConnection* connection)
+{
+    OrthogonalRouter::RouteRequest request;
+    request.routeId = getRouteId(connection);
+    request.start = connection->endpoint1()->scenePos();
+    request.startDirection = connection->endpoint1()->getDirection();
+    request.end = connection->endpoint2()->scenePos();
+    request.endDirection = connection->endpoint2()->getDirection();
+
+    return request;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::getRouteId()
+//-----------------------------------------------------------------------------
+int DesignDiagram::getRouteId(GraphicsConnection* connection)
+{
+    auto routeId = routeIds_.find(connection);
+    if (routeId == routeIds_.end())
+    {
+        routeId = routeIds_.insert(connection, nextRouteId_++);
+    }
+
+    return *routeId;
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignDiagram::updateAssociationCursor()
 //-----------------------------------------------------------------------------
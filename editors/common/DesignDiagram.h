@@ -14,6 +14,7 @@
 
 #include <editors/HWDesign/AdHocEnabled.h>
 #include <editors/common/DrawMode.h>
+#include <editors/common/OrthogonalRouter.h>
 
 #include <IPXACTmodels/DesignConfiguration/DesignConfiguration.h>
 
@@ -22,7 +23,9 @@
 #include <QAction>
 #include <QGraphicsScene>
 #include <QGraphicsSceneContextMenuEvent>
+#include <QHash>
 #include <QMenu>
+#include <QPointer>
 #include <QSharedPointer>
 #include <QStringList>
 #include <QUndoCommand>
@@ -211,6 +214,37 @@ public:
      */
     QList<ComponentItem*> getInstances() const;
 
+    /*!
+     *  Creates a route for a connection avoiding the component instances and the other connections.
+     *
+     *    While the design is being loaded, a default route is returned and the connection is routed together with
+     *    the other connections once the whole design has been loaded.
+     *
+     *    @param [in] connection          The connection to route.
+     *    @param [in] start               The start point of the route.
+     *    @param [in] startDirection      The direction in which the route exits the start point.
+     *    @param [in] end                 The end point of the route.
+     *    @param [in] endDirection        The direction in which the route exits the end point.
+     *
+     *    @return The route points.
+     */
+    QList<QPointF> createConnectionRoute(GraphicsConnection* connection, QPointF const& start,
+        QVector2D const& startDirection, QPointF const& end, QVector2D const& endDirection);
+
+    /*!
+     *  Stores the current route of a connection in the routing index.
+     *
+     *    @param [in] connection  The connection whose route to store.
+     */
+    void updateRoutingIndex(GraphicsConnection* connection);
+
+    /*!
+     *  Removes a connection from the routing index.
+     *
+     *    @param [in] connection  The connection to remove.
+     */
+    void removeFromRoutingIndex(GraphicsConnection* connection);
+
     /*!
      *  Ensures that all items in a given list have the same type. Items with different type are unselected.
      *
@@ -532,6 +566,36 @@ private:
     //! Enables/disables the sticky notes according to design protection state.
     void setProtectionForStickyNotes();
 
+    //! Routes the connections created while loading the design.
+    void routeScheduledConnections();
+
+    /*!
+     *  Finds the bounding rectangles of the component instances inside the given area.
+     *
+     *    @param [in] area    The area to search.
+     *
+     *    @return The bounding rectangles of the found instances.
+     */
+    QVector<QRectF> findRoutingObstacles(QRectF const& area) const;
+
+    /*!
+     *  Creates a routing request for the given connection using its current endpoints.
+     *
+     *    @param [in] connection  The connection to route.
+     *
+     *    @return The routing request.
+     */
+    OrthogonalRouter::RouteRequest createRouteRequest(GraphicsConnection* connection);
+
+    /*!
+     *  Gets the identifier of a connection in the routing index, creating a new one if necessary.
+     *
+     *    @param [in] connection  The connection whose identifier to get.
+     *
+     *    @return The identifier of the connection.
+     */
+    int getRouteId(GraphicsConnection* connection);
+
     /*!
      *  Get the names of the contained component instances.
      *
@@ -579,6 +643,18 @@ private:
     interactionMode interactionMode_;
 
     QGraphicsLineItem* associationLine_;
+
+    //! The router for the connections, containing the routes of all connections in the design.
+    OrthogonalRouter connectionRouter_;
+
+    //! The identifiers of the connections in the routing index.
+    QHash<GraphicsConnection*, int> routeIds_;
+
+    //! The identifier for the next connection added to the routing index.
+    int nextRouteId_ = 0;
+
+    //! The connections to route once the design has been loaded.
+    QList<QPointer<GraphicsConnection> > scheduledRoutes_;
 };
 
 //-----------------------------------------------------------------------------
@@ -262,7 +262,10 @@ bool DesignWidget::save()
         writeSucceeded = false;
     }
 
-    getLibHandler()->endSave();
+    if (!getLibHandler()->endSave())
+    {
+        writeSucceeded = false;
+    }
 
     if (writeSucceeded)
     {
@@ -235,6 +235,7 @@ void InterfaceEditor::onInterfaceNameChanged(QString const& newName)
 	Q_ASSERT(interface_);
 	
     disconnect(interface_, SIGNAL(contentChanged()), this, SLOT(refresh()));	
+    interface_->prepareInterfaceEdit();
 
 	QSharedPointer<QUndoCommand> cmd(new EndpointNameChangeCommand(interface_, newName, getDesignInterfaces()));
 	editProvider_->addCommand(cmd);
@@ -265,6 +266,7 @@ void InterfaceEditor::onDescriptionChanged()
     }
 
 	disconnect(interface_, SIGNAL(contentChanged()), this, SLOT(refresh()));
+    interface_->prepareInterfaceEdit();
 
 	QSharedPointer<QUndoCommand> cmd(new EndpointDescChangeCommand(interface_, interfaceDescription));
 	editProvider_->addCommand(cmd);
@@ -279,6 +281,7 @@ void InterfaceEditor::onDescriptionChanged()
 void InterfaceEditor::onDependencyDirectionChanged(QString const& newDir)
 {
     disconnect(interface_, SIGNAL(contentChanged()), this, SLOT(refresh()));
+    interface_->prepareInterfaceEdit();
 
     QSharedPointer<QUndoCommand> cmd(new EndpointDependencyDirectionChangeCommand(interface_,
         str2DependencyDirection(newDir, DEPENDENCY_PROVIDER)));
@@ -295,6 +298,7 @@ void InterfaceEditor::onDependencyDirectionChanged(QString const& newDir)
 void InterfaceEditor::onComDirectionChanged(QString const& newDir)
 {
     disconnect(interface_, SIGNAL(contentChanged()), this, SLOT(refresh()));
+    interface_->prepareInterfaceEdit();
 
     QSharedPointer<QUndoCommand> cmd(new EndpointComDirectionChangeCommand(interface_,
         DirectionTypes::str2Direction(newDir, DirectionTypes::IN)));
@@ -311,6 +315,7 @@ void InterfaceEditor::onComDirectionChanged(QString const& newDir)
 void InterfaceEditor::onComTransferTypeChanged(QString const& newTransferType)
 {
     disconnect(interface_, SIGNAL(contentChanged()), this, SLOT(refresh()));
+    interface_->prepareInterfaceEdit();
 
     QSharedPointer<QUndoCommand> cmd(new EndpointTransferTypeChangeCommand(interface_, newTransferType));
     editProvider_->addCommand(cmd);
@@ -325,6 +330,7 @@ void InterfaceEditor::onComTransferTypeChanged(QString const& newTransferType)
 void InterfaceEditor::onComPropertyValuesChanged()
 {
     disconnect(interface_, SIGNAL(contentChanged()), this, SLOT(refresh()));
+    interface_->prepareInterfaceEdit();
 
     QSharedPointer<QUndoCommand> cmd(new EndpointPropertyValuesChangeCommand(interface_,
         propertyValueEditor_.getData()));
@@ -0,0 +1,871 @@
+//-----------------------------------------------------------------------------
+// File: OrthogonalRouter.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Obstacle-aware orthogonal routing for design connections.
+//-----------------------------------------------------------------------------
+
+#include "OrthogonalRouter.h"
+
+#include "DefaultRouting.h"
+
+#include <QtMath>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <vector>
+
+namespace
+{
+    //! Size of the cells in the spatial indices.
+    qreal const CELL_SIZE = 160.0;
+
+    //! Cost of a single bend in the route.
+    qreal const BEND_PENALTY = 40.0;
+
+    //! Cost of crossing a stored route.
+    qreal const CROSSING_PENALTY = 60.0;
+
+    //! Cost multiplier for the length running on top of a stored route.
+    qreal const OVERLAP_PENALTY = 3.0;
+
+    //! Margin around the route endpoints included in the routing grid.
+    qreal const SEARCH_MARGIN = 60.0;
+
+    //! Maximum number of times the routing area is grown to contain the nearby obstacles.
+    int const MAX_AREA_EXPANSIONS = 3;
+
+    //! Maximum number of obstacles a route stub is moved past.
+    int const MAX_ESCAPE_STEPS = 16;
+
+    //! Tolerance for comparing coordinates.
+    qreal const TOLERANCE = 0.01;
+
+    //! The routing directions: right, down, left and up.
+    QPointF const DIRECTIONS[4] = { QPointF(1, 0), QPointF(0, 1), QPointF(-1, 0), QPointF(0, -1) };
+
+    /*!
+     *  Converts a direction vector to the closest routing direction.
+     *
+     *    @param [in] direction   The direction vector.
+     *    @param [in] fallback    The vector to use, if the direction is not set.
+     *
+     *    @return Index of the routing direction.
+     */
+    int toDirection(QVector2D const& direction, QPointF const& fallback);
+
+    /*!
+     *  Aligns a coordinate to the grid.
+     *
+     *    @param [in] value       The coordinate to align.
+     *    @param [in] gridSize    The grid size.
+     *    @param [in] upwards     If true, the coordinate is rounded up, otherwise down.
+     *
+     *    @return The aligned coordinate.
+     */
+    qreal alignToGrid(qreal value, qreal gridSize, bool upwards);
+
+    /*!
+     *  Sorts the given coordinates and removes the duplicates.
+     *
+     *    @param [in/out] coordinates     The coordinates to sort.
+     */
+    void sortUnique(QVector<qreal>& coordinates);
+
+    /*!
+     *  Checks if a point is strictly inside a rectangle.
+     *
+     *    @param [in] rectangle   The rectangle to check.
+     *    @param [in] point       The point to check.
+     *
+     *    @return True, if the point is inside the rectangle and not on its edge.
+     */
+    bool isInside(QRectF const& rectangle, QPointF const& point);
+
+    /*!
+     *  Checks if an axis-aligned segment passes through the inside of a rectangle.
+     *
+     *    @param [in] rectangle   The rectangle to check.
+     *    @param [in] first       The first point of the segment.
+     *    @param [in] second      The second point of the segment.
+     *
+     *    @return True, if the segment passes through the rectangle.
+     */
+    bool passesThrough(QRectF const& rectangle, QPointF const& first, QPointF const& second);
+
+    /*!
+     *  Checks if a line is horizontal or vertical.
+     *
+     *    @param [in] line    The line to check.
+     *
+     *    @return 0 for horizontal, 1 for vertical and -1 for other lines.
+     */
+    int getOrientation(QLineF const& line);
+
+    /*!
+     *  Checks if a segment crosses another segment.
+     *
+     *    @param [in] line            The segment to check.
+     *    @param [in] other           The other segment.
+     *    @param [in] includeStart    If true, a crossing at the start of the segment is also counted.
+     *
+     *    @return True, if the segments cross.
+     */
+    bool crosses(QLineF const& line, QLineF const& other, bool includeStart);
+
+    /*!
+     *  Calculates the length a segment runs on top of another segment.
+     *
+     *    @param [in] line    The segment to check.
+     *    @param [in] other   The other segment.
+     *
+     *    @return The overlapping length.
+     */
+    qreal overlapLength(QLineF const& line, QLineF const& other);
+
+    /*!
+     *  Removes the duplicate and collinear points from a route.
+     *
+     *    @param [in] route   The route points.
+     *
+     *    @return The simplified route.
+     */
+    QList<QPointF> simplifyRoute(QList<QPointF> const& route);
+
+    //-----------------------------------------------------------------------------
+    // Function: toDirection()
+    //-----------------------------------------------------------------------------
+    int toDirection(QVector2D const& direction, QPointF const& fallback)
+    {
+        QPointF vector = direction.isNull() ? QPointF(fallback.x(), 0) : direction.toPointF();
+
+        if (qAbs(vector.x()) >= qAbs(vector.y()))
+        {
+            return vector.x() >= 0 ? 0 : 2;
+        }
+
+        return vector.y() >= 0 ? 1 : 3;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: alignToGrid()
+    //-----------------------------------------------------------------------------
+    qreal alignToGrid(qreal value, qreal gridSize, bool upwards)
+    {
+        if (upwards)
+        {
+            return qCeil(value / gridSize) * gridSize;
+        }
+
+        return qFloor(value / gridSize) * gridSize;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: sortUnique()
+    //-----------------------------------------------------------------------------
+    void sortUnique(QVector<qreal>& coordinates)
+    {
+        std::sort(coordinates.begin(), coordinates.end());
+        coordinates.erase(std::unique(coordinates.begin(), coordinates.end(),
+            [](qreal first, qreal second) { return qAbs(first - second) < TOLERANCE; }), coordinates.end());
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: isInside()
+    //-----------------------------------------------------------------------------
+    bool isInside(QRectF const& rectangle, QPointF const& point)
+    {
+        return point.x() > rectangle.left() + TOLERANCE && point.x() < rectangle.right() - TOLERANCE &&
+            point.y() > rectangle.top() + TOLERANCE && point.y() < rectangle.bottom() - TOLERANCE;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: passesThrough()
+    //-----------------------------------------------------------------------------
+    bool passesThrough(QRectF const& rectangle, QPointF const& first, QPointF const& second)
+    {
+        qreal left = qMax(qMin(first.x(), second.x()), rectangle.left());
+        qreal right = qMin(qMax(first.x(), second.x()), rectangle.right());
+        qreal top = qMax(qMin(first.y(), second.y()), rectangle.top());
+        qreal bottom = qMin(qMax(first.y(), second.y()), rectangle.bottom());
+
+        if (qAbs(first.y() - second.y()) < TOLERANCE)
+        {
+            return right - left > TOLERANCE &&
+                first.y() > rectangle.top() + TOLERANCE && first.y() < rectangle.bottom() - TOLERANCE;
+        }
+
+        return bottom - top > TOLERANCE &&
+            first.x() > rectangle.left() + TOLERANCE && first.x() < rectangle.right() - TOLERANCE;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: getOrientation()
+    //-----------------------------------------------------------------------------
+    int getOrientation(QLineF const& line)
+    {
+        if (qAbs(line.dy()) < TOLERANCE)
+        {
+            return 0;
+        }
+        else if (qAbs(line.dx()) < TOLERANCE)
+        {
+            return 1;
+        }
+
+        return -1;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: crosses()
+    //-----------------------------------------------------------------------------
+    bool crosses(QLineF const& line, QLineF const& other, bool includeStart)
+    {
+        int orientation = getOrientation(line);
+        int otherOrientation = getOrientation(other);
+
+        if (orientation == -1 || otherOrientation == -1)
+        {
+            return line.intersects(other, nullptr) == QLineF::BoundedIntersection;
+        }
+
+        if (orientation == otherOrientation)
+        {
+            return false;
+        }
+
+        // Coordinates along the line and along the other segment.
+        bool horizontal = orientation == 0;
+        qreal lineStart = horizontal ? line.x1() : line.y1();
+        qreal lineEnd = horizontal ? line.x2() : line.y2();
+        qreal lineLevel = horizontal ? line.y1() : line.x1();
+        qreal otherStart = horizontal ? other.y1() : other.x1();
+        qreal otherEnd = horizontal ? other.y2() : other.x2();
+        qreal otherLevel = horizontal ? other.x1() : other.y1();
+
+        if (lineLevel <= qMin(otherStart, otherEnd) + TOLERANCE || lineLevel >= qMax(otherStart, otherEnd) - TOLERANCE)
+        {
+            return false;
+        }
+
+        qreal distanceFromStart = (otherLevel - lineStart) * (lineEnd > lineStart ? 1 : -1);
+        qreal length = qAbs(lineEnd - lineStart);
+
+        if (includeStart)
+        {
+            return distanceFromStart > -TOLERANCE && distanceFromStart < length - TOLERANCE;
+        }
+
+        return distanceFromStart > TOLERANCE && distanceFromStart < length - TOLERANCE;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: overlapLength()
+    //-----------------------------------------------------------------------------
+    qreal overlapLength(QLineF const& line, QLineF const& other)
+    {
+        int orientation = getOrientation(line);
+        if (orientation == -1 || orientation != getOrientation(other))
+        {
+            return 0;
+        }
+
+        bool horizontal = orientation == 0;
+        if (qAbs((horizontal ? line.y1() - other.y1() : line.x1() - other.x1())) > TOLERANCE)
+        {
+            return 0;
+        }
+
+        qreal lineStart = horizontal ? qMin(line.x1(), line.x2()) : qMin(line.y1(), line.y2());
+        qreal lineEnd = horizontal ? qMax(line.x1(), line.x2()) : qMax(line.y1(), line.y2());
+        qreal otherStart = horizontal ? qMin(other.x1(), other.x2()) : qMin(other.y1(), other.y2());
+        qreal otherEnd = horizontal ? qMax(other.x1(), other.x2()) : qMax(other.y1(), other.y2());
+
+        return qMax<qreal>(0, qMin(lineEnd, otherEnd) - qMax(lineStart, otherStart));
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: simplifyRoute()
+    //-----------------------------------------------------------------------------
+    QList<QPointF> simplifyRoute(QList<QPointF> const& route)
+    {
+        QList<QPointF> simplified;
+        for (QPointF const& point : route)
+        {
+            if (simplified.isEmpty() == false && (simplified.last() - point).manhattanLength() < TOLERANCE)
+            {
+                continue;
+            }
+
+            if (simplified.size() >= 2)
+            {
+                QPointF const& previous = simplified.at(simplified.size() - 2);
+                QPointF const& middle = simplified.last();
+
+                bool sameX = qAbs(previous.x() - middle.x()) < TOLERANCE && qAbs(middle.x() - point.x()) < TOLERANCE;
+                bool sameY = qAbs(previous.y() - middle.y()) < TOLERANCE && qAbs(middle.y() - point.y()) < TOLERANCE;
+                if (sameX || sameY)
+                {
+                    simplified.removeLast();
+                }
+            }
+
+            simplified.append(point);
+        }
+
+        return simplified;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::OrthogonalRouter()
+//-----------------------------------------------------------------------------
+OrthogonalRouter::OrthogonalRouter(qreal gridSize):
+gridSize_(gridSize),
+clearance_(DefaultRouting::MIN_START_LENGTH)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::setObstacles()
+//-----------------------------------------------------------------------------
+void OrthogonalRouter::setObstacles(QVector<QRectF> const& obstacles)
+{
+    obstacles_ = obstacles;
+    obstacleCells_.clear();
+    obstacleStamps_.fill(0, obstacles_.size());
+
+    for (int i = 0; i < obstacles_.size(); ++i)
+    {
+        for (qint64 cell : cellsCovering(obstacles_.at(i)))
+        {
+            obstacleCells_[cell].append(i);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::setRoute()
+//-----------------------------------------------------------------------------
+void OrthogonalRouter::setRoute(int routeId, QList<QPointF> const& route)
+{
+    removeRoute(routeId);
+
+    QVector<int> indices;
+    for (int i = 0; i < route.size() - 1; ++i)
+    {
+        QLineF line(route.at(i), route.at(i + 1));
+        if (line.isNull())
+        {
+            continue;
+        }
+
+        int index = 0;
+        if (freeSegments_.isEmpty() == false)
+        {
+            index = freeSegments_.takeLast();
+        }
+        else
+        {
+            index = segments_.size();
+            segments_.append(Segment());
+        }
+
+        segments_[index].line = line;
+        segments_[index].routeId = routeId;
+        indices.append(index);
+
+        for (qint64 cell : cellsCovering(QRectF(line.p1(), line.p2()).normalized()))
+        {
+            segmentCells_[cell].append(index);
+        }
+    }
+
+    routeSegments_.insert(routeId, indices);
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::removeRoute()
+//-----------------------------------------------------------------------------
+void OrthogonalRouter::removeRoute(int routeId)
+{
+    auto route = routeSegments_.find(routeId);
+    if (route == routeSegments_.end())
+    {
+        return;
+    }
+
+    for (int index : *route)
+    {
+        Segment& segment = segments_[index];
+        for (qint64 cell : cellsCovering(QRectF(segment.line.p1(), segment.line.p2()).normalized()))
+        {
+            auto cellSegments = segmentCells_.find(cell);
+            if (cellSegments != segmentCells_.end())
+            {
+                cellSegments->removeOne(index);
+                if (cellSegments->isEmpty())
+                {
+                    segmentCells_.erase(cellSegments);
+                }
+            }
+        }
+
+        segment.routeId = -1;
+        freeSegments_.append(index);
+    }
+
+    routeSegments_.erase(route);
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::clearRoutes()
+//-----------------------------------------------------------------------------
+void OrthogonalRouter::clearRoutes()
+{
+    segments_.clear();
+    freeSegments_.clear();
+    routeSegments_.clear();
+    segmentCells_.clear();
+    segmentStamps_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::getRouteCount()
+//-----------------------------------------------------------------------------
+int OrthogonalRouter::getRouteCount() const
+{
+    return routeSegments_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::route()
+//-----------------------------------------------------------------------------
+QList<QPointF> OrthogonalRouter::route(RouteRequest const& request) const
+{
+    if (request.start == request.end)
+    {
+        return QList<QPointF>({ request.start });
+    }
+
+    int const startDirection = toDirection(request.startDirection, request.end - request.start);
+    int const endDirection = toDirection(request.endDirection, request.start - request.end);
+    int const arrivalDirection = (endDirection + 2) % 4;
+
+    QPointF const startStub = escapeObstacles(request.start + DIRECTIONS[startDirection] * clearance_,
+        DIRECTIONS[startDirection]);
+    QPointF const endStub = escapeObstacles(request.end + DIRECTIONS[endDirection] * clearance_,
+        DIRECTIONS[endDirection]);
+
+    RoutingGrid const grid = createGrid(startStub, endStub);
+    int const columns = grid.xs.size();
+    int const rows = grid.ys.size();
+    int const nodeCount = columns * rows;
+
+    auto nodeIndex = [&grid, rows](QPointF const& point)
+    {
+        int column = std::lower_bound(grid.xs.begin(), grid.xs.end(), point.x() - TOLERANCE) - grid.xs.begin();
+        int row = std::lower_bound(grid.ys.begin(), grid.ys.end(), point.y() - TOLERANCE) - grid.ys.begin();
+        return column * rows + row;
+    };
+
+    auto nodePoint = [&grid, rows](int node)
+    {
+        return QPointF(grid.xs.at(node / rows), grid.ys.at(node % rows));
+    };
+
+    int const startNode = nodeIndex(startStub);
+    int const endNode = nodeIndex(endStub);
+
+    QVector<bool> blocked(nodeCount, false);
+    for (int node = 0; node < nodeCount; ++node)
+    {
+        QPointF point = nodePoint(node);
+        for (QRectF const& obstacle : grid.obstacles)
+        {
+            if (isInside(obstacle, point))
+            {
+                blocked[node] = true;
+                break;
+            }
+        }
+    }
+
+    // Search states are nodes combined with the arrival direction. The last state is the final goal.
+    int const goalState = nodeCount * 4;
+    QVector<qreal> costs(goalState + 1, std::numeric_limits<qreal>::max());
+    QVector<int> previous(goalState + 1, -1);
+    QVector<bool> closed(goalState + 1, false);
+
+    using QueueItem = std::pair<qreal, int>;
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem> > open;
+
+    int const startState = startNode * 4 + startDirection;
+    costs[startState] = 0;
+    open.push(QueueItem((endStub - startStub).manhattanLength(), startState));
+
+    while (open.empty() == false && closed.at(goalState) == false)
+    {
+        int const state = open.top().second;
+        open.pop();
+
+        if (closed.at(state))
+        {
+            continue;
+        }
+        closed[state] = true;
+
+        if (state == goalState)
+        {
+            break;
+        }
+
+        int const node = state / 4;
+        int const direction = state % 4;
+        qreal const cost = costs.at(state);
+        QPointF const point = nodePoint(node);
+
+        if (node == endNode)
+        {
+            qreal goalCost = cost + (direction != arrivalDirection ? BEND_PENALTY : 0);
+            if (goalCost < costs.at(goalState))
+            {
+                costs[goalState] = goalCost;
+                previous[goalState] = state;
+                open.push(QueueItem(goalCost, goalState));
+            }
+        }
+
+        int const column = node / rows;
+        int const row = node % rows;
+
+        for (int next = 0; next < 4; ++next)
+        {
+            if (next == (direction + 2) % 4)
+            {
+                continue;
+            }
+
+            int const nextColumn = column + qRound(DIRECTIONS[next].x());
+            int const nextRow = row + qRound(DIRECTIONS[next].y());
+            if (nextColumn < 0 || nextColumn >= columns || nextRow < 0 || nextRow >= rows)
+            {
+                continue;
+            }
+
+            int const nextNode = nextColumn * rows + nextRow;
+            if (blocked.at(nextNode) && nextNode != endNode)
+            {
+                continue;
+            }
+
+            QPointF const nextPoint = nodePoint(nextNode);
+            bool edgeBlocked = std::any_of(grid.obstacles.cbegin(), grid.obstacles.cend(),
+                [&point, &nextPoint](QRectF const& obstacle) { return passesThrough(obstacle, point, nextPoint); });
+
+            if (edgeBlocked)
+            {
+                continue;
+            }
+
+            qreal nextCost = cost + (nextPoint - point).manhattanLength() +
+                (next != direction ? BEND_PENALTY : 0) + segmentPenalty(QLineF(point, nextPoint), request.routeId);
+
+            int const nextState = nextNode * 4 + next;
+            if (nextCost < costs.at(nextState))
+            {
+                costs[nextState] = nextCost;
+                previous[nextState] = state;
+                open.push(QueueItem(nextCost + (endStub - nextPoint).manhattanLength(), nextState));
+            }
+        }
+    }
+
+    if (closed.at(goalState) == false)
+    {
+        return DefaultRouting::createRoute(request.start, request.end,
+            QVector2D(DIRECTIONS[startDirection]), QVector2D(DIRECTIONS[endDirection]));
+    }
+
+    QList<QPointF> path;
+    path.prepend(request.end);
+    for (int state = previous.at(goalState); state != -1; state = previous.at(state))
+    {
+        path.prepend(nodePoint(state / 4));
+    }
+    path.prepend(request.start);
+
+    return simplifyRoute(path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::routeAll()
+//-----------------------------------------------------------------------------
+QList<QList<QPointF> > OrthogonalRouter::routeAll(QList<RouteRequest> const& requests)
+{
+    QVector<int> order(requests.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&requests](int first, int second)
+        {
+            return (requests.at(first).end - requests.at(first).start).manhattanLength() <
+                (requests.at(second).end - requests.at(second).start).manhattanLength();
+        });
+
+    QList<QList<QPointF> > routes;
+    routes.reserve(requests.size());
+    for (int i = 0; i < requests.size(); ++i)
+    {
+        routes.append(QList<QPointF>());
+    }
+
+    // Routes without an identifier are stored temporarily, so that the following routes avoid them.
+    QVector<int> temporaryIds;
+    for (int index : order)
+    {
+        RouteRequest request = requests.at(index);
+        if (request.routeId < 0)
+        {
+            request.routeId = -2 - index;
+            temporaryIds.append(request.routeId);
+        }
+
+        routes[index] = route(request);
+        setRoute(request.routeId, routes.at(index));
+    }
+
+    for (int routeId : temporaryIds)
+    {
+        removeRoute(routeId);
+    }
+
+    return routes;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::countCrossings()
+//-----------------------------------------------------------------------------
+int OrthogonalRouter::countCrossings(QList<QPointF> const& route, int ignoredRouteId) const
+{
+    int crossings = 0;
+    for (int i = 0; i < route.size() - 1; ++i)
+    {
+        QLineF line(route.at(i), route.at(i + 1));
+        forEachSegmentNear(line, ignoredRouteId, [&line, &crossings](QLineF const& other)
+            {
+                if (crosses(line, other, false))
+                {
+                    ++crossings;
+                }
+            });
+    }
+
+    return crossings;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::findObstacles()
+//-----------------------------------------------------------------------------
+QVector<int> OrthogonalRouter::findObstacles(QRectF const& area) const
+{
+    ++currentStamp_;
+
+    QVector<int> found;
+    for (qint64 cell : cellsCovering(area))
+    {
+        auto cellObstacles = obstacleCells_.constFind(cell);
+        if (cellObstacles == obstacleCells_.cend())
+        {
+            continue;
+        }
+
+        for (int index : *cellObstacles)
+        {
+            if (obstacleStamps_.at(index) != currentStamp_)
+            {
+                obstacleStamps_[index] = currentStamp_;
+                if (obstacles_.at(index).intersects(area))
+                {
+                    found.append(index);
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::escapeObstacles()
+//-----------------------------------------------------------------------------
+QPointF OrthogonalRouter::escapeObstacles(QPointF const& point, QPointF const& direction) const
+{
+    QPointF escaped = point;
+    for (int step = 0; step < MAX_ESCAPE_STEPS; ++step)
+    {
+        bool moved = false;
+        for (int index : findObstacles(QRectF(escaped - QPointF(1, 1), QSizeF(2, 2))))
+        {
+            QRectF const& obstacle = obstacles_.at(index);
+            if (isInside(obstacle, escaped))
+            {
+                if (direction.x() > 0)
+                {
+                    escaped.setX(alignToGrid(obstacle.right() + clearance_, gridSize_, true));
+                }
+                else if (direction.x() < 0)
+                {
+                    escaped.setX(alignToGrid(obstacle.left() - clearance_, gridSize_, false));
+                }
+                else if (direction.y() > 0)
+                {
+                    escaped.setY(alignToGrid(obstacle.bottom() + clearance_, gridSize_, true));
+                }
+                else
+                {
+                    escaped.setY(alignToGrid(obstacle.top() - clearance_, gridSize_, false));
+                }
+
+                moved = true;
+                break;
+            }
+        }
+
+        if (moved == false)
+        {
+            break;
+        }
+    }
+
+    return escaped;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::createGrid()
+//-----------------------------------------------------------------------------
+OrthogonalRouter::RoutingGrid OrthogonalRouter::createGrid(QPointF const& startStub, QPointF const& endStub) const
+{
+    QRectF area = QRectF(startStub, endStub).normalized().adjusted(
+        -SEARCH_MARGIN, -SEARCH_MARGIN, SEARCH_MARGIN, SEARCH_MARGIN);
+
+    // Grow the area to contain the obstacles blocking the way, so that the route can go around them.
+    QVector<int> found = findObstacles(area);
+    for (int i = 0; i < MAX_AREA_EXPANSIONS; ++i)
+    {
+        QRectF expanded = area;
+        for (int index : found)
+        {
+            expanded |= obstacles_.at(index).adjusted(-2 * clearance_, -2 * clearance_, 2 * clearance_, 2 * clearance_);
+        }
+
+        if (expanded == area)
+        {
+            break;
+        }
+
+        area = expanded;
+        found = findObstacles(area);
+    }
+
+    RoutingGrid grid;
+    grid.xs = { startStub.x(), endStub.x(), alignToGrid((startStub.x() + endStub.x()) / 2, gridSize_, false),
+        area.left(), area.right() };
+    grid.ys = { startStub.y(), endStub.y(), alignToGrid((startStub.y() + endStub.y()) / 2, gridSize_, false),
+        area.top(), area.bottom() };
+
+    for (int index : found)
+    {
+        QRectF const& obstacle = obstacles_.at(index);
+        grid.obstacles.append(obstacle);
+
+        grid.xs.append(alignToGrid(obstacle.left() - clearance_, gridSize_, false));
+        grid.xs.append(alignToGrid(obstacle.right() + clearance_, gridSize_, true));
+        grid.ys.append(alignToGrid(obstacle.top() - clearance_, gridSize_, false));
+        grid.ys.append(alignToGrid(obstacle.bottom() + clearance_, gridSize_, true));
+    }
+
+    sortUnique(grid.xs);
+    sortUnique(grid.ys);
+
+    return grid;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::segmentPenalty()
+//-----------------------------------------------------------------------------
+qreal OrthogonalRouter::segmentPenalty(QLineF const& line, int ignoredRouteId) const
+{
+    qreal penalty = 0;
+    forEachSegmentNear(line, ignoredRouteId, [&line, &penalty](QLineF const& other)
+        {
+            // Crossings exactly at a grid node are counted once for the segment leaving the node.
+            if (crosses(line, other, true))
+            {
+                penalty += CROSSING_PENALTY;
+            }
+
+            penalty += OVERLAP_PENALTY * overlapLength(line, other);
+        });
+
+    return penalty;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::forEachSegmentNear()
+//-----------------------------------------------------------------------------
+template <typename Function>
+void OrthogonalRouter::forEachSegmentNear(QLineF const& line, int ignoredRouteId, Function function) const
+{
+    ++currentStamp_;
+    segmentStamps_.resize(segments_.size());
+
+    QRectF area = QRectF(line.p1(), line.p2()).normalized().adjusted(-TOLERANCE, -TOLERANCE, TOLERANCE, TOLERANCE);
+    for (qint64 cell : cellsCovering(area))
+    {
+        auto cellSegments = segmentCells_.constFind(cell);
+        if (cellSegments == segmentCells_.cend())
+        {
+            continue;
+        }
+
+        for (int index : *cellSegments)
+        {
+            Segment const& segment = segments_.at(index);
+            if (segmentStamps_.at(index) != currentStamp_ && segment.routeId != ignoredRouteId)
+            {
+                segmentStamps_[index] = currentStamp_;
+                function(segment.line);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::cellsCovering()
+//-----------------------------------------------------------------------------
+QVector<qint64> OrthogonalRouter::cellsCovering(QRectF const& area) const
+{
+    int const firstColumn = qFloor(area.left() / CELL_SIZE);
+    int const lastColumn = qFloor(area.right() / CELL_SIZE);
+    int const firstRow = qFloor(area.top() / CELL_SIZE);
+    int const lastRow = qFloor(area.bottom() / CELL_SIZE);
+
+    QVector<qint64> cells;
+    cells.reserve((lastColumn - firstColumn + 1) * (lastRow - firstRow + 1));
+    for (int column = firstColumn; column <= lastColumn; ++column)
+    {
+        for (int row = firstRow; row <= lastRow; ++row)
+        {
+            cells.append((static_cast<qint64>(column) << 32) | static_cast<quint32>(row));
+        }
+    }
+
+    return cells;
+}
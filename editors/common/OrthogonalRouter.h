@@ -0,0 +1,241 @@
+//-----------------------------------------------------------------------------
+// File: OrthogonalRouter.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Obstacle-aware orthogonal routing for design connections.
+//-----------------------------------------------------------------------------
+
+#ifndef ORTHOGONALROUTER_H
+#define ORTHOGONALROUTER_H
+
+#include <QHash>
+#include <QLineF>
+#include <QList>
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <QVector2D>
+
+//-----------------------------------------------------------------------------
+//! Obstacle-aware orthogonal routing for design connections.
+//!
+//! Routes are searched with A* on a sparse grid formed by the endpoints and the edges of the obstacles near
+//! them. Bends, crossings and overlaps with already routed segments are penalized. The routed segments are kept
+//! in a spatial index, so that the router can be reused for all the connections of a design. The router uses
+//! only geometry and does not depend on the graphics scene.
+//-----------------------------------------------------------------------------
+class OrthogonalRouter
+{
+public:
+
+    //! Describes a route to create.
+    struct RouteRequest
+    {
+        //! Identifier of the route in the segment index, or -1 for a route not stored in the index.
+        int routeId = -1;
+
+        //! The start point of the route.
+        QPointF start;
+
+        //! The direction in which the route exits the start point.
+        QVector2D startDirection;
+
+        //! The end point of the route.
+        QPointF end;
+
+        //! The direction in which the route exits the end point.
+        QVector2D endDirection;
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *    @param [in] gridSize    The grid size to which the route points are aligned.
+     */
+    explicit OrthogonalRouter(qreal gridSize = 10.0);
+
+    //! The destructor.
+    ~OrthogonalRouter() = default;
+
+    /*!
+     *  Sets the obstacles the routes should avoid.
+     *
+     *    @param [in] obstacles   The bounding rectangles of the obstacles.
+     */
+    void setObstacles(QVector<QRectF> const& obstacles);
+
+    /*!
+     *  Stores a route in the segment index, replacing the previous route with the same identifier.
+     *
+     *    @param [in] routeId     Identifier of the route.
+     *    @param [in] route       The route points.
+     */
+    void setRoute(int routeId, QList<QPointF> const& route);
+
+    /*!
+     *  Removes a route from the segment index.
+     *
+     *    @param [in] routeId     Identifier of the route to remove.
+     */
+    void removeRoute(int routeId);
+
+    //! Removes all routes from the segment index.
+    void clearRoutes();
+
+    /*!
+     *  Gets the number of routes in the segment index.
+     *
+     *    @return The number of stored routes.
+     */
+    int getRouteCount() const;
+
+    /*!
+     *  Creates a route without storing it in the segment index.
+     *
+     *    @param [in] request     The route to create.
+     *
+     *    @return The route points from the start point to the end point.
+     */
+    QList<QPointF> route(RouteRequest const& request) const;
+
+    /*!
+     *  Creates routes for all the given requests and stores them in the segment index.
+     *
+     *    The shortest connections are routed first, so that the longer ones go around them.
+     *
+     *    @param [in] requests    The routes to create.
+     *
+     *    @return The route points for each request in the order of the requests.
+     */
+    QList<QList<QPointF> > routeAll(QList<RouteRequest> const& requests);
+
+    /*!
+     *  Counts the crossings of the given route with the routes in the segment index.
+     *
+     *    @param [in] route           The route points.
+     *    @param [in] ignoredRouteId  Identifier of a stored route to ignore.
+     *
+     *    @return The number of crossings.
+     */
+    int countCrossings(QList<QPointF> const& route, int ignoredRouteId = -1) const;
+
+private:
+
+    //! A routed segment in the segment index.
+    struct Segment
+    {
+        //! The segment line.
+        QLineF line;
+
+        //! Identifier of the route containing the segment, or -1 for a free slot.
+        int routeId = -1;
+    };
+
+    //! The sparse routing grid for a single route.
+    struct RoutingGrid
+    {
+        //! The grid coordinates in x and y directions.
+        QVector<qreal> xs;
+        QVector<qreal> ys;
+
+        //! The obstacles inside the grid area.
+        QVector<QRectF> obstacles;
+    };
+
+    /*!
+     *  Finds the obstacles intersecting the given area.
+     *
+     *    @param [in] area    The area to search.
+     *
+     *    @return Indices of the found obstacles.
+     */
+    QVector<int> findObstacles(QRectF const& area) const;
+
+    /*!
+     *  Moves a route stub point along the given direction until it is outside all obstacles.
+     *
+     *    @param [in] point       The stub point.
+     *    @param [in] direction   The exit direction.
+     *
+     *    @return The moved point.
+     */
+    QPointF escapeObstacles(QPointF const& point, QPointF const& direction) const;
+
+    /*!
+     *  Creates the sparse routing grid for a route between the given stub points.
+     *
+     *    @param [in] startStub   The first point outside the start obstacle.
+     *    @param [in] endStub     The last point outside the end obstacle.
+     *
+     *    @return The routing grid.
+     */
+    RoutingGrid createGrid(QPointF const& startStub, QPointF const& endStub) const;
+
+    /*!
+     *  Calculates the penalty of the crossings and overlaps of a segment with the stored routes.
+     *
+     *    @param [in] line            The segment to check.
+     *    @param [in] ignoredRouteId  Identifier of a stored route to ignore.
+     *
+     *    @return The penalty cost.
+     */
+    qreal segmentPenalty(QLineF const& line, int ignoredRouteId) const;
+
+    /*!
+     *  Calls the given function for each stored segment near the given line once.
+     *
+     *    @param [in] line            The line whose surroundings to search.
+     *    @param [in] ignoredRouteId  Identifier of a stored route to ignore.
+     *    @param [in] function        The function to call with the found segment.
+     */
+    template <typename Function>
+    void forEachSegmentNear(QLineF const& line, int ignoredRouteId, Function function) const;
+
+    /*!
+     *  Gets the cell keys of the spatial index covering the given area.
+     *
+     *    @param [in] area    The area to cover.
+     *
+     *    @return The cell keys.
+     */
+    QVector<qint64> cellsCovering(QRectF const& area) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The grid size to which the route points are aligned.
+    qreal gridSize_;
+
+    //! The minimum distance of the routes from the obstacles.
+    qreal clearance_;
+
+    //! The obstacles to avoid.
+    QVector<QRectF> obstacles_;
+
+    //! The spatial index of the obstacles by cell.
+    QHash<qint64, QVector<int> > obstacleCells_;
+
+    //! The stored route segments.
+    QVector<Segment> segments_;
+
+    //! The free slots in the stored route segments.
+    QVector<int> freeSegments_;
+
+    //! The segment indices of each stored route.
+    QHash<int, QVector<int> > routeSegments_;
+
+    //! The spatial index of the stored segments by cell.
+    QHash<qint64, QVector<int> > segmentCells_;
+
+    //! Query stamps for visiting each obstacle and segment only once in a search.
+    mutable QVector<int> obstacleStamps_;
+    mutable QVector<int> segmentStamps_;
+    mutable int currentStamp_ = 0;
+};
+
+#endif // ORTHOGONALROUTER_H
@@ -52,12 +52,76 @@
 #include <QMap>
 #include <QMessageBox>
 #include <QPainter>
-#include <QPixmap>
 #include <QRectF>
 #include <QPointF>
 #include <QBrush>
 #include <QSharedPointer>
+#include <QSet>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QGraphicsScene>
 #include <QApplication>
+#include <QRecursiveMutex>
+
+namespace
+{
+    //! Lock for the library, shared by the generators of all the components in the document.
+    QRecursiveMutex libraryLock;
+
+    /*!
+     *  Render the items of a scene into an image.
+     *
+     *    @param [in] scene           The scene to render.
+     *    @param [in] boundingRect    The rect that bounds all items in the scene.
+     *
+     *    @return The rendered image.
+     */
+    QImage renderScene(QGraphicsScene* scene, QRectF boundingRect);
+
+    /*!
+     *  Save a picture as a PNG file, replacing any existing file. Safe to call from worker threads.
+     *
+     *    @param [in] path    Path of the picture file.
+     *    @param [in] image   The picture to save.
+     *
+     *    @return True, if the picture was saved, otherwise false.
+     */
+    bool savePicture(QString const& path, QImage const& image);
+
+    //-----------------------------------------------------------------------------
+    // Function: renderScene()
+    //-----------------------------------------------------------------------------
+    QImage renderScene(QGraphicsScene* scene, QRectF boundingRect)
+    {
+        boundingRect.setHeight(boundingRect.height() + 2);
+        boundingRect.setWidth(boundingRect.width() + 2);
+
+        // Unlike pixmaps, images can be handed over to the worker threads for encoding.
+        QImage picture(boundingRect.size().toSize(), QImage::Format_RGB32);
+
+        QPainter painter(&picture);
+        painter.fillRect(picture.rect(), QBrush(Qt::white));
+        scene->render(&painter, picture.rect(), boundingRect.toRect());
+        painter.end();
+
+        return picture;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: savePicture()
+    //-----------------------------------------------------------------------------
+    bool savePicture(QString const& path, QImage const& image)
+    {
+        QFile pictureFile(path);
+
+        if (pictureFile.exists())
+        {
+            pictureFile.remove();
+        }
+
+        return image.save(&pictureFile, "PNG");
+    }
+}
 
 //-----------------------------------------------------------------------------
 // Function: documentgenerator::DocumentGenerator()
@@ -65,7 +129,8 @@
 DocumentGenerator::DocumentGenerator(LibraryInterface* handler, const VLNV& vlnv,
     DesignWidgetFactory* designWidgetFactory, ExpressionFormatterFactory* expressionFormatterFactory,
     int componentNumber, QWidget* parent) :
-    libraryHandler_(handler),
+    serializedLibrary_(handler, &libraryLock),
+    libraryHandler_(&serializedLibrary_),
     component_(),
     componentNumber_(componentNumber),
     targetPath_(),
@@ -190,6 +255,29 @@ void DocumentGenerator::writeDocumentation(QTextStream& stream, QString targetPa
         return;
     }
 
+    QStringList pictureList = writeDocument(stream, targetPath, true);
+
+    QApplication::restoreOverrideCursor();
+
+    // ask user if he wants to save the generated documentation into object metadata
+    QMessageBox::StandardButton button = QMessageBox::question(parentWidget_, 
+        tr("Save generated documentation to metadata?"),
+        tr("Would you like to save the generated documentation to IP-Xact"
+        " metadata?"), QMessageBox::Yes | QMessageBox::No, QMessageBox::Yes);
+
+    // if the generated file is saved
+    if (button == QMessageBox::Yes)
+    {
+        saveDocumentationToMetadata(pictureList);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::writeDocument()
+//-----------------------------------------------------------------------------
+QStringList DocumentGenerator::writeDocument(QTextStream& stream, QString const& targetPath, bool concurrently)
+{
+    Q_ASSERT(component_);
     Q_ASSERT(libraryHandler_->contains(component_->getVlnv()));
     Q_ASSERT(libraryHandler_->getDocumentType(component_->getVlnv()) == VLNV::COMPONENT);
 
@@ -224,80 +312,83 @@ void DocumentGenerator::writeDocumentation(QTextStream& stream, QString targetPa
 
     QStringList pictureList;
 
-    // write the actual documentation for the top component
-    writeDocumentation(stream, targetPath_, pictureList);
+    // write the actual documentation for the top component and its sub-components
+    if (concurrently)
+    {
+        writeHierarchyDocumentation(stream, pictureList);
+    }
+    else
+    {
+        writeDocumentation(stream, targetPath_, pictureList);
+    }
 
     writer_->writeEndOfDocument(stream);
 
-    QApplication::restoreOverrideCursor();
-
-    // ask user if he wants to save the generated documentation into object metadata
-    QMessageBox::StandardButton button = QMessageBox::question(parentWidget_, 
-        tr("Save generated documentation to metadata?"),
-        tr("Would you like to save the generated documentation to IP-Xact"
-        " metadata?"), QMessageBox::Yes | QMessageBox::No, QMessageBox::Yes);
+    return pictureList;
+}
 
-    // if the generated file is saved
-    if (button == QMessageBox::Yes)
-    {
-        QString xmlPath = libraryHandler_->getPath(component_->getVlnv());
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::saveDocumentationToMetadata()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::saveDocumentationToMetadata(QStringList const& pictureList)
+{
+    QString xmlPath = libraryHandler_->getPath(component_->getVlnv());
 
-        // get the relative path to add to file set
-        QString relativePath = General::getRelativePath(xmlPath, targetPath_);
+    // get the relative path to add to file set
+    QString relativePath = General::getRelativePath(xmlPath, targetPath_);
 
-        QString fileSetName("Documentation");
-        QSharedPointer<FileSet> documentationFileSet = component_->getFileSet(fileSetName);
+    QString fileSetName("Documentation");
+    QSharedPointer<FileSet> documentationFileSet = component_->getFileSet(fileSetName);
 
-        // if the documentation file set was not found. Create one
-        if (!documentationFileSet)
-        {
-            documentationFileSet = QSharedPointer<FileSet>(new FileSet(fileSetName, QString("documentation")));
-            component_->getFileSets()->append(documentationFileSet);
-        }
+    // if the documentation file set was not found. Create one
+    if (!documentationFileSet)
+    {
+        documentationFileSet = QSharedPointer<FileSet>(new FileSet(fileSetName, QString("documentation")));
+        component_->getFileSets()->append(documentationFileSet);
+    }
 
-        QSettings settings;
+    QSettings settings;
 
-        QString docFileType = "";
-        if (currentFormat_ == DocumentFormat::HTML)
-        {
-            docFileType = "html";
-        }
-        else if (currentFormat_ == DocumentFormat::MD)
-        {
-            docFileType = "markdown";
-        }
+    QString docFileType = "";
+    if (currentFormat_ == DocumentFormat::HTML)
+    {
+        docFileType = "html";
+    }
+    else if (currentFormat_ == DocumentFormat::MD)
+    {
+        docFileType = "markdown";
+    }
 
-        // create a new file and add it to file set
-        QSharedPointer<File> docFile = documentationFileSet->addFile(relativePath, settings);
-        Q_ASSERT(docFile);
-        docFile->setIncludeFile(false);
-        docFile->setDescription(tr("File that contains the documentation "
-            "for this component and subcomponents"));
+    // create a new file and add it to file set
+    QSharedPointer<File> docFile = documentationFileSet->addFile(relativePath, settings);
+    Q_ASSERT(docFile);
+    docFile->setIncludeFile(false);
+    docFile->setDescription(tr("File that contains the documentation "
+        "for this component and subcomponents"));
 
-        if (!docFile->matchesFileType(docFileType))
-        {
-            docFile->getFileTypes()->append(FileType(docFileType));
-        }
+    if (!docFile->matchesFileType(docFileType))
+    {
+        docFile->getFileTypes()->append(FileType(docFileType));
+    }
 
-        // add all created pictures to the file set
-        for (auto const& pictureName : pictureList)
-        {
-            QString relativePicPath = General::getRelativePath(xmlPath, pictureName);
-            QString picFileType = "pngImage";
+    // add all created pictures to the file set
+    for (auto const& pictureName : pictureList)
+    {
+        QString relativePicPath = General::getRelativePath(xmlPath, pictureName);
+        QString picFileType = "pngImage";
 
-            QSharedPointer<File> picFile = documentationFileSet->addFile(relativePicPath, settings);
-            Q_ASSERT(picFile);
-            picFile->setIncludeFile(false);
-            picFile->setDescription(tr("Preview picture needed by the documentation."));
+        QSharedPointer<File> picFile = documentationFileSet->addFile(relativePicPath, settings);
+        Q_ASSERT(picFile);
+        picFile->setIncludeFile(false);
+        picFile->setDescription(tr("Preview picture needed by the documentation."));
 
-            if (!picFile->matchesFileType(picFileType))
-            {
-                picFile->getFileTypes()->append(FileType(picFileType));
-            }
+        if (!picFile->matchesFileType(picFileType))
+        {
+            picFile->getFileTypes()->append(FileType(picFileType));
         }
-
-        libraryHandler_->writeModelToFile(component_);
     }
+
+    libraryHandler_->writeModelToFile(component_);
 }
 
 //-----------------------------------------------------------------------------
@@ -328,16 +419,138 @@ void DocumentGenerator::writeTableOfContents(QTextStream& stream)
 //-----------------------------------------------------------------------------
 void DocumentGenerator::writeDocumentation(QTextStream& stream, const QString& targetPath,
     QStringList& filesToInclude)
+{
+    prepareComponentDocumentation(targetPath);
+
+    savePictures(renderPictures(), filesToInclude);
+
+    writeComponentSections(stream);
+
+    // tell each child to write it's documentation
+    for (auto const& generator : childInstances_)
+    {
+        generator->setImagesPath(imagesPath_);
+        generator->writeDocumentation(stream, targetPath, filesToInclude);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::writeHierarchyDocumentation()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::writeHierarchyDocumentation(QTextStream& stream, QStringList& pictureList)
+{
+    QList<DocumentGenerator*> generators;
+    collectGenerators(generators);
+
+    QThreadPool workers;
+
+    // Only a window of sections and pictures is kept in memory at a time.
+    int const windowSize = qMax(1, workers.maxThreadCount());
+
+    for (int windowBegin = 0; windowBegin < generators.size(); windowBegin += windowSize)
+    {
+        int const windowEnd = qMin(windowBegin + windowSize, generators.size());
+
+        // Widgets are not thread safe, so everything touching them is done on this thread before any of the
+        // workers are started. The workers still read the library, but only through the serialized interface.
+        QVector<RenderedPicture> pictures;
+        for (int i = windowBegin; i < windowEnd; ++i)
+        {
+            DocumentGenerator* generator = generators.at(i);
+            generator->setImagesPath(imagesPath_);
+            generator->prepareComponentDocumentation(targetPath_);
+
+            pictures.append(generator->renderPictures());
+        }
+
+        QVector<char> saved(pictures.size(), false);
+        startSavingPictures(pictures, saved, workers);
+
+        QVector<QString> sections(windowEnd - windowBegin);
+        QString* section = sections.data();
+        for (int i = windowBegin; i < windowEnd; ++i, ++section)
+        {
+            DocumentGenerator* generator = generators.at(i);
+            workers.start(QRunnable::create([generator, section]()
+                {
+                    QTextStream sectionStream(section);
+                    generator->writeComponentSections(sectionStream);
+                }));
+        }
+
+        workers.waitForDone();
+
+        for (QString const& componentSection : sections)
+        {
+            stream << componentSection;
+        }
+        stream.flush();
+
+        reportSavedPictures(pictures, saved, pictureList);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::collectGenerators()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::collectGenerators(QList<DocumentGenerator*>& generators)
+{
+    generators.append(this);
+
+    for (auto const& generator : childInstances_)
+    {
+        generator->collectGenerators(generators);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::prepareComponentDocumentation()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::prepareComponentDocumentation(QString const& targetPath)
 {
     writer_->setTargetPath(targetPath);
     writer_->setImagesPath(imagesPath_);
     targetPath_ = targetPath;
 
-    // write the component header, picture and info
-    writer_->writeComponentHeader(stream);
+    preloadReferencedDocuments();
+}
 
-    createComponentPicture(filesToInclude);
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::preloadReferencedDocuments()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::preloadReferencedDocuments() const
+{
+    QList<VLNV> references = component_->getDependentVLNVs();
+    QSet<QString> visited;
+
+    for (int i = 0; i < references.size(); ++i)
+    {
+        VLNV const reference = references.at(i);
+        if (visited.contains(reference.toString()))
+        {
+            continue;
+        }
+
+        visited.insert(reference.toString());
+
+        QSharedPointer<Document const> document = libraryHandler_->getModelReadOnly(reference);
+
+        // Designs and configurations reference the instantiated components and the designs in turn.
+        VLNV::IPXactType const documentType = libraryHandler_->getDocumentType(reference);
+        if (document && (documentType == VLNV::DESIGN || documentType == VLNV::DESIGNCONFIGURATION))
+        {
+            references.append(document->getDependentVLNVs());
+        }
+    }
+}
 
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::writeComponentSections()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::writeComponentSections(QTextStream& stream)
+{
+    // write the component header and info
+    writer_->writeComponentHeader(stream);
     writer_->writeComponentInfo(stream);
 
     int subHeaderNumber = 1;
@@ -348,14 +561,7 @@ void DocumentGenerator::writeDocumentation(QTextStream& stream, const QString& t
     writePorts(stream, subHeaderNumber);
     writeInterfaces(stream, subHeaderNumber);
     writeFileSets(stream, subHeaderNumber);
-    writeViews(stream, subHeaderNumber, filesToInclude);
-
-    // tell each child to write it's documentation
-    for (auto const& generator : childInstances_)
-    {
-        generator->setImagesPath(imagesPath_);
-        generator->writeDocumentation(stream, targetPath, filesToInclude);
-    }
+    writeViewSections(stream, subHeaderNumber);
 }
 
 //-----------------------------------------------------------------------------
@@ -459,6 +665,16 @@ void DocumentGenerator::writeFileSets(QTextStream& stream, int& subHeaderNumber)
 // Function: documentgenerator::writeViews()
 //-----------------------------------------------------------------------------
 void DocumentGenerator::writeViews(QTextStream& stream, int& subHeaderNumber, QStringList& pictureList)
+{
+    savePictures(renderDesignPictures(), pictureList);
+
+    writeViewSections(stream, subHeaderNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::writeViewSections()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::writeViewSections(QTextStream& stream, int& subHeaderNumber)
 {
     if (!component_->hasViews())
     {
@@ -471,7 +687,7 @@ void DocumentGenerator::writeViews(QTextStream& stream, int& subHeaderNumber, QS
 
     for (auto const& view : *component_->getViews())
     {
-        writeSingleView(stream, view, subHeaderNumber, viewNumber, pictureList);
+        writeSingleView(stream, view, subHeaderNumber, viewNumber);
         ++viewNumber;
     }
 
@@ -498,7 +714,7 @@ void DocumentGenerator::setImagesPath(QString const& path)
 // Function: documentgenerator::writeSingleView()
 //-----------------------------------------------------------------------------
 void DocumentGenerator::writeSingleView(QTextStream& stream, QSharedPointer<View> view,
-    int const& subHeaderNumber, int const& viewNumber, QStringList& pictureList)
+    int const& subHeaderNumber, int const& viewNumber)
 {
     QList subHeaderNumbers({ componentNumber_, subHeaderNumber, viewNumber });
     writer_->writeSubHeader(stream, subHeaderNumbers, "View: " + view->name(), 3);
@@ -537,7 +753,7 @@ void DocumentGenerator::writeSingleView(QTextStream& stream, QSharedPointer<View
 
     if (view->isHierarchical())
     {
-        writeDesign(stream, view, pictureList);
+        writeDesign(stream, view);
     }
 }
 
@@ -701,7 +917,7 @@ void DocumentGenerator::writeReferencedDesignInstantiation(QTextStream& stream,
 //-----------------------------------------------------------------------------
 // Function: documentgenerator::writeDesign()
 //-----------------------------------------------------------------------------
-void DocumentGenerator::writeDesign(QTextStream& stream, QSharedPointer<View> view, QStringList& pictureList)
+void DocumentGenerator::writeDesign(QTextStream& stream, QSharedPointer<View> view)
 {
     QSharedPointer<DesignConfiguration> configuration = getDesignConfiguration(view);
     QSharedPointer<Design> design = getDesign(view, configuration);
@@ -714,15 +930,6 @@ void DocumentGenerator::writeDesign(QTextStream& stream, QSharedPointer<View> vi
         return;
     }
 
-    QString designPicPath = imagesPath_
-        + (imagesPath_.isEmpty() ? QStringLiteral("") : QStringLiteral("/"))
-        + component_->getVlnv().toString(".")
-        + QStringLiteral(".")
-        + view->name()
-        + QStringLiteral(".png");
-
-    createDesignPicture(pictureList, view->name(), designPicPath);
-
     QString designDiagramTitle = QString("Diagram of design %1:").arg(design->getVlnv().toString());
     QString designDiagramAltText = QString("View: %1 preview picture").arg(view->name());
     QString relativePicPath = imagesPath_.split("/").back()
@@ -737,43 +944,62 @@ void DocumentGenerator::writeDesign(QTextStream& stream, QSharedPointer<View> vi
 }
 
 //-----------------------------------------------------------------------------
-// Function: documentgenerator::createDesignPicture()
+// Function: documentgenerator::getDesignPicturePath()
 //-----------------------------------------------------------------------------
-void DocumentGenerator::createDesignPicture(QStringList& pictureList,
-    QString const& viewName, QString const& designPicPath)
+QString DocumentGenerator::getDesignPicturePath(QSharedPointer<View> view) const
 {
-    DesignWidget* designWidget(designWidgetFactory_->makeHWDesignWidget());
+    return imagesPath_
+        + (imagesPath_.isEmpty() ? QStringLiteral("") : QStringLiteral("/"))
+        + component_->getVlnv().toString(".")
+        + QStringLiteral(".")
+        + view->name()
+        + QStringLiteral(".png");
+}
 
-    designWidget->hide();
-    designWidget->setDesign(component_->getVlnv(), viewName);
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::renderPictures()
+//-----------------------------------------------------------------------------
+QVector<DocumentGenerator::RenderedPicture> DocumentGenerator::renderPictures()
+{
+    QVector<RenderedPicture> pictures;
+    pictures.append(renderComponentPicture());
+    pictures.append(renderDesignPictures());
 
-    QFile designPicFile(designPicPath);
+    return pictures;
+}
 
-    if (designPicFile.exists())
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::renderDesignPictures()
+//-----------------------------------------------------------------------------
+QVector<DocumentGenerator::RenderedPicture> DocumentGenerator::renderDesignPictures()
+{
+    QVector<RenderedPicture> pictures;
+
+    for (auto const& view : *component_->getViews())
     {
-        designPicFile.remove();
+        // Views without a valid design get an error message in place of the diagram.
+        if (view->isHierarchical() && getDesign(view, getDesignConfiguration(view)))
+        {
+            pictures.append(renderDesignPicture(view->name(), getDesignPicturePath(view)));
+        }
     }
 
-    // get the rect that bounds all items on box
-    QRectF boundingRect = designWidget->getDiagram()->itemsBoundingRect();
-    boundingRect.setHeight(boundingRect.height() + 2);
-    boundingRect.setWidth(boundingRect.width() + 2);
+    return pictures;
+}
 
-    // set the size of the picture
-    QPixmap designPic(boundingRect.size().toSize());
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::renderDesignPicture()
+//-----------------------------------------------------------------------------
+DocumentGenerator::RenderedPicture DocumentGenerator::renderDesignPicture(QString const& viewName,
+    QString const& designPicPath) const
+{
+    DesignWidget* designWidget(designWidgetFactory_->makeHWDesignWidget());
 
-    // create the picture for the component
-    QPainter painter(&designPic);
-    painter.fillRect(designPic.rect(), QBrush(Qt::white));
-    designWidget->getDiagram()->render(&painter, designPic.rect(), boundingRect.toRect());
-    if (!designPic.save(&designPicFile, "PNG"))
-    {
-        emit errorMessage(tr("Could not save picture %1").arg(designPicPath));
-    }
-    else
-    {
-        pictureList.append(designPicPath);
-    }
+    designWidget->hide();
+    designWidget->setDesign(component_->getVlnv(), viewName);
+
+    return { designPicPath, renderScene(designWidget->getDiagram(),
+        designWidget->getDiagram()->itemsBoundingRect()) };
 }
 
 //-----------------------------------------------------------------------------
@@ -914,9 +1140,9 @@ QSharedPointer<Design> DocumentGenerator::getDesign(QSharedPointer<View> view,
 }
 
 //-----------------------------------------------------------------------------
-// Function: documentgenerator::createComponentPicture()
+// Function: documentgenerator::renderComponentPicture()
 //-----------------------------------------------------------------------------
-void DocumentGenerator::createComponentPicture(QStringList& pictureList)
+DocumentGenerator::RenderedPicture DocumentGenerator::renderComponentPicture() const
 {
     ComponentPreviewBox compBox(libraryHandler_);
     compBox.hide();
@@ -927,31 +1153,56 @@ void DocumentGenerator::createComponentPicture(QStringList& pictureList)
         + component_->getVlnv().toString(".")
         + ".png";
 
-    QFile compPicFile(compPicPath);
+    return { compPicPath, renderScene(compBox.scene(), compBox.itemsBoundingRect()) };
+}
 
-    if (compPicFile.exists())
-    {
-        compPicFile.remove();
-    }
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::savePictures()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::savePictures(QVector<RenderedPicture> const& pictures, QStringList& pictureList)
+{
+    QVector<char> saved(pictures.size(), false);
 
-    // get the rect that bounds all items on box
-    QRectF boundingRect = compBox.itemsBoundingRect();
-    boundingRect.setHeight(boundingRect.height() + 2);
-    boundingRect.setWidth(boundingRect.width() + 2);
+    QThreadPool workers;
+    startSavingPictures(pictures, saved, workers);
+    workers.waitForDone();
 
-    // set the size of the picture
-    QPixmap compPic(boundingRect.size().toSize());
+    reportSavedPictures(pictures, saved, pictureList);
+}
 
-    // create the picture for the component
-    QPainter painter(&compPic);
-    painter.fillRect(compPic.rect(), QBrush(Qt::white));
-    compBox.scene()->render(&painter, compPic.rect(), boundingRect.toRect());
-    if (!compPic.save(&compPicFile, "PNG"))
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::startSavingPictures()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::startSavingPictures(QVector<RenderedPicture> const& pictures, QVector<char>& saved,
+    QThreadPool& workers)
+{
+    char* result = saved.data();
+    for (RenderedPicture const& picture : pictures)
     {
-        emit errorMessage(tr("Could not save picture %1").arg(compPicPath));
+        workers.start(QRunnable::create([&picture, result]()
+            {
+                *result = savePicture(picture.path, picture.image);
+            }));
+
+        ++result;
     }
-    else
+}
+
+//-----------------------------------------------------------------------------
+// Function: documentgenerator::reportSavedPictures()
+//-----------------------------------------------------------------------------
+void DocumentGenerator::reportSavedPictures(QVector<RenderedPicture> const& pictures, QVector<char> const& saved,
+    QStringList& pictureList)
+{
+    for (int i = 0; i < pictures.size(); ++i)
     {
-        pictureList.append(compPicPath);
+        if (saved.at(i))
+        {
+            pictureList.append(pictures.at(i).path);
+        }
+        else
+        {
+            emit errorMessage(tr("Could not save picture %1").arg(pictures.at(i).path));
+        }
     }
 }
@@ -21,15 +21,18 @@
 #include <editors/common/DesignWidgetFactory.h>
 
 #include <KactusAPI/include/LibraryInterface.h>
+#include <KactusAPI/include/SerializedLibraryInterface.h>
 
 #include <IPXACTmodels/DesignConfiguration/DesignConfiguration.h>
 #include <IPXACTmodels/common/VLNV.h>
 #include <IPXACTmodels/Component/Component.h>
 
 #include <QTextStream>
+#include <QImage>
 #include <QList>
 #include <QSharedPointer>
 #include <QStringList>
+#include <QVector>
 #include <QWidget>
 
 class AddressBlock;
@@ -37,6 +40,8 @@ class Register;
 class Field;
 class View;
 
+class QThreadPool;
+
 //-----------------------------------------------------------------------------
 //! Generates documentation for a component and its associated items.
 //-----------------------------------------------------------------------------
@@ -80,11 +85,25 @@ public:
     /*!
      *  Write the documentation to the selected stream.
      *
+     *  The sections of the sub-components are generated concurrently and streamed in document order.
+     *
      *    @param [in] stream          The stream where to write.
      *    @param [in] targetPath      The path where the document will be placed.
      */
     void writeDocumentation(QTextStream& stream, QString targetPath);
 
+    /*!
+     *  Write the whole document to the selected stream without saving it to the component metadata.
+     *
+     *    @param [in] stream          The stream where to write.
+     *    @param [in] targetPath      The path where the document will be placed.
+     *    @param [in] concurrently    If true, the sections of the sub-components are generated concurrently,
+     *                                otherwise one component at a time.
+     *
+     *    @return The paths of the created pictures.
+     */
+    QStringList writeDocument(QTextStream& stream, QString const& targetPath, bool concurrently);
+
     /*!
      *  Write the document header.
      *
@@ -232,6 +251,70 @@ private:
     DocumentGenerator(const DocumentGenerator& other);
     DocumentGenerator& operator=(const DocumentGenerator& other);
 
+    //! Picture rendered offscreen and waiting to be saved.
+    struct RenderedPicture
+    {
+        //! Path of the picture file.
+        QString path;
+
+        //! The rendered picture.
+        QImage image;
+    };
+
+    /*!
+     *  Write the documentation of this generator and all its sub-generators.
+     *
+     *  Widgets are only accessed on the calling thread. The sections and the picture files are then written by
+     *  worker threads, a window of components at a time, and the sections are streamed in order. The workers
+     *  access the library only through the serialized library interface.
+     *
+     *    @param [in] stream          The stream where to write.
+     *    @param [in] pictureList     List of file names to add the paths of the created pictures to.
+     */
+    void writeHierarchyDocumentation(QTextStream& stream, QStringList& pictureList);
+
+    /*!
+     *  Add the generated document and its pictures to the documentation file set of the component and save it.
+     *
+     *    @param [in] pictureList     The paths of the created pictures.
+     */
+    void saveDocumentationToMetadata(QStringList const& pictureList);
+
+    /*!
+     *  Get this generator and all its sub-generators in document order.
+     *
+     *    @param [out] generators     The found generators.
+     */
+    void collectGenerators(QList<DocumentGenerator*>& generators);
+
+    /*!
+     *  Prepare the generator for writing the documentation of the component.
+     *
+     *    @param [in] targetPath      File path to the file to be written.
+     */
+    void prepareComponentDocumentation(QString const& targetPath);
+
+    /*!
+     *  Read the designs, configurations and other documents referenced by the component into the library cache,
+     *  so that writing the documentation does not modify the library.
+     */
+    void preloadReferencedDocuments() const;
+
+    /*!
+     *  Write the sections of the component documentation.
+     *
+     *    @param [in] stream  The text stream to write the documentation into.
+     */
+    void writeComponentSections(QTextStream& stream);
+
+    /*!
+     *  Write the views of the component without creating the design pictures.
+     *
+     *    @param [in] stream              The text stream to write the component views.
+     *    @param [in] subHeaderNumber     The number that defines the sub header.
+     */
+    void writeViewSections(QTextStream& stream, int& subHeaderNumber);
+
     /*!
      *  Write the selected view.
      *
@@ -239,10 +322,9 @@ private:
      *    @param [in] view                The selected view.
      *    @param [in] subHeaderNumber     Number for the sub header.
      *    @param [in] viewNumber          Number defining the selected view.
-     *    @param [in] pictureList         List of file names to add the pictures of the referenced designs to.
      */
     void writeSingleView(QTextStream& stream, QSharedPointer<View> view,
-        int const& subHeaderNumber, int const& viewNumber, QStringList& pictureList);
+        int const& subHeaderNumber, int const& viewNumber);
 
     /*!
      *  Write the referenced component instantiation.
@@ -284,19 +366,77 @@ private:
         *  Write the design diagram referenced by the design instantiation or the design configuration.
         *
         *    @param [in] stream          Text stream to write the design diagram.
-        *    @param [in] viewTabs        Design diagram indentation in the file.
         *    @param [in] view            View containing the design and design configuration references.
-        *    @param [in] pictureList     List of file names to add the pictures of the referenced designs to.
         */
-    void writeDesign(QTextStream& stream, QSharedPointer<View> view, QStringList& pictureList);
+    void writeDesign(QTextStream& stream, QSharedPointer<View> view);
+
+    /*!
+     *  Get the path of the design picture of the given view.
+     *
+     *    @param [in] view    The view containing the design.
+     *
+     *    @return Path of the design picture.
+     */
+    QString getDesignPicturePath(QSharedPointer<View> view) const;
+
+    /*!
+     *  Render the pictures of the component and its designs.
+     *
+     *    @return The rendered pictures.
+     */
+    QVector<RenderedPicture> renderPictures();
+
+    /*!
+     *  Render the pictures of the designs in the hierarchical views of the component.
+     *
+     *    @return The rendered pictures.
+     */
+    QVector<RenderedPicture> renderDesignPictures();
+
+    /*!
+     *  Render a picture of the design.
+     *
+     *    @param [in] viewName        Name of the view to create the design picture for.
+     *    @param [in] designPicPath   Path of the picture file.
+     *
+     *    @return The rendered picture.
+     */
+    RenderedPicture renderDesignPicture(QString const& viewName, QString const& designPicPath) const;
 
     /*!
-    *  Create a picture for the design
-    *
-    *    @param [in] pictureList     List of file names to add the path of the created picture to.
-    *    @param [in] viewName        Name of the view to create the design picture for.
-    */
-    void createDesignPicture(QStringList& pictureList, QString const& viewName, QString const& designPicPath);
+     *  Render a picture of the component.
+     *
+     *    @return The rendered picture.
+     */
+    RenderedPicture renderComponentPicture() const;
+
+    /*!
+     *  Save the given pictures in parallel.
+     *
+     *    @param [in] pictures        The pictures to save.
+     *    @param [in] pictureList     List of file names to add the paths of the saved pictures to.
+     */
+    void savePictures(QVector<RenderedPicture> const& pictures, QStringList& pictureList);
+
+    /*!
+     *  Start saving the given pictures in the worker threads.
+     *
+     *    @param [in] pictures    The pictures to save.
+     *    @param [in] saved       Flags set for each successfully saved picture.
+     *    @param [in] workers     The worker threads.
+     */
+    static void startSavingPictures(QVector<RenderedPicture> const& pictures, QVector<char>& saved,
+        QThreadPool& workers);
+
+    /*!
+     *  Report the results of saving the pictures.
+     *
+     *    @param [in] pictures        The saved pictures.
+     *    @param [in] saved           Flags set for each successfully saved picture.
+     *    @param [in] pictureList     List of file names to add the paths of the saved pictures to.
+     */
+    void reportSavedPictures(QVector<RenderedPicture> const& pictures, QVector<char> const& saved,
+        QStringList& pictureList);
 
     /*!
      *  Get the selected design instantiation.
@@ -363,17 +503,13 @@ private:
      */
     void parseChildItems(QList<VLNV>& objects, int& currentComponentNumber);
 
-    /*!
-     *  Create a picture for the component.
-     *
-     *    @param [in] pictureList     List of file names to add the path of the created picture to.
-     */
-    void createComponentPicture(QStringList& pictureList);
-
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
     
+    //! The library, serialized for the threads writing the sections.
+    SerializedLibraryInterface serializedLibrary_;
+
     //! Pointer to the instance that manages the library.
     LibraryInterface* libraryHandler_;
 
@@ -16,6 +16,7 @@
 
 #include <QCoreApplication>
 #include <QCommandLineParser>
+#include <QFileInfo>
 #include <QStringList>
 
 const QHash<CommandLineParser::Option, CommandLineParser::OptionData > CommandLineParser::CLI_OPTS = {
@@ -29,6 +30,39 @@ const QHash<CommandLineParser::Option, CommandLineParser::OptionData > CommandLi
         CommandLineParser::OptionData{QChar('i'), QStringLiteral("input-script"),
             QStringLiteral("Run script then exit."), QStringLiteral("script path")}
     },
+    {
+        CommandLineParser::Option::BatchManifest,
+        CommandLineParser::OptionData{QChar('b'), QStringLiteral("batch"),
+            QStringLiteral("Run the generation jobs listed in a JSON manifest then exit."), QStringLiteral("manifest path")}
+    },
+    {
+        CommandLineParser::Option::BatchReport,
+        CommandLineParser::OptionData{QChar('r'), QStringLiteral("report"),
+            QStringLiteral("Write a JSON report of the batch generation jobs or library differences."),
+            QStringLiteral("report path")}
+    },
+    {
+        CommandLineParser::Option::WorkerCount,
+        CommandLineParser::OptionData{QChar('j'), QStringLiteral("jobs"),
+            QStringLiteral("Maximum number of concurrent batch generation jobs."), QStringLiteral("count")}
+    },
+    {
+        CommandLineParser::Option::DiffReference,
+        CommandLineParser::OptionData{QChar('d'), QStringLiteral("diff"),
+            QStringLiteral("Compare the IP-XACT documents of a reference library to another library then exit."),
+            QStringLiteral("reference root")}
+    },
+    {
+        CommandLineParser::Option::DiffSubject,
+        CommandLineParser::OptionData{QChar('s'), QStringLiteral("diff-subject"),
+            QStringLiteral("The library to compare against the reference library."), QStringLiteral("subject root")}
+    },
+    {
+        CommandLineParser::Option::TraceFile,
+        CommandLineParser::OptionData{QChar('t'), QStringLiteral("trace"),
+            QStringLiteral("Record a performance trace and write it in Chrome trace format on exit."),
+            QStringLiteral("trace path")}
+    },
 };
 
 //-----------------------------------------------------------------------------
@@ -77,6 +111,22 @@ bool CommandLineParser::runScriptMode() const
     return optionIsSet(Option::InputScript);
 }
 
+//-----------------------------------------------------------------------------
+// Function: CommandLineParser::batchMode()
+//-----------------------------------------------------------------------------
+bool CommandLineParser::batchMode() const
+{
+    return optionIsSet(Option::BatchManifest);
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommandLineParser::diffMode()
+//-----------------------------------------------------------------------------
+bool CommandLineParser::diffMode() const
+{
+    return optionIsSet(Option::DiffReference);
+}
+
 //-----------------------------------------------------------------------------
 // Function: CommandLineParser::versionMode()
 //-----------------------------------------------------------------------------
@@ -121,6 +171,45 @@ int CommandLineParser::process(QStringList const& arguments, MessageMediator* me
         }
     }
 
+    if (optionIsSet(Option::BatchManifest))
+    {
+        auto manifestPath = getOptionValue(Option::BatchManifest);
+
+        if (QFile::exists(manifestPath) == false)
+        {
+            messageChannel->showFailure("Error: Invalid manifest path");
+            return 1;
+        }
+
+        bool validCount = true;
+        if (optionIsSet(Option::WorkerCount) &&
+            (getOptionValue(Option::WorkerCount).toInt(&validCount) < 1 || validCount == false))
+        {
+            messageChannel->showFailure("Error: Invalid job count");
+            return 1;
+        }
+    }
+
+    if (optionIsSet(Option::DiffReference))
+    {
+        if (QFileInfo(getOptionValue(Option::DiffReference)).isDir() == false)
+        {
+            messageChannel->showFailure("Error: Invalid reference library path");
+            return 1;
+        }
+        else if (QFileInfo(getOptionValue(Option::DiffSubject)).isDir() == false)
+        {
+            messageChannel->showFailure("Error: Invalid subject library path");
+            return 1;
+        }
+    }
+
+    if (optionIsSet(Option::TraceFile) && getOptionValue(Option::TraceFile).isEmpty())
+    {
+        messageChannel->showFailure("Error: No trace path given");
+        return 1;
+    }
+
     optionParser_.process(arguments);
     return 0;
 }
@@ -30,7 +30,13 @@ public:
     enum class Option
     {
         NoGui,
-        InputScript
+        InputScript,
+        BatchManifest,
+        BatchReport,
+        WorkerCount,
+        DiffReference,
+        DiffSubject,
+        TraceFile
     };
 
     struct OptionData
@@ -71,6 +77,20 @@ public:
      */
     bool runScriptMode() const;
 
+    /*!
+     *	Checks if the batch generation mode is set.
+     *	    
+     *    @return True, if the mode is set, otherwise false.
+     */
+    bool batchMode() const;
+
+    /*!
+     *	Checks if the library diff mode is set.
+     *	    
+     *    @return True, if the mode is set, otherwise false.
+     */
+    bool diffMode() const;
+
     bool versionMode() const;
 
     /*!
@@ -112,8 +112,10 @@ void DrawingBoard::saveCurrentDocumentAs()
 //-----------------------------------------------------------------------------
 // Function: DrawingBoard::saveAll()
 //-----------------------------------------------------------------------------
-void DrawingBoard::saveAll()
+QList<TabDocument*> DrawingBoard::saveAll()
 {
+    QList<TabDocument*> savedDocuments;
+
     // Go through all documents and save those that have been modified.
     for (int i = 0; i < count(); ++i)
     {
@@ -123,12 +125,17 @@ void DrawingBoard::saveAll()
         {
             if (!shouldSave(doc))
             {
-                return;
+                return savedDocuments;
             }
 
-            doc->save();
+            if (doc->save())
+            {
+                savedDocuments.append(doc);
+            }
         }
     }
+
+    return savedDocuments;
 }
 
 //-----------------------------------------------------------------------------
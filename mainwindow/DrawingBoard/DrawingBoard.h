@@ -52,8 +52,12 @@ public slots:
     //! Saves the currently open document under a different name.
     void saveCurrentDocumentAs();
 
-    //! Saves all open documents.
-    void saveAll();
+    /*!
+     *  Saves all modified open documents.
+     *
+     *    @return The documents that were saved.
+     */
+    QList<TabDocument*> saveAll();
 
     //! Prints the currently open document.
     void printCurrentDocument();
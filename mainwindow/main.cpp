@@ -34,10 +34,14 @@
 
 #include <KactusAPI/include/PluginManager.h>
 #include <KactusAPI/include/PluginUtilityAdapter.h>
+#include <KactusAPI/include/TraceRecorder.h>
 
 #include <settings/SettingsUpdater.h>
 
+#include <wizards/common/StructuralDiff/StructuralDiff.h>
+
 #include <QApplication>
+#include <QFile>
 #include <QPalette>
 #include <QTimer>
 #include <QObject>
@@ -61,6 +65,93 @@ namespace
         return argc == 1;
     }
 
+    //-----------------------------------------------------------------------------
+    // Function: runLibraryDiff()
+    //-----------------------------------------------------------------------------
+    int runLibraryDiff(QString const& referenceRoot, QString const& subjectRoot, QString const& reportPath,
+        MessageMediator* messageChannel)
+    {
+        QStringList errors;
+        QVector<StructuralDiff::Change> changes =
+            StructuralDiff::compareLibraries(referenceRoot, subjectRoot, errors);
+
+        for (QString const& error : errors)
+        {
+            messageChannel->showError(error);
+        }
+
+        if (reportPath.isEmpty() == false)
+        {
+            QFile reportFile(reportPath);
+            if (reportFile.open(QIODevice::WriteOnly | QIODevice::Truncate) == false)
+            {
+                messageChannel->showFailure(QObject::tr("Could not write report %1.").arg(reportPath));
+                return 2;
+            }
+
+            reportFile.write(StructuralDiff::toJson(changes).toJson());
+        }
+        else
+        {
+            for (StructuralDiff::Change const& change : changes)
+            {
+                messageChannel->showMessage(QStringLiteral("%1 %2 %3").arg(
+                    StructuralDiff::changeTypeName(change.type_), change.document_, change.path_));
+            }
+        }
+
+        if (errors.isEmpty() == false)
+        {
+            return 2;
+        }
+
+        return changes.isEmpty() ? 0 : 1;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Records a performance trace during a command-line run and writes it into a file at the end of the run.
+    //-----------------------------------------------------------------------------
+    class TraceFileGuard
+    {
+    public:
+
+        TraceFileGuard(QString const& filePath, MessageMediator* messageChannel):
+        filePath_(filePath),
+        messageChannel_(messageChannel)
+        {
+            if (filePath_.isEmpty() == false)
+            {
+                TraceRecorder::start();
+            }
+        }
+
+        ~TraceFileGuard()
+        {
+            if (filePath_.isEmpty())
+            {
+                return;
+            }
+
+            TraceRecorder::stop();
+            if (TraceRecorder::writeChromeTrace(filePath_) == false)
+            {
+                messageChannel_->showError(QObject::tr("Could not write trace %1.").arg(filePath_));
+            }
+        }
+
+        // Disable copying.
+        TraceFileGuard(TraceFileGuard const& rhs) = delete;
+        TraceFileGuard& operator=(TraceFileGuard const& rhs) = delete;
+
+    private:
+
+        //! Path to the trace file, or empty if no trace is recorded.
+        QString filePath_;
+
+        //! The channel for reporting errors.
+        MessageMediator* messageChannel_;
+    };
+
     void setAppStyle()
     {
         auto defaultStyle = QApplication::style();
@@ -167,6 +258,9 @@ int main(int argc, char *argv[])
 
     library.setOutputChannel(mediator.data());
 
+    // The memory budget of the library cache is given in megabytes, zero meaning no limit.
+    library.setCacheBudget(settings.value(QStringLiteral("Library/CacheBudget"), 0).toLongLong() * 1024 * 1024);
+
     QScopedPointer<KactusAPI> coreAPI(new KactusAPI(mediator.data()));
 
     wchar_t *program = Py_DecodeLocale(argv[0], NULL);
@@ -231,6 +325,8 @@ int main(int argc, char *argv[])
         QScopedPointer<FileChannel> outChannel(new FileChannel(stdout));
         QScopedPointer<FileChannel> errChannel(new FileChannel(stderr));
 
+        TraceFileGuard traceGuard(parser.getOptionValue(CommandLineParser::Option::TraceFile), mediator.data());
+
         // Excecute according to mode
         if (parser.versionMode())
         {
@@ -267,6 +363,23 @@ int main(int argc, char *argv[])
             auto scriptPath = parser.getOptionValue(CommandLineParser::Option::InputScript);
             return console.runFile(scriptPath);
         }
+        else if (parser.batchMode()) // Run generation jobs and exit
+        {
+            library.searchForIPXactFiles();
+
+            int failedJobs = KactusAPI::runBatchGeneration(
+                parser.getOptionValue(CommandLineParser::Option::BatchManifest),
+                parser.getOptionValue(CommandLineParser::Option::BatchReport),
+                parser.getOptionValue(CommandLineParser::Option::WorkerCount).toInt());
+
+            return failedJobs == 0 ? 0 : 1;
+        }
+        else if (parser.diffMode()) // Compare libraries and exit
+        {
+            return runLibraryDiff(parser.getOptionValue(CommandLineParser::Option::DiffReference),
+                parser.getOptionValue(CommandLineParser::Option::DiffSubject),
+                parser.getOptionValue(CommandLineParser::Option::BatchReport), mediator.data());
+        }
 
         return 1;
     }   
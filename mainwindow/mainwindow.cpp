@@ -78,6 +78,7 @@
 #include <kactusGenerators/DocumentGenerator/documentgenerator.h>
 
 #include <KactusAPI/include/LibraryHandler.h>
+#include <KactusAPI/include/TraceRecorder.h>
 #include <library/LibraryUtils.h>
 
 #include <IPXACTmodels/common/VLNV.h>
@@ -601,6 +602,12 @@ void MainWindow::setupActions()
     actSettings_ = new QAction(QIcon(":/icons/common/graphics/settings-general.png"), tr("Settings"), this);
     connect(actSettings_, SIGNAL(triggered()), this, SLOT(openSettings()));
 
+    // Initialize the action to record a performance trace.
+    actRecordTrace_ = new QAction(QIcon(":/icons/common/graphics/control-play.png"), tr("Record Trace"), this);
+    actRecordTrace_->setCheckable(true);
+    actRecordTrace_->setToolTip(tr("Record a performance trace in Chrome trace format"));
+    connect(actRecordTrace_, SIGNAL(toggled(bool)), this, SLOT(onRecordTrace(bool)), Qt::UniqueConnection);
+
     // Initialize the action to open the about box.
     actAbout_ = new QAction(QIcon(":/icons/common/graphics/system-about.png"), tr("About"), this);
     connect(actAbout_, SIGNAL(triggered()), this, SLOT(showAbout()), Qt::UniqueConnection);
@@ -771,6 +778,7 @@ void MainWindow::setupMenus()
     //! The "System" group.
     RibbonGroup* sysGroup = new RibbonGroup(tr("System"), ribbon_);
     sysGroup->addAction(actSettings_);
+    sysGroup->addAction(actRecordTrace_);
     sysGroup->addAction(actHelp_);
     sysGroup->addAction(actAbout_);
     sysGroup->addAction(actExit_);
@@ -1065,7 +1073,20 @@ void MainWindow::updateMenuStrip()
 //-----------------------------------------------------------------------------
 void MainWindow::saveAll()
 {
-    designTabs_->saveAll();
+    // Write all the documents together once every document has been saved.
+    libraryHandler_->beginSave();
+    QList<TabDocument*> savedDocuments = designTabs_->saveAll();
+
+    // The documents were saved within this save operation, so they could not know if their files were written.
+    if (!libraryHandler_->endSave())
+    {
+        for (TabDocument* savedDocument : savedDocuments)
+        {
+            savedDocument->setModified(true);
+        }
+
+        emit errorMessage(tr("Error saving documents to disk."));
+    }
 
     TabDocument* doc = static_cast<TabDocument*>(designTabs_->currentWidget());
     actSave_->setEnabled(doc && doc->isModified());
@@ -1566,7 +1587,10 @@ void MainWindow::createDesign(KactusAttribute::ProductHierarchy prodHier, Kactus
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -1681,7 +1705,10 @@ void MainWindow::createDesignForExistingComponent(VLNV const& vlnv)
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -1805,7 +1832,10 @@ void MainWindow::createSWDesign(VLNV const& vlnv, Document::Revision revision, Q
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -1931,7 +1961,10 @@ void MainWindow::createSWDesign(VLNV const& vlnv)
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -1963,6 +1996,38 @@ void MainWindow::openSettings()
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: MainWindow::onRecordTrace()
+//-----------------------------------------------------------------------------
+void MainWindow::onRecordTrace(bool record)
+{
+    if (record)
+    {
+        TraceRecorder::start();
+        emit noticeMessage(tr("Performance trace recording started."));
+        return;
+    }
+
+    TraceRecorder::stop();
+
+    QString tracePath = QFileDialog::getSaveFileName(this, tr("Save Performance Trace"),
+        QString(), tr("Chrome trace files (*.json)"));
+    if (tracePath.isEmpty())
+    {
+        return;
+    }
+
+    if (TraceRecorder::writeChromeTrace(tracePath))
+    {
+        emit noticeMessage(tr("Performance trace of %1 events saved to %2.").arg(
+            QString::number(TraceRecorder::eventCount()), tracePath));
+    }
+    else
+    {
+        emit errorMessage(tr("Could not write performance trace %1.").arg(tracePath));
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: mainwindow::createSystem()
 //-----------------------------------------------------------------------------
@@ -2061,7 +2126,10 @@ void MainWindow::createSystem(VLNV const& compVLNV, QString const& viewName, VLN
         }
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -2165,7 +2233,10 @@ void MainWindow::createSystemDesign(VLNV const& vlnv)
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -385,6 +385,13 @@ public slots:
      */
     void openSettings();
 
+    /*!
+     *  Starts or stops recording a performance trace. When stopped, the trace is saved into a file.
+     *
+     *    @param [in] record  If true, the recording is started, otherwise it is stopped.
+     */
+    void onRecordTrace(bool record);
+
     /*!
      *  Shows the about box.
      */
@@ -856,6 +863,9 @@ private:
     //! Action to open Kactus2 settings.
     QAction* actSettings_;
 
+    //! Action to start and stop recording a performance trace.
+    QAction* actRecordTrace_ = nullptr;
+
     //! Action to show the about box.
     QAction* actAbout_;
 
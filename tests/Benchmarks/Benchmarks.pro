@@ -0,0 +1,21 @@
+#-----------------------------------------------------------------------------
+# File: Benchmarks.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file for running the performance benchmarks on synthetic libraries.
+# The benchmarks are not part of test_all.pro, since the large scales take minutes to run.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = subdirs
+
+CONFIG += testcase
+SUBDIRS += \
+            tst_LibraryBenchmark.pro \
+            tst_ExpressionBenchmark.pro \
+            tst_PathSearchBenchmark.pro \
+            tst_VerilogGeneratorBenchmark.pro \
+            tst_RoutingBenchmark.pro
@@ -0,0 +1,716 @@
+//-----------------------------------------------------------------------------
+// File: SyntheticLibrary.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Generates deterministic synthetic IP-XACT libraries for the performance benchmarks.
+//-----------------------------------------------------------------------------
+
+#include "SyntheticLibrary.h"
+
+#include <KactusAPI/include/DocumentFileAccess.h>
+
+#include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
+#include <IPXACTmodels/AbstractionDefinition/PortAbstraction.h>
+#include <IPXACTmodels/AbstractionDefinition/WireAbstraction.h>
+#include <IPXACTmodels/AbstractionDefinition/WirePort.h>
+
+#include <IPXACTmodels/BusDefinition/BusDefinition.h>
+
+#include <IPXACTmodels/common/ConfigurableVLNVReference.h>
+#include <IPXACTmodels/common/Parameter.h>
+
+#include <IPXACTmodels/Component/AbstractionType.h>
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/AddressSpace.h>
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/ComponentInstantiation.h>
+#include <IPXACTmodels/Component/DesignInstantiation.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/InitiatorInterface.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/PortMap.h>
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/TargetInterface.h>
+#include <IPXACTmodels/Component/View.h>
+
+#include <IPXACTmodels/Design/ActiveInterface.h>
+#include <IPXACTmodels/Design/ComponentInstance.h>
+#include <IPXACTmodels/Design/Design.h>
+#include <IPXACTmodels/Design/Interconnection.h>
+
+#include <QDir>
+#include <QFileInfo>
+#include <QRandomGenerator>
+
+namespace
+{
+    //! The vendor of all the synthetic documents.
+    const QString VENDOR(QStringLiteral("bench.org"));
+
+    //! The version of all the synthetic documents.
+    const QString VERSION(QStringLiteral("1.0"));
+
+    //! The seed for the generated expressions.
+    const quint32 EXPRESSION_SEED = 0x4b32;
+
+    //! The width of the data ports and registers.
+    const int DATA_WIDTH = 32;
+
+    /*!
+     *  Creates the bus definition of the library.
+     *
+     *    @return The bus definition.
+     */
+    QSharedPointer<BusDefinition> createBusDefinition();
+
+    /*!
+     *  Creates the abstraction definition of the library.
+     *
+     *    @param [in] busDefinition   The bus definition of the abstraction.
+     *
+     *    @return The abstraction definition.
+     */
+    QSharedPointer<AbstractionDefinition> createAbstractionDefinition(QSharedPointer<BusDefinition> busDefinition);
+
+    /*!
+     *  Creates a parameter.
+     *
+     *    @param [in] name    Name of the parameter.
+     *    @param [in] id      The unique id of the parameter.
+     *    @param [in] value   The value expression of the parameter.
+     *
+     *    @return The parameter.
+     */
+    QSharedPointer<Parameter> createParameter(QString const& name, QString const& id, QString const& value);
+
+    /*!
+     *  Creates a wire port.
+     *
+     *    @param [in] name        Name of the port.
+     *    @param [in] direction   Direction of the port.
+     *    @param [in] widthId     Id of the parameter defining the port width, or empty for a scalar port.
+     *
+     *    @return The port.
+     */
+    QSharedPointer<Port> createPort(QString const& name, DirectionTypes::Direction direction,
+        QString const& widthId = QString());
+
+    /*!
+     *  Creates a bus interface with port maps for the data and valid signals.
+     *
+     *    @param [in] name            Name of the interface.
+     *    @param [in] mode            Mode of the interface.
+     *    @param [in] library         The library containing the bus and abstraction definitions.
+     *    @param [in] dataPort        The physical port mapped to the data signal.
+     *    @param [in] validPort       The physical port mapped to the valid signal.
+     *
+     *    @return The bus interface.
+     */
+    QSharedPointer<BusInterface> createBusInterface(QString const& name, General::InterfaceMode mode,
+        SyntheticLibrary::Library const& library, QString const& dataPort, QString const& validPort);
+
+    /*!
+     *  Creates a memory map of registers and fields.
+     *
+     *    @param [in] scale   The dimensions of the library.
+     *
+     *    @return The memory map.
+     */
+    QSharedPointer<MemoryMap> createMemoryMap(SyntheticLibrary::Scale const& scale);
+
+    /*!
+     *  Creates a leaf component.
+     *
+     *    @param [in] index       Index of the component.
+     *    @param [in] scale       The dimensions of the library.
+     *    @param [in] library     The library containing the bus and abstraction definitions.
+     *
+     *    @return The leaf component.
+     */
+    QSharedPointer<Component> createLeafComponent(int index, SyntheticLibrary::Scale const& scale,
+        SyntheticLibrary::Library const& library);
+
+    /*!
+     *  Creates a hierarchical component and its design.
+     *
+     *    @param [in] name                Name of the component.
+     *    @param [in] instanceComponents  The components instantiated in the design.
+     *    @param [in] chainInstances      If true, the instances are connected through their bus interfaces.
+     *    @param [out] design             The created design.
+     *
+     *    @return The hierarchical component.
+     */
+    QSharedPointer<Component> createHierarchicalComponent(QString const& name,
+        QVector<QSharedPointer<Component> > const& instanceComponents, bool chainInstances,
+        QSharedPointer<Design>& design);
+
+    /*!
+     *  Creates a random operand for an expression.
+     *
+     *    @param [in] random          The random number generator.
+     *    @param [in] parameterIds    Parameter ids the operand may refer to.
+     *    @param [in] depth           The remaining nesting depth.
+     *
+     *    @return The operand.
+     */
+    QString createOperand(QRandomGenerator& random, QStringList const& parameterIds, int depth);
+
+    /*!
+     *  Creates a random expression.
+     *
+     *    @param [in] random          The random number generator.
+     *    @param [in] parameterIds    Parameter ids the expression may refer to.
+     *    @param [in] depth           The remaining nesting depth.
+     *
+     *    @return The expression.
+     */
+    QString createExpression(QRandomGenerator& random, QStringList const& parameterIds, int depth);
+
+    //-----------------------------------------------------------------------------
+    // Function: createBusDefinition()
+    //-----------------------------------------------------------------------------
+    QSharedPointer<BusDefinition> createBusDefinition()
+    {
+        VLNV busVLNV(VLNV::BUSDEFINITION, VENDOR, QStringLiteral("bus"), QStringLiteral("data_bus"), VERSION);
+
+        QSharedPointer<BusDefinition> busDefinition(new BusDefinition(busVLNV, Document::Revision::Std14));
+        busDefinition->setDirectConnection(true);
+        busDefinition->setIsAddressable(true);
+
+        return busDefinition;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createAbstractionDefinition()
+    //-----------------------------------------------------------------------------
+    QSharedPointer<AbstractionDefinition> createAbstractionDefinition(QSharedPointer<BusDefinition> busDefinition)
+    {
+        VLNV abstractionVLNV(VLNV::ABSTRACTIONDEFINITION, VENDOR, QStringLiteral("bus"),
+            QStringLiteral("data_bus.absDef"), VERSION);
+
+        QSharedPointer<AbstractionDefinition> abstraction(
+            new AbstractionDefinition(abstractionVLNV, Document::Revision::Std14));
+        abstraction->setBusType(busDefinition->getVlnv());
+
+        const QVector<QPair<QString, int> > signalWidths({ { QStringLiteral("DATA"), DATA_WIDTH },
+            { QStringLiteral("VALID"), 1 } });
+
+        for (auto const& signal : signalWidths)
+        {
+            QSharedPointer<WirePort> masterPort(new WirePort());
+            masterPort->setDirection(DirectionTypes::OUT);
+            masterPort->setWidth(QString::number(signal.second));
+            masterPort->setPresence(PresenceTypes::REQUIRED);
+
+            QSharedPointer<WirePort> slavePort(new WirePort());
+            slavePort->setDirection(DirectionTypes::IN);
+            slavePort->setWidth(QString::number(signal.second));
+            slavePort->setPresence(PresenceTypes::REQUIRED);
+
+            QSharedPointer<WireAbstraction> wire(new WireAbstraction());
+            wire->setMasterPort(masterPort);
+            wire->setSlavePort(slavePort);
+
+            QSharedPointer<PortAbstraction> logicalPort(new PortAbstraction());
+            logicalPort->setLogicalName(signal.first);
+            logicalPort->setWire(wire);
+
+            abstraction->getLogicalPorts()->append(logicalPort);
+        }
+
+        return abstraction;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createParameter()
+    //-----------------------------------------------------------------------------
+    QSharedPointer<Parameter> createParameter(QString const& name, QString const& id, QString const& value)
+    {
+        QSharedPointer<Parameter> parameter(new Parameter());
+        parameter->setName(name);
+        parameter->setValueId(id);
+        parameter->setValue(value);
+        parameter->setType(QStringLiteral("int"));
+
+        return parameter;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createPort()
+    //-----------------------------------------------------------------------------
+    QSharedPointer<Port> createPort(QString const& name, DirectionTypes::Direction direction,
+        QString const& widthId)
+    {
+        QSharedPointer<Port> port(new Port(name));
+        port->setDirection(direction);
+
+        if (widthId.isEmpty() == false)
+        {
+            port->setLeftBound(widthId + QStringLiteral("-1"));
+            port->setRightBound(QStringLiteral("0"));
+        }
+
+        return port;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createBusInterface()
+    //-----------------------------------------------------------------------------
+    QSharedPointer<BusInterface> createBusInterface(QString const& name, General::InterfaceMode mode,
+        SyntheticLibrary::Library const& library, QString const& dataPort, QString const& validPort)
+    {
+        QSharedPointer<BusInterface> busInterface(new BusInterface());
+        busInterface->setName(name);
+        busInterface->setInterfaceMode(mode);
+        busInterface->setBusType(ConfigurableVLNVReference(library.busDefinition->getVlnv()));
+
+        QSharedPointer<AbstractionType> abstractionType(new AbstractionType());
+        abstractionType->setAbstractionRef(QSharedPointer<ConfigurableVLNVReference>(
+            new ConfigurableVLNVReference(library.abstractionDefinition->getVlnv())));
+
+        const QVector<QPair<QString, QString> > mappings({ { QStringLiteral("DATA"), dataPort },
+            { QStringLiteral("VALID"), validPort } });
+
+        for (auto const& mapping : mappings)
+        {
+            QSharedPointer<PortMap> portMap(new PortMap());
+            portMap->setLogicalPort(QSharedPointer<PortMap::LogicalPort>(new PortMap::LogicalPort(mapping.first)));
+            portMap->setPhysicalPort(
+                QSharedPointer<PortMap::PhysicalPort>(new PortMap::PhysicalPort(mapping.second)));
+
+            abstractionType->getPortMaps()->append(portMap);
+        }
+
+        busInterface->getAbstractionTypes()->append(abstractionType);
+
+        return busInterface;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createMemoryMap()
+    //-----------------------------------------------------------------------------
+    QSharedPointer<MemoryMap> createMemoryMap(SyntheticLibrary::Scale const& scale)
+    {
+        const int registerBytes = DATA_WIDTH / 8;
+        const int fieldWidth = qMax(1, DATA_WIDTH / qMax(1, scale.fieldCount));
+
+        QSharedPointer<AddressBlock> addressBlock(new AddressBlock(QStringLiteral("registers"),
+            QStringLiteral("'h0")));
+        addressBlock->setRange(QString::number(scale.registerCount * registerBytes));
+        addressBlock->setWidth(QString::number(DATA_WIDTH));
+
+        for (int registerIndex = 0; registerIndex < scale.registerCount; ++registerIndex)
+        {
+            QSharedPointer<Register> targetRegister(new Register(QStringLiteral("reg_%1").arg(registerIndex),
+                QStringLiteral("'h%1").arg(registerIndex * registerBytes, 0, 16), QString::number(DATA_WIDTH)));
+
+            for (int fieldIndex = 0; fieldIndex < scale.fieldCount && fieldIndex * fieldWidth < DATA_WIDTH;
+                ++fieldIndex)
+            {
+                QSharedPointer<Field> field(new Field(QStringLiteral("field_%1").arg(fieldIndex)));
+                field->setBitOffset(QString::number(fieldIndex * fieldWidth));
+                field->setBitWidth(QString::number(fieldWidth));
+
+                targetRegister->getFields()->append(field);
+            }
+
+            addressBlock->getRegisterData()->append(targetRegister);
+        }
+
+        QSharedPointer<MemoryMap> memoryMap(new MemoryMap(QStringLiteral("register_map")));
+        memoryMap->setAddressUnitBits(QStringLiteral("8"));
+        memoryMap->getMemoryBlocks()->append(addressBlock);
+
+        return memoryMap;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createLeafComponent()
+    //-----------------------------------------------------------------------------
+    QSharedPointer<Component> createLeafComponent(int index, SyntheticLibrary::Scale const& scale,
+        SyntheticLibrary::Library const& library)
+    {
+        QString name = QStringLiteral("leaf_%1").arg(index, 4, 10, QLatin1Char('0'));
+        VLNV componentVLNV(VLNV::COMPONENT, VENDOR, QStringLiteral("ip"), name, VERSION);
+
+        QSharedPointer<Component> component(new Component(componentVLNV, Document::Revision::Std14));
+
+        QString widthId = QStringLiteral("uuid_%1_width").arg(name);
+        QString depthId = QStringLiteral("uuid_%1_depth").arg(name);
+        component->getParameters()->append(createParameter(QStringLiteral("WIDTH"), widthId,
+            QString::number(DATA_WIDTH)));
+        component->getParameters()->append(createParameter(QStringLiteral("DEPTH"), depthId,
+            QStringLiteral("%1*%2").arg(widthId, QString::number(scale.registerCount))));
+        component->getParameters()->append(createParameter(QStringLiteral("BASE"),
+            QStringLiteral("uuid_%1_base").arg(name),
+            QStringLiteral("'h%1+$clog2(%2)").arg(QString::number(index * 0x1000, 16), depthId)));
+
+        component->getPorts()->append(createPort(QStringLiteral("clk"), DirectionTypes::IN));
+        component->getPorts()->append(createPort(QStringLiteral("rst_n"), DirectionTypes::IN));
+        component->getPorts()->append(createPort(QStringLiteral("data_in"), DirectionTypes::IN, widthId));
+        component->getPorts()->append(createPort(QStringLiteral("valid_in"), DirectionTypes::IN));
+        component->getPorts()->append(createPort(QStringLiteral("data_out"), DirectionTypes::OUT, widthId));
+        component->getPorts()->append(createPort(QStringLiteral("valid_out"), DirectionTypes::OUT));
+
+        QSharedPointer<MemoryMap> memoryMap = createMemoryMap(scale);
+        component->getMemoryMaps()->append(memoryMap);
+
+        QSharedPointer<AddressSpace> addressSpace(new AddressSpace(QStringLiteral("bus_space"),
+            QStringLiteral("4*1024*1024*1024"), QString::number(DATA_WIDTH)));
+        component->getAddressSpaces()->append(addressSpace);
+
+        QSharedPointer<BusInterface> target = createBusInterface(QStringLiteral("target"), General::SLAVE,
+            library, QStringLiteral("data_in"), QStringLiteral("valid_in"));
+        QSharedPointer<TargetInterface> targetInterface(new TargetInterface());
+        targetInterface->setMemoryMapRef(memoryMap->name());
+        target->setSlave(targetInterface);
+        component->getBusInterfaces()->append(target);
+
+        QSharedPointer<BusInterface> initiator = createBusInterface(QStringLiteral("initiator"), General::MASTER,
+            library, QStringLiteral("data_out"), QStringLiteral("valid_out"));
+        QSharedPointer<InitiatorInterface> initiatorInterface(new InitiatorInterface());
+        initiatorInterface->setAddressSpaceRef(addressSpace->name());
+        initiator->setMaster(initiatorInterface);
+        component->getBusInterfaces()->append(initiator);
+
+        QSharedPointer<ComponentInstantiation> instantiation(new ComponentInstantiation(QStringLiteral("rtl")));
+        instantiation->setLanguage(QStringLiteral("Verilog"));
+        instantiation->setModuleName(name);
+        component->getComponentInstantiations()->append(instantiation);
+
+        QSharedPointer<View> view(new View(QStringLiteral("rtl")));
+        view->setComponentInstantiationRef(instantiation->name());
+        component->getViews()->append(view);
+
+        return component;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createHierarchicalComponent()
+    //-----------------------------------------------------------------------------
+    QSharedPointer<Component> createHierarchicalComponent(QString const& name,
+        QVector<QSharedPointer<Component> > const& instanceComponents, bool chainInstances,
+        QSharedPointer<Design>& design)
+    {
+        VLNV componentVLNV(VLNV::COMPONENT, VENDOR, QStringLiteral("hier"), name, VERSION);
+        VLNV designVLNV(VLNV::DESIGN, VENDOR, QStringLiteral("hier"), name + QStringLiteral(".design"), VERSION);
+
+        QSharedPointer<Component> component(new Component(componentVLNV, Document::Revision::Std14));
+        component->getPorts()->append(createPort(QStringLiteral("clk"), DirectionTypes::IN));
+        component->getPorts()->append(createPort(QStringLiteral("rst_n"), DirectionTypes::IN));
+
+        QSharedPointer<DesignInstantiation> designInstantiation(
+            new DesignInstantiation(QStringLiteral("structural_design")));
+        designInstantiation->setDesignReference(
+            QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(designVLNV)));
+        component->getDesignInstantiations()->append(designInstantiation);
+
+        QSharedPointer<View> view(new View(QStringLiteral("structural")));
+        view->setDesignInstantiationRef(designInstantiation->name());
+        component->getViews()->append(view);
+
+        design = QSharedPointer<Design>(new Design(designVLNV, Document::Revision::Std14));
+
+        QStringList instanceNames;
+        for (QSharedPointer<Component> instanceComponent : instanceComponents)
+        {
+            QString instanceName = QStringLiteral("u%1_%2").arg(QString::number(instanceNames.size()),
+                instanceComponent->getVlnv().getName());
+            instanceNames.append(instanceName);
+
+            QSharedPointer<ComponentInstance> instance(new ComponentInstance(instanceName,
+                QSharedPointer<ConfigurableVLNVReference>(
+                    new ConfigurableVLNVReference(instanceComponent->getVlnv()))));
+            design->getComponentInstances()->append(instance);
+        }
+
+        for (int i = 0; chainInstances && i + 1 < instanceNames.size(); ++i)
+        {
+            QSharedPointer<ActiveInterface> start(new ActiveInterface(instanceNames.at(i),
+                QStringLiteral("initiator")));
+            QSharedPointer<ActiveInterface> end(new ActiveInterface(instanceNames.at(i + 1),
+                QStringLiteral("target")));
+
+            QSharedPointer<Interconnection> connection(new Interconnection(
+                QStringLiteral("%1_to_%2").arg(instanceNames.at(i), instanceNames.at(i + 1)), start));
+            connection->getActiveInterfaces()->append(end);
+
+            design->getInterconnections()->append(connection);
+        }
+
+        return component;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createOperand()
+    //-----------------------------------------------------------------------------
+    QString createOperand(QRandomGenerator& random, QStringList const& parameterIds, int depth)
+    {
+        int choice = random.bounded(depth > 0 ? 7 : 4);
+
+        if (choice == 0)
+        {
+            return QString::number(random.bounded(1, 1024));
+        }
+        else if (choice == 1)
+        {
+            return QStringLiteral("'h") + QString::number(random.bounded(1, 0x10000), 16);
+        }
+        else if (choice == 2)
+        {
+            return QStringLiteral("8'b") + QString::number(random.bounded(1, 256), 2);
+        }
+        else if (choice == 3)
+        {
+            if (parameterIds.isEmpty())
+            {
+                return QString::number(random.bounded(1, 64));
+            }
+
+            return parameterIds.at(random.bounded(parameterIds.size()));
+        }
+        else if (choice == 4)
+        {
+            return QStringLiteral("$clog2(") + createExpression(random, parameterIds, depth - 1) +
+                QStringLiteral(")");
+        }
+        else if (choice == 5)
+        {
+            return createOperand(random, parameterIds, depth - 1) + QStringLiteral(" > ") +
+                createOperand(random, parameterIds, depth - 1) + QStringLiteral(" ? ") +
+                createOperand(random, parameterIds, depth - 1) + QStringLiteral(" : ") +
+                createOperand(random, parameterIds, depth - 1);
+        }
+
+        return QStringLiteral("(") + createExpression(random, parameterIds, depth - 1) + QStringLiteral(")");
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createExpression()
+    //-----------------------------------------------------------------------------
+    QString createExpression(QRandomGenerator& random, QStringList const& parameterIds, int depth)
+    {
+        // Division and modulo take a non-zero literal on the right side.
+        const QStringList operators({ QStringLiteral("+"), QStringLiteral("-"), QStringLiteral("*"),
+            QStringLiteral("/"), QStringLiteral("%"), QStringLiteral("<<"), QStringLiteral("&"),
+            QStringLiteral("|") });
+
+        QString expression = createOperand(random, parameterIds, depth);
+
+        int operandCount = random.bounded(1, 4);
+        for (int i = 0; i < operandCount; ++i)
+        {
+            QString const& operation = operators.at(random.bounded(operators.size()));
+            expression.append(QLatin1Char(' ') + operation + QLatin1Char(' '));
+
+            if (operation == QLatin1String("/") || operation == QLatin1String("%"))
+            {
+                expression.append(QString::number(random.bounded(1, 64)));
+            }
+            else if (operation == QLatin1String("<<"))
+            {
+                expression.append(QString::number(random.bounded(0, 8)));
+            }
+            else
+            {
+                expression.append(createOperand(random, parameterIds, depth));
+            }
+        }
+
+        return expression;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibrary::standardScales()
+//-----------------------------------------------------------------------------
+QVector<SyntheticLibrary::Scale> SyntheticLibrary::standardScales()
+{
+    // The bottom designs instantiate all the leaf components exactly once:
+    // componentCount == instancesPerDesign ^ hierarchyDepth.
+    Scale small;
+    small.name = QStringLiteral("small");
+    small.componentCount = 16;
+    small.registerCount = 8;
+    small.fieldCount = 4;
+    small.hierarchyDepth = 2;
+    small.instancesPerDesign = 4;
+
+    Scale medium;
+    medium.name = QStringLiteral("medium");
+    medium.componentCount = 125;
+    medium.registerCount = 16;
+    medium.fieldCount = 4;
+    medium.hierarchyDepth = 3;
+    medium.instancesPerDesign = 5;
+
+    Scale large;
+    large.name = QStringLiteral("large");
+    large.componentCount = 1000;
+    large.registerCount = 32;
+    large.fieldCount = 8;
+    large.hierarchyDepth = 3;
+    large.instancesPerDesign = 10;
+
+    return QVector<Scale>({ small, medium, large });
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibrary::create()
+//-----------------------------------------------------------------------------
+SyntheticLibrary::Library SyntheticLibrary::create(Scale const& scale)
+{
+    Library library;
+    library.busDefinition = createBusDefinition();
+    library.abstractionDefinition = createAbstractionDefinition(library.busDefinition);
+
+    for (int i = 0; i < scale.componentCount; ++i)
+    {
+        library.leafComponents.append(createLeafComponent(i, scale, library));
+    }
+
+    if (scale.hierarchyDepth < 1 || scale.componentCount < 1)
+    {
+        return library;
+    }
+
+    // Create the tree bottom-up, so that the child components exist when their parents are created.
+    QVector<QSharedPointer<Component> > children;
+    QVector<QSharedPointer<Component> > hierarchicalComponents;
+    QVector<QSharedPointer<Design> > designs;
+
+    for (int level = scale.hierarchyDepth - 1; level >= 0; --level)
+    {
+        int nodeCount = 1;
+        for (int i = 0; i < level; ++i)
+        {
+            nodeCount *= scale.instancesPerDesign;
+        }
+
+        bool bottomLevel = level == scale.hierarchyDepth - 1;
+
+        QVector<QSharedPointer<Component> > levelComponents;
+        QVector<QSharedPointer<Design> > levelDesigns;
+        for (int node = 0; node < nodeCount; ++node)
+        {
+            QVector<QSharedPointer<Component> > instanceComponents;
+            for (int i = 0; i < scale.instancesPerDesign; ++i)
+            {
+                int childIndex = node * scale.instancesPerDesign + i;
+                if (bottomLevel)
+                {
+                    instanceComponents.append(library.leafComponents.at(childIndex % scale.componentCount));
+                }
+                else
+                {
+                    instanceComponents.append(children.at(childIndex));
+                }
+            }
+
+            QSharedPointer<Design> design;
+            levelComponents.append(createHierarchicalComponent(
+                QStringLiteral("level%1_%2").arg(QString::number(level), QString::number(node)),
+                instanceComponents, bottomLevel, design));
+            levelDesigns.append(design);
+        }
+
+        hierarchicalComponents = levelComponents + hierarchicalComponents;
+        designs = levelDesigns + designs;
+        children = levelComponents;
+    }
+
+    library.hierarchicalComponents = hierarchicalComponents;
+    library.designs = designs;
+
+    return library;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibrary::documents()
+//-----------------------------------------------------------------------------
+QVector<QSharedPointer<Document> > SyntheticLibrary::documents(Library const& library)
+{
+    QVector<QSharedPointer<Document> > allDocuments;
+    allDocuments.append(library.busDefinition);
+    allDocuments.append(library.abstractionDefinition);
+
+    for (QSharedPointer<Component> component : library.leafComponents)
+    {
+        allDocuments.append(component);
+    }
+
+    for (QSharedPointer<Design> design : library.designs)
+    {
+        allDocuments.append(design);
+    }
+
+    for (int i = library.hierarchicalComponents.size() - 1; i >= 0; --i)
+    {
+        allDocuments.append(library.hierarchicalComponents.at(i));
+    }
+
+    return allDocuments;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibrary::topComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> SyntheticLibrary::topComponent(Library const& library)
+{
+    if (library.hierarchicalComponents.isEmpty())
+    {
+        return QSharedPointer<Component>();
+    }
+
+    return library.hierarchicalComponents.first();
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibrary::documentPath()
+//-----------------------------------------------------------------------------
+QString SyntheticLibrary::documentPath(QString const& rootPath, VLNV const& vlnv)
+{
+    return QStringLiteral("%1/%2/%3/%4/%5/%4.%5.xml").arg(rootPath, vlnv.getVendor(), vlnv.getLibrary(),
+        vlnv.getName(), vlnv.getVersion());
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibrary::write()
+//-----------------------------------------------------------------------------
+bool SyntheticLibrary::write(Library const& library, QString const& rootPath)
+{
+    for (QSharedPointer<Document> document : documents(library))
+    {
+        QString path = documentPath(rootPath, document->getVlnv());
+        if (QDir().mkpath(QFileInfo(path).absolutePath()) == false ||
+            DocumentFileAccess::writeDocument(document, path) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibrary::createExpressions()
+//-----------------------------------------------------------------------------
+QStringList SyntheticLibrary::createExpressions(int count, QStringList const& parameterIds)
+{
+    QRandomGenerator random(EXPRESSION_SEED);
+
+    QStringList expressions;
+    expressions.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        expressions.append(createExpression(random, parameterIds, 2));
+    }
+
+    return expressions;
+}
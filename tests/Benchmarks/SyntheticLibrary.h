@@ -0,0 +1,144 @@
+//-----------------------------------------------------------------------------
+// File: SyntheticLibrary.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Generates deterministic synthetic IP-XACT libraries for the performance benchmarks.
+//-----------------------------------------------------------------------------
+
+#ifndef SYNTHETICLIBRARY_H
+#define SYNTHETICLIBRARY_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class AbstractionDefinition;
+class BusDefinition;
+class Component;
+class Design;
+class Document;
+
+//-----------------------------------------------------------------------------
+//! Generates deterministic synthetic IP-XACT libraries for the performance benchmarks.
+//!
+//! A library consists of a bus definition, an abstraction definition, leaf components with memory maps and
+//! a tree of hierarchical components. Every hierarchical component has a design instantiating its children, and
+//! the designs at the bottom of the tree instantiate the leaf components chained through their bus interfaces.
+//! The same scale always produces identical documents.
+//-----------------------------------------------------------------------------
+namespace SyntheticLibrary
+{
+    //! The dimensions of a synthetic library.
+    struct Scale
+    {
+        //! Name of the scale used in the benchmark results.
+        QString name;
+
+        //! Number of leaf components.
+        int componentCount = 16;
+
+        //! Number of registers in the memory map of each leaf component.
+        int registerCount = 8;
+
+        //! Number of fields in each register.
+        int fieldCount = 4;
+
+        //! Number of hierarchical levels above the leaf components.
+        int hierarchyDepth = 2;
+
+        //! Number of component instances in each design.
+        int instancesPerDesign = 4;
+    };
+
+    //! The documents of a synthetic library.
+    struct Library
+    {
+        //! The bus definition used by all bus interfaces.
+        QSharedPointer<BusDefinition> busDefinition;
+
+        //! The abstraction definition used by all bus interfaces.
+        QSharedPointer<AbstractionDefinition> abstractionDefinition;
+
+        //! The leaf components.
+        QVector<QSharedPointer<Component> > leafComponents;
+
+        //! The hierarchical components, starting from the top component.
+        QVector<QSharedPointer<Component> > hierarchicalComponents;
+
+        //! The designs of the hierarchical components in the same order.
+        QVector<QSharedPointer<Design> > designs;
+    };
+
+    /*!
+     *  Gets the scales used by the benchmarks.
+     *
+     *    @return The small, medium and large scale.
+     */
+    QVector<Scale> standardScales();
+
+    /*!
+     *  Creates a synthetic library.
+     *
+     *    @param [in] scale   The dimensions of the library.
+     *
+     *    @return The created library.
+     */
+    Library create(Scale const& scale);
+
+    /*!
+     *  Gets all the documents of a library.
+     *
+     *    @param [in] library     The library.
+     *
+     *    @return The documents, definitions first and the top component last.
+     */
+    QVector<QSharedPointer<Document> > documents(Library const& library);
+
+    /*!
+     *  Gets the top component of a library.
+     *
+     *    @param [in] library     The library.
+     *
+     *    @return The top component.
+     */
+    QSharedPointer<Component> topComponent(Library const& library);
+
+    /*!
+     *  Gets the path of a document in a library directory structure.
+     *
+     *    @param [in] rootPath    The root directory of the library.
+     *    @param [in] vlnv        The VLNV of the document.
+     *
+     *    @return The path in the form root/vendor/library/name/version/name.version.xml.
+     */
+    QString documentPath(QString const& rootPath, VLNV const& vlnv);
+
+    /*!
+     *  Writes all the documents of a library into a directory.
+     *
+     *    @param [in] library     The library to write.
+     *    @param [in] rootPath    The root directory of the library.
+     *
+     *    @return True, if all the documents were written, otherwise false.
+     */
+    bool write(Library const& library, QString const& rootPath);
+
+    /*!
+     *  Creates SystemVerilog expressions of mixed complexity.
+     *
+     *    @param [in] count           Number of expressions to create.
+     *    @param [in] parameterIds    Parameter ids the expressions may refer to.
+     *
+     *    @return The created expressions. The same arguments always produce the same expressions.
+     */
+    QStringList createExpressions(int count, QStringList const& parameterIds = QStringList());
+}
+
+#endif // SYNTHETICLIBRARY_H
@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// File: tst_ExpressionBenchmark.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Performance benchmarks for the expression parsers.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include "SyntheticLibrary.h"
+
+#include <KactusAPI/include/ComponentParameterFinder.h>
+#include <KactusAPI/include/IPXactSystemVerilogParser.h>
+#include <KactusAPI/include/SystemVerilogExpressionParser.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+#include <IPXACTmodels/Component/Component.h>
+
+class tst_ExpressionBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ExpressionBenchmark();
+
+private slots:
+
+    void benchmarkSystemVerilogExpressions();
+    void benchmarkSystemVerilogExpressions_data();
+
+    void benchmarkReferencingExpressions();
+    void benchmarkReferencingExpressions_data();
+
+private:
+
+    /*!
+     *  Adds a data row for each standard scale.
+     */
+    void createScaleData();
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionBenchmark::tst_ExpressionBenchmark()
+//-----------------------------------------------------------------------------
+tst_ExpressionBenchmark::tst_ExpressionBenchmark()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionBenchmark::benchmarkSystemVerilogExpressions()
+//-----------------------------------------------------------------------------
+void tst_ExpressionBenchmark::benchmarkSystemVerilogExpressions()
+{
+    QFETCH(int, expressionCount);
+
+    QStringList expressions = SyntheticLibrary::createExpressions(expressionCount);
+    SystemVerilogExpressionParser parser;
+
+    int validCount = 0;
+    QBENCHMARK
+    {
+        validCount = 0;
+        for (QString const& expression : expressions)
+        {
+            bool isValid = false;
+            parser.parseExpression(expression, &isValid);
+            if (isValid)
+            {
+                ++validCount;
+            }
+        }
+    }
+
+    QVERIFY(validCount > 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionBenchmark::benchmarkSystemVerilogExpressions_data()
+//-----------------------------------------------------------------------------
+void tst_ExpressionBenchmark::benchmarkSystemVerilogExpressions_data()
+{
+    createScaleData();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionBenchmark::benchmarkReferencingExpressions()
+//-----------------------------------------------------------------------------
+void tst_ExpressionBenchmark::benchmarkReferencingExpressions()
+{
+    QFETCH(int, expressionCount);
+
+    SyntheticLibrary::Scale scale;
+    scale.componentCount = 1;
+    scale.hierarchyDepth = 0;
+
+    QSharedPointer<Component> component = SyntheticLibrary::create(scale).leafComponents.first();
+
+    QStringList parameterIds;
+    for (QSharedPointer<Parameter> parameter : *component->getParameters())
+    {
+        parameterIds.append(parameter->getValueId());
+    }
+
+    QStringList expressions = SyntheticLibrary::createExpressions(expressionCount, parameterIds);
+
+    QSharedPointer<ComponentParameterFinder> finder(new ComponentParameterFinder(component));
+    IPXactSystemVerilogParser parser(finder);
+
+    int validCount = 0;
+    QBENCHMARK
+    {
+        validCount = 0;
+        for (QString const& expression : expressions)
+        {
+            bool isValid = false;
+            parser.parseExpression(expression, &isValid);
+            if (isValid)
+            {
+                ++validCount;
+            }
+        }
+    }
+
+    QVERIFY(validCount > 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionBenchmark::benchmarkReferencingExpressions_data()
+//-----------------------------------------------------------------------------
+void tst_ExpressionBenchmark::benchmarkReferencingExpressions_data()
+{
+    createScaleData();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ExpressionBenchmark::createScaleData()
+//-----------------------------------------------------------------------------
+void tst_ExpressionBenchmark::createScaleData()
+{
+    QTest::addColumn<int>("expressionCount");
+
+    // Scale the number of expressions with the library size, e.g. for evaluating all the parameters.
+    for (SyntheticLibrary::Scale const& scale : SyntheticLibrary::standardScales())
+    {
+        QTest::newRow(scale.name.toLatin1().constData()) << scale.componentCount * scale.registerCount * 8;
+    }
+}
+
+QTEST_GUILESS_MAIN(tst_ExpressionBenchmark)
+
+#include "tst_ExpressionBenchmark.moc"
@@ -0,0 +1,8 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ./SyntheticLibrary.h
+
+SOURCES += ./SyntheticLibrary.cpp \
+    ./tst_ExpressionBenchmark.cpp
@@ -0,0 +1,331 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryBenchmark.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Performance benchmarks for loading and validating synthetic libraries.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QTemporaryDir>
+
+#include "SyntheticLibrary.h"
+
+#include <KactusAPI/include/DocumentValidator.h>
+#include <KactusAPI/include/LibraryHandler.h>
+#include <KactusAPI/include/LibraryLoader.h>
+#include <KactusAPI/include/NullChannel.h>
+
+#include <IPXACTmodels/Component/Component.h>
+
+class tst_LibraryBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryBenchmark();
+
+private slots:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchmarkParseLibrary();
+    void benchmarkParseLibrary_data();
+
+    void benchmarkSearchForIPXactFiles();
+    void benchmarkSearchForIPXactFiles_data();
+
+    void benchmarkGetModel();
+    void benchmarkGetModel_data();
+
+    void benchmarkGetModelWithCacheBudget();
+    void benchmarkGetModelWithCacheBudget_data();
+
+    void benchmarkValidateDocuments();
+    void benchmarkValidateDocuments_data();
+
+private:
+
+    /*!
+     *  Adds a data row for each standard scale.
+     */
+    void createScaleData();
+
+    /*!
+     *  Writes the synthetic library of the current data row and sets it as the only library location.
+     *
+     *    @param [out] library    The created library.
+     */
+    void writeLibrary(SyntheticLibrary::Library& library);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The directory for the written libraries.
+    QTemporaryDir libraryDirectory_;
+
+    //! Discards the messages from the library.
+    NullChannel messages_;
+};
+
+Q_DECLARE_METATYPE(SyntheticLibrary::Scale)
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::tst_LibraryBenchmark()
+//-----------------------------------------------------------------------------
+tst_LibraryBenchmark::tst_LibraryBenchmark(): libraryDirectory_(), messages_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::initTestCase()
+{
+    QVERIFY(libraryDirectory_.isValid());
+
+    // Keep the benchmark settings separate from the user settings.
+    QCoreApplication::setOrganizationName(QStringLiteral("TUT"));
+    QCoreApplication::setApplicationName(QStringLiteral("Kactus2Benchmarks"));
+
+    LibraryHandler::getInstance().setOutputChannel(&messages_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::cleanupTestCase()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::cleanupTestCase()
+{
+    QSettings settings;
+    settings.remove(QStringLiteral("Library"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkParseLibrary()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkParseLibrary()
+{
+    SyntheticLibrary::Library library;
+    writeLibrary(library);
+
+    LibraryLoader loader;
+    QVector<LibraryLoader::LoadTarget> targets;
+
+    QBENCHMARK
+    {
+        targets = loader.parseLibrary(&messages_);
+    }
+
+    QCOMPARE(targets.size(), SyntheticLibrary::documents(library).size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkParseLibrary_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkParseLibrary_data()
+{
+    createScaleData();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkSearchForIPXactFiles()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkSearchForIPXactFiles()
+{
+    SyntheticLibrary::Library library;
+    writeLibrary(library);
+
+    LibraryHandler& handler = LibraryHandler::getInstance();
+
+    QBENCHMARK
+    {
+        handler.searchForIPXactFiles();
+    }
+
+    QCOMPARE(handler.getAllVLNVs().size(), SyntheticLibrary::documents(library).size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkSearchForIPXactFiles_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkSearchForIPXactFiles_data()
+{
+    createScaleData();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkGetModel()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkGetModel()
+{
+    SyntheticLibrary::Library library;
+    writeLibrary(library);
+
+    LibraryHandler& handler = LibraryHandler::getInstance();
+    handler.searchForIPXactFiles();
+
+    QVector<VLNV> vlnvs;
+    for (QSharedPointer<Document> document : SyntheticLibrary::documents(library))
+    {
+        vlnvs.append(document->getVlnv());
+    }
+
+    int foundCount = 0;
+    QBENCHMARK
+    {
+        foundCount = 0;
+        for (VLNV const& vlnv : vlnvs)
+        {
+            if (handler.getModel(vlnv).isNull() == false)
+            {
+                ++foundCount;
+            }
+        }
+    }
+
+    QCOMPARE(foundCount, vlnvs.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkGetModel_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkGetModel_data()
+{
+    createScaleData();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkGetModelWithCacheBudget()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkGetModelWithCacheBudget()
+{
+    SyntheticLibrary::Library library;
+    writeLibrary(library);
+
+    LibraryHandler& handler = LibraryHandler::getInstance();
+    handler.searchForIPXactFiles();
+
+    QVector<VLNV> vlnvs;
+    for (QSharedPointer<Document> document : SyntheticLibrary::documents(library))
+    {
+        vlnvs.append(document->getVlnv());
+    }
+
+    for (VLNV const& vlnv : vlnvs)
+    {
+        handler.getModelReadOnly(vlnv);
+    }
+
+    // Only a quarter of the library fits in the cache, so reading the library in order evicts every document.
+    qint64 const budget = handler.getCacheStatistics().residentBytes / 4;
+    handler.setCacheBudget(budget);
+
+    int foundCount = 0;
+    QBENCHMARK
+    {
+        foundCount = 0;
+        for (VLNV const& vlnv : vlnvs)
+        {
+            if (handler.getModel(vlnv).isNull() == false)
+            {
+                ++foundCount;
+            }
+        }
+    }
+
+    LibraryHandler::CacheStatistics const statistics = handler.getCacheStatistics();
+    handler.setCacheBudget(0);
+
+    QCOMPARE(foundCount, vlnvs.size());
+    QVERIFY(statistics.evictions > 0);
+    QVERIFY(statistics.residentBytes <= budget);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkGetModelWithCacheBudget_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkGetModelWithCacheBudget_data()
+{
+    createScaleData();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkValidateDocuments()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkValidateDocuments()
+{
+    SyntheticLibrary::Library library;
+    writeLibrary(library);
+
+    LibraryHandler& handler = LibraryHandler::getInstance();
+    handler.searchForIPXactFiles();
+
+    QVector<QSharedPointer<Document> > documents = SyntheticLibrary::documents(library);
+    DocumentValidator validator(&handler);
+
+    int validCount = 0;
+    QBENCHMARK
+    {
+        validCount = 0;
+        for (QSharedPointer<Document> document : documents)
+        {
+            if (validator.validate(document))
+            {
+                ++validCount;
+            }
+        }
+    }
+
+    QCOMPARE(validCount, documents.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::benchmarkValidateDocuments_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::benchmarkValidateDocuments_data()
+{
+    createScaleData();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::createScaleData()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::createScaleData()
+{
+    QTest::addColumn<SyntheticLibrary::Scale>("scale");
+
+    for (SyntheticLibrary::Scale const& scale : SyntheticLibrary::standardScales())
+    {
+        QTest::newRow(scale.name.toLatin1().constData()) << scale;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryBenchmark::writeLibrary()
+//-----------------------------------------------------------------------------
+void tst_LibraryBenchmark::writeLibrary(SyntheticLibrary::Library& library)
+{
+    QFETCH(SyntheticLibrary::Scale, scale);
+
+    QString libraryPath = libraryDirectory_.filePath(scale.name);
+    library = SyntheticLibrary::create(scale);
+
+    if (QFileInfo::exists(libraryPath) == false)
+    {
+        QVERIFY(SyntheticLibrary::write(library, libraryPath));
+    }
+
+    QSettings settings;
+    settings.setValue(QStringLiteral("Library/Locations"), QStringList(libraryPath));
+    settings.setValue(QStringLiteral("Library/ActiveLocations"), QStringList(libraryPath));
+}
+
+QTEST_GUILESS_MAIN(tst_LibraryBenchmark)
+
+#include "tst_LibraryBenchmark.moc"
@@ -0,0 +1,14 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../KactusAPI/include/DocumentValidator.h \
+    ../../KactusAPI/include/LibraryLoader.h \
+    ../../KactusAPI/include/NullChannel.h \
+    ./SyntheticLibrary.h
+
+SOURCES += ../../KactusAPI/library/DocumentValidator.cpp \
+    ../../KactusAPI/library/LibraryLoader.cpp \
+    ../../KactusAPI/utilities/NullChannel.cpp \
+    ./SyntheticLibrary.cpp \
+    ./tst_LibraryBenchmark.cpp
@@ -0,0 +1,53 @@
+#-----------------------------------------------------------------------------
+# File: tst_LibraryBenchmark.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file for running the library loading and validation benchmarks.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core xml testlib
+QT -= gui widgets
+CONFIG += c++17 testcase console
+
+# Store the results in a machine-readable form next to the plain text log.
+QMAKE_EXPORTED_VARIABLES += MAKE_TESTARGS
+MAKE_TESTARGS.name = TESTARGS
+MAKE_TESTARGS.value = "-o tst_LibraryBenchmark_results.xml,xml -o -,txt"
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    LIBS += \
+        -L../../executable -lIPXACTmodelsd \
+        -L../../executable -lKactusAPId
+
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_LibraryBenchmarkd
+
+} else {
+    # release mode
+    LIBS += \
+        -L../../executable -lIPXACTmodels \
+        -L../../executable -lKactusAPI
+
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_LibraryBenchmark
+}
+
+INCLUDEPATH += ../../
+INCLUDEPATH += ../../executable
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += ../../
+DEPENDPATH += ../../executable
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+include(tst_LibraryBenchmark.pri)
@@ -0,0 +1,171 @@
+//-----------------------------------------------------------------------------
+// File: tst_PathSearchBenchmark.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Performance benchmarks for the master-slave path search.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include "SyntheticLibrary.h"
+
+#include <editors/MemoryDesigner/MasterSlavePathSearch.h>
+#include <editors/MemoryDesigner/ConnectivityGraph.h>
+
+#include <editors/MemoryDesigner/ConnectivityComponent.h>
+#include <editors/MemoryDesigner/ConnectivityInterface.h>
+#include <editors/MemoryDesigner/ConnectivityConnection.h>
+#include <editors/MemoryDesigner/MemoryItem.h>
+
+#include <IPXACTmodels/generaldeclarations.h>
+
+class tst_PathSearchBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_PathSearchBenchmark();
+
+private slots:
+
+    void benchmarkFindMasterSlavePaths();
+    void benchmarkFindMasterSlavePaths_data();
+
+private:
+
+    /*!
+     *  Creates a connectivity graph corresponding to the bottom designs of a synthetic library.
+     *
+     *    Every design is a chain of instances, where the target interface of each instance is bridged to its
+     *    initiator interface, and the initiator is connected to the target of the next instance.
+     *
+     *    @param [in] chainCount      Number of instance chains.
+     *    @param [in] chainLength     Number of instances in each chain.
+     *
+     *    @return The connectivity graph.
+     */
+    QSharedPointer<ConnectivityGraph> createGraph(int chainCount, int chainLength) const;
+
+    /*!
+     *  Creates an interface with a memory item.
+     *
+     *    @param [in] name        Name of the interface.
+     *    @param [in] mode        Mode of the interface.
+     *    @param [in] instance    The instance containing the interface.
+     *
+     *    @return The interface.
+     */
+    QSharedPointer<ConnectivityInterface> createInterface(QString const& name, General::InterfaceMode mode,
+        QSharedPointer<ConnectivityComponent> instance) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_PathSearchBenchmark::tst_PathSearchBenchmark()
+//-----------------------------------------------------------------------------
+tst_PathSearchBenchmark::tst_PathSearchBenchmark()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PathSearchBenchmark::benchmarkFindMasterSlavePaths()
+//-----------------------------------------------------------------------------
+void tst_PathSearchBenchmark::benchmarkFindMasterSlavePaths()
+{
+    QFETCH(int, chainCount);
+    QFETCH(int, chainLength);
+
+    QSharedPointer<ConnectivityGraph> graph = createGraph(chainCount, chainLength);
+    MasterSlavePathSearch pathSearch;
+
+    QVector<QVector<QSharedPointer<ConnectivityInterface const> > > paths;
+    QBENCHMARK
+    {
+        paths = pathSearch.findMasterSlavePaths(graph, false);
+    }
+
+    QVERIFY(paths.isEmpty() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PathSearchBenchmark::benchmarkFindMasterSlavePaths_data()
+//-----------------------------------------------------------------------------
+void tst_PathSearchBenchmark::benchmarkFindMasterSlavePaths_data()
+{
+    QTest::addColumn<int>("chainCount");
+    QTest::addColumn<int>("chainLength");
+
+    for (SyntheticLibrary::Scale const& scale : SyntheticLibrary::standardScales())
+    {
+        QTest::newRow(scale.name.toLatin1().constData()) <<
+            scale.componentCount / scale.instancesPerDesign << scale.instancesPerDesign;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PathSearchBenchmark::createGraph()
+//-----------------------------------------------------------------------------
+QSharedPointer<ConnectivityGraph> tst_PathSearchBenchmark::createGraph(int chainCount, int chainLength) const
+{
+    QSharedPointer<ConnectivityGraph> graph(new ConnectivityGraph());
+
+    for (int chain = 0; chain < chainCount; ++chain)
+    {
+        QSharedPointer<ConnectivityInterface> previousInitiator;
+
+        for (int i = 0; i < chainLength; ++i)
+        {
+            QString instanceName = QStringLiteral("chain%1_u%2").arg(QString::number(chain), QString::number(i));
+            QSharedPointer<ConnectivityComponent> instance(new ConnectivityComponent(instanceName));
+            graph->getInstances().append(instance);
+
+            QSharedPointer<ConnectivityInterface> target =
+                createInterface(instanceName + QStringLiteral("_target"), General::SLAVE, instance);
+            QSharedPointer<ConnectivityInterface> initiator =
+                createInterface(instanceName + QStringLiteral("_initiator"), General::MASTER, instance);
+            graph->getInterfaces().append(target);
+            graph->getInterfaces().append(initiator);
+
+            if (previousInitiator)
+            {
+                graph->getConnections().append(QSharedPointer<ConnectivityConnection>(new ConnectivityConnection(
+                    instanceName + QStringLiteral("_in"), previousInitiator, target)));
+
+                // Every instance after the first one bridges its target to its initiator.
+                target->setBridged();
+                initiator->setBridged();
+                graph->getConnections().append(QSharedPointer<ConnectivityConnection>(new ConnectivityConnection(
+                    instanceName + QStringLiteral("_bridge"), target, initiator)));
+            }
+
+            previousInitiator = initiator;
+        }
+    }
+
+    return graph;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PathSearchBenchmark::createInterface()
+//-----------------------------------------------------------------------------
+QSharedPointer<ConnectivityInterface> tst_PathSearchBenchmark::createInterface(QString const& name,
+    General::InterfaceMode mode, QSharedPointer<ConnectivityComponent> instance) const
+{
+    QString memoryType = mode == General::MASTER ? QStringLiteral("addressSpace") : QStringLiteral("memoryMap");
+
+    QSharedPointer<ConnectivityInterface> connectivityInterface(new ConnectivityInterface(name));
+    connectivityInterface->setConnectedMemory(
+        QSharedPointer<MemoryItem>(new MemoryItem(name + QLatin1Char('_') + memoryType, memoryType)));
+    connectivityInterface->setMode(mode);
+    connectivityInterface->setInstance(instance);
+
+    return connectivityInterface;
+}
+
+QTEST_GUILESS_MAIN(tst_PathSearchBenchmark)
+
+#include "tst_PathSearchBenchmark.moc"
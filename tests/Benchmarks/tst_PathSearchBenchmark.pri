@@ -0,0 +1,20 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/MemoryDesigner/ConnectivityComponent.h \
+    ../../editors/MemoryDesigner/ConnectivityConnection.h \
+    ../../editors/MemoryDesigner/ConnectivityGraph.h \
+    ../../editors/MemoryDesigner/ConnectivityInterface.h \
+    ../../editors/MemoryDesigner/MasterSlavePathSearch.h \
+    ../../editors/MemoryDesigner/MemoryItem.h \
+    ./SyntheticLibrary.h
+
+SOURCES += ../../editors/MemoryDesigner/ConnectivityComponent.cpp \
+    ../../editors/MemoryDesigner/ConnectivityConnection.cpp \
+    ../../editors/MemoryDesigner/ConnectivityGraph.cpp \
+    ../../editors/MemoryDesigner/ConnectivityInterface.cpp \
+    ../../editors/MemoryDesigner/MasterSlavePathSearch.cpp \
+    ../../editors/MemoryDesigner/MemoryItem.cpp \
+    ./SyntheticLibrary.cpp \
+    ./tst_PathSearchBenchmark.cpp
@@ -0,0 +1,52 @@
+#-----------------------------------------------------------------------------
+# File: tst_PathSearchBenchmark.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file for running the master-slave path search benchmarks.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core xml gui testlib
+CONFIG += c++17 testcase console
+
+# Store the results in a machine-readable form next to the plain text log.
+QMAKE_EXPORTED_VARIABLES += MAKE_TESTARGS
+MAKE_TESTARGS.name = TESTARGS
+MAKE_TESTARGS.value = "-o tst_PathSearchBenchmark_results.xml,xml -o -,txt"
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    LIBS += \
+        -L../../executable -lIPXACTmodelsd \
+        -L../../executable -lKactusAPId
+
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_PathSearchBenchmarkd
+
+} else {
+    # release mode
+    LIBS += \
+        -L../../executable -lIPXACTmodels \
+        -L../../executable -lKactusAPI
+
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_PathSearchBenchmark
+}
+
+INCLUDEPATH += ../../
+INCLUDEPATH += ../../executable
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += ../../
+DEPENDPATH += ../../executable
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+include(tst_PathSearchBenchmark.pri)
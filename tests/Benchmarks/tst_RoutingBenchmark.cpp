@@ -0,0 +1,158 @@
+//-----------------------------------------------------------------------------
+// File: tst_RoutingBenchmark.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Performance benchmarks for routing the connections of a design.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/common/OrthogonalRouter.h>
+
+class tst_RoutingBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_RoutingBenchmark();
+
+private slots:
+
+    void benchmarkRouteAll();
+    void benchmarkRouteAll_data();
+
+private:
+
+    /*!
+     *  Creates the bounding rectangles of instances placed in a grid of columns and rows.
+     *
+     *    @param [in] columns     Number of instance columns.
+     *    @param [in] rows        Number of instances in each column.
+     *
+     *    @return The instance rectangles.
+     */
+    QVector<QRectF> createInstances(int columns, int rows) const;
+
+    /*!
+     *  Creates requests connecting the output ports of each instance to the input ports in the next column.
+     *
+     *    @param [in] columns     Number of instance columns.
+     *    @param [in] rows        Number of instances in each column.
+     *
+     *    @return The routing requests.
+     */
+    QList<OrthogonalRouter::RouteRequest> createRequests(int columns, int rows) const;
+};
+
+namespace
+{
+    //! Placement of the synthetic instances.
+    qreal const INSTANCE_WIDTH = 100.0;
+    qreal const INSTANCE_HEIGHT = 120.0;
+    qreal const COLUMN_WIDTH = 320.0;
+    qreal const ROW_HEIGHT = 200.0;
+
+    //! Number of ports on each side of an instance.
+    int const PORTS_PER_SIDE = 2;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RoutingBenchmark::tst_RoutingBenchmark()
+//-----------------------------------------------------------------------------
+tst_RoutingBenchmark::tst_RoutingBenchmark()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RoutingBenchmark::benchmarkRouteAll()
+//-----------------------------------------------------------------------------
+void tst_RoutingBenchmark::benchmarkRouteAll()
+{
+    QFETCH(int, columns);
+    QFETCH(int, rows);
+
+    QVector<QRectF> instances = createInstances(columns, rows);
+    QList<OrthogonalRouter::RouteRequest> requests = createRequests(columns, rows);
+
+    QList<QList<QPointF> > routes;
+    QBENCHMARK
+    {
+        OrthogonalRouter router;
+        router.setObstacles(instances);
+        routes = router.routeAll(requests);
+    }
+
+    QCOMPARE(routes.size(), requests.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RoutingBenchmark::benchmarkRouteAll_data()
+//-----------------------------------------------------------------------------
+void tst_RoutingBenchmark::benchmarkRouteAll_data()
+{
+    QTest::addColumn<int>("columns");
+    QTest::addColumn<int>("rows");
+
+    QTest::newRow("small") << 5 << 10;
+    QTest::newRow("medium") << 10 << 25;
+    QTest::newRow("large") << 20 << 50;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RoutingBenchmark::createInstances()
+//-----------------------------------------------------------------------------
+QVector<QRectF> tst_RoutingBenchmark::createInstances(int columns, int rows) const
+{
+    QVector<QRectF> instances;
+    instances.reserve(columns * rows);
+
+    for (int column = 0; column < columns; ++column)
+    {
+        for (int row = 0; row < rows; ++row)
+        {
+            instances.append(QRectF(column * COLUMN_WIDTH, row * ROW_HEIGHT, INSTANCE_WIDTH, INSTANCE_HEIGHT));
+        }
+    }
+
+    return instances;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RoutingBenchmark::createRequests()
+//-----------------------------------------------------------------------------
+QList<OrthogonalRouter::RouteRequest> tst_RoutingBenchmark::createRequests(int columns, int rows) const
+{
+    QList<OrthogonalRouter::RouteRequest> requests;
+
+    for (int column = 0; column < columns - 1; ++column)
+    {
+        for (int row = 0; row < rows; ++row)
+        {
+            for (int port = 0; port < PORTS_PER_SIDE; ++port)
+            {
+                // Connect to a nearby instance in the next column, so that some of the routes cross.
+                int targetRow = qBound(0, row + (row * 3 + port * 5 + column) % 7 - 3, rows - 1);
+                qreal portOffset = (port + 1) * INSTANCE_HEIGHT / (PORTS_PER_SIDE + 1);
+
+                OrthogonalRouter::RouteRequest request;
+                request.routeId = requests.size();
+                request.start = QPointF(column * COLUMN_WIDTH + INSTANCE_WIDTH, row * ROW_HEIGHT + portOffset);
+                request.startDirection = QVector2D(1, 0);
+                request.end = QPointF((column + 1) * COLUMN_WIDTH, targetRow * ROW_HEIGHT + portOffset);
+                request.endDirection = QVector2D(-1, 0);
+                requests.append(request);
+            }
+        }
+    }
+
+    return requests;
+}
+
+QTEST_GUILESS_MAIN(tst_RoutingBenchmark)
+
+#include "tst_RoutingBenchmark.moc"
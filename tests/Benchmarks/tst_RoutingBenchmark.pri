@@ -0,0 +1,10 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/common/DefaultRouting.h \
+    ../../editors/common/OrthogonalRouter.h
+
+SOURCES += ../../editors/common/DefaultRouting.cpp \
+    ../../editors/common/OrthogonalRouter.cpp \
+    ./tst_RoutingBenchmark.cpp
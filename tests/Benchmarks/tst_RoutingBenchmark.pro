@@ -0,0 +1,42 @@
+#-----------------------------------------------------------------------------
+# File: tst_RoutingBenchmark.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file for running the design connection routing benchmarks.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core gui testlib
+CONFIG += c++17 testcase console
+
+# Store the results in a machine-readable form next to the plain text log.
+QMAKE_EXPORTED_VARIABLES += MAKE_TESTARGS
+MAKE_TESTARGS.name = TESTARGS
+MAKE_TESTARGS.value = "-o tst_RoutingBenchmark_results.xml,xml -o -,txt"
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_RoutingBenchmarkd
+
+} else {
+    # release mode
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_RoutingBenchmark
+}
+
+INCLUDEPATH += ../../
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += ../../
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+include(tst_RoutingBenchmark.pri)
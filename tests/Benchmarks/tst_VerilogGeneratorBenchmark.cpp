@@ -0,0 +1,202 @@
+//-----------------------------------------------------------------------------
+// File: tst_VerilogGeneratorBenchmark.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Performance benchmarks for parsing design hierarchies and generating Verilog.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QTemporaryDir>
+
+#include "SyntheticLibrary.h"
+
+#include <Plugins/VerilogGenerator/VerilogWriterFactory/VerilogWriterFactory.h>
+
+#include <Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h>
+#include <Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h>
+
+#include <Plugins/common/HDLParser/MetaDesign.h>
+
+#include <tests/MockObjects/LibraryMock.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/View.h>
+#include <IPXACTmodels/Design/Design.h>
+
+class tst_VerilogGeneratorBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_VerilogGeneratorBenchmark();
+
+private slots:
+
+    void benchmarkParseHierarchy();
+    void benchmarkParseHierarchy_data();
+
+    void benchmarkGenerateVerilog();
+    void benchmarkGenerateVerilog_data();
+
+private:
+
+    /*!
+     *  Adds a data row for each standard scale.
+     */
+    void createScaleData();
+
+    /*!
+     *  Fills the library with the synthetic library of the current data row.
+     *
+     *    @return The input for the generation.
+     */
+    GenerationTuple createLibrary();
+
+    /*!
+     *  Parses the design hierarchy of the top component.
+     *
+     *    @param [in] input   The input for the generation.
+     *
+     *    @return The parsed designs.
+     */
+    QList<QSharedPointer<MetaDesign> > parseHierarchy(GenerationTuple const& input);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The library containing the synthetic documents.
+    LibraryMock library_;
+
+    //! Receives the generation messages.
+    MessagePasser messages_;
+};
+
+Q_DECLARE_METATYPE(SyntheticLibrary::Scale)
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogGeneratorBenchmark::tst_VerilogGeneratorBenchmark()
+//-----------------------------------------------------------------------------
+tst_VerilogGeneratorBenchmark::tst_VerilogGeneratorBenchmark(): library_(this), messages_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogGeneratorBenchmark::benchmarkParseHierarchy()
+//-----------------------------------------------------------------------------
+void tst_VerilogGeneratorBenchmark::benchmarkParseHierarchy()
+{
+    QFETCH(SyntheticLibrary::Scale, scale);
+
+    GenerationTuple input = createLibrary();
+
+    QList<QSharedPointer<MetaDesign> > designs;
+    QBENCHMARK
+    {
+        designs = parseHierarchy(input);
+    }
+
+    QCOMPARE(designs.size(), SyntheticLibrary::create(scale).designs.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogGeneratorBenchmark::benchmarkParseHierarchy_data()
+//-----------------------------------------------------------------------------
+void tst_VerilogGeneratorBenchmark::benchmarkParseHierarchy_data()
+{
+    createScaleData();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogGeneratorBenchmark::benchmarkGenerateVerilog()
+//-----------------------------------------------------------------------------
+void tst_VerilogGeneratorBenchmark::benchmarkGenerateVerilog()
+{
+    GenerationTuple input = createLibrary();
+
+    QTemporaryDir outputDirectory;
+    QVERIFY(outputDirectory.isValid());
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    int outputCount = 0;
+    QBENCHMARK
+    {
+        QList<QSharedPointer<MetaDesign> > designs = parseHierarchy(input);
+
+        VerilogWriterFactory factory(&library_, &messages_, &settings, QStringLiteral("benchmark"),
+            QStringLiteral("benchmark"));
+
+        QList<QSharedPointer<GenerationOutput> > outputs = factory.prepareDesign(designs);
+        for (QSharedPointer<GenerationOutput> output : outputs)
+        {
+            output->write(outputDirectory.path());
+        }
+
+        outputCount = outputs.size();
+    }
+
+    QVERIFY(outputCount > 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogGeneratorBenchmark::benchmarkGenerateVerilog_data()
+//-----------------------------------------------------------------------------
+void tst_VerilogGeneratorBenchmark::benchmarkGenerateVerilog_data()
+{
+    createScaleData();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogGeneratorBenchmark::createScaleData()
+//-----------------------------------------------------------------------------
+void tst_VerilogGeneratorBenchmark::createScaleData()
+{
+    QTest::addColumn<SyntheticLibrary::Scale>("scale");
+
+    for (SyntheticLibrary::Scale const& scale : SyntheticLibrary::standardScales())
+    {
+        QTest::newRow(scale.name.toLatin1().constData()) << scale;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogGeneratorBenchmark::createLibrary()
+//-----------------------------------------------------------------------------
+GenerationTuple tst_VerilogGeneratorBenchmark::createLibrary()
+{
+    QFETCH(SyntheticLibrary::Scale, scale);
+
+    SyntheticLibrary::Library library = SyntheticLibrary::create(scale);
+
+    library_.clear();
+    for (QSharedPointer<Document> document : SyntheticLibrary::documents(library))
+    {
+        library_.addComponent(document);
+    }
+
+    GenerationTuple input;
+    input.component = SyntheticLibrary::topComponent(library);
+    input.design = library.designs.first();
+    input.messages = &messages_;
+
+    return input;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogGeneratorBenchmark::parseHierarchy()
+//-----------------------------------------------------------------------------
+QList<QSharedPointer<MetaDesign> > tst_VerilogGeneratorBenchmark::parseHierarchy(GenerationTuple const& input)
+{
+    return MetaDesign::parseHierarchy(&library_, input, input.component->getViews()->first());
+}
+
+QTEST_GUILESS_MAIN(tst_VerilogGeneratorBenchmark)
+
+#include "tst_VerilogGeneratorBenchmark.moc"
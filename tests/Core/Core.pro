@@ -33,4 +33,9 @@ SUBDIRS += \
             tst_DocumentTreeBuilder.pro \
             tst_DocumentGenerator.pro \
             tst_MarkdownGenerator.pro \
-            tst_MasterSlavePathSearch.pro
+            tst_MasterSlavePathSearch.pro \
+            tst_StructuralDiff.pro \
+            tst_ComponentSnapshots.pro \
+            tst_OrthogonalRouter.pro \
+            tst_ComponentEditorTreeModel.pro \
+            tst_ConnectivityGraphFactory.pro
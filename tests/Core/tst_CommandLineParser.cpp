@@ -49,6 +49,8 @@ private slots:
     void testShowUsage();
     void testShowUsage_data();
 
+    void testBatchOptions();
+
 };
 
 tst_CommandLineParser::tst_CommandLineParser(): QObject(0),
@@ -211,6 +213,23 @@ void tst_CommandLineParser::testShowUsage_data()
     QTest::newRow("-h option") << "tst_CommandLineParser -h";
     QTest::newRow("--help option") << "tst_CommandLineParser --help";
 }
+
+//-----------------------------------------------------------------------------
+// Function: tst_CommandLineParser::testBatchOptions()
+//-----------------------------------------------------------------------------
+void tst_CommandLineParser::testBatchOptions()
+{
+    QString input("testApp --batch manifest.json -r report.json -j 4");
+
+    CommandLineParser parser;
+    parser.readArguments(input.split(QLatin1Char(' ')));
+
+    QVERIFY(parser.batchMode());
+    QVERIFY(parser.runScriptMode() == false);
+    QCOMPARE(parser.getOptionValue(CommandLineParser::Option::BatchManifest), QStringLiteral("manifest.json"));
+    QCOMPARE(parser.getOptionValue(CommandLineParser::Option::BatchReport), QStringLiteral("report.json"));
+    QCOMPARE(parser.getOptionValue(CommandLineParser::Option::WorkerCount), QStringLiteral("4"));
+}
 QTEST_MAIN(tst_CommandLineParser)
 
 #include "tst_CommandLineParser.moc"
@@ -0,0 +1,283 @@
+//-----------------------------------------------------------------------------
+// File: tst_ComponentEditorTreeModel.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class ComponentEditorTreeModel.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/treeStructure/componenteditortreemodel.h>
+#include <editors/ComponentEditor/treeStructure/componenteditorrootitem.h>
+#include <editors/ComponentEditor/treeStructure/componenteditoraddrblockitem.h>
+
+#include <KactusAPI/include/AccessPolicyInterface.h>
+#include <KactusAPI/include/AddressBlockInterface.h>
+#include <KactusAPI/include/ComponentParameterFinder.h>
+#include <KactusAPI/include/ExpressionFormatter.h>
+#include <KactusAPI/include/FieldInterface.h>
+#include <KactusAPI/include/IPXactSystemVerilogParser.h>
+#include <KactusAPI/include/ModeReferenceInterface.h>
+#include <KactusAPI/include/ParametersInterface.h>
+#include <KactusAPI/include/RegisterInterface.h>
+#include <KactusAPI/include/ResetInterface.h>
+
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/Register.h>
+
+#include <IPXACTmodels/Component/validators/AddressBlockValidator.h>
+#include <IPXACTmodels/Component/validators/EnumeratedValueValidator.h>
+#include <IPXACTmodels/Component/validators/FieldValidator.h>
+#include <IPXACTmodels/Component/validators/RegisterFileValidator.h>
+#include <IPXACTmodels/Component/validators/RegisterValidator.h>
+#include <IPXACTmodels/common/validators/ParameterValidator.h>
+
+class tst_ComponentEditorTreeModel : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ComponentEditorTreeModel();
+
+private slots:
+
+    void init();
+    void cleanup();
+
+    void testAddressBlockRegistersAreFetchedOnDemand();
+    void testRegisterFieldsAreFetchedOnDemand();
+    void testIdentifierChainFetchesItems();
+
+private:
+
+    QSharedPointer<ComponentEditorRootItem> createRootItem(ComponentEditorTreeModel* model);
+
+    QSharedPointer<Component> component_;
+
+    QSharedPointer<AddressBlock> addressBlock_;
+
+    QSharedPointer<ExpressionParser> expressionParser_;
+
+    QSharedPointer<ExpressionFormatter> expressionFormatter_;
+
+    QSharedPointer<ParameterFinder> parameterFinder_;
+
+    QSharedPointer<AddressBlockValidator> blockValidator_;
+
+    QSharedPointer<ResetInterface> resetInterface_;
+
+    QSharedPointer<FieldInterface> fieldInterface_;
+
+    QSharedPointer<ModeReferenceInterface> modeReferenceInterface_;
+
+    QSharedPointer<AccessPolicyInterface> accessPolicyInterface_;
+
+    QSharedPointer<RegisterInterface> registerInterface_;
+
+    QSharedPointer<ParametersInterface> parameterInterface_;
+
+    QSharedPointer<AddressBlockInterface> blockInterface_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentEditorTreeModel::tst_ComponentEditorTreeModel()
+//-----------------------------------------------------------------------------
+tst_ComponentEditorTreeModel::tst_ComponentEditorTreeModel()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentEditorTreeModel::init()
+//-----------------------------------------------------------------------------
+void tst_ComponentEditorTreeModel::init()
+{
+    component_ = QSharedPointer<Component>(new Component(VLNV(), Document::Revision::Std14));
+
+    QSharedPointer<Register> firstRegister(new Register("firstRegister", "0", "32"));
+    firstRegister->getFields()->append(QSharedPointer<Field>(new Field("firstField")));
+    firstRegister->getFields()->append(QSharedPointer<Field>(new Field("secondField")));
+
+    QSharedPointer<Register> secondRegister(new Register("secondRegister", "4", "32"));
+    secondRegister->getFields()->append(QSharedPointer<Field>(new Field("thirdField")));
+
+    addressBlock_ = QSharedPointer<AddressBlock>(new AddressBlock("testBlock", "0"));
+    addressBlock_->setRange("8");
+    addressBlock_->setWidth("32");
+    addressBlock_->getRegisterData()->append(firstRegister);
+    addressBlock_->getRegisterData()->append(secondRegister);
+
+    QSharedPointer<MemoryMap> memoryMap(new MemoryMap("testMap"));
+    memoryMap->getMemoryBlocks()->append(addressBlock_);
+    component_->getMemoryMaps()->append(memoryMap);
+
+    parameterFinder_ = QSharedPointer<ParameterFinder>(new ComponentParameterFinder(component_));
+    expressionParser_ = QSharedPointer<ExpressionParser>(new IPXactSystemVerilogParser(parameterFinder_));
+    expressionFormatter_ = QSharedPointer<ExpressionFormatter>(new ExpressionFormatter(parameterFinder_));
+
+    QSharedPointer<ParameterValidator> parameterValidator(new ParameterValidator(expressionParser_,
+        component_->getChoices(), component_->getRevision()));
+    QSharedPointer<EnumeratedValueValidator> enumValidator(new EnumeratedValueValidator(expressionParser_));
+    QSharedPointer<FieldValidator> fieldValidator(
+        new FieldValidator(expressionParser_, enumValidator, parameterValidator));
+    QSharedPointer<RegisterValidator> registerValidator(
+        new RegisterValidator(expressionParser_, fieldValidator, parameterValidator));
+    QSharedPointer<RegisterFileValidator> registerFileValidator(new RegisterFileValidator(expressionParser_,
+        registerValidator, parameterValidator, component_->getRevision()));
+
+    blockValidator_ = QSharedPointer<AddressBlockValidator>(new AddressBlockValidator(expressionParser_,
+        registerValidator, registerFileValidator, parameterValidator, component_->getRevision()));
+    blockValidator_->componentChange(component_);
+
+    resetInterface_ = QSharedPointer<ResetInterface>(
+        new ResetInterface(fieldValidator, expressionParser_, expressionFormatter_));
+    fieldInterface_ = QSharedPointer<FieldInterface>(
+        new FieldInterface(fieldValidator, expressionParser_, expressionFormatter_, resetInterface_.data()));
+
+    modeReferenceInterface_ = QSharedPointer<ModeReferenceInterface>(new ModeReferenceInterface());
+    accessPolicyInterface_ = QSharedPointer<AccessPolicyInterface>(
+        new AccessPolicyInterface(modeReferenceInterface_.data()));
+
+    registerInterface_ = QSharedPointer<RegisterInterface>(new RegisterInterface(registerValidator,
+        expressionParser_, expressionFormatter_, fieldInterface_.data(), accessPolicyInterface_.data()));
+
+    parameterInterface_ = QSharedPointer<ParametersInterface>(
+        new ParametersInterface(parameterValidator, expressionParser_, expressionFormatter_));
+
+    blockInterface_ = QSharedPointer<AddressBlockInterface>(new AddressBlockInterface(blockValidator_,
+        expressionParser_, expressionFormatter_, nullptr, registerInterface_.data(), parameterInterface_.data()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentEditorTreeModel::cleanup()
+//-----------------------------------------------------------------------------
+void tst_ComponentEditorTreeModel::cleanup()
+{
+    blockInterface_.clear();
+    parameterInterface_.clear();
+    registerInterface_.clear();
+    accessPolicyInterface_.clear();
+    modeReferenceInterface_.clear();
+    fieldInterface_.clear();
+    resetInterface_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentEditorTreeModel::testAddressBlockRegistersAreFetchedOnDemand()
+//-----------------------------------------------------------------------------
+void tst_ComponentEditorTreeModel::testAddressBlockRegistersAreFetchedOnDemand()
+{
+    ComponentEditorTreeModel model(nullptr);
+    QSharedPointer<ComponentEditorRootItem> root = createRootItem(&model);
+    model.setRootItem(root);
+
+    QModelIndex blockIndex = model.index(0, 0);
+    QCOMPARE(blockIndex.data(Qt::DisplayRole).toString(), QString("testBlock"));
+
+    QVERIFY(model.hasChildren(blockIndex));
+    QVERIFY(model.canFetchMore(blockIndex));
+    QCOMPARE(model.rowCount(blockIndex), 0);
+
+    QSignalSpy insertSpy(&model, SIGNAL(rowsInserted(QModelIndex const&, int, int)));
+
+    model.fetchMore(blockIndex);
+
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(insertSpy.first().at(0).value<QModelIndex>(), blockIndex);
+    QCOMPARE(insertSpy.first().at(1).toInt(), 0);
+    QCOMPARE(insertSpy.first().at(2).toInt(), 1);
+
+    QVERIFY(model.canFetchMore(blockIndex) == false);
+    QCOMPARE(model.rowCount(blockIndex), 2);
+    QCOMPARE(model.index(0, 0, blockIndex).data(Qt::DisplayRole).toString(), QString("firstRegister"));
+    QCOMPARE(model.index(1, 0, blockIndex).data(Qt::DisplayRole).toString(), QString("secondRegister"));
+
+    model.fetchMore(blockIndex);
+
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(model.rowCount(blockIndex), 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentEditorTreeModel::testRegisterFieldsAreFetchedOnDemand()
+//-----------------------------------------------------------------------------
+void tst_ComponentEditorTreeModel::testRegisterFieldsAreFetchedOnDemand()
+{
+    ComponentEditorTreeModel model(nullptr);
+    QSharedPointer<ComponentEditorRootItem> root = createRootItem(&model);
+    model.setRootItem(root);
+
+    QModelIndex blockIndex = model.index(0, 0);
+    model.fetchMore(blockIndex);
+
+    QModelIndex registerIndex = model.index(0, 0, blockIndex);
+    QVERIFY(model.hasChildren(registerIndex));
+    QVERIFY(model.canFetchMore(registerIndex));
+    QCOMPARE(model.rowCount(registerIndex), 0);
+
+    model.fetchMore(registerIndex);
+
+    QVERIFY(model.canFetchMore(registerIndex) == false);
+    QCOMPARE(model.rowCount(registerIndex), 2);
+    QCOMPARE(model.index(0, 0, registerIndex).data(Qt::DisplayRole).toString(), QString("firstField"));
+    QCOMPARE(model.index(1, 0, registerIndex).data(Qt::DisplayRole).toString(), QString("secondField"));
+
+    QModelIndex otherRegisterIndex = model.index(1, 0, blockIndex);
+    QVERIFY(model.canFetchMore(otherRegisterIndex));
+    QCOMPARE(model.rowCount(otherRegisterIndex), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentEditorTreeModel::testIdentifierChainFetchesItems()
+//-----------------------------------------------------------------------------
+void tst_ComponentEditorTreeModel::testIdentifierChainFetchesItems()
+{
+    ComponentEditorTreeModel model(nullptr);
+    QSharedPointer<ComponentEditorRootItem> root = createRootItem(&model);
+    model.setRootItem(root);
+
+    QModelIndex blockIndex = model.index(0, 0);
+    QVERIFY(model.canFetchMore(blockIndex));
+
+    QVector<QString> identifierChain({ "testBlock", "secondRegister", "thirdField" });
+    QModelIndex fieldIndex = model.getIndexOfItem(identifierChain);
+
+    QVERIFY(fieldIndex.isValid());
+    QCOMPARE(fieldIndex.data(Qt::DisplayRole).toString(), QString("thirdField"));
+    QCOMPARE(fieldIndex.parent().data(Qt::DisplayRole).toString(), QString("secondRegister"));
+    QCOMPARE(fieldIndex.parent().parent(), blockIndex);
+
+    QVERIFY(model.canFetchMore(blockIndex) == false);
+    QCOMPARE(model.rowCount(blockIndex), 2);
+
+    // Only the registers on the chain have their fields created.
+    QVERIFY(model.canFetchMore(model.index(0, 0, blockIndex)));
+    QCOMPARE(model.rowCount(fieldIndex.parent()), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentEditorTreeModel::createRootItem()
+//-----------------------------------------------------------------------------
+QSharedPointer<ComponentEditorRootItem> tst_ComponentEditorTreeModel::createRootItem(
+    ComponentEditorTreeModel* model)
+{
+    QSharedPointer<ComponentEditorRootItem> root(new ComponentEditorRootItem(nullptr, component_, model));
+
+    QSharedPointer<ComponentEditorAddrBlockItem> blockItem(new ComponentEditorAddrBlockItem(
+        component_->getMemoryMaps()->first(), addressBlock_, model, nullptr, component_,
+        QSharedPointer<ReferenceCounter>(), parameterFinder_, expressionFormatter_, expressionParser_,
+        blockValidator_, blockInterface_.data(), root.data()));
+
+    root->addChildItem(blockItem);
+    return root;
+}
+
+QTEST_MAIN(tst_ComponentEditorTreeModel)
+
+#include "tst_ComponentEditorTreeModel.moc"
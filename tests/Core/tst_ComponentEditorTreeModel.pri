@@ -0,0 +1,325 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+# This is a reminder that you are using a generated .pro file.
+# Remove it when you are finished editing this file.
+
+
+HEADERS += ../../common/KactusUtils.h \
+    ../../common/delegates/ComboDelegate/combodelegate.h \
+    ../../common/delegates/LineEditDelegate/lineeditdelegate.h \
+    ../../common/graphicsItems/GraphicsItemTypes.h \
+    ../../common/graphicsItems/expandableitem.h \
+    ../../common/graphicsItems/graphicsexpandcollapseitem.h \
+    ../../common/graphicsItems/visualizeritem.h \
+    ../../common/models/TableModelBase.h \
+    ../../common/views/EditableListView/editablelistview.h \
+    ../../common/views/EditableTableView/editabletableview.h \
+    ../../common/widgets/EnumCollectionEditor/EnumCollectionEditor.h \
+    ../../common/widgets/EnumCollectionEditor/EnumerationEditor.h \
+    ../../common/widgets/MandatoryComboBox/MandatoryComboBox.h \
+    ../../common/widgets/ParameterGroupBox/parametergroupbox.h \
+    ../../common/widgets/accessComboBox/accesscombobox.h \
+    ../../common/widgets/assistedLineEdit/AssistedLineEdit.h \
+    ../../common/widgets/assistedLineEdit/ILineContentMatcher.h \
+    ../../common/widgets/assistedLineEdit/LineContentAssistWidget.h \
+    ../../common/widgets/booleanComboBox/booleancombobox.h \
+    ../../common/widgets/interfaceModeSelector/interfacemodeselector.h \
+    ../../common/widgets/interfaceSelector/interfaceselector.h \
+    ../../common/widgets/listManager/listmanager.h \
+    ../../common/widgets/listManager/listmanagermodel.h \
+    ../../common/widgets/modWriteComboBox/modwritecombobox.h \
+    ../../common/widgets/nameGroupEditor/namegroupeditor.h \
+    ../../common/widgets/readActionComboBox/readactioncombobox.h \
+    ../../common/widgets/summaryLabel/summarylabel.h \
+    ../../common/widgets/testConstraintComboBox/testconstraintcombobox.h \
+    ../../common/widgets/usageComboBox/usagecombobox.h \
+    ../../common/widgets/vlnvEditor/VLNVContentMatcher.h \
+    ../../common/widgets/vlnvEditor/VLNVDataTree.h \
+    ../../common/widgets/vlnvEditor/vlnveditor.h \
+    ../../editors/ComponentEditor/ParameterItemEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/AbstractionTypesConstants.h \
+    ../../editors/ComponentEditor/busInterfaces/AbstractionTypesDelegate.h \
+    ../../editors/ComponentEditor/busInterfaces/AbstractionTypesEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/AbstractionTypesModel.h \
+    ../../editors/ComponentEditor/busInterfaces/BusInterfaceColumns.h \
+    ../../editors/ComponentEditor/busInterfaces/businterfaceeditor.h \
+    ../../editors/ComponentEditor/busInterfaces/businterfacesdelegate.h \
+    ../../editors/ComponentEditor/busInterfaces/businterfaceseditor.h \
+    ../../editors/ComponentEditor/busInterfaces/businterfacesmodel.h \
+    ../../editors/ComponentEditor/busInterfaces/general/BridgeColumns.h \
+    ../../editors/ComponentEditor/busInterfaces/general/InitiatorModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/MasterModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/MirroredInitiatorModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/MirroredMasterModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/MirroredSlaveModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/MirroredTargetModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/ModeEditorBase.h \
+    ../../editors/ComponentEditor/busInterfaces/general/MonitorModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/SlaveModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/SystemModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/TargetModeEditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/bridgesdelegate.h \
+    ../../editors/ComponentEditor/busInterfaces/general/bridgeseditor.h \
+    ../../editors/ComponentEditor/busInterfaces/general/bridgesmodel.h \
+    ../../editors/ComponentEditor/busInterfaces/general/busifgeneraldetails.h \
+    ../../editors/ComponentEditor/busInterfaces/general/busifgeneraltab.h \
+    ../../editors/ComponentEditor/busInterfaces/general/interfacemodestack.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/BusInterfacePortMapTab.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PhysicalPortMappingTableModel.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PhysicalPortMappingTableView.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortListSortProxyModel.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapAutoConnector.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapDelegate.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapHeaderView.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapModel.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapSortFilter.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapView.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingColumns.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingTableModel.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingTableView.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapsColumns.h \
+    ../../editors/ComponentEditor/common/AbstractParameterModel.h \
+    ../../editors/ComponentEditor/common/EnumerationEditorConstructorDelegate.h \
+    ../../editors/ComponentEditor/common/ExpressionDelegate.h \
+    ../../editors/ComponentEditor/common/ExpressionEditor.h \
+    ../../editors/ComponentEditor/common/ExpressionLineEditor.h \
+    ../../editors/ComponentEditor/common/FloatingModeReferenceEditor.h \
+    ../../editors/ComponentEditor/common/MasterExpressionEditor.h \
+    ../../editors/ComponentEditor/common/ModeReferenceDelegate.h \
+    ../../editors/ComponentEditor/common/ModeReferenceEditor.h \
+    ../../editors/ComponentEditor/common/ModeReferenceModel.h \
+    ../../editors/ComponentEditor/common/MultilineDescriptionDelegate.h \
+    ../../editors/ComponentEditor/common/ParameterizableTable.h \
+    ../../editors/ComponentEditor/common/ReferenceSelector/ReferenceSelector.h \
+    ../../editors/ComponentEditor/common/ReferencingTableModel.h \
+    ../../editors/ComponentEditor/instantiations/filesetrefeditor.h \
+    ../../editors/ComponentEditor/instantiations/filesetrefeditordelegate.h \
+    ../../editors/ComponentEditor/instantiations/filesetrefmodel.h \
+    ../../editors/ComponentEditor/itemeditor.h \
+    ../../editors/ComponentEditor/itemvisualizer.h \
+    ../../editors/ComponentEditor/memoryMaps/AccessPoliciesDelegate.h \
+    ../../editors/ComponentEditor/memoryMaps/AccessPoliciesEditor.h \
+    ../../editors/ComponentEditor/memoryMaps/AccessPoliciesModel.h \
+    ../../editors/ComponentEditor/memoryMaps/AddressBlockColumns.h \
+    ../../editors/ComponentEditor/memoryMaps/EnumeratedValueColumns.h \
+    ../../editors/ComponentEditor/memoryMaps/ExpressionProxyModel.h \
+    ../../editors/ComponentEditor/memoryMaps/FieldAccessPoliciesDelegate.h \
+    ../../editors/ComponentEditor/memoryMaps/FieldAccessPoliciesEditor.h \
+    ../../editors/ComponentEditor/memoryMaps/FieldAccessPoliciesModel.h \
+    ../../editors/ComponentEditor/memoryMaps/FieldAccessPolicyColumns.h \
+    ../../editors/ComponentEditor/memoryMaps/RegisterColumns.h \
+    ../../editors/ComponentEditor/memoryMaps/RegisterFileColumns.h \
+    ../../editors/ComponentEditor/memoryMaps/ResetColumns.h \
+    ../../editors/ComponentEditor/memoryMaps/ResetsDelegate.h \
+    ../../editors/ComponentEditor/memoryMaps/ResetsEditor.h \
+    ../../editors/ComponentEditor/memoryMaps/ResetsModel.h \
+    ../../editors/ComponentEditor/memoryMaps/SingleAddressBlockEditor.h \
+    ../../editors/ComponentEditor/memoryMaps/SingleFieldEditor.h \
+    ../../editors/ComponentEditor/memoryMaps/SingleRegisterEditor.h \
+    ../../editors/ComponentEditor/memoryMaps/SingleRegisterFileEditor.h \
+    ../../editors/ComponentEditor/memoryMaps/WriteValueConstraintComboBox.h \
+    ../../editors/ComponentEditor/memoryMaps/addressblockdelegate.h \
+    ../../editors/ComponentEditor/memoryMaps/addressblockeditor.h \
+    ../../editors/ComponentEditor/memoryMaps/addressblockmodel.h \
+    ../../editors/ComponentEditor/memoryMaps/enumeratedvaluedelegate.h \
+    ../../editors/ComponentEditor/memoryMaps/enumeratedvaluemodel.h \
+    ../../editors/ComponentEditor/memoryMaps/fieldeditor.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/ReferenceCalculator.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/ArrayableMemoryGraphItem.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/MemoryBlockGraphItem.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/fieldgraphitem.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapgraphitem.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapscene.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapsvisualizer.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapview.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registerfilegraphitem.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.h \
+    ../../editors/ComponentEditor/memoryMaps/registerdelegate.h \
+    ../../editors/ComponentEditor/memoryMaps/registereditor.h \
+    ../../editors/ComponentEditor/memoryMaps/registerfiledelegate.h \
+    ../../editors/ComponentEditor/memoryMaps/registerfileeditor.h \
+    ../../editors/ComponentEditor/memoryMaps/registerfilemodel.h \
+    ../../editors/ComponentEditor/memoryMaps/registertablemodel.h \
+    ../../editors/ComponentEditor/parameters/Array/ArrayColumns.h \
+    ../../editors/ComponentEditor/parameters/Array/ArrayDelegate.h \
+    ../../editors/ComponentEditor/parameters/Array/ArrayView.h \
+    ../../editors/ComponentEditor/parameters/Array/ParameterArrayModel.h \
+    ../../editors/ComponentEditor/parameters/ChoiceCreatorDelegate.h \
+    ../../editors/ComponentEditor/parameters/ComponentParameterColumns.h \
+    ../../editors/ComponentEditor/parameters/ComponentParameterModel.h \
+    ../../editors/ComponentEditor/parameters/LockableParametersModel.h \
+    ../../editors/ComponentEditor/parameters/ParameterColumns.h \
+    ../../editors/ComponentEditor/parameters/ParameterDelegate.h \
+    ../../editors/ComponentEditor/parameters/ParameterEditorHeaderView.h \
+    ../../editors/ComponentEditor/parameters/ParametersView.h \
+    ../../editors/ComponentEditor/parameters/parametersmodel.h \
+    ../../editors/ComponentEditor/referenceCounter/ReferenceCounter.h \
+    ../../editors/ComponentEditor/treeStructure/ParameterizableItem.h \
+    ../../editors/ComponentEditor/treeStructure/componenteditoraddrblockitem.h \
+    ../../editors/ComponentEditor/treeStructure/componenteditorbusinterfaceitem.h \
+    ../../editors/ComponentEditor/treeStructure/componenteditorbusinterfacesitem.h \
+    ../../editors/ComponentEditor/treeStructure/componenteditorfielditem.h \
+    ../../editors/ComponentEditor/treeStructure/componenteditoritem.h \
+    ../../editors/ComponentEditor/treeStructure/componenteditorregisterfileitem.h \
+    ../../editors/ComponentEditor/treeStructure/componenteditorregisteritem.h \
+    ../../editors/ComponentEditor/treeStructure/componenteditorrootitem.h \
+    ../../editors/ComponentEditor/treeStructure/componenteditortreemodel.h \
+    ../../editors/ComponentEditor/visualization/AddressableItem.h \
+    ../../editors/ComponentEditor/visualization/fieldgapitem.h \
+    ../../editors/ComponentEditor/visualization/memorygapitem.h \
+    ../../editors/ComponentEditor/visualization/memoryvisualizationitem.h \
+    ../../editors/common/ExpressionSet.h
+SOURCES += ../../common/KactusUtils.cpp \
+    ../../common/delegates/ComboDelegate/combodelegate.cpp \
+    ../../common/delegates/LineEditDelegate/lineeditdelegate.cpp \
+    ../../common/graphicsItems/expandableitem.cpp \
+    ../../common/graphicsItems/graphicsexpandcollapseitem.cpp \
+    ../../common/graphicsItems/visualizeritem.cpp \
+    ../../common/models/TableModelBase.cpp \
+    ../../common/views/EditableListView/editablelistview.cpp \
+    ../../common/views/EditableTableView/editabletableview.cpp \
+    ../../common/widgets/EnumCollectionEditor/EnumCollectionEditor.cpp \
+    ../../common/widgets/EnumCollectionEditor/EnumerationEditor.cpp \
+    ../../common/widgets/MandatoryComboBox/MandatoryComboBox.cpp \
+    ../../common/widgets/ParameterGroupBox/parametergroupbox.cpp \
+    ../../common/widgets/accessComboBox/accesscombobox.cpp \
+    ../../common/widgets/assistedLineEdit/AssistedLineEdit.cpp \
+    ../../common/widgets/assistedLineEdit/LineContentAssistWidget.cpp \
+    ../../common/widgets/booleanComboBox/booleancombobox.cpp \
+    ../../common/widgets/interfaceModeSelector/interfacemodeselector.cpp \
+    ../../common/widgets/interfaceSelector/interfaceselector.cpp \
+    ../../common/widgets/listManager/listmanager.cpp \
+    ../../common/widgets/listManager/listmanagermodel.cpp \
+    ../../common/widgets/modWriteComboBox/modwritecombobox.cpp \
+    ../../common/widgets/nameGroupEditor/namegroupeditor.cpp \
+    ../../common/widgets/readActionComboBox/readactioncombobox.cpp \
+    ../../common/widgets/summaryLabel/summarylabel.cpp \
+    ../../common/widgets/testConstraintComboBox/testconstraintcombobox.cpp \
+    ../../common/widgets/usageComboBox/usagecombobox.cpp \
+    ../../common/widgets/vlnvEditor/VLNVContentMatcher.cpp \
+    ../../common/widgets/vlnvEditor/VLNVDataTree.cpp \
+    ../../common/widgets/vlnvEditor/vlnveditor.cpp \
+    ../../editors/ComponentEditor/ParameterItemEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/AbstractionTypesDelegate.cpp \
+    ../../editors/ComponentEditor/busInterfaces/AbstractionTypesEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/AbstractionTypesModel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/businterfaceeditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/businterfacesdelegate.cpp \
+    ../../editors/ComponentEditor/busInterfaces/businterfaceseditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/businterfacesmodel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/InitiatorModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/MasterModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/MirroredInitiatorModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/MirroredMasterModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/MirroredSlaveModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/MirroredTargetModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/ModeEditorBase.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/MonitorModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/SlaveModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/SystemModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/TargetModeEditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/bridgesdelegate.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/bridgeseditor.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/bridgesmodel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/busifgeneraldetails.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/busifgeneraltab.cpp \
+    ../../editors/ComponentEditor/busInterfaces/general/interfacemodestack.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/BusInterfacePortMapTab.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PhysicalPortMappingTableModel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PhysicalPortMappingTableView.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortListSortProxyModel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapAutoConnector.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapDelegate.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapHeaderView.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapModel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapSortFilter.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapView.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingTableModel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingTableView.cpp \
+    ../../editors/ComponentEditor/common/AbstractParameterModel.cpp \
+    ../../editors/ComponentEditor/common/EnumerationEditorConstructorDelegate.cpp \
+    ../../editors/ComponentEditor/common/ExpressionDelegate.cpp \
+    ../../editors/ComponentEditor/common/ExpressionEditor.cpp \
+    ../../editors/ComponentEditor/common/ExpressionLineEditor.cpp \
+    ../../editors/ComponentEditor/common/FloatingModeReferenceEditor.cpp \
+    ../../editors/ComponentEditor/common/MasterExpressionEditor.cpp \
+    ../../editors/ComponentEditor/common/ModeReferenceDelegate.cpp \
+    ../../editors/ComponentEditor/common/ModeReferenceEditor.cpp \
+    ../../editors/ComponentEditor/common/ModeReferenceModel.cpp \
+    ../../editors/ComponentEditor/common/MultilineDescriptionDelegate.cpp \
+    ../../editors/ComponentEditor/common/ParameterizableTable.cpp \
+    ../../editors/ComponentEditor/common/ReferenceSelector/ReferenceSelector.cpp \
+    ../../editors/ComponentEditor/common/ReferencingTableModel.cpp \
+    ../../editors/ComponentEditor/instantiations/filesetrefeditor.cpp \
+    ../../editors/ComponentEditor/instantiations/filesetrefeditordelegate.cpp \
+    ../../editors/ComponentEditor/instantiations/filesetrefmodel.cpp \
+    ../../editors/ComponentEditor/itemeditor.cpp \
+    ../../editors/ComponentEditor/itemvisualizer.cpp \
+    ../../editors/ComponentEditor/memoryMaps/AccessPoliciesDelegate.cpp \
+    ../../editors/ComponentEditor/memoryMaps/AccessPoliciesEditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/AccessPoliciesModel.cpp \
+    ../../editors/ComponentEditor/memoryMaps/ExpressionProxyModel.cpp \
+    ../../editors/ComponentEditor/memoryMaps/FieldAccessPoliciesDelegate.cpp \
+    ../../editors/ComponentEditor/memoryMaps/FieldAccessPoliciesEditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/FieldAccessPoliciesModel.cpp \
+    ../../editors/ComponentEditor/memoryMaps/ResetsDelegate.cpp \
+    ../../editors/ComponentEditor/memoryMaps/ResetsEditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/ResetsModel.cpp \
+    ../../editors/ComponentEditor/memoryMaps/SingleAddressBlockEditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/SingleFieldEditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/SingleRegisterEditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/SingleRegisterFileEditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/WriteValueConstraintComboBox.cpp \
+    ../../editors/ComponentEditor/memoryMaps/addressblockdelegate.cpp \
+    ../../editors/ComponentEditor/memoryMaps/addressblockeditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/addressblockmodel.cpp \
+    ../../editors/ComponentEditor/memoryMaps/enumeratedvaluedelegate.cpp \
+    ../../editors/ComponentEditor/memoryMaps/enumeratedvaluemodel.cpp \
+    ../../editors/ComponentEditor/memoryMaps/fieldeditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/ReferenceCalculator.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/ArrayableMemoryGraphItem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/MemoryBlockGraphItem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/fieldgraphitem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapgraphitem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapscene.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapsvisualizer.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapview.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registerfilegraphitem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/registerdelegate.cpp \
+    ../../editors/ComponentEditor/memoryMaps/registereditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/registerfiledelegate.cpp \
+    ../../editors/ComponentEditor/memoryMaps/registerfileeditor.cpp \
+    ../../editors/ComponentEditor/memoryMaps/registerfilemodel.cpp \
+    ../../editors/ComponentEditor/memoryMaps/registertablemodel.cpp \
+    ../../editors/ComponentEditor/parameters/Array/ArrayDelegate.cpp \
+    ../../editors/ComponentEditor/parameters/Array/ArrayView.cpp \
+    ../../editors/ComponentEditor/parameters/Array/ParameterArrayModel.cpp \
+    ../../editors/ComponentEditor/parameters/ChoiceCreatorDelegate.cpp \
+    ../../editors/ComponentEditor/parameters/ComponentParameterModel.cpp \
+    ../../editors/ComponentEditor/parameters/LockableParametersModel.cpp \
+    ../../editors/ComponentEditor/parameters/ParameterDelegate.cpp \
+    ../../editors/ComponentEditor/parameters/ParameterEditorHeaderView.cpp \
+    ../../editors/ComponentEditor/parameters/ParametersView.cpp \
+    ../../editors/ComponentEditor/parameters/parametersmodel.cpp \
+    ../../editors/ComponentEditor/treeStructure/ParameterizableItem.cpp \
+    ../../editors/ComponentEditor/treeStructure/componenteditoraddrblockitem.cpp \
+    ../../editors/ComponentEditor/treeStructure/componenteditorbusinterfaceitem.cpp \
+    ../../editors/ComponentEditor/treeStructure/componenteditorbusinterfacesitem.cpp \
+    ../../editors/ComponentEditor/treeStructure/componenteditorfielditem.cpp \
+    ../../editors/ComponentEditor/treeStructure/componenteditoritem.cpp \
+    ../../editors/ComponentEditor/treeStructure/componenteditorregisterfileitem.cpp \
+    ../../editors/ComponentEditor/treeStructure/componenteditorregisteritem.cpp \
+    ../../editors/ComponentEditor/treeStructure/componenteditorrootitem.cpp \
+    ../../editors/ComponentEditor/treeStructure/componenteditortreemodel.cpp \
+    ../../editors/ComponentEditor/visualization/AddressableItem.cpp \
+    ../../editors/ComponentEditor/visualization/fieldgapitem.cpp \
+    ../../editors/ComponentEditor/visualization/memorygapitem.cpp \
+    ../../editors/ComponentEditor/visualization/memoryvisualizationitem.cpp \
+    ./tst_ComponentEditorTreeModel.cpp
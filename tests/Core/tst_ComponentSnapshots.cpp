@@ -0,0 +1,267 @@
+//-----------------------------------------------------------------------------
+// File: tst_ComponentSnapshots.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for the shared component snapshots of design instances.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/common/ComponentSnapshots.h>
+
+#include <editors/HWDesign/ActiveBusInterfaceItem.h>
+#include <editors/HWDesign/HWComponentItem.h>
+
+#include <editors/SystemDesign/SWComponentItem.h>
+#include <editors/SystemDesign/SWPortItem.h>
+
+#include <tests/MockObjects/LibraryMock.h>
+
+#include <IPXACTmodels/common/ConfigurableVLNVReference.h>
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Design/ComponentInstance.h>
+#include <IPXACTmodels/kactusExtensions/ApiInterface.h>
+#include <IPXACTmodels/kactusExtensions/ComInterface.h>
+
+class tst_ComponentSnapshots : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ComponentSnapshots();
+
+private slots:
+
+    void init();
+
+    void testInstancesShareSnapshot();
+    void testNewLibraryDocumentRefreshesSnapshot();
+    void testDetachReturnsPrivateCopy();
+    void testSWPortInterfacesFollowDetachedComponent();
+    void testHWPortEditDetachesComponent();
+
+private:
+
+    /*!
+     *  Creates a component and adds it to the library.
+     *
+     *    @param [in] description     The description of the component.
+     *
+     *    @return The component in the library.
+     */
+    QSharedPointer<Component> addLibraryComponent(QString const& description);
+
+    /*!
+     *  Creates an instance of the test component.
+     *
+     *    @param [in] name    The name of the instance.
+     *
+     *    @return The created instance.
+     */
+    QSharedPointer<ComponentInstance> createInstance(QString const& name) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The VLNV of the test component.
+    VLNV componentVLNV_;
+
+    //! The library containing the test component.
+    LibraryMock library_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentSnapshots::tst_ComponentSnapshots()
+//-----------------------------------------------------------------------------
+tst_ComponentSnapshots::tst_ComponentSnapshots():
+componentVLNV_(VLNV::COMPONENT, "tut.fi", "test", "shared", "1.0"),
+library_(this)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentSnapshots::init()
+//-----------------------------------------------------------------------------
+void tst_ComponentSnapshots::init()
+{
+    library_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentSnapshots::testInstancesShareSnapshot()
+//-----------------------------------------------------------------------------
+void tst_ComponentSnapshots::testInstancesShareSnapshot()
+{
+    QSharedPointer<Component> libraryComponent = addLibraryComponent("original");
+
+    QSharedPointer<Component> first = ComponentSnapshots::getSnapshot(&library_, componentVLNV_);
+    QSharedPointer<Component> second = ComponentSnapshots::getSnapshot(&library_, componentVLNV_);
+
+    QVERIFY(first.isNull() == false);
+    QCOMPARE(first, second);
+    QVERIFY(first != libraryComponent);
+
+    QVERIFY(ComponentSnapshots::isShared(first));
+    QVERIFY(ComponentSnapshots::isShared(libraryComponent) == false);
+
+    QVERIFY(ComponentSnapshots::getSnapshot(&library_, VLNV(VLNV::COMPONENT, "tut.fi", "test", "missing", "1.0"))
+        .isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentSnapshots::testNewLibraryDocumentRefreshesSnapshot()
+//-----------------------------------------------------------------------------
+void tst_ComponentSnapshots::testNewLibraryDocumentRefreshesSnapshot()
+{
+    addLibraryComponent("original");
+    QSharedPointer<Component> original = ComponentSnapshots::getSnapshot(&library_, componentVLNV_);
+
+    // Saving the component replaces the library document.
+    addLibraryComponent("saved");
+    QSharedPointer<Component> refreshed = ComponentSnapshots::getSnapshot(&library_, componentVLNV_);
+
+    QVERIFY(refreshed != original);
+    QCOMPARE(refreshed->getDescription(), QString("saved"));
+    QCOMPARE(original->getDescription(), QString("original"));
+
+    // The instances still using the old snapshot must not modify it either.
+    QVERIFY(ComponentSnapshots::isShared(original));
+    QVERIFY(ComponentSnapshots::isShared(refreshed));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentSnapshots::testDetachReturnsPrivateCopy()
+//-----------------------------------------------------------------------------
+void tst_ComponentSnapshots::testDetachReturnsPrivateCopy()
+{
+    addLibraryComponent("original");
+    QSharedPointer<Component> snapshot = ComponentSnapshots::getSnapshot(&library_, componentVLNV_);
+
+    QSharedPointer<Component> detached = ComponentSnapshots::detach(snapshot);
+
+    QVERIFY(detached != snapshot);
+    QVERIFY(ComponentSnapshots::isShared(detached) == false);
+    QCOMPARE(detached->getVlnv(), componentVLNV_);
+
+    detached->setDescription("edited");
+    QCOMPARE(snapshot->getDescription(), QString("original"));
+
+    // A private component is modified in place.
+    QCOMPARE(ComponentSnapshots::detach(detached), detached);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentSnapshots::testSWPortInterfacesFollowDetachedComponent()
+//-----------------------------------------------------------------------------
+void tst_ComponentSnapshots::testSWPortInterfacesFollowDetachedComponent()
+{
+    QSharedPointer<Component> libraryComponent = addLibraryComponent("original");
+
+    QSharedPointer<ApiInterface> apiInterface(new ApiInterface());
+    apiInterface->setName("api");
+    libraryComponent->setApiInterfaces({ apiInterface });
+
+    QSharedPointer<ComInterface> comInterface(new ComInterface());
+    comInterface->setName("com");
+    libraryComponent->setComInterfaces({ comInterface });
+
+    QSharedPointer<Component> snapshot = ComponentSnapshots::getSnapshot(&library_, componentVLNV_);
+
+    SWComponentItem firstItem(&library_, snapshot, createInstance("first"));
+    SWComponentItem secondItem(&library_, snapshot, createInstance("second"));
+
+    SWPortItem* apiPort = firstItem.getSWPort("api", SWConnectionEndpoint::ENDPOINT_TYPE_API);
+    SWPortItem* comPort = firstItem.getSWPort("com", SWConnectionEndpoint::ENDPOINT_TYPE_COM);
+    QVERIFY(apiPort != nullptr);
+    QVERIFY(comPort != nullptr);
+    QCOMPARE(apiPort->getApiInterface(), snapshot->getApiInterface("api"));
+
+    firstItem.detachComponentModel();
+
+    QSharedPointer<Component> detached = firstItem.componentModel();
+    QVERIFY(detached != snapshot);
+    QCOMPARE(secondItem.componentModel(), snapshot);
+
+    QCOMPARE(apiPort->getOwnerComponent(), detached);
+    QCOMPARE(apiPort->getApiInterface(), detached->getApiInterface("api"));
+    QCOMPARE(comPort->getOwnerComponent(), detached);
+    QCOMPARE(comPort->getComInterface(), detached->getComInterface("com"));
+
+    // Renaming the port of the first instance must not show in the second one.
+    apiPort->setName("renamed");
+    QCOMPARE(snapshot->getApiInterfaces().first()->name(), QString("api"));
+    QVERIFY(secondItem.getSWPort("api", SWConnectionEndpoint::ENDPOINT_TYPE_API) != nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentSnapshots::testHWPortEditDetachesComponent()
+//-----------------------------------------------------------------------------
+void tst_ComponentSnapshots::testHWPortEditDetachesComponent()
+{
+    QSharedPointer<Component> libraryComponent = addLibraryComponent("original");
+
+    QSharedPointer<BusInterface> busInterface(new BusInterface());
+    busInterface->setName("bus");
+    libraryComponent->getBusInterfaces()->append(busInterface);
+
+    QSharedPointer<Component> snapshot = ComponentSnapshots::getSnapshot(&library_, componentVLNV_);
+
+    HWComponentItem firstItem(&library_, createInstance("first"), snapshot);
+    HWComponentItem secondItem(&library_, createInstance("second"), snapshot);
+
+    ActiveBusInterfaceItem* busPort = firstItem.getBusPort("bus");
+    QVERIFY(busPort != nullptr);
+
+    // Adding an interface to the first instance must not add it to the other instances of the component.
+    firstItem.addPort(QPointF(0, 0));
+
+    QSharedPointer<Component> detached = firstItem.componentModel();
+    QVERIFY(detached != snapshot);
+    QCOMPARE(detached->getBusInterfaces()->size(), 2);
+    QCOMPARE(snapshot->getBusInterfaces()->size(), 1);
+    QCOMPARE(secondItem.componentModel(), snapshot);
+
+    QCOMPARE(busPort->getOwnerComponent(), detached);
+    QCOMPARE(busPort->getBusInterface(), detached->getBusInterface("bus"));
+
+    // Editing the interface of an instance takes the private copy before the edit.
+    ActiveBusInterfaceItem* secondBusPort = secondItem.getBusPort("bus");
+    secondBusPort->prepareInterfaceEdit();
+    secondBusPort->setDescription("edited");
+
+    QVERIFY(secondItem.componentModel() != snapshot);
+    QCOMPARE(secondItem.componentModel()->getBusInterface("bus")->description(), QString("edited"));
+    QVERIFY(snapshot->getBusInterface("bus")->description().isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentSnapshots::addLibraryComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_ComponentSnapshots::addLibraryComponent(QString const& description)
+{
+    QSharedPointer<Component> component(new Component(componentVLNV_, Document::Revision::Std14));
+    component->setDescription(description);
+
+    library_.addComponent(component);
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentSnapshots::createInstance()
+//-----------------------------------------------------------------------------
+QSharedPointer<ComponentInstance> tst_ComponentSnapshots::createInstance(QString const& name) const
+{
+    return QSharedPointer<ComponentInstance>(new ComponentInstance(name,
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(componentVLNV_))));
+}
+
+QTEST_MAIN(tst_ComponentSnapshots)
+
+#include "tst_ComponentSnapshots.moc"
@@ -0,0 +1,309 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+# This is a reminder that you are using a generated .pro file.
+# Remove it when you are finished editing this file.
+
+
+HEADERS += ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.h \
+    ../../editors/HWDesign/undoCommands/AdHocConnectionDeleteCommand.h \
+    ../../editors/HWDesign/AdHocEnabled.h \
+    ../../editors/HWDesign/undoCommands/AdHocTieOffConnectionDeleteCommand.h \
+    ../../editors/HWDesign/undoCommands/AdHocVisibilityChangeCommand.h \
+    ../../editors/common/Association/Associable.h \
+    ../../editors/common/Association/Association.h \
+    ../../editors/common/Association/AssociationAddCommand.h \
+    ../../editors/common/Association/AssociationChangeEndpointCommand.h \
+    ../../editors/common/Association/AssociationRemoveCommand.h \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnectorItem.h \
+    ../../editors/common/ComponentItemAutoConnector/BusInterfaceItemMatcher.h \
+    ../../editors/common/ComponentItemAutoConnector/BusInterfaceListFiller.h \
+    ../../editors/common/ComponentItemAutoConnector/BusInterfaceTableAutoConnector.h \
+    ../../common/graphicsItems/CommonGraphicsUndoCommands.h \
+    ../../editors/HWDesign/undoCommands/ComponentInstancePasteCommand.h \
+    ../../editors/HWDesign/undoCommands/ComponentItemMoveCommand.h \
+    ../../editors/HWDesign/undoCommands/ConnectionDeleteCommand.h \
+    ../../common/graphicsItems/ConnectionUndoCommands.h \
+    ../../editors/common/ComponentSnapshots.h \
+    ../../editors/common/DefaultRouting.h \
+    ../../editors/common/OrthogonalRouter.h \
+    ../../editors/common/DesignDiagramResolver.h \
+    ../MockObjects/DesignWidgetFactoryMock.h \
+    ../../common/widgets/tagEditor/FlowLayout.h \
+    ../../common/graphicsItems/GraphicsColumnAddCommand.h \
+    ../../common/graphicsItems/GraphicsColumnUndoCommands.h \
+    ../../editors/common/GraphicsItemLabel.h \
+    ../../editors/HWDesign/HWAddCommands.h \
+    ../../editors/HWDesign/undoCommands/HWColumnAddCommand.h \
+    ../../editors/SystemDesign/HWMappingItem.h \
+    ../../editors/HWDesign/HWMoveCommands.h \
+    ../../editors/common/ComponentItemAutoConnector/HierarchicalBusInterfaceItemMatcher.h \
+    ../../editors/common/ComponentItemAutoConnector/HierarchicalBusInterfaceTableAutoConnector.h \
+    ../../editors/common/ComponentItemAutoConnector/HierarchicalPortItemMatcher.h \
+    ../../editors/common/ComponentItemAutoConnector/HierarchicalPortTableAutoConnector.h \
+    ../../kactusGenerators/DocumentGenerator/HtmlWriter.h \
+    ../../editors/common/ImageExporter.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.h \
+    ../../common/widgets/assistedLineEdit/LineContentAssistWidget.h \
+    ../../kactusGenerators/DocumentGenerator/MarkdownWriter.h \
+    ../../editors/ComponentEditor/common/MasterExpressionEditor.h \
+    ../../editors/common/NamelabelWidth.h \
+    ../../editors/ComponentEditor/common/ParameterizableTable.h \
+    ../../editors/common/ComponentItemAutoConnector/PortItemMatcher.h \
+    ../../editors/common/ComponentItemAutoConnector/PortListFiller.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapHeaderView.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapSortFilter.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingColumns.h \
+    ../../editors/HWDesign/undoCommands/PortPasteCommand.h \
+    ../../editors/common/ComponentItemAutoConnector/PortTableAutoConnector.h \
+    ../../editors/common/PortUtilities.h \
+    ../../editors/common/StickyNote/StickyNoteEditCommand.h \
+    ../../editors/common/StickyNote/StickyNoteMoveCommand.h \
+    ../../editors/HWDesign/WarningSymbol.h \
+    ../../editors/HWDesign/ActiveBusInterfaceItem.h \
+    ../../editors/HWDesign/ActivePortItem.h \
+    ../../editors/HWDesign/AdHocConnectionItem.h \
+    ../../editors/HWDesign/AdHocItem.h \
+    ../../common/widgets/assistedLineEdit/AssistedLineEdit.h \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnector.h \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnectorConnectionDelegate.h \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnectorConnectionTable.h \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnectorListFilter.h \
+    ../../editors/HWDesign/BusInterfaceDialog.h \
+    ../../editors/HWDesign/BusInterfaceEndPoint.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/BusInterfacePortMapTab.h \
+    ../../common/widgets/colorBox/ColorBox.h \
+    ../../editors/common/StickyNote/ColorFillTextItem.h \
+    ../../editors/HWDesign/columnview/ColumnEditDialog.h \
+    ../../editors/HWDesign/undoCommands/ComponentDeleteCommand.h \
+    ../../editors/common/ComponentDesignDiagram.h \
+    ../../common/graphicsItems/ComponentItem.h \
+    ../../editors/common/ComponentItemAutoConnector/ComponentItemAutoConnector.h \
+    ../../editors/ComponentEditor/parameters/ComponentParameterModel.h \
+    ../../common/widgets/componentPreviewBox/ComponentPreviewBox.h \
+    ../../editors/common/ComponentInstanceEditor/ConfigurableElementsView.h \
+    ../../common/graphicsItems/ConnectionEndpoint.h \
+    ../../editors/common/DesignDiagram.h \
+    ../../editors/common/DesignWidget.h \
+    ../../common/views/EditableTreeView/EditableTreeSortFilter.h \
+    ../../common/views/EditableTreeView/EditableTreeView.h \
+    ../../editors/ComponentEditor/common/ExpressionDelegate.h \
+    ../../editors/ComponentEditor/common/ExpressionEditor.h \
+    ../../editors/ComponentEditor/common/ExpressionLineEditor.h \
+    ../../common/GenericEditProvider.h \
+    ../../common/graphicsItems/GraphicsColumn.h \
+    ../../common/graphicsItems/GraphicsColumnLayout.h \
+    ../../common/graphicsItems/GraphicsConnection.h \
+    ../../editors/HWDesign/HWChangeCommands.h \
+    ../../editors/HWDesign/columnview/HWColumn.h \
+    ../../editors/HWDesign/undoCommands/HWComponentAddCommand.h \
+    ../../editors/HWDesign/HWComponentItem.h \
+    ../../editors/HWDesign/HWConnection.h \
+    ../../editors/HWDesign/HWConnectionEndpoint.h \
+    ../../editors/HWDesign/HWDesignDiagram.h \
+    ../MockObjects/HWDesignWidgetMock.h \
+    ../../editors/HWDesign/HierarchicalBusInterfaceItem.h \
+    ../../editors/HWDesign/HierarchicalPortItem.h \
+    ../../common/IEditProvider.h \
+    ../../common/widgets/kactusAttributeEditor/KactusAttributeEditor.h \
+    ../MockObjects/LibraryMock.h \
+    ../../common/widgets/LibrarySelectorWidget/LibrarySelectorWidget.h \
+    ../../common/dialogs/LibrarySettingsDialog/LibrarySettingsDialog.h \
+    ../../editors/ComponentEditor/common/MultilineDescriptionDelegate.h \
+    ../../editors/HWDesign/OffPageConnectorItem.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PhysicalPortMappingTableModel.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PhysicalPortMappingTableView.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortListSortProxyModel.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapAutoConnector.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapDelegate.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapModel.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapView.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingTableModel.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingTableView.h \
+    ../../editors/ComponentEditor/common/ReferencingTableModel.h \
+    ../../editors/HWDesign/undoCommands/ReplaceComponentCommand.h \
+    ../../editors/SystemDesign/SWComponentItem.h \
+    ../../editors/SystemDesign/SWConnectionEndpoint.h \
+    ../../editors/SystemDesign/SWPortItem.h \
+    ../../editors/HWDesign/SelectItemTypeDialog.h \
+    ../../editors/common/StickyNote/StickyNote.h \
+    ../../editors/common/StickyNote/StickyNoteAddCommand.h \
+    ../../editors/common/StickyNote/StickyNoteRemoveCommand.h \
+    ../../editors/SystemDesign/SystemComponentItem.h \
+    ../../common/widgets/tabDocument/TabDocument.h \
+    ../../common/widgets/tagEditor/TagCompleterModel.h \
+    ../../common/widgets/tagEditor/TagContainer.h \
+    ../../common/widgets/tagEditor/TagDisplay.h \
+    ../../common/widgets/tagEditor/TagEditor.h \
+    ../../common/widgets/tagEditor/TagEditorContainer.h \
+    ../../common/widgets/tagEditor/TagLabel.h \
+    ../../common/widgets/tagEditor/TagSelector.h \
+    ../../common/widgets/tagEditor/TagSelectorContainer.h \
+    ../../editors/common/ConfigurationEditor/activeviewmodel.h \
+    ../../kactusGenerators/DocumentGenerator/documentgenerator.h \
+    ../../common/views/EditableTableView/editabletableview.h \
+    ../../common/widgets/LibrarySelectorWidget/LibraryPathEditor/librarypatheditor.h \
+    ../../common/widgets/LibrarySelectorWidget/LibraryPathSelector/librarypathselector.h \
+    ../../common/validators/LibraryPathValidator/librarypathvalidator.h \
+    ../../common/dialogs/LibrarySettingsDialog/librarysettingsdelegate.h \
+    ../../common/delegates/LineEditDelegate/lineeditdelegate.h \
+    ../../common/dialogs/newObjectDialog/newobjectdialog.h \
+    ../../editors/ComponentEditor/itemvisualizer.h \
+    ../../common/widgets/vlnvEditor/vlnveditor.h \
+    ../../common/models/TableModelBase.h \
+    ../../common/KactusUtils.h
+SOURCES += ../../editors/HWDesign/ActiveBusInterfaceItem.cpp \
+    ../../editors/HWDesign/ActivePortItem.cpp \
+    ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.cpp \
+    ../../editors/HWDesign/undoCommands/AdHocConnectionDeleteCommand.cpp \
+    ../../editors/HWDesign/AdHocConnectionItem.cpp \
+    ../../editors/HWDesign/AdHocEnabled.cpp \
+    ../../editors/HWDesign/AdHocItem.cpp \
+    ../../editors/HWDesign/undoCommands/AdHocTieOffConnectionDeleteCommand.cpp \
+    ../../editors/HWDesign/undoCommands/AdHocVisibilityChangeCommand.cpp \
+    ../../common/widgets/assistedLineEdit/AssistedLineEdit.cpp \
+    ../../editors/common/Association/Associable.cpp \
+    ../../editors/common/Association/Association.cpp \
+    ../../editors/common/Association/AssociationAddCommand.cpp \
+    ../../editors/common/Association/AssociationChangeEndpointCommand.cpp \
+    ../../editors/common/Association/AssociationRemoveCommand.cpp \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnector.cpp \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnectorConnectionDelegate.cpp \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnectorConnectionTable.cpp \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnectorItem.cpp \
+    ../../editors/common/ComponentItemAutoConnector/AutoConnectorListFilter.cpp \
+    ../../editors/HWDesign/BusInterfaceDialog.cpp \
+    ../../editors/HWDesign/BusInterfaceEndPoint.cpp \
+    ../../editors/common/ComponentItemAutoConnector/BusInterfaceItemMatcher.cpp \
+    ../../editors/common/ComponentItemAutoConnector/BusInterfaceListFiller.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/BusInterfacePortMapTab.cpp \
+    ../../editors/common/ComponentItemAutoConnector/BusInterfaceTableAutoConnector.cpp \
+    ../../common/widgets/colorBox/ColorBox.cpp \
+    ../../editors/common/StickyNote/ColorFillTextItem.cpp \
+    ../../editors/HWDesign/columnview/ColumnEditDialog.cpp \
+    ../../common/graphicsItems/CommonGraphicsUndoCommands.cpp \
+    ../../editors/HWDesign/undoCommands/ComponentDeleteCommand.cpp \
+    ../../editors/common/ComponentDesignDiagram.cpp \
+    ../../editors/HWDesign/undoCommands/ComponentInstancePasteCommand.cpp \
+    ../../common/graphicsItems/ComponentItem.cpp \
+    ../../editors/common/ComponentItemAutoConnector/ComponentItemAutoConnector.cpp \
+    ../../editors/HWDesign/undoCommands/ComponentItemMoveCommand.cpp \
+    ../../editors/ComponentEditor/parameters/ComponentParameterModel.cpp \
+    ../../common/widgets/componentPreviewBox/ComponentPreviewBox.cpp \
+    ../../editors/common/ComponentInstanceEditor/ConfigurableElementsView.cpp \
+    ../../editors/HWDesign/undoCommands/ConnectionDeleteCommand.cpp \
+    ../../common/graphicsItems/ConnectionEndpoint.cpp \
+    ../../common/graphicsItems/ConnectionUndoCommands.cpp \
+    ../../editors/common/ComponentSnapshots.cpp \
+    ../../editors/common/DefaultRouting.cpp \
+    ../../editors/common/OrthogonalRouter.cpp \
+    ../../editors/common/DesignDiagram.cpp \
+    ../../editors/common/DesignDiagramResolver.cpp \
+    ../../editors/common/DesignWidget.cpp \
+    ../../kactusGenerators/DocumentGenerator/DocumentationWriter.cpp \
+    ../MockObjects/DesignWidgetFactoryMock.cpp \
+    ../../common/views/EditableTreeView/EditableTreeSortFilter.cpp \
+    ../../common/views/EditableTreeView/EditableTreeView.cpp \
+    ../../editors/ComponentEditor/common/ExpressionDelegate.cpp \
+    ../../editors/ComponentEditor/common/ExpressionEditor.cpp \
+    ../../editors/ComponentEditor/common/ExpressionLineEditor.cpp \
+    ../../common/widgets/tagEditor/FlowLayout.cpp \
+    ../../common/GenericEditProvider.cpp \
+    ../../common/graphicsItems/GraphicsColumn.cpp \
+    ../../common/graphicsItems/GraphicsColumnAddCommand.cpp \
+    ../../common/graphicsItems/GraphicsColumnLayout.cpp \
+    ../../common/graphicsItems/GraphicsColumnUndoCommands.cpp \
+    ../../common/graphicsItems/GraphicsConnection.cpp \
+    ../../editors/common/GraphicsItemLabel.cpp \
+    ../../editors/HWDesign/HWAddCommands.cpp \
+    ../../editors/HWDesign/HWChangeCommands.cpp \
+    ../../editors/HWDesign/columnview/HWColumn.cpp \
+    ../../editors/HWDesign/undoCommands/HWColumnAddCommand.cpp \
+    ../../editors/HWDesign/undoCommands/HWComponentAddCommand.cpp \
+    ../../editors/HWDesign/HWComponentItem.cpp \
+    ../../editors/HWDesign/HWConnection.cpp \
+    ../../editors/HWDesign/HWConnectionEndPoint.cpp \
+    ../../editors/HWDesign/HWDesignDiagram.cpp \
+    ../MockObjects/HWDesignWidgetMock.cpp \
+    ../../editors/SystemDesign/HWMappingItem.cpp \
+    ../../editors/HWDesign/HWMoveCommands.cpp \
+    ../../editors/HWDesign/HierarchicalBusInterfaceItem.cpp \
+    ../../editors/common/ComponentItemAutoConnector/HierarchicalBusInterfaceItemMatcher.cpp \
+    ../../editors/common/ComponentItemAutoConnector/HierarchicalBusInterfaceTableAutoConnector.cpp \
+    ../../editors/HWDesign/HierarchicalPortItem.cpp \
+    ../../editors/common/ComponentItemAutoConnector/HierarchicalPortItemMatcher.cpp \
+    ../../editors/common/ComponentItemAutoConnector/HierarchicalPortTableAutoConnector.cpp \
+    ../../kactusGenerators/DocumentGenerator/HtmlWriter.cpp \
+    ../../editors/common/ImageExporter.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.cpp \
+    ../../common/widgets/kactusAttributeEditor/KactusAttributeEditor.cpp \
+    ../MockObjects/LibraryMock.cpp \
+    ../../common/widgets/LibrarySelectorWidget/LibrarySelectorWidget.cpp \
+    ../../common/dialogs/LibrarySettingsDialog/LibrarySettingsDialog.cpp \
+    ../../common/widgets/assistedLineEdit/LineContentAssistWidget.cpp \
+    ../../kactusGenerators/DocumentGenerator/MarkdownWriter.cpp \
+    ../../editors/ComponentEditor/common/MasterExpressionEditor.cpp \
+    ../../editors/ComponentEditor/common/MultilineDescriptionDelegate.cpp \
+    ../../editors/common/NamelabelWidth.cpp \
+    ../../editors/HWDesign/OffPageConnectorItem.cpp \
+    ../../editors/ComponentEditor/common/ParameterizableTable.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PhysicalPortMappingTableModel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PhysicalPortMappingTableView.cpp \
+    ../../editors/common/ComponentItemAutoConnector/PortItemMatcher.cpp \
+    ../../editors/common/ComponentItemAutoConnector/PortListFiller.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortListSortProxyModel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapAutoConnector.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapDelegate.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapHeaderView.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapModel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapSortFilter.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMapView.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingTableModel.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/PortMappingTableView.cpp \
+    ../../editors/HWDesign/undoCommands/PortPasteCommand.cpp \
+    ../../editors/common/ComponentItemAutoConnector/PortTableAutoConnector.cpp \
+    ../../editors/common/PortUtilities.cpp \
+    ../../editors/HWDesign/PortmapDialog.cpp \
+    ../../editors/ComponentEditor/common/ReferencingTableModel.cpp \
+    ../../editors/HWDesign/undoCommands/ReplaceComponentCommand.cpp \
+    ../../editors/SystemDesign/SWComponentItem.cpp \
+    ../../editors/SystemDesign/SWConnectionEndpoint.cpp \
+    ../../editors/SystemDesign/SWPortItem.cpp \
+    ../../editors/HWDesign/SelectItemTypeDialog.cpp \
+    ../../editors/common/StickyNote/StickyNote.cpp \
+    ../../editors/common/StickyNote/StickyNoteAddCommand.cpp \
+    ../../editors/common/StickyNote/StickyNoteEditCommand.cpp \
+    ../../editors/common/StickyNote/StickyNoteMoveCommand.cpp \
+    ../../editors/common/StickyNote/StickyNoteRemoveCommand.cpp \
+    ../../editors/SystemDesign/SystemComponentItem.cpp \
+    ../../editors/SystemDesign/UndoCommands/SystemMoveCommands.cpp \
+    ../../common/widgets/tabDocument/TabDocument.cpp \
+    ../../editors/common/ComponentItemAutoConnector/TableAutoConnector.cpp \
+    ../../editors/common/ComponentItemAutoConnector/TableItemMatcher.cpp \
+    ../../common/widgets/tagEditor/TagCompleterModel.cpp \
+    ../../common/widgets/tagEditor/TagContainer.cpp \
+    ../../common/widgets/tagEditor/TagDisplay.cpp \
+    ../../common/widgets/tagEditor/TagEditor.cpp \
+    ../../common/widgets/tagEditor/TagEditorContainer.cpp \
+    ../../common/widgets/tagEditor/TagLabel.cpp \
+    ../../common/widgets/tagEditor/TagSelector.cpp \
+    ../../common/widgets/tagEditor/TagSelectorContainer.cpp \
+    ../../editors/HWDesign/undoCommands/TopAdHocVisibilityChangeCommand.cpp \
+    ../../common/widgets/vlnvEditor/VLNVContentMatcher.cpp \
+    ../../common/widgets/vlnvEditor/VLNVDataTree.cpp \
+    ../../editors/HWDesign/WarningSymbol.cpp \
+    ../../editors/common/ConfigurationEditor/activeviewmodel.cpp \
+    ../../kactusGenerators/DocumentGenerator/documentgenerator.cpp \
+    ../../common/views/EditableTableView/editabletableview.cpp \
+    ../../common/widgets/LibrarySelectorWidget/LibraryPathEditor/librarypatheditor.cpp \
+    ../../common/widgets/LibrarySelectorWidget/LibraryPathSelector/librarypathselector.cpp \
+    ../../common/validators/LibraryPathValidator/librarypathvalidator.cpp \
+    ../../common/dialogs/LibrarySettingsDialog/librarysettingsdelegate.cpp \
+    ../../common/delegates/LineEditDelegate/lineeditdelegate.cpp \
+    ../../common/dialogs/newObjectDialog/newobjectdialog.cpp \
+    ../../common/widgets/vlnvEditor/vlnveditor.cpp \
+    ../../editors/ComponentEditor/itemvisualizer.cpp \
+    ../../common/models/TableModelBase.cpp \
+    ../../common/KactusUtils.cpp \
+    ./tst_ComponentSnapshots.cpp
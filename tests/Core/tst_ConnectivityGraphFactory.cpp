@@ -0,0 +1,224 @@
+//-----------------------------------------------------------------------------
+// File: tst_ConnectivityGraphFactory.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class ConnectivityGraphFactory.
+//-----------------------------------------------------------------------------
+
+#include <editors/MemoryDesigner/ConnectivityGraphFactory.h>
+#include <editors/MemoryDesigner/ConnectivityGraph.h>
+#include <editors/MemoryDesigner/ConnectivityComponent.h>
+#include <editors/MemoryDesigner/MemoryDesignerConstants.h>
+#include <editors/MemoryDesigner/MemoryItem.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Register.h>
+
+#include <QtTest>
+
+class tst_ConnectivityGraphFactory : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ConnectivityGraphFactory();
+
+private slots:
+
+    void init();
+    void cleanup();
+
+    void testAllRegistersAreCreatedWithoutExpansionLimit();
+    void testLargeAddressBlockIsCollapsed();
+    void testExpandedAddressBlockIsNotCollapsed();
+    void testSmallAddressBlockIsNotCollapsed();
+
+private:
+
+    QSharedPointer<AddressBlock> addAddressBlock(QString const& blockName, int registerCount);
+
+    QSharedPointer<MemoryItem> findAddressBlockItem(QSharedPointer<ConnectivityGraph> graph,
+        QString const& blockName) const;
+
+    //! The test component.
+    QSharedPointer<Component> testComponent_;
+
+    //! The memory map containing the test address blocks.
+    QSharedPointer<MemoryMap> testMap_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectivityGraphFactory::tst_ConnectivityGraphFactory()
+//-----------------------------------------------------------------------------
+tst_ConnectivityGraphFactory::tst_ConnectivityGraphFactory()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectivityGraphFactory::init()
+//-----------------------------------------------------------------------------
+void tst_ConnectivityGraphFactory::init()
+{
+    testComponent_ = QSharedPointer<Component>(new Component(
+        VLNV(VLNV::COMPONENT, "TUT:Tests:TestComponent:1.0"), Document::Revision::Std14));
+
+    testMap_ = QSharedPointer<MemoryMap>(new MemoryMap("testMap"));
+    testMap_->setAddressUnitBits("8");
+    testComponent_->getMemoryMaps()->append(testMap_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectivityGraphFactory::cleanup()
+//-----------------------------------------------------------------------------
+void tst_ConnectivityGraphFactory::cleanup()
+{
+    testMap_.clear();
+    testComponent_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectivityGraphFactory::testAllRegistersAreCreatedWithoutExpansionLimit()
+//-----------------------------------------------------------------------------
+void tst_ConnectivityGraphFactory::testAllRegistersAreCreatedWithoutExpansionLimit()
+{
+    int const registerCount = MemoryDesignerConstants::MAXIMUM_EXPANDED_REGISTERS + 1;
+    addAddressBlock("largeBlock", registerCount);
+
+    ConnectivityGraphFactory factory(nullptr);
+    QSharedPointer<ConnectivityGraph> graph = factory.createConnectivityGraph(testComponent_, QString());
+
+    QSharedPointer<MemoryItem> blockItem = findAddressBlockItem(graph, "largeBlock");
+    QVERIFY(blockItem.isNull() == false);
+
+    QCOMPARE(blockItem->getChildItems().size(), registerCount);
+    QCOMPARE(blockItem->getCollapsedChildCount(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectivityGraphFactory::testLargeAddressBlockIsCollapsed()
+//-----------------------------------------------------------------------------
+void tst_ConnectivityGraphFactory::testLargeAddressBlockIsCollapsed()
+{
+    int const registerCount = MemoryDesignerConstants::MAXIMUM_EXPANDED_REGISTERS + 1;
+    addAddressBlock("largeBlock", registerCount);
+
+    ConnectivityGraphFactory factory(nullptr);
+    factory.setRegisterExpansionLimit(MemoryDesignerConstants::MAXIMUM_EXPANDED_REGISTERS);
+    QSharedPointer<ConnectivityGraph> graph = factory.createConnectivityGraph(testComponent_, QString());
+
+    QSharedPointer<MemoryItem> blockItem = findAddressBlockItem(graph, "largeBlock");
+    QVERIFY(blockItem.isNull() == false);
+
+    QCOMPARE(blockItem->getChildItems().size(), 0);
+    QCOMPARE(blockItem->getCollapsedChildCount(), registerCount);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectivityGraphFactory::testExpandedAddressBlockIsNotCollapsed()
+//-----------------------------------------------------------------------------
+void tst_ConnectivityGraphFactory::testExpandedAddressBlockIsNotCollapsed()
+{
+    int const registerCount = MemoryDesignerConstants::MAXIMUM_EXPANDED_REGISTERS + 1;
+    addAddressBlock("largeBlock", registerCount);
+    addAddressBlock("otherBlock", registerCount);
+
+    ConnectivityGraphFactory collapsingFactory(nullptr);
+    collapsingFactory.setRegisterExpansionLimit(MemoryDesignerConstants::MAXIMUM_EXPANDED_REGISTERS);
+    QSharedPointer<MemoryItem> collapsedItem =
+        findAddressBlockItem(collapsingFactory.createConnectivityGraph(testComponent_, QString()), "largeBlock");
+    QVERIFY(collapsedItem.isNull() == false);
+
+    ConnectivityGraphFactory factory(nullptr);
+    factory.setRegisterExpansionLimit(MemoryDesignerConstants::MAXIMUM_EXPANDED_REGISTERS);
+    factory.setExpandedAddressBlocks(QSet<QString>({ collapsedItem->getIdentifier() }));
+    QSharedPointer<ConnectivityGraph> graph = factory.createConnectivityGraph(testComponent_, QString());
+
+    QSharedPointer<MemoryItem> blockItem = findAddressBlockItem(graph, "largeBlock");
+    QVERIFY(blockItem.isNull() == false);
+    QCOMPARE(blockItem->getIdentifier(), collapsedItem->getIdentifier());
+
+    QCOMPARE(blockItem->getChildItems().size(), registerCount);
+    QCOMPARE(blockItem->getCollapsedChildCount(), 0);
+
+    QSharedPointer<MemoryItem> otherItem = findAddressBlockItem(graph, "otherBlock");
+    QVERIFY(otherItem.isNull() == false);
+
+    QCOMPARE(otherItem->getChildItems().size(), 0);
+    QCOMPARE(otherItem->getCollapsedChildCount(), registerCount);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectivityGraphFactory::testSmallAddressBlockIsNotCollapsed()
+//-----------------------------------------------------------------------------
+void tst_ConnectivityGraphFactory::testSmallAddressBlockIsNotCollapsed()
+{
+    int const registerCount = MemoryDesignerConstants::MAXIMUM_EXPANDED_REGISTERS;
+    addAddressBlock("smallBlock", registerCount);
+
+    ConnectivityGraphFactory factory(nullptr);
+    factory.setRegisterExpansionLimit(MemoryDesignerConstants::MAXIMUM_EXPANDED_REGISTERS);
+    QSharedPointer<ConnectivityGraph> graph = factory.createConnectivityGraph(testComponent_, QString());
+
+    QSharedPointer<MemoryItem> blockItem = findAddressBlockItem(graph, "smallBlock");
+    QVERIFY(blockItem.isNull() == false);
+
+    QCOMPARE(blockItem->getChildItems().size(), registerCount);
+    QCOMPARE(blockItem->getCollapsedChildCount(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectivityGraphFactory::addAddressBlock()
+//-----------------------------------------------------------------------------
+QSharedPointer<AddressBlock> tst_ConnectivityGraphFactory::addAddressBlock(QString const& blockName,
+    int registerCount)
+{
+    QSharedPointer<AddressBlock> block(new AddressBlock(blockName, "0"));
+    block->setRange(QString::number(registerCount * 4));
+    block->setWidth("32");
+
+    for (int i = 0; i < registerCount; ++i)
+    {
+        QSharedPointer<Register> reg(new Register("reg" + QString::number(i), QString::number(i * 4), "32"));
+        block->getRegisterData()->append(reg);
+    }
+
+    testMap_->getMemoryBlocks()->append(block);
+    return block;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectivityGraphFactory::findAddressBlockItem()
+//-----------------------------------------------------------------------------
+QSharedPointer<MemoryItem> tst_ConnectivityGraphFactory::findAddressBlockItem(
+    QSharedPointer<ConnectivityGraph> graph, QString const& blockName) const
+{
+    for (QSharedPointer<ConnectivityComponent> instance : graph->getInstances())
+    {
+        for (QSharedPointer<MemoryItem> memory : instance->getMemories())
+        {
+            if (memory->getType() == MemoryDesignerConstants::MEMORYMAP_TYPE)
+            {
+                for (QSharedPointer<MemoryItem> block : memory->getChildItems())
+                {
+                    if (block->getName() == blockName)
+                    {
+                        return block;
+                    }
+                }
+            }
+        }
+    }
+
+    return QSharedPointer<MemoryItem>();
+}
+
+QTEST_MAIN(tst_ConnectivityGraphFactory)
+
+#include "tst_ConnectivityGraphFactory.moc"
@@ -0,0 +1,25 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+# This is a reminder that you are using a generated .pro file.
+# Remove it when you are finished editing this file.
+
+
+HEADERS += ../../common/graphicsItems/GraphicsColumnConstants.h \
+    ../../editors/common/diagramgrid.h \
+    ../../editors/MemoryDesigner/ConnectivityComponent.h \
+    ../../editors/MemoryDesigner/ConnectivityConnection.h \
+    ../../editors/MemoryDesigner/ConnectivityGraph.h \
+    ../../editors/MemoryDesigner/ConnectivityGraphFactory.h \
+    ../../editors/MemoryDesigner/ConnectivityInterface.h \
+    ../../editors/MemoryDesigner/MemoryDesignerConstants.h \
+    ../../editors/MemoryDesigner/MemoryItem.h
+SOURCES += ../../editors/MemoryDesigner/ConnectivityComponent.cpp \
+    ../../editors/MemoryDesigner/ConnectivityConnection.cpp \
+    ../../editors/MemoryDesigner/ConnectivityGraph.cpp \
+    ../../editors/MemoryDesigner/ConnectivityGraphFactory.cpp \
+    ../../editors/MemoryDesigner/ConnectivityInterface.cpp \
+    ../../editors/MemoryDesigner/MemoryDesignerConstants.cpp \
+    ../../editors/MemoryDesigner/MemoryItem.cpp \
+    ./tst_ConnectivityGraphFactory.cpp
@@ -86,6 +86,8 @@ private slots:
 
     void testEndOfDocumentWrittenForTopComponent();
 
+    void testConcurrentDocumentMatchesSequentialDocument();
+
 private:
 
     /*!
@@ -93,6 +95,15 @@ private:
      */
     DocumentGenerator* createTestGenerator();
 
+    /*!
+     *  Write the whole document of the test component.
+     *
+     *      @param [in] concurrently    If true, the sections are written concurrently.
+     *
+     *      @return The document without the line containing the generation time.
+     */
+    QString writeTestDocument(bool concurrently);
+
     /*!
      *  Read the output file of the generator.
      */
@@ -1482,6 +1493,75 @@ void tst_DocumentGenerator::testEndOfDocumentWrittenForTopComponent()
     checkOutputFile(expectedOutput);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentGenerator::testConcurrentDocumentMatchesSequentialDocument()
+//-----------------------------------------------------------------------------
+void tst_DocumentGenerator::testConcurrentDocumentMatchesSequentialDocument()
+{
+    VLNV designVlnv(VLNV::DESIGN, "Test", "TestLibrary", "TestDesign", "1.0");
+    QSharedPointer<Design> design = QSharedPointer<Design>(new Design(designVlnv, Document::Revision::Std14));
+    library_.writeModelToFile("C:/Test/TestLibrary/TestDesign/1.0/TestDesign.1.0.xml", design);
+    library_.addComponent(design);
+
+    // Enough components for several windows of workers.
+    int const subComponentCount = 2 * QThread::idealThreadCount() + 1;
+    for (int i = 0; i < subComponentCount; ++i)
+    {
+        QString const name = QString("SubComponent%1").arg(i);
+
+        VLNV subVlnv(VLNV::COMPONENT, "Test", "TestLibrary", name, "1.0");
+        QSharedPointer<Component> subComponent(new Component(subVlnv, Document::Revision::Std14));
+        subComponent->getParameters()->append(createTestParameter("parameter", QString::number(i), "",
+            "ID_" + name, "", ""));
+        subComponent->getPorts()->append(createTestPort("port", QString::number(i), "0", "", "", ""));
+        subComponent->getFileSets()->append(QSharedPointer<FileSet>(new FileSet("fileSet")));
+
+        library_.writeModelToFile("C:/Test/TestLibrary/" + name + "/1.0/" + name + ".1.0.xml", subComponent);
+        library_.addComponent(subComponent);
+
+        QSharedPointer<ConfigurableVLNVReference> instanceVLNV(new ConfigurableVLNVReference(subVlnv));
+        design->getComponentInstances()->append(QSharedPointer<ComponentInstance>(
+            new ComponentInstance("instance" + QString::number(i), instanceVLNV)));
+    }
+
+    QSharedPointer<View> hierarchicalView(new View);
+    hierarchicalView->setName("HierarchicalView");
+    hierarchicalView->setDesignInstantiationRef("design_instantiation");
+    topComponent_->getViews()->append(hierarchicalView);
+
+    QSharedPointer<DesignInstantiation> designInstantiation(new DesignInstantiation("design_instantiation"));
+    designInstantiation->setDesignReference(
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(designVlnv)));
+    topComponent_->getDesignInstantiations()->append(designInstantiation);
+
+    QString sequentialDocument = writeTestDocument(false);
+    QString concurrentDocument = writeTestDocument(true);
+
+    QDir(QFileInfo(targetPath_).absolutePath() + "/images").removeRecursively();
+
+    QVERIFY(sequentialDocument.contains("SubComponent" + QString::number(subComponentCount - 1)));
+    QCOMPARE(concurrentDocument, sequentialDocument);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentGenerator::writeTestDocument()
+//-----------------------------------------------------------------------------
+QString tst_DocumentGenerator::writeTestDocument(bool concurrently)
+{
+    QScopedPointer<DocumentGenerator> generator(createTestGenerator());
+
+    QString document;
+    QTextStream stream(&document);
+
+    generator->writeDocument(stream, targetPath_, concurrently);
+    stream.flush();
+
+    QStringList lines = document.split("\n");
+    lines.removeIf([](QString const& line) { return line.contains("This document was generated by Kactus2"); });
+
+    return lines.join("\n");
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_DocumentGenerator::createTestGenerator()
 //-----------------------------------------------------------------------------
@@ -25,7 +25,9 @@ HEADERS += ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.h \
     ../../editors/HWDesign/undoCommands/ComponentItemMoveCommand.h \
     ../../editors/HWDesign/undoCommands/ConnectionDeleteCommand.h \
     ../../common/graphicsItems/ConnectionUndoCommands.h \
+    ../../editors/common/ComponentSnapshots.h \
     ../../editors/common/DefaultRouting.h \
+    ../../editors/common/OrthogonalRouter.h \
     ../../editors/common/DesignDiagramResolver.h \
     ../MockObjects/DesignWidgetFactoryMock.h \
     ../../common/widgets/tagEditor/FlowLayout.h \
@@ -193,7 +195,9 @@ SOURCES += ../../editors/HWDesign/ActiveBusInterfaceItem.cpp \
     ../../editors/HWDesign/undoCommands/ConnectionDeleteCommand.cpp \
     ../../common/graphicsItems/ConnectionEndpoint.cpp \
     ../../common/graphicsItems/ConnectionUndoCommands.cpp \
+    ../../editors/common/ComponentSnapshots.cpp \
     ../../editors/common/DefaultRouting.cpp \
+    ../../editors/common/OrthogonalRouter.cpp \
     ../../editors/common/DesignDiagram.cpp \
     ../../editors/common/DesignDiagramResolver.cpp \
     ../../editors/common/DesignWidget.cpp \
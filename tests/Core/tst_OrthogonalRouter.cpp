@@ -0,0 +1,268 @@
+//-----------------------------------------------------------------------------
+// File: tst_OrthogonalRouter.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class OrthogonalRouter.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/common/OrthogonalRouter.h>
+
+class tst_OrthogonalRouter : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_OrthogonalRouter();
+
+private slots:
+    void testRouteWithoutObstacles();
+    void testRouteAvoidsObstacle();
+    void testRouteLeavesStartComponent();
+    void testRouteAvoidsOverlappingStoredRoutes();
+    void testCountCrossings();
+    void testRouteAllStoresIdentifiedRoutes();
+
+private:
+
+    /*!
+     *  Creates a routing request.
+     *
+     *    @param [in] start           The start point.
+     *    @param [in] startDirection  The exit direction from the start point.
+     *    @param [in] end             The end point.
+     *    @param [in] endDirection    The exit direction from the end point.
+     *    @param [in] routeId         Identifier of the route.
+     *
+     *    @return The routing request.
+     */
+    OrthogonalRouter::RouteRequest createRequest(QPointF const& start, QVector2D const& startDirection,
+        QPointF const& end, QVector2D const& endDirection, int routeId = -1) const;
+
+    /*!
+     *  Checks that all the segments of a route are horizontal or vertical.
+     *
+     *    @param [in] route   The route to check.
+     *
+     *    @return True, if the route is orthogonal.
+     */
+    bool isOrthogonal(QList<QPointF> const& route) const;
+
+    /*!
+     *  Checks if any segment of a route passes through the inside of a rectangle.
+     *
+     *    @param [in] route       The route to check.
+     *    @param [in] rectangle   The rectangle to check.
+     *
+     *    @return True, if the route passes through the rectangle.
+     */
+    bool passesThrough(QList<QPointF> const& route, QRectF const& rectangle) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::tst_OrthogonalRouter()
+//-----------------------------------------------------------------------------
+tst_OrthogonalRouter::tst_OrthogonalRouter()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testRouteWithoutObstacles()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testRouteWithoutObstacles()
+{
+    OrthogonalRouter router;
+
+    QList<QPointF> route = router.route(createRequest(QPointF(0, 0), QVector2D(1, 0),
+        QPointF(200, 100), QVector2D(-1, 0)));
+
+    QVERIFY(route.size() >= 4);
+    QCOMPARE(route.first(), QPointF(0, 0));
+    QCOMPARE(route.last(), QPointF(200, 100));
+    QVERIFY(isOrthogonal(route));
+
+    // The route must leave and enter the endpoints in their directions.
+    QVERIFY(route.at(1).x() > route.first().x());
+    QVERIFY(route.at(route.size() - 2).x() < route.last().x());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testRouteAvoidsObstacle()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testRouteAvoidsObstacle()
+{
+    QRectF obstacle(150, 50, 100, 100);
+
+    OrthogonalRouter router;
+    router.setObstacles({ obstacle });
+
+    QList<QPointF> route = router.route(createRequest(QPointF(0, 100), QVector2D(1, 0),
+        QPointF(400, 100), QVector2D(-1, 0)));
+
+    QCOMPARE(route.first(), QPointF(0, 100));
+    QCOMPARE(route.last(), QPointF(400, 100));
+    QVERIFY(isOrthogonal(route));
+    QVERIFY(passesThrough(route, obstacle) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testRouteLeavesStartComponent()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testRouteLeavesStartComponent()
+{
+    QRectF component(0, 0, 100, 100);
+
+    OrthogonalRouter router;
+    router.setObstacles({ component });
+
+    // The route starts from the right side of the component and ends on its left side.
+    QList<QPointF> route = router.route(createRequest(QPointF(100, 50), QVector2D(1, 0),
+        QPointF(-100, 50), QVector2D(-1, 0)));
+
+    QCOMPARE(route.first(), QPointF(100, 50));
+    QCOMPARE(route.last(), QPointF(-100, 50));
+    QVERIFY(isOrthogonal(route));
+    QVERIFY(passesThrough(route, component) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testRouteAvoidsOverlappingStoredRoutes()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testRouteAvoidsOverlappingStoredRoutes()
+{
+    OrthogonalRouter router;
+    router.setRoute(0, QList<QPointF>({ QPointF(20, 0), QPointF(180, 0) }));
+
+    QList<QPointF> route = router.route(createRequest(QPointF(0, 0), QVector2D(1, 0),
+        QPointF(200, 0), QVector2D(-1, 0)));
+
+    QCOMPARE(route.first(), QPointF(0, 0));
+    QCOMPARE(route.last(), QPointF(200, 0));
+    QVERIFY(isOrthogonal(route));
+
+    // Only the start and end stubs may run on the line of the stored route.
+    for (int i = 0; i < route.size() - 1; ++i)
+    {
+        if (qFuzzyIsNull(route.at(i).y()) && qFuzzyIsNull(route.at(i + 1).y()))
+        {
+            QVERIFY(qAbs(route.at(i + 1).x() - route.at(i).x()) <= 20);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testCountCrossings()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testCountCrossings()
+{
+    OrthogonalRouter router;
+    router.setRoute(0, QList<QPointF>({ QPointF(100, -100), QPointF(100, 100) }));
+    router.setRoute(1, QList<QPointF>({ QPointF(300, -100), QPointF(300, 100) }));
+    QCOMPARE(router.getRouteCount(), 2);
+
+    QList<QPointF> route({ QPointF(0, 0), QPointF(400, 0) });
+    QCOMPARE(router.countCrossings(route), 2);
+    QCOMPARE(router.countCrossings(route, 1), 1);
+
+    // Touching the end of a route is not a crossing.
+    QCOMPARE(router.countCrossings(QList<QPointF>({ QPointF(0, 100), QPointF(400, 100) })), 0);
+
+    router.removeRoute(0);
+    QCOMPARE(router.getRouteCount(), 1);
+    QCOMPARE(router.countCrossings(route), 1);
+
+    router.clearRoutes();
+    QCOMPARE(router.getRouteCount(), 0);
+    QCOMPARE(router.countCrossings(route), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testRouteAllStoresIdentifiedRoutes()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testRouteAllStoresIdentifiedRoutes()
+{
+    OrthogonalRouter router;
+    router.setObstacles({ QRectF(0, 0, 100, 200), QRectF(400, 0, 100, 200) });
+
+    QList<OrthogonalRouter::RouteRequest> requests;
+    requests.append(createRequest(QPointF(100, 50), QVector2D(1, 0), QPointF(400, 50), QVector2D(-1, 0), 0));
+    requests.append(createRequest(QPointF(100, 150), QVector2D(1, 0), QPointF(400, 150), QVector2D(-1, 0), 1));
+    requests.append(createRequest(QPointF(100, 100), QVector2D(1, 0), QPointF(400, 100), QVector2D(-1, 0)));
+
+    QList<QList<QPointF> > routes = router.routeAll(requests);
+
+    QCOMPARE(routes.size(), 3);
+    QCOMPARE(router.getRouteCount(), 2);
+
+    for (int i = 0; i < routes.size(); ++i)
+    {
+        QCOMPARE(routes.at(i).first(), requests.at(i).start);
+        QCOMPARE(routes.at(i).last(), requests.at(i).end);
+        QVERIFY(isOrthogonal(routes.at(i)));
+    }
+
+    // The parallel routes should not cross each other.
+    QCOMPARE(router.countCrossings(routes.at(2)), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::createRequest()
+//-----------------------------------------------------------------------------
+OrthogonalRouter::RouteRequest tst_OrthogonalRouter::createRequest(QPointF const& start,
+    QVector2D const& startDirection, QPointF const& end, QVector2D const& endDirection, int routeId) const
+{
+    OrthogonalRouter::RouteRequest request;
+    request.routeId = routeId;
+    request.start = start;
+    request.startDirection = startDirection;
+    request.end = end;
+    request.endDirection = endDirection;
+
+    return request;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::isOrthogonal()
+//-----------------------------------------------------------------------------
+bool tst_OrthogonalRouter::isOrthogonal(QList<QPointF> const& route) const
+{
+    for (int i = 0; i < route.size() - 1; ++i)
+    {
+        if (qAbs(route.at(i).x() - route.at(i + 1).x()) > 0.01 &&
+            qAbs(route.at(i).y() - route.at(i + 1).y()) > 0.01)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::passesThrough()
+//-----------------------------------------------------------------------------
+bool tst_OrthogonalRouter::passesThrough(QList<QPointF> const& route, QRectF const& rectangle) const
+{
+    QRectF inside = rectangle.adjusted(1, 1, -1, -1);
+
+    for (int i = 0; i < route.size() - 1; ++i)
+    {
+        QRectF segment = QRectF(route.at(i), route.at(i + 1)).normalized();
+        if (segment.left() < inside.right() && segment.right() > inside.left() &&
+            segment.top() < inside.bottom() && segment.bottom() > inside.top())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+QTEST_APPLESS_MAIN(tst_OrthogonalRouter)
+
+#include "tst_OrthogonalRouter.moc"
@@ -0,0 +1,37 @@
+#-----------------------------------------------------------------------------
+# File: tst_OrthogonalRouter.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for OrthogonalRouter.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core gui testlib
+CONFIG += c++17 testcase console
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_OrthogonalRouterd
+
+} else {
+    # release mode
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_OrthogonalRouter
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../
+
+DEPENDPATH += .
+DEPENDPATH += ../../
+
+OBJECTS_DIR += $$DESTDIR
+include(tst_OrthogonalRouter.pri)
@@ -63,6 +63,10 @@ private slots:
 
     void testNonPresentField();
 
+    void testFieldAfterOverlappingFields();
+
+    void testBatchedChildUpdate();
+
 private:
     void expandItem(RegisterGraphItem* registerItem);
 
@@ -604,6 +608,62 @@ void tst_RegisterGraphItem::testNonPresentField()
     delete registerItem->parentItem();
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterGraphItem::testFieldAfterOverlappingFields()
+//-----------------------------------------------------------------------------
+void tst_RegisterGraphItem::testFieldAfterOverlappingFields()
+{
+    RegisterGraphItem* registerItem = createRegisterItem();
+
+    FieldGraphItem* firstItem = createFieldItem("first", 0, 2, registerItem);
+    FieldGraphItem* secondItem = createFieldItem("second", 1, 2, registerItem);
+    FieldGraphItem* separateItem = createFieldItem("separate", 4, 2, registerItem);
+    FieldGraphItem* lastItem = createFieldItem("last", 6, 2, registerItem);
+
+    registerItem->redoChildLayout();
+    expandItem(registerItem);
+
+    QVERIFY(firstItem->isConflicted());
+    QVERIFY(secondItem->isConflicted());
+    QVERIFY(!separateItem->isConflicted());
+    QVERIFY(!lastItem->isConflicted());
+
+    delete registerItem->parentItem();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterGraphItem::testBatchedChildUpdate()
+//-----------------------------------------------------------------------------
+void tst_RegisterGraphItem::testBatchedChildUpdate()
+{
+    RegisterGraphItem* registerItem = createRegisterItem();
+
+    registerItem->beginChildUpdate();
+
+    FieldGraphItem* firstItem = createFieldItem("first", 0, 4, registerItem);
+    registerItem->redoChildLayout();
+
+    FieldGraphItem* secondItem = createFieldItem("second", 2, 4, registerItem);
+    registerItem->redoChildLayout();
+
+    // The layout is not redone until the update is ended.
+    QVERIFY(!firstItem->isConflicted());
+    QVERIFY(!secondItem->isConflicted());
+
+    registerItem->endChildUpdate();
+    expandItem(registerItem);
+
+    QVERIFY(firstItem->isConflicted());
+    QVERIFY(secondItem->isConflicted());
+
+    QList<MemoryGapItem*> reservedSpaces = findMemoryGaps(registerItem);
+    QCOMPARE(reservedSpaces.size(), 1);
+    QCOMPARE(reservedSpaces.first()->getDisplayOffset(), quint64(7));
+    QCOMPARE(reservedSpaces.first()->getDisplayLastAddress(), quint64(6));
+
+    delete registerItem->parentItem();
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MemoryMapGraphItem::expandItem()
 //-----------------------------------------------------------------------------
@@ -0,0 +1,307 @@
+//-----------------------------------------------------------------------------
+// File: tst_StructuralDiff.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for StructuralDiff and StructuralHashTree.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <wizards/common/StructuralDiff/StructuralDiff.h>
+#include <wizards/common/StructuralDiff/StructuralHashTree.h>
+
+#include <QBuffer>
+#include <QTemporaryDir>
+
+class tst_StructuralDiff : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_StructuralDiff();
+
+private slots:
+
+    void testIdenticalDocumentsHaveNoChanges();
+    void testReorderedElementsHaveNoChanges();
+    void testModifiedValueIsModification();
+    void testAddedAttributeIsAdd();
+    void testAddedElementIsAdd();
+    void testRemovedElementIsRemove();
+    void testDocumentVLNV();
+    void testInvalidDocumentIsEmpty();
+
+    void testCompareLibraries();
+    void testChangesToJson();
+
+private:
+
+    StructuralHashTree createTree(QString const& xml) const;
+
+    QString createComponent(QString const& ports, QString const& fieldWidth = QStringLiteral("8")) const;
+
+    void writeFile(QString const& path, QString const& contents) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::tst_StructuralDiff()
+//-----------------------------------------------------------------------------
+tst_StructuralDiff::tst_StructuralDiff()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testIdenticalDocumentsHaveNoChanges()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testIdenticalDocumentsHaveNoChanges()
+{
+    StructuralHashTree reference = createTree(createComponent(QStringLiteral("<port><name>clk</name></port>")));
+    StructuralHashTree subject = createTree(createComponent(QStringLiteral("<port><name>clk</name></port>")));
+
+    QCOMPARE(reference.getRootHash(), subject.getRootHash());
+    QVERIFY(StructuralDiff::compareTrees(reference, subject).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testReorderedElementsHaveNoChanges()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testReorderedElementsHaveNoChanges()
+{
+    StructuralHashTree reference = createTree(createComponent(
+        QStringLiteral("<port><name>clk</name></port><port><name>rst</name></port>")));
+    StructuralHashTree subject = createTree(createComponent(
+        QStringLiteral("<port><name>rst</name></port><port><name>clk</name></port>")));
+
+    QVERIFY(StructuralDiff::compareTrees(reference, subject).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testModifiedValueIsModification()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testModifiedValueIsModification()
+{
+    StructuralHashTree reference = createTree(createComponent(QString(), QStringLiteral("8")));
+    StructuralHashTree subject = createTree(createComponent(QString(), QStringLiteral("16")));
+
+    QVector<StructuralDiff::Change> changes = StructuralDiff::compareTrees(reference, subject,
+        QStringLiteral("tut.fi:test:comp:1.0"));
+
+    QCOMPARE(changes.size(), 1);
+
+    StructuralDiff::Change const& change = changes.first();
+    QCOMPARE(change.type_, IPXactDiff::MODIFICATION);
+    QCOMPARE(change.document_, QStringLiteral("tut.fi:test:comp:1.0"));
+    QCOMPARE(change.path_, QStringLiteral(
+        "memoryMaps/memoryMap[cpu]/addressBlock[regs]/register[ctrl]/field[enable]/bitWidth"));
+    QCOMPARE(change.element_, QStringLiteral("bitWidth"));
+    QCOMPARE(change.previousValue_, QStringLiteral("8"));
+    QCOMPARE(change.newValue_, QStringLiteral("16"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testAddedAttributeIsAdd()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testAddedAttributeIsAdd()
+{
+    StructuralHashTree reference = createTree(createComponent(
+        QStringLiteral("<port><name>clk</name><wire><direction>in</direction></wire></port>")));
+    StructuralHashTree subject = createTree(createComponent(
+        QStringLiteral("<port><name>clk</name><wire allLogicalDirectionsAllowed=\"true\">"
+            "<direction>in</direction></wire></port>")));
+
+    QVector<StructuralDiff::Change> changes = StructuralDiff::compareTrees(reference, subject);
+
+    QCOMPARE(changes.size(), 1);
+    QCOMPARE(changes.first().type_, IPXactDiff::ADD);
+    QCOMPARE(changes.first().path_, QStringLiteral("model/ports/port[clk]/wire/@allLogicalDirectionsAllowed"));
+    QCOMPARE(changes.first().newValue_, QStringLiteral("true"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testAddedElementIsAdd()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testAddedElementIsAdd()
+{
+    StructuralHashTree reference = createTree(createComponent(QStringLiteral("<port><name>clk</name></port>")));
+    StructuralHashTree subject = createTree(createComponent(
+        QStringLiteral("<port><name>clk</name></port><port><name>rst</name></port>")));
+
+    QVector<StructuralDiff::Change> changes = StructuralDiff::compareTrees(reference, subject);
+
+    QCOMPARE(changes.size(), 1);
+    QCOMPARE(changes.first().type_, IPXactDiff::ADD);
+    QCOMPARE(changes.first().path_, QStringLiteral("model/ports/port[rst]"));
+    QCOMPARE(changes.first().element_, QStringLiteral("port"));
+    QCOMPARE(changes.first().name_, QStringLiteral("rst"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testRemovedElementIsRemove()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testRemovedElementIsRemove()
+{
+    StructuralHashTree reference = createTree(createComponent(
+        QStringLiteral("<port><name>clk</name></port><port><name>rst</name></port>")));
+    StructuralHashTree subject = createTree(createComponent(QStringLiteral("<port><name>rst</name></port>")));
+
+    QVector<StructuralDiff::Change> changes = StructuralDiff::compareTrees(reference, subject);
+
+    QCOMPARE(changes.size(), 1);
+    QCOMPARE(changes.first().type_, IPXactDiff::REMOVE);
+    QCOMPARE(changes.first().path_, QStringLiteral("model/ports/port[clk]"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testDocumentVLNV()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testDocumentVLNV()
+{
+    StructuralHashTree component = createTree(createComponent(QString()));
+    QCOMPARE(component.getVLNV(), QStringLiteral("tut.fi:test:comp:1.0"));
+
+    StructuralHashTree other = createTree(QStringLiteral("<catalog><name>noVLNV</name></catalog>"));
+    QCOMPARE(other.getVLNV(), QString());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testInvalidDocumentIsEmpty()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testInvalidDocumentIsEmpty()
+{
+    StructuralHashTree tree = createTree(QStringLiteral("<component><name>broken</component>"));
+
+    QVERIFY(tree.isEmpty());
+    QVERIFY(tree.getErrorString().isEmpty() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testCompareLibraries()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testCompareLibraries()
+{
+    QTemporaryDir referenceRoot;
+    QTemporaryDir subjectRoot;
+    QVERIFY(referenceRoot.isValid());
+    QVERIFY(subjectRoot.isValid());
+
+    QString unchanged = createComponent(QStringLiteral("<port><name>clk</name></port>"));
+    unchanged.replace(QStringLiteral(">comp<"), QStringLiteral(">same<"));
+
+    QString removed = createComponent(QString());
+    removed.replace(QStringLiteral(">comp<"), QStringLiteral(">old<"));
+
+    QString added = createComponent(QString());
+    added.replace(QStringLiteral(">comp<"), QStringLiteral(">new<"));
+
+    writeFile(referenceRoot.path() + QStringLiteral("/same/same.xml"), unchanged);
+    writeFile(referenceRoot.path() + QStringLiteral("/comp/comp.xml"), createComponent(QString()));
+    writeFile(referenceRoot.path() + QStringLiteral("/old/old.xml"), removed);
+
+    writeFile(subjectRoot.path() + QStringLiteral("/moved/same.xml"), unchanged);
+    writeFile(subjectRoot.path() + QStringLiteral("/comp/comp.xml"),
+        createComponent(QString(), QStringLiteral("4")));
+    writeFile(subjectRoot.path() + QStringLiteral("/new/new.xml"), added);
+    writeFile(subjectRoot.path() + QStringLiteral("/notes.xml"), QStringLiteral("<notes/>"));
+
+    QStringList errors;
+    QVector<StructuralDiff::Change> changes = StructuralDiff::compareLibraries(referenceRoot.path(),
+        subjectRoot.path(), errors);
+
+    QVERIFY(errors.isEmpty());
+    QCOMPARE(changes.size(), 3);
+
+    QCOMPARE(changes.at(0).type_, IPXactDiff::MODIFICATION);
+    QCOMPARE(changes.at(0).document_, QStringLiteral("tut.fi:test:comp:1.0"));
+    QCOMPARE(changes.at(0).newValue_, QStringLiteral("4"));
+
+    QCOMPARE(changes.at(1).type_, IPXactDiff::REMOVE);
+    QCOMPARE(changes.at(1).document_, QStringLiteral("tut.fi:test:old:1.0"));
+
+    QCOMPARE(changes.at(2).type_, IPXactDiff::ADD);
+    QCOMPARE(changes.at(2).document_, QStringLiteral("tut.fi:test:new:1.0"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::testChangesToJson()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::testChangesToJson()
+{
+    StructuralDiff::Change change;
+    change.type_ = IPXactDiff::MODIFICATION;
+    change.document_ = QStringLiteral("tut.fi:test:comp:1.0");
+    change.path_ = QStringLiteral("model/ports/port[clk]/wire/direction");
+    change.element_ = QStringLiteral("direction");
+    change.previousValue_ = QStringLiteral("in");
+    change.newValue_ = QStringLiteral("out");
+
+    QJsonObject root = StructuralDiff::toJson({ change }).object();
+    QJsonArray changeArray = root.value(QStringLiteral("changes")).toArray();
+
+    QCOMPARE(changeArray.size(), 1);
+
+    QJsonObject changeObject = changeArray.first().toObject();
+    QCOMPARE(changeObject.value(QStringLiteral("type")).toString(), QStringLiteral("modification"));
+    QCOMPARE(changeObject.value(QStringLiteral("path")).toString(), change.path_);
+    QCOMPARE(changeObject.value(QStringLiteral("previousValue")).toString(), QStringLiteral("in"));
+    QCOMPARE(changeObject.value(QStringLiteral("newValue")).toString(), QStringLiteral("out"));
+    QVERIFY(changeObject.contains(QStringLiteral("name")) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::createTree()
+//-----------------------------------------------------------------------------
+StructuralHashTree tst_StructuralDiff::createTree(QString const& xml) const
+{
+    QByteArray contents = xml.toUtf8();
+    QBuffer buffer(&contents);
+    buffer.open(QIODevice::ReadOnly);
+
+    StructuralHashTree tree;
+    tree.read(&buffer);
+    return tree;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::createComponent()
+//-----------------------------------------------------------------------------
+QString tst_StructuralDiff::createComponent(QString const& ports, QString const& fieldWidth) const
+{
+    return QStringLiteral(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<ipxact:component xmlns:ipxact=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2022\">\n"
+        "  <ipxact:vendor>tut.fi</ipxact:vendor>\n"
+        "  <ipxact:library>test</ipxact:library>\n"
+        "  <ipxact:name>comp</ipxact:name>\n"
+        "  <ipxact:version>1.0</ipxact:version>\n"
+        "  <ipxact:model><ipxact:ports>%1</ipxact:ports></ipxact:model>\n"
+        "  <ipxact:memoryMaps><ipxact:memoryMap><ipxact:name>cpu</ipxact:name>\n"
+        "    <ipxact:addressBlock><ipxact:name>regs</ipxact:name>\n"
+        "      <ipxact:register><ipxact:name>ctrl</ipxact:name>\n"
+        "        <ipxact:field><ipxact:name>enable</ipxact:name><ipxact:bitWidth>%2</ipxact:bitWidth></ipxact:field>\n"
+        "      </ipxact:register>\n"
+        "    </ipxact:addressBlock>\n"
+        "  </ipxact:memoryMap></ipxact:memoryMaps>\n"
+        "</ipxact:component>\n").arg(QString(ports).replace(QStringLiteral("<"), QStringLiteral("<ipxact:"))
+            .replace(QStringLiteral("<ipxact:/"), QStringLiteral("</ipxact:")), fieldWidth);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralDiff::writeFile()
+//-----------------------------------------------------------------------------
+void tst_StructuralDiff::writeFile(QString const& path, QString const& contents) const
+{
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write(contents.toUtf8());
+}
+
+QTEST_APPLESS_MAIN(tst_StructuralDiff)
+
+#include "tst_StructuralDiff.moc"
@@ -0,0 +1,11 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../wizards/common/IPXactDiff.h \
+    ../../wizards/common/StructuralDiff/StructuralDiff.h \
+    ../../wizards/common/StructuralDiff/StructuralHashTree.h
+
+SOURCES += ../../wizards/common/StructuralDiff/StructuralDiff.cpp \
+    ../../wizards/common/StructuralDiff/StructuralHashTree.cpp \
+    ./tst_StructuralDiff.cpp
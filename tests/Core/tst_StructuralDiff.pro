@@ -0,0 +1,46 @@
+#-----------------------------------------------------------------------------
+# File: tst_StructuralDiff.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for StructuralDiff.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core xml gui testlib
+CONFIG += c++17 testcase console
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    LIBS += \
+        -L../../executable -lIPXACTmodelsd -lKactusAPId
+
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_StructuralDiffd
+
+} else {
+    # release mode
+    LIBS += \
+        -L../../executable -lIPXACTmodels -lKactusAPI
+
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_StructuralDiff
+}
+
+INCLUDEPATH += ../../
+INCLUDEPATH += ../../executable
+INCLUDEPATH += ../../executable/Plugins
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += ../../
+DEPENDPATH += ../../executable
+DEPENDPATH += ../../executable/Plugins
+
+OBJECTS_DIR += $$DESTDIR
+include(tst_StructuralDiff.pri)
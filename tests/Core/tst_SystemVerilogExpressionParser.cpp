@@ -53,6 +53,11 @@ private slots:
     void testGetBaseForExpression();
     void testGetBaseForExpression_data();
 
+    void testParseExpressionAndBase();
+    void testParseExpressionAndBase_data();
+
+    void testParseExpressionAndBaseWithoutOutputs();
+
     void testIsPlainValue();
     void testIsPlainValue_data();
 
@@ -729,6 +734,76 @@ void tst_SystemVerilogExpressionParser::testGetBaseForExpression_data()
     QTest::newRow("Expression with multiple bases values has the greatest base") << "'b01 + 'o1 + 'h01 + 'd1" << 16;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testParseExpressionAndBase()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testParseExpressionAndBase()
+{
+    QFETCH(QString, expression);
+    QFETCH(QString, expectedValue);
+    QFETCH(bool, expectedValid);
+    QFETCH(int, expectedBase);
+
+    SystemVerilogExpressionParser parser;
+
+    bool isValid = !expectedValid;
+    int base = -1;
+    QString value = parser.parseExpressionAndBase(expression, &isValid, &base);
+
+    QCOMPARE(value, expectedValue);
+    QCOMPARE(isValid, expectedValid);
+    QCOMPARE(base, expectedBase);
+
+    // The result must match the separate parsing and base functions.
+    bool separateValid = false;
+    QCOMPARE(parser.parseExpression(expression, &separateValid), value);
+    QCOMPARE(separateValid, isValid);
+
+    if (isValid)
+    {
+        QCOMPARE(parser.baseForExpression(expression), base);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testParseExpressionAndBase_data()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testParseExpressionAndBase_data()
+{
+    QTest::addColumn<QString>("expression");
+    QTest::addColumn<QString>("expectedValue");
+    QTest::addColumn<bool>("expectedValid");
+    QTest::addColumn<int>("expectedBase");
+
+    QTest::newRow("Decimal constant") << "12" << "12" << true << 10;
+    QTest::newRow("Hexadecimal constant") << "'h1F" << "31" << true << 16;
+    QTest::newRow("Binary addition") << "'b1 + 'b1" << "2" << true << 2;
+    QTest::newRow("Greatest base of mixed bases") << "'b01 + 'o1 + 'h01 + 'd1" << "4" << true << 16;
+    QTest::newRow("String constant") << "\"text\"" << "\"text\"" << true << 0;
+
+    // The base is not set for invalid expressions.
+    QTest::newRow("Unknown reference") << "unknown + 1" << "x" << false << -1;
+    QTest::newRow("Missing operand") << "1 +" << "x" << false << -1;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testParseExpressionAndBaseWithoutOutputs()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testParseExpressionAndBaseWithoutOutputs()
+{
+    SystemVerilogExpressionParser parser;
+
+    int base = 0;
+    QCOMPARE(parser.parseExpressionAndBase(QStringLiteral("'h10 + 1"), nullptr, &base), QString("17"));
+    QCOMPARE(base, 16);
+
+    bool isValid = false;
+    QCOMPARE(parser.parseExpressionAndBase(QStringLiteral("'h10 + 1"), &isValid, nullptr), QString("17"));
+    QVERIFY(isValid);
+
+    QCOMPARE(parser.parseExpressionAndBase(QStringLiteral("'h10 + 1"), nullptr, nullptr), QString("17"));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_SystemVerilogExpressionParser::testIsPlainValue()
 //-----------------------------------------------------------------------------
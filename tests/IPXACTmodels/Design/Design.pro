@@ -14,4 +14,5 @@ TEMPLATE = subdirs
 CONFIG += testcase
 SUBDIRS += tst_DesignReader.pro \
 	       tst_DesignWriter.pro \
-		   tst_DesignValidator.pro
+		   tst_DesignValidator.pro \
+		   tst_DesignValidationContext.pro
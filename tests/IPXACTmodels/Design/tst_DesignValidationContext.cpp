@@ -0,0 +1,314 @@
+//-----------------------------------------------------------------------------
+// File: tst_DesignValidationContext.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class DesignValidationContext.
+//-----------------------------------------------------------------------------
+
+#include <IPXACTmodels/common/VLNV.h>
+#include <IPXACTmodels/common/ConfigurableVLNVReference.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Port.h>
+
+#include <IPXACTmodels/Design/ComponentInstance.h>
+#include <IPXACTmodels/Design/Interconnection.h>
+#include <IPXACTmodels/Design/ActiveInterface.h>
+
+#include <IPXACTmodels/Design/validator/DesignValidationContext.h>
+#include <IPXACTmodels/Design/validator/InterconnectionValidator.h>
+
+#include <KactusAPI/include/SystemVerilogExpressionParser.h>
+
+#include <tests/MockObjects/LibraryMock.h>
+
+#include <QtTest>
+
+class tst_DesignValidationContext : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_DesignValidationContext();
+
+private slots:
+
+    void testInstanceLookupUsesFirstInstanceWithName();
+    void testMissingInstancesAreNotFound();
+    void testNullInstanceListIsEmpty();
+
+    void testInstanceChangesAreNotSeenUntilRecreated();
+    void testStandaloneValidatorSeesRenamedInstanceAfterChange();
+
+    void testReferencedComponentIsCached();
+    void testMissingReferencedComponentIsNull();
+
+    void testLibraryContains();
+
+    void testBusInterfaceAndPortLookupUsesFirstWithName();
+
+private:
+
+    QSharedPointer<ComponentInstance> createInstance(QString const& instanceName, VLNV const& componentVLNV) const;
+
+    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > createInstanceList(
+        QList<QSharedPointer<ComponentInstance> > const& instances) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::tst_DesignValidationContext()
+//-----------------------------------------------------------------------------
+tst_DesignValidationContext::tst_DesignValidationContext()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::testInstanceLookupUsesFirstInstanceWithName()
+//-----------------------------------------------------------------------------
+void tst_DesignValidationContext::testInstanceLookupUsesFirstInstanceWithName()
+{
+    VLNV componentVLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0");
+
+    QSharedPointer<ComponentInstance> firstInstance = createInstance("instance", componentVLNV);
+    QSharedPointer<ComponentInstance> duplicateInstance = createInstance("instance", componentVLNV);
+    QSharedPointer<ComponentInstance> otherInstance = createInstance("other", componentVLNV);
+
+    DesignValidationContext context(nullptr,
+        createInstanceList({ firstInstance, duplicateInstance, otherInstance }));
+
+    QCOMPARE(context.getComponentInstances()->size(), 3);
+    QCOMPARE(context.getComponentInstance("instance"), firstInstance);
+    QCOMPARE(context.getComponentInstance("other"), otherInstance);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::testMissingInstancesAreNotFound()
+//-----------------------------------------------------------------------------
+void tst_DesignValidationContext::testMissingInstancesAreNotFound()
+{
+    VLNV componentVLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0");
+
+    QSharedPointer<ComponentInstance> unnamedInstance = createInstance("", componentVLNV);
+
+    DesignValidationContext context(nullptr, createInstanceList({ unnamedInstance }));
+
+    QVERIFY(context.getComponentInstance("").isNull());
+    QVERIFY(context.getComponentInstance("unknown").isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::testNullInstanceListIsEmpty()
+//-----------------------------------------------------------------------------
+void tst_DesignValidationContext::testNullInstanceListIsEmpty()
+{
+    DesignValidationContext context(nullptr, QSharedPointer<QList<QSharedPointer<ComponentInstance> > >());
+
+    QVERIFY(context.getComponentInstances().isNull() == false);
+    QVERIFY(context.getComponentInstances()->isEmpty());
+    QVERIFY(context.getComponentInstance("instance").isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::testInstanceChangesAreNotSeenUntilRecreated()
+//-----------------------------------------------------------------------------
+void tst_DesignValidationContext::testInstanceChangesAreNotSeenUntilRecreated()
+{
+    VLNV componentVLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0");
+
+    QSharedPointer<ComponentInstance> instance = createInstance("original", componentVLNV);
+    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > instances = createInstanceList({ instance });
+
+    DesignValidationContext context(nullptr, instances);
+
+    instance->setInstanceName("renamed");
+    QSharedPointer<ComponentInstance> addedInstance = createInstance("added", componentVLNV);
+    instances->append(addedInstance);
+
+    QCOMPARE(context.getComponentInstance("original"), instance);
+    QVERIFY(context.getComponentInstance("renamed").isNull());
+    QVERIFY(context.getComponentInstance("added").isNull());
+
+    DesignValidationContext recreatedContext(nullptr, instances);
+
+    QVERIFY(recreatedContext.getComponentInstance("original").isNull());
+    QCOMPARE(recreatedContext.getComponentInstance("renamed"), instance);
+    QCOMPARE(recreatedContext.getComponentInstance("added"), addedInstance);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::testStandaloneValidatorSeesRenamedInstanceAfterChange()
+//-----------------------------------------------------------------------------
+void tst_DesignValidationContext::testStandaloneValidatorSeesRenamedInstanceAfterChange()
+{
+    LibraryMock* mockLibrary (new LibraryMock(this));
+
+    VLNV componentVLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0");
+
+    QSharedPointer<Component> component(new Component(componentVLNV, Document::Revision::Std14));
+    QSharedPointer<BusInterface> bus(new BusInterface());
+    bus->setName("bus");
+    component->getBusInterfaces()->append(bus);
+    mockLibrary->addComponent(component);
+
+    QSharedPointer<ComponentInstance> instance = createInstance("original", componentVLNV);
+    QSharedPointer<QList<QSharedPointer<ComponentInstance> > > instances = createInstanceList({ instance });
+
+    QSharedPointer<ExpressionParser> parser(new SystemVerilogExpressionParser());
+    InterconnectionValidator validator(parser, mockLibrary);
+    validator.changeComponentInstances(instances);
+
+    QSharedPointer<ActiveInterface> startInterface(new ActiveInterface("renamed", "bus"));
+    QSharedPointer<Interconnection> connection(new Interconnection("connection", startInterface));
+
+    instance->setInstanceName("renamed");
+    QCOMPARE(validator.hasValidStartInterface(connection), false);
+
+    validator.changeComponentInstances(instances);
+    QCOMPARE(validator.hasValidStartInterface(connection), true);
+
+    delete mockLibrary;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::testReferencedComponentIsCached()
+//-----------------------------------------------------------------------------
+void tst_DesignValidationContext::testReferencedComponentIsCached()
+{
+    LibraryMock* mockLibrary (new LibraryMock(this));
+
+    VLNV componentVLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0");
+
+    QSharedPointer<Component> originalComponent(new Component(componentVLNV, Document::Revision::Std14));
+    mockLibrary->addComponent(originalComponent);
+
+    QSharedPointer<ComponentInstance> instance = createInstance("instance", componentVLNV);
+    QSharedPointer<ComponentInstance> otherInstance = createInstance("other", componentVLNV);
+
+    DesignValidationContext context(mockLibrary, createInstanceList({ instance, otherInstance }));
+
+    QCOMPARE(context.getReferencedComponent(instance), QSharedPointer<Component const>(originalComponent));
+
+    QSharedPointer<Component> replacingComponent(new Component(componentVLNV, Document::Revision::Std14));
+    mockLibrary->addComponent(replacingComponent);
+
+    QCOMPARE(context.getReferencedComponent(otherInstance), QSharedPointer<Component const>(originalComponent));
+
+    DesignValidationContext recreatedContext(mockLibrary, createInstanceList({ instance }));
+    QCOMPARE(recreatedContext.getReferencedComponent(instance),
+        QSharedPointer<Component const>(replacingComponent));
+
+    delete mockLibrary;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::testMissingReferencedComponentIsNull()
+//-----------------------------------------------------------------------------
+void tst_DesignValidationContext::testMissingReferencedComponentIsNull()
+{
+    LibraryMock* mockLibrary (new LibraryMock(this));
+
+    VLNV componentVLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0");
+    QSharedPointer<ComponentInstance> instance = createInstance("instance", componentVLNV);
+    QSharedPointer<ComponentInstance> unreferencingInstance(new ComponentInstance());
+    unreferencingInstance->setInstanceName("unreferencing");
+
+    DesignValidationContext context(mockLibrary, createInstanceList({ instance, unreferencingInstance }));
+
+    QVERIFY(context.getReferencedComponent(instance).isNull());
+    QVERIFY(context.getReferencedComponent(unreferencingInstance).isNull());
+    QVERIFY(context.getReferencedComponent(QSharedPointer<ComponentInstance>()).isNull());
+
+    mockLibrary->addComponent(QSharedPointer<Component>(new Component(componentVLNV, Document::Revision::Std14)));
+    QVERIFY(context.getReferencedComponent(instance).isNull());
+
+    DesignValidationContext contextWithoutLibrary(nullptr, createInstanceList({ instance }));
+    QVERIFY(contextWithoutLibrary.getReferencedComponent(instance).isNull());
+
+    delete mockLibrary;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::testLibraryContains()
+//-----------------------------------------------------------------------------
+void tst_DesignValidationContext::testLibraryContains()
+{
+    LibraryMock* mockLibrary (new LibraryMock(this));
+
+    VLNV componentVLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0");
+    VLNV missingVLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "MissingComponent", "1.0");
+
+    mockLibrary->addComponent(QSharedPointer<Component>(new Component(componentVLNV, Document::Revision::Std14)));
+
+    DesignValidationContext context(mockLibrary, createInstanceList({}));
+
+    QCOMPARE(context.libraryContains(componentVLNV), true);
+    QCOMPARE(context.libraryContains(missingVLNV), false);
+
+    DesignValidationContext contextWithoutLibrary(nullptr, createInstanceList({}));
+    QCOMPARE(contextWithoutLibrary.libraryContains(componentVLNV), false);
+
+    delete mockLibrary;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::testBusInterfaceAndPortLookupUsesFirstWithName()
+//-----------------------------------------------------------------------------
+void tst_DesignValidationContext::testBusInterfaceAndPortLookupUsesFirstWithName()
+{
+    VLNV componentVLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0");
+    QSharedPointer<Component> component(new Component(componentVLNV, Document::Revision::Std14));
+
+    QSharedPointer<BusInterface> firstBus(new BusInterface());
+    firstBus->setName("bus");
+    QSharedPointer<BusInterface> duplicateBus(new BusInterface());
+    duplicateBus->setName("bus");
+    component->getBusInterfaces()->append(firstBus);
+    component->getBusInterfaces()->append(duplicateBus);
+
+    QSharedPointer<Port> firstPort(new Port("port"));
+    QSharedPointer<Port> duplicatePort(new Port("port"));
+    component->getPorts()->append(firstPort);
+    component->getPorts()->append(duplicatePort);
+
+    DesignValidationContext context(nullptr, createInstanceList({}));
+
+    QCOMPARE(context.getBusInterface(component, "bus"), firstBus);
+    QVERIFY(context.getBusInterface(component, "").isNull());
+    QVERIFY(context.getBusInterface(component, "unknown").isNull());
+    QVERIFY(context.getBusInterface(QSharedPointer<Component const>(), "bus").isNull());
+
+    QCOMPARE(context.getPort(component, "port"), firstPort);
+    QVERIFY(context.getPort(component, "").isNull());
+    QVERIFY(context.getPort(component, "unknown").isNull());
+    QVERIFY(context.getPort(QSharedPointer<Component const>(), "port").isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::createInstance()
+//-----------------------------------------------------------------------------
+QSharedPointer<ComponentInstance> tst_DesignValidationContext::createInstance(QString const& instanceName,
+    VLNV const& componentVLNV) const
+{
+    QSharedPointer<ConfigurableVLNVReference> componentReference(new ConfigurableVLNVReference(componentVLNV));
+    return QSharedPointer<ComponentInstance>(new ComponentInstance(instanceName, componentReference));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignValidationContext::createInstanceList()
+//-----------------------------------------------------------------------------
+QSharedPointer<QList<QSharedPointer<ComponentInstance> > > tst_DesignValidationContext::createInstanceList(
+    QList<QSharedPointer<ComponentInstance> > const& instances) const
+{
+    return QSharedPointer<QList<QSharedPointer<ComponentInstance> > >(
+        new QList<QSharedPointer<ComponentInstance> >(instances));
+}
+
+QTEST_APPLESS_MAIN(tst_DesignValidationContext)
+
+#include "tst_DesignValidationContext.moc"
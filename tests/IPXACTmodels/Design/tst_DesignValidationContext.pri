@@ -0,0 +1,7 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+HEADERS += ../../MockObjects/LibraryMock.h
+SOURCES += ../../MockObjects/LibraryMock.cpp \
+    ./tst_DesignValidationContext.cpp 
\ No newline at end of file
@@ -0,0 +1,47 @@
+#-----------------------------------------------------------------------------
+# File: tst_DesignValidationContext.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for design validation context.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core gui xml testlib
+
+CONFIG += c++17 testcase console
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodelsd \
+        -L../../../executable -lKactusAPId
+
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_DesignValidationContextd
+
+} else {
+    # release mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodels \
+        -L../../../executable -lKactusAPI
+
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_DesignValidationContext
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../../
+
+DEPENDPATH += .
+DEPENDPATH += ../../../
+
+OBJECTS_DIR += $$DESTDIR
+
+include(tst_DesignValidationContext.pri)
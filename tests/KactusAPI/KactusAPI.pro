@@ -13,4 +13,8 @@ TEMPLATE = subdirs
 
 CONFIG += testcase
 SUBDIRS += \
-            tst_ModeConditionParser.pro 
+            tst_ModeConditionParser.pro \
+            tst_LibraryWatcher.pro \
+            tst_LibraryHandler.pro \
+            tst_TraceRecorder.pro \
+            tst_BatchGenerationRunner.pro
@@ -0,0 +1,449 @@
+//-----------------------------------------------------------------------------
+// File: tst_BatchGenerationRunner.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for BatchGenerationRunner.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+#include <KactusAPI/include/BatchGenerationRunner.h>
+#include <KactusAPI/include/CLIGenerator.h>
+#include <KactusAPI/include/IGeneratorPlugin.h>
+#include <KactusAPI/include/IPluginUtility.h>
+#include <KactusAPI/include/MessageMediator.h>
+
+#include <IPXACTmodels/Component/Component.h>
+
+#include <tests/MockObjects/LibraryMock.h>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Message channel collecting the messages for the test.
+    //-----------------------------------------------------------------------------
+    class MessageCollector : public MessageMediator
+    {
+    public:
+
+        void showMessage(QString const& message) const final { messages_.append(message); }
+
+        void showError(QString const& error) const final { errors_.append(error); }
+
+        void showFailure(QString const& error) const final { errors_.append(error); }
+
+        void showStatusMessage(QString const& status) const final { messages_.append(status); }
+
+        //! The shown messages.
+        mutable QStringList messages_;
+
+        //! The shown errors.
+        mutable QStringList errors_;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Command-line generator recording the generations it runs.
+    //-----------------------------------------------------------------------------
+    class GeneratorMock : public IGeneratorPlugin, public CLIGenerator
+    {
+    public:
+
+        explicit GeneratorMock(QString const& name): name_(name) {}
+
+        QString getName() const final { return name_; }
+
+        QString getVersion() const final { return QStringLiteral("1.0"); }
+
+        QString getDescription() const final { return QString(); }
+
+        QString getVendor() const final { return QString(); }
+
+        QString getLicense() const final { return QString(); }
+
+        QString getLicenseHolder() const final { return QString(); }
+
+        QWidget* getSettingsWidget() final { return nullptr; }
+
+        PluginSettingsModel* getSettingsModel() final { return nullptr; }
+
+        QList<IPlugin::ExternalProgramRequirement> getProgramRequirements() final { return {}; }
+
+        QIcon getIcon() const final { return QIcon(); }
+
+        bool checkGeneratorSupport(QSharedPointer<Component const> /*component*/,
+            QSharedPointer<Design const> /*design*/,
+            QSharedPointer<DesignConfiguration const> /*designConfiguration*/) const final
+        {
+            return true;
+        }
+
+        void runGenerator(IPluginUtility* /*utility*/, QSharedPointer<Component> /*component*/,
+            QSharedPointer<Design> /*design*/, QSharedPointer<DesignConfiguration> /*designConfiguration*/) final
+        {
+
+        }
+
+        QString getOutputFormat() const final { return QStringLiteral("test"); }
+
+        //! Jobs of the same generator are serialized by the runner, so no locking is needed.
+        void runGenerator(IPluginUtility* utility, QSharedPointer<Component> component,
+            QSharedPointer<Design> /*design*/, QSharedPointer<DesignConfiguration> /*designConfiguration*/,
+            QString const& viewName, QString const& outputDirectory) final
+        {
+            generations_.append(component->getVlnv().getName() + QLatin1Char(' ') + viewName +
+                QLatin1Char(' ') + outputDirectory);
+
+            if (viewName == QLatin1String("failing"))
+            {
+                utility->printError(QStringLiteral("Generation failed."));
+            }
+        }
+
+        //! The name of the generator.
+        QString name_;
+
+        //! The component, view and output of each run generation.
+        QStringList generations_;
+    };
+}
+
+class tst_BatchGenerationRunner : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_BatchGenerationRunner();
+
+private slots:
+
+    void initTestCase();
+    void cleanup();
+
+    void testManifestIsRead();
+    void testIncompleteJobIsReported();
+    void testInvalidManifestIsReported();
+    void testMissingManifestIsReported();
+
+    void testAllJobsAreRun();
+    void testFailedJobsAreReported();
+
+    void testReportIsWritten();
+
+private:
+
+    QString writeManifest(QJsonArray const& jobs) const;
+
+    QJsonObject createJob(QString const& componentName, QString const& view, QString const& generator) const;
+
+    void addComponent(QString const& name);
+
+    QTemporaryDir directory_;
+
+    LibraryMock library_;
+
+    MessageCollector messages_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::tst_BatchGenerationRunner()
+//-----------------------------------------------------------------------------
+tst_BatchGenerationRunner::tst_BatchGenerationRunner(): directory_(), library_(this), messages_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::initTestCase()
+{
+    QVERIFY(directory_.isValid());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::cleanup()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::cleanup()
+{
+    library_.clear();
+    messages_.messages_.clear();
+    messages_.errors_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::testManifestIsRead()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::testManifestIsRead()
+{
+    QJsonArray jobs;
+    jobs.append(createJob(QStringLiteral("first"), QStringLiteral("rtl"), QStringLiteral("Generator")));
+    jobs.append(createJob(QStringLiteral("second"), QString(), QStringLiteral("Other generator")));
+
+    BatchGenerationRunner runner(&library_, &messages_);
+    QVERIFY(runner.readManifest(writeManifest(jobs)));
+    QVERIFY(messages_.errors_.isEmpty());
+
+    QVector<BatchGenerationRunner::Job> readJobs = runner.getJobs();
+    QCOMPARE(readJobs.size(), 2);
+
+    QCOMPARE(readJobs.first().componentVLNV,
+        VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi"), QStringLiteral("test"), QStringLiteral("first"),
+        QStringLiteral("1.0")));
+    QCOMPARE(readJobs.first().viewName, QStringLiteral("rtl"));
+    QCOMPARE(readJobs.first().generatorName, QStringLiteral("Generator"));
+    QCOMPARE(readJobs.first().outputDirectory, QStringLiteral("output/first"));
+
+    QCOMPARE(readJobs.last().componentVLNV.getName(), QStringLiteral("second"));
+    QCOMPARE(readJobs.last().viewName, QString());
+    QCOMPARE(readJobs.last().generatorName, QStringLiteral("Other generator"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::testIncompleteJobIsReported()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::testIncompleteJobIsReported()
+{
+    QJsonObject withoutGenerator = createJob(QStringLiteral("second"), QStringLiteral("rtl"), QString());
+
+    QJsonObject withoutOutput = createJob(QStringLiteral("third"), QStringLiteral("rtl"),
+        QStringLiteral("Generator"));
+    withoutOutput.remove(QStringLiteral("output"));
+
+    QJsonObject withInvalidVLNV = createJob(QStringLiteral("fourth"), QStringLiteral("rtl"),
+        QStringLiteral("Generator"));
+    withInvalidVLNV.insert(QStringLiteral("vlnv"), QStringLiteral("tut.fi:test"));
+
+    QJsonArray jobs;
+    jobs.append(createJob(QStringLiteral("first"), QStringLiteral("rtl"), QStringLiteral("Generator")));
+    jobs.append(withoutGenerator);
+    jobs.append(withoutOutput);
+    jobs.append(withInvalidVLNV);
+
+    BatchGenerationRunner runner(&library_, &messages_);
+    QCOMPARE(runner.readManifest(writeManifest(jobs)), false);
+
+    QCOMPARE(runner.getJobs().size(), 4);
+    QCOMPARE(messages_.errors_.size(), 3);
+    QVERIFY(messages_.errors_.first().contains(QStringLiteral("job 1")));
+    QVERIFY(messages_.errors_.last().contains(QStringLiteral("job 3")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::testInvalidManifestIsReported()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::testInvalidManifestIsReported()
+{
+    QString manifestPath = directory_.filePath(QStringLiteral("manifest.json"));
+
+    QFile manifestFile(manifestPath);
+    QVERIFY(manifestFile.open(QIODevice::WriteOnly));
+    manifestFile.write("{ \"jobs\": [ ");
+    manifestFile.close();
+
+    BatchGenerationRunner runner(&library_, &messages_);
+    QCOMPARE(runner.readManifest(manifestPath), false);
+
+    QVERIFY(runner.getJobs().isEmpty());
+    QCOMPARE(messages_.errors_.size(), 1);
+    QVERIFY(messages_.errors_.first().startsWith(QStringLiteral("Could not parse manifest")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::testMissingManifestIsReported()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::testMissingManifestIsReported()
+{
+    BatchGenerationRunner runner(&library_, &messages_);
+    QCOMPARE(runner.readManifest(directory_.filePath(QStringLiteral("missing.json"))), false);
+
+    QCOMPARE(messages_.errors_.size(), 1);
+    QVERIFY(messages_.errors_.first().startsWith(QStringLiteral("Could not open manifest")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::testAllJobsAreRun()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::testAllJobsAreRun()
+{
+    GeneratorMock firstGenerator(QStringLiteral("Generator"));
+    GeneratorMock secondGenerator(QStringLiteral("Other generator"));
+
+    QJsonArray jobs;
+    for (int i = 0; i < 6; ++i)
+    {
+        QString componentName = QStringLiteral("component") + QString::number(i);
+        addComponent(componentName);
+
+        jobs.append(createJob(componentName, QStringLiteral("rtl"),
+            i % 2 == 0 ? firstGenerator.getName() : secondGenerator.getName()));
+    }
+
+    BatchGenerationRunner runner(&library_, &messages_);
+    QVERIFY(runner.readManifest(writeManifest(jobs)));
+
+    runner.setWorkerCount(2);
+    QCOMPARE(runner.run({ &firstGenerator, &secondGenerator }), 0);
+
+    QVERIFY(messages_.errors_.isEmpty());
+    QVERIFY(messages_.messages_.last().startsWith(
+        QStringLiteral("Batch generation finished: 6 job(s), 0 failed")));
+
+    QVector<BatchGenerationRunner::JobResult> results = runner.getResults();
+    QCOMPARE(results.size(), 6);
+    for (int i = 0; i < results.size(); ++i)
+    {
+        QCOMPARE(results.at(i).job.componentVLNV.getName(), QStringLiteral("component") + QString::number(i));
+        QCOMPARE(results.at(i).exitStatus, 0);
+        QVERIFY(results.at(i).errors.isEmpty());
+    }
+
+    QCOMPARE(firstGenerator.generations_.size(), 3);
+    QCOMPARE(secondGenerator.generations_.size(), 3);
+    QVERIFY(firstGenerator.generations_.contains(QStringLiteral("component0 rtl output/component0")));
+    QVERIFY(secondGenerator.generations_.contains(QStringLiteral("component5 rtl output/component5")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::testFailedJobsAreReported()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::testFailedJobsAreReported()
+{
+    GeneratorMock generator(QStringLiteral("Generator"));
+
+    addComponent(QStringLiteral("first"));
+    addComponent(QStringLiteral("second"));
+
+    QJsonArray jobs;
+    jobs.append(createJob(QStringLiteral("first"), QStringLiteral("rtl"), generator.getName()));
+    jobs.append(createJob(QStringLiteral("first"), QStringLiteral("rtl"), QStringLiteral("Unknown generator")));
+    jobs.append(createJob(QStringLiteral("missing"), QStringLiteral("rtl"), generator.getName()));
+    jobs.append(createJob(QStringLiteral("second"), QStringLiteral("failing"), generator.getName()));
+
+    BatchGenerationRunner runner(&library_, &messages_);
+    QVERIFY(runner.readManifest(writeManifest(jobs)));
+
+    QCOMPARE(runner.run({ &generator }), 3);
+
+    QVector<BatchGenerationRunner::JobResult> results = runner.getResults();
+    QCOMPARE(results.size(), 4);
+
+    QCOMPARE(results.at(0).exitStatus, 0);
+
+    QCOMPARE(results.at(1).exitStatus, 1);
+    QCOMPARE(results.at(1).errors,
+        QStringList(QStringLiteral("No command-line generator named 'Unknown generator' is available.")));
+
+    QCOMPARE(results.at(2).exitStatus, 1);
+    QCOMPARE(results.at(2).errors,
+        QStringList(QStringLiteral("Component tut.fi:test:missing:1.0 was not found in the library.")));
+
+    QCOMPARE(results.at(3).exitStatus, 1);
+    QCOMPARE(results.at(3).errors, QStringList(QStringLiteral("Generation failed.")));
+
+    QCOMPARE(generator.generations_.size(), 2);
+
+    // Errors of the jobs run by the workers are prefixed with the job index.
+    QCOMPARE(messages_.errors_.size(), 3);
+    QVERIFY(messages_.errors_.contains(QStringLiteral("[3] Generation failed.")));
+    QVERIFY(messages_.errors_.contains(
+        QStringLiteral("No command-line generator named 'Unknown generator' is available.")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::testReportIsWritten()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::testReportIsWritten()
+{
+    GeneratorMock generator(QStringLiteral("Generator"));
+
+    addComponent(QStringLiteral("first"));
+
+    QJsonArray jobs;
+    jobs.append(createJob(QStringLiteral("first"), QStringLiteral("rtl"), generator.getName()));
+    jobs.append(createJob(QStringLiteral("first"), QStringLiteral("failing"), generator.getName()));
+
+    BatchGenerationRunner runner(&library_, &messages_);
+    QVERIFY(runner.readManifest(writeManifest(jobs)));
+    QCOMPARE(runner.run({ &generator }), 1);
+
+    QString reportPath = directory_.filePath(QStringLiteral("report.json"));
+    QVERIFY(runner.writeReport(reportPath));
+
+    QFile reportFile(reportPath);
+    QVERIFY(reportFile.open(QIODevice::ReadOnly));
+
+    QJsonObject report = QJsonDocument::fromJson(reportFile.readAll()).object();
+    QCOMPARE(report.value(QStringLiteral("failed")).toInt(), 1);
+    QVERIFY(report.value(QStringLiteral("elapsedMs")).toDouble() >= 0);
+
+    QJsonArray reportedJobs = report.value(QStringLiteral("jobs")).toArray();
+    QCOMPARE(reportedJobs.size(), 2);
+
+    QJsonObject succeeded = reportedJobs.at(0).toObject();
+    QCOMPARE(succeeded.value(QStringLiteral("vlnv")).toString(), QStringLiteral("tut.fi:test:first:1.0"));
+    QCOMPARE(succeeded.value(QStringLiteral("view")).toString(), QStringLiteral("rtl"));
+    QCOMPARE(succeeded.value(QStringLiteral("generator")).toString(), QStringLiteral("Generator"));
+    QCOMPARE(succeeded.value(QStringLiteral("output")).toString(), QStringLiteral("output/first"));
+    QCOMPARE(succeeded.value(QStringLiteral("exitStatus")).toInt(), 0);
+    QVERIFY(succeeded.contains(QStringLiteral("elapsedMs")));
+    QVERIFY(succeeded.value(QStringLiteral("errors")).toArray().isEmpty());
+
+    QJsonObject failed = reportedJobs.at(1).toObject();
+    QCOMPARE(failed.value(QStringLiteral("view")).toString(), QStringLiteral("failing"));
+    QCOMPARE(failed.value(QStringLiteral("exitStatus")).toInt(), 1);
+    QCOMPARE(failed.value(QStringLiteral("errors")).toArray(),
+        QJsonArray::fromStringList(QStringList(QStringLiteral("Generation failed."))));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::writeManifest()
+//-----------------------------------------------------------------------------
+QString tst_BatchGenerationRunner::writeManifest(QJsonArray const& jobs) const
+{
+    QJsonObject manifest;
+    manifest.insert(QStringLiteral("jobs"), jobs);
+
+    QString manifestPath = directory_.filePath(QStringLiteral("manifest.json"));
+
+    QFile manifestFile(manifestPath);
+    manifestFile.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    manifestFile.write(QJsonDocument(manifest).toJson());
+
+    return manifestPath;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::createJob()
+//-----------------------------------------------------------------------------
+QJsonObject tst_BatchGenerationRunner::createJob(QString const& componentName, QString const& view,
+    QString const& generator) const
+{
+    QJsonObject job;
+    job.insert(QStringLiteral("vlnv"), QStringLiteral("tut.fi:test:") + componentName + QStringLiteral(":1.0"));
+    job.insert(QStringLiteral("view"), view);
+    job.insert(QStringLiteral("generator"), generator);
+    job.insert(QStringLiteral("output"), QStringLiteral("output/") + componentName);
+
+    return job;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_BatchGenerationRunner::addComponent()
+//-----------------------------------------------------------------------------
+void tst_BatchGenerationRunner::addComponent(QString const& name)
+{
+    VLNV vlnv(VLNV::COMPONENT, QStringLiteral("tut.fi"), QStringLiteral("test"), name, QStringLiteral("1.0"));
+    library_.addComponent(QSharedPointer<Component>(new Component(vlnv, Document::Revision::Std22)));
+}
+
+QTEST_GUILESS_MAIN(tst_BatchGenerationRunner)
+
+#include "tst_BatchGenerationRunner.moc"
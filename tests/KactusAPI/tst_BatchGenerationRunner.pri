@@ -0,0 +1,8 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../MockObjects/LibraryMock.h
+
+SOURCES += ../MockObjects/LibraryMock.cpp \
+    ./tst_BatchGenerationRunner.cpp
@@ -0,0 +1,47 @@
+#-----------------------------------------------------------------------------
+# File: tst_BatchGenerationRunner.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file for running unit tests for BatchGenerationRunner.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core gui widgets xml testlib
+CONFIG += c++17 testcase console
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    LIBS += \
+        -L../../executable -lIPXACTmodelsd \
+        -L../../executable -lKactusAPId
+
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_BatchGenerationRunnerd
+
+} else {
+    # release mode
+    LIBS += \
+        -L../../executable -lIPXACTmodels \
+        -L../../executable -lKactusAPI
+
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_BatchGenerationRunner
+}
+
+INCLUDEPATH += ../../
+INCLUDEPATH += ../../executable
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += ../../
+DEPENDPATH += ../../executable
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+include(tst_BatchGenerationRunner.pri)
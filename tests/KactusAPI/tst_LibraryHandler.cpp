@@ -0,0 +1,318 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryHandler.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class LibraryHandler.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QTemporaryDir>
+
+#include <KactusAPI/include/DocumentFileAccess.h>
+#include <KactusAPI/include/LibraryHandler.h>
+#include <KactusAPI/include/NullChannel.h>
+
+#include <IPXACTmodels/Component/Component.h>
+
+class tst_LibraryHandler : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryHandler();
+
+private slots:
+
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+
+    void testSaveWithCacheBudget();
+    void testFailedSaveIsKeptInCache();
+
+    void testExternalChangesAreLoaded();
+    void testExternalChangeIsLoadedAfterFailedSave();
+
+private:
+
+    /*!
+     *  Creates a component with the given name in the test library.
+     *
+     *    @param [in] name    The name of the component.
+     *
+     *    @return The created component.
+     */
+    QSharedPointer<Component> createComponent(QString const& name) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The directory of the test library.
+    QTemporaryDir libraryDirectory_;
+
+    //! Discards the messages from the library.
+    NullChannel messages_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::tst_LibraryHandler()
+//-----------------------------------------------------------------------------
+tst_LibraryHandler::tst_LibraryHandler(): libraryDirectory_(), messages_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::initTestCase()
+{
+    QVERIFY(libraryDirectory_.isValid());
+
+    // Keep the test settings separate from the user settings.
+    QCoreApplication::setOrganizationName(QStringLiteral("TUT"));
+    QCoreApplication::setApplicationName(QStringLiteral("Kactus2Tests"));
+
+    QSettings settings;
+    settings.setValue(QStringLiteral("Library/Locations"), QStringList(libraryDirectory_.path()));
+    settings.setValue(QStringLiteral("Library/ActiveLocations"), QStringList(libraryDirectory_.path()));
+
+    LibraryHandler::getInstance().setOutputChannel(&messages_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::cleanupTestCase()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::cleanupTestCase()
+{
+    QSettings settings;
+    settings.remove(QStringLiteral("Library"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::init()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::init()
+{
+    QDir library(libraryDirectory_.path());
+    for (QString const& entry : library.entryList(QDir::Dirs | QDir::NoDotAndDotDot))
+    {
+        QVERIFY(QDir(library.filePath(entry)).removeRecursively());
+    }
+
+    LibraryHandler& handler = LibraryHandler::getInstance();
+    handler.setCacheBudget(0);
+    handler.searchForIPXactFiles();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testSaveWithCacheBudget()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testSaveWithCacheBudget()
+{
+    LibraryHandler& handler = LibraryHandler::getInstance();
+
+    // Any document exceeds the budget, so every other document is a candidate for eviction on each save.
+    handler.setCacheBudget(1);
+
+    QVector<VLNV> savedItems;
+
+    handler.beginSave();
+    for (int i = 0; i < 8; ++i)
+    {
+        QSharedPointer<Component> component = createComponent(QStringLiteral("saved%1").arg(i));
+        QVERIFY(handler.writeModelToFile(libraryDirectory_.filePath(component->getVlnv().getName()), component));
+
+        savedItems.append(component->getVlnv());
+    }
+
+    // The files are not written before the save ends, so the documents must still be in the cache.
+    for (VLNV const& savedItem : savedItems)
+    {
+        QVERIFY(QFileInfo::exists(handler.getPath(savedItem)) == false);
+
+        QSharedPointer<Document const> document = handler.getModelReadOnly(savedItem);
+        QVERIFY(document.isNull() == false);
+        QCOMPARE(document->getVlnv(), savedItem);
+    }
+
+    QVERIFY(handler.endSave());
+
+    // The written documents can be evicted and read again from the files.
+    QVERIFY(handler.getCacheStatistics().evictions > 0);
+
+    for (VLNV const& savedItem : savedItems)
+    {
+        QVERIFY(QFileInfo::exists(handler.getPath(savedItem)));
+        QVERIFY(handler.getModel(savedItem).isNull() == false);
+    }
+
+    handler.setCacheBudget(0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testFailedSaveIsKeptInCache()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testFailedSaveIsKeptInCache()
+{
+    LibraryHandler& handler = LibraryHandler::getInstance();
+
+    QString directory = libraryDirectory_.filePath(QStringLiteral("unwritten"));
+
+    QSharedPointer<Component> component = createComponent(QStringLiteral("unwritten"));
+    QVERIFY(handler.writeModelToFile(directory, component));
+
+    QString path = handler.getPath(component->getVlnv());
+
+    QFile::Permissions readOnly = QFile::ReadOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther;
+    QFile::Permissions directoryPermissions = QFile::permissions(directory);
+    QVERIFY(QFile::setPermissions(path, readOnly));
+    QVERIFY(QFile::setPermissions(directory, readOnly | QFile::ExeOwner | QFile::ExeUser));
+
+    QFile probe(path);
+    bool writable = probe.open(QIODevice::Append);
+    probe.close();
+
+    bool saved = true;
+    if (writable == false)
+    {
+        // Any document exceeds the budget, so the unwritten document is a candidate for eviction on each save.
+        handler.setCacheBudget(1);
+
+        QSharedPointer<Component> savedComponent(new Component(*component));
+        savedComponent->setDescription(QStringLiteral("Unwritten change."));
+
+        handler.beginSave();
+        handler.writeModelToFile(savedComponent);
+        saved = handler.endSave();
+
+        for (int i = 0; i < 4; ++i)
+        {
+            QSharedPointer<Component> otherComponent = createComponent(QStringLiteral("written%1").arg(i));
+            handler.writeModelToFile(libraryDirectory_.filePath(otherComponent->getVlnv().getName()),
+                otherComponent);
+        }
+    }
+
+    QFile::setPermissions(directory, directoryPermissions);
+    QFile::setPermissions(path, readOnly | QFile::WriteOwner | QFile::WriteUser);
+
+    if (writable)
+    {
+        QSKIP("File permissions are not enforced for the current user.");
+    }
+
+    QCOMPARE(saved, false);
+
+    // The unwritten document is not read again from the outdated file.
+    QCOMPARE(handler.getModel(component->getVlnv())->getDescription(), QStringLiteral("Unwritten change."));
+
+    // A later save writes the change to the file.
+    QSharedPointer<Component> writtenComponent(new Component(*component));
+    writtenComponent->setDescription(QStringLiteral("Written change."));
+    QVERIFY(handler.writeModelToFile(writtenComponent));
+
+    handler.setCacheBudget(0);
+    QCOMPARE(DocumentFileAccess::readDocument(path)->getDescription(), QStringLiteral("Written change."));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testExternalChangesAreLoaded()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testExternalChangesAreLoaded()
+{
+    LibraryHandler& handler = LibraryHandler::getInstance();
+
+    QString directory = libraryDirectory_.filePath(QStringLiteral("external"));
+
+    QSharedPointer<Component> modifiedComponent = createComponent(QStringLiteral("modified"));
+    QSharedPointer<Component> removedComponent = createComponent(QStringLiteral("removed"));
+    QVERIFY(handler.writeModelToFile(directory, modifiedComponent));
+    QVERIFY(handler.writeModelToFile(directory, removedComponent));
+
+    QSharedPointer<Component> externalCopy(new Component(*modifiedComponent));
+    externalCopy->setDescription(QStringLiteral("External change."));
+    QVERIFY(DocumentFileAccess::writeDocument(externalCopy, handler.getPath(modifiedComponent->getVlnv())));
+
+    QVERIFY(QFile::remove(handler.getPath(removedComponent->getVlnv())));
+
+    QSharedPointer<Component> addedComponent = createComponent(QStringLiteral("added"));
+    QVERIFY(DocumentFileAccess::writeDocument(addedComponent, directory + QStringLiteral("/added.1.0.xml")));
+
+    QTRY_VERIFY(handler.contains(addedComponent->getVlnv()));
+    QTRY_VERIFY(handler.contains(removedComponent->getVlnv()) == false);
+    QTRY_COMPARE(handler.getModel(modifiedComponent->getVlnv())->getDescription(),
+        QStringLiteral("External change."));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::testExternalChangeIsLoadedAfterFailedSave()
+//-----------------------------------------------------------------------------
+void tst_LibraryHandler::testExternalChangeIsLoadedAfterFailedSave()
+{
+    LibraryHandler& handler = LibraryHandler::getInstance();
+
+    QString directory = libraryDirectory_.filePath(QStringLiteral("readOnly"));
+
+    QSharedPointer<Component> component = createComponent(QStringLiteral("readOnly"));
+    QVERIFY(handler.writeModelToFile(directory, component));
+
+    QString path = handler.getPath(component->getVlnv());
+
+    // The file is changed outside the library, and then made read-only before the library saves it.
+    QSharedPointer<Component> externalCopy(new Component(*component));
+    externalCopy->setDescription(QStringLiteral("External change."));
+    QVERIFY(DocumentFileAccess::writeDocument(externalCopy, path));
+
+    QFile::Permissions readOnly = QFile::ReadOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther;
+    QFile::Permissions directoryPermissions = QFile::permissions(directory);
+    QVERIFY(QFile::setPermissions(path, readOnly));
+    QVERIFY(QFile::setPermissions(directory, readOnly | QFile::ExeOwner | QFile::ExeUser));
+
+    QFile probe(path);
+    bool writable = probe.open(QIODevice::Append);
+    probe.close();
+
+    bool saved = true;
+    if (writable == false)
+    {
+        QSharedPointer<Component> savedComponent(new Component(*component));
+        savedComponent->setDescription(QStringLiteral("Failed save."));
+
+        handler.beginSave();
+        handler.writeModelToFile(savedComponent);
+        saved = handler.endSave();
+    }
+
+    QFile::setPermissions(directory, directoryPermissions);
+    QFile::setPermissions(path, readOnly | QFile::WriteOwner | QFile::WriteUser);
+
+    if (writable)
+    {
+        QSKIP("File permissions are not enforced for the current user.");
+    }
+
+    QCOMPARE(saved, false);
+
+    // The failed write is not acknowledged, so the external change is still reported and loaded.
+    QTRY_COMPARE(handler.getModel(component->getVlnv())->getDescription(), QStringLiteral("External change."));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryHandler::createComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_LibraryHandler::createComponent(QString const& name) const
+{
+    return QSharedPointer<Component>(new Component(
+        VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi"), QStringLiteral("test"), name, QStringLiteral("1.0")),
+        Document::Revision::Std22));
+}
+
+QTEST_GUILESS_MAIN(tst_LibraryHandler)
+
+#include "tst_LibraryHandler.moc"
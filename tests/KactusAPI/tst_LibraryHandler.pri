@@ -0,0 +1,8 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../KactusAPI/include/NullChannel.h
+
+SOURCES += ../../KactusAPI/utilities/NullChannel.cpp \
+    ./tst_LibraryHandler.cpp
@@ -0,0 +1,236 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryWatcher.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class LibraryWatcher.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+
+#include <KactusAPI/include/LibraryWatcher.h>
+
+class tst_LibraryWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryWatcher();
+
+private slots:
+
+    void testAddedFileIsReported();
+    void testModifiedFileIsReported();
+    void testRemovedFileIsReported();
+    void testFileInNewDirectoryIsReported();
+    void testAcknowledgedFileIsNotReported();
+    void testOtherFilesAreNotReported();
+    void testReplacedFileBeyondWatchLimitIsReported();
+
+private:
+
+    void writeFile(QString const& path, QByteArray const& contents);
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::tst_LibraryWatcher()
+//-----------------------------------------------------------------------------
+tst_LibraryWatcher::tst_LibraryWatcher()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testAddedFileIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testAddedFileIsReported()
+{
+    QTemporaryDir library;
+    QVERIFY(library.isValid());
+
+    LibraryWatcher watcher;
+    watcher.watch(QStringList(library.path()));
+
+    QSignalSpy spy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    QString filePath = QFileInfo(library.path() + QStringLiteral("/added.xml")).absoluteFilePath();
+    writeFile(filePath, "<added/>");
+
+    QVERIFY(spy.wait(5000));
+
+    QList<QVariant> arguments = spy.takeFirst();
+    QCOMPARE(arguments.at(0).toStringList(), QStringList(filePath));
+    QVERIFY(arguments.at(1).toStringList().isEmpty());
+    QVERIFY(arguments.at(2).toStringList().isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testModifiedFileIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testModifiedFileIsReported()
+{
+    QTemporaryDir library;
+    QVERIFY(library.isValid());
+
+    QString filePath = QFileInfo(library.path() + QStringLiteral("/modified.xml")).absoluteFilePath();
+    writeFile(filePath, "<modified/>");
+
+    LibraryWatcher watcher;
+    watcher.watch(QStringList(library.path()));
+
+    QSignalSpy spy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    writeFile(filePath, "<modified><changed/></modified>");
+
+    QVERIFY(spy.wait(5000));
+
+    QList<QVariant> arguments = spy.takeFirst();
+    QVERIFY(arguments.at(0).toStringList().isEmpty());
+    QVERIFY(arguments.at(1).toStringList().isEmpty());
+    QCOMPARE(arguments.at(2).toStringList(), QStringList(filePath));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testRemovedFileIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testRemovedFileIsReported()
+{
+    QTemporaryDir library;
+    QVERIFY(library.isValid());
+
+    QString filePath = QFileInfo(library.path() + QStringLiteral("/removed.xml")).absoluteFilePath();
+    writeFile(filePath, "<removed/>");
+
+    LibraryWatcher watcher;
+    watcher.watch(QStringList(library.path()));
+
+    QSignalSpy spy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    QVERIFY(QFile::remove(filePath));
+
+    QVERIFY(spy.wait(5000));
+
+    QList<QVariant> arguments = spy.takeFirst();
+    QVERIFY(arguments.at(0).toStringList().isEmpty());
+    QCOMPARE(arguments.at(1).toStringList(), QStringList(filePath));
+    QVERIFY(arguments.at(2).toStringList().isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testFileInNewDirectoryIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testFileInNewDirectoryIsReported()
+{
+    QTemporaryDir library;
+    QVERIFY(library.isValid());
+
+    LibraryWatcher watcher;
+    watcher.watch(QStringList(library.path()));
+
+    QSignalSpy spy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    QVERIFY(QDir(library.path()).mkpath(QStringLiteral("vendor/library/name/1.0")));
+
+    QString filePath = QFileInfo(library.path() +
+        QStringLiteral("/vendor/library/name/1.0/name.1.0.xml")).absoluteFilePath();
+    writeFile(filePath, "<new/>");
+
+    QVERIFY(spy.wait(5000));
+
+    QList<QVariant> arguments = spy.takeFirst();
+    QCOMPARE(arguments.at(0).toStringList(), QStringList(filePath));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testAcknowledgedFileIsNotReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testAcknowledgedFileIsNotReported()
+{
+    QTemporaryDir library;
+    QVERIFY(library.isValid());
+
+    QString modifiedPath = QFileInfo(library.path() + QStringLiteral("/modified.xml")).absoluteFilePath();
+    writeFile(modifiedPath, "<modified/>");
+
+    LibraryWatcher watcher;
+    watcher.watch(QStringList(library.path()));
+
+    QSignalSpy spy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    QString addedPath = QFileInfo(library.path() + QStringLiteral("/added.xml")).absoluteFilePath();
+    writeFile(addedPath, "<added/>");
+    watcher.acknowledgeFile(addedPath);
+
+    writeFile(modifiedPath, "<modified><changed/></modified>");
+    watcher.acknowledgeFile(modifiedPath);
+
+    QVERIFY(spy.wait(2000) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testOtherFilesAreNotReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testOtherFilesAreNotReported()
+{
+    QTemporaryDir library;
+    QVERIFY(library.isValid());
+
+    LibraryWatcher watcher;
+    watcher.watch(QStringList(library.path()));
+
+    QSignalSpy spy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    writeFile(library.path() + QStringLiteral("/readme.txt"), "Not an IP-XACT file.");
+
+    QVERIFY(spy.wait(2000) == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::testReplacedFileBeyondWatchLimitIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::testReplacedFileBeyondWatchLimitIsReported()
+{
+    QTemporaryDir library;
+    QVERIFY(library.isValid());
+
+    QString filePath = QFileInfo(library.path() + QStringLiteral("/replaced.xml")).absoluteFilePath();
+    writeFile(filePath, "<replaced/>");
+
+    // Only the directories are watched.
+    LibraryWatcher watcher;
+    watcher.setWatchedFileLimit(0);
+    watcher.watch(QStringList(library.path()));
+
+    QSignalSpy spy(&watcher, SIGNAL(filesChanged(QStringList const&, QStringList const&, QStringList const&)));
+
+    QString temporaryPath = library.path() + QStringLiteral("/replaced.tmp");
+    writeFile(temporaryPath, "<replaced><changed/></replaced>");
+    QVERIFY(QFile::remove(filePath));
+    QVERIFY(QFile::rename(temporaryPath, filePath));
+
+    QVERIFY(spy.wait(5000));
+
+    QList<QVariant> arguments = spy.takeFirst();
+    QVERIFY(arguments.at(0).toStringList().isEmpty());
+    QVERIFY(arguments.at(1).toStringList().isEmpty());
+    QCOMPARE(arguments.at(2).toStringList(), QStringList(filePath));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryWatcher::writeFile()
+//-----------------------------------------------------------------------------
+void tst_LibraryWatcher::writeFile(QString const& path, QByteArray const& contents)
+{
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write(contents);
+}
+
+QTEST_GUILESS_MAIN(tst_LibraryWatcher)
+
+#include "tst_LibraryWatcher.moc"
@@ -0,0 +1,8 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../KactusAPI/include/LibraryWatcher.h
+
+SOURCES += ../../KactusAPI/library/LibraryWatcher.cpp \
+    ./tst_LibraryWatcher.cpp
@@ -0,0 +1,242 @@
+//-----------------------------------------------------------------------------
+// File: tst_TraceRecorder.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for TraceRecorder.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <QThread>
+
+#include <KactusAPI/include/TraceRecorder.h>
+
+class tst_TraceRecorder : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_TraceRecorder();
+
+private slots:
+
+    void cleanup();
+
+    void testNothingIsRecordedWhenDisabled();
+    void testSpanIsRecorded();
+    void testCounterIsRecorded();
+    void testStartDiscardsPreviousEvents();
+    void testThreadsAreSeparated();
+    void testFinishedThreadsKeepTheirEvents();
+    void testTraceIsWrittenToFile();
+
+private:
+
+    QJsonArray findEvents(QString const& phase) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::tst_TraceRecorder()
+//-----------------------------------------------------------------------------
+tst_TraceRecorder::tst_TraceRecorder()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::cleanup()
+//-----------------------------------------------------------------------------
+void tst_TraceRecorder::cleanup()
+{
+    TraceRecorder::stop();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::testNothingIsRecordedWhenDisabled()
+//-----------------------------------------------------------------------------
+void tst_TraceRecorder::testNothingIsRecordedWhenDisabled()
+{
+    TraceRecorder::start();
+    TraceRecorder::stop();
+
+    QVERIFY(TraceRecorder::isEnabled() == false);
+
+    {
+        TRACE_SCOPE("test", "disabled");
+        TRACE_COUNTER("test", "disabled", 1);
+    }
+
+    QCOMPARE(TraceRecorder::eventCount(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::testSpanIsRecorded()
+//-----------------------------------------------------------------------------
+void tst_TraceRecorder::testSpanIsRecorded()
+{
+    TraceRecorder::start();
+
+    {
+        TRACE_SCOPE_DETAIL("test", "span", QStringLiteral("detail"));
+        QThread::msleep(2);
+    }
+
+    QJsonArray spans = findEvents(QStringLiteral("X"));
+    QCOMPARE(spans.size(), 1);
+
+    QJsonObject span = spans.first().toObject();
+    QCOMPARE(span.value(QStringLiteral("name")).toString(), QStringLiteral("span"));
+    QCOMPARE(span.value(QStringLiteral("cat")).toString(), QStringLiteral("test"));
+    QVERIFY(span.value(QStringLiteral("dur")).toDouble() >= 2000);
+    QCOMPARE(span.value(QStringLiteral("args")).toObject().value(QStringLiteral("detail")).toString(),
+        QStringLiteral("detail"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::testCounterIsRecorded()
+//-----------------------------------------------------------------------------
+void tst_TraceRecorder::testCounterIsRecorded()
+{
+    TraceRecorder::start();
+
+    TRACE_COUNTER("test", "documents", 42);
+
+    QJsonArray counters = findEvents(QStringLiteral("C"));
+    QCOMPARE(counters.size(), 1);
+
+    QJsonObject counter = counters.first().toObject();
+    QCOMPARE(counter.value(QStringLiteral("name")).toString(), QStringLiteral("documents"));
+    QCOMPARE(counter.value(QStringLiteral("args")).toObject().value(QStringLiteral("documents")).toInt(), 42);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::testStartDiscardsPreviousEvents()
+//-----------------------------------------------------------------------------
+void tst_TraceRecorder::testStartDiscardsPreviousEvents()
+{
+    TraceRecorder::start();
+    TRACE_COUNTER("test", "first", 1);
+    TraceRecorder::stop();
+
+    QCOMPARE(TraceRecorder::eventCount(), 1);
+
+    TraceRecorder::start();
+    QCOMPARE(TraceRecorder::eventCount(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::testThreadsAreSeparated()
+//-----------------------------------------------------------------------------
+void tst_TraceRecorder::testThreadsAreSeparated()
+{
+    TraceRecorder::start();
+
+    {
+        TRACE_SCOPE("test", "main");
+    }
+
+    QThread* worker = QThread::create([]()
+        {
+            TRACE_SCOPE("test", "worker");
+        });
+    worker->setObjectName(QStringLiteral("Worker"));
+    worker->start();
+    QVERIFY(worker->wait(5000));
+    delete worker;
+
+    QJsonArray spans = findEvents(QStringLiteral("X"));
+    QCOMPARE(spans.size(), 2);
+    QVERIFY(spans.at(0).toObject().value(QStringLiteral("tid")).toInt() !=
+        spans.at(1).toObject().value(QStringLiteral("tid")).toInt());
+
+    QStringList threadNames;
+    for (QJsonValue const& metadata : findEvents(QStringLiteral("M")))
+    {
+        threadNames.append(metadata.toObject().value(QStringLiteral("args")).toObject().value(
+            QStringLiteral("name")).toString());
+    }
+
+    QVERIFY(threadNames.contains(QStringLiteral("Worker")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::testFinishedThreadsKeepTheirEvents()
+//-----------------------------------------------------------------------------
+void tst_TraceRecorder::testFinishedThreadsKeepTheirEvents()
+{
+    TraceRecorder::start();
+
+    for (int i = 0; i < 2; ++i)
+    {
+        QThread* worker = QThread::create([]()
+            {
+                TRACE_SCOPE("test", "finished");
+            });
+        worker->start();
+        QVERIFY(worker->wait(5000));
+        delete worker;
+    }
+
+    QJsonArray spans = findEvents(QStringLiteral("X"));
+    QCOMPARE(spans.size(), 2);
+    QVERIFY(spans.at(0).toObject().value(QStringLiteral("tid")).toInt() !=
+        spans.at(1).toObject().value(QStringLiteral("tid")).toInt());
+
+    TraceRecorder::start();
+    QCOMPARE(TraceRecorder::eventCount(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::testTraceIsWrittenToFile()
+//-----------------------------------------------------------------------------
+void tst_TraceRecorder::testTraceIsWrittenToFile()
+{
+    QTemporaryDir outputDirectory;
+    QVERIFY(outputDirectory.isValid());
+
+    TraceRecorder::start();
+    {
+        TRACE_SCOPE("test", "written");
+    }
+    TraceRecorder::stop();
+
+    QString tracePath = outputDirectory.filePath(QStringLiteral("trace.json"));
+    QVERIFY(TraceRecorder::writeChromeTrace(tracePath));
+
+    QFile traceFile(tracePath);
+    QVERIFY(traceFile.open(QIODevice::ReadOnly));
+
+    QJsonObject trace = QJsonDocument::fromJson(traceFile.readAll()).object();
+    QVERIFY(trace.value(QStringLiteral("traceEvents")).toArray().isEmpty() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_TraceRecorder::findEvents()
+//-----------------------------------------------------------------------------
+QJsonArray tst_TraceRecorder::findEvents(QString const& phase) const
+{
+    QJsonArray events = QJsonDocument::fromJson(TraceRecorder::toChromeTrace()).object().value(
+        QStringLiteral("traceEvents")).toArray();
+
+    QJsonArray matchingEvents;
+    for (QJsonValue const& event : events)
+    {
+        if (event.toObject().value(QStringLiteral("ph")).toString() == phase)
+        {
+            matchingEvents.append(event);
+        }
+    }
+
+    return matchingEvents;
+}
+
+QTEST_GUILESS_MAIN(tst_TraceRecorder)
+
+#include "tst_TraceRecorder.moc"
@@ -300,7 +300,8 @@ void LibraryMock::beginSave()
 //-----------------------------------------------------------------------------
 // Function: LibraryMock::endSave()
 //-----------------------------------------------------------------------------
-void LibraryMock::endSave()
+bool LibraryMock::endSave()
 {
    Q_ASSERT(false);
+   return false;
 }
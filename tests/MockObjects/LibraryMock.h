@@ -322,7 +322,7 @@ public slots:
     *
     *    @return Description.
     */
-    virtual void endSave();
+    virtual bool endSave();
 
 private:
 
@@ -0,0 +1,282 @@
+//-----------------------------------------------------------------------------
+// File: tst_GlobalAddressMap.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class GlobalAddressMap.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/MemoryDesigner/ConnectivityInterface.h>
+#include <editors/MemoryDesigner/MemoryDesignerConstants.h>
+#include <editors/MemoryDesigner/MemoryItem.h>
+
+#include <Plugins/common/CpuRoutesContainer.h>
+#include <Plugins/common/GlobalAddressMap.h>
+
+class tst_GlobalAddressMap : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_GlobalAddressMap();
+
+private slots:
+
+    void testTargetAddresses();
+    void testFindTarget();
+    void testFindOverlapping();
+    void testFindConflicts();
+    void testMapIsStoredInRoute();
+
+    void testBenchmarkBuildMap();
+    void testBenchmarkLookup();
+
+private:
+
+    QSharedPointer<CpuRouteStructs::CpuRoute> createInitiator() const;
+
+    void addTarget(QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute, QString const& name,
+        quint64 address, quint64 range) const;
+
+    QSharedPointer<CpuRouteStructs::CpuRoute> createLargeSystem(int targetCount) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::tst_GlobalAddressMap()
+//-----------------------------------------------------------------------------
+tst_GlobalAddressMap::tst_GlobalAddressMap()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::testTargetAddresses()
+//-----------------------------------------------------------------------------
+void tst_GlobalAddressMap::testTargetAddresses()
+{
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute = createInitiator();
+    addTarget(cpuRoute, "uart", 0x1000, 0x100);
+    addTarget(cpuRoute, "timer", 0x2000, 0x10);
+
+    GlobalAddressMap addressMap(cpuRoute);
+
+    QVERIFY(addressMap.getInitiator() == cpuRoute->cpuInterface_);
+    QCOMPARE(addressMap.getTargets().size(), 2);
+
+    GlobalAddressMap::Target const& uart = addressMap.getTargets().first();
+    QCOMPARE(uart.targetInterface_->getName(), QString("uart"));
+    QCOMPARE(uart.routePosition_, 1);
+    QCOMPARE(uart.baseAddress_, quint64(0x1000));
+    QCOMPARE(uart.lastAddress_, quint64(0x10FF));
+    QVERIFY(uart.isAddressable_);
+
+    GlobalAddressMap::Target const& timer = addressMap.getTargets().last();
+    QCOMPARE(timer.baseAddress_, quint64(0x2000));
+    QCOMPARE(timer.lastAddress_, quint64(0x200F));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::testFindTarget()
+//-----------------------------------------------------------------------------
+void tst_GlobalAddressMap::testFindTarget()
+{
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute = createInitiator();
+    addTarget(cpuRoute, "timer", 0x2000, 0x10);
+    addTarget(cpuRoute, "uart", 0x1000, 0x100);
+    addTarget(cpuRoute, "gpio", 0x3000, 0x1000);
+
+    GlobalAddressMap addressMap(cpuRoute);
+
+    QVERIFY(addressMap.findTarget(0x0FFF) == nullptr);
+    QCOMPARE(addressMap.findTarget(0x1000)->targetInterface_->getName(), QString("uart"));
+    QCOMPARE(addressMap.findTarget(0x10FF)->targetInterface_->getName(), QString("uart"));
+    QVERIFY(addressMap.findTarget(0x1100) == nullptr);
+    QCOMPARE(addressMap.findTarget(0x2008)->targetInterface_->getName(), QString("timer"));
+    QCOMPARE(addressMap.findTarget(0x3FFF)->targetInterface_->getName(), QString("gpio"));
+    QVERIFY(addressMap.findTarget(0x4000) == nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::testFindOverlapping()
+//-----------------------------------------------------------------------------
+void tst_GlobalAddressMap::testFindOverlapping()
+{
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute = createInitiator();
+    addTarget(cpuRoute, "gpio", 0x3000, 0x1000);
+    addTarget(cpuRoute, "uart", 0x1000, 0x100);
+    addTarget(cpuRoute, "timer", 0x2000, 0x10);
+
+    GlobalAddressMap addressMap(cpuRoute);
+
+    QVector<GlobalAddressMap::Target const*> overlapping = addressMap.findOverlapping(0x1080, 0x3000);
+    QCOMPARE(overlapping.size(), 3);
+    QCOMPARE(overlapping.at(0)->targetInterface_->getName(), QString("uart"));
+    QCOMPARE(overlapping.at(1)->targetInterface_->getName(), QString("timer"));
+    QCOMPARE(overlapping.at(2)->targetInterface_->getName(), QString("gpio"));
+
+    QVERIFY(addressMap.findOverlapping(0x1100, 0x1FFF).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::testFindConflicts()
+//-----------------------------------------------------------------------------
+void tst_GlobalAddressMap::testFindConflicts()
+{
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute = createInitiator();
+    addTarget(cpuRoute, "uart", 0x1000, 0x100);
+    addTarget(cpuRoute, "timer", 0x1080, 0x100);
+    addTarget(cpuRoute, "gpio", 0x3000, 0x1000);
+    addTarget(cpuRoute, "spi", 0x3000, 0x10);
+
+    GlobalAddressMap addressMap(cpuRoute);
+
+    QVector<QPair<GlobalAddressMap::Target const*, GlobalAddressMap::Target const*> > conflicts =
+        addressMap.findConflicts();
+
+    QCOMPARE(conflicts.size(), 2);
+    QCOMPARE(conflicts.first().first->targetInterface_->getName(), QString("uart"));
+    QCOMPARE(conflicts.first().second->targetInterface_->getName(), QString("timer"));
+
+    QStringList lastPair({ conflicts.last().first->targetInterface_->getName(),
+        conflicts.last().second->targetInterface_->getName() });
+    lastPair.sort();
+    QCOMPARE(lastPair, QStringList({ "gpio", "spi" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::testMapIsStoredInRoute()
+//-----------------------------------------------------------------------------
+void tst_GlobalAddressMap::testMapIsStoredInRoute()
+{
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute = createInitiator();
+    addTarget(cpuRoute, "uart", 0x1000, 0x100);
+
+    QSharedPointer<GlobalAddressMap const> addressMap = GlobalAddressMap::getAddressMap(cpuRoute);
+    QVERIFY(GlobalAddressMap::getAddressMap(cpuRoute) == addressMap);
+
+    addTarget(cpuRoute, "timer", 0x2000, 0x10);
+
+    QSharedPointer<GlobalAddressMap const> updatedMap = GlobalAddressMap::getAddressMap(cpuRoute);
+    QVERIFY(updatedMap != addressMap);
+    QCOMPARE(updatedMap->getTargets().size(), 2);
+
+    // Replacing the routes with the same number of routes calculates the map again.
+    QSharedPointer<CpuRouteStructs::CpuRoute> otherRoute(new CpuRouteStructs::CpuRoute());
+    otherRoute->cpuInterface_ = cpuRoute->cpuInterface_;
+    addTarget(otherRoute, "gpio", 0x3000, 0x10);
+    addTarget(otherRoute, "spi", 0x4000, 0x10);
+    cpuRoute->setRoutes(otherRoute->routes_);
+
+    QSharedPointer<GlobalAddressMap const> replacedMap = GlobalAddressMap::getAddressMap(cpuRoute);
+    QVERIFY(replacedMap != updatedMap);
+    QCOMPARE(replacedMap->getTargets().size(), 2);
+    QCOMPARE(replacedMap->getTargets().first().baseAddress_, quint64(0x3000));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::testBenchmarkBuildMap()
+//-----------------------------------------------------------------------------
+void tst_GlobalAddressMap::testBenchmarkBuildMap()
+{
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute = createLargeSystem(1000);
+
+    int targetCount = 0;
+    QBENCHMARK
+    {
+        GlobalAddressMap addressMap(cpuRoute);
+        targetCount = addressMap.getTargets().size();
+    }
+
+    QCOMPARE(targetCount, 1000);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::testBenchmarkLookup()
+//-----------------------------------------------------------------------------
+void tst_GlobalAddressMap::testBenchmarkLookup()
+{
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute = createLargeSystem(1000);
+    GlobalAddressMap addressMap(cpuRoute);
+
+    int foundTargets = 0;
+    QBENCHMARK
+    {
+        foundTargets = 0;
+        for (quint64 address = 0; address < 1000 * 0x1000; address += 0x800)
+        {
+            if (addressMap.findTarget(address) != nullptr)
+            {
+                ++foundTargets;
+            }
+        }
+    }
+
+    QCOMPARE(foundTargets, 1000);
+    QVERIFY(addressMap.findConflicts().isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::createInitiator()
+//-----------------------------------------------------------------------------
+QSharedPointer<CpuRouteStructs::CpuRoute> tst_GlobalAddressMap::createInitiator() const
+{
+    QSharedPointer<MemoryItem> spaceItem(new MemoryItem("cpuSpace", MemoryDesignerConstants::ADDRESSSPACE_TYPE));
+    spaceItem->setRange("4294967296");
+
+    QSharedPointer<ConnectivityInterface> initiator(new ConnectivityInterface("cpuInterface"));
+    initiator->setMode(General::INITIATOR);
+    initiator->setBaseAddress("0");
+    initiator->setConnectedMemory(spaceItem);
+
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute(new CpuRouteStructs::CpuRoute());
+    cpuRoute->cpuInterface_ = initiator;
+
+    return cpuRoute;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::addTarget()
+//-----------------------------------------------------------------------------
+void tst_GlobalAddressMap::addTarget(QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute, QString const& name,
+    quint64 address, quint64 range) const
+{
+    QSharedPointer<MemoryItem> blockItem(new MemoryItem(name + "_block", MemoryDesignerConstants::ADDRESSBLOCK_TYPE));
+    blockItem->setAddress(QString::number(address));
+    blockItem->setRange(QString::number(range));
+
+    QSharedPointer<MemoryItem> mapItem(new MemoryItem(name + "_map", MemoryDesignerConstants::MEMORYMAP_TYPE));
+    mapItem->addChild(blockItem);
+
+    QSharedPointer<ConnectivityInterface> target(new ConnectivityInterface(name));
+    target->setMode(General::TARGET);
+    target->setConnectedMemory(mapItem);
+
+    QVector<QSharedPointer<ConnectivityInterface const> > route;
+    route.append(cpuRoute->cpuInterface_);
+    route.append(target);
+
+    cpuRoute->addRoute(route);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_GlobalAddressMap::createLargeSystem()
+//-----------------------------------------------------------------------------
+QSharedPointer<CpuRouteStructs::CpuRoute> tst_GlobalAddressMap::createLargeSystem(int targetCount) const
+{
+    QSharedPointer<CpuRouteStructs::CpuRoute> cpuRoute = createInitiator();
+    for (int i = 0; i < targetCount; ++i)
+    {
+        addTarget(cpuRoute, "target" + QString::number(i), quint64(i) * 0x1000, 0x800);
+    }
+
+    return cpuRoute;
+}
+
+QTEST_APPLESS_MAIN(tst_GlobalAddressMap)
+
+#include "tst_GlobalAddressMap.moc"
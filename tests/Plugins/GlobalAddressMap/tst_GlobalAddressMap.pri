@@ -0,0 +1,24 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+# This is a reminder that you are using a generated .pro file.
+# Remove it when you are finished editing this file.
+message("You are running qmake on a generated .pro file. This may not work!")
+
+
+HEADERS += ../../../editors/MemoryDesigner/ConnectivityComponent.h \
+    ../../../editors/MemoryDesigner/ConnectivityInterface.h \
+    ../../../editors/MemoryDesigner/MemoryConnectionAddressCalculator.h \
+    ../../../editors/MemoryDesigner/MemoryDesignerConstants.h \
+    ../../../editors/MemoryDesigner/MemoryItem.h \
+    ../../../Plugins/common/CpuRoutesContainer.h \
+    ../../../Plugins/common/GlobalAddressMap.h
+SOURCES += ../../../editors/MemoryDesigner/ConnectivityComponent.cpp \
+    ../../../editors/MemoryDesigner/ConnectivityInterface.cpp \
+    ../../../editors/MemoryDesigner/MemoryConnectionAddressCalculator.cpp \
+    ../../../editors/MemoryDesigner/MemoryDesignerConstants.cpp \
+    ../../../editors/MemoryDesigner/MemoryItem.cpp \
+    ../../../Plugins/common/CpuRoutesContainer.cpp \
+    ../../../Plugins/common/GlobalAddressMap.cpp \
+    ./tst_GlobalAddressMap.cpp
@@ -0,0 +1,47 @@
+#-----------------------------------------------------------------------------
+# File: tst_GlobalAddressMap.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for GlobalAddressMap.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core xml gui testlib widgets
+CONFIG += c++17 testcase console
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodelsd \
+        -L../../../executable -lKactusAPId
+
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_GlobalAddressMapd
+
+} else {
+    # release mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodels \
+        -L../../../executable -lKactusAPI
+
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_GlobalAddressMap
+}
+
+INCLUDEPATH += ../../../
+INCLUDEPATH += ../../../executable
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += ../../../
+DEPENDPATH += ../../../executable
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+include(tst_GlobalAddressMap.pri)
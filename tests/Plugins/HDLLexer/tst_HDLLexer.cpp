@@ -0,0 +1,215 @@
+//-----------------------------------------------------------------------------
+// File: tst_HDLLexer.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class HDLLexer.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <Plugins/common/HDLLexer.h>
+
+class tst_HDLLexer : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_HDLLexer();
+
+private slots:
+
+    void testDirectiveWithContinuation();
+    void testDirectiveWithContinuation_data();
+
+    void testBlockCommentsDoNotNest();
+    void testLineCommentInsideBlockComment();
+
+    void testUnterminatedAttribute();
+    void testAttributeAndEventControl();
+
+    void testVHDLExtendedIdentifier();
+    void testVHDLExtendedIdentifier_data();
+
+    void testVHDLWordsAreCaseInsensitive();
+
+private:
+
+    void verifyToken(HDLLexer const& lexer, int index, HDLLexer::TokenType type, QString const& text);
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::tst_HDLLexer()
+//-----------------------------------------------------------------------------
+tst_HDLLexer::tst_HDLLexer()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::testDirectiveWithContinuation()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::testDirectiveWithContinuation()
+{
+    QFETCH(QString, input);
+    QFETCH(QString, expectedDirective);
+
+    HDLLexer lexer(input, HDLLexer::Language::Verilog);
+
+    QCOMPARE(lexer.count(), 4);
+    verifyToken(lexer, 0, HDLLexer::TokenType::Directive, expectedDirective);
+    verifyToken(lexer, 1, HDLLexer::TokenType::Identifier, "wire");
+    verifyToken(lexer, 2, HDLLexer::TokenType::Identifier, "a");
+    verifyToken(lexer, 3, HDLLexer::TokenType::Operator, ";");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::testDirectiveWithContinuation_data()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::testDirectiveWithContinuation_data()
+{
+    QTest::addColumn<QString>("input");
+    QTest::addColumn<QString>("expectedDirective");
+
+    QTest::newRow("single line") << "`define W 8\nwire a;" << "`define W 8";
+
+    QTest::newRow("one continuation") << "`define W \\\n 8\nwire a;" << "`define W \\\n 8";
+
+    QTest::newRow("two continuations") << "`define W \\\n (4 + \\\n 4)\nwire a;" <<
+        "`define W \\\n (4 + \\\n 4)";
+
+    QTest::newRow("continuation with CRLF line endings") << "`define W \\\r\n 8\r\nwire a;" <<
+        "`define W \\\r\n 8";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::testBlockCommentsDoNotNest()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::testBlockCommentsDoNotNest()
+{
+    HDLLexer lexer("/* outer /* inner */ tail */", HDLLexer::Language::Verilog);
+
+    QCOMPARE(lexer.count(), 4);
+    verifyToken(lexer, 0, HDLLexer::TokenType::Comment, "/* outer /* inner */");
+    verifyToken(lexer, 1, HDLLexer::TokenType::Identifier, "tail");
+    verifyToken(lexer, 2, HDLLexer::TokenType::Operator, "*");
+    verifyToken(lexer, 3, HDLLexer::TokenType::Operator, "/");
+
+    QCOMPARE(lexer.commentText(0), QString("outer /* inner"));
+    QCOMPARE(lexer.next(-1), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::testLineCommentInsideBlockComment()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::testLineCommentInsideBlockComment()
+{
+    HDLLexer lexer("/* first // second\n third */ wire // last */", HDLLexer::Language::Verilog);
+
+    QCOMPARE(lexer.count(), 3);
+    verifyToken(lexer, 0, HDLLexer::TokenType::Comment, "/* first // second\n third */");
+    verifyToken(lexer, 1, HDLLexer::TokenType::Identifier, "wire");
+    verifyToken(lexer, 2, HDLLexer::TokenType::Comment, "// last */");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::testUnterminatedAttribute()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::testUnterminatedAttribute()
+{
+    HDLLexer lexer("(* full_case\ncase", HDLLexer::Language::Verilog);
+
+    QCOMPARE(lexer.count(), 4);
+    verifyToken(lexer, 0, HDLLexer::TokenType::Operator, "(");
+    verifyToken(lexer, 1, HDLLexer::TokenType::Operator, "*");
+    verifyToken(lexer, 2, HDLLexer::TokenType::Identifier, "full_case");
+    verifyToken(lexer, 3, HDLLexer::TokenType::Identifier, "case");
+
+    QCOMPARE(lexer.matching(0), -1);
+    QCOMPARE(lexer.isTrivia(0), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::testAttributeAndEventControl()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::testAttributeAndEventControl()
+{
+    HDLLexer lexer("(* keep = 1 *) always @(*) begin", HDLLexer::Language::Verilog);
+
+    QCOMPARE(lexer.count(), 7);
+    verifyToken(lexer, 0, HDLLexer::TokenType::Attribute, "(* keep = 1 *)");
+    verifyToken(lexer, 1, HDLLexer::TokenType::Identifier, "always");
+    verifyToken(lexer, 2, HDLLexer::TokenType::Operator, "@");
+    verifyToken(lexer, 3, HDLLexer::TokenType::Operator, "(");
+    verifyToken(lexer, 4, HDLLexer::TokenType::Operator, "*");
+    verifyToken(lexer, 5, HDLLexer::TokenType::Operator, ")");
+    verifyToken(lexer, 6, HDLLexer::TokenType::Identifier, "begin");
+
+    QCOMPARE(lexer.isTrivia(0), true);
+    QCOMPARE(lexer.matching(3), 5);
+    QCOMPARE(lexer.matching(5), 3);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::testVHDLExtendedIdentifier()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::testVHDLExtendedIdentifier()
+{
+    QFETCH(QString, input);
+    QFETCH(QString, expectedIdentifier);
+
+    HDLLexer lexer(input, HDLLexer::Language::VHDL);
+
+    QCOMPARE(lexer.count(), 3);
+    verifyToken(lexer, 0, HDLLexer::TokenType::Identifier, expectedIdentifier);
+    verifyToken(lexer, 1, HDLLexer::TokenType::Operator, ":");
+    verifyToken(lexer, 2, HDLLexer::TokenType::Identifier, "integer");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::testVHDLExtendedIdentifier_data()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::testVHDLExtendedIdentifier_data()
+{
+    QTest::addColumn<QString>("input");
+    QTest::addColumn<QString>("expectedIdentifier");
+
+    QTest::newRow("plain extended identifier") << "\\foo\\ : integer" << "\\foo\\";
+    QTest::newRow("extended identifier with space") << "\\foo bar\\ : integer" << "\\foo bar\\";
+    QTest::newRow("extended identifier with operator characters") << "\\a:b;c\\ : integer" << "\\a:b;c\\";
+    QTest::newRow("extended identifier with escaped backslash") << "\\a\\\\b\\ : integer" << "\\a\\\\b\\";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::testVHDLWordsAreCaseInsensitive()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::testVHDLWordsAreCaseInsensitive()
+{
+    HDLLexer vhdlLexer("ENTITY test IS", HDLLexer::Language::VHDL);
+
+    QCOMPARE(vhdlLexer.count(), 3);
+    QCOMPARE(vhdlLexer.isWord(0, "entity"), true);
+    QCOMPARE(vhdlLexer.isWord(2, "is"), true);
+
+    HDLLexer verilogLexer("MODULE test", HDLLexer::Language::Verilog);
+
+    QCOMPARE(verilogLexer.isWord(0, "module"), false);
+    QCOMPARE(verilogLexer.isWord(0, "MODULE"), true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLLexer::verifyToken()
+//-----------------------------------------------------------------------------
+void tst_HDLLexer::verifyToken(HDLLexer const& lexer, int index, HDLLexer::TokenType type, QString const& text)
+{
+    QVERIFY(index < lexer.count());
+    QCOMPARE(lexer.token(index).type, type);
+    QCOMPARE(lexer.text(index).toString(), text);
+}
+
+QTEST_APPLESS_MAIN(tst_HDLLexer)
+
+#include "tst_HDLLexer.moc"
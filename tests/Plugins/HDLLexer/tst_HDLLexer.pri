@@ -0,0 +1,3 @@
+HEADERS += ../../../Plugins/common/HDLLexer.h
+SOURCES += ../../../Plugins/common/HDLLexer.cpp \
+    ./tst_HDLLexer.cpp
@@ -0,0 +1,39 @@
+#-----------------------------------------------------------------------------
+# File: tst_HDLLexer.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for a single module.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core testlib
+QT -= gui
+CONFIG += c++17 testcase console
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_HDLLexerd
+
+} else {
+    # release mode
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_HDLLexer
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../../
+
+DEPENDPATH += .
+DEPENDPATH += ../../../
+
+OBJECTS_DIR += $$DESTDIR
+
+include(tst_HDLLexer.pri)
@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include <QtTest>
+#include <QTemporaryDir>
 
 #include <IPXACTmodels/common/VLNV.h>
 #include <IPXACTmodels/common/ConfigurableVLNVReference.h>
@@ -35,6 +36,8 @@
 
 #include <Plugins/LinuxDeviceTree/LinuxDeviceTreeGenerator.h>
 
+#include <Plugins/common/ConnectivityGraphUtilities.h>
+
 #include <tests/MockObjects/LibraryMock.h>
 
 class tst_LinuxDeviceTreeGenerator : public QObject
@@ -71,12 +74,27 @@ private slots:
     void testHierarchicalPath();
 
     void testMemoryInAddressBlock();
+
+    void testCpuRoutesAreCached();
+    void testCachedCpuIsTakenFromCurrentComponent();
+    void testCpuRoutesCacheIsInvalidatedByTopComponentChange();
+    void testCpuRoutesCacheIsInvalidatedByDocumentChange();
+    void testCpuRoutesAreNotCachedWithoutFiles();
+    void testCpuRoutesCacheIsBounded();
+
 private:
 
     QString runGenerator(QString const& activeView, bool generateAddressBlocks = false);
 
     QString getFileContent(QString const& fileName);
 
+    QSharedPointer<Component> createSimpleConnection();
+
+    void storeInFile(QSharedPointer<Document> document, QTemporaryDir const& directory);
+
+    QSharedPointer<const ConnectivityInterface> getFirstCpuInterface(
+        QVector<QSharedPointer<SingleCpuRoutesContainer> > const& cpus) const;
+
     QSharedPointer<AddressSpace> createAddressSpace(QString const& spaceName, QString const& range,
         QString const& width, QSharedPointer<Component> containingComponent) const;
 
@@ -170,6 +188,7 @@ void tst_LinuxDeviceTreeGenerator::init()
 void tst_LinuxDeviceTreeGenerator::cleanup()
 {
     library_->clear();
+    ConnectivityGraphUtilities::clearCpuRouteCache();
 
     QFile outputFile("./TopComponent_0.dts");
     outputFile.remove();
@@ -1244,6 +1263,163 @@ void tst_LinuxDeviceTreeGenerator::testMemoryInAddressBlock()
     QCOMPARE(output, expectedOutput);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_LinuxDeviceTreeGenerator::testCpuRoutesAreCached()
+//-----------------------------------------------------------------------------
+void tst_LinuxDeviceTreeGenerator::testCpuRoutesAreCached()
+{
+    QSharedPointer<Component> cpuComponent = createSimpleConnection();
+
+    QTemporaryDir libraryDirectory;
+    storeInFile(design_, libraryDirectory);
+    storeInFile(cpuComponent, libraryDirectory);
+    storeInFile(library_->getModel(VLNV(VLNV::COMPONENT, "Test", "TestLibrary", "MapComponent", "1.0")),
+        libraryDirectory);
+
+    auto firstCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+    auto secondCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+
+    QCOMPARE(firstCPUs.size(), 1);
+    QCOMPARE(secondCPUs.size(), 1);
+
+    // A cache hit shares the connectivity interfaces, but each caller gets its own containers.
+    QVERIFY(getFirstCpuInterface(firstCPUs).isNull() == false);
+    QCOMPARE(getFirstCpuInterface(secondCPUs), getFirstCpuInterface(firstCPUs));
+    QVERIFY(secondCPUs.first() != firstCPUs.first());
+    QCOMPARE(secondCPUs.first()->getFileID(), firstCPUs.first()->getFileID());
+    QCOMPARE(secondCPUs.first()->getCpu(), cpuComponent->getCpus()->first());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LinuxDeviceTreeGenerator::testCachedCpuIsTakenFromCurrentComponent()
+//-----------------------------------------------------------------------------
+void tst_LinuxDeviceTreeGenerator::testCachedCpuIsTakenFromCurrentComponent()
+{
+    QSharedPointer<Component> cpuComponent = createSimpleConnection();
+
+    QTemporaryDir libraryDirectory;
+    storeInFile(design_, libraryDirectory);
+    storeInFile(cpuComponent, libraryDirectory);
+    storeInFile(library_->getModel(VLNV(VLNV::COMPONENT, "Test", "TestLibrary", "MapComponent", "1.0")),
+        libraryDirectory);
+
+    auto firstCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+
+    // The library reads the unchanged document again.
+    QSharedPointer<Component> reloadedComponent(new Component(*cpuComponent));
+    library_->addComponent(reloadedComponent);
+
+    auto secondCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+
+    QCOMPARE(secondCPUs.size(), 1);
+    QCOMPARE(getFirstCpuInterface(secondCPUs), getFirstCpuInterface(firstCPUs));
+    QCOMPARE(secondCPUs.first()->getCpu(), reloadedComponent->getCpus()->first());
+    QCOMPARE(firstCPUs.first()->getCpu(), cpuComponent->getCpus()->first());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LinuxDeviceTreeGenerator::testCpuRoutesCacheIsInvalidatedByTopComponentChange()
+//-----------------------------------------------------------------------------
+void tst_LinuxDeviceTreeGenerator::testCpuRoutesCacheIsInvalidatedByTopComponentChange()
+{
+    QSharedPointer<Component> cpuComponent = createSimpleConnection();
+
+    QTemporaryDir libraryDirectory;
+    storeInFile(design_, libraryDirectory);
+    storeInFile(cpuComponent, libraryDirectory);
+    storeInFile(library_->getModel(VLNV(VLNV::COMPONENT, "Test", "TestLibrary", "MapComponent", "1.0")),
+        libraryDirectory);
+
+    auto firstCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+
+    topComponent_->setDescription("Unsaved change.");
+
+    auto secondCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+
+    QCOMPARE(secondCPUs.size(), 1);
+    QVERIFY(getFirstCpuInterface(secondCPUs) != getFirstCpuInterface(firstCPUs));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LinuxDeviceTreeGenerator::testCpuRoutesCacheIsInvalidatedByDocumentChange()
+//-----------------------------------------------------------------------------
+void tst_LinuxDeviceTreeGenerator::testCpuRoutesCacheIsInvalidatedByDocumentChange()
+{
+    QSharedPointer<Component> cpuComponent = createSimpleConnection();
+
+    QTemporaryDir libraryDirectory;
+    storeInFile(design_, libraryDirectory);
+    storeInFile(cpuComponent, libraryDirectory);
+    storeInFile(library_->getModel(VLNV(VLNV::COMPONENT, "Test", "TestLibrary", "MapComponent", "1.0")),
+        libraryDirectory);
+
+    auto firstCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+
+    QFile designFile(library_->getPath(design_->getVlnv()));
+    QVERIFY(designFile.open(QIODevice::Append));
+    designFile.write("<!-- Saved again. -->\n");
+    designFile.close();
+
+    auto secondCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+
+    QCOMPARE(secondCPUs.size(), 1);
+    QVERIFY(getFirstCpuInterface(secondCPUs) != getFirstCpuInterface(firstCPUs));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LinuxDeviceTreeGenerator::testCpuRoutesAreNotCachedWithoutFiles()
+//-----------------------------------------------------------------------------
+void tst_LinuxDeviceTreeGenerator::testCpuRoutesAreNotCachedWithoutFiles()
+{
+    QSharedPointer<Component> cpuComponent = createSimpleConnection();
+
+    // The map component is only in memory.
+    QTemporaryDir libraryDirectory;
+    storeInFile(design_, libraryDirectory);
+    storeInFile(cpuComponent, libraryDirectory);
+
+    auto firstCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+    auto secondCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+
+    QCOMPARE(firstCPUs.size(), 1);
+    QCOMPARE(secondCPUs.size(), 1);
+    QVERIFY(getFirstCpuInterface(secondCPUs) != getFirstCpuInterface(firstCPUs));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LinuxDeviceTreeGenerator::testCpuRoutesCacheIsBounded()
+//-----------------------------------------------------------------------------
+void tst_LinuxDeviceTreeGenerator::testCpuRoutesCacheIsBounded()
+{
+    QSharedPointer<Component> cpuComponent = createSimpleConnection();
+
+    QTemporaryDir libraryDirectory;
+    storeInFile(design_, libraryDirectory);
+    storeInFile(cpuComponent, libraryDirectory);
+    storeInFile(library_->getModel(VLNV(VLNV::COMPONENT, "Test", "TestLibrary", "MapComponent", "1.0")),
+        libraryDirectory);
+
+    auto firstCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+
+    for (int i = 0; i < ConnectivityGraphUtilities::CPU_ROUTE_CACHE_SIZE - 1; ++i)
+    {
+        ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "view" + QString::number(i));
+    }
+
+    auto secondCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+    QCOMPARE(getFirstCpuInterface(secondCPUs), getFirstCpuInterface(firstCPUs));
+
+    // The hierarchical view is now the most recently used, so all the others are dropped before it.
+    for (int i = 0; i < ConnectivityGraphUtilities::CPU_ROUTE_CACHE_SIZE; ++i)
+    {
+        ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "otherView" + QString::number(i));
+    }
+
+    auto thirdCPUs = ConnectivityGraphUtilities::getDefaultCPUs(library_, topComponent_, "hierarchical");
+    QCOMPARE(thirdCPUs.size(), 1);
+    QVERIFY(getFirstCpuInterface(thirdCPUs) != getFirstCpuInterface(firstCPUs));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_LinuxDeviceTreeGenerator::runGenerator()
 //-----------------------------------------------------------------------------
@@ -1287,6 +1463,73 @@ QSharedPointer<AddressSpace> tst_LinuxDeviceTreeGenerator::createAddressSpace(QS
     return newSpace;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_LinuxDeviceTreeGenerator::createSimpleConnection()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_LinuxDeviceTreeGenerator::createSimpleConnection()
+{
+    VLNV cpuVLNV(VLNV::COMPONENT, "Test", "TestLibrary", "testCPU", "1.0");
+    QSharedPointer<Component> cpuComponent(new Component(cpuVLNV, Document::Revision::Std14));
+
+    QSharedPointer<AddressSpace> testSpace =
+        createAddressSpace(QStringLiteral("testSpace"), "16", "16", cpuComponent);
+    createCPU("testCPU", testSpace->name(), cpuComponent);
+
+    QSharedPointer<BusInterface> cpuBus = createMasterBusInterface("topBus", testSpace, cpuComponent);
+
+    VLNV mapVlnv(VLNV::COMPONENT, "Test", "TestLibrary", "MapComponent", "1.0");
+    QSharedPointer<Component> mapComponent(new Component(mapVlnv, Document::Revision::Std14));
+
+    library_->addComponent(cpuComponent);
+    library_->addComponent(mapComponent);
+
+    QSharedPointer<MemoryMap> testMap = createMemoryMap("testMap", mapComponent);
+    QSharedPointer<BusInterface> mapBus = createSlaveBusInterface("mapBus", testMap, mapComponent);
+
+    QSharedPointer<ComponentInstance> cpuInstance =
+        createComponentInstance(cpuVLNV, "cpuInstance", "cpuID", design_);
+    QSharedPointer<ComponentInstance> mapInstance =
+        createComponentInstance(mapVlnv, "mapInstance", "mapID", design_);
+
+    QSharedPointer<ActiveInterface> cpuInterface(
+        new ActiveInterface(cpuInstance->getInstanceName(), cpuBus->name()));
+    QSharedPointer<ActiveInterface> mapInterface(
+        new ActiveInterface(mapInstance->getInstanceName(), mapBus->name()));
+
+    createInterconnection(cpuInterface, mapInterface, design_);
+
+    return cpuComponent;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LinuxDeviceTreeGenerator::storeInFile()
+//-----------------------------------------------------------------------------
+void tst_LinuxDeviceTreeGenerator::storeInFile(QSharedPointer<Document> document, QTemporaryDir const& directory)
+{
+    QString documentPath = directory.filePath(document->getVlnv().getName() + ".xml");
+
+    QFile documentFile(documentPath);
+    documentFile.open(QIODevice::WriteOnly);
+    documentFile.write("<document/>\n");
+    documentFile.close();
+
+    library_->writeModelToFile(documentPath, document);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LinuxDeviceTreeGenerator::getFirstCpuInterface()
+//-----------------------------------------------------------------------------
+QSharedPointer<const ConnectivityInterface> tst_LinuxDeviceTreeGenerator::getFirstCpuInterface(
+    QVector<QSharedPointer<SingleCpuRoutesContainer> > const& cpus) const
+{
+    if (cpus.isEmpty() || cpus.first()->getRoutes().isEmpty())
+    {
+        return QSharedPointer<const ConnectivityInterface>();
+    }
+
+    return cpus.first()->getRoutes().first()->cpuInterface_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_LinuxDeviceTreeGenerator::createCPU()
 //-----------------------------------------------------------------------------
@@ -82,6 +82,7 @@ private slots:
 	void multiObjectGeneration();
 	void multiFileGeneration();
 	void noCompiler();
+	void unchangedMakefile();
 	void allTheWay();
 
 private:
@@ -1767,6 +1768,60 @@ void tst_MakefileGenerator::noCompiler()
 	verifyOutputContains("software_0", "_OBJ= array.c.o");
 }
 
+// Makefiles with unchanged content must not be rewritten, as their timestamp would trigger a rebuild.
+void tst_MakefileGenerator::unchangedMakefile()
+{
+    QSharedPointer<Design> design;
+    QSharedPointer<DesignConfiguration> desgconf;
+    QSharedPointer<Component> topComponent = createDesign(design, desgconf);
+
+	SWStackParser stackParser(&library_, topComponent, design, desgconf);
+	MakefileParser makeParser( &library_, stackParser );
+	QSharedPointer<QList<QSharedPointer<MakeFileData> > > datas = makeParser.getParsedData();
+	QSharedPointer<MakeFileData> makeData = QSharedPointer<MakeFileData>( new MakeFileData );
+	datas->append(makeData);
+
+	makeData->hardPart = QSharedPointer<StackPart>( new StackPart );
+	makeData->hardPart->buildCmd = QSharedPointer<FileBuilder>( new FileBuilder() );
+	makeData->hardPart->buildCmd->setCommand("gcc");
+	makeData->name = "unchanged_0";
+	makeData->makeName = makeData->name + ".mak";
+
+	QSharedPointer<MakeObjectData> mod( new MakeObjectData );
+	makeData->swObjects.append( mod );
+	mod->fileName = "array.c";
+	mod->compiler = "gcc";
+	mod->flags = "-sw";
+
+	MakefileGenerator generator( makeParser, &utilityMock_, stackParser.getGeneralFileSet() );
+	generator.generate(outputDir_,outputDir_);
+
+	QString makePath = outputDir_ + "/" + makeData->makeName;
+	QDateTime oldTime(QDate(2000, 1, 1), QTime(0, 0));
+
+	QFile makeFile(makePath);
+	QVERIFY(makeFile.open(QIODevice::ReadWrite));
+	QVERIFY(makeFile.setFileTime(oldTime, QFileDevice::FileModificationTime));
+	makeFile.close();
+
+	generator.generate(outputDir_,outputDir_);
+	QCOMPARE(QFileInfo(makePath).lastModified(), oldTime);
+
+	mod->flags = "-sw -hw";
+	generator.generate(outputDir_,outputDir_);
+	QVERIFY(QFileInfo(makePath).lastModified() != oldTime);
+	verifyOutputContains("unchanged_0", "$(PROFILE_FLAGS) -sw -hw");
+
+	// The master makefile must let make -j build the instances in parallel.
+	QFile masterFile(outputDir_ + "/" + MAKEFILE_MASTER_NAME);
+	QVERIFY(masterFile.open(QIODevice::ReadOnly));
+	QString masterContent = masterFile.readAll();
+	masterFile.close();
+
+	QVERIFY(masterContent.contains("make: make-unchanged_0.mak"));
+	QVERIFY(masterContent.contains("make-unchanged_0.mak:\n\t$(MAKE) -C . -f unchanged_0.mak\n"));
+}
+
 // A case used to test if correct makefile comes from original parsing results.
 void tst_MakefileGenerator::allTheWay()
 {
@@ -0,0 +1,237 @@
+//-----------------------------------------------------------------------------
+// File: tst_ModelSimGenerator.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class ModelSimWriter.
+//-----------------------------------------------------------------------------
+
+#include <Plugins/ModelSimGenerator/ModelSimWriterFactory/ModelSimWriter.h>
+
+#include <QtTest>
+#include <QTemporaryDir>
+
+class tst_ModelSimGenerator : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ModelSimGenerator();
+
+private slots:
+    void init();
+    void cleanup();
+
+    void testFilesAreOrderedByDependencies();
+    void testDependencyCycleIsBroken();
+    void testDuplicateFilesAreIgnored();
+    void testFilesAreGroupedByLibrary();
+    void testIncludeFilesAreNotCompiled();
+
+private:
+
+    /*!
+     *  Creates a source file in the temporary directory.
+     *
+     *    @param [in] fileName        The name of the file.
+     *    @param [in] compiler        The compile command for the file.
+     *    @param [in] dependencies    The names of the files the file depends on.
+     *
+     *    @return The source file description.
+     */
+    ModelSimWriter::SourceFile createFile(QString const& fileName, QString const& compiler,
+        QStringList const& dependencies = QStringList());
+
+    /*!
+     *  Gets the names of the given files.
+     *
+     *    @param [in] files   The files whose names to get.
+     *
+     *    @return The file names.
+     */
+    QStringList fileNames(QList<ModelSimWriter::SourceFile> const& files) const;
+
+    /*!
+     *  Writes the script of the given writer.
+     *
+     *    @param [in] writer  The writer to use.
+     *
+     *    @return The written script.
+     */
+    QString writeScript(ModelSimWriter const& writer) const;
+
+    //! The directory for the source files and the script.
+    QTemporaryDir* directory_ = nullptr;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::tst_ModelSimGenerator()
+//-----------------------------------------------------------------------------
+tst_ModelSimGenerator::tst_ModelSimGenerator()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::init()
+//-----------------------------------------------------------------------------
+void tst_ModelSimGenerator::init()
+{
+    directory_ = new QTemporaryDir();
+    QVERIFY(directory_->isValid());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::cleanup()
+//-----------------------------------------------------------------------------
+void tst_ModelSimGenerator::cleanup()
+{
+    delete directory_;
+    directory_ = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::testFilesAreOrderedByDependencies()
+//-----------------------------------------------------------------------------
+void tst_ModelSimGenerator::testFilesAreOrderedByDependencies()
+{
+    ModelSimWriter writer;
+    writer.addFile(createFile("top.vhd", "vcom", { "middle.vhd", "package.vhd" }));
+    writer.addFile(createFile("middle.vhd", "vcom", { "package.vhd" }));
+    writer.addFile(createFile("package.vhd", "vcom"));
+    writer.addFile(createFile("other.vhd", "vcom"));
+
+    QCOMPARE(fileNames(writer.getCompileOrder()),
+        QStringList({ "package.vhd", "middle.vhd", "top.vhd", "other.vhd" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::testDependencyCycleIsBroken()
+//-----------------------------------------------------------------------------
+void tst_ModelSimGenerator::testDependencyCycleIsBroken()
+{
+    ModelSimWriter writer;
+    writer.addFile(createFile("first.v", "vlog", { "second.v" }));
+    writer.addFile(createFile("second.v", "vlog", { "first.v", "external.v" }));
+
+    QCOMPARE(fileNames(writer.getCompileOrder()), QStringList({ "second.v", "first.v" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::testDuplicateFilesAreIgnored()
+//-----------------------------------------------------------------------------
+void tst_ModelSimGenerator::testDuplicateFilesAreIgnored()
+{
+    ModelSimWriter writer;
+    writer.addFile(createFile("instance.v", "vlog"));
+    writer.addFile(createFile("instance.v", "vlog"));
+
+    QCOMPARE(fileNames(writer.getCompileOrder()), QStringList({ "instance.v" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::testFilesAreGroupedByLibrary()
+//-----------------------------------------------------------------------------
+void tst_ModelSimGenerator::testFilesAreGroupedByLibrary()
+{
+    QDir(directory_->path()).mkdir("include");
+
+    ModelSimWriter::SourceFile first = createFile("first.v", "vlog");
+    first.includeDirectories.append(directory_->filePath("include"));
+    first.defines.append("WIDTH=8");
+
+    ModelSimWriter::SourceFile second = createFile("second.v", "vlog");
+    second.includeDirectories = first.includeDirectories;
+    second.defines = first.defines;
+
+    ModelSimWriter::SourceFile library = createFile("library.vhd", "vcom");
+    library.library = "ip_lib";
+
+    ModelSimWriter writer;
+    writer.addFile(first);
+    writer.addFile(second);
+    writer.addFile(library);
+
+    QString script = writeScript(writer);
+
+    QVERIFY(script.contains("if {![file exists {work}]} {vlib {work}}"));
+    QVERIFY(script.contains("if {![file exists {ip_lib}]} {vlib {ip_lib}}"));
+    QCOMPARE(script.count("vlog -work {work} {+incdir+include} {+define+WIDTH=8} {*}$kactus2_files"), 1);
+    QCOMPARE(script.count("vcom -work {ip_lib} {*}$kactus2_files"), 1);
+    QVERIFY(script.contains("if {[kactus2_changed {first.v} {}]} {lappend kactus2_files {first.v}}"));
+    QVERIFY(script.contains("if {[kactus2_changed {second.v} {}]} {lappend kactus2_files {second.v}}"));
+
+    // The signatures are stored only after all the files have been compiled.
+    QVERIFY(script.indexOf("array get kactus2_current") > script.lastIndexOf("kactus2_files"));
+    QVERIFY(script.contains("project compileall") == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::testIncludeFilesAreNotCompiled()
+//-----------------------------------------------------------------------------
+void tst_ModelSimGenerator::testIncludeFilesAreNotCompiled()
+{
+    ModelSimWriter writer;
+    writer.addFile(createFile("module.v", "vlog", { "definitions.vh" }));
+    writer.addFile(createFile("definitions.vh", QString()));
+
+    QString script = writeScript(writer);
+
+    QVERIFY(script.contains("kactus2_changed {definitions.vh} {}\n"));
+    QVERIFY(script.contains("if {[kactus2_changed {module.v} {{definitions.vh}}]}"));
+    QVERIFY(script.indexOf("{definitions.vh} {}") < script.indexOf("{module.v}"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::createFile()
+//-----------------------------------------------------------------------------
+ModelSimWriter::SourceFile tst_ModelSimGenerator::createFile(QString const& fileName, QString const& compiler,
+    QStringList const& dependencies)
+{
+    QFile file(directory_->filePath(fileName));
+    file.open(QIODevice::WriteOnly);
+    file.close();
+
+    ModelSimWriter::SourceFile source;
+    source.path = directory_->filePath(fileName);
+    source.compiler = compiler;
+
+    for (QString const& dependency : dependencies)
+    {
+        source.dependencies.append(directory_->filePath(dependency));
+    }
+
+    return source;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::fileNames()
+//-----------------------------------------------------------------------------
+QStringList tst_ModelSimGenerator::fileNames(QList<ModelSimWriter::SourceFile> const& files) const
+{
+    QStringList names;
+    for (ModelSimWriter::SourceFile const& file : files)
+    {
+        names.append(QFileInfo(file.path).fileName());
+    }
+
+    return names;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelSimGenerator::writeScript()
+//-----------------------------------------------------------------------------
+QString tst_ModelSimGenerator::writeScript(ModelSimWriter const& writer) const
+{
+    QString script;
+    QTextStream output(&script);
+    writer.write(output, directory_->path());
+
+    return script;
+}
+
+QTEST_APPLESS_MAIN(tst_ModelSimGenerator)
+
+#include "tst_ModelSimGenerator.moc"
@@ -0,0 +1,7 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Tools.
+# ------------------------------------------------------
+
+HEADERS += ../../../Plugins/ModelSimGenerator/ModelSimWriterFactory/ModelSimWriter.h
+SOURCES += ../../../Plugins/ModelSimGenerator/ModelSimWriterFactory/ModelSimWriter.cpp \
+    ./tst_ModelSimGenerator.cpp
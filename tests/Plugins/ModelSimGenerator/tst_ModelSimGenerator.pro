@@ -0,0 +1,51 @@
+#-----------------------------------------------------------------------------
+# File: tst_ModelSimGenerator.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for ModelSim generator.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core xml gui testlib widgets
+CONFIG += c++17 testcase console
+
+QMAKE_EXPORTED_VARIABLES += MAKE_TESTARGS
+MAKE_TESTARGS.name = TESTARGS
+MAKE_TESTARGS.value = "-platform offscreen"
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodelsd \
+        -L../../../executable -lKactusAPId
+
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_ModelSimGeneratord
+
+} else {
+    # release mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodels \
+        -L../../../executable -lKactusAPI
+
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_ModelSimGenerator
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../../
+INCLUDEPATH += ./../../KactusAPI/include
+
+DEPENDPATH += .
+DEPENDPATH += ../../../
+
+OBJECTS_DIR += $$DESTDIR
+
+include(tst_ModelSimGenerator.pri)
@@ -14,13 +14,18 @@ TEMPLATE = subdirs
 CONFIG += c++17 testcase
 
 SUBDIRS += VerilogGenerator/VerilogGenerator.pro \
+			VHDLGenerator/tst_VHDLWriterFactory.pro \
 			MakefileGenerator/tst_MakefileGenerator.pro \
 			VHDLimport/VHDLimport.pro \
 			VerilogImport/VerilogImport.pro \
 		    VerilogIncludeImport/tst_VerilogIncludeImport.pro \
+			HDLLexer/tst_HDLLexer.pro \
 			VerilogSourceAnalyzer/tst_VerilogSourceAnalyzer.pro \
 			MemoryMapHeaderGenerator/tst_MemoryMapHeaderGenerator.pro \
 #			MemoryViewGenerator/tst_MemoryViewGenerator.pro \
 			CppSourceAnalyzer/tst_CppSourceAnalyzer.pro \
 			QuartusProjectGenerator/tst_QuartusProjectGenerator.pro \
-			LinuxDeviceTreeGenerator/tst_LinuxDeviceTreeGenerator.pro
+			ModelSimGenerator/tst_ModelSimGenerator.pro \
+			LinuxDeviceTreeGenerator/tst_LinuxDeviceTreeGenerator.pro \
+			GlobalAddressMap/tst_GlobalAddressMap.pro \
+			QuartusPinImport/tst_QuartusPinImport.pro
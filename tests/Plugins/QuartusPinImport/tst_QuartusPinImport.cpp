@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------------
+// File: tst_QuartusPinImport.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class QuartusPinImportPlugin.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <Plugins/QuartusPinImportPlugin/QuartusPinImportPlugin.h>
+#include <Plugins/common/PinTable/PinTableReader.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Port.h>
+
+class tst_QuartusPinImport : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_QuartusPinImport();
+
+private slots:
+    void init();
+
+    void testQuartusPinsAreImported();
+    void testCsvPinsAreImported();
+    void testHeaderAndCommentLinesAreSkipped();
+    void testExistingPortIsUpdated();
+    void testUnknownDirectionIsRejected();
+
+private:
+
+    //! The component to import into.
+    QSharedPointer<Component> importComponent_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_QuartusPinImport::tst_QuartusPinImport()
+//-----------------------------------------------------------------------------
+tst_QuartusPinImport::tst_QuartusPinImport(): importComponent_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_QuartusPinImport::init()
+//-----------------------------------------------------------------------------
+void tst_QuartusPinImport::init()
+{
+    importComponent_ = QSharedPointer<Component>(new Component(VLNV(), Document::Revision::Std14));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_QuartusPinImport::testQuartusPinsAreImported()
+//-----------------------------------------------------------------------------
+void tst_QuartusPinImport::testQuartusPinsAreImported()
+{
+    QString input(
+        "CLOCK_50                     : AF14      : input  : 3.3-V LVTTL       :         : 3B       : Y\r\n"
+        "LEDR[0]                      : V16       : output : 3.3-V LVTTL       :         : 4A       : Y\r\n"
+        "GPIO_0[3]                    : AC18      : bidir  : 3.3-V LVTTL       :         : 4A       : Y\r\n"
+        "RESERVED_INPUT               : AB12      :        :                   :         : 3A       :\r\n");
+
+    QuartusPinImportPlugin importer;
+    importer.import(input, QString(), importComponent_);
+
+    QCOMPARE(importComponent_->getPorts()->count(), 4);
+
+    QSharedPointer<Port> clock = importComponent_->getPort("AF14");
+    QVERIFY(clock.isNull() == false);
+    QCOMPARE(clock->getDirection(), DirectionTypes::IN);
+    QCOMPARE(clock->description(), QString("CLOCK_50"));
+
+    QCOMPARE(importComponent_->getPort("V16")->getDirection(), DirectionTypes::OUT);
+    QCOMPARE(importComponent_->getPort("V16")->description(), QString("LEDR[0]"));
+    QCOMPARE(importComponent_->getPort("AC18")->getDirection(), DirectionTypes::INOUT);
+    QCOMPARE(importComponent_->getPort("AB12")->getDirection(), DirectionTypes::DIRECTION_PHANTOM);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_QuartusPinImport::testCsvPinsAreImported()
+//-----------------------------------------------------------------------------
+void tst_QuartusPinImport::testCsvPinsAreImported()
+{
+    QString input(
+        "# Board pin list\n"
+        "Location,Signal,Direction\n"
+        "E3, \"clk\", in\n"
+        "H17,led,OUT\n");
+
+    QuartusPinImportPlugin importer;
+    importer.import(input, QString(), importComponent_);
+
+    QCOMPARE(importComponent_->getPorts()->count(), 2);
+    QCOMPARE(importComponent_->getPort("E3")->getDirection(), DirectionTypes::IN);
+    QCOMPARE(importComponent_->getPort("E3")->description(), QString("clk"));
+    QCOMPARE(importComponent_->getPort("H17")->getDirection(), DirectionTypes::OUT);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_QuartusPinImport::testHeaderAndCommentLinesAreSkipped()
+//-----------------------------------------------------------------------------
+void tst_QuartusPinImport::testHeaderAndCommentLinesAreSkipped()
+{
+    QString input(
+        " -- Copyright (C) 2013 Altera Corporation\n"
+        "CHIP  \"top\"  ASSIGNED TO AN: 5CSEMA5F31C6\n"
+        "\n"
+        "Pin Name/Usage               : Location  : Dir.   : I/O Standard      : Voltage : I/O Bank : User Assignment\n"
+        "-------------------------------------------------------------------------------------------------------------\n"
+        "KEY[0]                       : AA14      : input  : 3.3-V LVTTL       :         : 3B       : Y\n");
+
+    QuartusPinImportPlugin importer;
+    importer.import(input, QString(), importComponent_);
+
+    QCOMPARE(importComponent_->getPorts()->count(), 1);
+    QCOMPARE(importComponent_->getPorts()->first()->name(), QString("AA14"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_QuartusPinImport::testExistingPortIsUpdated()
+//-----------------------------------------------------------------------------
+void tst_QuartusPinImport::testExistingPortIsUpdated()
+{
+    QSharedPointer<Port> existingPort(new Port("AA14"));
+    existingPort->setDirection(DirectionTypes::OUT);
+    importComponent_->getPorts()->append(existingPort);
+
+    QSharedPointer<Port> removedPort(new Port("AB30"));
+    removedPort->setDirection(DirectionTypes::IN);
+    importComponent_->getPorts()->append(removedPort);
+
+    QString input(
+        "KEY[0]                       : AA14      : input  : 3.3-V LVTTL       :         : 3B       : Y\n");
+
+    QuartusPinImportPlugin importer;
+    importer.import(input, QString(), importComponent_);
+
+    QCOMPARE(importComponent_->getPorts()->count(), 2);
+    QCOMPARE(existingPort->getDirection(), DirectionTypes::IN);
+    QCOMPARE(existingPort->description(), QString("KEY[0]"));
+    QCOMPARE(removedPort->getDirection(), DirectionTypes::DIRECTION_PHANTOM);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_QuartusPinImport::testUnknownDirectionIsRejected()
+//-----------------------------------------------------------------------------
+void tst_QuartusPinImport::testUnknownDirectionIsRejected()
+{
+    PinTableReader reader(QList<PinTableFormat>({ PinTableFormat::csvPinList() }));
+
+    PinDefinition pin;
+    QVERIFY(reader.readLine(QString("A1,data,sideways"), pin) == false);
+    QVERIFY(reader.getFormat() == nullptr);
+
+    QVERIFY(reader.readLine(QString("A1,data,inout"), pin));
+    QCOMPARE(pin.portName_, QString("A1"));
+    QCOMPARE(pin.direction_, DirectionTypes::INOUT);
+    QVERIFY(reader.getFormat() != nullptr);
+}
+
+QTEST_APPLESS_MAIN(tst_QuartusPinImport)
+
+#include "tst_QuartusPinImport.moc"
@@ -0,0 +1,9 @@
+HEADERS += ../../../Plugins/QuartusPinImportPlugin/QuartusPinImportPlugin_global.h \
+    ../../../Plugins/QuartusPinImportPlugin/QuartusPinImportPlugin.h \
+    ../../../Plugins/QuartusPinImportPlugin/QuartusPinSyntax.h \
+    ../../../Plugins/common/PinTable/PinTableFormat.h \
+    ../../../Plugins/common/PinTable/PinTableReader.h
+SOURCES += ../../../Plugins/QuartusPinImportPlugin/QuartusPinImportPlugin.cpp \
+    ../../../Plugins/common/PinTable/PinTableFormat.cpp \
+    ../../../Plugins/common/PinTable/PinTableReader.cpp \
+    ./tst_QuartusPinImport.cpp
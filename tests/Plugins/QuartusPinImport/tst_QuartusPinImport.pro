@@ -0,0 +1,53 @@
+#-----------------------------------------------------------------------------
+# File: tst_QuartusPinImport.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for a single module.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+DEFINES += QUARTUSPINIMPORTPLUGIN_LIB
+
+QT += core xml gui testlib widgets
+CONFIG += c++11 testcase console
+
+QMAKE_EXPORTED_VARIABLES += MAKE_TESTARGS
+MAKE_TESTARGS.name = TESTARGS
+MAKE_TESTARGS.value = "-platform offscreen"
+
+CONFIG(debug, debug|release) {
+    # debug mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodelsd \
+        -L../../../executable -lKactusAPId
+
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_QuartusPinImportd
+
+} else {
+    # release mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodels \
+        -L../../../executable -lKactusAPI
+
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_QuartusPinImport
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../../
+INCLUDEPATH += ../../../KactusAPI/include
+
+DEPENDPATH += .
+DEPENDPATH += ../../../
+
+OBJECTS_DIR += $$DESTDIR
+
+include(tst_QuartusPinImport.pri)
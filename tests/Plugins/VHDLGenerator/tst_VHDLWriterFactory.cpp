@@ -0,0 +1,832 @@
+//-----------------------------------------------------------------------------
+// File: tst_VHDLWriterFactory.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class VHDLWriterFactory.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <Plugins/VHDLGenerator/VHDLWriterFactory/VHDLWriterFactory.h>
+#include <Plugins/VerilogGenerator/VerilogWriterFactory/VerilogWriterFactory.h>
+
+#include <Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h>
+#include <Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h>
+
+#include <tests/MockObjects/LibraryMock.h>
+
+#include <Plugins/common/HDLParser/MetaDesign.h>
+#include <Plugins/common/HDLParser/MetaComponent.h>
+
+#include <IPXACTmodels/common/Parameter.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/PortMap.h>
+
+class tst_VHDLWriterFactory : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_VHDLWriterFactory();
+
+private slots:
+    void init();
+    void cleanup();
+
+    void testFlatComponent();
+    void testFileHeaderIsPrinted();
+
+    void testMasterToSlaveInterconnection();
+    void testAdhocTieOffInComponentInstance();
+
+    void testWideVectorsAndValues();
+    void testFormatType();
+    void testFormatType_data();
+    void testFormatValue();
+    void testFormatValue_data();
+    void testUnconvertibleValueIsReported();
+    void testUnsupportedTypeIsReported();
+
+    void testUserCodeIsKept();
+
+    void testVerilogAndVHDLShareElaboration();
+
+    void testRenamedSelectionKeepsVHDLSuffix();
+    void testRenamedSelectionKeepsVHDLSuffix_data();
+
+    void testGenerationControlWithSeveralFactories();
+
+private:
+
+    QSharedPointer<MetaPort> addPort(QString const& portName, int portSize, DirectionTypes::Direction direction,
+        QSharedPointer<MetaComponent> component,
+        QSharedPointer<MetaInterface> mInterface = QSharedPointer<MetaInterface>());
+
+    QSharedPointer<Parameter> addParameter(QString const& name, QString const& value,
+        QSharedPointer<MetaComponent> mComponent);
+
+    QSharedPointer<MetaWire> addWireToDesign(QString const& name, QString const& leftBound,
+        QString const& rightBound, QSharedPointer<MetaInterconnection> mInterconnect);
+
+    void createPortAssignment(QSharedPointer<MetaPort> mPort, QSharedPointer<MetaWire> wire);
+
+    QSharedPointer<MetaInterface> addInterfaceToComponent(QString const& interfaceName,
+        QSharedPointer<MetaInstance> component);
+
+    QSharedPointer<MetaInstance> addInstanceToDesign(QString const& instanceName, QString const& componentName);
+
+    void runGenerator(bool useDesign);
+
+    void verifyOutputContains(QString const& expectedOutput);
+
+    QSharedPointer<MetaInstance> topComponent_;
+    QSharedPointer<MetaDesign> design_;
+
+    QSharedPointer<MetaComponent> flatComponent_;
+
+    //! The generator output as a string.
+    QString output_;
+
+    //! The time of the generator run.
+    QDateTime generationTime_;
+
+    //! The test mock for library interface.
+    LibraryMock library_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::tst_VHDLWriterFactory()
+//-----------------------------------------------------------------------------
+tst_VHDLWriterFactory::tst_VHDLWriterFactory(): output_(), generationTime_(), library_(this)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::init()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::init()
+{
+    VLNV vlnv(VLNV::COMPONENT, "Test", "TestLibrary", "TestComponent", "1.0");
+    QSharedPointer<Component> component = QSharedPointer<Component>(new Component(vlnv, Document::Revision::Std14));
+
+    MessagePasser messages;
+
+    topComponent_ =  QSharedPointer<MetaInstance>(new MetaInstance(QSharedPointer<ComponentInstance>(),
+        &library_, &messages, component, QSharedPointer<View>()));
+
+    design_ = QSharedPointer<MetaDesign>(new MetaDesign(&library_,&messages,
+        QSharedPointer<Design>(), QSharedPointer<DesignInstantiation>(),
+        QSharedPointer<DesignConfiguration>(),
+        topComponent_));
+
+    flatComponent_ = QSharedPointer<MetaComponent>(
+        new MetaComponent(&messages, component, QSharedPointer<View>()));
+
+    library_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::cleanup()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::cleanup()
+{
+    topComponent_.clear();
+
+    output_.clear();
+
+    QFile::remove("TestComponent.vhd");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testFlatComponent()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testFlatComponent()
+{
+    addPort("clk", 1, DirectionTypes::IN, flatComponent_);
+    addPort("rst_n", 1, DirectionTypes::IN, flatComponent_);
+    addPort("dataOut", 8, DirectionTypes::OUT, flatComponent_);
+    addPort("dataIn", 8, DirectionTypes::IN, flatComponent_);
+    addParameter("dataWidth", "8", flatComponent_);
+    addParameter("freq", "100000", flatComponent_);
+
+    runGenerator(false);
+
+    verifyOutputContains(QString(
+        "library IEEE;\n"
+        "use IEEE.std_logic_1164.all;\n"
+        "\n"
+        "entity TestComponent is\n"
+        "    generic (\n"
+        "        dataWidth            : integer := 8;\n"
+        "        freq                 : integer := 100000\n"
+        "    );\n"
+        "    port (\n"
+        "        -- These ports are not in any interface\n"
+        "        clk                  : in   std_logic;\n"
+        "        dataIn               : in   std_logic_vector(7 downto 0);\n"
+        "        rst_n                : in   std_logic;\n"
+        "        dataOut              : out  std_logic_vector(7 downto 0)\n"
+        "    );\n"
+        "end TestComponent;\n"
+        "\n"
+        "architecture structural of TestComponent is\n"
+        "\n"
+        "    -- You can write VHDL code after this tag and it is saved through the generator.\n"
+        "    -- ##KACTUS2_BLACK_BOX_DECLARATIONS_BEGIN##\n"
+        "    -- ##KACTUS2_BLACK_BOX_DECLARATIONS_END##\n"
+        "    -- Do not write your code after this tag.\n"
+        "\n"
+        "begin\n"
+        "\n"
+        "    -- You can write VHDL code after this tag and it is saved through the generator.\n"
+        "    -- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_BEGIN##\n"
+        "    -- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_END##\n"
+        "    -- Do not write your code after this tag.\n"
+        "\n"
+        "end structural;\n"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testFileHeaderIsPrinted()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testFileHeaderIsPrinted()
+{
+    flatComponent_->getComponent()->setDescription("Component description\nspanning multiple\nlines.");
+    library_.writeModelToFile("C:/Test/TestLibrary/TestComponent/1.0/TestComponent.1.0.xml",
+        flatComponent_->getComponent());
+
+    QCoreApplication::setOrganizationName("TUT");
+    QCoreApplication::setApplicationName("TestRunner");
+    QSettings settings;
+    settings.setValue("General/Username", "testUser");
+
+    runGenerator(false);
+
+    verifyOutputContains(QString(
+        "-------------------------------------------------------------------------------\n"
+        "-- File          : TestComponent.vhd\n"
+        "-- Creation date : " + generationTime_.date().toString("dd.MM.yyyy") + "\n"
+        "-- Creation time : " + generationTime_.time().toString("hh:mm:ss") + "\n"
+        "-- Description   : Component description\n"
+        "--                 spanning multiple\n"
+        "--                 lines.\n"
+        "-- Created by    : testUser\n"
+        "-- Tool : Kactus2 bogusToolVersion\n"
+        "-- Plugin : VHDL generator bogusGeneratorVersion\n"
+        "-- This file was generated based on IP-XACT component Test:TestLibrary:TestComponent:1.0\n"
+        "-- whose XML file is C:/Test/TestLibrary/TestComponent/1.0/TestComponent.1.0.xml\n"
+        "-------------------------------------------------------------------------------\n"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testMasterToSlaveInterconnection()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testMasterToSlaveInterconnection()
+{
+    QSharedPointer<MetaInstance> senderInstance = addInstanceToDesign("sender", "TestSender");
+    QSharedPointer<MetaInterface> senderIf = addInterfaceToComponent("data_if", senderInstance);
+    addPort("enable_out", 1, DirectionTypes::OUT, senderInstance, senderIf);
+    addPort("data_out", 8, DirectionTypes::OUT, senderInstance, senderIf);
+
+    QSharedPointer<MetaInstance> receiverInstance = addInstanceToDesign("receiver", "TestReceiver");
+    QSharedPointer<MetaInterface> receiverIf = addInterfaceToComponent("data_if", receiverInstance);
+    addPort("enable_in", 1, DirectionTypes::IN, receiverInstance, receiverIf);
+    addPort("data_in", 8, DirectionTypes::IN, receiverInstance, receiverIf);
+
+    QSharedPointer<MetaInterconnection> mInterconnect(new MetaInterconnection);
+    mInterconnect->name_ = "data_connection";
+    design_->getInterconnections()->append(mInterconnect);
+
+    QSharedPointer<MetaWire> dataWire = addWireToDesign("sender_to_receiver_DATA", "7", "0", mInterconnect);
+    QSharedPointer<MetaWire> enaWire = addWireToDesign("sender_to_receiver_ENABLE", "0", "0", mInterconnect);
+
+    createPortAssignment(receiverInstance->getPorts()->value("data_in"), dataWire);
+    createPortAssignment(receiverInstance->getPorts()->value("enable_in"), enaWire);
+    createPortAssignment(senderInstance->getPorts()->value("data_out"), dataWire);
+    createPortAssignment(senderInstance->getPorts()->value("enable_out"), enaWire);
+
+    runGenerator(true);
+
+    verifyOutputContains("    signal sender_to_receiver_DATA : std_logic_vector(7 downto 0);");
+    verifyOutputContains("    signal sender_to_receiver_ENABLE : std_logic;");
+    verifyOutputContains("    signal receiver_data_in     : std_logic_vector(7 downto 0);");
+    verifyOutputContains("    signal sender_enable_out    : std_logic;");
+
+    verifyOutputContains(
+        "    component TestReceiver\n"
+        "        port (\n"
+        "            -- Interface: data_if\n"
+        "            data_in              : in   std_logic_vector(7 downto 0);\n"
+        "            enable_in            : in   std_logic\n"
+        "        );\n"
+        "    end component;");
+
+    verifyOutputContains("    receiver_data_in <= sender_to_receiver_DATA;");
+    verifyOutputContains("    receiver_enable_in <= sender_to_receiver_ENABLE;");
+    verifyOutputContains("    sender_to_receiver_DATA <= sender_data_out;");
+    verifyOutputContains("    sender_to_receiver_ENABLE <= sender_enable_out;");
+
+    verifyOutputContains(
+        "    -- IP-XACT VLNV: Test:TestLibrary:TestReceiver:1.0\n"
+        "    receiver : TestReceiver\n"
+        "        port map (\n"
+        "            -- Interface: data_if\n"
+        "            data_in              => receiver_data_in,\n"
+        "            enable_in            => receiver_enable_in\n"
+        "        );");
+
+    verifyOutputContains(
+        "    -- IP-XACT VLNV: Test:TestLibrary:TestSender:1.0\n"
+        "    sender : TestSender\n"
+        "        port map (\n"
+        "            -- Interface: data_if\n"
+        "            data_out             => sender_data_out,\n"
+        "            enable_out           => sender_enable_out\n"
+        "        );");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testAdhocTieOffInComponentInstance()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testAdhocTieOffInComponentInstance()
+{
+    QSharedPointer<MetaInstance> receiverInstance = addInstanceToDesign("receiver", "TestReceiver");
+    addPort("enable_in", 1, DirectionTypes::IN, receiverInstance)->defaultValue_ = "1";
+    addPort("data_in", 8, DirectionTypes::IN, receiverInstance)->defaultValue_ = "8'h0";
+    addPort("mode_in", 4, DirectionTypes::IN, receiverInstance)->defaultValue_ = "4'b1010";
+    addPort("full_out", 1, DirectionTypes::OUT, receiverInstance);
+
+    runGenerator(true);
+
+    verifyOutputContains(
+        "        port map (\n"
+        "            -- These ports are not in any interface\n"
+        "            data_in              => (others => '0'),\n"
+        "            enable_in            => '1',\n"
+        "            mode_in              => \"1010\",\n"
+        "            full_out             => open\n"
+        "        );");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testWideVectorsAndValues()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testWideVectorsAndValues()
+{
+    addPort("wide_out", 100, DirectionTypes::OUT, flatComponent_);
+    addPort("seed_in", 72, DirectionTypes::IN, flatComponent_)->defaultValue_ = "64'hFFFFFFFFFFFFFFFF";
+
+    QSharedPointer<MetaPort> ascending = addPort("ascending_in", 8, DirectionTypes::IN, flatComponent_);
+    ascending->vectorBounds_ = qMakePair(QString("0"), QString("7"));
+
+    runGenerator(false);
+
+    verifyOutputContains("        wide_out             : out  std_logic_vector(99 downto 0)");
+    verifyOutputContains("        seed_in              : in   std_logic_vector(71 downto 0) := \"00000000" +
+        QString(64, QLatin1Char('1')) + "\";");
+    verifyOutputContains("        ascending_in         : in   std_logic_vector(0 to 7);");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testFormatType()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testFormatType()
+{
+    QFETCH(QString, typeName);
+    QFETCH(QString, left);
+    QFETCH(QString, right);
+    QFETCH(QString, expected);
+
+    QCOMPARE(VHDLDocument::formatType(typeName, qMakePair(left, right)), expected);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testFormatType_data()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testFormatType_data()
+{
+    QTest::addColumn<QString>("typeName");
+    QTest::addColumn<QString>("left");
+    QTest::addColumn<QString>("right");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("signal vector") << "" << "7" << "0" << "std_logic_vector(7 downto 0)";
+    QTest::newRow("signal without bounds") << "" << "" << "" << "std_logic";
+    QTest::newRow("verilog type without bounds") << "wire" << "" << "" << "std_logic";
+    QTest::newRow("vhdl vector") << "std_logic_vector" << "WIDTH-1" << "0" <<
+        "std_logic_vector(WIDTH-1 downto 0)";
+    QTest::newRow("ascending vhdl vector") << "unsigned" << "0" << "3" << "unsigned(0 to 3)";
+    QTest::newRow("vhdl vector without bounds") << "std_logic_vector" << "" << "" << "std_logic_vector";
+    QTest::newRow("vhdl vector with one bound") << "bit_vector" << "7" << "" << "bit_vector";
+    QTest::newRow("vhdl scalar") << "std_ulogic" << "" << "" << "std_ulogic";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testFormatValue()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testFormatValue()
+{
+    QFETCH(QString, value);
+    QFETCH(QString, left);
+    QFETCH(QString, right);
+    QFETCH(QString, expected);
+
+    QCOMPARE(VHDLDocument::formatValue(value, qMakePair(left, right)), expected);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testFormatValue_data()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testFormatValue_data()
+{
+    QTest::addColumn<QString>("value");
+    QTest::addColumn<QString>("left");
+    QTest::addColumn<QString>("right");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("scalar one") << "1'b1" << "0" << "0" << "'1'";
+    QTest::newRow("scalar decimal zero") << "0" << "0" << "0" << "'0'";
+    QTest::newRow("vector zero") << "16'h0000" << "15" << "0" << "(others => '0')";
+    QTest::newRow("vector decimal") << "5" << "3" << "0" << "\"0101\"";
+    QTest::newRow("vector octal") << "6'o17" << "5" << "0" << "\"001111\"";
+    QTest::newRow("truncated to width") << "8'hFF" << "3" << "0" << "\"1111\"";
+    QTest::newRow("sign and underscores") << "8'sb1010_0101" << "7" << "0" << "\"10100101\"";
+    QTest::newRow("expression is kept") << "WIDTH-1" << "7" << "0" << "WIDTH-1";
+    QTest::newRow("zero with unknown bounds") << "8'h0" << "WIDTH-1" << "0" << "(others => '0')";
+    QTest::newRow("sized decimal") << "8'd10" << "7" << "0" << "\"00001010\"";
+    QTest::newRow("wider than 64 bits") << "68'hF_0000_0000_0000_0001" << "67" << "0" <<
+        "\"1111" + QString(63, QLatin1Char('0')) + "1\"";
+    QTest::newRow("unknown and high impedance digits") << "4'b1x0z" << "3" << "0" << "\"1X0Z\"";
+    QTest::newRow("unknown value is extended") << "4'hx" << "7" << "0" << "\"XXXXXXXX\"";
+    QTest::newRow("fill with ones") << "'1" << "15" << "0" << "(others => '1')";
+    QTest::newRow("scalar fill") << "'z" << "" << "" << "'Z'";
+    QTest::newRow("scalar unknown") << "1'bx" << "0" << "0" << "'X'";
+
+    QTest::newRow("unknown bounds") << "5" << "WIDTH-1" << "0" << "";
+    QTest::newRow("too wide for scalar") << "8'hFF" << "0" << "0" << "";
+    QTest::newRow("expression with verilog literal") << "WIDTH + 8'h1" << "7" << "0" << "";
+    QTest::newRow("expression with macro") << "`WIDTH" << "7" << "0" << "";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testUnconvertibleValueIsReported()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testUnconvertibleValueIsReported()
+{
+    addPort("data_in", 8, DirectionTypes::IN, flatComponent_)->defaultValue_ = "8'hFF + `OFFSET";
+    addPort("enable_in", 1, DirectionTypes::IN, flatComponent_)->defaultValue_ = "1'b1";
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    MessagePasser messages;
+    QSignalSpy errorSpy(&messages, SIGNAL(errorMessage(QString const&)));
+
+    VHDLWriterFactory factory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+    QSharedPointer<GenerationOutput> document = factory.prepareComponent(".", flatComponent_);
+    document->write(".");
+
+    output_ = document->fileContent_;
+
+    verifyOutputContains("        data_in              : in   std_logic_vector(7 downto 0);");
+    verifyOutputContains("        enable_in            : in   std_logic := '1'");
+
+    QCOMPARE(errorSpy.count(), 1);
+    QVERIFY(errorSpy.first().first().toString().contains("8'hFF + `OFFSET"));
+    QVERIFY(errorSpy.first().first().toString().contains("data_in"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testUnsupportedTypeIsReported()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testUnsupportedTypeIsReported()
+{
+    addPort("count_in", 32, DirectionTypes::IN, flatComponent_)->port_->setTypeName("int");
+    addPort("data_out", 8, DirectionTypes::OUT, flatComponent_)->port_->setTypeName("logic");
+    addPort("enable_in", 1, DirectionTypes::IN, flatComponent_)->port_->setTypeName("std_ulogic");
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    MessagePasser messages;
+    QSignalSpy errorSpy(&messages, SIGNAL(errorMessage(QString const&)));
+
+    VHDLWriterFactory factory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+    QSharedPointer<GenerationOutput> document = factory.prepareComponent(".", flatComponent_);
+    document->write(".");
+
+    output_ = document->fileContent_;
+
+    verifyOutputContains("        count_in             : in   std_logic_vector(31 downto 0)");
+    verifyOutputContains("        data_out             : out  std_logic_vector(7 downto 0)");
+    verifyOutputContains("        enable_in            : in   std_ulogic");
+
+    QCOMPARE(errorSpy.count(), 1);
+    QVERIFY(errorSpy.first().first().toString().contains("int"));
+    QVERIFY(errorSpy.first().first().toString().contains("count_in"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testUserCodeIsKept()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testUserCodeIsKept()
+{
+    addPort("clk", 1, DirectionTypes::IN, flatComponent_);
+
+    QFile existingFile("TestComponent.vhd");
+    QVERIFY(existingFile.open(QIODevice::WriteOnly | QIODevice::Text));
+
+    QTextStream existingOutput(&existingFile);
+    existingOutput <<
+        "architecture structural of TestComponent is\n"
+        "    -- ##KACTUS2_BLACK_BOX_DECLARATIONS_BEGIN##\n"
+        "    signal counter : integer;\n"
+        "    -- ##KACTUS2_BLACK_BOX_DECLARATIONS_END##\n"
+        "begin\n"
+        "    -- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_BEGIN##\n"
+        "    counter <= 0;\n"
+        "    -- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_END##\n"
+        "end structural;\n";
+    existingFile.close();
+
+    runGenerator(false);
+
+    verifyOutputContains(
+        "    -- ##KACTUS2_BLACK_BOX_DECLARATIONS_BEGIN##\n"
+        "    signal counter : integer;\n"
+        "    -- ##KACTUS2_BLACK_BOX_DECLARATIONS_END##\n");
+
+    verifyOutputContains(
+        "    -- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_BEGIN##\n"
+        "    counter <= 0;\n"
+        "    -- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_END##\n");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testVerilogAndVHDLShareElaboration()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testVerilogAndVHDLShareElaboration()
+{
+    QSharedPointer<MetaInstance> receiverInstance = addInstanceToDesign("receiver", "TestReceiver");
+    QSharedPointer<MetaInterface> receiverIf = addInterfaceToComponent("data_if", receiverInstance);
+    addPort("data_in", 40, DirectionTypes::IN, receiverInstance, receiverIf);
+
+    QSharedPointer<MetaInterconnection> mInterconnect(new MetaInterconnection);
+    mInterconnect->name_ = "data_connection";
+    design_->getInterconnections()->append(mInterconnect);
+
+    QSharedPointer<MetaWire> dataWire = addWireToDesign("data", "39", "0", mInterconnect);
+    createPortAssignment(receiverInstance->getPorts()->value("data_in"), dataWire);
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    MessagePasser messages;
+
+    VerilogWriterFactory verilogFactory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+    VHDLWriterFactory vhdlFactory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+
+    QList<QSharedPointer<MetaDesign> > designs({ design_ });
+
+    QList<QSharedPointer<GenerationOutput> > verilogDocuments = verilogFactory.prepareDesign(designs);
+    QList<QSharedPointer<GenerationOutput> > vhdlDocuments = vhdlFactory.prepareDesign(designs);
+
+    QCOMPARE(verilogDocuments.size(), 1);
+    QCOMPARE(vhdlDocuments.size(), 1);
+
+    QCOMPARE(verilogDocuments.first()->fileName_, QString("TestComponent.v"));
+    QCOMPARE(vhdlDocuments.first()->fileName_, QString("TestComponent.vhd"));
+
+    // Both documents are written from the very same elaborated design.
+    QCOMPARE(verilogDocuments.first()->metaDesign_, design_);
+    QCOMPARE(vhdlDocuments.first()->metaDesign_, design_);
+
+    verilogDocuments.first()->write(".");
+    vhdlDocuments.first()->write(".");
+
+    QVERIFY(verilogDocuments.first()->fileContent_.contains("wire [39:0] data;"));
+    QVERIFY(vhdlDocuments.first()->fileContent_.contains("signal data                 : std_logic_vector(39 downto 0);"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testRenamedSelectionKeepsVHDLSuffix()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testRenamedSelectionKeepsVHDLSuffix()
+{
+    QFETCH(QString, selectedName);
+
+    addPort("clk", 1, DirectionTypes::IN, flatComponent_);
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    MessagePasser messages;
+
+    GenerationTuple input;
+    input.component = flatComponent_->getComponent();
+    input.messages = &messages;
+
+    VHDLWriterFactory factory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+
+    GenerationControl control(&library_, &factory, input, &settings);
+    control.getOutputControl()->setOutputPath(".");
+    control.parseDocuments();
+
+    QCOMPARE(control.getOutputControl()->getOutputs()->size(), 1);
+    QCOMPARE(control.getOutputControl()->getOutputs()->first()->fileName_, QString("TestComponent.vhd"));
+
+    control.getOutputControl()->getOutputs()->first()->fileName_ = selectedName;
+
+    QSharedPointer<GenerationOutput> renamed = control.setupRenamedSelection(0);
+
+    QCOMPARE(renamed->fileName_, QString("renamed_entity.vhd"));
+    QVERIFY(renamed->fileContent_.contains("entity renamed_entity is"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testRenamedSelectionKeepsVHDLSuffix_data()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testRenamedSelectionKeepsVHDLSuffix_data()
+{
+    QTest::addColumn<QString>("selectedName");
+
+    QTest::newRow("name with suffix") << "renamed_entity.vhd";
+    QTest::newRow("name without suffix") << "renamed_entity";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::testGenerationControlWithSeveralFactories()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::testGenerationControlWithSeveralFactories()
+{
+    addPort("clk", 1, DirectionTypes::IN, flatComponent_);
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    MessagePasser messages;
+
+    GenerationTuple input;
+    input.component = flatComponent_->getComponent();
+    input.messages = &messages;
+
+    VHDLWriterFactory vhdlFactory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+    VerilogWriterFactory verilogFactory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+
+    GenerationControl control(&library_, &vhdlFactory, input, &settings);
+    control.addWriterFactory(&verilogFactory);
+    control.getOutputControl()->setOutputPath(".");
+    control.parseDocuments();
+
+    QSharedPointer<QList<QSharedPointer<GenerationOutput> > > outputs = control.getOutputControl()->getOutputs();
+    QCOMPARE(outputs->size(), 2);
+    QCOMPARE(outputs->at(0)->fileName_, QString("TestComponent.vhd"));
+    QCOMPARE(outputs->at(1)->fileName_, QString("TestComponent.v"));
+
+    // Both documents are written from the same formatted component.
+    QCOMPARE(outputs->at(0)->metaComponent_, outputs->at(1)->metaComponent_);
+
+    // The renamed output is written again by the factory that produced it.
+    outputs->at(1)->fileName_ = "renamed_module";
+
+    QSharedPointer<GenerationOutput> renamed = control.setupRenamedSelection(1);
+
+    QCOMPARE(renamed->fileName_, QString("renamed_module.v"));
+    QVERIFY(renamed->fileContent_.contains("module renamed_module"));
+    QCOMPARE(outputs->at(0)->fileName_, QString("TestComponent.vhd"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::addPort()
+//-----------------------------------------------------------------------------
+QSharedPointer<MetaPort> tst_VHDLWriterFactory::addPort(QString const& portName, int portSize,
+    DirectionTypes::Direction direction, QSharedPointer<MetaComponent> component,
+    QSharedPointer<MetaInterface> mInterface /*= QSharedPointer<MetaInterface>()*/)
+{
+    QSharedPointer<Port> port = QSharedPointer<Port>(new Port(portName));
+    port->setDirection(direction);
+    port->setPortSize(portSize);
+
+    QSharedPointer<MetaPort> gp(new MetaPort);
+    gp->isWire_ = true;
+    gp->isTransactional_ = false;
+    gp->port_ = port;
+    gp->vectorBounds_.first = QString::number(portSize-1);
+    gp->vectorBounds_.second = "0";
+
+    component->getPorts()->insert(portName,gp);
+    component->getComponent()->getPorts()->append(port);
+
+    if (mInterface)
+    {
+        mInterface->ports_.insert(portName,gp);
+
+        QSharedPointer<PortMap> pm(new PortMap);
+        QSharedPointer<PortMap::PhysicalPort> pp(new PortMap::PhysicalPort);
+        pp->name_ = portName;
+        pm->setPhysicalPort(pp);
+
+        mInterface->interface_->getAbstractionTypes()->first()->getPortMaps()->append(pm);
+    }
+
+    return gp;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::addParameter()
+//-----------------------------------------------------------------------------
+QSharedPointer<Parameter> tst_VHDLWriterFactory::addParameter(QString const& name, QString const& value,
+    QSharedPointer<MetaComponent> mComponent)
+{
+    QSharedPointer<Parameter> parameter = QSharedPointer<Parameter>(new Parameter());
+    parameter->setName(name);
+    parameter->setValue(value);
+
+    mComponent->getMetaParameters()->append(parameter);
+
+    return parameter;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::addWireToDesign()
+//-----------------------------------------------------------------------------
+QSharedPointer<MetaWire> tst_VHDLWriterFactory::addWireToDesign(QString const& name,
+    QString const& leftBound, QString const& rightBound, QSharedPointer<MetaInterconnection> mInterconnect)
+{
+    QSharedPointer<MetaWire> gw(new MetaWire);
+    gw->name_ = name;
+    gw->bounds_.first = leftBound;
+    gw->bounds_.second = rightBound;
+
+    mInterconnect->wires_.insert(gw->name_, gw);
+
+    return gw;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::createPortAssignment()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::createPortAssignment(QSharedPointer<MetaPort> mPort, QSharedPointer<MetaWire> wire)
+{
+    QSharedPointer<MetaPortAssignment> mpa(new MetaPortAssignment);
+    mpa->logicalBounds_ = wire->bounds_;
+    mpa->physicalBounds_ = mPort->vectorBounds_;
+    mpa->wire_ = wire;
+    mpa->invert_ = false;
+
+    mPort->upAssignments_.insert(wire->name_, mpa);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::addInterfaceToComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<MetaInterface> tst_VHDLWriterFactory::addInterfaceToComponent(QString const& interfaceName,
+    QSharedPointer<MetaInstance> component)
+{
+    QSharedPointer<MetaInterface> mInterface(new MetaInterface());
+    component->getInterfaces()->insert(interfaceName,mInterface);
+
+    QSharedPointer<BusInterface> bi = QSharedPointer<BusInterface>(new BusInterface);
+    bi->setName(interfaceName);
+    mInterface->interface_ = bi;
+    component->getComponent()->getBusInterfaces()->append(bi);
+
+    QSharedPointer<AbstractionType> at = QSharedPointer<AbstractionType>(new AbstractionType);
+    bi->getAbstractionTypes()->append(at);
+
+    return mInterface;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::addInstanceToDesign()
+//-----------------------------------------------------------------------------
+QSharedPointer<MetaInstance> tst_VHDLWriterFactory::addInstanceToDesign(QString const& instanceName,
+    QString const& componentName)
+{
+    VLNV componentVLNV(VLNV::COMPONENT, "Test", "TestLibrary", componentName, "1.0");
+    QSharedPointer<Component> component(new Component(componentVLNV, Document::Revision::Std14));
+    library_.addComponent(component);
+
+    QSharedPointer<ConfigurableVLNVReference> vlnvReference(new ConfigurableVLNVReference(componentVLNV));
+    QSharedPointer<ComponentInstance> instance(new ComponentInstance(instanceName, vlnvReference));
+
+    MessagePasser messages;
+
+    QSharedPointer<MetaInstance> mInstance(new MetaInstance(instance,
+        &library_, &messages, component, QSharedPointer<View>()));
+    mInstance->parseInstance();
+
+    design_->getInstances()->insert(instanceName, mInstance);
+
+    return mInstance;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::runGenerator()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::runGenerator(bool useDesign)
+{
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    MessagePasser messages;
+
+    VHDLWriterFactory factory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+    QSharedPointer<GenerationOutput> document;
+
+    if (useDesign)
+    {
+        QList<QSharedPointer<MetaDesign> > designs({ design_ });
+        document = factory.prepareDesign(designs).first();
+    }
+    else
+    {
+        document = factory.prepareComponent(".", flatComponent_);
+    }
+
+    generationTime_ = QDateTime::currentDateTime();
+
+    document->write(".");
+
+    output_ = document->fileContent_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VHDLWriterFactory::verifyOutputContains()
+//-----------------------------------------------------------------------------
+void tst_VHDLWriterFactory::verifyOutputContains(QString const& expectedOutput)
+{
+    if (!output_.contains(expectedOutput))
+    {
+        QStringList outputLines = output_.split("\n");
+        QStringList expectedLines = expectedOutput.split("\n");
+
+        int lineOffset = outputLines.indexOf(expectedLines.first());
+        if (lineOffset == -1)
+        {
+            QCOMPARE(output_, expectedOutput);
+        }
+
+        for (int i = 0; i < expectedLines.count() && i + lineOffset < outputLines.count(); i++)
+        {
+            QCOMPARE(outputLines.at(i + lineOffset), expectedLines.at(i));
+        }
+
+        QFAIL("Expected output was not found.");
+    }
+    else if (output_.count(expectedOutput) != 1)
+    {
+        QVERIFY2(false, QString(expectedOutput + " was found " + QString::number(output_.count(expectedOutput))
+            + " times in output.").toLocal8Bit());
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_VHDLWriterFactory)
+
+#include "tst_VHDLWriterFactory.moc"
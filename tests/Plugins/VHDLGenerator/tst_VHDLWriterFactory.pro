@@ -0,0 +1,53 @@
+#-----------------------------------------------------------------------------
+# File: unittest.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author:
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file for running unit tests for VHDLWriterFactory.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+QT += core xml gui testlib
+CONFIG += c++17 testcase console
+
+DEFINES += VHDLGENERATOR_LIB VERILOGGENERATORPLUGIN_LIB
+
+CONFIG (debug, debug|release) {
+    # debug mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodelsd \
+        -L../../../executable -lKactusAPId
+
+    MOC_DIR += ./GeneratedFiles/Debug
+    DESTDIR += Debug
+    TARGET = tst_VHDLWriterFactoryd
+
+} else {
+    # release mode
+    LIBS += \
+        -L../../../executable -lIPXACTmodels \
+        -L../../../executable -lKactusAPI
+
+    MOC_DIR += ./GeneratedFiles/Release
+    DESTDIR += Release
+    TARGET = tst_VHDLWriterFactory
+}
+
+INCLUDEPATH += ../../../
+INCLUDEPATH += ../../../executable
+INCLUDEPATH += ../../../executable/Plugins
+INCLUDEPATH += ../../../KactusAPI/include
+INCLUDEPATH += .
+
+DEPENDPATH += ../../../
+DEPENDPATH += ../../../executable
+DEPENDPATH += ../../../executable/Plugins
+DEPENDPATH += .
+
+OBJECTS_DIR = $$DESTDIR
+
+include(tst_VHDLWriterFactory.pri)
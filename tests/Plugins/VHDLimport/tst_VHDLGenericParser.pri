@@ -2,6 +2,8 @@
 # This file is generated by the Qt Visual Studio Add-in.
 # ------------------------------------------------------
 
-HEADERS += ../../../Plugins/VHDLimport/VHDLGenericParser.h
+HEADERS += ../../../Plugins/VHDLimport/VHDLGenericParser.h \
+    ../../../Plugins/common/HDLLexer.h
 SOURCES += ./tst_VHDLGenericParser.cpp \
-    ../../../Plugins/VHDLimport/VHDLGenericParser.cpp
+    ../../../Plugins/VHDLimport/VHDLGenericParser.cpp \
+    ../../../Plugins/common/HDLLexer.cpp
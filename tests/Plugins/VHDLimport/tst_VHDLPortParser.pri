@@ -2,6 +2,8 @@
 # This file is generated by the Qt Visual Studio Add-in.
 # ------------------------------------------------------
 
-HEADERS += ../../../Plugins/VHDLimport/VHDLPortParser.h
+HEADERS += ../../../Plugins/VHDLimport/VHDLPortParser.h \
+    ../../../Plugins/common/HDLLexer.h
 SOURCES += ../../../Plugins/VHDLimport/VHDLPortParser.cpp \
+    ../../../Plugins/common/HDLLexer.cpp \
     ./tst_VHDLPortParser.cpp
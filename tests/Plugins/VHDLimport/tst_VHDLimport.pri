@@ -14,11 +14,13 @@ HEADERS += ../../../KactusAPI/include/ImportHighlighter.h \
     ../../../Plugins/VHDLimport/vhdlimport_global.h \
     ../../../Plugins/VHDLimport/VHDLGenericParser.h \
     ../../../Plugins/VHDLimport/VHDLPortParser.h \
+    ../../../Plugins/common/HDLLexer.h \
     ../../../Plugins/VHDLimport/VHDLimport.h
 SOURCES += ../../../KactusAPI/plugins/ImportHighlighter.cpp \
     ../../../common/NameGenerationPolicy.cpp \
     ../../../common/KactusUtils.cpp \
     ../../../Plugins/VHDLimport/VHDLGenericParser.cpp \
     ../../../Plugins/VHDLimport/VHDLPortParser.cpp \
+    ../../../Plugins/common/HDLLexer.cpp \
     ../../../Plugins/VHDLimport/VHDLimport.cpp \
     ./tst_VHDLimport.cpp
@@ -3,7 +3,9 @@
 # ------------------------------------------------------
 
 HEADERS += ../../../Plugins/VerilogImport/VerilogSyntax.h \
+HEADERS += ../../../Plugins/common/HDLLexer.h \
     ../../MockObjects/LibraryMock.h
 SOURCES += ../../MockObjects/LibraryMock.cpp \
     ../../../Plugins/VerilogImport/VerilogSyntax.cpp \
+    ../../../Plugins/common/HDLLexer.cpp \
     ./tst_ImplementationSelection.cpp
@@ -29,6 +29,7 @@ HEADERS += ../../../Plugins/VerilogGenerator/CommentWriter/CommentWriter.h \
     ../../../Plugins/VerilogGenerator/VerilogInterconnectionWriter/VerilogInterconnectionWriter.h \
     ../../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogPortWriter.h \
     ../../../Plugins/VerilogImport/VerilogSyntax.h \
+    ../../../Plugins/common/HDLLexer.h \
     ../../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogTopDefaultWriter.h \
     ../../../Plugins/VerilogGenerator/VerilogWireWriter/VerilogWireWriter.h \
     ../../../Plugins/VerilogGenerator/VerilogWriterFactory/VerilogWriterFactory.h \
@@ -56,6 +57,7 @@ SOURCES += ../../../Plugins/VerilogGenerator/CommentWriter/CommentWriter.cpp \
     ../../../Plugins/VerilogGenerator/VerilogInterconnectionWriter/VerilogInterconnectionWriter.cpp \
     ../../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogPortWriter.cpp \
     ../../../Plugins/VerilogImport/VerilogSyntax.cpp \
+    ../../../Plugins/common/HDLLexer.cpp \
     ../../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogTopDefaultWriter.cpp \
     ../../../Plugins/VerilogGenerator/VerilogWireWriter/VerilogWireWriter.cpp \
     ../../../Plugins/VerilogGenerator/VerilogWriterFactory/VerilogWriterFactory.cpp \
@@ -13,6 +13,7 @@
 #include <QSharedPointer>
 #include <QTextCursor>
 #include <QPlainTextEdit>
+#include <QTemporaryDir>
 
 #include <IPXACTmodels/Component/Component.h>
 #include <IPXACTmodels/Component/Model.h>
@@ -64,6 +65,12 @@ private slots:
     void testMacroInParameterBitWidth();
     void testMacroInParameterValue();
 
+    void testMacroDefinedInInputIsExpanded();
+    void testMacroDefinedInInputIsExpanded_data();
+    void testMacroFromIncludedFileIsExpanded();
+    void testInactiveConditionalPortIsNotImported();
+    void testInactiveConditionalPortIsNotImported_data();
+
     void testSemicolonInComments(); //<! Issue #203.
     void testAfterAssignComments();
     void testAfterAssignCommentsSemicolon();
@@ -843,6 +850,172 @@ void tst_VerilogImporter::testMacroInParameterValue()
     QCOMPARE(similarMacro->getUsageCount(), 0);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogImporter::testMacroDefinedInInputIsExpanded()
+//-----------------------------------------------------------------------------
+void tst_VerilogImporter::testMacroDefinedInInputIsExpanded()
+{
+    QFETCH(QString, fileContent);
+    QFETCH(QString, expectedValue);
+    QFETCH(QString, expectedLeftBound);
+
+    runParser(fileContent, getModuleDeclaration(fileContent));
+
+    QSharedPointer<Parameter> parameter = importComponent_->getParameters()->first();
+    QCOMPARE(parameter->name(), QString("size"));
+    QCOMPARE(parameter->getValue(), expectedValue);
+
+    QCOMPARE(importComponent_->getPorts()->size(), 1);
+    QCOMPARE(importComponent_->getPorts()->first()->getLeftBound(), expectedLeftBound);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogImporter::testMacroDefinedInInputIsExpanded_data()
+//-----------------------------------------------------------------------------
+void tst_VerilogImporter::testMacroDefinedInInputIsExpanded_data()
+{
+    QTest::addColumn<QString>("fileContent");
+    QTest::addColumn<QString>("expectedValue");
+    QTest::addColumn<QString>("expectedLeftBound");
+
+    QTest::newRow("Object-like macro") <<
+        "`define WIDTH 8\n"
+        "module test #(\n"
+        "   parameter int size = `WIDTH\n"
+        ") (\n"
+        "   input [`WIDTH-1:0] data\n"
+        ");\n"
+        "endmodule"
+        << "8" << "8-1";
+
+    QTest::newRow("Function-like macro with a default argument") <<
+        "`define SUM(a, b=1) (a+b)\n"
+        "module test #(\n"
+        "   parameter int size = `SUM(2)\n"
+        ") (\n"
+        "   input [`SUM(3, 4):0] data\n"
+        ");\n"
+        "endmodule"
+        << "(2+1)" << "(3+4)";
+
+    QTest::newRow("Macro defined in an active branch") <<
+        "`ifdef WIDE\n"
+        "`define WIDTH 64\n"
+        "`else\n"
+        "`define WIDTH 32\n"
+        "`endif\n"
+        "module test #(\n"
+        "   parameter int size = `WIDTH\n"
+        ") (\n"
+        "   input [`WIDTH-1:0] data\n"
+        ");\n"
+        "endmodule"
+        << "32" << "32-1";
+
+    QTest::newRow("Unknown macro is kept") <<
+        "module test #(\n"
+        "   parameter int size = `UNKNOWN\n"
+        ") (\n"
+        "   input [`UNKNOWN:0] data\n"
+        ");\n"
+        "endmodule"
+        << "`UNKNOWN" << "`UNKNOWN";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogImporter::testMacroFromIncludedFileIsExpanded()
+//-----------------------------------------------------------------------------
+void tst_VerilogImporter::testMacroFromIncludedFileIsExpanded()
+{
+    QTemporaryDir includeDirectory;
+    QVERIFY(includeDirectory.isValid());
+
+    QFile includeFile(includeDirectory.filePath("defines.vh"));
+    QVERIFY(includeFile.open(QIODevice::WriteOnly));
+    includeFile.write("`define DEPTH 4\n");
+    includeFile.close();
+
+    QString fileContent(
+        "`include \"defines.vh\"\n"
+        "module test #(\n"
+        "   parameter int size = `DEPTH\n"
+        ") ();\n"
+        "endmodule");
+
+    importer_.setInputLocation(QDir(QDir::tempPath()).filePath("test.v"), { includeDirectory.path() });
+    runParser(fileContent, getModuleDeclaration(fileContent));
+
+    QSharedPointer<Parameter> parameter = importComponent_->getParameters()->first();
+    QCOMPARE(parameter->name(), QString("size"));
+    QCOMPARE(parameter->getValue(), QString("4"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogImporter::testInactiveConditionalPortIsNotImported()
+//-----------------------------------------------------------------------------
+void tst_VerilogImporter::testInactiveConditionalPortIsNotImported()
+{
+    QFETCH(QString, fileContent);
+    QFETCH(QStringList, expectedPorts);
+
+    runParser(fileContent, getModuleDeclaration(fileContent));
+
+    QStringList importedPorts;
+    for (QSharedPointer<Port> port : *importComponent_->getPorts())
+    {
+        importedPorts.append(port->name());
+    }
+
+    QCOMPARE(importedPorts, expectedPorts);
+
+    // The highlight positions are unaffected by the blanked inactive code.
+    QString lastPort = "input " + expectedPorts.last();
+    int begin = fileContent.indexOf(lastPort);
+    verifyDeclarationIsHighlighted(begin, lastPort.length(), KactusColors::Importer::PORT);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogImporter::testInactiveConditionalPortIsNotImported_data()
+//-----------------------------------------------------------------------------
+void tst_VerilogImporter::testInactiveConditionalPortIsNotImported_data()
+{
+    QTest::addColumn<QString>("fileContent");
+    QTest::addColumn<QStringList>("expectedPorts");
+
+    QTest::newRow("Undefined condition") <<
+        "module test (\n"
+        "    input clk\n"
+        "    `ifdef EXTERNAL_RESET\n"
+        "    ,input rst_n\n"
+        "    `endif\n"
+        "    );\n"
+        "endmodule"
+        << QStringList({ "clk" });
+
+    QTest::newRow("Defined condition") <<
+        "`define EXTERNAL_RESET\n"
+        "module test (\n"
+        "    input clk\n"
+        "    `ifdef EXTERNAL_RESET\n"
+        "    ,input rst_n\n"
+        "    `endif\n"
+        "    );\n"
+        "endmodule"
+        << QStringList({ "clk", "rst_n" });
+
+    QTest::newRow("Else branch") <<
+        "module test (\n"
+        "    input clk,\n"
+        "    `ifdef EXTERNAL_RESET\n"
+        "    input rst_n\n"
+        "    `else\n"
+        "    input reset\n"
+        "    `endif\n"
+        "    );\n"
+        "endmodule"
+        << QStringList({ "clk", "reset" });
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogImporter::testSemicolonInComments()
 //-----------------------------------------------------------------------------
@@ -14,6 +14,8 @@ HEADERS += ../../../KactusAPI/include/ExpressionParser.h \
     ../../../Plugins/VerilogImport/VerilogInstanceParser.h \
     ../../../Plugins/VerilogImport/VerilogParameterParser.h \
     ../../../Plugins/VerilogImport/VerilogPortParser.h \
+    ../../../Plugins/VerilogImport/VerilogPreprocessor.h \
+    ../../../Plugins/common/HDLLexer.h \
     ../../../common/expressions/utilities.h \
     ../../../KactusAPI/include/ImportHighlighter.h \
     ../../../Plugins/VerilogImport/VerilogImporter.h
@@ -23,6 +25,8 @@ SOURCES += ../../../KactusAPI/plugins/ImportHighlighter.cpp \
     ../../../Plugins/VerilogImport/VerilogInstanceParser.cpp \
     ../../../Plugins/VerilogImport/VerilogParameterParser.cpp \
     ../../../Plugins/VerilogImport/VerilogPortParser.cpp \
+    ../../../Plugins/VerilogImport/VerilogPreprocessor.cpp \
     ../../../Plugins/VerilogImport/VerilogSyntax.cpp \
+    ../../../Plugins/common/HDLLexer.cpp \
     ../../../common/expressions/utilities.cpp \
     ./tst_VerilogImporter.cpp
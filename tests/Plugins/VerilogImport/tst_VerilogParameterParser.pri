@@ -5,8 +5,10 @@
 HEADERS += ../../../KactusAPI/include/ExpressionParser.h \
     ../../../Plugins/VerilogImport/VerilogParameterParser.h \
     ../../../Plugins/VerilogImport/VerilogSyntax.h \
+    ../../../Plugins/common/HDLLexer.h \
     ../../../common/expressions/utilities.h
 SOURCES += ../../../Plugins/VerilogImport/VerilogParameterParser.cpp \
     ../../../Plugins/VerilogImport/VerilogSyntax.cpp \
+    ../../../Plugins/common/HDLLexer.cpp \
     ../../../common/expressions/utilities.cpp \
     ./tst_VerilogParameterParser.cpp
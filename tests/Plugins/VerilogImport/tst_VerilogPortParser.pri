@@ -9,7 +9,9 @@ message("You are running qmake on a generated .pro file. This may not work!")
 
 HEADERS += ../../../Plugins/VerilogImport/VerilogPortParser.h \
     ../../../Plugins/VerilogImport/VerilogSyntax.h \
+    ../../../Plugins/common/HDLLexer.h \
     ../../../common/expressions/utilities.h
 SOURCES += ../../../Plugins/VerilogImport/VerilogPortParser.cpp \
+SOURCES += ../../../Plugins/common/HDLLexer.cpp \
     ./tst_VerilogPortParser.cpp \
     ../../../common/expressions/utilities.cpp
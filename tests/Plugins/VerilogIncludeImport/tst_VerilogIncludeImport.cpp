@@ -12,8 +12,10 @@
 #include <QtTest>
 
 #include <QPlainTextEdit>
+#include <QTemporaryDir>
 
 #include <Plugins/VerilogIncludeImport/VerilogIncludeImport.h>
+#include <Plugins/VerilogImport/VerilogPreprocessor.h>
 #include <KactusAPI/include/KactusColors.h>
 
 #include <KactusAPI/include/ImportHighlighter.h>
@@ -58,6 +60,12 @@ private slots:
 
     void testExistingParameterIsUpdated();
 
+    void testConditionalDefinitions();
+    void testConditionalDefinitions_data();
+
+    void testIncludedDefinitionsAreUsed();
+    void testMacrosAreExpanded();
+
 private:
     void runParser(QString const& input);
 
@@ -416,6 +424,156 @@ void tst_VerilogIncludeImport::testExistingParameterIsUpdated()
         QString("This parameter has been updated."));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogIncludeImport::testConditionalDefinitions()
+//-----------------------------------------------------------------------------
+void tst_VerilogIncludeImport::testConditionalDefinitions()
+{
+    QFETCH(QString, input);
+    QFETCH(QString, expectedValue);
+
+    runParser(input);
+
+    QSharedPointer<Parameter> width = importComponent_->getParameters()->last();
+    QCOMPARE(width->name(), QString("WIDTH"));
+    QCOMPARE(width->getValue(), expectedValue);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogIncludeImport::testConditionalDefinitions_data()
+//-----------------------------------------------------------------------------
+void tst_VerilogIncludeImport::testConditionalDefinitions_data()
+{
+    QTest::addColumn<QString>("input");
+    QTest::addColumn<QString>("expectedValue");
+
+    QTest::newRow("Defined branch is taken") <<
+        "`define FAST\n"
+        "`ifdef FAST\n"
+        "`define WIDTH 64\n"
+        "`else\n"
+        "`define WIDTH 32\n"
+        "`endif\n"
+        << "64";
+
+    QTest::newRow("Else branch is taken") <<
+        "`ifdef FAST\n"
+        "`define WIDTH 64\n"
+        "`else\n"
+        "`define WIDTH 32\n"
+        "`endif\n"
+        << "32";
+
+    QTest::newRow("Elsif branch is taken") <<
+        "`define MEDIUM\n"
+        "`undef MEDIUM\n"
+        "`define SLOW\n"
+        "`ifndef SLOW\n"
+        "`define WIDTH 64\n"
+        "`elsif SLOW\n"
+        "`define WIDTH 8\n"
+        "`else\n"
+        "`define WIDTH 32\n"
+        "`endif\n"
+        << "8";
+
+    QTest::newRow("Nested conditions inside inactive branch") <<
+        "`ifdef FAST\n"
+        "`ifdef WIDE\n"
+        "`define WIDTH 128\n"
+        "`else\n"
+        "`define WIDTH 64\n"
+        "`endif\n"
+        "`else\n"
+        "`define WIDTH 32\n"
+        "`endif\n"
+        << "32";
+
+    QTest::newRow("Parameter in inactive branch is not parsed") <<
+        "`ifdef FAST\n"
+        "parameter WIDTH = 64;\n"
+        "`else\n"
+        "parameter WIDTH = 32;\n"
+        "`endif\n"
+        << "32";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogIncludeImport::testIncludedDefinitionsAreUsed()
+//-----------------------------------------------------------------------------
+void tst_VerilogIncludeImport::testIncludedDefinitionsAreUsed()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    QVERIFY(QDir(directory.path()).mkdir("include"));
+
+    QFile options(directory.filePath("options.vh"));
+    QVERIFY(options.open(QIODevice::WriteOnly));
+    options.write("`include \"features.vh\"\n");
+    options.close();
+
+    // The recursive inclusion of options.vh is ignored.
+    QFile features(directory.filePath("include/features.vh"));
+    QVERIFY(features.open(QIODevice::WriteOnly));
+    features.write("`define FAST\n`include \"../options.vh\"\n");
+    features.close();
+
+    QString input =
+        "`include \"options.vh\"\n"
+        "`ifdef FAST\n"
+        "`define WIDTH 64\n"
+        "`else\n"
+        "`define WIDTH 32\n"
+        "`endif\n";
+
+    displayEditor_.setPlainText(input);
+
+    VerilogIncludeImport parser;
+    parser.setHighlighter(highlighter_);
+    parser.setInputLocation(directory.filePath("top.v"), QStringList(directory.filePath("include")));
+    parser.import(input, input, importComponent_);
+
+    QCOMPARE(importComponent_->getParameters()->count(), 1);
+    QCOMPARE(importComponent_->getParameters()->first()->name(), QString("WIDTH"));
+    QCOMPARE(importComponent_->getParameters()->first()->getValue(), QString("64"));
+
+    // Without the location, options.vh is not found from the include directories.
+    importComponent_->getParameters()->clear();
+    parser.import(input, input, importComponent_);
+
+    QCOMPARE(importComponent_->getParameters()->count(), 1);
+    QCOMPARE(importComponent_->getParameters()->first()->getValue(), QString("32"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogIncludeImport::testMacrosAreExpanded()
+//-----------------------------------------------------------------------------
+void tst_VerilogIncludeImport::testMacrosAreExpanded()
+{
+    QString input =
+        "`define WIDTH 8\n"
+        "`define MAX(a, b = 0) ((a) > (b) ? (a) : (b))\n"
+        "`define NAME(prefix) prefix``_data\n"
+        "`define MESSAGE(text) `\"text`\"\n"
+        "wire [`MAX(`WIDTH, (4, 2))-1:0] `NAME(bus);\n"
+        "assign x = `MAX(y, );\n"
+        "initial $display(`MESSAGE(ready));\n"
+        "`undef WIDTH\n"
+        "`WIDTH\n";
+
+    VerilogPreprocessor preprocessor;
+    QString output = preprocessor.preprocess(input);
+
+    QVERIFY(output.contains("wire [((8) > ((4, 2)) ? (8) : ((4, 2)))-1:0] bus_data;"));
+    QVERIFY(output.contains("assign x = ((y) > (0) ? (y) : (0));"));
+    QVERIFY(output.contains("initial $display(\"ready\");"));
+    QVERIFY(output.contains("`WIDTH"));
+    QVERIFY(output.contains("`define") == false);
+
+    QCOMPARE(preprocessor.getDefinitions().count(), 4);
+    QVERIFY(preprocessor.getMacros().contains("WIDTH") == false);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogIncludeImport::runParser()
 //-----------------------------------------------------------------------------
@@ -9,12 +9,16 @@ message("You are running qmake on a generated .pro file. This may not work!")
 
 HEADERS += ../../../IPXACTmodels/utilities/Search.h \
     ../../../Plugins/VerilogImport/VerilogParameterParser.h \
+    ../../../Plugins/VerilogImport/VerilogPreprocessor.h \
+    ../../../Plugins/common/HDLLexer.h \
     ../../../common/expressions/utilities.h \
     ../../../Plugins/VerilogIncludeImport/verilogincludeimport_global.h \
     ../../../Plugins/VerilogIncludeImport/VerilogIncludeImport.h \
     ../../../KactusAPI/include/ImportHighlighter.h
 SOURCES += ../../../Plugins/VerilogIncludeImport/VerilogIncludeImport.cpp \
     ../../../Plugins/VerilogImport/VerilogParameterParser.cpp \
+    ../../../Plugins/VerilogImport/VerilogPreprocessor.cpp \
+    ../../../Plugins/common/HDLLexer.cpp \
     ../../../Plugins/VerilogImport/VerilogSyntax.cpp \
     ../../../common/expressions/utilities.cpp \
     ./tst_VerilogIncludeImport.cpp \
@@ -0,0 +1,443 @@
+//-----------------------------------------------------------------------------
+// File: StructuralDiff.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Finds the differences between IP-XACT documents and libraries using structural hashes.
+//-----------------------------------------------------------------------------
+
+#include "StructuralDiff.h"
+
+#include "StructuralHashTree.h"
+
+#include <IPXACTmodels/common/Document.h>
+
+#include <QDir>
+#include <QDirIterator>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QObject>
+#include <QRunnable>
+#include <QThreadPool>
+
+namespace
+{
+    /*!
+     *  Creates the labels used to match the children of a node. Named children are labeled by element and name,
+     *  unnamed children by element and their index among the unnamed children of the same element.
+     *
+     *    @param [in] tree            The tree containing the node.
+     *    @param [in] index           Index of the parent node.
+     *    @param [out] labels         The labels in child order. Duplicate labels are left empty.
+     *    @param [out] labelIndexes   The child node indexes by label.
+     */
+    void labelChildren(StructuralHashTree const& tree, int index, QVector<QString>& labels,
+        QHash<QString, int>& labelIndexes);
+
+    /*!
+     *  Creates a change for an element found only in the reference or the subject.
+     *
+     *    @param [in] type        The change type.
+     *    @param [in] node        The added or removed node.
+     *    @param [in] path        Path to the node.
+     *    @param [in] document    VLNV of the document.
+     *
+     *    @return The change.
+     */
+    StructuralDiff::Change createChange(IPXactDiff::DiffType type, StructuralHashTree::Node const& node,
+        QString const& path, QString const& document);
+
+    /*!
+     *  Finds the differences between two matched nodes and their children.
+     *
+     *    @param [in] reference       The reference tree.
+     *    @param [in] referenceIndex  Index of the node in the reference tree.
+     *    @param [in] subject         The subject tree.
+     *    @param [in] subjectIndex    Index of the node in the subject tree.
+     *    @param [in] path            Path to the nodes.
+     *    @param [in] document        VLNV of the document.
+     *    @param [in/out] changes     The found changes.
+     */
+    void compareNodes(StructuralHashTree const& reference, int referenceIndex,
+        StructuralHashTree const& subject, int subjectIndex, QString const& path, QString const& document,
+        QVector<StructuralDiff::Change>& changes);
+
+    /*!
+     *  Reads the XML files in a library directory in parallel and indexes them by VLNV.
+     *
+     *    @param [in] root            The library directory.
+     *    @param [out] trees          The hash trees of the documents.
+     *    @param [in/out] errors      Errors found while reading the documents.
+     *
+     *    @return The tree indexes by document VLNV.
+     */
+    QMap<QString, int> readLibrary(QString const& root, QVector<StructuralHashTree>& trees, QStringList& errors);
+
+    //-----------------------------------------------------------------------------
+    // Function: labelChildren()
+    //-----------------------------------------------------------------------------
+    void labelChildren(StructuralHashTree const& tree, int index, QVector<QString>& labels,
+        QHash<QString, int>& labelIndexes)
+    {
+        QVector<int> const& children = tree.getNode(index).children_;
+
+        QHash<QString, int> unnamedCounts;
+        for (int childIndex : children)
+        {
+            StructuralHashTree::Node const& child = tree.getNode(childIndex);
+            if (child.name_.isEmpty())
+            {
+                unnamedCounts[child.element_]++;
+            }
+        }
+
+        labels.reserve(children.size());
+        labelIndexes.reserve(children.size());
+
+        QHash<QString, int> unnamedIndexes;
+        for (int childIndex : children)
+        {
+            StructuralHashTree::Node const& child = tree.getNode(childIndex);
+
+            QString label = child.element_;
+            if (child.name_.isEmpty() == false)
+            {
+                label.append(QLatin1Char('[') + child.name_ + QLatin1Char(']'));
+            }
+            else if (unnamedCounts.value(child.element_) > 1)
+            {
+                label.append(QLatin1Char('[') + QString::number(unnamedIndexes[child.element_]++) +
+                    QLatin1Char(']'));
+            }
+
+            // Duplicate names are invalid in IP-XACT, keep the first occurrence.
+            if (labelIndexes.contains(label))
+            {
+                label.clear();
+            }
+            else
+            {
+                labelIndexes.insert(label, childIndex);
+            }
+
+            labels.append(label);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: createChange()
+    //-----------------------------------------------------------------------------
+    StructuralDiff::Change createChange(IPXactDiff::DiffType type, StructuralHashTree::Node const& node,
+        QString const& path, QString const& document)
+    {
+        StructuralDiff::Change change;
+        change.type_ = type;
+        change.document_ = document;
+        change.path_ = path;
+        change.element_ = node.element_;
+        change.name_ = node.name_;
+
+        if (type == IPXactDiff::REMOVE)
+        {
+            change.previousValue_ = node.value_;
+        }
+        else
+        {
+            change.newValue_ = node.value_;
+        }
+
+        return change;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: compareNodes()
+    //-----------------------------------------------------------------------------
+    void compareNodes(StructuralHashTree const& reference, int referenceIndex,
+        StructuralHashTree const& subject, int subjectIndex, QString const& path, QString const& document,
+        QVector<StructuralDiff::Change>& changes)
+    {
+        StructuralHashTree::Node const& referenceNode = reference.getNode(referenceIndex);
+        StructuralHashTree::Node const& subjectNode = subject.getNode(subjectIndex);
+
+        if (referenceNode.hash_ == subjectNode.hash_)
+        {
+            return;
+        }
+
+        if (referenceNode.value_ != subjectNode.value_)
+        {
+            StructuralDiff::Change change = createChange(IPXactDiff::MODIFICATION, subjectNode, path, document);
+            change.previousValue_ = referenceNode.value_;
+            changes.append(change);
+        }
+
+        QVector<QString> referenceLabels;
+        QHash<QString, int> referenceChildren;
+        labelChildren(reference, referenceIndex, referenceLabels, referenceChildren);
+
+        QVector<QString> subjectLabels;
+        QHash<QString, int> subjectChildren;
+        labelChildren(subject, subjectIndex, subjectLabels, subjectChildren);
+
+        QString const childPrefix = path.isEmpty() ? QString() : path + QLatin1Char('/');
+
+        // Report in document order for readable output.
+        for (int i = 0; i < referenceNode.children_.size(); ++i)
+        {
+            int childIndex = referenceNode.children_.at(i);
+            QString const& label = referenceLabels.at(i);
+            if (label.isEmpty())
+            {
+                continue;
+            }
+
+            auto subjectChild = subjectChildren.constFind(label);
+            if (subjectChild == subjectChildren.constEnd())
+            {
+                changes.append(createChange(IPXactDiff::REMOVE, reference.getNode(childIndex),
+                    childPrefix + label, document));
+            }
+            else
+            {
+                compareNodes(reference, childIndex, subject, subjectChild.value(), childPrefix + label, document,
+                    changes);
+            }
+        }
+
+        for (int i = 0; i < subjectNode.children_.size(); ++i)
+        {
+            QString const& label = subjectLabels.at(i);
+            if (label.isEmpty() == false && referenceChildren.contains(label) == false)
+            {
+                changes.append(createChange(IPXactDiff::ADD, subject.getNode(subjectNode.children_.at(i)),
+                    childPrefix + label, document));
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: readLibrary()
+    //-----------------------------------------------------------------------------
+    QMap<QString, int> readLibrary(QString const& root, QVector<StructuralHashTree>& trees, QStringList& errors)
+    {
+        QStringList paths;
+        QDirIterator files(root, QStringList(QStringLiteral("*.xml")), QDir::Files, QDirIterator::Subdirectories);
+        while (files.hasNext())
+        {
+            paths.append(files.next());
+        }
+        paths.sort();
+
+        trees.clear();
+        trees.resize(paths.size());
+
+        QStringList readErrors;
+        QMutex errorMutex;
+
+        // Each task writes only its own tree, so only the error list is shared.
+        QThreadPool readers;
+        for (int i = 0; i < paths.size(); ++i)
+        {
+            QString const path = paths.at(i);
+            StructuralHashTree* tree = &trees[i];
+
+            readers.start(QRunnable::create([path, tree, &readErrors, &errorMutex]()
+                {
+                    if (tree->readFile(path) == false)
+                    {
+                        QMutexLocker errorLock(&errorMutex);
+                        readErrors.append(QObject::tr("Could not read file %1: %2").arg(path,
+                            tree->getErrorString()));
+                    }
+                }));
+        }
+
+        readers.waitForDone();
+
+        readErrors.sort();
+        errors.append(readErrors);
+
+        QMap<QString, int> documents;
+        for (int i = 0; i < trees.size(); ++i)
+        {
+            QString vlnv = trees.at(i).getVLNV();
+            if (vlnv.isEmpty())
+            {
+                continue;
+            }
+
+            if (documents.contains(vlnv))
+            {
+                errors.append(QObject::tr("VLNV %1 was found in several files, ignoring %2.").arg(vlnv,
+                    paths.at(i)));
+            }
+            else
+            {
+                documents.insert(vlnv, i);
+            }
+        }
+
+        return documents;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralDiff::compareTrees()
+//-----------------------------------------------------------------------------
+QVector<StructuralDiff::Change> StructuralDiff::compareTrees(StructuralHashTree const& reference,
+    StructuralHashTree const& subject, QString const& document)
+{
+    QVector<Change> changes;
+
+    if (reference.isEmpty() && subject.isEmpty())
+    {
+        return changes;
+    }
+    else if (reference.isEmpty())
+    {
+        changes.append(createChange(IPXactDiff::ADD, subject.getNode(0), QString(), document));
+    }
+    else if (subject.isEmpty())
+    {
+        changes.append(createChange(IPXactDiff::REMOVE, reference.getNode(0), QString(), document));
+    }
+    else if (reference.getNode(0).element_ != subject.getNode(0).element_)
+    {
+        changes.append(createChange(IPXactDiff::REMOVE, reference.getNode(0), QString(), document));
+        changes.append(createChange(IPXactDiff::ADD, subject.getNode(0), QString(), document));
+    }
+    else
+    {
+        compareNodes(reference, 0, subject, 0, QString(), document, changes);
+    }
+
+    return changes;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralDiff::compareDocuments()
+//-----------------------------------------------------------------------------
+QVector<StructuralDiff::Change> StructuralDiff::compareDocuments(QSharedPointer<Document> reference,
+    QSharedPointer<Document> subject)
+{
+    StructuralHashTree referenceTree;
+    if (reference.isNull() == false)
+    {
+        referenceTree.readDocument(reference);
+    }
+
+    StructuralHashTree subjectTree;
+    if (subject.isNull() == false)
+    {
+        subjectTree.readDocument(subject);
+    }
+
+    QString document = subject.isNull() ? referenceTree.getVLNV() : subjectTree.getVLNV();
+    return compareTrees(referenceTree, subjectTree, document);
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralDiff::compareLibraries()
+//-----------------------------------------------------------------------------
+QVector<StructuralDiff::Change> StructuralDiff::compareLibraries(QString const& referenceRoot,
+    QString const& subjectRoot, QStringList& errors)
+{
+    QVector<StructuralHashTree> referenceTrees;
+    QMap<QString, int> referenceDocuments = readLibrary(referenceRoot, referenceTrees, errors);
+
+    QVector<StructuralHashTree> subjectTrees;
+    QMap<QString, int> subjectDocuments = readLibrary(subjectRoot, subjectTrees, errors);
+
+    QVector<Change> changes;
+    for (auto it = referenceDocuments.cbegin(); it != referenceDocuments.cend(); ++it)
+    {
+        StructuralHashTree const& referenceTree = referenceTrees.at(it.value());
+
+        auto subjectDocument = subjectDocuments.constFind(it.key());
+        if (subjectDocument == subjectDocuments.constEnd())
+        {
+            changes.append(createChange(IPXactDiff::REMOVE, referenceTree.getNode(0), QString(), it.key()));
+        }
+        else
+        {
+            changes.append(compareTrees(referenceTree, subjectTrees.at(subjectDocument.value()), it.key()));
+        }
+    }
+
+    for (auto it = subjectDocuments.cbegin(); it != subjectDocuments.cend(); ++it)
+    {
+        if (referenceDocuments.contains(it.key()) == false)
+        {
+            changes.append(createChange(IPXactDiff::ADD, subjectTrees.at(it.value()).getNode(0), QString(),
+                it.key()));
+        }
+    }
+
+    return changes;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralDiff::changeTypeName()
+//-----------------------------------------------------------------------------
+QString StructuralDiff::changeTypeName(IPXactDiff::DiffType type)
+{
+    if (type == IPXactDiff::ADD)
+    {
+        return QStringLiteral("add");
+    }
+    else if (type == IPXactDiff::REMOVE)
+    {
+        return QStringLiteral("remove");
+    }
+    else if (type == IPXactDiff::MODIFICATION)
+    {
+        return QStringLiteral("modification");
+    }
+
+    return QStringLiteral("none");
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralDiff::toJson()
+//-----------------------------------------------------------------------------
+QJsonDocument StructuralDiff::toJson(QVector<Change> const& changes)
+{
+    QJsonArray changeArray;
+    for (Change const& change : changes)
+    {
+        QJsonObject changeObject;
+        changeObject.insert(QStringLiteral("type"), changeTypeName(change.type_));
+        changeObject.insert(QStringLiteral("document"), change.document_);
+        changeObject.insert(QStringLiteral("path"), change.path_);
+        changeObject.insert(QStringLiteral("element"), change.element_);
+
+        if (change.name_.isEmpty() == false)
+        {
+            changeObject.insert(QStringLiteral("name"), change.name_);
+        }
+
+        if (change.type_ != IPXactDiff::ADD)
+        {
+            changeObject.insert(QStringLiteral("previousValue"), change.previousValue_);
+        }
+
+        if (change.type_ != IPXactDiff::REMOVE)
+        {
+            changeObject.insert(QStringLiteral("newValue"), change.newValue_);
+        }
+
+        changeArray.append(changeObject);
+    }
+
+    QJsonObject root;
+    root.insert(QStringLiteral("changes"), changeArray);
+
+    return QJsonDocument(root);
+}
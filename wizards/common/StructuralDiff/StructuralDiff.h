@@ -0,0 +1,113 @@
+//-----------------------------------------------------------------------------
+// File: StructuralDiff.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Finds the differences between IP-XACT documents and libraries using structural hashes.
+//-----------------------------------------------------------------------------
+
+#ifndef STRUCTURALDIFF_H
+#define STRUCTURALDIFF_H
+
+#include <wizards/common/IPXactDiff.h>
+
+#include <QJsonDocument>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class Document;
+class StructuralHashTree;
+
+//-----------------------------------------------------------------------------
+//! Finds the differences between IP-XACT documents and libraries using structural hashes.
+//!
+//! Elements are matched by their element name and their name or instanceName, so reordering elements is not
+//! reported as a change. Subtrees with equal hashes are skipped without visiting their elements.
+//-----------------------------------------------------------------------------
+namespace StructuralDiff
+{
+    //! A single difference between the reference and the subject.
+    struct Change
+    {
+        //! The type of the change.
+        IPXactDiff::DiffType type_ = IPXactDiff::NO_CHANGE;
+
+        //! VLNV of the changed document.
+        QString document_;
+
+        //! Path to the changed element, e.g. memoryMaps/memoryMap[cpu]/addressBlock[regs]/register[ctrl].
+        QString path_;
+
+        //! The changed element, e.g. register.
+        QString element_;
+
+        //! The name of the changed element, if any.
+        QString name_;
+
+        //! The value of the element in the reference.
+        QString previousValue_;
+
+        //! The value of the element in the subject.
+        QString newValue_;
+    };
+
+    /*!
+     *  Finds the differences between two hash trees.
+     *
+     *    @param [in] reference   The reference tree to compare to.
+     *    @param [in] subject     The tree to compare against the reference.
+     *    @param [in] document    VLNV of the compared document for the changes.
+     *
+     *    @return The differences between the reference and subject.
+     */
+    QVector<Change> compareTrees(StructuralHashTree const& reference, StructuralHashTree const& subject,
+        QString const& document = QString());
+
+    /*!
+     *  Finds the differences between two document models.
+     *
+     *    @param [in] reference   The reference document to compare to.
+     *    @param [in] subject     The document to compare against the reference.
+     *
+     *    @return The differences between the reference and subject.
+     */
+    QVector<Change> compareDocuments(QSharedPointer<Document> reference, QSharedPointer<Document> subject);
+
+    /*!
+     *  Finds the differences between the IP-XACT documents in two library directories. Documents are matched
+     *  by their VLNV.
+     *
+     *    @param [in] referenceRoot   The reference library directory.
+     *    @param [in] subjectRoot     The library directory to compare against the reference.
+     *    @param [out] errors         Errors found while reading the documents.
+     *
+     *    @return The differences between the reference and subject libraries.
+     */
+    QVector<Change> compareLibraries(QString const& referenceRoot, QString const& subjectRoot,
+        QStringList& errors);
+
+    /*!
+     *  Gets a name for a change type.
+     *
+     *    @param [in] type    The change type.
+     *
+     *    @return The name of the change type.
+     */
+    QString changeTypeName(IPXactDiff::DiffType type);
+
+    /*!
+     *  Converts changes into a JSON document.
+     *
+     *    @param [in] changes     The changes to convert.
+     *
+     *    @return JSON document listing the changes.
+     */
+    QJsonDocument toJson(QVector<Change> const& changes);
+}
+
+#endif // STRUCTURALDIFF_H
@@ -0,0 +1,227 @@
+//-----------------------------------------------------------------------------
+// File: StructuralHashTree.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Tree of structural hashes for the elements of an IP-XACT document.
+//-----------------------------------------------------------------------------
+
+#include "StructuralHashTree.h"
+
+#include <KactusAPI/include/DocumentFileAccess.h>
+
+#include <IPXACTmodels/common/Document.h>
+
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QFile>
+#include <QObject>
+#include <QStack>
+#include <QStringList>
+#include <QXmlStreamReader>
+
+namespace
+{
+    const QByteArray SEPARATOR(1, '\0');
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::read()
+//-----------------------------------------------------------------------------
+bool StructuralHashTree::read(QIODevice* device)
+{
+    nodes_.clear();
+    errorString_.clear();
+
+    QXmlStreamReader reader(device);
+    QStack<int> openNodes;
+
+    while (reader.atEnd() == false)
+    {
+        reader.readNext();
+
+        if (reader.isStartElement())
+        {
+            int index = nodes_.size();
+            nodes_.append(Node());
+            nodes_[index].element_ = reader.name().toString();
+
+            if (openNodes.isEmpty() == false)
+            {
+                nodes_[openNodes.top()].children_.append(index);
+            }
+
+            for (QXmlStreamAttribute const& attribute : reader.attributes())
+            {
+                Node attributeNode;
+                attributeNode.element_ = QStringLiteral("@") + attribute.name().toString();
+                attributeNode.value_ = attribute.value().toString();
+
+                nodes_[index].children_.append(nodes_.size());
+                nodes_.append(attributeNode);
+                finishNode(nodes_.size() - 1);
+            }
+
+            openNodes.push(index);
+        }
+        else if (reader.isCharacters() && reader.isWhitespace() == false && openNodes.isEmpty() == false)
+        {
+            nodes_[openNodes.top()].value_.append(reader.text());
+        }
+        else if (reader.isEndElement() && openNodes.isEmpty() == false)
+        {
+            finishNode(openNodes.pop());
+        }
+    }
+
+    if (reader.hasError())
+    {
+        errorString_ = reader.errorString();
+        nodes_.clear();
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::readFile()
+//-----------------------------------------------------------------------------
+bool StructuralHashTree::readFile(QString const& path)
+{
+    QFile file(path);
+    if (file.open(QIODevice::ReadOnly) == false)
+    {
+        nodes_.clear();
+        errorString_ = file.errorString();
+        return false;
+    }
+
+    return read(&file);
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::readDocument()
+//-----------------------------------------------------------------------------
+bool StructuralHashTree::readDocument(QSharedPointer<Document> document)
+{
+    QByteArray contents = DocumentFileAccess::serializeDocument(document);
+    if (contents.isEmpty())
+    {
+        nodes_.clear();
+        errorString_ = QObject::tr("Unknown document type.");
+        return false;
+    }
+
+    QBuffer buffer(&contents);
+    buffer.open(QIODevice::ReadOnly);
+
+    return read(&buffer);
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::isEmpty()
+//-----------------------------------------------------------------------------
+bool StructuralHashTree::isEmpty() const
+{
+    return nodes_.isEmpty();
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::getNode()
+//-----------------------------------------------------------------------------
+StructuralHashTree::Node const& StructuralHashTree::getNode(int index) const
+{
+    return nodes_.at(index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::getRootHash()
+//-----------------------------------------------------------------------------
+QByteArray StructuralHashTree::getRootHash() const
+{
+    if (nodes_.isEmpty())
+    {
+        return QByteArray();
+    }
+
+    return nodes_.first().hash_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::getVLNV()
+//-----------------------------------------------------------------------------
+QString StructuralHashTree::getVLNV() const
+{
+    if (nodes_.isEmpty())
+    {
+        return QString();
+    }
+
+    QStringList vlnvParts({
+        findChildValue(0, QStringLiteral("vendor")),
+        findChildValue(0, QStringLiteral("library")),
+        findChildValue(0, QStringLiteral("name")),
+        findChildValue(0, QStringLiteral("version")) });
+
+    if (vlnvParts.contains(QString()))
+    {
+        return QString();
+    }
+
+    return vlnvParts.join(QLatin1Char(':'));
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::getErrorString()
+//-----------------------------------------------------------------------------
+QString StructuralHashTree::getErrorString() const
+{
+    return errorString_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::finishNode()
+//-----------------------------------------------------------------------------
+void StructuralHashTree::finishNode(int index)
+{
+    Node& node = nodes_[index];
+    node.name_ = findChildValue(index, QStringLiteral("name"));
+    if (node.name_.isEmpty())
+    {
+        node.name_ = findChildValue(index, QStringLiteral("instanceName"));
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(node.element_.toUtf8());
+    hash.addData(SEPARATOR);
+    hash.addData(node.value_.toUtf8());
+
+    for (int childIndex : node.children_)
+    {
+        hash.addData(SEPARATOR);
+        hash.addData(nodes_.at(childIndex).hash_);
+    }
+
+    node.hash_ = hash.result();
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHashTree::findChildValue()
+//-----------------------------------------------------------------------------
+QString StructuralHashTree::findChildValue(int index, QString const& element) const
+{
+    for (int childIndex : nodes_.at(index).children_)
+    {
+        Node const& child = nodes_.at(childIndex);
+        if (child.element_ == element && child.children_.isEmpty())
+        {
+            return child.value_;
+        }
+    }
+
+    return QString();
+}
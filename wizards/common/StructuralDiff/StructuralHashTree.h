@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------------
+// File: StructuralHashTree.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author:
+// Date: 19.10.2026
+//
+// Description:
+// Tree of structural hashes for the elements of an IP-XACT document.
+//-----------------------------------------------------------------------------
+
+#ifndef STRUCTURALHASHTREE_H
+#define STRUCTURALHASHTREE_H
+
+#include <QByteArray>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+class Document;
+class QIODevice;
+
+//-----------------------------------------------------------------------------
+//! Tree of structural hashes for the elements of an IP-XACT document.
+//!
+//! Every XML element of the document is a node in the tree. Attributes are stored as child nodes named with a
+//! leading @. The hash of a node covers the element name, its text and the hashes of its children, so two
+//! subtrees with equal hashes are identical and need not be compared further.
+//-----------------------------------------------------------------------------
+class StructuralHashTree
+{
+public:
+
+    //! A single element in the tree.
+    struct Node
+    {
+        //! The local name of the element, e.g. register.
+        QString element_;
+
+        //! The value of the name or instanceName child element, if any.
+        QString name_;
+
+        //! The text content of the element.
+        QString value_;
+
+        //! The structural hash of the element and its children.
+        QByteArray hash_;
+
+        //! Indexes of the child nodes in document order.
+        QVector<int> children_;
+    };
+
+    //! The constructor.
+    StructuralHashTree() = default;
+
+    //! The destructor.
+    ~StructuralHashTree() = default;
+
+    /*!
+     *  Builds the tree from an XML document.
+     *
+     *    @param [in] device  The device to read the document from.
+     *
+     *    @return True, if the document was read successfully, otherwise false.
+     */
+    bool read(QIODevice* device);
+
+    /*!
+     *  Builds the tree from an XML file.
+     *
+     *    @param [in] path    Path to the file.
+     *
+     *    @return True, if the file was read successfully, otherwise false.
+     */
+    bool readFile(QString const& path);
+
+    /*!
+     *  Builds the tree from a document model.
+     *
+     *    @param [in] document    The document to build the tree for.
+     *
+     *    @return True, if the document was serialized successfully, otherwise false.
+     */
+    bool readDocument(QSharedPointer<Document> document);
+
+    /*!
+     *  Checks if the tree has no nodes.
+     *
+     *    @return True, if the tree is empty, otherwise false.
+     */
+    bool isEmpty() const;
+
+    /*!
+     *  Gets a node in the tree. The root node is at index 0.
+     *
+     *    @param [in] index   Index of the node.
+     *
+     *    @return The node at the given index.
+     */
+    Node const& getNode(int index) const;
+
+    /*!
+     *  Gets the hash of the whole document.
+     *
+     *    @return The hash of the root node, or an empty array for an empty tree.
+     */
+    QByteArray getRootHash() const;
+
+    /*!
+     *  Gets the VLNV of the document from the vendor, library, name and version elements of the root.
+     *
+     *    @return The VLNV as vendor:library:name:version, or an empty string if the VLNV is not found.
+     */
+    QString getVLNV() const;
+
+    /*!
+     *  Gets the description of the last read error.
+     *
+     *    @return The error description.
+     */
+    QString getErrorString() const;
+
+private:
+
+    /*!
+     *  Calculates the name and hash of a node once all its children have been read.
+     *
+     *    @param [in] index   Index of the node.
+     */
+    void finishNode(int index);
+
+    /*!
+     *  Finds the value of a leaf child element.
+     *
+     *    @param [in] index       Index of the parent node.
+     *    @param [in] element     Name of the child element.
+     *
+     *    @return The value of the first matching child, or an empty string if none is found.
+     */
+    QString findChildValue(int index, QString const& element) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The nodes of the tree with the root at index 0.
+    QVector<Node> nodes_;
+
+    //! Description of the last read error.
+    QString errorString_;
+};
+
+#endif // STRUCTURALHASHTREE_H